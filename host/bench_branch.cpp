@@ -0,0 +1,231 @@
+/*
+ *  bench_branch.cpp - PC translation cache check and benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Runs hand-assembled 68k programs dominated by control transfers that go
+ *  through m68k_setpc(): nested JSR/RTS as in the Finder event loop, JSR
+ *  (An) through a jump table as in the QuickDraw and Toolbox dispatchers,
+ *  and calls from RAM into a ROM routine and back. Each program runs with
+ *  the PC translation cache off (every jump translated through the bank
+ *  table) and on; registers, flags and instruction counts must match, and
+ *  the report gives MIPS for both.
+ *
+ *  Usage:
+ *    basilisk_host --bench branch [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "blockcache.h"
+
+#if USE_PC_CACHE
+
+const uint32 BRANCH_RAM_SIZE = 1024 * 1024;
+const uaecptr CODE_BASE = 0x10000;
+const uint32 ROM_ROUTINE = 0x100;       // Offset of the ROM routine
+
+// Program writer; ROM code is written to host memory since ROM writes are
+// ignored
+class code_writer {
+public:
+    code_writer(uaecptr base, uint8 *host = NULL) : pc(base), start(base), host(host) {}
+    void w(uint16 v) {
+        if (host) {
+            host[pc - start] = v >> 8;
+            host[pc - start + 1] = v;
+        } else
+            WriteMacInt16(pc, v);
+        pc += 2;
+    }
+    void l(uint32 v) { w(v >> 16); w(v); }
+    void patch_w(uaecptr at, uint16 v) { WriteMacInt16(at, v); }
+    void patch_l(uaecptr at, uint32 v) { WriteMacInt32(at, v); }
+    uaecptr pc;
+private:
+    uaecptr start;
+    uint8 *host;
+};
+
+/*
+ *  Test programs. Each is entered with Execute68k() and ends with RTS;
+ *  "n" is the loop count.
+ */
+
+// Nested subroutine calls
+static void load_calls(uint32 n)
+{
+    code_writer c(CODE_BASE);
+    c.w(0x2e3c); c.l(n);            //     move.l  #n,d7
+    uaecptr loop = c.pc;
+    c.w(0x4eba);                    // 1$: jsr     2$(pc)
+    uaecptr call1 = c.pc; c.w(0);
+    c.w(0x5387);                    //     subq.l  #1,d7
+    c.w(0x6600 | (uint8)(loop - (c.pc + 2)));   // bne.s 1$
+    c.w(0x4e75);                    //     rts
+    c.patch_w(call1, c.pc - call1);
+    c.w(0x5281);                    // 2$: addq.l  #1,d1
+    c.w(0x4eba);                    //     jsr     3$(pc)
+    uaecptr call2 = c.pc; c.w(0);
+    c.w(0x4e75);                    //     rts
+    c.patch_w(call2, c.pc - call2);
+    c.w(0xd481);                    // 3$: add.l   d1,d2
+    c.w(0x4e75);                    //     rts
+}
+
+// Calls through a jump table indexed by the loop counter
+static void load_dispatch(uint32 n)
+{
+    code_writer c(CODE_BASE);
+    c.w(0x2e3c); c.l(n);            //     move.l  #n,d7
+    c.w(0x43fa);                    //     lea     table(pc),a1
+    uaecptr lea = c.pc; c.w(0);
+    uaecptr loop = c.pc;
+    c.w(0x2007);                    // 1$: move.l  d7,d0
+    c.w(0x0240); c.w(0x0003);       //     andi.w  #3,d0
+    c.w(0x2071); c.w(0x0400);       //     movea.l 0(a1,d0.w*4),a0
+    c.w(0x4e90);                    //     jsr     (a0)
+    c.w(0x5387);                    //     subq.l  #1,d7
+    c.w(0x6600 | (uint8)(loop - (c.pc + 2)));   // bne.s 1$
+    c.w(0x4e75);                    //     rts
+
+    static const uint16 handlers[4] = {
+        0x5281,                     // addq.l  #1,d1
+        0xd487,                     // add.l   d7,d2
+        0xbf83,                     // eor.l   d7,d3
+        0x9887,                     // sub.l   d7,d4
+    };
+    uaecptr entry[4];
+    for (int i = 0; i < 4; i++) {
+        entry[i] = c.pc;
+        c.w(handlers[i]);
+        c.w(0x4e75);                //     rts
+    }
+    c.patch_w(lea, c.pc - lea);
+    for (int i = 0; i < 4; i++)     // table: dc.l h0,h1,h2,h3
+        c.l(entry[i]);
+}
+
+// Calls from RAM into a ROM routine and back
+static void load_rom(uint32 n)
+{
+    code_writer r(ROMBaseMac + ROM_ROUTINE, ROMBaseHost + ROM_ROUTINE);
+    r.w(0xd487);                    //     add.l   d7,d2
+    r.w(0xe39a);                    //     rol.l   #1,d2
+    r.w(0x4e75);                    //     rts
+
+    code_writer c(CODE_BASE);
+    c.w(0x2e3c); c.l(n);            //     move.l  #n,d7
+    uaecptr loop = c.pc;
+    c.w(0x4eb9); c.l(ROMBaseMac + ROM_ROUTINE);  // 1$: jsr routine
+    c.w(0x5387);                    //     subq.l  #1,d7
+    c.w(0x6600 | (uint8)(loop - (c.pc + 2)));   // bne.s 1$
+    c.w(0x4e75);                    //     rts
+}
+
+struct branch_program {
+    const char *name;
+    void (*load)(uint32 n);
+};
+
+static const branch_program programs[] = {
+    { "calls", load_calls },
+    { "dispatch", load_dispatch },
+    { "rom", load_rom },
+};
+
+struct branch_result {
+    uint32 d[8], a[8];
+    uint16 sr;
+    uint64 instructions;
+    uint64 usec;
+};
+
+static void run_program(const branch_program &p, uint32 n, bool pc_cache, branch_result &res)
+{
+    memset(RAMBaseHost + CODE_BASE, 0, 0x1000);
+    p.load(n);
+
+    pc_cache_enabled = pc_cache;
+    pc_xlate_flush();
+#if USE_BLOCK_CACHE
+    block_cache_flush();
+#endif
+
+    M68kRegisters r;
+    memset(&r, 0, sizeof(r));
+    uint64 insns = HostEmulatedInstructions();
+    uint64 start = HostWallMicros();
+    Execute68k(CODE_BASE, &r);
+    res.usec = HostWallMicros() - start;
+    res.instructions = HostEmulatedInstructions() - insns;
+
+    memcpy(res.d, r.d, sizeof(res.d));
+    memcpy(res.a, r.a, sizeof(res.a));
+    MakeSR();
+    res.sr = regs.sr;
+}
+
+static bool same_result(const branch_result &x, const branch_result &y)
+{
+    return !memcmp(x.d, y.d, sizeof(x.d)) && !memcmp(x.a, y.a, sizeof(x.a))
+        && x.sr == y.sr && x.instructions == y.instructions;
+}
+
+static double mips(const branch_result &res)
+{
+    return res.usec ? res.instructions / (double)res.usec : 0.0;
+}
+
+int HostBenchBranch(uint64 iterations)
+{
+    if (!HostBenchInit(BRANCH_RAM_SIZE)) {
+        fprintf(stderr, "Branch benchmark setup failed\n");
+        return 1;
+    }
+
+    printf("bench=branch\n");
+    bool all_match = true;
+    for (size_t i = 0; i < sizeof(programs) / sizeof(programs[0]); i++) {
+        const branch_program &p = programs[i];
+        branch_result plain, cached;
+        run_program(p, iterations, false, plain);
+        run_program(p, iterations, true, cached);
+        bool match = same_result(plain, cached);
+        all_match &= match;
+
+        printf("branch.%s.instructions=%llu\n", p.name, (unsigned long long)plain.instructions);
+        printf("branch.%s.banks_mips=%.2f\n", p.name, mips(plain));
+        printf("branch.%s.pc_cache_mips=%.2f\n", p.name, mips(cached));
+        printf("branch.%s.match=%d\n", p.name, match);
+        if (!match) {
+            fprintf(stderr, "branch.%s: d1 %08x/%08x d2 %08x/%08x sr %04x/%04x insns %llu/%llu\n",
+                    p.name, plain.d[1], cached.d[1], plain.d[2], cached.d[2], plain.sr, cached.sr,
+                    (unsigned long long)plain.instructions, (unsigned long long)cached.instructions);
+        }
+    }
+    printf("match=%d\n", all_match);
+
+    pc_cache_enabled = true;
+    Exit680x0();
+    return all_match ? 0 : 1;
+}
+
+#else
+
+int HostBenchBranch(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without USE_PC_CACHE, nothing to compare\n");
+    return 1;
+}
+
+#endif /* USE_PC_CACHE */
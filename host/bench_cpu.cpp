@@ -0,0 +1,246 @@
+/*
+ *  bench_cpu.cpp - Synthetic 68k CPU benchmark and equivalence check
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Runs small hand-assembled 68k programs on the real interpreter without a
+ *  Mac ROM: first through the plain dispatch loop, then through the block
+ *  cache. Final registers, condition codes and a hash of the touched memory
+ *  must match exactly; the report gives MIPS for both paths.
+ *
+ *  Usage:
+ *    basilisk_host --bench cpu [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "rom_patches.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "blockcache.h"
+
+// Memory layout inside the 8MB of benchmark RAM
+const uint32 BENCH_RAM_SIZE = 8 * 1024 * 1024;
+const uint32 BENCH_ROM_SIZE = 64 * 1024;
+const uaecptr CODE_BASE = 0x10000;
+const uaecptr DATA_BASE = 0x100000;
+const uint32 DATA_SIZE = 0x20000;
+const uint32 COPY_LONGS = 1024;
+
+// Program writer
+class code_writer {
+public:
+    code_writer(uaecptr base) : pc(base) {}
+    void w(uint16 v) { WriteMacInt16(pc, v); pc += 2; }
+    void l(uint32 v) { WriteMacInt32(pc, v); pc += 4; }
+    uaecptr pc;
+};
+
+/*
+ *  Test programs. Each is entered with Execute68k() and ends with RTS;
+ *  "n" is the outer loop count.
+ */
+
+// Register arithmetic, short backward branch
+static void load_arith(uaecptr base, uint32 n)
+{
+    code_writer c(base);
+    c.w(0x203c); c.l(n);    //     move.l  #n,d0
+    c.w(0x7200);            //     moveq   #0,d1
+    c.w(0x7400);            //     moveq   #0,d2
+    c.w(0xd280);            // 1$: add.l   d0,d1
+    c.w(0xb382);            //     eor.l   d1,d2
+    c.w(0xe79a);            //     rol.l   #3,d2
+    c.w(0x5380);            //     subq.l  #1,d0
+    c.w(0x66f6);            //     bne.s   1$
+    c.w(0x4e75);            //     rts
+}
+
+// Block copy with postincrement and DBRA, as in BlockMove()
+static void load_copy(uaecptr base, uint32 n)
+{
+    code_writer c(base);
+    c.w(0x2e3c); c.l(n);                    //     move.l  #n,d7
+    c.w(0x207c); c.l(DATA_BASE);            // 1$: movea.l #src,a0
+    c.w(0x227c); c.l(DATA_BASE + 0x10000);  //     movea.l #dst,a1
+    c.w(0x303c); c.w(COPY_LONGS - 1);       //     move.w  #count-1,d0
+    c.w(0x22d8);                            // 2$: move.l  (a0)+,(a1)+
+    c.w(0x51c8); c.w(0xfffc);               //     dbra    d0,2$
+    c.w(0x5387);                            //     subq.l  #1,d7
+    c.w(0x66e6);                            //     bne.s   1$
+    c.w(0x4e75);                            //     rts
+}
+
+// Subroutine calls with memory read-modify-write
+static void load_call(uaecptr base, uint32 n)
+{
+    code_writer c(base);
+    c.w(0x2e3c); c.l(n);            //     move.l  #n,d7
+    c.w(0x207c); c.l(DATA_BASE);    //     movea.l #data,a0
+    c.w(0x6100); c.w(0x0008);       // 1$: bsr.w   2$
+    c.w(0x5387);                    //     subq.l  #1,d7
+    c.w(0x66f8);                    //     bne.s   1$
+    c.w(0x4e75);                    //     rts
+    c.w(0x5290);                    // 2$: addq.l  #1,(a0)
+    c.w(0xd090);                    //     add.l   (a0),d0
+    c.w(0x4a80);                    //     tst.l   d0
+    c.w(0x6a02);                    //     bpl.s   3$
+    c.w(0x4480);                    //     neg.l   d0
+    c.w(0x4e75);                    // 3$: rts
+}
+
+// Self-modifying code: the loop bumps the immediate of its own MOVEQ
+static void load_smc(uaecptr base, uint32 n)
+{
+    code_writer c(base);
+    c.w(0x2e3c); c.l(n);            //     move.l  #n,d7
+    c.w(0x7000);                    //     moveq   #0,d0
+    c.w(0x41fa); c.w(0x0002);       //     lea     1$(pc),a0
+    c.w(0x7201);                    // 1$: moveq   #1,d1
+    c.w(0xd081);                    //     add.l   d1,d0
+    c.w(0x5228); c.w(0x0001);       //     addq.b  #1,1(a0)
+    c.w(0x5387);                    //     subq.l  #1,d7
+    c.w(0x66f4);                    //     bne.s   1$
+    c.w(0x4e75);                    //     rts
+}
+
+struct bench_program {
+    const char *name;
+    void (*load)(uaecptr base, uint32 n);
+    uint32 scale;       // Divides the iteration count for long inner loops
+};
+
+static const bench_program programs[] = {
+    { "arith", load_arith, 1 },
+    { "copy", load_copy, COPY_LONGS },
+    { "call", load_call, 1 },
+    { "smc", load_smc, 1 },
+};
+
+struct bench_result {
+    uint32 d[8], a[8];
+    uint16 sr;
+    uint32 mem_hash;
+    uint64 instructions;
+    uint64 usec;
+};
+
+static uint32 hash_ram(uaecptr start, uint32 size)
+{
+    uint32 hash = 2166136261u;
+    for (uint32 i = 0; i < size; i++)
+        hash = (hash ^ RAMBaseHost[start + i]) * 16777619u;
+    return hash;
+}
+
+static void run_program(const bench_program &p, uint32 n, bool cached, bench_result &res)
+{
+    // Same starting memory for every run
+    memset(RAMBaseHost + CODE_BASE, 0, 0x1000);
+    for (uint32 i = 0; i < DATA_SIZE; i++)
+        RAMBaseHost[DATA_BASE + i] = (uint8)(i * 37 + (i >> 8));
+    p.load(CODE_BASE, n);
+
+#if USE_BLOCK_CACHE
+    block_cache_enabled = cached;
+    block_cache_flush();
+#endif
+
+    M68kRegisters r;
+    memset(&r, 0, sizeof(r));
+    uint64 insns = HostEmulatedInstructions();
+    uint64 start = HostWallMicros();
+    Execute68k(CODE_BASE, &r);
+    res.usec = HostWallMicros() - start;
+    res.instructions = HostEmulatedInstructions() - insns;
+
+    memcpy(res.d, r.d, sizeof(res.d));
+    memcpy(res.a, r.a, sizeof(res.a));
+    MakeSR();
+    res.sr = regs.sr;
+    res.mem_hash = hash_ram(CODE_BASE, 0x1000) ^ hash_ram(DATA_BASE, DATA_SIZE);
+}
+
+static bool same_result(const bench_result &x, const bench_result &y)
+{
+    return !memcmp(x.d, y.d, sizeof(x.d)) && !memcmp(x.a, y.a, sizeof(x.a))
+        && x.sr == y.sr && x.mem_hash == y.mem_hash && x.instructions == y.instructions;
+}
+
+static double mips(const bench_result &res)
+{
+    return res.usec ? res.instructions / (double)res.usec : 0.0;
+}
+
+/*
+ *  Set up a ROM-less machine with just RAM and a blank ROM bank
+ */
+bool HostBenchInit(uint32 ram_size)
+{
+    RAMSize = ram_size;
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize);
+    ROMSize = BENCH_ROM_SIZE;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    if (!RAMBaseHost || !ROMBaseHost)
+        return false;
+    MacFrameLayout = FLAYOUT_NONE;
+    ROMVersion = ROM_VERSION_32;
+    if (!Init680x0())
+        return false;
+    m68k_reset();
+    HostStartProfiler();
+    return true;
+}
+
+int HostBenchCPU(uint64 iterations)
+{
+    if (!HostBenchInit(BENCH_RAM_SIZE)) {
+        fprintf(stderr, "CPU benchmark setup failed\n");
+        return 1;
+    }
+
+    printf("bench=cpu\n");
+    bool all_match = true;
+    for (size_t i = 0; i < sizeof(programs) / sizeof(programs[0]); i++) {
+        const bench_program &p = programs[i];
+        uint32 n = iterations / p.scale;
+        if (n == 0) n = 1;
+
+        bench_result plain, cached;
+        run_program(p, n, false, plain);
+        run_program(p, n, true, cached);
+        bool match = same_result(plain, cached);
+        all_match &= match;
+
+        printf("cpu.%s.instructions=%llu\n", p.name, (unsigned long long)plain.instructions);
+        printf("cpu.%s.interp_mips=%.2f\n", p.name, mips(plain));
+        printf("cpu.%s.cached_mips=%.2f\n", p.name, mips(cached));
+        printf("cpu.%s.match=%d\n", p.name, match);
+        if (!match) {
+            fprintf(stderr, "cpu.%s: d0 %08x/%08x d1 %08x/%08x sr %04x/%04x mem %08x/%08x insns %llu/%llu\n",
+                    p.name, plain.d[0], cached.d[0], plain.d[1], cached.d[1], plain.sr, cached.sr,
+                    plain.mem_hash, cached.mem_hash,
+                    (unsigned long long)plain.instructions, (unsigned long long)cached.instructions);
+        }
+    }
+
+#if USE_BLOCK_CACHE
+    printf("block_cache.hits=%u\n", block_stats.hits);
+    printf("block_cache.misses=%u\n", block_stats.misses);
+    printf("block_cache.invalidations=%u\n", block_stats.invalidations);
+    printf("block_cache.storms=%u\n", block_stats.storms);
+#if USE_FLAG_LIVENESS
+    printf("block_cache.noflags=%u\n", block_stats.noflags);
+#endif
+#endif
+    printf("match=%d\n", all_match);
+
+    Exit680x0();
+    return all_match ? 0 : 1;
+}
@@ -0,0 +1,367 @@
+/*
+ *  bench_dirty.cpp - Write-time dirty tile marking check and benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Compares the table-driven VideoMarkDirtyOffset()/VideoMarkDirtyRange()
+ *  in video_dirty.cpp with a copy of the division-based versions they
+ *  replaced. For every depth, every byte offset and a set of store sizes
+ *  (1, 2 and 4 bytes at every offset, plus longer row and multi-row
+ *  blocks) must mark exactly the same tiles; with USE_DIRTY_PAGES, page
+ *  marking must mark at least the tiles of every byte written. Then all
+ *  are timed over
+ *  QuickDraw-style store streams:
+ *
+ *    fill    FillRect of a 200x120 rectangle, long stores with byte/word
+ *            edges as in the blitter loops
+ *    text    8x12 glyphs drawn with byte stores along a line of text
+ *    scroll  a window-wide CopyBits, long stores over the whole screen
+ *    lines   vertical lines, one byte store per row
+ *
+ *  The bitmap is collected (as the video task does once per frame) after
+ *  every pass over a stream. The report gives the cost per store, which
+ *  the emulation core pays, and per collect, which the video task pays,
+ *  plus the number of tiles each method leaves to redraw.
+ *
+ *  Usage:
+ *    basilisk_host --bench dirty [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "main.h"
+#include "video.h"
+#include "video_dirty.h"
+#include "host.h"
+
+const uint32 SCREEN_WIDTH = 640;
+const uint32 SCREEN_HEIGHT = 360;
+
+/*
+ *  The marking code as it was before the lookup tables
+ */
+static uint32 ref_tiles[TILE_WORDS];
+static uint32 ref_bpr, ref_ppb, ref_frame_size;
+
+static void ref_mark_offset(uint32 offset)
+{
+    if (offset >= ref_frame_size) return;
+    uint32 bpr = ref_bpr;
+    int ppb = ref_ppb;
+    int y = offset / bpr;
+    if (y >= (int)SCREEN_HEIGHT) return;
+    int byte_in_row = offset % bpr;
+    int pixel_start = byte_in_row * ppb;
+    int pixel_end = pixel_start + ppb - 1;
+    if (pixel_start >= (int)SCREEN_WIDTH) return;
+    if (pixel_end >= (int)SCREEN_WIDTH) pixel_end = SCREEN_WIDTH - 1;
+    int tile_x_start = pixel_start / TILE_WIDTH;
+    int tile_x_end = pixel_end / TILE_WIDTH;
+    int tile_y = y / TILE_HEIGHT;
+    for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
+        int tile_idx = tile_y * TILES_X + tile_x;
+        if (tile_idx < TOTAL_TILES)
+            __atomic_or_fetch(&ref_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
+    }
+}
+
+static void ref_mark_range(uint32 offset, uint32 size)
+{
+    if (offset >= ref_frame_size) return;
+    if (offset + size > ref_frame_size)
+        size = ref_frame_size - offset;
+    uint32 bpr = ref_bpr;
+    int ppb = ref_ppb;
+    int start_y = offset / bpr;
+    int end_y = (offset + size - 1) / bpr;
+    if (end_y == start_y && size <= 4) {
+        ref_mark_offset(offset);
+        if (size > 1)
+            ref_mark_offset(offset + size - 1);
+        return;
+    }
+    int start_byte_in_row = offset % bpr;
+    int end_byte_in_row = (offset + size - 1) % bpr;
+    int pixel_col_start = start_byte_in_row * ppb;
+    int pixel_col_end = (end_byte_in_row + 1) * ppb - 1;
+    if (end_y > start_y) {
+        pixel_col_start = 0;
+        pixel_col_end = SCREEN_WIDTH - 1;
+    }
+    int tile_x_start = pixel_col_start / TILE_WIDTH;
+    int tile_x_end = pixel_col_end / TILE_WIDTH;
+    if (tile_x_end >= TILES_X) tile_x_end = TILES_X - 1;
+    int tile_y_start = start_y / TILE_HEIGHT;
+    int tile_y_end = end_y / TILE_HEIGHT;
+    if (tile_y_end >= TILES_Y) tile_y_end = TILES_Y - 1;
+    for (int tile_y = tile_y_start; tile_y <= tile_y_end; tile_y++) {
+        for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
+            int tile_idx = tile_y * TILES_X + tile_x;
+            __atomic_or_fetch(&ref_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void set_mode(video_depth depth)
+{
+    static const uint32 ppb[] = {8, 4, 2, 1};
+    ref_ppb = ppb[depth];
+    ref_bpr = TrivialBytesPerRow(SCREEN_WIDTH, depth);
+    ref_frame_size = SCREEN_WIDTH * SCREEN_HEIGHT;
+    memset(ref_tiles, 0, sizeof(ref_tiles));
+    VideoDirtySetMode(SCREEN_WIDTH, SCREEN_HEIGHT, depth, ref_bpr, ref_frame_size);
+}
+
+// One store against both implementations; true if they marked the same
+// tiles. With superset, the new code must mark at least the tiles of every
+// byte written (the old code marks whole tile rows for stores that cross a
+// row).
+static bool same_tiles(uint32 offset, uint32 size, bool superset)
+{
+    uint32 tiles[TILE_WORDS];
+    memset(ref_tiles, 0, sizeof(ref_tiles));
+    if (superset) {
+        for (uint32 i = 0; i < size; i++)
+            ref_mark_offset(offset + i);
+    } else if (size == 1)
+        ref_mark_offset(offset);
+    else
+        ref_mark_range(offset, size);
+    if (size == 1)
+        VideoMarkDirtyOffset(offset);
+    else
+        VideoMarkDirtyRange(offset, size);
+    VideoDirtyCollect(tiles);
+    if (!superset)
+        return !memcmp(tiles, ref_tiles, sizeof(tiles));
+    for (int w = 0; w < TILE_WORDS; w++)
+        if ((tiles[w] & ref_tiles[w]) != ref_tiles[w])
+            return false;
+    return true;
+}
+
+/*
+ *  QuickDraw-style store streams, as (offset, size) pairs
+ */
+struct store {
+    uint32 offset;
+    uint32 size;
+};
+
+static void add(vector<store> &s, uint32 offset, uint32 size)
+{
+    store st = {offset, size};
+    s.push_back(st);
+}
+
+// Stores covering bytes [start, end) of one row the way the blitter does:
+// leading byte and word, longs, trailing word and byte
+static void add_span(vector<store> &s, uint32 start, uint32 end)
+{
+    uint32 p = start;
+    if ((p & 1) && p < end) add(s, p++, 1);
+    if ((p & 2) && p + 2 <= end) { add(s, p, 2); p += 2; }
+    for (; p + 4 <= end; p += 4) add(s, p, 4);
+    if (p + 2 <= end) { add(s, p, 2); p += 2; }
+    if (p < end) add(s, p, 1);
+}
+
+static void make_fill(vector<store> &s, uint32 bpr, uint32 ppb)
+{
+    const uint32 x = 37, y = 53, w = 200, h = 120;
+    for (uint32 row = y; row < y + h; row++)
+        add_span(s, row * bpr + x / ppb, row * bpr + (x + w + ppb - 1) / ppb);
+}
+
+static void make_text(vector<store> &s, uint32 bpr, uint32 ppb)
+{
+    const uint32 x = 12, y = 200, glyphs = 70, glyph_w = 8, glyph_h = 12;
+    for (uint32 g = 0; g < glyphs; g++) {
+        uint32 gx = x + g * glyph_w;
+        for (uint32 row = y; row < y + glyph_h; row++)
+            for (uint32 b = gx / ppb; b < (gx + glyph_w + ppb - 1) / ppb; b++)
+                add(s, row * bpr + b, 1);
+    }
+}
+
+static void make_scroll(vector<store> &s, uint32 bpr, uint32 ppb)
+{
+    UNUSED(ppb);
+    for (uint32 row = 20; row < SCREEN_HEIGHT; row++)
+        add_span(s, row * bpr, row * bpr + bpr);
+}
+
+static void make_lines(vector<store> &s, uint32 bpr, uint32 ppb)
+{
+    for (uint32 x = 5; x < SCREEN_WIDTH; x += 45)
+        for (uint32 row = 0; row < SCREEN_HEIGHT; row++)
+            add(s, row * bpr + x / ppb, 1);
+}
+
+struct fill_pattern {
+    const char *name;
+    void (*make)(vector<store> &s, uint32 bpr, uint32 ppb);
+};
+
+static const fill_pattern patterns[] = {
+    { "fill", make_fill },
+    { "text", make_text },
+    { "scroll", make_scroll },
+    { "lines", make_lines },
+};
+
+enum mark_mode {
+    MARK_DIVIDE,        // The code before the lookup tables
+    MARK_TABLES,        // Lookup tables, tile per store
+    MARK_PAGES,         // Page per store, tiles at collect time
+};
+
+static const char *mark_mode_names[] = {"divide", "table", "page"};
+
+static void mark_stream(const vector<store> &s, mark_mode mode)
+{
+    if (mode == MARK_DIVIDE) {
+        for (size_t i = 0; i < s.size(); i++) {
+            if (s[i].size == 1)
+                ref_mark_offset(s[i].offset);
+            else
+                ref_mark_range(s[i].offset, s[i].size);
+        }
+    } else {
+        // Before and after each store, as the frame buffer bank does
+        for (size_t i = 0; i < s.size(); i++) {
+            if (s[i].size == 1) {
+                VideoMarkDirtyOffset(s[i].offset);
+                VideoMarkDirtyOffset(s[i].offset);
+            } else {
+                VideoMarkDirtyRange(s[i].offset, s[i].size);
+                VideoMarkDirtyRange(s[i].offset, s[i].size);
+            }
+        }
+    }
+}
+
+static int collect(uint32 *tiles, mark_mode mode)
+{
+    if (mode != MARK_DIVIDE)
+        return VideoDirtyCollect(tiles);
+    int count = 0;
+    for (int w = 0; w < TILE_WORDS; w++) {
+        tiles[w] = __atomic_exchange_n(&ref_tiles[w], 0, __ATOMIC_RELAXED);
+        count += __builtin_popcount(tiles[w]);
+    }
+    return count;
+}
+
+static void set_mark_mode(mark_mode mode)
+{
+#if USE_DIRTY_PAGES
+    dirty_pages_enabled = mode == MARK_PAGES;
+#else
+    UNUSED(mode);
+#endif
+}
+
+/*
+ *  Replays the stream, one "frame" per pass, until at least count stores
+ *  are done. Marking (emulation core) and collecting (video task) are
+ *  timed separately.
+ */
+struct stream_timing {
+    double store_ns;        // Per store
+    double collect_ns;      // Per frame
+};
+
+static stream_timing time_stream(const vector<store> &s, uint64 count, mark_mode mode)
+{
+    uint32 tiles[TILE_WORDS];
+    uint64 done = 0, passes = 0, mark_ns = 0, collect_ns = 0;
+    set_mark_mode(mode);
+    while (done < count) {
+        uint64 t0 = HostWallNanos();
+        mark_stream(s, mode);
+        uint64 t1 = HostWallNanos();
+        collect(tiles, mode);
+        uint64 t2 = HostWallNanos();
+        mark_ns += t1 - t0;
+        collect_ns += t2 - t1;
+        done += s.size();
+        passes++;
+    }
+    stream_timing t = {(double)mark_ns / done, (double)collect_ns / passes};
+    return t;
+}
+
+int HostBenchDirty(uint64 iterations)
+{
+    static const char *depth_names[] = {"1bit", "2bit", "4bit", "8bit"};
+    static const uint32 block_sizes[] = {1, 2, 3, 4, 8, 17, 64, 639, 640, 641, 1300, 30000};
+    const int modes = USE_DIRTY_PAGES ? 3 : 2;
+
+    printf("bench=dirty\n");
+    uint32 mismatches = 0;
+    for (int d = VDEPTH_1BIT; d <= VDEPTH_8BIT; d++) {
+        video_depth depth = (video_depth)d;
+        set_mode(depth);
+        uint32 bpr = ref_bpr, ppb = ref_ppb;
+
+        // Every offset, every store size: tables must match exactly, pages
+        // may only add tiles
+        for (int m = MARK_TABLES; m < modes; m++) {
+            set_mark_mode((mark_mode)m);
+            for (uint32 offset = 0; offset < ref_frame_size + 8; offset++) {
+                for (size_t i = 0; i < sizeof(block_sizes) / sizeof(block_sizes[0]); i++) {
+                    uint32 size = block_sizes[i];
+                    if (size > 4 && offset % 7)
+                        continue;
+                    if (size > 1300 && m == MARK_PAGES)
+                        continue;
+                    if (!same_tiles(offset, size, m == MARK_PAGES)) {
+                        if (mismatches < 10)
+                            fprintf(stderr, "dirty.%s: %u-byte store at %u marks different tiles (%s)\n",
+                                    depth_names[d], size, offset, mark_mode_names[m]);
+                        mismatches++;
+                    }
+                }
+            }
+        }
+
+        for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+            vector<store> s;
+            patterns[p].make(s, bpr, ppb);
+            const char *name = patterns[p].name;
+            printf("dirty.%s.%s.stores=%u\n", depth_names[d], name, (uint32)s.size());
+
+            // Tiles one pass over the stream dirties
+            uint32 ref[TILE_WORDS];
+            mark_stream(s, MARK_DIVIDE);
+            collect(ref, MARK_DIVIDE);
+            for (int m = MARK_TABLES; m < modes; m++) {
+                uint32 tiles[TILE_WORDS];
+                set_mark_mode((mark_mode)m);
+                mark_stream(s, (mark_mode)m);
+                int count = collect(tiles, (mark_mode)m);
+                bool ok = true;
+                for (int w = 0; w < TILE_WORDS; w++)
+                    ok &= m == MARK_PAGES ? (tiles[w] & ref[w]) == ref[w] : tiles[w] == ref[w];
+                if (!ok) {
+                    fprintf(stderr, "dirty.%s.%s: stream marks different tiles (%s)\n",
+                            depth_names[d], name, mark_mode_names[m]);
+                    mismatches++;
+                }
+                printf("dirty.%s.%s.%s_tiles=%d\n", depth_names[d], name, mark_mode_names[m], count);
+            }
+
+            for (int m = MARK_DIVIDE; m < modes; m++) {
+                time_stream(s, s.size(), (mark_mode)m);     // Warm up
+                stream_timing t = time_stream(s, iterations, (mark_mode)m);
+                printf("dirty.%s.%s.%s_store_ns=%.2f\n", depth_names[d], name, mark_mode_names[m], t.store_ns);
+                printf("dirty.%s.%s.%s_collect_ns=%.0f\n", depth_names[d], name, mark_mode_names[m], t.collect_ns);
+            }
+        }
+    }
+    set_mark_mode(MARK_PAGES);
+    printf("dirty.mismatches=%u\n", mismatches);
+    printf("match=%d\n", mismatches == 0);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/*
+ *  bench_dispatch.cpp - Compact dispatch table check and lookup benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Checks that the two-level table generated by gencpu (cpudispatch.cpp)
+ *  gives the same handler as cpufunctbl for all 65536 opcodes, then times
+ *  both lookups over a pseudo-random stream of legal opcodes. The handlers
+ *  are not called, so the numbers are the table walk alone; on the host
+ *  both tables sit in cache and the flat one wins, on the device the flat
+ *  one is in PSRAM (README, Compact Dispatch Table).
+ *
+ *  Usage:
+ *    basilisk_host --bench dispatch [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+
+#if USE_COMPACT_DISPATCH
+
+const uint32 DISPATCH_RAM_SIZE = 64 * 1024;
+const uint32 STREAM_LENGTH = 4096;
+
+static uint32 rng_state = 0x2545f491;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Sum of handler addresses so the lookups cannot be optimized away
+static volatile uintptr_t sink;
+
+static uint64 time_flat(const uint16 *stream, uint64 lookups)
+{
+    uintptr_t sum = 0;
+    uint64 start = HostWallMicros();
+    for (uint64 n = 0; n < lookups; n++)
+        sum += (uintptr_t)cpufunctbl[stream[n & (STREAM_LENGTH - 1)]];
+    uint64 usec = HostWallMicros() - start;
+    sink = sum;
+    return usec;
+}
+
+static uint64 time_compact(const uint16 *stream, uint64 lookups)
+{
+    uintptr_t sum = 0;
+    uint64 start = HostWallMicros();
+    for (uint64 n = 0; n < lookups; n++)
+        sum += (uintptr_t)cpu_opcode_handler(stream[n & (STREAM_LENGTH - 1)]);
+    uint64 usec = HostWallMicros() - start;
+    sink = sum;
+    return usec;
+}
+
+int HostBenchDispatch(uint64 iterations)
+{
+    if (!HostBenchInit(DISPATCH_RAM_SIZE)) {
+        fprintf(stderr, "Dispatch benchmark setup failed\n");
+        return 1;
+    }
+
+    uint32 mismatches = 0;
+    for (uint32 opcode = 0; opcode < 65536; opcode++) {
+        if (cpu_opcode_handler(opcode) != cpufunctbl[opcode]) {
+            if (mismatches < 10)
+                fprintf(stderr, "dispatch: mismatch at opcode %04x\n", opcode);
+            mismatches++;
+        }
+    }
+
+    // Legal opcodes only, as a running program would see them
+    vector<uint16> legal;
+    for (uint32 opcode = 0; opcode < 65536; opcode++) {
+        if (table68k[opcode].mnemo != i_ILLG)
+            legal.push_back(opcode);
+    }
+    uint16 *stream = (uint16 *)malloc(STREAM_LENGTH * sizeof(uint16));
+    for (uint32 i = 0; i < STREAM_LENGTH; i++)
+        stream[i] = legal[rnd() % legal.size()];
+
+    uint64 lookups = iterations < 1000000 ? 1000000 : iterations;
+    time_flat(stream, STREAM_LENGTH);       // Warm up both tables
+    time_compact(stream, STREAM_LENGTH);
+    uint64 flat_us = time_flat(stream, lookups);
+    uint64 compact_us = time_compact(stream, lookups);
+
+    uint32 compact_bytes = cpu_dispatch.nhandlers * sizeof(cpuop_func *)
+                         + (cpu_dispatch.npages << CPUDISPATCH_PAGE_BITS) * sizeof(uae_u16)
+                         + (65536 >> CPUDISPATCH_PAGE_BITS) * sizeof(uae_u16);
+
+    printf("bench=dispatch\n");
+    printf("dispatch.handlers=%u\n", cpu_dispatch.nhandlers);
+    printf("dispatch.pages=%u\n", cpu_dispatch.npages);
+    printf("dispatch.compact_bytes=%u\n", compact_bytes);
+    printf("dispatch.flat_bytes=%u\n", (uint32)(65536 * sizeof(cpuop_func *)));
+    printf("dispatch.flat_ns=%.2f\n", flat_us * 1000.0 / lookups);
+    printf("dispatch.compact_ns=%.2f\n", compact_us * 1000.0 / lookups);
+    printf("dispatch.mismatches=%u\n", mismatches);
+    printf("match=%d\n", mismatches == 0);
+
+    free(stream);
+    Exit680x0();
+    return mismatches == 0 ? 0 : 1;
+}
+
+#else
+
+int HostBenchDispatch(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without USE_COMPACT_DISPATCH, nothing to compare\n");
+    return 1;
+}
+
+#endif /* USE_COMPACT_DISPATCH */
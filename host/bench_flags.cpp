@@ -0,0 +1,407 @@
+/*
+ *  bench_flags.cpp - Lazy condition code equivalence check
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The generated handlers are compiled a second time in this file with the
+ *  eager flag macros from m68k.h, i.e. the code gencpu emits without
+ *  --lazy-flags. Random instruction pairs then run through both handler
+ *  sets from identical machine states: the first instruction usually
+ *  leaves lazy flags pending, the second one often reads them (Bcc, Scc,
+ *  ADDX, MOVE from SR, ...). Registers, PC, materialized condition codes
+ *  and all of RAM must match after each instruction.
+ *
+ *  Usage:
+ *    basilisk_host --bench flags [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "compiler/compemu.h"
+#include "fpu/fpu.h"
+#include "blockcache.h"
+
+#include <map>
+
+#if LAZY_FLAGS
+
+// Reference handlers with eager condition codes
+#undef lazyflag_testb
+#undef lazyflag_testw
+#undef lazyflag_testl
+#undef lazyflag_addb
+#undef lazyflag_addw
+#undef lazyflag_addl
+#undef lazyflag_subb
+#undef lazyflag_subw
+#undef lazyflag_subl
+#undef lazyflag_cmpb
+#undef lazyflag_cmpw
+#undef lazyflag_cmpl
+#define lazyflag_testb(v) eagerflag_test (uae_s8, v)
+#define lazyflag_testw(v) eagerflag_test (uae_s16, v)
+#define lazyflag_testl(v) eagerflag_test (uae_s32, v)
+#define lazyflag_addb(v, s, d) eagerflag_add (uae_s8, uae_u8, v, s, d)
+#define lazyflag_addw(v, s, d) eagerflag_add (uae_s16, uae_u16, v, s, d)
+#define lazyflag_addl(v, s, d) eagerflag_add (uae_s32, uae_u32, v, s, d)
+#define lazyflag_subb(v, s, d) eagerflag_sub (uae_s8, uae_u8, v, s, d)
+#define lazyflag_subw(v, s, d) eagerflag_sub (uae_s16, uae_u16, v, s, d)
+#define lazyflag_subl(v, s, d) eagerflag_sub (uae_s32, uae_u32, v, s, d)
+#define lazyflag_cmpb(v, s, d) eagerflag_cmp (uae_s8, uae_u8, v, s, d)
+#define lazyflag_cmpw(v, s, d) eagerflag_cmp (uae_s16, uae_u16, v, s, d)
+#define lazyflag_cmpl(v, s, d) eagerflag_cmp (uae_s32, uae_u32, v, s, d)
+
+namespace eager {
+#include "cpuemu.cpp"
+#include "cpustbl.cpp"
+}
+
+// Memory layout inside 256KB of RAM (small enough to compare all of it)
+const uint32 FLAGS_RAM_SIZE = 256 * 1024;
+const uaecptr VECTOR_TARGET = 0x3000;       // Every exception vector points here
+const uaecptr CODE_BASE = 0x20000;
+const uaecptr STACK_BASE = 0x30000;
+const uaecptr LOOP_BASE = 0x38000;
+
+static cpuop_func **lazy_table = NULL;
+static cpuop_func **eager_table = NULL;
+#if USE_COMPACT_DISPATCH
+static cpuop_func **lazy_handlers = NULL;   // cpu_dispatch.handlers and its twin
+static cpuop_func **eager_handlers = NULL;
+#endif
+
+static uint32 rng_state = 0x2545f491;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Operand values that hit the carry/overflow/sign corners half of the time
+static uint32 rnd_value(void)
+{
+    static const uint32 corners[] = {
+        0, 1, 0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0xffff,
+        0x7fffffff, 0x80000000, 0xffffffff, 0xfffffffe,
+    };
+    if (rnd() & 1)
+        return rnd();
+    return corners[rnd() % (sizeof(corners) / sizeof(corners[0]))];
+}
+
+/*
+ *  Map every lazy handler in cpufunctbl to its eager twin
+ */
+static void build_eager_table(void)
+{
+    std::map<cpuop_func *, cpuop_func *> twin;
+    for (int i = 0; op_smalltbl_0_ff[i].handler != NULL; i++)
+        twin[op_smalltbl_0_ff[i].handler] = eager::op_smalltbl_0_ff[i].handler;
+
+    lazy_table = (cpuop_func **)malloc(65536 * sizeof(cpuop_func *));
+    eager_table = (cpuop_func **)malloc(65536 * sizeof(cpuop_func *));
+    for (int opcode = 0; opcode < 65536; opcode++) {
+        cpuop_func *f = cpufunctbl[opcode];
+        lazy_table[opcode] = f;
+        std::map<cpuop_func *, cpuop_func *>::iterator it = twin.find(f);
+        eager_table[opcode] = it != twin.end() ? it->second : f;
+    }
+
+#if USE_COMPACT_DISPATCH
+    size_t size = cpu_dispatch.nhandlers * sizeof(cpuop_func *);
+    lazy_handlers = (cpuop_func **)malloc(size);
+    eager_handlers = (cpuop_func **)malloc(size);
+    memcpy(lazy_handlers, cpu_dispatch.handlers, size);
+    for (uae_u32 i = 0; i < cpu_dispatch.nhandlers; i++) {
+        std::map<cpuop_func *, cpuop_func *>::iterator it = twin.find(lazy_handlers[i]);
+        eager_handlers[i] = it != twin.end() ? it->second : lazy_handlers[i];
+    }
+#endif
+}
+
+static bool testable(uint32 opcode)
+{
+    if (opcode >= 0xf000)
+        return false;   // FPU state is not compared
+    int mnemo = table68k[opcode].mnemo;
+    return mnemo != i_ILLG && mnemo != i_RESET
+        && mnemo != i_EMULOP && mnemo != i_EMULOP_RETURN
+        && table68k[opcode].clev <= 4;
+}
+
+struct cpu_state {
+    uae_u32 regs[16];
+    uaecptr pc;
+    uae_u16 sr;
+    uae_u32 usp, isp, msp, vbr;
+};
+
+static void capture(cpu_state &s)
+{
+    // MakeSR() materializes lazy flags, keep them pending for the next instruction
+    struct flag_struct flags = regflags;
+    uae_u16 sr = regs.sr;
+    MakeSR();
+    s.sr = regs.sr;
+    regs.sr = sr;
+    regflags = flags;
+
+    memcpy(s.regs, regs.regs, sizeof(s.regs));
+    s.pc = m68k_getpc();
+    s.usp = regs.usp;
+    s.isp = regs.isp;
+    s.msp = regs.msp;
+    s.vbr = regs.vbr;
+}
+
+static bool same_state(const cpu_state &x, const cpu_state &y)
+{
+    return !memcmp(x.regs, y.regs, sizeof(x.regs)) && x.pc == y.pc && x.sr == y.sr
+        && x.usp == y.usp && x.isp == y.isp && x.msp == y.msp && x.vbr == y.vbr;
+}
+
+static bool pc_in_ram(uaecptr pc)
+{
+    return pc >= 0x400 && pc < RAMSize - 64;
+}
+
+static uae_u8 *ram_snapshot = NULL;
+static uae_u8 *ram_result = NULL;
+static struct regstruct regs_snapshot;
+static struct flag_struct flags_snapshot;
+
+static void restore_snapshot(void)
+{
+    memcpy(RAMBaseHost, ram_snapshot, RAMSize);
+    low_mem_mirror_sync(RAMBaseHost, RAMSize);
+    regs = regs_snapshot;
+    regflags = flags_snapshot;
+    m68k_setpc(CODE_BASE);
+    SPCFLAGS_INIT( 0 );
+}
+
+static void step(cpuop_func **table)
+{
+    uae_u32 opcode = GET_OPCODE;
+    (*table[opcode])(opcode);
+}
+
+/*
+ *  Run op1 (and op2 if control stays in RAM at a testable opcode),
+ *  capturing state after each
+ */
+static int run_pair(cpuop_func **table, cpu_state *after)
+{
+    restore_snapshot();
+    step(table);
+    capture(after[0]);
+    if (!pc_in_ram(after[0].pc) || !testable(get_word(after[0].pc)))
+        return 1;
+    step(table);
+    capture(after[1]);
+    return 2;
+}
+
+// m68k_reset() without the FPU reset (and its log line)
+static void reset_cpu(void)
+{
+    regs.s = 1;
+    regs.m = 0;
+    regs.stopped = 0;
+    regs.t1 = 0;
+    regs.t0 = 0;
+    regs.intmask = 7;
+    regs.vbr = regs.sfc = regs.dfc = 0;
+    SPCFLAGS_INIT( 0 );
+}
+
+static void randomize_machine(uint32 op1, bool all_ram)
+{
+    // Random RAM (the rest carries over from the previous case), all
+    // exception vectors pointing to a valid address
+    uint32 *ram = (uint32 *)RAMBaseHost;
+    if (all_ram) {
+        for (uint32 i = 0; i < RAMSize / 4; i++)
+            ram[i] = rnd();
+    } else {
+        for (int i = 0; i < 64; i++)
+            ram[rnd() % (RAMSize / 4)] = rnd();
+    }
+    for (uint32 i = 0; i < 32; i += 4)
+        WriteMacInt32(CODE_BASE + i, rnd());
+    for (uint32 v = 0; v < 0x400; v += 4)
+        WriteMacInt32(v, VECTOR_TARGET);
+    WriteMacInt16(CODE_BASE, op1);
+
+    reset_cpu();
+    for (int i = 0; i < 8; i++)
+        m68k_dreg(regs, i) = rnd_value();
+    for (int i = 0; i < 7; i++)
+        m68k_areg(regs, i) = 0x1000 + (rnd() % (RAMSize - 0x2000));
+    m68k_areg(regs, 7) = STACK_BASE + (rnd() & 0xffc);
+    regs.usp = STACK_BASE + 0x2000;
+    regs.isp = m68k_areg(regs, 7);
+    regs.msp = STACK_BASE + 0x4000;
+    SET_CFLG(rnd() & 1);
+    SET_ZFLG(rnd() & 1);
+    SET_NFLG(rnd() & 1);
+    SET_VFLG(rnd() & 1);
+    SET_XFLG(rnd() & 1);
+    MakeSR();
+
+    memcpy(ram_snapshot, RAMBaseHost, RAMSize);
+    regs_snapshot = regs;
+    flags_snapshot = regflags;
+}
+
+/*
+ *  Flag-heavy loop for a lazy vs. eager throughput figure
+ */
+static void load_loop(uaecptr base, uint32 n)
+{
+    uaecptr pc = base;
+    static const uint16 code[] = {
+        0x7200,         //     moveq   #0,d1
+        0x7400,         //     moveq   #0,d2
+        0xd280,         // 1$: add.l   d0,d1
+        0xb481,         //     cmp.l   d1,d2
+        0x6302,         //     bls.s   2$
+        0x5282,         //     addq.l  #1,d2
+        0x4a41,         // 2$: tst.w   d1
+        0x5380,         //     subq.l  #1,d0
+        0x66f2,         //     bne.s   1$
+        0x4e75,         //     rts
+    };
+    WriteMacInt16(pc, 0x203c); pc += 2;     //     move.l  #n,d0
+    WriteMacInt32(pc, n); pc += 4;
+    for (size_t i = 0; i < sizeof(code) / sizeof(code[0]); i++, pc += 2)
+        WriteMacInt16(pc, code[i]);
+}
+
+static double loop_mips(cpuop_func **table, uint32 n, uae_u32 *result)
+{
+    memcpy(cpufunctbl, table, 65536 * sizeof(cpuop_func *));
+#if USE_COMPACT_DISPATCH
+    cpu_dispatch.handlers = table == eager_table ? eager_handlers : lazy_handlers;
+#endif
+#if USE_BLOCK_CACHE
+    block_cache_flush();
+#endif
+    reset_cpu();
+    m68k_areg(regs, 7) = STACK_BASE;
+    load_loop(LOOP_BASE, n);
+
+    M68kRegisters r;
+    memset(&r, 0, sizeof(r));
+    uint64 insns = HostEmulatedInstructions();
+    uint64 start = HostWallMicros();
+    Execute68k(LOOP_BASE, &r);
+    uint64 usec = HostWallMicros() - start;
+    insns = HostEmulatedInstructions() - insns;
+    MakeSR();
+    result[0] = r.d[1];
+    result[1] = r.d[2];
+    result[2] = regs.sr;
+    return usec ? insns / (double)usec : 0.0;
+}
+
+int HostBenchFlags(uint64 iterations)
+{
+    if (!HostBenchInit(FLAGS_RAM_SIZE)) {
+        fprintf(stderr, "Flags check setup failed\n");
+        return 1;
+    }
+    build_eager_table();
+    ram_snapshot = (uae_u8 *)malloc(RAMSize);
+    ram_result = (uae_u8 *)malloc(RAMSize);
+
+    // Candidate opcodes, half of the second instructions are flag readers
+    vector<uint16> any_ops, reader_ops;
+    for (uint32 opcode = 0; opcode < 65536; opcode++) {
+        if (!testable(opcode))
+            continue;
+        any_ops.push_back(opcode);
+        if (table68k[opcode].flaglive)
+            reader_ops.push_back(opcode);
+    }
+
+    uint64 cases = iterations / 10;
+    if (cases == 0) cases = 1;
+    uint64 failures = 0, pairs = 0;
+    for (uint64 n = 0; n < cases; n++) {
+        uint16 op1 = any_ops[rnd() % any_ops.size()];
+        uint16 op2 = (rnd() & 1) ? reader_ops[rnd() % reader_ops.size()] : any_ops[rnd() % any_ops.size()];
+        randomize_machine(op1, n == 0);
+
+        // Find out where op1 goes and put op2 there
+        cpu_state lazy_after[2], eager_after[2];
+        run_pair(lazy_table, lazy_after);
+        if (pc_in_ram(lazy_after[0].pc) && lazy_after[0].pc != CODE_BASE) {
+            uaecptr pc2 = lazy_after[0].pc;
+            ram_snapshot[pc2 - RAMBaseMac] = op2 >> 8;
+            ram_snapshot[pc2 - RAMBaseMac + 1] = op2 & 0xff;
+        }
+
+        int steps = run_pair(lazy_table, lazy_after);
+        memcpy(ram_result, RAMBaseHost, RAMSize);
+        run_pair(eager_table, eager_after);
+
+        bool match = same_state(lazy_after[0], eager_after[0])
+            && (steps < 2 || same_state(lazy_after[1], eager_after[1]))
+            && !memcmp(ram_result, RAMBaseHost, RAMSize);
+        if (steps == 2)
+            pairs++;
+        if (!match) {
+            if (failures < 10) {
+                int i = steps - 1;
+                uae_u16 op2_seen = ram_snapshot[lazy_after[0].pc & (RAMSize - 1)] << 8
+                                 | ram_snapshot[(lazy_after[0].pc + 1) & (RAMSize - 1)];
+                fprintf(stderr, "flags: mismatch op1 %04x op2 %04x: sr %04x/%04x pc %08x/%08x d0 %08x/%08x\n",
+                        op1, steps == 2 ? op2_seen : 0, lazy_after[i].sr, eager_after[i].sr,
+                        lazy_after[i].pc, eager_after[i].pc, lazy_after[i].regs[0], eager_after[i].regs[0]);
+            }
+            failures++;
+        }
+    }
+
+    uae_u32 lazy_result[3], eager_result[3];
+    uint32 loop_n = iterations < 1000000 ? 1000000 : (uint32)iterations;
+    double eager_mips = loop_mips(eager_table, loop_n, eager_result);
+    double lazy_mips = loop_mips(lazy_table, loop_n, lazy_result);
+    bool loop_match = !memcmp(lazy_result, eager_result, sizeof(lazy_result));
+
+    printf("bench=flags\n");
+    printf("flags.cases=%llu\n", (unsigned long long)cases);
+    printf("flags.pairs=%llu\n", (unsigned long long)pairs);
+    printf("flags.mismatches=%llu\n", (unsigned long long)failures);
+    printf("flags.loop.eager_mips=%.2f\n", eager_mips);
+    printf("flags.loop.lazy_mips=%.2f\n", lazy_mips);
+    printf("flags.loop.match=%d\n", loop_match);
+    bool ok = failures == 0 && loop_match;
+    printf("match=%d\n", ok);
+
+    Exit680x0();
+    return ok ? 0 : 1;
+}
+
+#else
+
+int HostBenchFlags(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without LAZY_FLAGS, nothing to compare\n");
+    return 1;
+}
+
+#endif /* LAZY_FLAGS */
@@ -0,0 +1,451 @@
+/*
+ *  bench_fusion.cpp - Fused instruction pair check and benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Builds random 68k instruction streams in which the pairs from
+ *  op_fusedtbl_* (a straight-line instruction followed by a Bcc or DBcc)
+ *  are mixed with other straight-line instructions, every branch jumping
+ *  forward to a random instruction of the stream or just past it. Each
+ *  stream runs from the same machine state three times: one instruction at
+ *  a time with the normal handlers, and through the block cache without
+ *  and with fusion once it has recorded the stream. Registers, SR and RAM
+ *  must match, and both cached runs must count the same instructions.
+ *
+ *  Then a scan loop (CMP/Bcc, TST/Bcc, SUBQ/Bcc) runs through the block
+ *  cache with fusion off and on, for the MIPS of both.
+ *
+ *  Usage:
+ *    basilisk_host --bench fusion [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "blockcache.h"
+
+#if USE_FUSION
+
+// Memory layout inside 256KB of RAM, as in bench_noflags.cpp. Address
+// registers stay far enough below the code that (d16,An) cannot reach it.
+const uint32 FUSION_RAM_SIZE = 256 * 1024;
+const uaecptr DATA_LOW = 0x8000;
+const uaecptr DATA_HIGH = 0x17000;
+const uaecptr STACK_BASE = 0x18000;
+const uaecptr CODE_BASE = 0x20000;
+const uint32 CODE_SIZE = 0x1000;
+const uaecptr LOOP_BASE = 0x30000;
+const int MAX_PAIRS = 8;
+const int MAX_STEPS = 1000;
+const int MAX_INSN_WORDS = 11;
+
+static uint32 rng_state = 0x7f4a7c15;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint32 rnd_value(void)
+{
+    static const uint32 corners[] = {
+        0, 1, 2, 0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0xffff,
+        0x7fffffff, 0x80000000, 0xffffffff, 0xfffffffe,
+    };
+    if (rnd() & 1)
+        return rnd();
+    return corners[rnd() % (sizeof(corners) / sizeof(corners[0]))];
+}
+
+struct cpu_state {
+    uae_u32 regs[16];
+    uaecptr pc;
+    uae_u16 sr;
+};
+
+static void capture(cpu_state &s)
+{
+    MakeSR();
+    s.sr = regs.sr;
+    memcpy(s.regs, regs.regs, sizeof(s.regs));
+    s.pc = m68k_getpc();
+}
+
+static bool same_state(const cpu_state &x, const cpu_state &y)
+{
+    return !memcmp(x.regs, y.regs, sizeof(x.regs)) && x.pc == y.pc && x.sr == y.sr;
+}
+
+static uae_u8 *ram_snapshot = NULL;
+static uae_u8 *ram_result = NULL;
+static struct regstruct regs_snapshot;
+static struct flag_struct flags_snapshot;
+
+static void restore_snapshot(void)
+{
+    memcpy(RAMBaseHost, ram_snapshot, RAMSize);
+    low_mem_mirror_sync(RAMBaseHost, RAMSize);
+    regs = regs_snapshot;
+    regflags = flags_snapshot;
+    m68k_setpc(CODE_BASE);
+    SPCFLAGS_INIT( 0 );
+}
+
+static void step(void)
+{
+    uae_u32 opcode = GET_OPCODE;
+    (*cpufunctbl[opcode])(opcode);
+}
+
+static void randomize_machine(bool all_ram)
+{
+    uint32 *ram = (uint32 *)RAMBaseHost;
+    if (all_ram) {
+        for (uint32 i = 0; i < RAMSize / 4; i++)
+            ram[i] = rnd();
+    } else {
+        for (int i = 0; i < 64; i++)
+            ram[rnd() % (RAMSize / 4)] = rnd();
+    }
+
+    regs.s = 1;
+    regs.m = 0;
+    regs.t1 = regs.t0 = 0;
+    regs.intmask = 7;
+    for (int i = 0; i < 8; i++)
+        m68k_dreg(regs, i) = rnd_value();
+    for (int i = 0; i < 7; i++)
+        m68k_areg(regs, i) = DATA_LOW + (rnd() % (DATA_HIGH - DATA_LOW));
+    m68k_areg(regs, 7) = STACK_BASE - (rnd() & 0xffc);
+    regs.isp = m68k_areg(regs, 7);
+    SET_CFLG(rnd() & 1);
+    SET_ZFLG(rnd() & 1);
+    SET_NFLG(rnd() & 1);
+    SET_VFLG(rnd() & 1);
+    SET_XFLG(rnd() & 1);
+    MakeSR();
+
+    memcpy(ram_snapshot, RAMBaseHost, RAMSize);
+    regs_snapshot = regs;
+    flags_snapshot = regflags;
+}
+
+// Opcodes of one fused pair's first and second handler
+struct pair_opcodes {
+    vector<uint16> first;
+    vector<uint16> second;
+};
+
+static vector<pair_opcodes> pairs;
+static vector<uint16> straight;
+
+static void collect_opcodes(void)
+{
+    const cpufused *fused;
+    int count = block_cache_fused_pairs(&fused);
+    pairs.resize(count);
+    for (uint32 opcode = 0; opcode < 0xf000; opcode++) {
+        if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > 4)
+            continue;
+        cpuop_func *handler = cpufunctbl[opcode];
+        if (block_flags_straight_line(opcode))
+            straight.push_back(opcode);
+        for (int i = 0; i < count; i++) {
+            if (fused[i].first == handler && block_flags_straight_line(opcode))
+                pairs[i].first.push_back(opcode);
+            if (fused[i].second == handler)
+                pairs[i].second.push_back(opcode);
+        }
+    }
+    // Pairs no opcode reaches (a first instruction the block cache does not
+    // treat as straight line)
+    for (size_t i = 0; i < pairs.size(); ) {
+        if (pairs[i].first.empty() || pairs[i].second.empty())
+            pairs.erase(pairs.begin() + i);
+        else
+            i++;
+    }
+}
+
+/*
+ *  Write one straight-line instruction with random extension words and step
+ *  it to learn its length. Returns false if it did not fall through.
+ */
+static bool put_straight(uaecptr &pc, uint16 opcode)
+{
+    WriteMacInt16(pc, opcode);
+    for (int w = 1; w < MAX_INSN_WORDS; w++)
+        WriteMacInt16(pc + 2 * w, rnd());
+    m68k_setpc(pc);
+    step();
+    if (m68k_getpc() <= pc || m68k_getpc() >= CODE_BASE + CODE_SIZE - 8 * MAX_INSN_WORDS)
+        return false;       // Overwrote itself and ran into something else
+    pc = m68k_getpc();
+    return true;
+}
+
+// Length of a Bcc/DBcc from its opcode
+static uint32 branch_length(uint16 opcode)
+{
+    if (table68k[opcode].mnemo == i_DBcc)
+        return 4;
+    if ((opcode & 0xff) == 0)
+        return 4;
+    if ((opcode & 0xff) == 0xff)
+        return 6;
+    return 2;
+}
+
+/*
+ *  Write a random stream of filler instructions and fused pairs at
+ *  CODE_BASE, followed by two BRA.S to themselves, then point every branch
+ *  at a later instruction. Returns the end PC.
+ */
+static uaecptr build_stream(int npairs)
+{
+    restore_snapshot();
+    vector<uaecptr> starts;
+    vector<size_t> branches;    // Indices into starts
+    uaecptr pc = CODE_BASE;
+    bool ok = true;
+    for (int p = 0; p < npairs && ok; p++) {
+        int filler = rnd() % 3;
+        for (int i = 0; i < filler && ok; i++) {
+            starts.push_back(pc);
+            ok = put_straight(pc, straight[rnd() % straight.size()]);
+            if (!ok)
+                starts.pop_back();
+        }
+        if (!ok)
+            break;
+        const pair_opcodes &pair = pairs[rnd() % pairs.size()];
+        starts.push_back(pc);
+        if (!put_straight(pc, pair.first[rnd() % pair.first.size()])) {
+            starts.pop_back();
+            break;
+        }
+        uint16 opcode = pair.second[rnd() % pair.second.size()];
+        WriteMacInt16(pc, opcode);
+        branches.push_back(starts.size());
+        starts.push_back(pc);
+        pc += branch_length(opcode);
+    }
+    // A block records through short forward branches, so whatever lies
+    // past the end may run in the cached passes: stop there too
+    uaecptr end = pc;
+    WriteMacInt16(end, 0x60fe);     // bra.s *
+    WriteMacInt16(end + 2, 0x60fe); // bra.s *, for branches that leave the stream
+    starts.push_back(end);
+    starts.push_back(end + 2);
+
+    for (size_t b = 0; b < branches.size(); b++) {
+        size_t index = branches[b];
+        uaecptr bpc = starts[index];
+        uint16 opcode = ReadMacInt16(bpc);
+        // Not the next instruction: a zero Bcc.B displacement means Bcc.W
+        size_t first = index + 2, last = first;
+        while (last + 1 < starts.size() && (branch_length(opcode) != 2 || starts[last + 1] - (bpc + 2) <= 0x7e))
+            last++;
+        if (first >= starts.size())
+            first = last = starts.size() - 1;
+        uaecptr target = starts[first + rnd() % (last - first + 1)];
+        uint32 disp = target - (bpc + 2);
+        if (table68k[opcode].mnemo == i_DBcc || (opcode & 0xff) == 0)
+            WriteMacInt16(bpc + 2, disp);
+        else if ((opcode & 0xff) == 0xff)
+            WriteMacInt32(bpc + 2, disp);
+        else
+            WriteMacInt16(bpc, (opcode & 0xff00) | disp);
+    }
+
+    // The probe run scribbled over data and registers, keep only the code
+    memcpy(ram_snapshot + CODE_BASE, RAMBaseHost + CODE_BASE, CODE_SIZE);
+    return end;
+}
+
+// Still inside the stream and not done
+static bool running(uaecptr end)
+{
+    uaecptr pc = m68k_getpc();
+    return pc >= CODE_BASE && pc < end;
+}
+
+static void run_interpreted(uaecptr end)
+{
+    restore_snapshot();
+    for (int i = 0; i < MAX_STEPS && running(end); i++)
+        step();
+}
+
+// A block that falls into the final BRA.S also runs that, so the count is
+// only comparable between cached runs
+static uint64 run_cached(uaecptr end)
+{
+    restore_snapshot();
+    uint64 instructions = 0;
+    for (int i = 0; i < MAX_STEPS && running(end); i++) {
+        instructions += block_cache_execute(1);
+        SPCFLAGS_CLEAR( SPCFLAG_BLOCK_INVALID );    // As do_specialties() does
+    }
+    return instructions;
+}
+
+// First pass records the blocks, the second one replays them
+static uint64 run_recorded(uaecptr end, bool fused)
+{
+    block_fusion_enabled = fused;
+    block_cache_flush();
+    run_cached(end);
+    return run_cached(end);
+}
+
+/*
+ *  Byte scan with a count of matches and a sign test per pass
+ */
+static void load_scan(uaecptr base, uint32 n)
+{
+    uaecptr pc = base;
+    static const uint16 code[] = {
+        0x2e3c, 0, 0,       //     move.l  #n,d7
+        0x41f9, 0, 0,       // 1$: lea     DATA_LOW,a0
+        0x303c, 0x00ff,     //     move.w  #255,d0
+        0x7200,             //     moveq   #0,d1
+        0xb218,             // 2$: cmp.b   (a0)+,d1
+        0x6702,             //     beq.s   3$
+        0x5282,             //     addq.l  #1,d2
+        0x51c8, 0xfff8,     // 3$: dbra    d0,2$
+        0x4a42,             //     tst.w   d2
+        0x6b02,             //     bmi.s   4$
+        0x5383,             //     subq.l  #1,d3
+        0x5387,             // 4$: subq.l  #1,d7
+        0x66e0,             //     bne.s   1$
+        0x4e75,             //     rts
+    };
+    for (size_t i = 0; i < sizeof(code) / sizeof(code[0]); i++)
+        WriteMacInt16(pc + 2 * i, code[i]);
+    WriteMacInt32(pc + 2, n);
+    WriteMacInt32(pc + 8, DATA_LOW);
+}
+
+static double time_scan(uint32 n, bool fused, uint32 &d2)
+{
+    block_fusion_enabled = fused;
+    block_cache_flush();
+    M68kRegisters r;
+    memset(&r, 0, sizeof(r));
+    r.a[7] = STACK_BASE;
+    uint64 insns = HostEmulatedInstructions();
+    uint64 start = HostWallMicros();
+    Execute68k(LOOP_BASE, &r);
+    uint64 usec = HostWallMicros() - start;
+    d2 = r.d[2];
+    return usec ? (HostEmulatedInstructions() - insns) / (double)usec : 0.0;
+}
+
+int HostBenchFusion(uint64 iterations)
+{
+    if (!HostBenchInit(FUSION_RAM_SIZE)) {
+        fprintf(stderr, "Fusion check setup failed\n");
+        return 1;
+    }
+    ram_snapshot = (uae_u8 *)malloc(RAMSize);
+    ram_result = (uae_u8 *)malloc(RAMSize);
+    block_cache_enabled = true;
+    block_fusion_enabled = true;
+
+    collect_opcodes();
+    if (pairs.empty()) {
+        fprintf(stderr, "No fused pairs generated (gencpu --fuse)\n");
+        return 1;
+    }
+
+    uint64 cases = iterations / 200;
+    if (cases == 0) cases = 1;
+    uint64 failures = 0, skipped = 0, instructions = 0;
+    uint32 fused_before = block_stats.fused;
+    for (uint64 n = 0; n < cases; n++) {
+        randomize_machine(n == 0);
+        uaecptr end = build_stream(1 + rnd() % MAX_PAIRS);
+
+        cpu_state plain, unfused, fused;
+        run_interpreted(end);
+        capture(plain);
+        memcpy(ram_result, RAMBaseHost, RAMSize);
+
+        // Skip streams that stored into their own code: the cached copy
+        // would be stale, and the interpreter may not even reach the end
+        if (running(end) || memcmp(RAMBaseHost + CODE_BASE, ram_snapshot + CODE_BASE, CODE_SIZE)) {
+            skipped++;
+            continue;
+        }
+
+        uint64 unfused_insns = run_recorded(end, false);
+        capture(unfused);
+        bool match = same_state(plain, unfused) && !memcmp(ram_result, RAMBaseHost, RAMSize);
+        uint64 fused_insns = run_recorded(end, true);
+        capture(fused);
+        match &= same_state(plain, fused) && !memcmp(ram_result, RAMBaseHost, RAMSize);
+        match &= unfused_insns == fused_insns;
+        instructions += fused_insns;
+
+        if (!match) {
+            if (failures < 10) {
+                fprintf(stderr, "fusion: mismatch: sr %04x/%04x pc %08x/%08x d0 %08x/%08x insns %llu/%llu\n",
+                        plain.sr, fused.sr, plain.pc, fused.pc, plain.regs[0], fused.regs[0],
+                        (unsigned long long)unfused_insns, (unsigned long long)fused_insns);
+                for (uaecptr pc = CODE_BASE; pc < end; pc += 2)
+                    fprintf(stderr, "%04x%s", ReadMacInt16(pc), pc + 2 < end ? " " : "\n");
+            }
+            failures++;
+        }
+    }
+    uint32 fused_pairs = block_stats.fused - fused_before;
+
+    // Same loop, fusion off and on
+    uint32 loops = iterations / 1024;
+    if (loops == 0) loops = 1;
+    load_scan(LOOP_BASE, loops);
+    uint32 d2_plain, d2_fused;
+    time_scan(loops, true, d2_fused);      // Warm up
+    double plain_mips = time_scan(loops, false, d2_plain);
+    double fused_mips = time_scan(loops, true, d2_fused);
+    if (d2_plain != d2_fused) {
+        fprintf(stderr, "fusion: scan loop result %08x/%08x\n", d2_plain, d2_fused);
+        failures++;
+    }
+
+    printf("bench=fusion\n");
+    printf("fusion.pairs=%u\n", (uint32)pairs.size());
+    printf("fusion.cases=%llu\n", (unsigned long long)cases);
+    printf("fusion.skipped=%llu\n", (unsigned long long)skipped);
+    printf("fusion.instructions=%llu\n", (unsigned long long)instructions);
+    printf("fusion.pairs_fused=%u\n", fused_pairs);
+    printf("fusion.scan_plain_mips=%.2f\n", plain_mips);
+    printf("fusion.scan_fused_mips=%.2f\n", fused_mips);
+    printf("fusion.mismatches=%llu\n", (unsigned long long)failures);
+    printf("match=%d\n", failures == 0);
+
+    Exit680x0();
+    return failures == 0 ? 0 : 1;
+}
+
+#else
+
+int HostBenchFusion(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without USE_FUSION, nothing to compare\n");
+    return 1;
+}
+
+#endif /* USE_FUSION */
@@ -0,0 +1,175 @@
+/*
+ *  bench_lowmem.cpp - Low memory mirror check and benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Runs a hand-assembled loop that works on Mac low-memory globals the way
+ *  Toolbox calls do (Ticks, MemTop, CurrentA5 and a word it points through,
+ *  plus a long that straddles the end of the mirror) with the mirror off
+ *  and on. Registers, flags, instruction counts and RAM must match, the
+ *  mirror must equal RAM afterwards, and a Host2Mac_memcpy() and stores
+ *  through the RAM bank handlers into low memory must be visible to the
+ *  emulated CPU. The report gives MIPS for
+ *  both runs.
+ *
+ *  On the host both copies sit in the same caches, so the numbers mostly
+ *  show the cost of the extra compare; the gain is on the device, where RAM
+ *  is PSRAM. Boot and Finder timings with a ROM come from
+ *    basilisk_host --rom ROM --disk DISK --instructions N --virtual-clock IPS
+ *  run with and without --no-low-mem-mirror.
+ *
+ *  Usage:
+ *    basilisk_host --bench lowmem [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "blockcache.h"
+
+#if USE_LOW_MEM_MIRROR
+
+const uint32 LOWMEM_RAM_SIZE = 2 * 1024 * 1024;
+const uaecptr CODE_BASE = 0x10000;
+const uaecptr HEAP_BASE = 0x100000;
+const uaecptr STACK_BASE = 0x8000;     // m68k_reset() puts it at 0x2000, inside the mirror
+
+static void load_loop(uint32 n)
+{
+    uaecptr pc = CODE_BASE;
+    static const uint16 code[] = {
+        0x2e3c, 0, 0,       //     move.l  #n,d7
+        0x2038, 0x016a,     // 1$: move.l  Ticks,d0
+        0xd2b8, 0x0108,     //     add.l   MemTop,d1
+        0x2078, 0x0904,     //     movea.l CurrentA5,a0
+        0x2410,             //     move.l  (a0),d2
+        0x52b8, 0x016a,     //     addq.l  #1,Ticks
+        0x31c7, 0x0a00,     //     move.w  d7,$a00
+        0xd678, 0x0a00,     //     add.w   $a00,d3
+        0x2838, LOW_MEM_MIRROR_SIZE - 2,    // move.l  end-2,d4
+        0x21c1, LOW_MEM_MIRROR_SIZE - 2,    // move.l  d1,end-2
+        0x5387,             //     subq.l  #1,d7
+        0x66e0,             //     bne.s   1$
+        0x4e75,             //     rts
+    };
+    for (size_t i = 0; i < sizeof(code) / sizeof(code[0]); i++, pc += 2)
+        WriteMacInt16(pc, code[i]);
+    WriteMacInt32(CODE_BASE + 2, n);
+}
+
+struct lowmem_result {
+    uint32 d[8], a[8];
+    uint16 sr;
+    uint32 mem_hash;
+    uint64 instructions;
+    uint64 usec;
+};
+
+static uint32 hash_ram(uaecptr start, uint32 size)
+{
+    uint32 hash = 2166136261u;
+    for (uint32 i = 0; i < size; i++)
+        hash = (hash ^ RAMBaseHost[start + i]) * 16777619u;
+    return hash;
+}
+
+static void run_loop(uint32 n, bool mirror, lowmem_result &res)
+{
+    // Same low memory for every run, written by the CPU side
+    memset(RAMBaseHost, 0, LOW_MEM_MIRROR_SIZE + 4);
+    low_mem_mirror_enable(mirror);
+    WriteMacInt32(0x016a, 0);
+    WriteMacInt32(0x0108, LOWMEM_RAM_SIZE);
+    WriteMacInt32(0x0904, HEAP_BASE);
+    WriteMacInt32(HEAP_BASE, 0x12345678);
+    load_loop(n);
+#if USE_BLOCK_CACHE
+    block_cache_flush();
+#endif
+
+    M68kRegisters r;
+    memset(&r, 0, sizeof(r));
+    m68k_areg(regs, 7) = STACK_BASE;
+    uint64 insns = HostEmulatedInstructions();
+    uint64 start = HostWallMicros();
+    Execute68k(CODE_BASE, &r);
+    res.usec = HostWallMicros() - start;
+    res.instructions = HostEmulatedInstructions() - insns;
+
+    memcpy(res.d, r.d, sizeof(res.d));
+    memcpy(res.a, r.a, sizeof(res.a));
+    MakeSR();
+    res.sr = regs.sr;
+    res.mem_hash = hash_ram(0, LOW_MEM_MIRROR_SIZE + 4);
+}
+
+static double mips(const lowmem_result &res)
+{
+    return res.usec ? res.instructions / (double)res.usec : 0.0;
+}
+
+int HostBenchLowMem(uint64 iterations)
+{
+    if (!HostBenchInit(LOWMEM_RAM_SIZE)) {
+        fprintf(stderr, "Low memory benchmark setup failed\n");
+        return 1;
+    }
+
+    lowmem_result plain, mirrored;
+    run_loop(iterations, false, plain);
+    run_loop(iterations, true, mirrored);
+    bool match = !memcmp(plain.d, mirrored.d, sizeof(plain.d)) && !memcmp(plain.a, mirrored.a, sizeof(plain.a))
+        && plain.sr == mirrored.sr && plain.mem_hash == mirrored.mem_hash
+        && plain.instructions == mirrored.instructions;
+    bool coherent = low_mem_read_limit != 0 && !memcmp(low_mem_mirror, RAMBaseHost, LOW_MEM_MIRROR_SIZE);
+
+    // A host write into low memory must reach the mirror
+    static const uint8 pattern[4] = {0xde, 0xad, 0xbe, 0xef};
+    Host2Mac_memcpy(0x0100, pattern, sizeof(pattern));
+    bool synced = ReadMacInt32(0x0100) == 0xdeadbeef;
+
+    // So must stores that go through the RAM bank handlers
+    get_mem_bank(0x0200).lput(0x0200, 0x01234567);
+    get_mem_bank(0x0204).wput(0x0204, 0x89ab);
+    get_mem_bank(0x0206).bput(0x0206, 0xcd);
+    bool bank_synced = ReadMacInt32(0x0200) == 0x01234567 && ReadMacInt16(0x0204) == 0x89ab
+        && ReadMacInt8(0x0206) == 0xcd && !memcmp(low_mem_mirror, RAMBaseHost, LOW_MEM_MIRROR_SIZE);
+
+    printf("bench=lowmem\n");
+    printf("lowmem.mirror_bytes=%u\n", LOW_MEM_MIRROR_SIZE);
+    printf("lowmem.instructions=%llu\n", (unsigned long long)plain.instructions);
+    printf("lowmem.ram_mips=%.2f\n", mips(plain));
+    printf("lowmem.mirror_mips=%.2f\n", mips(mirrored));
+    printf("lowmem.coherent=%d\n", coherent);
+    printf("lowmem.host_write_synced=%d\n", synced);
+    printf("lowmem.bank_write_synced=%d\n", bank_synced);
+    if (!match) {
+        fprintf(stderr, "lowmem: d0 %08x/%08x d1 %08x/%08x d4 %08x/%08x mem %08x/%08x insns %llu/%llu\n",
+                plain.d[0], mirrored.d[0], plain.d[1], mirrored.d[1], plain.d[4], mirrored.d[4],
+                plain.mem_hash, mirrored.mem_hash,
+                (unsigned long long)plain.instructions, (unsigned long long)mirrored.instructions);
+    }
+    bool ok = match && coherent && synced && bank_synced;
+    printf("match=%d\n", ok);
+
+    Exit680x0();
+    return ok ? 0 : 1;
+}
+
+#else
+
+int HostBenchLowMem(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without USE_LOW_MEM_MIRROR, nothing to compare\n");
+    return 1;
+}
+
+#endif /* USE_LOW_MEM_MIRROR */
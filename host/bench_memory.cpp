@@ -0,0 +1,306 @@
+/*
+ *  bench_memory.cpp - Software TLB check and memory fast path benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Maps RAM, ROM and a direct frame buffer, then runs a pseudo-random
+ *  stream of byte, word and long accesses (mostly RAM, some ROM, a few
+ *  frame buffer) through the mem_tlb fast paths in memory.h and through a
+ *  copy of the RAM/ROM range checks they replaced. Every read must return
+ *  the same value; RAM and frame buffer writes must reach host memory and
+ *  ROM writes must be ignored. Then both paths are timed over the stream.
+ *
+ *  The frame buffer is also remapped as for Thousands (FLAYOUT_BE_565):
+ *  555 stores of every size must land as big-endian 565 and read back as
+ *  written.
+ *
+ *  Usage:
+ *    basilisk_host --bench memory [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+
+#if USE_SOFT_TLB
+
+const uint32 MEMORY_RAM_SIZE = 8 * 1024 * 1024;
+const uint32 MEMORY_FRAME_SIZE = 640 * 360;
+const uint32 STREAM_LENGTH = 4096;
+
+static uint32 rng_state = 0x1b873593;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/*
+ *  The fast paths as they were before the TLB: RAM and ROM range checks,
+ *  everything else through the bank table. RAM writes pay for the same low
+ *  memory mirror and block cache checks as the TLB paths, so only the
+ *  lookup differs.
+ */
+static inline uae_u32 range_get(uaecptr addr, int size)
+{
+    if (likely(addr < RAMSize)) {
+        uae_u8 *m = RAMBaseHost + addr;
+        return size == 4 ? do_get_mem_long((uae_u32 *)m) : size == 2 ? do_get_mem_word((uae_u16 *)m) : *m;
+    }
+    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
+        uae_u8 *m = ROMBaseHost + (addr - ROMBaseMac);
+        return size == 4 ? do_get_mem_long((uae_u32 *)m) : size == 2 ? do_get_mem_word((uae_u16 *)m) : *m;
+    }
+    addrbank &bank = get_mem_bank(addr);
+    mem_get_func get = size == 4 ? bank.lget : size == 2 ? bank.wget : bank.bget;
+    return call_mem_get_func(get, addr);
+}
+
+static inline void range_put(uaecptr addr, int size, uae_u32 v)
+{
+    if (likely(addr < RAMSize)) {
+        uae_u8 *m = RAMBaseHost + addr;
+        if (size == 4)
+            do_put_mem_long((uae_u32 *)m, v);
+        else if (size == 2)
+            do_put_mem_word((uae_u16 *)m, v);
+        else
+            *m = v;
+        if (size == 4)
+            low_mem_check_write(m, do_put_mem_long, uae_u32, v);
+        else if (size == 2)
+            low_mem_check_write(m, do_put_mem_word, uae_u16, v);
+        else
+            low_mem_check_write(m, do_put_mem_byte, uae_u8, v);
+#if USE_BLOCK_CACHE
+        block_cache_check_write(addr, size);
+#endif
+        return;
+    }
+    addrbank &bank = get_mem_bank(addr);
+    mem_put_func put = size == 4 ? bank.lput : size == 2 ? bank.wput : bank.bput;
+    call_mem_put_func(put, addr, v);
+}
+
+static inline uae_u32 tlb_get(uaecptr addr, int size)
+{
+    return size == 4 ? longget(addr) : size == 2 ? wordget(addr) : byteget(addr);
+}
+
+static inline void tlb_put(uaecptr addr, int size, uae_u32 v)
+{
+    if (size == 4)
+        longput(addr, v);
+    else if (size == 2)
+        wordput(addr, v);
+    else
+        byteput(addr, v);
+}
+
+// 555 pixel as the display takes it, green's top bit repeated into the new low bit
+static uint32 ref_555_to_565(uint32 p)
+{
+    uint32 r = (p >> 10) & 0x1f, g = (p >> 5) & 0x1f, b = p & 0x1f;
+    return (r << 11) | (((g << 1) | (g >> 4)) << 5) | b;
+}
+
+struct access {
+    uaecptr addr;
+    int size;
+};
+
+// Sum of the values read so the loads cannot be optimized away
+static volatile uae_u32 sink;
+
+static uint64 time_reads(const access *stream, uint64 count, bool tlb)
+{
+    uae_u32 sum = 0;
+    uint64 start = HostWallMicros();
+    if (tlb) {
+        for (uint64 n = 0; n < count; n++) {
+            const access &a = stream[n & (STREAM_LENGTH - 1)];
+            sum += tlb_get(a.addr, a.size);
+        }
+    } else {
+        for (uint64 n = 0; n < count; n++) {
+            const access &a = stream[n & (STREAM_LENGTH - 1)];
+            sum += range_get(a.addr, a.size);
+        }
+    }
+    uint64 usec = HostWallMicros() - start;
+    sink = sum;
+    return usec;
+}
+
+static uint64 time_writes(const access *stream, uint64 count, bool tlb)
+{
+    uint64 start = HostWallMicros();
+    if (tlb) {
+        for (uint64 n = 0; n < count; n++) {
+            const access &a = stream[n & (STREAM_LENGTH - 1)];
+            tlb_put(a.addr, a.size, (uae_u32)n);
+        }
+    } else {
+        for (uint64 n = 0; n < count; n++) {
+            const access &a = stream[n & (STREAM_LENGTH - 1)];
+            range_put(a.addr, a.size, (uae_u32)n);
+        }
+    }
+    return HostWallMicros() - start;
+}
+
+// 60% RAM, 30% ROM, 10% frame buffer; words and longs on even addresses
+static access random_access(void)
+{
+    access a;
+    uint32 r = rnd() % 10;
+    static const int sizes[3] = {1, 2, 4};
+    a.size = sizes[rnd() % 3];
+    if (r < 6)
+        a.addr = RAMBaseMac + rnd() % (RAMSize - 4);
+    else if (r < 9)
+        a.addr = ROMBaseMac + rnd() % (ROMSize - 4);
+    else
+        a.addr = MacFrameBaseMac + rnd() % (MEMORY_FRAME_SIZE - 4);
+    if (a.size > 1)
+        a.addr &= ~1;
+    return a;
+}
+
+int HostBenchMemory(uint64 iterations)
+{
+    if (!HostBenchInit(MEMORY_RAM_SIZE)) {
+        fprintf(stderr, "Memory benchmark setup failed\n");
+        return 1;
+    }
+
+    // Direct frame buffer, remapped as on a video mode change
+    MacFrameBaseHost = (uint8 *)calloc(1, MEMORY_FRAME_SIZE);
+    MacFrameSize = MEMORY_FRAME_SIZE;
+    MacFrameLayout = FLAYOUT_DIRECT;
+    InitFrameBufferMapping();
+
+    for (uint32 i = 0; i < RAMSize; i++)
+        RAMBaseHost[i] = rnd();
+    for (uint32 i = 0; i < ROMSize; i++)
+        ROMBaseHost[i] = rnd();
+    for (uint32 i = 0; i < MEMORY_FRAME_SIZE; i++)
+        MacFrameBaseHost[i] = rnd();
+    low_mem_mirror_sync(RAMBaseHost, RAMSize);
+
+    access *stream = (access *)malloc(STREAM_LENGTH * sizeof(access));
+    access *ram_stream = (access *)malloc(STREAM_LENGTH * sizeof(access));
+    for (uint32 i = 0; i < STREAM_LENGTH; i++) {
+        stream[i] = random_access();
+        ram_stream[i].size = 1 << (rnd() % 3);
+        ram_stream[i].addr = (RAMBaseMac + rnd() % (RAMSize - 4)) & (ram_stream[i].size > 1 ? ~1 : ~0);
+    }
+
+    // Reads through both paths must agree
+    uint32 mismatches = 0;
+    for (uint32 i = 0; i < STREAM_LENGTH; i++) {
+        const access &a = stream[i];
+        uae_u32 expect = range_get(a.addr, a.size);
+        uae_u32 got = tlb_get(a.addr, a.size);
+        if (got != expect) {
+            if (mismatches < 10)
+                fprintf(stderr, "memory: %d-byte read at %08x gave %08x, expected %08x\n", a.size, a.addr, got, expect);
+            mismatches++;
+        }
+    }
+
+    // Writes: RAM and frame buffer take the value, ROM keeps its contents
+    for (uint32 i = 0; i < STREAM_LENGTH; i++) {
+        const access &a = stream[i];
+        bool rom = a.addr >= ROMBaseMac && a.addr < ROMBaseMac + ROMSize;
+        uae_u32 before = range_get(a.addr, a.size);
+        uae_u32 value = rnd() & (a.size == 4 ? 0xffffffff : a.size == 2 ? 0xffff : 0xff);
+        tlb_put(a.addr, a.size, value);
+        uae_u32 expect = rom ? before : value;
+        uae_u32 got = range_get(a.addr, a.size);
+        if (got != expect) {
+            if (mismatches < 10)
+                fprintf(stderr, "memory: %d-byte write at %08x left %08x, expected %08x\n", a.size, a.addr, got, expect);
+            mismatches++;
+        }
+    }
+
+    // Thousands: stores convert to 565, loads convert back
+    MacFrameLayout = FLAYOUT_BE_565;
+    map_frame_banks();
+    uint32 be565_mismatches = 0;
+    for (uint32 i = 0; i < STREAM_LENGTH; i++) {
+        int size = 1 << (rnd() % 3);
+        uaecptr addr = MacFrameBaseMac + (rnd() % (MEMORY_FRAME_SIZE / 2 - 2)) * 2;
+        if (size == 1)
+            addr += rnd() & 1;
+        uae_u32 value = rnd() & (size == 4 ? 0x7fff7fff : size == 2 ? 0x7fff : (addr & 1) ? 0xff : 0x7f);
+        uaecptr pixel = addr & ~1;
+        uae_u32 expect = value;     // 555 pixel(s) after the store
+        if (size == 1) {
+            uae_u32 w = tlb_get(pixel, 2);
+            expect = (addr & 1) ? (w & 0xff00) | value : (w & 0xff) | (value << 8);
+        }
+        tlb_put(addr, size, value);
+        bool ok = tlb_get(addr, size) == value;
+        for (int p = 0; p < (size == 4 ? 2 : 1); p++) {
+            uae_u32 px = size == 4 ? (expect >> (16 - 16 * p)) & 0xffff : expect;
+            const uae_u8 *m = MacFrameBaseHost + (pixel - MacFrameBaseMac) + p * 2;
+            ok &= (uae_u32)((m[0] << 8) | m[1]) == ref_555_to_565(px);
+        }
+        if (!ok) {
+            if (be565_mismatches < 10)
+                fprintf(stderr, "memory: %d-byte 555 store of %08x at %08x not stored as 565\n", size, value, addr);
+            be565_mismatches++;
+        }
+    }
+    mismatches += be565_mismatches;
+    MacFrameLayout = FLAYOUT_DIRECT;
+    map_frame_banks();
+
+    uint64 accesses = iterations < 1000000 ? 1000000 : iterations;
+    time_reads(stream, STREAM_LENGTH, false);   // Warm up
+    time_reads(stream, STREAM_LENGTH, true);
+    uint64 range_read_us = time_reads(stream, accesses, false);
+    uint64 tlb_read_us = time_reads(stream, accesses, true);
+    uint64 range_write_us = time_writes(ram_stream, accesses, false);
+    uint64 tlb_write_us = time_writes(ram_stream, accesses, true);
+
+    printf("bench=memory\n");
+    printf("memory.tlb_bytes=%u\n", (uint32)(65536 * sizeof(uintptr)));
+    printf("memory.range_read_ns=%.2f\n", range_read_us * 1000.0 / accesses);
+    printf("memory.tlb_read_ns=%.2f\n", tlb_read_us * 1000.0 / accesses);
+    printf("memory.range_ram_write_ns=%.2f\n", range_write_us * 1000.0 / accesses);
+    printf("memory.tlb_ram_write_ns=%.2f\n", tlb_write_us * 1000.0 / accesses);
+    printf("memory.be565_mismatches=%u\n", be565_mismatches);
+    printf("memory.mismatches=%u\n", mismatches);
+    printf("match=%d\n", mismatches == 0);
+
+    free(stream);
+    free(ram_stream);
+    Exit680x0();
+    free(MacFrameBaseHost);
+    MacFrameBaseHost = NULL;
+    return mismatches == 0 ? 0 : 1;
+}
+
+#else
+
+int HostBenchMemory(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without USE_SOFT_TLB, nothing to compare\n");
+    return 1;
+}
+
+#endif /* USE_SOFT_TLB */
@@ -0,0 +1,263 @@
+/*
+ *  bench_noflags.cpp - Flag liveness equivalence check
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Builds random straight-line 68k instruction streams out of the
+ *  instructions the block cache may switch to no-flags handlers, flag
+ *  readers such as Scc, ADDX and ROXL included, and runs each stream from
+ *  the same machine state twice: one instruction at a time with the normal
+ *  handlers, and through the block cache once it has recorded the stream,
+ *  so dead flag updates are skipped. Registers, SR and RAM must match when
+ *  the stream ends, where every flag is live again.
+ *
+ *  Usage:
+ *    basilisk_host --bench noflags [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "blockcache.h"
+
+#if USE_FLAG_LIVENESS
+
+// Memory layout inside 256KB of RAM. Address registers stay far enough
+// below the code that (d16,An) cannot reach it.
+const uint32 NOFLAGS_RAM_SIZE = 256 * 1024;
+const uaecptr DATA_LOW = 0x8000;
+const uaecptr DATA_HIGH = 0x17000;
+const uaecptr STACK_BASE = 0x18000;
+const uaecptr CODE_BASE = 0x20000;
+const uint32 CODE_SIZE = 0x1000;
+const int MAX_STREAM = 40;
+const int MAX_INSN_WORDS = 11;
+
+static uint32 rng_state = 0x9e3779b9;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint32 rnd_value(void)
+{
+    static const uint32 corners[] = {
+        0, 1, 0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0xffff,
+        0x7fffffff, 0x80000000, 0xffffffff, 0xfffffffe,
+    };
+    if (rnd() & 1)
+        return rnd();
+    return corners[rnd() % (sizeof(corners) / sizeof(corners[0]))];
+}
+
+struct cpu_state {
+    uae_u32 regs[16];
+    uaecptr pc;
+    uae_u16 sr;
+};
+
+static void capture(cpu_state &s)
+{
+    MakeSR();
+    s.sr = regs.sr;
+    memcpy(s.regs, regs.regs, sizeof(s.regs));
+    s.pc = m68k_getpc();
+}
+
+static bool same_state(const cpu_state &x, const cpu_state &y)
+{
+    return !memcmp(x.regs, y.regs, sizeof(x.regs)) && x.pc == y.pc && x.sr == y.sr;
+}
+
+static uae_u8 *ram_snapshot = NULL;
+static uae_u8 *ram_result = NULL;
+static struct regstruct regs_snapshot;
+static struct flag_struct flags_snapshot;
+
+static void restore_snapshot(void)
+{
+    memcpy(RAMBaseHost, ram_snapshot, RAMSize);
+    low_mem_mirror_sync(RAMBaseHost, RAMSize);
+    regs = regs_snapshot;
+    regflags = flags_snapshot;
+    m68k_setpc(CODE_BASE);
+    SPCFLAGS_INIT( 0 );
+}
+
+static void step(void)
+{
+    uae_u32 opcode = GET_OPCODE;
+    (*cpufunctbl[opcode])(opcode);
+}
+
+static void randomize_machine(bool all_ram)
+{
+    uint32 *ram = (uint32 *)RAMBaseHost;
+    if (all_ram) {
+        for (uint32 i = 0; i < RAMSize / 4; i++)
+            ram[i] = rnd();
+    } else {
+        for (int i = 0; i < 64; i++)
+            ram[rnd() % (RAMSize / 4)] = rnd();
+    }
+
+    regs.s = 1;
+    regs.m = 0;
+    regs.t1 = regs.t0 = 0;
+    regs.intmask = 7;
+    for (int i = 0; i < 8; i++)
+        m68k_dreg(regs, i) = rnd_value();
+    for (int i = 0; i < 7; i++)
+        m68k_areg(regs, i) = DATA_LOW + (rnd() % (DATA_HIGH - DATA_LOW));
+    m68k_areg(regs, 7) = STACK_BASE - (rnd() & 0xffc);
+    regs.isp = m68k_areg(regs, 7);
+    SET_CFLG(rnd() & 1);
+    SET_ZFLG(rnd() & 1);
+    SET_NFLG(rnd() & 1);
+    SET_VFLG(rnd() & 1);
+    SET_XFLG(rnd() & 1);
+    MakeSR();
+
+    memcpy(ram_snapshot, RAMBaseHost, RAMSize);
+    regs_snapshot = regs;
+    flags_snapshot = regflags;
+}
+
+/*
+ *  Write a random stream at CODE_BASE, followed by BRA.S to itself. Each
+ *  instruction is stepped once to learn its length. Returns the end PC.
+ */
+static uaecptr build_stream(const vector<uint16> &ops, int length)
+{
+    restore_snapshot();
+    uaecptr pc = CODE_BASE;
+    for (int i = 0; i < length; i++) {
+        WriteMacInt16(pc, ops[rnd() % ops.size()]);
+        for (int w = 1; w < MAX_INSN_WORDS; w++)
+            WriteMacInt16(pc + 2 * w, rnd());
+        m68k_setpc(pc);
+        step();
+        if (m68k_getpc() <= pc || m68k_getpc() >= CODE_BASE + CODE_SIZE - 2 * MAX_INSN_WORDS)
+            break;      // Overwrote itself and ran into something else
+        pc = m68k_getpc();
+    }
+    WriteMacInt16(pc, 0x60fe);      // bra.s *
+
+    // The probe run scribbled over data and registers, keep only the code
+    memcpy(ram_snapshot + CODE_BASE, RAMBaseHost + CODE_BASE, CODE_SIZE);
+    return pc;
+}
+
+// Still inside the stream and not done
+static bool running(uaecptr end)
+{
+    uaecptr pc = m68k_getpc();
+    return pc >= CODE_BASE && pc < end;
+}
+
+static void run_interpreted(uaecptr end)
+{
+    restore_snapshot();
+    for (int i = 0; i < MAX_STREAM && running(end); i++)
+        step();
+}
+
+static void run_cached(uaecptr end)
+{
+    restore_snapshot();
+    for (int i = 0; i < MAX_STREAM && running(end); i++) {
+        block_cache_execute(1);
+        SPCFLAGS_CLEAR( SPCFLAG_BLOCK_INVALID );    // As do_specialties() does
+    }
+}
+
+int HostBenchNoFlags(uint64 iterations)
+{
+    if (!HostBenchInit(NOFLAGS_RAM_SIZE)) {
+        fprintf(stderr, "No-flags check setup failed\n");
+        return 1;
+    }
+    ram_snapshot = (uae_u8 *)malloc(RAMSize);
+    ram_result = (uae_u8 *)malloc(RAMSize);
+    block_cache_enabled = true;
+
+    vector<uint16> ops;
+    for (uint32 opcode = 0; opcode < 0xf000; opcode++) {
+        if (table68k[opcode].mnemo != i_ILLG && table68k[opcode].clev <= 4
+                && block_flags_straight_line(opcode))
+            ops.push_back(opcode);
+    }
+
+    uint64 cases = iterations / 200;
+    if (cases == 0) cases = 1;
+    uint64 failures = 0, skipped = 0, instructions = 0;
+    uint32 noflags_before = block_stats.noflags;
+    for (uint64 n = 0; n < cases; n++) {
+        randomize_machine(n == 0);
+        int length = 2 + rnd() % (MAX_STREAM - 2);
+        uaecptr end = build_stream(ops, length);
+
+        cpu_state plain, cached;
+        run_interpreted(end);
+        capture(plain);
+        memcpy(ram_result, RAMBaseHost, RAMSize);
+
+        // Skip streams that stored into their own code: the cached copy
+        // would be stale, and the interpreter may not even reach the end
+        if (plain.pc != end || memcmp(RAMBaseHost + CODE_BASE, ram_snapshot + CODE_BASE, CODE_SIZE)) {
+            skipped++;
+            continue;
+        }
+
+        // First pass records the blocks, the second one replays them
+        block_cache_flush();
+        run_cached(end);
+        run_cached(end);
+        capture(cached);
+        instructions += length;
+
+        bool match = same_state(plain, cached) && !memcmp(ram_result, RAMBaseHost, RAMSize);
+        if (!match) {
+            if (failures < 10) {
+                fprintf(stderr, "noflags: mismatch in %d-instruction stream: sr %04x/%04x pc %08x/%08x d0 %08x/%08x\n",
+                        length, plain.sr, cached.sr, plain.pc, cached.pc, plain.regs[0], cached.regs[0]);
+                for (uaecptr pc = CODE_BASE; pc < end; pc += 2)
+                    fprintf(stderr, "%04x%s", ReadMacInt16(pc), pc + 2 < end ? " " : "\n");
+            }
+            failures++;
+        }
+    }
+
+    printf("bench=noflags\n");
+    printf("noflags.cases=%llu\n", (unsigned long long)cases);
+    printf("noflags.skipped=%llu\n", (unsigned long long)skipped);
+    printf("noflags.instructions=%llu\n", (unsigned long long)instructions);
+    printf("noflags.handlers_switched=%u\n", block_stats.noflags - noflags_before);
+    printf("noflags.mismatches=%llu\n", (unsigned long long)failures);
+    printf("match=%d\n", failures == 0);
+
+    Exit680x0();
+    return failures == 0 ? 0 : 1;
+}
+
+#else
+
+int HostBenchNoFlags(uint64 iterations)
+{
+    UNUSED(iterations);
+    fprintf(stderr, "Built without USE_FLAG_LIVENESS, nothing to compare\n");
+    return 1;
+}
+
+#endif /* USE_FLAG_LIVENESS */
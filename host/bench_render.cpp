@@ -0,0 +1,290 @@
+/*
+ *  bench_render.cpp - 2x palette render kernel check and benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Compares the scalar kernels in video_render.cpp (doubled palette, one
+ *  32-bit store per Mac pixel, second row repeated) with a copy of the
+ *  render loop they replaced in video_esp32.cpp (four 16-bit stores per
+ *  Mac pixel into two rows, packed rows unpacked first). Output must be
+ *  bit-exact for:
+ *
+ *    tiles   every 40x40 tile of random 8-bit frames
+ *    rows    full rows of random frames at 1, 2, 4 and 8-bit
+ *    tails   widths that end inside a byte, 1 to 64 pixels
+ *    16bit   Thousands rows (big-endian 565 in the frame buffer), which
+ *            must come out as the display's swap565 pixels, each doubled
+ *    1x      1280-pixel rows and tails at every depth through
+ *            VideoRenderRow1x(), which must equal every other pixel of
+ *            the 2x kernel's output
+ *
+ *  Then a 40x40 tile and a full frame at every depth are timed both ways,
+ *  a Thousands frame (doubling only) against them, and a 1280x720 frame
+ *  at 1:1.
+ *
+ *  Usage:
+ *    basilisk_host --bench render [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "main.h"
+#include "video.h"
+#include "video_dirty.h"
+#include "video_unpack.h"
+#include "video_render.h"
+#include "host.h"
+
+const int SCREEN_WIDTH = 640;
+const int SCREEN_HEIGHT = 360;
+const int OUT_WIDTH = SCREEN_WIDTH * 2;
+const int TILE_OUT_WIDTH = TILE_WIDTH * 2;
+const int HIRES_WIDTH = 1280;
+const int HIRES_HEIGHT = 720;
+
+static uint32 rng_state = 0x68e31da4;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/*
+ *  The render loop as it was before the doubled palette: 4 indices per
+ *  32-bit read, each color stored twice in both display rows
+ */
+static void ref_render_rows(const uint8 *src, int src_stride, const uint16 *palette, uint16 *out,
+                            int out_stride, int width, int rows)
+{
+    for (int row = 0; row < rows; row++) {
+        const uint8 *s = src + row * src_stride;
+        uint16 *dst_row0 = out;
+        uint16 *dst_row1 = out + out_stride;
+        int x = 0;
+        for (; x < width - 3; x += 4) {
+            uint32 src4 = *((const uint32 *)s);
+            s += 4;
+            uint16 c0 = palette[src4 & 0xFF];
+            uint16 c1 = palette[(src4 >> 8) & 0xFF];
+            uint16 c2 = palette[(src4 >> 16) & 0xFF];
+            uint16 c3 = palette[(src4 >> 24) & 0xFF];
+            dst_row0[0] = c0; dst_row0[1] = c0;
+            dst_row0[2] = c1; dst_row0[3] = c1;
+            dst_row0[4] = c2; dst_row0[5] = c2;
+            dst_row0[6] = c3; dst_row0[7] = c3;
+            dst_row1[0] = c0; dst_row1[1] = c0;
+            dst_row1[2] = c1; dst_row1[3] = c1;
+            dst_row1[4] = c2; dst_row1[5] = c2;
+            dst_row1[6] = c3; dst_row1[7] = c3;
+            dst_row0 += 8;
+            dst_row1 += 8;
+        }
+        for (; x < width; x++) {
+            uint16 c = palette[*s++];
+            dst_row0[0] = c; dst_row0[1] = c;
+            dst_row1[0] = c; dst_row1[1] = c;
+            dst_row0 += 2;
+            dst_row1 += 2;
+        }
+        out += out_stride * 2;
+    }
+}
+
+// Packed or 8-bit frame buffer row: unpacked first, as the streaming path did
+static void ref_render_row(const uint8 *src, video_depth depth, const uint16 *palette, uint16 *out, int width)
+{
+    static uint8 decoded[SCREEN_WIDTH + 8] __attribute__((aligned(4)));
+    VideoUnpackRow(src, decoded, width, depth);
+    ref_render_rows(decoded, 0, palette, out, OUT_WIDTH, width, 1);
+}
+
+// Thousands row: big-endian 565 pixels, sent to the display byte-swapped
+static void ref_render_row16(const uint8 *src, uint16 *out, int width)
+{
+    for (int x = 0; x < width; x++) {
+        uint16 c = (uint16)(src[x * 2] | (src[x * 2 + 1] << 8));    // swap565
+        out[x * 2] = out[x * 2 + 1] = c;
+        out[OUT_WIDTH + x * 2] = out[OUT_WIDTH + x * 2 + 1] = c;
+    }
+}
+
+// The same through the kernels
+static void new_render_rows(const uint8 *src, int src_stride, video_depth depth, const uint32 *doubled,
+                            uint16 *out, int out_stride, int width, int rows)
+{
+    for (int row = 0; row < rows; row++) {
+        VideoRenderRow2x(src + row * src_stride, out, width, depth, doubled);
+        VideoRepeatRow(out, out + out_stride, width * 2);
+        out += out_stride * 2;
+    }
+}
+
+static uint32 mismatches = 0;
+
+static void check(bool same, const char *what, int a, int b)
+{
+    if (same) return;
+    if (mismatches < 10)
+        fprintf(stderr, "render: %s %d/%d differs\n", what, a, b);
+    mismatches++;
+}
+
+int HostBenchRender(uint64 iterations)
+{
+    static const char *depth_names[] = {"1bit", "2bit", "4bit", "8bit"};
+
+    VideoUnpackInit();
+
+    uint16 palette[256];
+    uint32 doubled[256];
+    for (int i = 0; i < 256; i++)
+        palette[i] = rnd();
+    VideoDoublePalette(palette, doubled, 256);
+
+    uint8 *fb = (uint8 *)malloc(HIRES_WIDTH * HIRES_HEIGHT * 2);
+    uint16 *ref_out = (uint16 *)aligned_alloc(16, OUT_WIDTH * 2 * sizeof(uint16));
+    uint16 *new_out = (uint16 *)aligned_alloc(16, OUT_WIDTH * 2 * sizeof(uint16));
+    static uint8 tile[TILE_WIDTH * TILE_HEIGHT] __attribute__((aligned(4)));
+    static uint16 ref_tile_out[TILE_OUT_WIDTH * TILE_HEIGHT * 2] __attribute__((aligned(16)));
+    static uint16 new_tile_out[TILE_OUT_WIDTH * TILE_HEIGHT * 2] __attribute__((aligned(16)));
+
+    printf("bench=render\n");
+
+    // Tiles of 8-bit frames (packed depths are covered by the rows)
+    for (int pass = 0; pass < 4; pass++) {
+        for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++)
+            fb[i] = pass == 0 ? i : rnd();
+        for (int ty = 0; ty < TILES_Y; ty++) {
+            for (int tx = 0; tx < TILES_X; tx++) {
+                const uint8 *src = fb + ty * TILE_HEIGHT * SCREEN_WIDTH + tx * TILE_WIDTH;
+                for (int row = 0; row < TILE_HEIGHT; row++)
+                    memcpy(tile + row * TILE_WIDTH, src + row * SCREEN_WIDTH, TILE_WIDTH);
+                ref_render_rows(tile, TILE_WIDTH, palette, ref_tile_out, TILE_OUT_WIDTH, TILE_WIDTH, TILE_HEIGHT);
+                new_render_rows(tile, TILE_WIDTH, VDEPTH_8BIT, doubled, new_tile_out, TILE_OUT_WIDTH, TILE_WIDTH, TILE_HEIGHT);
+                check(!memcmp(ref_tile_out, new_tile_out, sizeof(ref_tile_out)), "tile", tx, ty);
+            }
+        }
+    }
+
+    // Frame buffer rows at every depth, then widths ending inside a byte
+    for (int d = VDEPTH_1BIT; d <= VDEPTH_8BIT; d++) {
+        video_depth depth = (video_depth)d;
+        uint32 bpr = (SCREEN_WIDTH << d) >> 3;
+        for (int pass = 0; pass < 2; pass++) {
+            for (uint32 i = 0; i < bpr * SCREEN_HEIGHT; i++)
+                fb[i] = rnd();
+            for (int y = 0; y < SCREEN_HEIGHT; y++) {
+                ref_render_row(fb + y * bpr, depth, palette, ref_out, SCREEN_WIDTH);
+                new_render_rows(fb + y * bpr, 0, depth, doubled, new_out, OUT_WIDTH, SCREEN_WIDTH, 1);
+                check(!memcmp(ref_out, new_out, OUT_WIDTH * 2 * sizeof(uint16)), depth_names[d], y, pass);
+            }
+        }
+        for (int width = 1; width <= 64; width++) {
+            ref_render_row(fb, depth, palette, ref_out, width);
+            new_render_rows(fb, 0, depth, doubled, new_out, OUT_WIDTH, width, 1);
+            bool same = true;
+            for (int r = 0; r < 2; r++)
+                same &= !memcmp(ref_out + r * OUT_WIDTH, new_out + r * OUT_WIDTH, width * 2 * sizeof(uint16));
+            check(same, depth_names[d], width, -1);
+        }
+    }
+
+    // Thousands rows and tails
+    const uint32 bpr16 = SCREEN_WIDTH * 2;
+    for (uint32 i = 0; i < bpr16 * SCREEN_HEIGHT; i++)
+        fb[i] = rnd();
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        ref_render_row16(fb + y * bpr16, ref_out, SCREEN_WIDTH);
+        new_render_rows(fb + y * bpr16, 0, VDEPTH_16BIT, doubled, new_out, OUT_WIDTH, SCREEN_WIDTH, 1);
+        check(!memcmp(ref_out, new_out, OUT_WIDTH * 2 * sizeof(uint16)), "16bit", y, 0);
+    }
+    for (int width = 1; width <= 64; width++) {
+        ref_render_row16(fb, ref_out, width);
+        new_render_rows(fb, 0, VDEPTH_16BIT, doubled, new_out, OUT_WIDTH, width, 1);
+        bool same = true;
+        for (int r = 0; r < 2; r++)
+            same &= !memcmp(ref_out + r * OUT_WIDTH, new_out + r * OUT_WIDTH, width * 2 * sizeof(uint16));
+        check(same, "16bit", width, -1);
+    }
+
+    // 1:1 rows (1280x720 modes): one display pixel per Mac pixel, the same
+    // colors as the 2x kernel's
+    static uint16 wide_out[HIRES_WIDTH * 2] __attribute__((aligned(16)));
+    static uint16 one_out[HIRES_WIDTH] __attribute__((aligned(16)));
+    for (int d = VDEPTH_1BIT; d <= VDEPTH_16BIT; d++) {
+        video_depth depth = (video_depth)d;
+        uint32 bpr = (HIRES_WIDTH << d) >> 3;
+        for (uint32 i = 0; i < bpr * 16; i++)
+            fb[i] = rnd();
+        for (int y = 0; y < 16; y++) {
+            int width = y == 0 ? HIRES_WIDTH : y * 4 - 1;    // Full row, then tails
+            VideoRenderRow2x(fb + y * bpr, wide_out, width, depth, doubled);
+            VideoRenderRow1x(fb + y * bpr, one_out, width, depth, doubled);
+            bool same = true;
+            for (int x = 0; x < width; x++)
+                same &= one_out[x] == wide_out[x * 2];
+            check(same, "1x", d, width);
+        }
+    }
+
+    // One tile, as the dirty tile path renders it
+    uint64 tiles = iterations / 100;
+    if (tiles < 20000) tiles = 20000;
+    uint64 t0 = HostWallNanos();
+    for (uint64 n = 0; n < tiles; n++)
+        ref_render_rows(tile, TILE_WIDTH, palette, ref_tile_out, TILE_OUT_WIDTH, TILE_WIDTH, TILE_HEIGHT);
+    uint64 t1 = HostWallNanos();
+    for (uint64 n = 0; n < tiles; n++)
+        new_render_rows(tile, TILE_WIDTH, VDEPTH_8BIT, doubled, new_tile_out, TILE_OUT_WIDTH, TILE_WIDTH, TILE_HEIGHT);
+    uint64 t2 = HostWallNanos();
+    printf("render.tile.store16_ns=%.0f\n", (double)(t1 - t0) / tiles);
+    printf("render.tile.doubled_ns=%.0f\n", (double)(t2 - t1) / tiles);
+
+    // Full frames, row by row as the streaming path renders them
+    uint64 frames = tiles / 144;
+    for (int d = VDEPTH_1BIT; d <= VDEPTH_8BIT; d++) {
+        video_depth depth = (video_depth)d;
+        uint32 bpr = (SCREEN_WIDTH << d) >> 3;
+        t0 = HostWallNanos();
+        for (uint64 f = 0; f < frames; f++)
+            for (int y = 0; y < SCREEN_HEIGHT; y++)
+                ref_render_row(fb + y * bpr, depth, palette, ref_out, SCREEN_WIDTH);
+        t1 = HostWallNanos();
+        for (uint64 f = 0; f < frames; f++)
+            for (int y = 0; y < SCREEN_HEIGHT; y++)
+                new_render_rows(fb + y * bpr, 0, depth, doubled, new_out, OUT_WIDTH, SCREEN_WIDTH, 1);
+        t2 = HostWallNanos();
+        printf("render.%s.store16_frame_us=%.1f\n", depth_names[d], (double)(t1 - t0) / frames / 1000);
+        printf("render.%s.doubled_frame_us=%.1f\n", depth_names[d], (double)(t2 - t1) / frames / 1000);
+    }
+
+    // Thousands frame: twice the bytes read, no palette lookup
+    t0 = HostWallNanos();
+    for (uint64 f = 0; f < frames; f++)
+        for (int y = 0; y < SCREEN_HEIGHT; y++)
+            new_render_rows(fb + y * bpr16, 0, VDEPTH_16BIT, doubled, new_out, OUT_WIDTH, SCREEN_WIDTH, 1);
+    t1 = HostWallNanos();
+    printf("render.16bit.direct_frame_us=%.1f\n", (double)(t1 - t0) / frames / 1000);
+
+    // 1280x720 8-bit frame at 1:1: four times the Mac pixels of 640x360,
+    // the same number of display pixels
+    for (int i = 0; i < HIRES_WIDTH * HIRES_HEIGHT; i++)
+        fb[i] = rnd();
+    t0 = HostWallNanos();
+    for (uint64 f = 0; f < frames; f++)
+        for (int y = 0; y < HIRES_HEIGHT; y++)
+            VideoRenderRow1x(fb + y * HIRES_WIDTH, one_out, HIRES_WIDTH, VDEPTH_8BIT, doubled);
+    t1 = HostWallNanos();
+    printf("render.1x.8bit_frame_us=%.1f\n", (double)(t1 - t0) / frames / 1000);
+
+    printf("render.mismatches=%u\n", mismatches);
+    printf("match=%d\n", mismatches == 0);
+
+    free(fb);
+    free(ref_out);
+    free(new_out);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+/*
+ *  bench_tear.cpp - Torn tile detection test
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The video task converts dirty tiles straight from the frame buffer
+ *  while the emulation core keeps writing to it, and relies on the
+ *  generation check of VideoDirtyRenderTiles() (video_dirty.cpp) to catch
+ *  tiles that changed under it. This drives that same pass, with a push
+ *  callback drawing into a simulated 1280x720 display, and lands the race
+ *  deterministically in its after_push hook, between the conversion of a
+ *  run and its check:
+ *
+ *    store     a byte of the tile is inverted (and marked, as the frame
+ *              buffer bank does), and the tile drawn again: the conversion
+ *              caught the store
+ *    revert    the byte is stored back (and marked), like a blinking
+ *              insertion point, so the tile hashes as it did before
+ *
+ *  Between frames the core fills rectangles and inverts others twice.
+ *  Only the marks (VideoDirtyTileWritten()) show the reverted tiles were
+ *  written; the hash does not. After the core stops and the queue drains,
+ *  the display must equal a full render of the final frame buffer with
+ *  the check, and must not without it (pass.unchecked), or the race did
+ *  not exercise the check.
+ *
+ *  A third run (threaded) draws the same rectangles from a thread of its
+ *  own while the frames are rendered, as the emulation core does on the
+ *  device, so stores land at any point of the pass and go through the
+ *  relaxed marks and fences for real. With the check, it must end on the
+ *  same display as a full render too. On a single-core host the threads
+ *  only interleave when one is preempted, so its tiles_torn stays low
+ *  unless --iterations is raised (about 30-150 torn tiles at 10000000).
+ *
+ *  Usage:
+ *    basilisk_host --bench tear [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "main.h"
+#include "video.h"
+#include "video_dirty.h"
+#include "video_render.h"
+#include "host.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+const int DISPLAY_WIDTH = 1280;
+const int DISPLAY_HEIGHT = 720;
+
+// Rectangles the core draws between two frames
+const int RECTS_PER_FRAME = 8;
+
+// One in RACE_ODDS converted tiles gets a racing store
+const uint32 RACE_ODDS = 4;
+
+static uint32 rng_state = 0x2545f491;
+
+static uint32 rnd(uint32 &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/*
+ *  Screen mode under test
+ */
+struct tear_mode {
+    const char *name;
+    int width, height;
+    video_depth depth;
+};
+
+static uint8 *frame_buffer;
+static uint32 bytes_per_row;
+static int screen_height, scale, tile_width, tile_height, tile_bytes;
+static video_depth depth;
+
+/*
+ *  Emulation core side
+ */
+static uint64 core_stores;
+static bool core_running;
+
+// One 32-bit store, marked before and after it lands, as memory.cpp does
+static inline void store_long(uint32 offset, uint32 value)
+{
+    VideoMarkDirtyRange(offset, 4);
+    memcpy(frame_buffer + offset, &value, 4);
+    VideoMarkDirtyRange(offset, 4);
+    core_stores++;
+}
+
+static inline void store_byte(uint32 offset, uint8 value)
+{
+    VideoMarkDirtyOffset(offset);
+    frame_buffer[offset] = value;
+    VideoMarkDirtyOffset(offset);
+    core_stores++;
+}
+
+// Fill a rectangle, or invert one twice
+static void draw_rect(uint32 &state)
+{
+    // Rectangle in whole longs of the frame buffer
+    uint32 w = 4 + (rnd(state) % 32) * 4;
+    if (w > bytes_per_row) w = bytes_per_row;
+    uint32 h = 1 + rnd(state) % 80;
+    uint32 x = (rnd(state) % ((bytes_per_row - w) / 4 + 1)) * 4;
+    uint32 y = rnd(state) % (screen_height - h + 1);
+    bool invert = rnd(state) & 1;
+    uint32 fill = rnd(state);
+    for (int pass = 0; pass < (invert ? 2 : 1); pass++) {
+        for (uint32 row = y; row < y + h; row++) {
+            uint32 offset = row * bytes_per_row + x;
+            for (uint32 i = 0; i < w; i += 4) {
+                uint32 value = fill;
+                if (invert) {
+                    memcpy(&value, frame_buffer + offset + i, 4);
+                    value = ~value;
+                }
+                store_long(offset + i, value);
+            }
+        }
+    }
+}
+
+// Core thread of the threaded run
+static void *core_thread(void *param)
+{
+    UNUSED(param);
+    uint32 state = 0x9e3779b9;
+    while (__atomic_load_n(&core_running, __ATOMIC_RELAXED))
+        draw_rect(state);
+    return NULL;
+}
+
+/*
+ *  Video task side
+ */
+static uint16 display[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+static uint16 reference[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+static uint32 doubled[256];
+static video_tile_state tile_state;
+static uint32 race_state;
+static uint32 races;
+static bool racing;
+
+static void render_tile(uint16 *out, int tile)
+{
+    int ty = tile / TILES_X, tx = tile % TILES_X;
+    const uint8 *src = frame_buffer + ty * tile_height * bytes_per_row + tx * tile_bytes;
+    uint16 *dst = out + ty * tile_height * scale * DISPLAY_WIDTH + tx * tile_width * scale;
+    for (int row = 0; row < tile_height; row++, src += bytes_per_row) {
+        if (scale == 1) {
+            VideoRenderRow1x(src, dst, tile_width, depth, doubled);
+            dst += DISPLAY_WIDTH;
+        } else {
+            VideoRenderRow2x(src, dst, tile_width, depth, doubled);
+            VideoRepeatRow(dst, dst + DISPLAY_WIDTH, tile_width * 2);
+            dst += DISPLAY_WIDTH * 2;
+        }
+    }
+}
+
+// video_tile_pass::push_run
+static void push_run(void *ctx, int first_tx, int count, int ty)
+{
+    UNUSED(ctx);
+    for (int i = 0; i < count; i++)
+        render_tile(display, ty * TILES_X + first_tx + i);
+}
+
+// video_tile_pass::after_push: a store the conversion caught, then undone
+static void race_run(void *ctx, int first_tx, int count, int ty)
+{
+    UNUSED(ctx);
+    if (!racing)
+        return;
+    for (int i = 0; i < count; i++) {
+        if (rnd(race_state) % RACE_ODDS)
+            continue;
+        int tile = ty * TILES_X + first_tx + i;
+        uint32 offset = (ty * tile_height + rnd(race_state) % tile_height) * bytes_per_row +
+                        (first_tx + i) * tile_bytes + rnd(race_state) % tile_bytes;
+        uint8 old = frame_buffer[offset];
+        store_byte(offset, ~old);
+        render_tile(display, tile);
+        store_byte(offset, old);
+        races++;
+    }
+}
+
+// One frame of renderAndPushDirtyTiles(); false if nothing was dirty
+static bool render_frame(video_tile_pass &pass)
+{
+    uint32 dirty[TILE_WORDS];
+    VideoDirtyCollect(dirty);
+    bool any = false;
+    for (int w = 0; w < TILE_WORDS; w++) {
+        dirty[w] |= tile_state.torn[w];
+        any |= dirty[w] != 0;
+    }
+    if (!any)
+        return false;
+    VideoDirtyRenderTiles(&pass, &tile_state, dirty, NULL, false);
+    return true;
+}
+
+/*
+ *  Draw and render frames with racing stores, stop, drain the queue and
+ *  count the tiles that differ from a full render of the final frame
+ *  (-1 if the core thread cannot start)
+ */
+static int run(const tear_mode &m, bool checked, bool threaded, uint32 frames, video_tile_pass &pass)
+{
+    memset(&pass, 0, sizeof(pass));
+    pass.src = frame_buffer;
+    pass.bytes_per_row = bytes_per_row;
+    pass.depth = depth;
+    pass.tile_width = tile_width;
+    pass.tile_height = tile_height;
+    pass.push_run = push_run;
+    pass.after_push = race_run;
+    pass.unchecked = !checked;
+
+    memset(&tile_state, 0, sizeof(tile_state));
+    memset(frame_buffer, 0, bytes_per_row * screen_height);
+    VideoDirtySetMode(m.width, m.height, depth, bytes_per_row, bytes_per_row * screen_height);
+    for (int tile = 0; tile < TOTAL_TILES; tile++) {
+        render_tile(display, tile);
+        tile_state.hash[tile] = VideoHashTile(frame_buffer + (tile / TILES_X) * tile_height * bytes_per_row +
+                                              (tile % TILES_X) * tile_bytes, bytes_per_row, tile_bytes, tile_height);
+    }
+
+    // Same rectangles for both runs of a mode
+    uint32 state = 0x9e3779b9;
+    race_state = 0x6a09e667;
+    races = 0;
+    core_stores = 0;
+    if (threaded) {
+        pthread_t core;
+        __atomic_store_n(&core_running, true, __ATOMIC_RELAXED);
+        if (pthread_create(&core, NULL, core_thread, NULL) != 0) {
+            fprintf(stderr, "tear: cannot start the core thread\n");
+            return -1;
+        }
+        for (uint32 f = 0; f < frames; f++) {
+            if (!render_frame(pass))
+                sched_yield();
+        }
+        __atomic_store_n(&core_running, false, __ATOMIC_RELAXED);
+        pthread_join(core, NULL);
+    } else {
+        racing = true;
+        for (uint32 f = 0; f < frames; f++) {
+            for (int i = 0; i < RECTS_PER_FRAME; i++)
+                draw_rect(state);
+            render_frame(pass);
+        }
+        racing = false;
+    }
+
+    // The core is done: every mark is in, frames settle the display
+    for (int f = 0; f < 4 && render_frame(pass); f++)
+        ;
+
+    for (int tile = 0; tile < TOTAL_TILES; tile++)
+        render_tile(reference, tile);
+    int wrong = 0;
+    for (int tile = 0; tile < TOTAL_TILES; tile++) {
+        int ty = tile / TILES_X, tx = tile % TILES_X;
+        int x = tx * tile_width * scale, w = tile_width * scale;
+        for (int y = ty * tile_height * scale; y < (ty + 1) * tile_height * scale; y++) {
+            if (memcmp(display + y * DISPLAY_WIDTH + x, reference + y * DISPLAY_WIDTH + x, w * sizeof(uint16))) {
+                wrong++;
+                break;
+            }
+        }
+    }
+    return wrong;
+}
+
+int HostBenchTear(uint64 iterations)
+{
+    static const tear_mode modes[] = {
+        {"1bit", 640, 360, VDEPTH_1BIT},
+        {"8bit", 640, 360, VDEPTH_8BIT},
+        {"1280x720_8bit", 1280, 720, VDEPTH_8BIT},
+    };
+
+    frame_buffer = (uint8 *)malloc(DISPLAY_WIDTH * DISPLAY_HEIGHT);
+    if (!frame_buffer)
+        return 1;
+    uint16 palette[256];
+    for (int i = 0; i < 256; i++)
+        palette[i] = rnd(rng_state);
+    VideoDoublePalette(palette, doubled, 256);
+
+    uint32 frames = iterations / 5000;
+    if (frames < 100) frames = 100;
+
+    printf("bench=tear\n");
+    printf("tear.frames=%u\n", frames);
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        const tear_mode &m = modes[i];
+        screen_height = m.height;
+        depth = m.depth;
+        bytes_per_row = TrivialBytesPerRow(m.width, m.depth);
+        scale = DISPLAY_WIDTH / m.width;
+        tile_width = m.width / TILES_X;
+        tile_height = m.height / TILES_Y;
+        tile_bytes = (tile_width << depth) >> 3;
+
+        // Checked, unchecked, then checked against the core thread
+        for (int r = 0; r < 3; r++) {
+            bool checked = r != 1, threaded = r == 2;
+            video_tile_pass pass;
+            uint64 t0 = HostWallNanos();
+            int wrong = run(m, checked, threaded, frames, pass);
+            uint64 t1 = HostWallNanos();
+            if (wrong < 0) {
+                ok = false;
+                continue;
+            }
+            static const char *kinds[] = {"checked", "unchecked", "threaded"};
+            const char *kind = kinds[r];
+            printf("tear.%s.%s.stores=%llu\n", m.name, kind, (unsigned long long)core_stores);
+            if (!threaded)
+                printf("tear.%s.%s.races=%u\n", m.name, kind, races);
+            printf("tear.%s.%s.tiles_rendered=%u\n", m.name, kind, pass.pushed);
+            printf("tear.%s.%s.tiles_identical=%u\n", m.name, kind, pass.identical);
+            if (checked)
+                printf("tear.%s.%s.tiles_torn=%u\n", m.name, kind, pass.torn);
+            printf("tear.%s.%s.wrong_tiles=%d\n", m.name, kind, wrong);
+            printf("tear.%s.%s.frame_us=%.1f\n", m.name, kind, (double)(t1 - t0) / 1000 / frames);
+            if (checked && wrong) {
+                fprintf(stderr, "tear.%s: %d tiles differ from the frame buffer\n", m.name, wrong);
+                ok = false;
+            }
+            if (!checked && !wrong) {
+                fprintf(stderr, "tear.%s: no torn tile left without the check, the race missed it\n", m.name);
+                ok = false;
+            }
+        }
+    }
+    free(frame_buffer);
+    VideoDirtyReset();
+    printf("match=%d\n", ok);
+    return ok ? 0 : 1;
+}
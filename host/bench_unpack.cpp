@@ -0,0 +1,218 @@
+/*
+ *  bench_unpack.cpp - Packed pixel unpacking check and benchmark
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Compares the table-driven VideoUnpackRow() and VideoPackedPixel() in
+ *  video_unpack.cpp with copies of the per-pixel code they replaced in
+ *  video_esp32.cpp (decodePackedRow(), getPackedPixel() and the packed
+ *  branch of the tile snapshot, since dropped for rendering tiles straight
+ *  from the frame buffer). At 1, 2, 4 and 8-bit the output must be
+ *  bit-exact for:
+ *
+ *    bytes   every source byte value
+ *    rows    full 640-pixel rows of random frames
+ *    tiles   every 40x40 tile of those frames, read in place at its byte
+ *            offset in the frame buffer, as the tile path does
+ *            (VideoRenderRow2x() and VideoRenderRow1x() render the same
+ *            pixels without the unpack pass, see --bench render)
+ *    tails   widths that end inside a byte, 1 to 64 pixels
+ *    pixels  every pixel of a row through VideoPackedPixel()
+ *
+ *  Then full-frame unpacking is timed for both at every depth, with the
+ *  8-bit copy as the target packed modes should reach.
+ *
+ *  Usage:
+ *    basilisk_host --bench unpack [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "main.h"
+#include "video.h"
+#include "video_dirty.h"
+#include "video_unpack.h"
+#include "host.h"
+
+const int SCREEN_WIDTH = 640;
+const int SCREEN_HEIGHT = 360;
+
+static uint32 rng_state = 0x2545f491;
+
+static uint32 rnd(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/*
+ *  The unpacking code as it was before the lookup tables
+ */
+static void ref_decode_row(const uint8 *src, uint8 *dst, int width, video_depth depth)
+{
+    switch (depth) {
+        case VDEPTH_1BIT:
+            for (int x = 0; x < width; x++) {
+                int byte_idx = x / 8;
+                int bit_idx = 7 - (x % 8);
+                dst[x] = (src[byte_idx] >> bit_idx) & 0x01;
+            }
+            break;
+        case VDEPTH_2BIT:
+            for (int x = 0; x < width; x++) {
+                int byte_idx = x / 4;
+                int shift = 6 - ((x % 4) * 2);
+                dst[x] = (src[byte_idx] >> shift) & 0x03;
+            }
+            break;
+        case VDEPTH_4BIT:
+            for (int x = 0; x < width; x++) {
+                int byte_idx = x / 2;
+                int shift = (x % 2 == 0) ? 4 : 0;
+                dst[x] = (src[byte_idx] >> shift) & 0x0F;
+            }
+            break;
+        default:
+            memcpy(dst, src, width);
+            break;
+    }
+}
+
+static uint8 ref_get_pixel(const uint8 *row, int x, video_depth depth)
+{
+    switch (depth) {
+        case VDEPTH_1BIT: return (row[x / 8] >> (7 - (x % 8))) & 0x01;
+        case VDEPTH_2BIT: return (row[x / 4] >> (6 - ((x % 4) * 2))) & 0x03;
+        case VDEPTH_4BIT: return (row[x / 2] >> ((x % 2 == 0) ? 4 : 0)) & 0x0F;
+        default: return row[x];
+    }
+}
+
+static void ref_unpack_tile(const uint8 *fb, uint32 bpr, video_depth depth, int tx, int ty, uint8 *dst)
+{
+    for (int row = 0; row < TILE_HEIGHT; row++) {
+        const uint8 *src_row = fb + (ty * TILE_HEIGHT + row) * bpr;
+        for (int x = 0; x < TILE_WIDTH; x++)
+            *dst++ = ref_get_pixel(src_row, tx * TILE_WIDTH + x, depth);
+    }
+}
+
+// The same through the tables, from the tile's first byte in the frame buffer
+static void new_unpack_tile(const uint8 *fb, uint32 bpr, video_depth depth, int tx, int ty, uint8 *dst)
+{
+    const uint8 *src = fb + ty * TILE_HEIGHT * bpr + ((tx * TILE_WIDTH << depth) >> 3);
+    for (int row = 0; row < TILE_HEIGHT; row++) {
+        VideoUnpackRow(src, dst, TILE_WIDTH, depth);
+        src += bpr;
+        dst += TILE_WIDTH;
+    }
+}
+
+static uint32 mismatches = 0;
+
+static void check(bool same, const char *depth_name, const char *what, int a, int b)
+{
+    if (same) return;
+    if (mismatches < 10)
+        fprintf(stderr, "unpack.%s: %s %d/%d differs\n", depth_name, what, a, b);
+    mismatches++;
+}
+
+// Unpack every row of the frame, frames times; returns ns per frame
+static double time_frames(const uint8 *fb, uint32 bpr, video_depth depth, uint8 *out, uint64 frames, bool tables)
+{
+    uint64 t0 = HostWallNanos();
+    for (uint64 f = 0; f < frames; f++) {
+        for (int y = 0; y < SCREEN_HEIGHT; y++) {
+            if (tables)
+                VideoUnpackRow(fb + y * bpr, out + y * SCREEN_WIDTH, SCREEN_WIDTH, depth);
+            else
+                ref_decode_row(fb + y * bpr, out + y * SCREEN_WIDTH, SCREEN_WIDTH, depth);
+        }
+    }
+    return (double)(HostWallNanos() - t0) / frames;
+}
+
+int HostBenchUnpack(uint64 iterations)
+{
+    static const char *depth_names[] = {"1bit", "2bit", "4bit", "8bit"};
+
+    VideoUnpackInit();
+
+    uint8 *fb = (uint8 *)malloc(SCREEN_WIDTH * SCREEN_HEIGHT);
+    uint8 *ref_out = (uint8 *)malloc(SCREEN_WIDTH * SCREEN_HEIGHT);
+    uint8 *new_out = (uint8 *)malloc(SCREEN_WIDTH * SCREEN_HEIGHT);
+    static uint8 ref_tile[TILE_WIDTH * TILE_HEIGHT] __attribute__((aligned(4)));
+    static uint8 new_tile[TILE_WIDTH * TILE_HEIGHT] __attribute__((aligned(4)));
+
+    printf("bench=unpack\n");
+
+    uint64 frames = iterations / 10000;
+    if (frames < 50) frames = 50;
+
+    for (int d = VDEPTH_1BIT; d <= VDEPTH_8BIT; d++) {
+        video_depth depth = (video_depth)d;
+        const char *name = depth_names[d];
+        uint32 bpr = (SCREEN_WIDTH << d) >> 3;
+
+        // Every byte value, as the first byte of a row
+        for (int b = 0; b < 256; b++) {
+            uint8 src = b;
+            int width = 8 >> d;     // Pixels in one byte
+            ref_decode_row(&src, ref_out, width, depth);
+            VideoUnpackRow(&src, new_out, width, depth);
+            check(!memcmp(ref_out, new_out, width), name, "byte", b, 0);
+        }
+
+        for (int pass = 0; pass < 4; pass++) {
+            for (uint32 i = 0; i < bpr * SCREEN_HEIGHT; i++)
+                fb[i] = pass == 0 ? i : rnd();
+
+            // Full rows and single pixels
+            for (int y = 0; y < SCREEN_HEIGHT; y++) {
+                const uint8 *row = fb + y * bpr;
+                ref_decode_row(row, ref_out, SCREEN_WIDTH, depth);
+                VideoUnpackRow(row, new_out, SCREEN_WIDTH, depth);
+                check(!memcmp(ref_out, new_out, SCREEN_WIDTH), name, "row", y, pass);
+                for (int x = 0; x < SCREEN_WIDTH; x++)
+                    check(VideoPackedPixel(row, x, depth) == ref_get_pixel(row, x, depth), name, "pixel", x, y);
+            }
+
+            // Tiles in place
+            for (int ty = 0; ty < TILES_Y; ty++) {
+                for (int tx = 0; tx < TILES_X; tx++) {
+                    ref_unpack_tile(fb, bpr, depth, tx, ty, ref_tile);
+                    new_unpack_tile(fb, bpr, depth, tx, ty, new_tile);
+                    check(!memcmp(ref_tile, new_tile, sizeof(ref_tile)), name, "tile", tx, ty);
+                }
+            }
+
+            // Widths ending inside a byte
+            for (int width = 1; width <= 64; width++) {
+                memset(new_out, 0xee, width + 8);
+                ref_decode_row(fb, ref_out, width, depth);
+                VideoUnpackRow(fb, new_out, width, depth);
+                check(!memcmp(ref_out, new_out, width) && new_out[width] == 0xee, name, "tail", width, pass);
+            }
+        }
+
+        time_frames(fb, bpr, depth, new_out, 5, false);   // Warm up
+        time_frames(fb, bpr, depth, new_out, 5, true);
+        double ref_ns = time_frames(fb, bpr, depth, ref_out, frames, false);
+        double new_ns = time_frames(fb, bpr, depth, new_out, frames, true);
+        printf("unpack.%s.shift_frame_us=%.1f\n", name, ref_ns / 1000);
+        printf("unpack.%s.table_frame_us=%.1f\n", name, new_ns / 1000);
+        printf("unpack.%s.table_pixel_ns=%.3f\n", name, new_ns / (SCREEN_WIDTH * SCREEN_HEIGHT));
+    }
+
+    printf("unpack.table_bytes=%u\n", 256 * (8 + 4 + 2));
+    printf("unpack.mismatches=%u\n", mismatches);
+    printf("match=%d\n", mismatches == 0);
+
+    free(fb);
+    free(ref_out);
+    free(new_out);
+    return mismatches == 0 ? 0 : 1;
+}
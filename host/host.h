@@ -0,0 +1,54 @@
+/*
+ *  host.h - Interfaces shared by the host (Linux) build stand-ins
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+/*
+ *  Clock (host_clock.cpp)
+ *
+ *  By default the emulator sees wall-clock time. With a virtual clock the
+ *  time base advances by one second every "ips" emulated instructions, so
+ *  60Hz interrupts, Time Manager tasks and video refreshes land on the same
+ *  instruction every run and the framebuffer checksum is reproducible.
+ */
+extern void HostClockSetVirtual(uint64 ips);	// 0 = wall clock
+extern bool HostClockIsVirtual(void);
+extern uint64 HostWallMicros(void);				// Always wall-clock time
+extern uint64 HostWallNanos(void);				// The same in nanoseconds (benchmark timing)
+
+/*
+ *  Emulated instruction counter and sampling profiler (main_host.cpp)
+ */
+extern uint64 HostEmulatedInstructions(void);
+extern void HostStartProfiler(void);			// --sample-profile, once the CPU is set up
+
+/*
+ *  Benchmarks (bench_*.cpp), return the process exit code
+ */
+extern bool HostBenchInit(uint32 ram_size);		// ROM-less CPU and RAM setup
+extern int HostBenchCPU(uint64 iterations);		// Interpreter vs. block cache
+extern int HostBenchFlags(uint64 iterations);	// Lazy vs. eager condition codes
+extern int HostBenchNoFlags(uint64 iterations);	// Flag liveness vs. full flags
+extern int HostBenchDispatch(uint64 iterations);	// Compact vs. flat opcode table
+extern int HostBenchFusion(uint64 iterations);		// Fused pairs vs. single instructions
+extern int HostBenchMemory(uint64 iterations);		// Software TLB vs. RAM/ROM range checks
+extern int HostBenchBranch(uint64 iterations);		// PC translation cache vs. bank table
+extern int HostBenchLowMem(uint64 iterations);		// Low memory mirror vs. RAM only
+extern int HostBenchDirty(uint64 iterations);		// Table-driven vs. dividing dirty tile marking
+extern int HostBenchUnpack(uint64 iterations);		// Table-driven vs. per-pixel packed pixel unpacking
+extern int HostBenchRender(uint64 iterations);		// Doubled palette vs. 16-bit stores in 2x rendering
+extern int HostBenchTear(uint64 iterations);		// Torn tile detection against racing stores
+
+/*
+ *  Headless video (video_host.cpp)
+ */
+extern uint32 HostVideoFramesRendered(void);	// VideoRefresh() calls that found damage
+extern uint32 HostVideoChecksum(void);			// FNV-1a over visible framebuffer + palette
+extern bool HostVideoEnableSink(const char *frame_hashes_path, const char *dump_path, uint32 every, bool raw);
+extern void HostVideoFinish(void);				// Last dump, sink counters on stdout
+
+#endif /* HOST_H */
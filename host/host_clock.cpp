@@ -0,0 +1,97 @@
+/*
+ *  host_clock.cpp - Wall-clock and virtual time base for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  All emulator time sources end up here: millis()/micros() from the
+ *  Arduino stand-in, GetTicks_usec() from timer_host.cpp, and (through
+ *  linker --wrap, see host/CMakeLists.txt) the gettimeofday()/time() calls
+ *  made by driver_stubs.cpp for the Time Manager and the Mac clock.
+ */
+
+#include "sysdeps.h"
+#include "host.h"
+
+#include <time.h>
+#include <sys/time.h>
+
+// Virtual clock epoch: 2025-01-01 00:00:00 UTC. TimerDateTime() falls back
+// to the build timestamp for anything before 2020, which would make runs
+// depend on when the binary was compiled.
+static const time_t VIRTUAL_EPOCH = 1735689600;
+
+static uint64 virtual_ips = 0;		// Emulated instructions per virtual second (0 = wall clock)
+static uint64 wall_start_ns = 0;
+
+HostSerial Serial;
+
+uint64 HostWallNanos(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint64 now = (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+	if (wall_start_ns == 0)
+		wall_start_ns = now;
+	return now - wall_start_ns;
+}
+
+uint64 HostWallMicros(void)
+{
+	return HostWallNanos() / 1000;
+}
+
+void HostClockSetVirtual(uint64 ips)
+{
+	virtual_ips = ips;
+}
+
+bool HostClockIsVirtual(void)
+{
+	return virtual_ips != 0;
+}
+
+uint64_t HostClockMicros(void)
+{
+	if (virtual_ips)
+		return HostEmulatedInstructions() * 1000000ULL / virtual_ips;
+	return HostWallMicros();
+}
+
+void HostClockSleep(uint64_t usec)
+{
+	// Virtual time only advances by executing instructions
+	if (virtual_ips || usec == 0)
+		return;
+	struct timespec ts;
+	ts.tv_sec = usec / 1000000;
+	ts.tv_nsec = (usec % 1000000) * 1000;
+	nanosleep(&ts, NULL);
+}
+
+/*
+ *  Linker-wrapped libc time functions
+ */
+extern "C" {
+int __real_gettimeofday(struct timeval *tv, void *tz);
+time_t __real_time(time_t *t);
+
+int __wrap_gettimeofday(struct timeval *tv, void *tz)
+{
+	if (!virtual_ips)
+		return __real_gettimeofday(tv, tz);
+	uint64 us = HostClockMicros();
+	tv->tv_sec = VIRTUAL_EPOCH + us / 1000000;
+	tv->tv_usec = us % 1000000;
+	return 0;
+}
+
+time_t __wrap_time(time_t *t)
+{
+	if (!virtual_ips)
+		return __real_time(t);
+	time_t now = VIRTUAL_EPOCH + HostClockMicros() / 1000000;
+	if (t)
+		*t = now;
+	return now;
+}
+}
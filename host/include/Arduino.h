@@ -0,0 +1,83 @@
+/*
+ *  Arduino.h - Minimal Arduino core stand-in for the host (Linux) build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The shared emulator sources include <Arduino.h> through sysdeps.h and use
+ *  a small subset of the Arduino/ESP-IDF API (Serial logging, millis/micros,
+ *  ps_malloc, DRAM_ATTR). This header provides POSIX implementations of just
+ *  that subset so the UAE core and the Basilisk II drivers compile unchanged
+ *  on a Linux box. ARDUINO is deliberately NOT defined, so code guarded with
+ *  #ifdef ARDUINO takes its plain malloc() fallbacks.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+/*
+ *  Memory placement attributes (no IRAM/DRAM split on the host)
+ */
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+#ifndef DRAM_ATTR
+#define DRAM_ATTR
+#endif
+
+/*
+ *  Host clock (implemented in host/host_clock.cpp)
+ *  Either wall-clock time or a virtual clock driven by the number of
+ *  emulated instructions, see HostClockSetVirtual().
+ */
+extern uint64_t HostClockMicros(void);
+extern void HostClockSleep(uint64_t usec);
+
+static inline uint32_t millis(void) { return (uint32_t)(HostClockMicros() / 1000); }
+static inline uint32_t micros(void) { return (uint32_t)HostClockMicros(); }
+static inline void delay(uint32_t ms) { HostClockSleep((uint64_t)ms * 1000); }
+static inline void delayMicroseconds(uint32_t us) { HostClockSleep(us); }
+static inline void yield(void) {}
+
+/*
+ *  PSRAM allocation - ordinary heap on the host
+ */
+#define ps_malloc(size) malloc(size)
+#define ps_calloc(n, size) calloc(n, size)
+
+/*
+ *  Serial console - emulator log output goes to stderr so that the
+ *  benchmark report on stdout stays machine readable
+ */
+class HostSerial {
+public:
+	bool quiet = false;
+
+	int printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+	{
+		if (quiet) return 0;
+		va_list ap;
+		va_start(ap, fmt);
+		int n = vfprintf(stderr, fmt, ap);
+		va_end(ap);
+		return n;
+	}
+	size_t print(const char *s) { return quiet ? 0 : fputs(s, stderr); }
+	size_t println(const char *s) { return quiet ? 0 : fprintf(stderr, "%s\n", s); }
+	size_t println(void) { return quiet ? 0 : fputs("\n", stderr); }
+};
+
+extern HostSerial Serial;
+
+#endif /* HOST_ARDUINO_H */
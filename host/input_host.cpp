@@ -0,0 +1,50 @@
+/*
+ *  input_host.cpp - Input handling for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  There is no touch panel or USB host on a headless run; the Mac just
+ *  sees an idle ADB mouse and keyboard.
+ */
+
+#include "sysdeps.h"
+#include "input.h"
+
+bool InputInit(void)
+{
+    return true;
+}
+
+void InputExit(void)
+{
+}
+
+void InputPoll(void)
+{
+}
+
+void InputSetScreenSize(int width, int height)
+{
+    UNUSED(width);
+    UNUSED(height);
+}
+
+void InputSetTouchEnabled(bool enabled)
+{
+    UNUSED(enabled);
+}
+
+void InputSetKeyboardEnabled(bool enabled)
+{
+    UNUSED(enabled);
+}
+
+bool InputIsKeyboardConnected(void)
+{
+    return false;
+}
+
+bool InputIsMouseConnected(void)
+{
+    return false;
+}
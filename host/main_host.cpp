@@ -0,0 +1,567 @@
+/*
+ *  main_host.cpp - Headless benchmark runner for the host (Linux) build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Boots a ROM and disk image with the same emulator core, ROM patches and
+ *  drivers as the ESP32-P4 build, runs for a fixed number of emulated
+ *  instructions and/or seconds, then prints a machine-readable report
+ *  (MIPS, frames rendered, framebuffer checksum, and with --render the
+ *  video pipeline counters and display hash) on stdout. Emulator log
+ *  output goes to stderr.
+ *
+ *  Usage:
+ *    basilisk_host --rom Q650.ROM --disk Macintosh8.dsk [options]
+ *
+ *  Options:
+ *    --rom FILE             Mac ROM image (required)
+ *    --disk FILE            Disk image, may be repeated
+ *    --ram MB               Mac RAM size (default 8, as on the device)
+ *    --instructions N       Stop after N emulated instructions
+ *    --seconds S            Stop after S seconds of emulated time
+ *    --virtual-clock IPS    Drive all emulator time sources from the
+ *                           instruction count (IPS instructions = 1 second)
+ *                           so runs are bit-for-bit reproducible
+ *    --opcode-profile FILE  Write executed instruction counts per handler
+ *                           (needs -DBASILISK_OPCODE_PROFILE=ON), input for
+ *                           scripts/hot_handlers.py
+ *    --pair-profile FILE    Write executed straight-line instruction + Bcc/DBcc
+ *                           pairs (same build), input for gencpu --fuse
+ *    --sample-profile FILE  Run the sampling profiler and write its report
+ *    --sample-interval N    Instructions between samples (default 1000)
+ *    --no-low-mem-mirror    Keep low memory in Mac RAM only (timing comparison)
+ *    --render               Draw frames into a 1280x720 display in memory with
+ *                           the device's tile pipeline and report its counters
+ *    --frame-hashes FILE    Write the display hash of every drawn frame
+ *    --dump-frames DIR      Write every Nth drawn frame and the last one as PNG
+ *    --dump-every N         N for --dump-frames (default 60)
+ *    --dump-raw             Dump raw swap565 pixels instead of PNG
+ *    --quiet                Suppress emulator log output
+ *
+ *  Benchmarks (no ROM needed):
+ *    basilisk_host --bench cpu|flags|noflags|dispatch|fusion|memory|branch|lowmem|dirty|unpack|render|tear [--iterations N]
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "sys.h"
+#include "rom_patches.h"
+#include "xpram.h"
+#include "timer.h"
+#include "video.h"
+#include "prefs.h"
+#include "prefs_items.h"
+#include "main.h"
+#include "user_strings.h"
+#include "input.h"
+#include "host.h"
+
+#include "m68k.h"
+#include "newcpu.h"
+#include "blockcache.h"
+#include "profiler.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// ROM file size limits (same as the device)
+const uint32 ROM_MIN_SIZE = 64 * 1024;
+const uint32 ROM_MAX_SIZE = 1024 * 1024;
+
+// CPU and FPU type
+int CPUType = 4;           // 68040
+bool CPUIs68060 = false;
+int FPUType = 1;           // 68881
+bool TwentyFourBitAddressing = false;
+
+// Interrupt flags
+uint32 InterruptFlags = 0;
+
+// From newcpu.cpp
+extern bool quit_program;
+
+// CPU tick counter, same quantum as main_esp32.cpp
+int32 emulated_ticks = 40000;
+static int32 emulated_ticks_quantum = 40000;
+
+// Instructions executed in completed quanta
+static uint64 total_instructions = 0;
+
+// Periodic task timing (same intervals as main_esp32.cpp)
+#define VIDEO_SIGNAL_INTERVAL 42
+static uint32 last_60hz_time = 0;
+static uint32 last_second_time = 0;
+static uint32 last_video_signal = 0;
+
+// Run limits
+static uint64 limit_instructions = 0;	// 0 = unlimited
+static uint64 limit_usec = 0;			// 0 = unlimited
+static bool run_finished = false;
+
+// Benchmarks run without interrupts or video refreshes
+static bool periodic_tasks = true;
+
+// Sampling profiler (--sample-profile)
+static const char *sample_profile_path = NULL;
+static const char *pair_profile_path = NULL;
+static uint32 sample_interval = 0;
+
+/*
+ *  Total emulated instructions, including the current partial quantum
+ */
+uint64 HostEmulatedInstructions(void)
+{
+    return total_instructions + (emulated_ticks_quantum - emulated_ticks);
+}
+
+/*
+ *  Start the sampling profiler if it was asked for, once the CPU is set up
+ */
+void HostStartProfiler(void)
+{
+#if USE_PROFILER
+    if (sample_profile_path)
+        profiler_start(sample_interval);
+#endif
+}
+
+/*
+ *  Interrupt flags
+ */
+void SetInterruptFlag(uint32 flag)
+{
+    __atomic_or_fetch(&InterruptFlags, flag, __ATOMIC_SEQ_CST);
+}
+
+void ClearInterruptFlag(uint32 flag)
+{
+    __atomic_and_fetch(&InterruptFlags, ~flag, __ATOMIC_SEQ_CST);
+}
+
+/*
+ *  Mutexes (single-threaded)
+ */
+B2_mutex *B2_create_mutex(void)
+{
+    return new B2_mutex;
+}
+
+void B2_lock_mutex(B2_mutex *mutex)
+{
+    UNUSED(mutex);
+}
+
+void B2_unlock_mutex(B2_mutex *mutex)
+{
+    UNUSED(mutex);
+}
+
+void B2_delete_mutex(B2_mutex *mutex)
+{
+    delete mutex;
+}
+
+/*
+ *  Flush code cache (drops predecoded blocks, see blockcache.h, and the
+ *  PC translation, see memory.h). Callers have just written Mac RAM
+ *  through a host pointer, so the low memory mirror is refreshed too.
+ */
+void FlushCodeCache(void *start, uint32 size)
+{
+#if USE_PC_CACHE
+    pc_xlate_flush();
+#endif
+    low_mem_mirror_sync(start, size);
+#if USE_BLOCK_CACHE
+    block_cache_invalidate_host(start, size);
+#else
+    UNUSED(start);
+    UNUSED(size);
+#endif
+}
+
+/*
+ *  Alerts
+ */
+void ErrorAlert(const char *text)
+{
+    fprintf(stderr, "[ERROR] %s\n", text);
+}
+
+void WarningAlert(const char *text)
+{
+    Serial.printf("[WARNING] %s\n", text);
+}
+
+bool ChoiceAlert(const char *text, const char *pos, const char *neg)
+{
+    Serial.printf("[CHOICE] %s (%s/%s)\n", text, pos, neg);
+    return true;
+}
+
+/*
+ *  Quit emulator (Mac shut down or fatal EMUL_OP)
+ */
+void QuitEmulator(void)
+{
+    Serial.println("[MAIN] QuitEmulator called");
+    run_finished = true;
+}
+
+/*
+ *  Stop the CPU loop. Execute68k() clears quit_program when a nested
+ *  m68k_execute() returns, so this is re-armed from every tick check
+ *  until the outermost loop has exited.
+ */
+static void stop_cpu(void)
+{
+    quit_program = true;
+    SPCFLAGS_SET( SPCFLAG_BRK );
+}
+
+/*
+ *  Periodic tasks (host equivalent of basilisk_loop())
+ */
+static void host_loop(void)
+{
+    uint32 current_time = millis();
+
+    if (current_time - last_60hz_time >= 16) {
+        last_60hz_time = current_time;
+        SetInterruptFlag(INTFLAG_60HZ);
+        SetInterruptFlag(INTFLAG_ADB);
+        TriggerInterrupt();
+    }
+
+    if (current_time - last_second_time >= 1000) {
+        last_second_time = current_time;
+        SetInterruptFlag(INTFLAG_1HZ);
+        TriggerInterrupt();
+    }
+
+    if (current_time - last_video_signal >= VIDEO_SIGNAL_INTERVAL) {
+        last_video_signal = current_time;
+        VideoRefresh();
+    }
+}
+
+/*
+ *  CPU tick check - called every emulated_ticks_quantum instructions
+ */
+void cpu_do_check_ticks(void)
+{
+    total_instructions += emulated_ticks_quantum - emulated_ticks;
+    emulated_ticks = emulated_ticks_quantum;
+
+    if (limit_instructions && total_instructions >= limit_instructions)
+        run_finished = true;
+    if (limit_usec && HostClockMicros() >= limit_usec)
+        run_finished = true;
+
+    if (run_finished) {
+        stop_cpu();
+        return;
+    }
+
+    if (periodic_tasks)
+        host_loop();
+}
+
+/*
+ *  Load ROM file
+ */
+static bool LoadROM(const char *rom_path)
+{
+    FILE *f = fopen(rom_path, "rb");
+    if (!f) {
+        fprintf(stderr, "Cannot open ROM file %s\n", rom_path);
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long rom_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if (rom_size < (long)ROM_MIN_SIZE || rom_size > (long)ROM_MAX_SIZE) {
+        fprintf(stderr, "Invalid ROM size %ld (expected %u-%u bytes)\n", rom_size, ROM_MIN_SIZE, ROM_MAX_SIZE);
+        fclose(f);
+        return false;
+    }
+
+    // Round up to nearest 64KB
+    ROMSize = (rom_size + 0xFFFF) & ~0xFFFF;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    if (!ROMBaseHost) {
+        fclose(f);
+        return false;
+    }
+
+    size_t bytes_read = fread(ROMBaseHost, 1, rom_size, f);
+    fclose(f);
+    if (bytes_read != (size_t)rom_size) {
+        fprintf(stderr, "ROM read failed (got %zu, expected %ld)\n", bytes_read, rom_size);
+        return false;
+    }
+    return true;
+}
+
+/*
+ *  Allocate Mac RAM
+ */
+static bool AllocateRAM(void)
+{
+    RAMSize = PrefsFindInt32("ramsize");
+    if (RAMSize < 1024 * 1024) {
+        RAMSize = 8 * 1024 * 1024;
+    }
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize);
+    return RAMBaseHost != NULL;
+}
+
+/*
+ *  Write the opcode profile and the sampling profiler report, if asked for
+ */
+static bool write_profiles(const char *path)
+{
+#if USE_PROFILER
+    if (sample_profile_path && !profiler_write_file(sample_profile_path, 1000))
+        return false;
+#endif
+#if OPCODE_PROFILE
+    if (path) {
+        FILE *f = fopen(path, "w");
+        if (!f) {
+            fprintf(stderr, "Cannot write opcode profile %s\n", path);
+            return false;
+        }
+        m68k_dump_opcode_profile(f);
+        fclose(f);
+    }
+#if USE_FUSION
+    if (pair_profile_path) {
+        FILE *f = fopen(pair_profile_path, "w");
+        if (!f) {
+            fprintf(stderr, "Cannot write pair profile %s\n", pair_profile_path);
+            return false;
+        }
+        m68k_dump_pair_profile(f);
+        fclose(f);
+    }
+#endif
+#else
+    UNUSED(path);
+#endif
+    return true;
+}
+
+static void usage(const char *prg)
+{
+    fprintf(stderr,
+            "Usage: %s --rom FILE [--disk FILE]... [--ram MB]\n"
+            "          [--instructions N] [--seconds S] [--virtual-clock IPS]\n"
+            "          [--opcode-profile FILE] [--pair-profile FILE]\n"
+            "          [--sample-profile FILE [--sample-interval N]] [--no-low-mem-mirror] [--quiet]\n"
+            "          [--render] [--frame-hashes FILE] [--dump-frames DIR [--dump-every N] [--dump-raw]]\n"
+            "       %s --bench cpu|flags|noflags|dispatch|fusion|memory|branch|lowmem|dirty|unpack|render|tear [--iterations N]\n"
+            "          [--opcode-profile FILE] [--pair-profile FILE]\n"
+            "          [--sample-profile FILE [--sample-interval N]]\n",
+            prg, prg);
+}
+
+int main(int argc, char **argv)
+{
+    const char *rom_path = NULL;
+    vector<const char *> disks;
+    int ram_mb = 8;
+    double seconds = 0;
+    uint64 virtual_ips = 0;
+    const char *bench = NULL;
+    const char *profile_path = NULL;
+    uint64 iterations = 1000000;
+    bool no_low_mem_mirror = false;
+    bool render = false;
+    const char *frame_hashes_path = NULL;
+    const char *dump_dir = NULL;
+    uint32 dump_every = 60;
+    bool dump_raw = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        bool has_value = i + 1 < argc;
+        if (!strcmp(opt, "--rom") && has_value)
+            rom_path = argv[++i];
+        else if (!strcmp(opt, "--disk") && has_value)
+            disks.push_back(argv[++i]);
+        else if (!strcmp(opt, "--ram") && has_value)
+            ram_mb = atoi(argv[++i]);
+        else if (!strcmp(opt, "--instructions") && has_value)
+            limit_instructions = strtoull(argv[++i], NULL, 0);
+        else if (!strcmp(opt, "--seconds") && has_value)
+            seconds = atof(argv[++i]);
+        else if (!strcmp(opt, "--virtual-clock") && has_value)
+            virtual_ips = strtoull(argv[++i], NULL, 0);
+        else if (!strcmp(opt, "--bench") && has_value)
+            bench = argv[++i];
+        else if (!strcmp(opt, "--iterations") && has_value)
+            iterations = strtoull(argv[++i], NULL, 0);
+        else if (!strcmp(opt, "--opcode-profile") && has_value)
+            profile_path = argv[++i];
+        else if (!strcmp(opt, "--pair-profile") && has_value)
+            pair_profile_path = argv[++i];
+        else if (!strcmp(opt, "--sample-profile") && has_value)
+            sample_profile_path = argv[++i];
+        else if (!strcmp(opt, "--sample-interval") && has_value)
+            sample_interval = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(opt, "--no-low-mem-mirror"))
+            no_low_mem_mirror = true;
+        else if (!strcmp(opt, "--render"))
+            render = true;
+        else if (!strcmp(opt, "--frame-hashes") && has_value)
+            frame_hashes_path = argv[++i];
+        else if (!strcmp(opt, "--dump-frames") && has_value)
+            dump_dir = argv[++i];
+        else if (!strcmp(opt, "--dump-every") && has_value)
+            dump_every = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(opt, "--dump-raw"))
+            dump_raw = true;
+        else if (!strcmp(opt, "--quiet"))
+            Serial.quiet = true;
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+#if !OPCODE_PROFILE
+    if (profile_path) {
+        fprintf(stderr, "--opcode-profile needs a build with -DBASILISK_OPCODE_PROFILE=ON\n");
+        return 2;
+    }
+#endif
+#if !OPCODE_PROFILE || !USE_FUSION
+    if (pair_profile_path) {
+        fprintf(stderr, "--pair-profile needs a build with -DBASILISK_OPCODE_PROFILE=ON and USE_FUSION\n");
+        return 2;
+    }
+#endif
+#if !USE_LOW_MEM_MIRROR
+    if (no_low_mem_mirror) {
+        fprintf(stderr, "--no-low-mem-mirror needs a build with USE_LOW_MEM_MIRROR\n");
+        return 2;
+    }
+#endif
+#if !USE_PROFILER
+    if (sample_profile_path) {
+        fprintf(stderr, "--sample-profile needs a build with USE_PROFILER\n");
+        return 2;
+    }
+#endif
+
+    if (bench) {
+        periodic_tasks = false;
+        int result;
+        if (!strcmp(bench, "cpu"))
+            result = HostBenchCPU(iterations);
+        else if (!strcmp(bench, "flags"))
+            result = HostBenchFlags(iterations);
+        else if (!strcmp(bench, "noflags"))
+            result = HostBenchNoFlags(iterations);
+        else if (!strcmp(bench, "dispatch"))
+            result = HostBenchDispatch(iterations);
+        else if (!strcmp(bench, "fusion"))
+            result = HostBenchFusion(iterations);
+        else if (!strcmp(bench, "memory"))
+            result = HostBenchMemory(iterations);
+        else if (!strcmp(bench, "branch"))
+            result = HostBenchBranch(iterations);
+        else if (!strcmp(bench, "lowmem"))
+            result = HostBenchLowMem(iterations);
+        else if (!strcmp(bench, "dirty"))
+            result = HostBenchDirty(iterations);
+        else if (!strcmp(bench, "unpack"))
+            result = HostBenchUnpack(iterations);
+        else if (!strcmp(bench, "render"))
+            result = HostBenchRender(iterations);
+        else if (!strcmp(bench, "tear"))
+            result = HostBenchTear(iterations);
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+        return write_profiles(profile_path) ? result : 1;
+    }
+
+    if (!rom_path) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (!limit_instructions && seconds <= 0)
+        seconds = 10;
+    limit_usec = (uint64)(seconds * 1000000.0);
+
+    HostClockSetVirtual(virtual_ips);
+
+    // Preferences: device defaults, then command line overrides
+    int prefs_argc = 0;
+    char *prefs_argv_data[] = { NULL };
+    char **prefs_argv = prefs_argv_data;
+    PrefsInit(NULL, prefs_argc, prefs_argv);
+    PrefsReplaceString("rom", rom_path);
+    PrefsReplaceInt32("ramsize", ram_mb * 1024 * 1024);
+    while (PrefsFindString("disk"))
+        PrefsRemoveItem("disk");
+    for (size_t i = 0; i < disks.size(); i++)
+        PrefsAddString("disk", disks[i]);
+
+    // Frames to memory instead of only counting them
+    if ((render || frame_hashes_path || dump_dir) &&
+        !HostVideoEnableSink(frame_hashes_path, dump_dir, dump_every, dump_raw))
+        return 1;
+
+    SysInit();
+
+    if (!AllocateRAM()) {
+        ErrorAlert("Failed to allocate Mac RAM");
+        return 1;
+    }
+    if (!LoadROM(rom_path)) {
+        ErrorAlert("Failed to load ROM file");
+        return 1;
+    }
+#if USE_LOW_MEM_MIRROR
+    low_mem_mirror_enabled = !no_low_mem_mirror;
+#endif
+    if (!InitAll(NULL)) {
+        ErrorAlert("InitAll() failed");
+        return 1;
+    }
+    InputInit();
+    HostStartProfiler();
+
+    // Run
+    uint64 wall_start = HostWallMicros();
+    Start680x0();
+    uint64 wall_us = HostWallMicros() - wall_start;
+
+    uint64 instructions = HostEmulatedInstructions();
+    double wall_s = wall_us / 1000000.0;
+    double mips = wall_us ? instructions / (double)wall_us : 0.0;
+
+    printf("instructions=%llu\n", (unsigned long long)instructions);
+    printf("emulated_seconds=%.3f\n", HostClockMicros() / 1000000.0);
+    printf("wall_seconds=%.3f\n", wall_s);
+    printf("mips=%.2f\n", mips);
+    printf("frames=%u\n", HostVideoFramesRendered());
+    printf("fb_checksum=0x%08x\n", HostVideoChecksum());
+    HostVideoFinish();
+
+    if (!write_profiles(profile_path))
+        return 1;
+
+    InputExit();
+    ExitAll();
+    SysExit();
+    PrefsExit();
+    return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ *  prefs_host.cpp - Preferences handling for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Mirrors the hardcoded ESP32 configuration (prefs_esp32.cpp) so the host
+ *  runs the same machine; main_host.cpp then overrides ROM, disk and RAM
+ *  size from the command line.
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Platform-specific preferences items
+prefs_desc platform_prefs_items[] = {
+    {NULL, TYPE_END, false, NULL}  // End marker
+};
+
+/*
+ *  Load preferences (same defaults as the device)
+ */
+void LoadPrefs(const char *vmdir)
+{
+    UNUSED(vmdir);
+
+    PrefsReplaceString("rom", "Q650.ROM");
+    PrefsReplaceInt32("modelid", 14);
+    PrefsReplaceInt32("cpu", 4);
+    PrefsReplaceBool("fpu", false);
+    PrefsReplaceInt32("ramsize", 8 * 1024 * 1024);
+    PrefsReplaceString("screen", "win/640/480");
+    PrefsReplaceBool("nosound", true);
+    PrefsReplaceBool("nocdrom", true);
+    PrefsReplaceBool("nogui", true);
+    PrefsReplaceInt32("bootdrive", 0);
+    PrefsReplaceInt32("bootdriver", 0);
+    PrefsReplaceInt32("frameskip", 4);
+}
+
+/*
+ *  Save preferences (no-op)
+ */
+void SavePrefs(void)
+{
+}
+
+/*
+ *  Add default preferences items
+ */
+void AddPlatformPrefsDefaults(void)
+{
+    // Defaults are set in LoadPrefs
+}
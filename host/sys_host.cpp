@@ -0,0 +1,231 @@
+/*
+ *  sys_host.cpp - System dependent routines for the host build (POSIX I/O)
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Disk images are mapped copy-on-write (MAP_PRIVATE): the emulated Mac can
+ *  write to them as usual, but nothing reaches the image file. Every run
+ *  therefore starts from an identical disk, which keeps benchmark numbers
+ *  and framebuffer checksums reproducible.
+ */
+
+#include "sysdeps.h"
+#include "main.h"
+#include "macos_util.h"
+#include "prefs.h"
+#include "sys.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define DEBUG 0
+#include "debug.h"
+
+// File handle structure (glibc already has a struct file_handle)
+struct disk_file {
+    uint8 *data;        // Private mapping of the whole image
+    bool is_open;
+    bool read_only;
+    bool is_floppy;
+    bool is_cdrom;
+    loff_t size;
+    char path[256];
+};
+
+/*
+ *  Initialization
+ */
+void SysInit(void)
+{
+}
+
+/*
+ *  Deinitialization
+ */
+void SysExit(void)
+{
+}
+
+/*
+ *  Periodic flush (nothing is ever written back)
+ */
+void Sys_periodic_flush(void)
+{
+}
+
+void SysAddFloppyPrefs(void)
+{
+}
+
+void SysAddDiskPrefs(void)
+{
+}
+
+void SysAddCDROMPrefs(void)
+{
+}
+
+void SysAddSerialPrefs(void)
+{
+}
+
+/*
+ *  Open a file/device
+ */
+void *Sys_open(const char *name, bool read_only, bool is_cdrom)
+{
+    if (!name || strlen(name) == 0) {
+        return NULL;
+    }
+
+    int fd = open(name, O_RDONLY);
+    if (fd < 0) {
+        Serial.printf("[SYS] Cannot open %s\n", name);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        Serial.printf("[SYS] Cannot map %s\n", name);
+        return NULL;
+    }
+
+    disk_file *fh = new disk_file;
+    memset(fh, 0, sizeof(disk_file));
+    strncpy(fh->path, name, sizeof(fh->path) - 1);
+    fh->data = (uint8 *)data;
+    fh->size = st.st_size;
+    fh->is_cdrom = is_cdrom;
+    fh->is_floppy = (strstr(name, ".img") != NULL || strstr(name, ".IMG") != NULL);
+    fh->read_only = read_only || is_cdrom || strstr(name, ".iso") != NULL || strstr(name, ".ISO") != NULL;
+    fh->is_open = true;
+
+    Serial.printf("[SYS] Opened %s (%lld KB, ro=%d, copy-on-write)\n",
+                  name, (long long)(fh->size / 1024), fh->read_only);
+
+    return fh;
+}
+
+/*
+ *  Close a file/device
+ */
+void Sys_close(void *arg)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh) return;
+
+    if (fh->is_open) {
+        munmap(fh->data, fh->size);
+        fh->is_open = false;
+    }
+
+    delete fh;
+}
+
+/*
+ *  Read from a file/device
+ */
+size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh || !fh->is_open || !buffer || offset < 0 || offset >= fh->size) {
+        return 0;
+    }
+
+    if (length > (size_t)(fh->size - offset)) {
+        length = fh->size - offset;
+    }
+    memcpy(buffer, fh->data + offset, length);
+    return length;
+}
+
+/*
+ *  Write to a file/device (lands in the private mapping only)
+ */
+size_t Sys_write(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh || !fh->is_open || !buffer || fh->read_only || offset < 0 || offset >= fh->size) {
+        return 0;
+    }
+
+    if (length > (size_t)(fh->size - offset)) {
+        length = fh->size - offset;
+    }
+    memcpy(fh->data + offset, buffer, length);
+    return length;
+}
+
+/*
+ *  Return size of file/device
+ */
+loff_t SysGetFileSize(void *arg)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh || !fh->is_open) {
+        return 0;
+    }
+    return fh->size;
+}
+
+void SysEject(void *arg)
+{
+    UNUSED(arg);
+}
+
+bool SysFormat(void *arg)
+{
+    UNUSED(arg);
+    return false;
+}
+
+bool SysIsReadOnly(void *arg)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh) return true;
+    return fh->read_only;
+}
+
+bool SysIsFixedDisk(void *arg)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh) return true;
+    return !fh->is_floppy && !fh->is_cdrom;
+}
+
+bool SysIsDiskInserted(void *arg)
+{
+    disk_file *fh = (disk_file *)arg;
+    if (!fh) return false;
+    return fh->is_open;
+}
+
+void SysPreventRemoval(void *arg) { UNUSED(arg); }
+void SysAllowRemoval(void *arg) { UNUSED(arg); }
+
+// CD-ROM stubs
+bool SysCDReadTOC(void *arg, uint8 *toc) { UNUSED(arg); UNUSED(toc); return false; }
+bool SysCDGetPosition(void *arg, uint8 *pos) { UNUSED(arg); UNUSED(pos); return false; }
+bool SysCDPlay(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, uint8 end_m, uint8 end_s, uint8 end_f) {
+    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f);
+    UNUSED(end_m); UNUSED(end_s); UNUSED(end_f); return false;
+}
+bool SysCDPause(void *arg) { UNUSED(arg); return false; }
+bool SysCDResume(void *arg) { UNUSED(arg); return false; }
+bool SysCDStop(void *arg, uint8 lead_out_m, uint8 lead_out_s, uint8 lead_out_f) {
+    UNUSED(arg); UNUSED(lead_out_m); UNUSED(lead_out_s); UNUSED(lead_out_f); return false;
+}
+bool SysCDScan(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, bool reverse) {
+    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f); UNUSED(reverse); return false;
+}
+void SysCDSetVolume(void *arg, uint8 left, uint8 right) { UNUSED(arg); UNUSED(left); UNUSED(right); }
+void SysCDGetVolume(void *arg, uint8 &left, uint8 &right) { UNUSED(arg); left = right = 0; }
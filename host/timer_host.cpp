@@ -0,0 +1,43 @@
+/*
+ *  timer_host.cpp - Time Manager support for the host build
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#include "sysdeps.h"
+#include "timer.h"
+#include "host.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+/*
+ *  Return microseconds since start (wall or virtual clock)
+ */
+uint64 GetTicks_usec(void)
+{
+    return HostClockMicros();
+}
+
+/*
+ *  Delay for specified number of microseconds
+ */
+void Delay_usec(uint64 usec)
+{
+    HostClockSleep(usec);
+}
+
+/*
+ *  Suspend emulator thread, wait for wakeup
+ *  (Single-threaded, as on the ESP32)
+ */
+void idle_wait(void)
+{
+}
+
+/*
+ *  Resume execution of emulator thread
+ */
+void idle_resume(void)
+{
+}
@@ -0,0 +1,578 @@
+/*
+ *  video_host.cpp - Headless video stand-in for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Registers the same 1/2/4/8/16-bit modes at 640x360 and 1280x720 as
+ *  video_esp32.cpp does with enough PSRAM, so the Mac sees an identical
+ *  display. By default nothing is drawn: VideoRefresh() only counts frames
+ *  that had framebuffer or palette damage, and the runner can take a
+ *  checksum of the framebuffer at the end of a run. Framebuffer damage
+ *  comes from the same write-time tile tracking (video_dirty.cpp) the
+ *  device uses.
+ *
+ *  With HostVideoEnableSink() (--render), frames go to a 1280x720 display
+ *  in memory instead of the panel, through the device's tile pass
+ *  (VideoDirtyRenderTiles(): hash-skip unchanged tiles, re-queue torn
+ *  ones), rendered with the video_render.cpp kernels and default
+ *  palettes. Each frame gets a hash of the display pixels, which can be
+ *  logged and dumped as PNG or raw swap565, and the render counters of the
+ *  device's [VIDEO PERF] lines are reported at the end of the run.
+ *
+ *  Palette conversion (VideoSetPalette()) and palette usage tracking
+ *  (VideoDirtyRecolorTiles()) are the device's code as well. Device paths
+ *  with no counterpart here: the USE_HW_CURSOR overlay (video_cursor.cpp),
+ *  the DMA strips of pushTileRun() and their dma counters, the streaming
+ *  full-frame renderer, frame pacing and the spinlock around the palette.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "video.h"
+#include "video_defs.h"
+#include "video_dirty.h"
+#include "video_render.h"
+#include "host.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Display configuration - must match video_esp32.cpp
+#define MAC_SCREEN_WIDTH  640
+#define MAC_SCREEN_HEIGHT 360
+#define DISPLAY_WIDTH     1280
+#define DISPLAY_HEIGHT    720
+
+// Frame buffer for Mac emulation
+static uint8 *mac_frame_buffer = NULL;
+static uint32 frame_buffer_size = 0;
+
+// Current mode and palette (RGB888, as handed over by the video driver)
+static video_depth current_depth = VDEPTH_8BIT;
+static uint32 current_bytes_per_row = MAC_SCREEN_WIDTH;
+static uint32 current_width = MAC_SCREEN_WIDTH;
+static uint32 current_height = MAC_SCREEN_HEIGHT;
+static uint8 palette_rgb888[256 * 3];
+
+// Mode damage since the last VideoRefresh() (and palette damage without
+// USE_PALETTE_USAGE); framebuffer damage is in the dirty tile bitmap
+static bool frame_damaged = true;
+#if USE_PALETTE_USAGE
+// Palette indices whose color changed since the last VideoRefresh(), and
+// the tiles using them
+static bool palette_changed = false;
+static uint32 palette_changed_indices[PALETTE_WORDS];
+static uint32 recolor_tiles[TILE_WORDS];
+#endif
+static uint32 dirty_tiles[TILE_WORDS];
+static uint32 frames_rendered = 0;
+
+// Framebuffer sink (HostVideoEnableSink()): the panel's pixels in swap565,
+// the tile pass state (frame buffer hashes as last drawn, torn tiles) and
+// per tile the display hash
+static bool sink_enabled = false;
+static uint16 *display = NULL;
+static uint16 palette_rgb565[256];
+static uint32 doubled_palette[256];
+static video_tile_state tile_state;
+static uint32 display_tile_hash[TOTAL_TILES];
+static uint32 frame_hash = 0;
+static FILE *frame_hash_file = NULL;
+static const char *dump_dir = NULL;
+static uint32 dump_every = 0;
+static bool dump_raw = false;
+
+// Counters, as in the device's [VIDEO PERF] lines
+static uint32 perf_full_count = 0;
+static uint32 perf_partial_count = 0;
+static uint32 perf_skip_count = 0;
+static uint32 perf_tile_count = 0;          // Tiles drawn
+static uint32 perf_identical_count = 0;     // Dirty tiles skipped as unchanged
+static uint32 perf_torn_count = 0;
+static uint32 perf_recolor_count = 0;       // Tiles redrawn for palette changes
+static uint32 perf_recolor_saved = 0;       // Tiles a palette change did not need to redraw
+static uint64 perf_detect_us = 0;
+static uint64 perf_render_us = 0;
+
+// Monitor descriptor for the host
+class Host_monitor_desc : public monitor_desc {
+public:
+    Host_monitor_desc(const vector<video_mode> &available_modes, video_depth default_depth, uint32 default_id)
+        : monitor_desc(available_modes, default_depth, default_id) {}
+
+    virtual void switch_to_current_mode(void);
+    virtual void set_palette(uint8 *pal, int num);
+    virtual void set_gamma(uint8 *gamma, int num);
+};
+
+static Host_monitor_desc *the_monitor = NULL;
+
+void Host_monitor_desc::set_palette(uint8 *pal, int num)
+{
+    if (num > 256) num = 256;
+    memcpy(palette_rgb888, pal, num * 3);
+#if USE_PALETTE_USAGE
+    VideoSetPalette(pal, num, palette_rgb565, palette_changed_indices);
+    palette_changed = true;
+#else
+    VideoSetPalette(pal, num, palette_rgb565, NULL);
+    frame_damaged = true;
+#endif
+    VideoDoublePalette(palette_rgb565, doubled_palette, num);
+}
+
+void Host_monitor_desc::set_gamma(uint8 *gamma, int num)
+{
+    UNUSED(gamma);
+    UNUSED(num);
+}
+
+void Host_monitor_desc::switch_to_current_mode(void)
+{
+    const video_mode &mode = get_current_mode();
+    current_depth = mode.depth;
+    current_bytes_per_row = mode.bytes_per_row;
+    current_width = mode.x;
+    current_height = mode.y;
+    VideoDefaultPalette(current_depth, palette_rgb565);
+    VideoDoublePalette(palette_rgb565, doubled_palette, 256);
+    int layout = current_depth == VDEPTH_16BIT ? FLAYOUT_BE_565 : FLAYOUT_DIRECT;
+    if (layout != MacFrameLayout) {
+        MacFrameLayout = layout;
+        map_frame_banks();
+    }
+    VideoDirtySetMode(mode.x, mode.y, current_depth, current_bytes_per_row, frame_buffer_size);
+    set_mac_frame_base(MacFrameBaseMac);
+    frame_damaged = true;
+}
+
+/*
+ *  Initialize video driver
+ */
+bool VideoInit(bool classic)
+{
+    UNUSED(classic);
+
+    frame_buffer_size = TrivialBytesPerRow(DISPLAY_WIDTH, VDEPTH_16BIT) * DISPLAY_HEIGHT;
+    mac_frame_buffer = (uint8 *)malloc(frame_buffer_size);
+    if (!mac_frame_buffer) {
+        return false;
+    }
+    memset(mac_frame_buffer, 0x80, frame_buffer_size);
+
+    MacFrameBaseHost = mac_frame_buffer;
+    MacFrameSize = frame_buffer_size;
+    MacFrameLayout = FLAYOUT_DIRECT;
+
+    // 640x360 (scaled 2x on the device) and 1280x720 (1:1)
+    vector<video_mode> modes;
+    video_mode mode;
+    mode.user_data = 0;
+    for (int r = 0; r < 2; r++) {
+        mode.x = r ? DISPLAY_WIDTH : MAC_SCREEN_WIDTH;
+        mode.y = r ? DISPLAY_HEIGHT : MAC_SCREEN_HEIGHT;
+        mode.resolution_id = 0x80 + r;
+        for (int d = VDEPTH_1BIT; d <= VDEPTH_16BIT; d++) {
+            mode.depth = (video_depth)d;
+            mode.bytes_per_row = TrivialBytesPerRow(mode.x, mode.depth);
+            modes.push_back(mode);
+        }
+    }
+
+    current_depth = VDEPTH_8BIT;
+    current_width = MAC_SCREEN_WIDTH;
+    current_height = MAC_SCREEN_HEIGHT;
+    current_bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_8BIT);
+    VideoDefaultPalette(current_depth, palette_rgb565);
+    VideoDoublePalette(palette_rgb565, doubled_palette, 256);
+    if (sink_enabled) {
+        display = (uint16 *)calloc(DISPLAY_WIDTH * DISPLAY_HEIGHT, sizeof(uint16));
+        if (!display) {
+            return false;
+        }
+    }
+    VideoDirtySetMode(MAC_SCREEN_WIDTH, MAC_SCREEN_HEIGHT, current_depth, current_bytes_per_row, frame_buffer_size);
+    frames_rendered = 0;
+    frame_damaged = true;
+
+    the_monitor = new Host_monitor_desc(modes, VDEPTH_8BIT, 0x80);
+    VideoMonitors.push_back(the_monitor);
+    the_monitor->set_mac_frame_base(MacFrameBaseMac);
+
+    return true;
+}
+
+/*
+ *  Deinitialize video driver
+ */
+void VideoExit(void)
+{
+    VideoMonitors.clear();
+    delete the_monitor;
+    the_monitor = NULL;
+
+    free(mac_frame_buffer);
+    mac_frame_buffer = NULL;
+    free(display);
+    display = NULL;
+}
+
+/*
+ *  PNG of the display: 8-bit RGB, stored (uncompressed) deflate blocks, so
+ *  no zlib is needed
+ */
+static uint32 png_crc_table[256];
+
+static uint32 pngCRC(uint32 crc, const uint8 *data, size_t len)
+{
+    if (!png_crc_table[1]) {
+        for (uint32 n = 0; n < 256; n++) {
+            uint32 c = n;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            }
+            png_crc_table[n] = c;
+        }
+    }
+    for (size_t i = 0; i < len; i++) {
+        crc = png_crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void pngPut32(vector<uint8> &out, uint32 v)
+{
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static void pngChunk(FILE *f, const char *type, const vector<uint8> &data)
+{
+    vector<uint8> chunk;
+    pngPut32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    uint32 crc = pngCRC(0xffffffff, &chunk[4], chunk.size() - 4) ^ 0xffffffff;
+    pngPut32(chunk, crc);
+    fwrite(&chunk[0], 1, chunk.size(), f);
+}
+
+static bool writePNG(const char *path, const uint16 *pixels, int width, int height)
+{
+    // Filter byte 0 and RGB per row, from swap565 (see VideoRGB565())
+    vector<uint8> raw;
+    raw.reserve((size_t)(width * 3 + 1) * height);
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        for (int x = 0; x < width; x++) {
+            uint16 v = pixels[y * width + x];
+            uint8 r5 = (v & 0xff) >> 3;
+            uint8 g6 = ((v & 7) << 3) | (v >> 13);
+            uint8 b5 = (v >> 8) & 0x1f;
+            raw.push_back(r5 << 3 | r5 >> 2);
+            raw.push_back(g6 << 2 | g6 >> 4);
+            raw.push_back(b5 << 3 | b5 >> 2);
+        }
+    }
+
+    // zlib stream of stored blocks
+    vector<uint8> z;
+    z.push_back(0x78);
+    z.push_back(0x01);
+    uint32 a = 1, b = 0;
+    for (size_t pos = 0; pos < raw.size();) {
+        size_t len = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+        z.push_back(pos + len == raw.size());
+        z.push_back(len);
+        z.push_back(len >> 8);
+        z.push_back(~len);
+        z.push_back(~len >> 8);
+        for (size_t i = 0; i < len; i++) {
+            a = (a + raw[pos + i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    }
+    pngPut32(z, b << 16 | a);
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return false;
+    }
+    static const uint8 signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    fwrite(signature, 1, sizeof(signature), f);
+    vector<uint8> header;
+    pngPut32(header, width);
+    pngPut32(header, height);
+    header.push_back(8);        // Bit depth
+    header.push_back(2);        // RGB
+    header.push_back(0);
+    header.push_back(0);
+    header.push_back(0);
+    pngChunk(f, "IHDR", header);
+    pngChunk(f, "IDAT", z);
+    pngChunk(f, "IEND", vector<uint8>());
+    return fclose(f) == 0;
+}
+
+/*
+ *  Write the display to dump_dir as name.png, or name.raw (swap565 pixels
+ *  as the panel receives them, row by row)
+ */
+static void dumpDisplay(const char *name)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s.%s", dump_dir, name, dump_raw ? "raw" : "png");
+    bool ok;
+    if (dump_raw) {
+        FILE *f = fopen(path, "wb");
+        ok = f && fwrite(display, sizeof(uint16), DISPLAY_WIDTH * DISPLAY_HEIGHT, f) == DISPLAY_WIDTH * DISPLAY_HEIGHT;
+        ok = f && fclose(f) == 0 && ok;
+    } else {
+        ok = writePNG(path, display, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+    if (!ok) {
+        fprintf(stderr, "Cannot write frame dump %s\n", path);
+    }
+}
+
+/*
+ *  Draw a run of dirty tiles into the display (video_tile_pass::push_run),
+ *  where the device's pushTileRun() sends it to the panel, and hash each
+ *  tile's display pixels for the frame hash
+ */
+static void pushTileRun(void *ctx, int first_tx, int count, int ty)
+{
+    UNUSED(ctx);
+    video_depth depth = current_depth;
+    uint32 bpr = current_bytes_per_row;
+    int scale = DISPLAY_WIDTH / current_width;
+    int tile_width = current_width / TILES_X, tile_height = current_height / TILES_Y;
+    int span_width = count * tile_width;
+    const uint8 *src = mac_frame_buffer + ty * tile_height * bpr + ((first_tx * tile_width << depth) >> 3);
+    uint16 *out = display + ty * tile_height * scale * DISPLAY_WIDTH + first_tx * tile_width * scale;
+    uint16 *dst = out;
+    for (int row = 0; row < tile_height; row++) {
+        if (scale == 1) {
+            VideoRenderRow1x(src + row * bpr, dst, span_width, depth, doubled_palette);
+            dst += DISPLAY_WIDTH;
+        } else {
+            VideoRenderRow2x(src + row * bpr, dst, span_width, depth, doubled_palette);
+            VideoRepeatRow(dst, dst + DISPLAY_WIDTH, span_width * 2);
+            dst += DISPLAY_WIDTH * 2;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        display_tile_hash[ty * TILES_X + first_tx + i] =
+            VideoHashTile((const uint8 *)(out + i * tile_width * scale), DISPLAY_WIDTH * sizeof(uint16),
+                          tile_width * scale * sizeof(uint16), tile_height * scale);
+    }
+}
+
+/*
+ *  Draw the dirty tiles into the display through the device's tile pass
+ *  (VideoDirtyRenderTiles()), and return how many were drawn
+ */
+static int renderDirtyTiles(bool redraw_all)
+{
+    video_tile_pass pass;
+    memset(&pass, 0, sizeof(pass));
+    pass.src = mac_frame_buffer;
+    pass.bytes_per_row = current_bytes_per_row;
+    pass.depth = current_depth;
+    pass.tile_width = current_width / TILES_X;
+    pass.tile_height = current_height / TILES_Y;
+    pass.push_run = pushTileRun;
+
+    const uint32 *recolor = NULL;
+#if USE_PALETTE_USAGE
+    recolor = recolor_tiles;
+#endif
+    int drawn = VideoDirtyRenderTiles(&pass, &tile_state, dirty_tiles, recolor, redraw_all);
+    perf_tile_count += drawn;
+    perf_identical_count += pass.identical;
+    perf_torn_count += pass.torn;
+    return drawn;
+}
+
+/*
+ *  Frame tick - count frames that would have been pushed to the panel, and
+ *  with the sink, push them to the display in memory
+ */
+void VideoSignalFrameReady(void)
+{
+    uint64 t0 = HostWallMicros();
+    bool tiles_damaged = VideoDirtyCollect(dirty_tiles) > 0;
+    if (sink_enabled) {
+        for (int i = 0; i < TILE_WORDS; i++) {
+            tiles_damaged |= tile_state.torn[i] != 0;
+            dirty_tiles[i] |= tile_state.torn[i];
+        }
+    }
+#if USE_PALETTE_USAGE
+    // Palette change: only the tiles that use a changed index, as the
+    // device's markRecolorTiles() (without the sink, count the frame)
+    if (palette_changed) {
+        palette_changed = false;
+        if (sink_enabled) {
+            int count = VideoDirtyRecolorTiles(&tile_state, palette_changed_indices, recolor_tiles);
+            perf_recolor_count += count;
+            perf_recolor_saved += TOTAL_TILES - count;
+            for (int i = 0; i < TILE_WORDS; i++) {
+                dirty_tiles[i] |= recolor_tiles[i];
+            }
+            tiles_damaged |= count > 0;
+        } else {
+            tiles_damaged = true;
+        }
+        memset(palette_changed_indices, 0, sizeof(palette_changed_indices));
+    }
+#endif
+    if (!frame_damaged && !tiles_damaged) {
+        perf_skip_count++;
+        return;
+    }
+    bool redraw_all = frame_damaged;
+    frame_damaged = false;
+    frames_rendered++;
+    if (!sink_enabled) {
+        return;
+    }
+
+    // Palette or mode change: every tile, as force_full_update does
+    if (redraw_all) {
+        memset(dirty_tiles, 0xff, sizeof(dirty_tiles));
+        perf_full_count++;
+    } else {
+        perf_partial_count++;
+    }
+    uint64 t1 = HostWallMicros();
+    int drawn = renderDirtyTiles(redraw_all);
+#if USE_PALETTE_USAGE
+    memset(recolor_tiles, 0, sizeof(recolor_tiles));
+#endif
+    uint64 t2 = HostWallMicros();
+    perf_detect_us += t1 - t0;
+    perf_render_us += t2 - t1;
+
+    // Frame hash: FNV-1a over the display hashes of all tiles
+    uint32 hash = 2166136261u;
+    for (int i = 0; i < TOTAL_TILES; i++) {
+        hash = (hash ^ display_tile_hash[i]) * 16777619u;
+    }
+    frame_hash = hash;
+    if (frame_hash_file) {
+        fprintf(frame_hash_file, "frame=%u instructions=%llu tiles=%d hash=0x%08x\n", frames_rendered,
+                (unsigned long long)HostEmulatedInstructions(), drawn, hash);
+    }
+    if (dump_dir && frames_rendered % dump_every == 0) {
+        char name[32];
+        snprintf(name, sizeof(name), "frame_%06u", frames_rendered);
+        dumpDisplay(name);
+    }
+}
+
+void VideoRefresh(void)
+{
+    if (!mac_frame_buffer) {
+        return;
+    }
+    VideoSignalFrameReady();
+}
+
+void VideoQuitFullScreen(void)
+{
+}
+
+void VideoInterrupt(void)
+{
+    SetInterruptFlag(INTFLAG_ADB);
+}
+
+uint8 *VideoGetFrameBuffer(void)
+{
+    return mac_frame_buffer;
+}
+
+uint32 VideoGetFrameBufferSize(void)
+{
+    return frame_buffer_size;
+}
+
+/*
+ *  Framebuffer sink, before VideoInit()
+ */
+bool HostVideoEnableSink(const char *frame_hashes_path, const char *dump_path, uint32 every, bool raw)
+{
+    sink_enabled = true;
+    dump_dir = dump_path;
+    dump_every = every ? every : 1;
+    dump_raw = raw;
+    if (frame_hashes_path) {
+        frame_hash_file = fopen(frame_hashes_path, "w");
+        if (!frame_hash_file) {
+            fprintf(stderr, "Cannot write frame hashes %s\n", frame_hashes_path);
+            return false;
+        }
+    }
+    return true;
+}
+
+void HostVideoFinish(void)
+{
+    if (!sink_enabled) {
+        return;
+    }
+    if (frame_hash_file) {
+        fclose(frame_hash_file);
+        frame_hash_file = NULL;
+    }
+    if (dump_dir && display) {
+        dumpDisplay("final");
+    }
+    uint32 frames = perf_full_count + perf_partial_count;
+    printf("video_full=%u\n", perf_full_count);
+    printf("video_partial=%u\n", perf_partial_count);
+    printf("video_skip=%u\n", perf_skip_count);
+    printf("video_tiles=%u\n", perf_tile_count);
+    printf("video_identical=%u\n", perf_identical_count);
+    printf("video_torn=%u\n", perf_torn_count);
+#if USE_PALETTE_USAGE
+    printf("video_recolor=%u\n", perf_recolor_count);
+    printf("video_recolor_saved=%u\n", perf_recolor_saved);
+#endif
+    printf("video_detect_us=%.1f\n", frames ? (double)perf_detect_us / frames : 0.0);
+    printf("video_render_us=%.1f\n", frames ? (double)perf_render_us / frames : 0.0);
+    printf("display_hash=0x%08x\n", frame_hash);
+}
+
+/*
+ *  Runner statistics
+ */
+uint32 HostVideoFramesRendered(void)
+{
+    return frames_rendered;
+}
+
+uint32 HostVideoChecksum(void)
+{
+    // FNV-1a over the visible part of the framebuffer, then the palette
+    uint32 hash = 2166136261u;
+    if (mac_frame_buffer) {
+        uint32 visible = current_bytes_per_row * current_height;
+        if (visible > frame_buffer_size) visible = frame_buffer_size;
+        for (uint32 i = 0; i < visible; i++) {
+            hash = (hash ^ mac_frame_buffer[i]) * 16777619u;
+        }
+    }
+    int colors = current_depth == VDEPTH_16BIT ? 0 : 1 << (1 << current_depth);
+    for (int i = 0; i < colors * 3; i++) {
+        hash = (hash ^ palette_rgb888[i]) * 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,42 @@
+/*
+ *  xpram_host.cpp - XPRAM handling for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  XPRAM is never persisted on the host: every benchmark run starts from
+ *  the Basilisk II defaults so results do not depend on earlier runs.
+ */
+
+#include "sysdeps.h"
+#include "xpram.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+/*
+ *  Load XPRAM (start from zeroes, InitAll() fills in the defaults)
+ */
+void LoadXPRAM(const char *vmdir)
+{
+    UNUSED(vmdir);
+    if (XPRAM != NULL) {
+        memset(XPRAM, 0, XPRAM_SIZE);
+    }
+}
+
+/*
+ *  Save XPRAM (no-op)
+ */
+void SaveXPRAM(void)
+{
+}
+
+/*
+ *  Clear XPRAM
+ */
+void ZapPRAM(void)
+{
+    if (XPRAM != NULL) {
+        memset(XPRAM, 0, XPRAM_SIZE);
+    }
+}
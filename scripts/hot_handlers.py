@@ -0,0 +1,216 @@
+"""
+Pre-build script: place the most frequently executed 68k opcode handlers in IRAM.
+
+Reads an opcode profile (tools/cpu_gen/opcode_profile.txt, written by
+`basilisk_host --opcode-profile`), maps each profiled handler to its name in
+generated/cpustbl.cpp and writes generated/cpuhot.h, which cpuemu.cpp and
+cpuemu_nf.cpp include to tag the top handlers IRAM_ATTR. Everything else
+stays in flash. Without a profile the header is empty.
+
+Profile format: "# table N" names the op_smalltbl_N used for the profiled
+CPU level, then one "<opcode hex> <count>" line per handler, where the
+opcode is the one the handler is listed under in cpustbl.cpp.
+
+Handlers are taken hottest first until their code would exceed
+custom_hot_iram_bytes (platformio.ini). A handler costs the size of its
+normal and, unless it is CPUFUNC_FF, its flag-free variant. Sizes come from
+the firmware of the previous build when there is one, else from an estimate
+of HANDLER_BYTES_PER_LINE per line of cpuemu.cpp. After linking, the sizes
+of the handlers that were placed are checked against the same budget, and
+the build fails if they exceed it.
+
+Also runs standalone: python3 scripts/hot_handlers.py [bytes [firmware.elf]]
+"""
+import os
+import re
+import subprocess
+import sys
+
+try:
+    Import("env")
+except NameError:
+    env = None
+
+DEFAULT_HOT_IRAM_BYTES = 32768
+
+# Code per line of a handler in cpuemu.cpp, for handlers not in a previous
+# firmware (generous: the post-link check has the final word)
+HANDLER_BYTES_PER_LINE = 16
+
+if env is not None:
+    project_dir = env.subst("$PROJECT_DIR")
+    iram_budget = int(env.GetProjectOption("custom_hot_iram_bytes", str(DEFAULT_HOT_IRAM_BYTES)))
+    firmware_path = env.subst("$BUILD_DIR/${PROGNAME}.elf")
+    nm_tool = env.subst("$CC").replace("gcc", "nm")
+else:
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    iram_budget = int(sys.argv[1]) if len(sys.argv) > 1 else DEFAULT_HOT_IRAM_BYTES
+    firmware_path = sys.argv[2] if len(sys.argv) > 2 else ""
+    nm_tool = "riscv32-esp-elf-nm"
+
+profile_path = os.path.join(project_dir, "tools", "cpu_gen", "opcode_profile.txt")
+generated_dir = os.path.join(project_dir, "src", "basilisk", "uae_cpu", "generated")
+stbl_path = os.path.join(generated_dir, "cpustbl.cpp")
+emu_path = os.path.join(generated_dir, "cpuemu.cpp")
+header_path = os.path.join(generated_dir, "cpuhot.h")
+
+
+def read_profile(path):
+    """Returns (table index, [(opcode, count)] sorted by count)."""
+    table = 0
+    counts = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            m = re.match(r"#\s*table\s+(\d+)", line)
+            if m:
+                table = int(m.group(1))
+                continue
+            if not line or line.startswith("#"):
+                continue
+            opcode, count = line.split()[:2]
+            counts.append((int(opcode, 16), int(count)))
+    counts.sort(key=lambda c: -c[1])
+    return table, counts
+
+
+def read_handler_names(path, table):
+    """Maps opcode to CPUFUNC(handler) for one op_smalltbl_N in cpustbl.cpp."""
+    names = {}
+    inside = False
+    start = "struct cputbl CPUFUNC(op_smalltbl_%d)[]" % table
+    # CPUFUNC_FF marks handlers that have no flag-free twin
+    entry = re.compile(r"\{ (CPUFUNC(?:_FF)?\(op_[0-9a-f]+_\d\)), \d+, (\d+) \}")
+    with open(path) as f:
+        for line in f:
+            if not inside:
+                inside = start in line
+                continue
+            m = entry.match(line)
+            if not m:
+                break
+            names.setdefault(int(m.group(2)), m.group(1))
+    return names
+
+
+def variants(name):
+    """Linked symbols of CPUFUNC(op_x) or CPUFUNC_FF(op_x)."""
+    base = name[name.index("(") + 1:-1]
+    if name.startswith("CPUFUNC_FF"):
+        return [base + "_ff"]
+    return [base + "_ff", base + "_nf"]
+
+
+def read_firmware_sizes(path):
+    """Maps handler symbol to its code size in a linked firmware ({} if none)."""
+    if not path or not os.path.isfile(path):
+        return {}
+    try:
+        out = subprocess.run([nm_tool, "--print-size", "--defined-only", "-C", path],
+                             capture_output=True, text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError):
+        return {}
+    sizes = {}
+    symbol = re.compile(r"^[0-9a-f]+ ([0-9a-f]+) [tTwW] (op_[0-9a-f]+_\d_[fn]f)\b")
+    for line in out.splitlines():
+        m = symbol.match(line)
+        if m:
+            sizes[m.group(2)] = int(m.group(1), 16)
+    return sizes
+
+
+def estimate_sizes(path):
+    """Maps CPUFUNC(handler) to an estimated size per variant from cpuemu.cpp."""
+    sizes = {}
+    start = re.compile(r"^void REGPARAM2 (CPUFUNC(?:_FF)?\(op_[0-9a-f]+_\d\))\(")
+    name, lines = None, 0
+    with open(path) as f:
+        for line in f:
+            m = start.match(line)
+            if m:
+                name, lines = m.group(1), 0
+            elif name is not None:
+                lines += 1
+                if line.startswith("}"):
+                    sizes[name] = lines * HANDLER_BYTES_PER_LINE
+                    name = None
+    return sizes
+
+
+def handler_bytes(name, measured, estimated):
+    return sum(measured.get(sym, estimated.get(name, 0)) for sym in variants(name))
+
+
+def build_header():
+    lines = [
+        "/* Generated by scripts/hot_handlers.py from tools/cpu_gen/opcode_profile.txt, do not edit */",
+        "#include <esp_attr.h>",
+        "",
+    ]
+    if not os.path.isfile(profile_path):
+        lines.append("/* No opcode profile, all handlers stay in flash */")
+        return "\n".join(lines) + "\n", 0, 0, 0
+
+    table, counts = read_profile(profile_path)
+    names = read_handler_names(stbl_path, table)
+    measured = read_firmware_sizes(firmware_path)
+    estimated = estimate_sizes(emu_path)
+    total = sum(c for _, c in counts) or 1
+    hot, used = [], 0
+    for op, count in counts:
+        if op not in names or count == 0:
+            continue
+        size = handler_bytes(names[op], measured, estimated)
+        if used + size > iram_budget:
+            break
+        hot.append(names[op])
+        used += size
+    covered = sum(c for op, c in counts if op in names and names[op] in hot)
+
+    lines.append("/* %d handlers, about %d of %d bytes, %.1f%% of profiled instructions */"
+                 % (len(hot), used, iram_budget, 100.0 * covered / total))
+    for name in hot:
+        # Declared for both cpuemu.cpp (_ff) and cpuemu_nf.cpp (_nf)
+        lines.append("extern void REGPARAM2 %s(uae_u32) IRAM_ATTR;" % name)
+    return "\n".join(lines) + "\n", len(hot), used, 100.0 * covered / total
+
+
+def read_header_names(path):
+    names = []
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"extern void REGPARAM2 (CPUFUNC(?:_FF)?\(op_[0-9a-f]+_\d\))", line)
+            if m:
+                names.append(m.group(1))
+    return names
+
+
+def check_iram(target, source, env):
+    """Post-link: the placed handlers must fit the budget."""
+    sizes = read_firmware_sizes(str(target[0]))
+    names = read_header_names(header_path)
+    if not sizes or not names:
+        return 0
+    used = sum(sizes.get(sym, 0) for name in names for sym in variants(name))
+    print("Hot opcode handlers in IRAM: %d bytes of %d" % (used, iram_budget))
+    if used > iram_budget:
+        print("Error: hot opcode handlers take %d bytes of IRAM, custom_hot_iram_bytes is %d; "
+              "rebuild to place them by their linked sizes, or raise the budget" % (used, iram_budget))
+        return 1
+    return 0
+
+
+header, hot, used, coverage = build_header()
+old = None
+if os.path.isfile(header_path):
+    with open(header_path) as f:
+        old = f.read()
+# Only touch the header when the placement changes, cpuemu.cpp is slow to build
+if header != old:
+    with open(header_path, "w") as f:
+        f.write(header)
+print("Hot opcode handlers in IRAM: %d, about %d of %d bytes (%.1f%% of profiled instructions)"
+      % (hot, used, iram_budget, coverage))
+
+if env is not None:
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", check_iram)
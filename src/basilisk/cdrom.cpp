@@ -605,6 +605,7 @@ int16 CDROMPrime(uint32 pb, uint32 dce)
 		
 		// Read
 		actual = Sys_read(info->fh, buffer, position + info->start_byte, length);
+		FlushCodeCache(buffer, actual);	// May replace code the CPU has cached
 		if (actual != length) {
 			
 			// Read error, tried to read HFS root block?
@@ -355,6 +355,7 @@ int16 DiskPrime(uint32 pb, uint32 dce)
 		actual = Sys_read(info->fh, buffer, position + info->start_byte, length);
 		if (actual != length)
 			return readErr;
+		FlushCodeCache(buffer, actual);	// May replace code the CPU has cached
 
 	} else {
 
@@ -41,6 +41,9 @@
 #include "ether.h"
 #include "extfs.h"
 #include "emul_op.h"
+#if USE_HW_CURSOR
+#include "video_cursor.h"
+#endif
 
 #ifdef ENABLE_MON
 #include "mon.h"
@@ -596,6 +599,37 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 			break;
 		}
 
+#if USE_HW_CURSOR
+		// Cursor vectors (see video_cursor.h), arguments on the stack above the return address
+		case M68K_EMUL_OP_CURSOR_HIDE:
+			CursorHide();
+			break;
+
+		case M68K_EMUL_OP_CURSOR_SHOW:
+			CursorShow();
+			break;
+
+		case M68K_EMUL_OP_CURSOR_SHIELD:
+			CursorShield();
+			break;
+
+		case M68K_EMUL_OP_CURSOR_SET:
+			CursorSet(ReadMacInt32(r->a[7] + 4));
+			break;
+
+		case M68K_EMUL_OP_CURSOR_SET_COLOR:
+			CursorSetColor(ReadMacInt32(r->a[7] + 4));
+			break;
+
+		case M68K_EMUL_OP_CURSOR_OBSCURE:
+			CursorObscure();
+			break;
+
+		case M68K_EMUL_OP_CURSOR_TASK:
+			CursorTask();
+			break;
+#endif
+
 		default:
 			printf("FATAL: EMUL_OP called with bogus opcode %08x\n", opcode);
 			printf("d0 %08x d1 %08x d2 %08x d3 %08x\n"
@@ -91,6 +91,13 @@ enum {
 	M68K_EMUL_OP_DEBUGUTIL,
 	M68K_EMUL_OP_IDLE_TIME,
 	M68K_EMUL_OP_SUSPEND,
+	M68K_EMUL_OP_CURSOR_HIDE,		// Cursor overlay (USE_HW_CURSOR)
+	M68K_EMUL_OP_CURSOR_SHOW,
+	M68K_EMUL_OP_CURSOR_SHIELD,
+	M68K_EMUL_OP_CURSOR_SET,
+	M68K_EMUL_OP_CURSOR_SET_COLOR,
+	M68K_EMUL_OP_CURSOR_OBSCURE,
+	M68K_EMUL_OP_CURSOR_TASK,
 	M68K_EMUL_OP_MAX				// highest number
 };
 
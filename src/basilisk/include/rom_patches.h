@@ -44,6 +44,9 @@ extern uint32 PutScrapPatch;
 // Mac address of GetScrap() patch
 extern uint32 GetScrapPatch;
 
+// Mac address of cursor vector routines (USE_HW_CURSOR)
+extern uint32 CursorPatch;
+
 // Flag: print ROM information in PatchROM()
 extern bool PrintROMInfo;
 
@@ -0,0 +1,69 @@
+/*
+ *  video_cursor.h - Mouse cursor drawn as a display overlay
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Normally QuickDraw draws the cursor into the frame buffer: every mouse
+ *  move restores the pixels under the old cursor and draws the new one,
+ *  dirtying 2-4 tiles that then go through hashing, render and DMA.
+ *
+ *  With USE_HW_CURSOR, PatchAfterStartup() points the low memory cursor
+ *  vectors (JHideCursor, JShowCursor, JShieldCursor, JSetCrsr,
+ *  JCrsrObscure, JSetCCrsr, JCrsrTask) at EMUL_OP routines that only keep
+ *  track of the cursor image, position and visibility here. The cursor
+ *  never reaches the frame buffer; the display driver composites it into
+ *  the pixels it pushes, and a move costs one small DMA around the old and
+ *  new positions.
+ *
+ *  Like a hardware cursor, it needs no shielding: ShieldCursor() keeps the
+ *  hide level balanced but does not hide it. Color cursors are shown with
+ *  their black-and-white data and mask.
+ */
+
+#ifndef VIDEO_CURSOR_H
+#define VIDEO_CURSOR_H
+
+#if USE_HW_CURSOR
+
+// Cursor size in Mac pixels
+#define CURSOR_SIZE 16
+
+// Cursor as the display should show it
+struct video_cursor {
+    uint16 data[CURSOR_SIZE];   // One row per word, MSB = leftmost pixel
+    uint16 mask[CURSOR_SIZE];
+    int x, y;                   // Top left in Mac screen coordinates (Mouse - hotSpot)
+    bool visible;
+    uint32 seq;                 // Even, changes whenever the fields above do
+};
+
+// Take the cursor out of the frame buffer and adopt QuickDraw's cursor
+// state (called by PatchAfterStartup() right before it sets the vectors)
+extern void CursorInstall(void);
+
+// EMUL_OP handlers
+extern void CursorHide(void);
+extern void CursorShow(void);
+extern void CursorShield(void);
+extern void CursorSet(uint32 crsr);
+extern void CursorSetColor(uint32 ccrsr_handle);
+extern void CursorObscure(void);
+extern void CursorTask(void);
+
+// True once the patches are active
+extern bool CursorInstalled(void);
+
+// Consistent copy of the current cursor (any thread)
+extern void VideoCursorRead(video_cursor *c);
+
+/*
+ *  Draw the cursor into RGB565 pixels scaled by scale (1 or 2). buf holds
+ *  the display rectangle at (buf_x, buf_y), width x height pixels, stride
+ *  pixels per row; only the part of the cursor inside it is drawn.
+ */
+extern void VideoCursorComposite(const video_cursor *c, int scale, uint16 *buf, int stride,
+                                 int buf_x, int buf_y, int width, int height);
+
+#endif
+
+#endif
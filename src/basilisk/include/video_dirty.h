@@ -0,0 +1,145 @@
+/*
+ *  video_dirty.h - Write-time dirty tile tracking for the frame buffer
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The screen is divided into a fixed grid of TILES_X x TILES_Y tiles of
+ *  80x80 display pixels, so a tile holds 40x40 Mac pixels in the 2x scaled
+ *  modes and 80x80 at 1280x720. frame_direct_lput/wput/bput (memory.cpp)
+ *  call VideoMarkDirtyRange()
+ *  and VideoMarkDirtyOffset() on every frame buffer store, which set the
+ *  tile's bit in a bitmap; the video driver collects and clears the bitmap
+ *  once per frame.
+ *
+ *  Marking runs for every pixel the Mac draws, so it does no division:
+ *  VideoDirtySetMode() precomputes, per mode, a reciprocal for the frame
+ *  buffer row, the first tile of every row and the tile column of every byte
+ *  in a row. A byte store then costs one multiply, two table loads and at
+ *  most one atomic OR (none if the tile is already dirty).
+ *
+ *  With USE_DIRTY_PAGES a store only sets the bit of its frame buffer page
+ *  (a shift and at most one atomic OR), and VideoDirtyCollect() maps the
+ *  dirty pages to tiles once per frame on the video task's core. A page is
+ *  the largest power of two bytes that fits in the width of a tile at the
+ *  current depth (64 bytes at 16-bit, 32 at 8-bit, 4 at 1-bit), so it
+ *  touches at most two tiles of a row: a few more tiles get redrawn in
+ *  exchange for moving all tile math off the emulation core.
+ *
+ *  The marks double as per-tile generation counters for the video task,
+ *  which renders tiles straight from the frame buffer: it collects the
+ *  bitmap, converts a tile, then asks VideoDirtyTileWritten() whether a
+ *  store was marked in the meantime (the tile's generation moved, as with
+ *  a seqlock) and only then redraws it in the next frame. For this a store
+ *  is marked both before and after it lands (see VideoDirtyTileWritten()
+ *  in video_dirty.cpp); the second mark usually finds the bit already set.
+ */
+
+#ifndef VIDEO_DIRTY_H
+#define VIDEO_DIRTY_H
+
+// Tile grid: 16 columns x 9 rows of 80x80 display pixels. TILE_WIDTH x
+// TILE_HEIGHT is the tile in Mac pixels at 640x360 (2x scaling); a mode of
+// width x height uses tiles of width / TILES_X x height / TILES_Y.
+#define TILE_WIDTH        40
+#define TILE_HEIGHT       40
+#define TILES_X           16
+#define TILES_Y           9
+#define TOTAL_TILES       (TILES_X * TILES_Y)  // 144 tiles
+#define TILE_WORDS        ((TOTAL_TILES + 31) / 32)
+
+// Largest frame buffer geometry the lookup tables are sized for (1280x720)
+#define DIRTY_MAX_WIDTH          (TILES_X * TILE_WIDTH * 2)
+#define DIRTY_MAX_HEIGHT         (TILES_Y * TILE_HEIGHT * 2)
+#define DIRTY_MAX_BYTES_PER_ROW  (DIRTY_MAX_WIDTH * 2)    // 16-bit
+
+// A packed byte holds at most 8 pixels and must never straddle two tiles
+// (mode widths must be multiples of TILES_X * 8 as well)
+#if TILE_WIDTH % 8
+#error "TILE_WIDTH must be a multiple of 8"
+#endif
+
+#if USE_DIRTY_PAGES
+// Pages are more than half a tile wide, so at most two per tile and row
+#define DIRTY_PAGE_WORDS  ((TILES_X * 2 * DIRTY_MAX_HEIGHT + 31) / 32)
+
+#ifdef ARDUINO
+// Always page marking on the device, so stores test no switch
+#define dirty_pages_enabled true
+#else
+// Page marking on (default) or per-store tile marking (--bench dirty)
+extern bool dirty_pages_enabled;
+#endif
+#endif
+
+// Rebuild the lookup tables for a new mode and clear the bitmap (call
+// before the CPU can write with the new geometry)
+extern void VideoDirtySetMode(uint32 width, uint32 height, video_depth depth, uint32 bytes_per_row, uint32 frame_size);
+
+// Atomically move the tiles marked since the last call into bitmap
+// (TILE_WORDS words) and clear them; returns the number of dirty tiles
+extern int VideoDirtyCollect(uint32 *bitmap);
+
+// True if a store to the tile was marked since the last VideoDirtyCollect()
+// (video task only, as it is the one collecting)
+extern bool VideoDirtyTileWritten(int tile);
+
+#if USE_PALETTE_USAGE
+// Bitmap words of a 256-entry palette
+#define PALETTE_WORDS (256 / 32)
+#endif
+
+/*
+ *  Per-frame pass over the dirty tiles, shared by the panel driver, the
+ *  host's headless display and --bench tear, so all three run the same
+ *  hash skip, palette usage tracking and generation check. Only pushing
+ *  pixels is caller-side.
+ */
+struct video_tile_state {
+    uint32 hash[TOTAL_TILES];       // Frame buffer hash of each tile as last pushed (USE_TILE_HASH)
+    uint32 torn[TILE_WORDS];        // Tiles torn in the last pass, to redraw in the next
+#if USE_PALETTE_USAGE
+    // Palette indices each tile used when it was last pushed (4.6KB)
+    uint32 palette_usage[TOTAL_TILES][PALETTE_WORDS];
+#endif
+};
+
+struct video_tile_pass {
+    // Frame buffer and mode
+    const uint8 *src;
+    uint32 bytes_per_row;
+    video_depth depth;
+    int tile_width, tile_height;    // Mac pixels
+
+    // Convert and push count adjacent tiles of tile row ty, straight from src
+    void (*push_run)(void *ctx, int first_tx, int count, int ty);
+    // Runs between push_run and the generation check of the run; NULL
+    // except in --bench tear, which lands racing stores there
+    void (*after_push)(void *ctx, int first_tx, int count, int ty);
+    void *ctx;
+    bool unchecked;                 // Skip the generation check (--bench tear only)
+
+    // Counters, added to by VideoDirtyRenderTiles()
+    uint32 identical;               // Dirty tiles skipped, hash unchanged
+    uint32 pushed;                  // Tiles pushed
+    uint32 torn;                    // Tiles re-queued into state->torn
+};
+
+// Push the tiles in dirty (TILE_WORDS words; callers include state->torn).
+// A tile whose hash is unchanged is skipped unless redraw_all is set, it
+// was torn or it is in recolor (may be NULL). Returns the tiles pushed.
+extern int VideoDirtyRenderTiles(video_tile_pass *pass, video_tile_state *state, const uint32 *dirty,
+                                 const uint32 *recolor, bool redraw_all);
+
+#if USE_PALETTE_USAGE
+// Add the tiles that use any index in changed (PALETTE_WORDS words) to
+// recolor, so a palette change only redraws those; returns how many use one
+extern int VideoDirtyRecolorTiles(const video_tile_state *state, const uint32 *changed, uint32 *recolor);
+#endif
+
+// Mark every tile dirty
+extern void VideoDirtyMarkAll(void);
+
+// Clear the bitmap
+extern void VideoDirtyReset(void);
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ *  video_render.h - Palette conversion and 2x scaling kernels
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Every Mac pixel becomes a 2x2 block of RGB565 display pixels. The
+ *  kernels look pixels up in a "doubled" palette whose entries hold the
+ *  color in both 16-bit halves, so one 32-bit store writes both display
+ *  pixels of a row. The second display row is then a copy of the first
+ *  (VideoRepeatRow()), instead of a second set of stores per pixel.
+ *
+ *  VideoRenderRow2x() reads 8-bit indices or packed 1/2/4-bit pixels
+ *  directly, so rows need no separate unpack pass. 16-bit rows are stored
+ *  in display format and only doubled.
+ *
+ *  The 1280x720 modes are shown 1:1 by VideoRenderRow1x(), which takes the
+ *  same doubled palette and stores one half of each entry.
+ *
+ *  The palette conversion, default palettes and tile content hash live here
+ *  too, so the host's headless display (host/video_host.cpp) draws and
+ *  skips tiles exactly as the panel driver does.
+ *
+ *  The scalar kernels are the reference. With USE_PIE_SIMD on the ESP32-P4,
+ *  VideoRepeatRow() moves 16 bytes per instruction through the PIE vector
+ *  registers; PIE has no gather load, so the palette lookup stays scalar.
+ */
+
+#ifndef VIDEO_RENDER_H
+#define VIDEO_RENDER_H
+
+/*
+ *  RGB888 to the display's pixel format, M5GFX swap565 (RGB565 byte-swapped,
+ *  i.e. big-endian in memory):
+ *  - Low byte:  RRRRRGGG (R5 in bits 7-3, G high 3 bits in bits 2-0)
+ *  - High byte: GGGBBBBB (G low 3 bits in bits 7-5, B5 in bits 4-0)
+ */
+static inline uint16 VideoRGB565(uint8 r, uint8 g, uint8 b)
+{
+    return ((r >> 3) << 3 | (g >> 5)) | (((g >> 2) << 5 | (b >> 3)) << 8);
+}
+
+/*
+ *  Palette a depth starts with until Mac OS sets its own, in display format
+ *  (fills 2, 4, 16 or 256 entries; nothing at 16-bit)
+ */
+extern void VideoDefaultPalette(video_depth depth, uint16 *palette);
+
+/*
+ *  32-bit content hash of a tile: rows row_bytes long, stride bytes apart,
+ *  at any alignment
+ */
+extern uint32 VideoHashTile(const uint8 *src, uint32 stride, int row_bytes, int rows);
+
+/*
+ *  Convert num RGB888 entries (as the Mac's set_palette() hands them over)
+ *  into palette, in display format. The indices whose color changed are
+ *  added to changed (256 bits), unless it is NULL.
+ */
+extern void VideoSetPalette(const uint8 *pal, int num, uint16 *palette, uint32 *changed);
+
+// Doubled palette entry for an RGB565 color
+static inline uint32 VideoDoublePixel(uint16 color)
+{
+    return (uint32)color | ((uint32)color << 16);
+}
+
+// Fill doubled[0..count-1] from an RGB565 palette
+extern void VideoDoublePalette(const uint16 *palette, uint32 *doubled, int count);
+
+/*
+ *  Render width Mac pixels of a row at depth (starting on a byte boundary)
+ *  as 2 * width display pixels. dst must be 4-byte aligned. At 16-bit the
+ *  row already holds display pixels (2-byte aligned) and doubled is unused.
+ */
+extern void VideoRenderRow2x(const uint8 *src, uint16 *dst, int width, video_depth depth, const uint32 *doubled);
+
+/*
+ *  Render width Mac pixels of a row at depth (starting on a byte boundary)
+ *  as width display pixels. dst must be 2-byte aligned; at 16-bit the row
+ *  is copied as it is.
+ */
+extern void VideoRenderRow1x(const uint8 *src, uint16 *dst, int width, video_depth depth, const uint32 *doubled);
+
+/*
+ *  Copy a rendered display row of pixels to the row below it. With
+ *  USE_PIE_SIMD, rows must be 16-byte aligned and a multiple of 8 pixels
+ *  (true for tile spans and full rows).
+ */
+extern void VideoRepeatRow(const uint16 *src, uint16 *dst, int pixels);
+
+#endif
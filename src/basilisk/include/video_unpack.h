@@ -0,0 +1,45 @@
+/*
+ *  video_unpack.h - Packed pixel (1/2/4-bit) to palette index unpacking
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  In packed modes a frame buffer byte holds several pixels, MSB first:
+ *  8 at 1-bit, 4 at 2-bit, 2 at 4-bit. VideoUnpackRow() expands a row
+ *  with one lookup per source byte into tables built by VideoUnpackInit()
+ *  (a byte maps straight to its 8, 4 or 2 palette indices), instead of a
+ *  shift and mask per pixel.
+ *
+ *  The device renders packed rows without an unpack pass (the render
+ *  kernels in video_render.cpp read the packed bytes directly) and only
+ *  uses VideoPackedPixel(). VideoUnpackRow() and its tables are built on
+ *  the host only, as the reference decode of --bench unpack and --bench
+ *  render.
+ */
+
+#ifndef VIDEO_UNPACK_H
+#define VIDEO_UNPACK_H
+
+#ifndef ARDUINO
+// Build the lookup tables (once, before the first VideoUnpackRow())
+extern void VideoUnpackInit(void);
+
+/*
+ *  Expand width pixels starting at the first pixel of src into one 8-bit
+ *  palette index per pixel. dst must be 4-byte aligned; depths above 8-bit
+ *  are not handled.
+ */
+extern void VideoUnpackRow(const uint8 *src, uint8 *dst, int width, video_depth depth);
+#endif
+
+/*
+ *  Palette index of pixel x in a frame buffer row (any depth up to 8-bit,
+ *  shifts only)
+ */
+static inline uint8 VideoPackedPixel(const uint8 *row, int x, video_depth depth)
+{
+    int bits = 1 << depth;                  // 1, 2, 4, 8
+    int bit = x << depth;                   // Bit offset of the pixel in the row
+    return (row[bit >> 3] >> (8 - bits - (bit & 7))) & ((1 << bits) - 1);
+}
+
+#endif
@@ -32,6 +32,10 @@
 #include "macos_util.h"
 #include "user_strings.h"
 #include "input.h"
+#include "m68k.h"
+#include "newcpu.h"
+#include "blockcache.h"
+#include "profiler.h"
 
 #define DEBUG 1
 #include "debug.h"
@@ -154,8 +158,9 @@ static uint32 last_video_signal = 0;
 static uint32 last_disk_flush_time = 0;
 
 // Video signal interval (ms) - how often to signal video task
-// The video task runs at its own pace, this just triggers buffer swap
-#define VIDEO_SIGNAL_INTERVAL 42  // ~24 FPS
+// The video task paces frames itself (up to 60 FPS for small updates),
+// this only wakes it as often as it could render
+#define VIDEO_SIGNAL_INTERVAL 16  // ~60 FPS
 
 // Disk flush interval (ms) - how often to flush write buffer to SD card
 #define DISK_FLUSH_INTERVAL 2000  // 2 seconds
@@ -249,12 +254,22 @@ void B2_delete_mutex(B2_mutex *mutex)
 }
 
 /*
- *  Flush code cache (no-op for interpreted emulation)
+ *  Flush code cache (drops predecoded blocks, see blockcache.h, and the
+ *  PC translation, see memory.h). Callers have just written Mac RAM
+ *  through a host pointer, so the low memory mirror is refreshed too.
  */
 void FlushCodeCache(void *start, uint32 size)
 {
+#if USE_PC_CACHE
+    pc_xlate_flush();
+#endif
+    low_mem_mirror_sync(start, size);
+#if USE_BLOCK_CACHE
+    block_cache_invalidate_host(start, size);
+#else
     UNUSED(start);
     UNUSED(size);
+#endif
 }
 
 /*
@@ -389,6 +404,50 @@ static bool AllocateRAM(void)
     return true;
 }
 
+#if USE_PROFILER
+/*
+ *  Sampling profiler control from the serial console (uae_cpu/profiler.h):
+ *    p  start/stop sampling      r  print report
+ *    w  write report to SD card  z  clear samples
+ */
+#define PROFILER_REPORT_FILE "/sd/profile.txt"
+#define PROFILER_SERIAL_ROWS 30
+#define PROFILER_FILE_ROWS 1000
+
+static void profilerPrintSerial(const char *line, void *arg)
+{
+    UNUSED(arg);
+    Serial.println(line);
+}
+
+static void pollProfilerCommands(void)
+{
+    while (Serial.available() > 0) {
+        switch (Serial.read()) {
+            case 'p':
+                if (profiler_enabled) {
+                    profiler_stop();
+                    Serial.println("[PROFILE] Stopped");
+                } else if (profiler_start(PROFILER_INTERVAL)) {
+                    Serial.printf("[PROFILE] Sampling 1 in %u instructions\n", profiler_stats.interval);
+                }
+                break;
+            case 'r':
+                profiler_report(profilerPrintSerial, NULL, PROFILER_SERIAL_ROWS);
+                break;
+            case 'w':
+                if (profiler_write_file(PROFILER_REPORT_FILE, PROFILER_FILE_ROWS))
+                    Serial.println("[PROFILE] Wrote " PROFILER_REPORT_FILE);
+                break;
+            case 'z':
+                profiler_reset();
+                Serial.println("[PROFILE] Cleared");
+                break;
+        }
+    }
+}
+#endif
+
 /*
  *  1Hz tick handler
  */
@@ -396,6 +455,9 @@ static void handle_1hz_tick(void)
 {
     SetInterruptFlag(INTFLAG_1HZ);
     TriggerInterrupt();
+#if USE_PROFILER
+    pollProfilerCommands();
+#endif
 }
 
 /*
@@ -47,7 +47,7 @@ void LoadPrefs(const char *vmdir)
     Serial.printf("[PREFS] RAM: %d MB\n", ram_size / (1024 * 1024));
     
     // Set screen configuration
-    PrefsReplaceString("screen", "win/640/480");
+    PrefsReplaceString("screen", "win/640/360");
     
     // Get hard disk path from Boot GUI selection
     const char* disk_path = BootGUI_GetDiskPath();
@@ -38,6 +38,9 @@
 #endif
 
 #include "rom_patches.h"
+#if USE_HW_CURSOR
+#include "video_cursor.h"
+#endif
 
 #define DEBUG 0
 #include "debug.h"
@@ -47,6 +50,7 @@
 uint32 UniversalInfo;		// ROM offset of UniversalInfo
 uint32 PutScrapPatch = 0;	// Mac address of PutScrap() patch
 uint32 GetScrapPatch = 0;	// Mac address of GetScrap() patch
+uint32 CursorPatch = 0;		// Mac address of cursor vector routines (USE_HW_CURSOR)
 uint32 ROMBreakpoint = 0;	// ROM offset of breakpoint (0 = disabled, 0x2310 = CritError)
 bool PrintROMInfo = false;	// Flag: print ROM information in PatchROM()
 bool PatchHWBases = true;	// Flag: patch hardware base addresses
@@ -821,6 +825,20 @@ void PatchAfterStartup(void)
 	// Install external file system
 	InstallExtFS();
 #endif
+
+#if USE_HW_CURSOR
+	// Take the cursor out of the frame buffer and redirect the cursor vectors
+	if (CursorPatch) {
+		CursorInstall();
+		WriteMacInt32(0x800, CursorPatch + 0x00);	// JHideCursor
+		WriteMacInt32(0x804, CursorPatch + 0x04);	// JShowCursor
+		WriteMacInt32(0x808, CursorPatch + 0x08);	// JShieldCursor
+		WriteMacInt32(0x818, CursorPatch + 0x0e);	// JSetCrsr
+		WriteMacInt32(0x81c, CursorPatch + 0x14);	// JCrsrObscure
+		WriteMacInt32(0x890, CursorPatch + 0x18);	// JSetCCrsr
+		WriteMacInt32(0x8ee, CursorPatch + 0x1e);	// JCrsrTask
+	}
+#endif
 }
 
 
@@ -1638,6 +1656,29 @@ static bool patch_rom_32(void)
 	*wp++ = htons(base >> 16);
 	*wp = htons(base & 0xffff);
 
+#if USE_HW_CURSOR
+	// Install cursor vector routines (activated by PatchAfterStartup(), see video_cursor.h)
+	CursorPatch = ROMBaseMac + sony_offset + 0xe00;
+	wp = (uint16 *)(ROMBaseHost + sony_offset + 0xe00);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_HIDE);		// +0x00 JHideCursor
+	*wp++ = htons(M68K_RTS);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_SHOW);		// +0x04 JShowCursor
+	*wp++ = htons(M68K_RTS);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_SHIELD);	// +0x08 JShieldCursor
+	*wp++ = htons(M68K_RTD);
+	*wp++ = htons(8);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_SET);		// +0x0e JSetCrsr
+	*wp++ = htons(M68K_RTD);
+	*wp++ = htons(4);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_OBSCURE);	// +0x14 JCrsrObscure
+	*wp++ = htons(M68K_RTS);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_SET_COLOR);	// +0x18 JSetCCrsr
+	*wp++ = htons(M68K_RTD);
+	*wp++ = htons(4);
+	*wp++ = htons(M68K_EMUL_OP_CURSOR_TASK);		// +0x1e JCrsrTask
+	*wp = htons(M68K_RTS);
+#endif
+
 	// Look for double PACK 4 resources
 	if ((base = find_rom_resource(FOURCC('P','A','C','K'), 4)) == 0) return false;
 	if ((base = find_rom_resource(FOURCC('P','A','C','K'), 4, true)) == 0 && FPUType == 0)
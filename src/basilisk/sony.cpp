@@ -380,6 +380,7 @@ int16 SonyPrime(uint32 pb, uint32 dce)
 		actual = Sys_read(info->fh, buffer, position, length);
 		if (actual != length)
 			return set_dsk_err(readErr);
+		FlushCodeCache(buffer, actual);	// May replace code the CPU has cached
 
 		// Clear TagBuf
 		WriteMacInt32(0x2fc, 0);
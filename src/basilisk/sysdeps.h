@@ -60,12 +60,19 @@ using std::vector;
 
 /*
  * Data type sizes for ESP32-P4
+ * The host benchmark build (host/) runs on LP64 Linux, where long and
+ * pointers are 64 bits wide.
  */
 #define SIZEOF_SHORT 2
 #define SIZEOF_INT 4
+#if defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ == 8
+#define SIZEOF_LONG 8
+#define SIZEOF_VOID_P 8
+#else
 #define SIZEOF_LONG 4
-#define SIZEOF_LONG_LONG 8
 #define SIZEOF_VOID_P 4
+#endif
+#define SIZEOF_LONG_LONG 8
 #define SIZEOF_FLOAT 4
 #define SIZEOF_DOUBLE 8
 
@@ -80,11 +87,18 @@ typedef uint32_t uint32;
 typedef int32_t int32;
 typedef uint64_t uint64;
 typedef int64_t int64;
+#if SIZEOF_VOID_P == 8
+typedef uintptr_t uintptr;
+typedef intptr_t intptr;
+#else
 typedef uint32_t uintptr;
 typedef int32_t intptr;
+#endif
 
-// File offset type
+// File offset type (glibc already provides a 64-bit one for the host build)
+#ifndef __GLIBC__
 typedef int32_t loff_t;
+#endif
 
 // Character address type
 typedef char* caddr_t;
@@ -64,40 +64,117 @@ bool UseJIT = false;
 extern bool quit_program;
 
 
+/*
+ *  Internal SRAM budget of the CPU tables: what cpufunctbl alone took
+ *  before the compact dispatch table. Tables read on every instruction or
+ *  memory access share it, first come first served in Init680x0() order
+ *  (sizes on ESP32 with 8MB of Mac RAM):
+ *
+ *    low memory mirror          8KB   system globals
+ *    compact dispatch table   ~46KB   every instruction
+ *    block cache               72KB   every replayed instruction
+ *    block code lines           4KB   every RAM write
+ *
+ *  That is about 130KB; profiler counters (~16KB) come out of what is left
+ *  when it starts. mem_tlb (256KB, every memory access) goes to PSRAM: RAM,
+ *  ROM and the frame buffer use about 150 of its entries, 600 bytes that
+ *  stay in the cache. Without compact dispatch, cpufunctbl takes the whole
+ *  budget and the others go to PSRAM.
+ */
+#define CPU_SRAM_BUDGET		(256 * 1024)
+#define MAX_CPU_TABLES		16
+
+struct cpu_table {
+	const char *name;
+	void *p;
+	size_t size;
+	bool internal;
+};
+static cpu_table cpu_tables[MAX_CPU_TABLES];
+static size_t cpu_sram_used = 0;
+
+void *AllocCPUTable(const char *name, size_t size, int placement)
+{
+	bool internal = placement != TABLE_PSRAM && cpu_sram_used + size <= CPU_SRAM_BUDGET;
+	void *p = NULL;
+#ifdef ARDUINO
+	if (internal)
+		p = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (p == NULL) {
+		internal = false;
+		if (placement != TABLE_SRAM_ONLY)
+			p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+	}
+#else
+	if (internal || placement != TABLE_SRAM_ONLY)
+		p = malloc(size);
+#endif
+	if (p == NULL) {
+		write_log("No %s for %s (%d KB)\n", placement == TABLE_PSRAM ? "PSRAM" : "internal SRAM",
+		          name, (int)((size + 512) / 1024));
+		return NULL;
+	}
+
+	for (int i = 0; i < MAX_CPU_TABLES; i++) {
+		if (cpu_tables[i].p == NULL) {
+			cpu_tables[i].name = name;
+			cpu_tables[i].p = p;
+			cpu_tables[i].size = size;
+			cpu_tables[i].internal = internal;
+			if (internal)
+				cpu_sram_used += size;
+			break;
+		}
+	}
+	write_log("Allocated %s (%d KB) in %s\n", name, (int)((size + 512) / 1024), internal ? "internal SRAM" : "PSRAM");
+	return p;
+}
+
+void FreeCPUTable(void *p)
+{
+	if (p == NULL)
+		return;
+	for (int i = 0; i < MAX_CPU_TABLES; i++) {
+		if (cpu_tables[i].p == p) {
+			if (cpu_tables[i].internal)
+				cpu_sram_used -= cpu_tables[i].size;
+			cpu_tables[i].p = NULL;
+			break;
+		}
+	}
+	free(p);
+}
+
+// Internal SRAM the tables take against the budget, and PSRAM
+static void report_cpu_tables(void)
+{
+	size_t psram = 0;
+	for (int i = 0; i < MAX_CPU_TABLES; i++)
+		if (cpu_tables[i].p != NULL && !cpu_tables[i].internal)
+			psram += cpu_tables[i].size;
+	write_log("CPU tables: %d of %d KB internal SRAM budget, %d KB PSRAM\n",
+	          (int)((cpu_sram_used + 512) / 1024), CPU_SRAM_BUDGET / 1024, (int)((psram + 512) / 1024));
+}
+
+
 /*
  *  Initialize 680x0 emulation, CheckROM() must have been called first
  */
 
 bool Init680x0(void)
 {
-#ifdef ARDUINO
-	// Allocate 256KB opcode table
-	// This table is accessed once per instruction for opcode dispatch
-	// NOTE: mem_banks gets priority for internal SRAM since it's accessed more frequently
-	// (multiple memory operations per instruction)
 	if (cpufunctbl == NULL) {
-		// Report available internal SRAM before allocation
-		size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
-		size_t largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
-		write_log("cpufunctbl allocation: need 256KB, internal SRAM has %d bytes free (largest: %d)\n",
-		          free_before, largest_block);
-		
-		// Try internal SRAM first - cpufunctbl is accessed once per instruction for dispatch
-		// This is the hot path for CPU emulation
-		cpufunctbl = (cpuop_func **)heap_caps_malloc(65536 * sizeof(cpuop_func *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-		if (cpufunctbl != NULL) {
-			write_log("Allocated cpufunctbl (256KB) in internal SRAM - FAST DISPATCH\n");
-		} else {
-			// Fall back to PSRAM if internal SRAM not available
-			cpufunctbl = (cpuop_func **)heap_caps_malloc(65536 * sizeof(cpuop_func *), MALLOC_CAP_SPIRAM);
-			if (cpufunctbl == NULL) {
-				write_log("ERROR: Failed to allocate cpufunctbl!\n");
-				return false;
-			}
-			write_log("Allocated cpufunctbl (256KB) in PSRAM (fallback)\n");
-		}
-	}
+#if USE_COMPACT_DISPATCH
+		// Dispatch goes through the compact table (newcpu.h), which takes the
+		// internal SRAM instead; cpufunctbl is only read off the hot path
+		cpufunctbl = (cpuop_func **)AllocCPUTable("cpufunctbl", 65536 * sizeof(cpuop_func *), TABLE_PSRAM);
+#else
+		// Read once per instruction for dispatch; it takes the whole budget
+		cpufunctbl = (cpuop_func **)AllocCPUTable("cpufunctbl", 65536 * sizeof(cpuop_func *), TABLE_SRAM);
 #endif
+		if (cpufunctbl == NULL)
+			return false;
+	}
 
 #if REAL_ADDRESSING
 	// Mac address space = host address space
@@ -135,6 +212,7 @@ bool Init680x0(void)
 	if (UseJIT)
 	    compiler_init();
 #endif
+	report_cpu_tables();
 	return true;
 }
 
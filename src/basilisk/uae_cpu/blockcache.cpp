@@ -0,0 +1,652 @@
+/*
+ *  blockcache.cpp - Predecoded basic-block cache for the 68k interpreter
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  See blockcache.h for the design. Everything here runs on the CPU core;
+ *  the only cross-module entry points are the write check in memory.h,
+ *  FlushCodeCache() and flush_icache() (CINV/CPUSH).
+ */
+
+#include "sysdeps.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#include <esp_attr.h>
+#endif
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "blockcache.h"
+#include "profiler.h"
+
+#if USE_BLOCK_CACHE
+
+// Longest 68k instruction (opcode + 10 extension words)
+#define MAX_INSN_LENGTH 22
+
+bool block_cache_enabled = true;
+struct block_cache_stats block_stats;
+
+// Direct-mapped block slots, indexed by Mac PC
+static blockinfo *block_cache = NULL;
+
+// One bit per RAM line that holds the start of a cached instruction
+uae_u8 *block_code_lines = NULL;
+static uae_u32 block_code_lines_size = 0;
+
+// Bumped on every invalidation. A block that ends in an EMUL_OP uses it to
+// tell whether the nested Execute68k() run overwrote any code (that run may
+// also have re-recorded our line, so the line bit alone is not enough)
+static uae_u32 block_cache_generation = 0;
+
+// Opcodes that must end a block: EMUL_OPs can re-enter m68k_execute(), which
+// may reuse the slot that is currently being replayed
+static uae_u8 *block_terminal = NULL;
+
+// Invalidations per RAM line, hashed. A line that code keeps writing into
+// (self-modifying loops, code and data sharing a line) is interpreted
+// without recording once it reaches BLOCK_STORM_LIMIT, as each recording
+// would be thrown away again by the next store. The counts are cleared on
+// a flush and every BLOCK_STORM_DECAY recordings, so such lines get
+// another chance once the code settles.
+#define BLOCK_STORM_LINES 256
+#define BLOCK_STORM_DECAY 4096
+static uae_u8 block_storms[BLOCK_STORM_LINES];
+
+#if USE_FLAG_LIVENESS
+// All condition codes (XNZVC, as in table68k flagdead/flaglive)
+#define FLAGS_ALL 0x1f
+
+// Flag-setting handler -> its no-flags twin, sorted by handler address
+struct noflags_pair {
+	cpuop_func *ff;
+	cpuop_func *nf;
+};
+static noflags_pair *noflags_pairs = NULL;
+static int noflags_count = 0;
+#endif
+
+#if USE_FUSION
+bool block_fusion_enabled = true;
+
+// Fused instruction pairs, sorted by first and then second handler address
+static cpufused *fused_pairs = NULL;
+static int fused_count = 0;
+#endif
+
+static inline uae_u32 block_slot(uaecptr pc)
+{
+	return (pc >> 1) & (BLOCK_CACHE_SIZE - 1);
+}
+
+static inline bool block_cacheable(uaecptr pc)
+{
+	if (pc < RAMSize)
+		return !TwentyFourBitAddressing;
+	return pc >= ROMBaseMac && pc < ROMBaseMac + ROMSize;
+}
+
+static inline bool block_storm(uaecptr pc)
+{
+	return pc < RAMSize && block_storms[(pc >> BLOCK_LINE_SHIFT) & (BLOCK_STORM_LINES - 1)] >= BLOCK_STORM_LIMIT;
+}
+
+static inline void mark_code_line(uaecptr pc)
+{
+	if (pc < RAMSize) {
+		uae_u32 line = pc >> BLOCK_LINE_SHIFT;
+		block_code_lines[line >> 3] |= 1 << (line & 7);
+	}
+}
+
+static inline bool code_line_marked(uaecptr pc)
+{
+	if (pc < RAMSize) {
+		uae_u32 line = pc >> BLOCK_LINE_SHIFT;
+		return (block_code_lines[line >> 3] & (1 << (line & 7))) != 0;
+	}
+	return true;
+}
+
+void block_cache_init(void)
+{
+	if (block_cache == NULL) {
+		// Replayed blocks are read on every instruction: internal SRAM
+		block_cache = (blockinfo *)AllocCPUTable("block cache", BLOCK_CACHE_SIZE * sizeof(blockinfo), TABLE_SRAM);
+		if (block_cache == NULL) {
+			write_log("ERROR: Failed to allocate block cache, running without it\n");
+			block_cache_enabled = false;
+			return;
+		}
+	}
+
+	if (block_code_lines == NULL) {
+		// Checked on every RAM write
+		block_code_lines_size = ((RAMSize >> BLOCK_LINE_SHIFT) + 7) / 8;
+		block_code_lines = (uae_u8 *)AllocCPUTable("block code lines", block_code_lines_size, TABLE_SRAM);
+		if (block_code_lines == NULL) {
+			write_log("ERROR: Failed to allocate block cache line map, running without it\n");
+			block_cache_enabled = false;
+			return;
+		}
+	}
+
+	if (block_terminal == NULL) {
+		// Only looked at while recording a block
+		block_terminal = (uae_u8 *)AllocCPUTable("block terminal opcodes", 65536 / 8, TABLE_PSRAM);
+		if (block_terminal == NULL) {
+			block_cache_enabled = false;
+			return;
+		}
+		memset(block_terminal, 0, 65536 / 8);
+		for (int opcode = 0; opcode < 65536; opcode++) {
+			int mnemo = table68k[opcode].mnemo;
+			if (mnemo == i_EMULOP || mnemo == i_EMULOP_RETURN)
+				block_terminal[opcode >> 3] |= 1 << (opcode & 7);
+		}
+	}
+
+	memset(&block_stats, 0, sizeof(block_stats));
+	block_cache_flush();
+	block_stats.flushes = 0;
+}
+
+void block_cache_exit(void)
+{
+#if USE_FLAG_LIVENESS
+	free(noflags_pairs);
+	noflags_pairs = NULL;
+	noflags_count = 0;
+#endif
+#if USE_FUSION
+	free(fused_pairs);
+	fused_pairs = NULL;
+	fused_count = 0;
+#endif
+	FreeCPUTable(block_cache);
+	block_cache = NULL;
+	FreeCPUTable(block_code_lines);
+	block_code_lines = NULL;
+	FreeCPUTable(block_terminal);
+	block_terminal = NULL;
+}
+
+/*
+ *  Drop every block (CINV/CPUSH, ROM patching)
+ */
+void block_cache_flush(void)
+{
+	if (block_cache == NULL)
+		return;
+	for (int i = 0; i < BLOCK_CACHE_SIZE; i++)
+		block_cache[i].pc = BLOCK_PC_INVALID;
+	memset(block_code_lines, 0, block_code_lines_size);
+	memset(block_storms, 0, sizeof(block_storms));
+	block_cache_generation++;
+	block_stats.flushes++;
+	SPCFLAGS_SET( SPCFLAG_BLOCK_INVALID );
+}
+
+/*
+ *  Drop the blocks that start in one RAM line (called from the write check)
+ */
+void block_cache_invalidate_line(uae_u32 line)
+{
+	block_code_lines[line >> 3] &= ~(1 << (line & 7));
+
+	// A line maps onto a contiguous run of slots
+	uaecptr start = line << BLOCK_LINE_SHIFT;
+	uae_u32 slot = block_slot(start);
+	const int n = (1 << BLOCK_LINE_SHIFT) / 2 < BLOCK_CACHE_SIZE ? (1 << BLOCK_LINE_SHIFT) / 2 : BLOCK_CACHE_SIZE;
+	for (int i = 0; i < n; i++) {
+		blockinfo *bi = &block_cache[(slot + i) & (BLOCK_CACHE_SIZE - 1)];
+		if ((bi->pc >> BLOCK_LINE_SHIFT) == line)
+			bi->pc = BLOCK_PC_INVALID;
+	}
+
+	block_cache_generation++;
+	block_stats.invalidations++;
+	uae_u8 *storm = &block_storms[line & (BLOCK_STORM_LINES - 1)];
+	if (*storm < BLOCK_STORM_LIMIT && ++*storm == BLOCK_STORM_LIMIT)
+		block_stats.storms++;
+
+	// The instruction that wrote may be replaying a block from this line
+	SPCFLAGS_SET( SPCFLAG_BLOCK_INVALID );
+}
+
+/*
+ *  Drop blocks in a Mac address range (FlushCodeCache(), disk reads)
+ */
+void block_cache_invalidate_range(uaecptr start, uae_u32 size)
+{
+	if (block_code_lines == NULL || size == 0 || start >= RAMSize)
+		return;
+	uaecptr end = start + size - 1;
+	if (end >= RAMSize || end < start)
+		end = RAMSize - 1;
+	for (uae_u32 line = start >> BLOCK_LINE_SHIFT; line <= (end >> BLOCK_LINE_SHIFT); line++) {
+		if (block_code_lines[line >> 3] & (1 << (line & 7)))
+			block_cache_invalidate_line(line);
+	}
+}
+
+/*
+ *  FlushCodeCache() entry point: host range in RAM, anything else (ROM
+ *  patches) flushes the whole cache
+ */
+void block_cache_invalidate_host(void *start, uae_u32 size)
+{
+	uae_u8 *p = (uae_u8 *)start;
+	if (RAMBaseHost != NULL && p >= RAMBaseHost && p < RAMBaseHost + RAMSize)
+		block_cache_invalidate_range(RAMBaseMac + (p - RAMBaseHost), size);
+	else
+		block_cache_flush();
+}
+
+#if USE_FLAG_LIVENESS || USE_FUSION
+// Instructions that always continue with the next one and cannot trap, so
+// the flags they set are certain to be seen by the rest of the block
+bool block_flags_straight_line(uae_u32 opcode)
+{
+	switch (table68k[opcode].mnemo) {
+	case i_OR: case i_AND: case i_EOR:
+	case i_SUB: case i_SUBA: case i_SUBX:
+	case i_ADD: case i_ADDA: case i_ADDX:
+	case i_NEG: case i_NEGX: case i_CLR: case i_NOT: case i_TST:
+	case i_BTST: case i_BCHG: case i_BCLR: case i_BSET:
+	case i_CMP: case i_CMPM: case i_CMPA:
+	case i_MOVE: case i_MOVEA: case i_SWAP: case i_EXG: case i_EXT:
+	case i_MVMEL: case i_MVMLE: case i_NOP:
+	case i_LINK: case i_UNLK: case i_LEA: case i_PEA: case i_Scc:
+	case i_MULU: case i_MULS: case i_MULL:
+	case i_ASR: case i_ASL: case i_LSR: case i_LSL:
+	case i_ROL: case i_ROR: case i_ROXL: case i_ROXR:
+	case i_ASRW: case i_ASLW: case i_LSRW: case i_LSLW:
+	case i_ROLW: case i_RORW: case i_ROXLW: case i_ROXRW:
+		return true;
+	default:
+		return false;
+	}
+}
+#endif
+
+#if USE_FLAG_LIVENESS
+static int noflags_compare(const void *a, const void *b)
+{
+	uintptr_t x = (uintptr_t)((const noflags_pair *)a)->ff;
+	uintptr_t y = (uintptr_t)((const noflags_pair *)b)->ff;
+	return x < y ? -1 : x > y;
+}
+
+/*
+ *  Pair up the flag-setting and no-flags handler tables of the CPU level in
+ *  use (called from build_cpufunctbl(), both tables are in the same order)
+ */
+void block_cache_set_noflags(const struct cputbl *ff, const struct cputbl *nf)
+{
+	int n = 0;
+	while (ff[n].handler != NULL)
+		n++;
+
+	free(noflags_pairs);
+	noflags_count = 0;
+	// Only looked at while recording a block, PSRAM is fine
+#ifdef ARDUINO
+	noflags_pairs = (noflags_pair *)heap_caps_malloc(n * sizeof(noflags_pair), MALLOC_CAP_SPIRAM);
+#else
+	noflags_pairs = (noflags_pair *)malloc(n * sizeof(noflags_pair));
+#endif
+	if (noflags_pairs == NULL) {
+		write_log("WARNING: No memory for the no-flags handler map\n");
+		return;
+	}
+	for (int i = 0; i < n; i++) {
+		if (ff[i].handler != nf[i].handler) {
+			noflags_pairs[noflags_count].ff = ff[i].handler;
+			noflags_pairs[noflags_count].nf = nf[i].handler;
+			noflags_count++;
+		}
+	}
+	qsort(noflags_pairs, noflags_count, sizeof(noflags_pair), noflags_compare);
+}
+
+static cpuop_func *noflags_handler(cpuop_func *handler)
+{
+	int lo = 0, hi = noflags_count - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		if (noflags_pairs[mid].ff == handler)
+			return noflags_pairs[mid].nf;
+		if ((uintptr_t)noflags_pairs[mid].ff < (uintptr_t)handler)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+	return NULL;
+}
+
+// ASd/LSd/ROXd/ROd Dx,Dy
+static inline bool shift_by_register(uae_u32 opcode)
+{
+	int mnemo = table68k[opcode].mnemo;
+	return mnemo >= i_ASR && mnemo <= i_ROXR && (opcode & 0x20) != 0;
+}
+
+/*
+ *  Switch entries whose condition codes are overwritten before they are
+ *  read to the no-flags handlers (backwards liveness scan over the block)
+ */
+static void block_drop_dead_flags(blockentry *entries, int n)
+{
+	uae_u32 live = FLAGS_ALL;	// Whatever runs after the block may read them
+	for (int i = n - 1; i >= 0; i--) {
+		uae_u32 opcode = entries[i].opcode;
+		if (!block_flags_straight_line(opcode)) {
+			live = FLAGS_ALL;
+			continue;
+		}
+		// Flags the instruction may change vs. flags it always overwrites
+		uae_u32 set = table68k[opcode].flagdead & FLAGS_ALL;
+		uae_u32 dead = set;
+		if (shift_by_register(opcode))
+			dead &= ~0x10;		// A zero count leaves X alone
+		if (set != 0 && (set & live) == 0) {
+			cpuop_func *nf = noflags_handler(entries[i].handler);
+			if (nf != NULL) {
+				entries[i].handler = nf;
+				block_stats.noflags++;
+			}
+		}
+		live = (live & ~dead) | (table68k[opcode].flaglive & FLAGS_ALL);
+	}
+}
+#endif
+
+#if USE_FUSION
+static int fused_compare(const void *a, const void *b)
+{
+	const cpufused *x = (const cpufused *)a;
+	const cpufused *y = (const cpufused *)b;
+	if (x->first != y->first)
+		return (uintptr_t)x->first < (uintptr_t)y->first ? -1 : 1;
+	if (x->second != y->second)
+		return (uintptr_t)x->second < (uintptr_t)y->second ? -1 : 1;
+	return 0;
+}
+
+/*
+ *  Collect the fused pairs of the CPU level in use (called from
+ *  build_cpufunctbl()). There are no no-flags fused handlers: the branch
+ *  reads the flags, so block_drop_dead_flags() never switches the first
+ *  instruction of a pair to its twin.
+ */
+void block_cache_set_fused(const struct cpufused *pairs)
+{
+	int n = 0;
+	while (pairs[n].handler != NULL)
+		n++;
+
+	free(fused_pairs);
+	fused_pairs = NULL;
+	fused_count = 0;
+	if (n == 0)
+		return;
+#ifdef ARDUINO
+	fused_pairs = (cpufused *)heap_caps_malloc(n * sizeof(cpufused), MALLOC_CAP_SPIRAM);
+#else
+	fused_pairs = (cpufused *)malloc(n * sizeof(cpufused));
+#endif
+	if (fused_pairs == NULL) {
+		write_log("WARNING: No memory for the fused handler map\n");
+		return;
+	}
+	memcpy(fused_pairs, pairs, n * sizeof(cpufused));
+	fused_count = n;
+	qsort(fused_pairs, fused_count, sizeof(cpufused), fused_compare);
+}
+
+int block_cache_fused_pairs(const struct cpufused **pairs)
+{
+	*pairs = fused_pairs;
+	return fused_count;
+}
+
+static cpuop_func *fused_handler(cpuop_func *first, cpuop_func *second)
+{
+	cpufused key;
+	key.first = first;
+	key.second = second;
+	const cpufused *pair = (const cpufused *)bsearch(&key, fused_pairs, fused_count, sizeof(cpufused), fused_compare);
+	return pair != NULL ? pair->handler : NULL;
+}
+
+/*
+ *  Merge entries with the Bcc/DBcc after them where a fused handler exists.
+ *  Runs after the flag liveness scan, which needs every opcode. Returns the
+ *  new number of entries.
+ */
+static int block_fuse(blockentry *entries, int n)
+{
+	int out = 0;
+	for (int i = 0; i < n; i++) {
+		entries[out] = entries[i];
+		if (i + 1 < n && block_flags_straight_line(entries[i].opcode)) {
+			cpuop_func *fused = fused_handler(entries[i].handler, entries[i + 1].handler);
+			if (fused != NULL) {
+				entries[out].handler = fused;
+				entries[out].split = entries[i].length;
+				entries[out].length = entries[i].length + entries[i + 1].length;
+				block_stats.fused++;
+				i++;
+			}
+		}
+		out++;
+	}
+	return out;
+}
+#endif
+
+/*
+ *  Interpret a new block starting at pc and record it into bi
+ */
+static int block_record(blockinfo *bi, uaecptr pc)
+{
+	blockentry entries[BLOCK_MAX_INSNS];
+	uae_u32 line = pc >> BLOCK_LINE_SHIFT;
+	bool terminal = false;
+	int n = 0;
+
+	// Flag the line before running anything, so a store into code we have
+	// already recorded clears the flag again
+	mark_code_line(pc);
+	uae_u32 generation = block_cache_generation;
+	uae_u32 flushes = block_stats.flushes;
+
+	uaecptr ipc = pc;
+	for (;;) {
+		uae_u32 opcode = GET_OPCODE;
+		cpuop_func *handler = cpu_opcode_handler(opcode);
+#if OPCODE_PROFILE
+		m68k_profile_opcode(opcode);
+#endif
+		(*handler)(opcode);
+
+		uaecptr next = m68k_getpc();
+		entries[n].handler = handler;
+		entries[n].opcode = opcode;
+		entries[n].length = next - ipc;
+		entries[n].split = 0;
+		n++;
+
+		if (block_terminal[opcode >> 3] & (1 << (opcode & 7))) {
+			terminal = true;
+			break;
+		}
+		if (next <= ipc || next - ipc > MAX_INSN_LENGTH)
+			break;		// Control left the straight line
+		if ((next >> BLOCK_LINE_SHIFT) != line)
+			break;
+		if (n == BLOCK_MAX_INSNS)
+			break;
+		if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+			break;
+		ipc = next;
+	}
+
+	bool valid;
+	if (terminal)
+		valid = generation == block_cache_generation;
+	else
+		valid = flushes == block_stats.flushes && code_line_marked(pc);
+	if (valid) {
+		int count = n;
+#if USE_FLAG_LIVENESS
+		if (noflags_pairs != NULL)
+			block_drop_dead_flags(entries, n);
+#endif
+#if USE_FUSION
+		if (block_fusion_enabled && fused_count != 0)
+			count = block_fuse(entries, n);
+#endif
+		memcpy(bi->entries, entries, count * sizeof(blockentry));
+		bi->count = count;
+		bi->insns = n;
+		bi->pc = pc;
+	}
+	if ((++block_stats.misses & (BLOCK_STORM_DECAY - 1)) == 0)
+		memset(block_storms, 0, sizeof(block_storms));
+	return n;
+}
+
+#if USE_PROFILER
+// Opcode of the index-th instruction of a block
+static uae_u32 block_insn_opcode(const blockinfo *bi, int index)
+{
+#if USE_FUSION
+	uaecptr pc = bi->pc;
+	for (const blockentry *e = bi->entries; ; e++) {
+		if (index == 0)
+			return e->opcode;
+		if (e->split != 0) {
+			if (index == 1)
+				return get_word(pc + e->split);
+			index--;
+		}
+		index--;
+		pc += e->length;
+	}
+#else
+	return bi->entries[index].opcode;
+#endif
+}
+
+/*
+ *  Count a block run towards the next profiler sample, and sample the
+ *  instruction the countdown runs out on
+ */
+static inline void block_profile(const blockinfo *bi)
+{
+	if (unlikely(profiler_enabled) && (profiler_countdown -= bi->insns) <= 0)
+		profiler_sample(block_insn_opcode(bi, bi->insns - 1 + profiler_countdown));
+}
+#endif
+
+/*
+ *  Run cached blocks until at least "budget" instructions have executed or
+ *  a special condition is pending. Returns the number of instructions run.
+ */
+#ifdef ARDUINO
+IRAM_ATTR
+#endif
+int block_cache_execute(int budget)
+{
+	int executed = 0;
+
+	do {
+		uaecptr pc = m68k_getpc();
+		blockinfo *bi = &block_cache[block_slot(pc)];
+
+		if (unlikely(bi->pc != pc)) {
+			if (!block_cacheable(pc)) {
+				// Not RAM/ROM: interpret one instruction
+				uae_u32 opcode = GET_OPCODE;
+#if OPCODE_PROFILE
+				m68k_profile_opcode(opcode);
+#endif
+#if USE_PROFILER
+				profiler_tick(1);
+#endif
+				(*cpu_opcode_handler(opcode))(opcode);
+				executed++;
+			} else if (block_storm(pc)) {
+				// A line that keeps being written to: interpret until
+				// control leaves it
+				uae_u32 line = pc >> BLOCK_LINE_SHIFT;
+				do {
+					uae_u32 opcode = GET_OPCODE;
+#if OPCODE_PROFILE
+					m68k_profile_opcode(opcode);
+#endif
+#if USE_PROFILER
+					profiler_tick(1);
+#endif
+					(*cpu_opcode_handler(opcode))(opcode);
+					executed++;
+				} while (executed < budget && !SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)
+						 && (m68k_getpc() >> BLOCK_LINE_SHIFT) == line);
+			} else {
+				executed += block_record(bi, pc);
+#if USE_PROFILER
+				if (bi->pc == pc)
+					block_profile(bi);
+#endif
+			}
+		} else {
+			const blockentry *e = bi->entries;
+			const blockentry *end = e + bi->count;
+			uae_u8 *expect = regs.pc_p;
+			block_stats.hits++;
+#if USE_PROFILER
+			block_profile(bi);
+#endif
+			for (;;) {
+#if OPCODE_PROFILE
+				m68k_profile_opcode(e->opcode);
+#if USE_FUSION
+				if (e->split != 0)
+					m68k_profile_opcode(do_get_mem_word((uae_u16 *)(expect + e->split)));
+#endif
+#endif
+				(*e->handler)(e->opcode);
+				executed++;
+				if (unlikely(SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))) {
+#if USE_FUSION
+					// A fused handler stops after the first instruction
+					// when that raised a flag
+					if (e->split != 0 && regs.pc_p != expect + e->split)
+						executed++;
+#endif
+					return executed;
+				}
+#if USE_FUSION
+				executed += e->split != 0;
+#endif
+				expect += e->length;
+				if (++e == end || regs.pc_p != expect)
+					break;
+			}
+		}
+
+		if (unlikely(SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)))
+			break;
+	} while (executed < budget);
+
+	return executed;
+}
+
+#endif /* USE_BLOCK_CACHE */
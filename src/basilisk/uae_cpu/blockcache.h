@@ -0,0 +1,118 @@
+/*
+ *  blockcache.h - Predecoded basic-block cache for the 68k interpreter
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  m68k_do_execute() normally fetches every opcode from Mac RAM/ROM (PSRAM)
+ *  and looks its handler up in the 256KB cpufunctbl. The block cache keeps
+ *  straight-line runs of instructions as compact {handler, opcode, length}
+ *  arrays in internal SRAM, keyed by Mac PC, so a cached block dispatches
+ *  without touching either table.
+ *
+ *  Blocks are recorded the first time they run: each instruction is
+ *  interpreted normally and its handler, opcode and observed PC advance are
+ *  appended until control leaves the straight line (taken branch, exception),
+ *  an EMUL_OP is reached, or the block would cross a 256-byte code line.
+ *  On replay the PC after each handler is compared against the recorded
+ *  length, so a branch that goes the other way simply ends the block.
+ *
+ *  Only opcode words are cached; extension words are still read live through
+ *  regs.pc_p. A RAM line that holds the start of a cached instruction is
+ *  flagged in a bitmap, and the RAM write fast paths in memory.h invalidate
+ *  the line on a write. FlushCodeCache() and CINV/CPUSH drop blocks too.
+ *  A line that is invalidated BLOCK_STORM_LIMIT times (self-modifying code)
+ *  is interpreted one instruction at a time instead of being re-recorded
+ *  after every store, until the counts decay.
+ *
+ *  With USE_FLAG_LIVENESS a recorded block is scanned backwards for
+ *  condition codes that are overwritten before anything reads them. Such
+ *  instructions are replayed with their no-flags handler (cpuemu_nf.cpp,
+ *  see noflags.h). Only instructions that always fall through and cannot
+ *  trap take part; anything else, and the end of the block, counts as
+ *  reading all flags. An interrupt taken inside a block may stack stale
+ *  flags, which are overwritten again once the block continues.
+ *
+ *  With USE_FUSION, an entry followed by a Bcc or DBcc is merged with it
+ *  when gencpu generated a fused handler for the pair (op_fusedtbl_*, from
+ *  tools/cpu_gen/fused_pairs.txt), so the pair costs one dispatch and the
+ *  compiler sees the flag producer and the branch in one function. Only
+ *  straight-line first instructions qualify, so the PC between the two is
+ *  known; other pairs stay two entries.
+ */
+
+#ifndef BLOCKCACHE_H
+#define BLOCKCACHE_H
+
+#if USE_FUSION && !USE_BLOCK_CACHE
+#error "USE_FUSION needs USE_BLOCK_CACHE (pairs are fused in recorded blocks)"
+#endif
+
+#if USE_BLOCK_CACHE
+
+// Number of direct-mapped block slots (power of two)
+#ifndef BLOCK_CACHE_SIZE
+#define BLOCK_CACHE_SIZE 1024
+#endif
+
+// Maximum instructions per block
+#ifndef BLOCK_MAX_INSNS
+#define BLOCK_MAX_INSNS 8
+#endif
+
+// Invalidations after which a RAM line is interpreted without recording
+#ifndef BLOCK_STORM_LIMIT
+#define BLOCK_STORM_LIMIT 8
+#endif
+
+struct blockentry {
+	cpuop_func *handler;
+	uae_u16 opcode;			// First opcode of a fused pair
+	uae_u8 length;			// PC advance to the next entry
+	uae_u8 split;			// Length of the first instruction of a fused pair, else 0
+};
+
+struct blockinfo {
+	uaecptr pc;				// Mac PC of the first instruction (BLOCK_PC_INVALID if empty)
+	uae_u16 count;			// Number of valid entries
+	uae_u16 insns;			// Instructions in them (fused pairs count twice)
+	blockentry entries[BLOCK_MAX_INSNS];
+};
+
+#define BLOCK_PC_INVALID 0xffffffff
+
+// Runtime switch (host benchmarks compare both paths in one binary)
+extern bool block_cache_enabled;
+
+extern void block_cache_init(void);
+extern void block_cache_exit(void);
+extern void block_cache_flush(void);
+extern void block_cache_invalidate_range(uaecptr start, uae_u32 size);
+extern void block_cache_invalidate_host(void *start, uae_u32 size);
+extern int block_cache_execute(int budget);
+#if USE_FLAG_LIVENESS
+extern void block_cache_set_noflags(const struct cputbl *ff, const struct cputbl *nf);
+#endif
+#if USE_FUSION
+extern bool block_fusion_enabled;		// Runtime switch, as block_cache_enabled
+extern void block_cache_set_fused(const struct cpufused *pairs);
+extern int block_cache_fused_pairs(const struct cpufused **pairs);
+#endif
+#if USE_FLAG_LIVENESS || USE_FUSION
+extern bool block_flags_straight_line(uae_u32 opcode);
+#endif
+
+// Statistics
+struct block_cache_stats {
+	uae_u32 hits;			// Blocks replayed from the cache
+	uae_u32 misses;			// Blocks recorded
+	uae_u32 invalidations;	// Lines invalidated by writes or FlushCodeCache()
+	uae_u32 flushes;		// Whole-cache flushes (CINV/CPUSH)
+	uae_u32 noflags;		// Recorded entries switched to a no-flags handler
+	uae_u32 fused;			// Recorded instruction pairs merged into a fused handler
+	uae_u32 storms;			// Lines that stopped being recorded (BLOCK_STORM_LIMIT)
+};
+extern struct block_cache_stats block_stats;
+
+#endif /* USE_BLOCK_CACHE */
+
+#endif /* BLOCKCACHE_H */
@@ -13,7 +13,13 @@
 // Stub definitions for JIT-related functions and variables
 static inline void compiler_init(void) {}
 static inline void compiler_exit(void) {}
+#if USE_BLOCK_CACHE
+// CINV/CPUSH drop the interpreter's block cache instead
+extern void block_cache_flush(void);
+static inline void flush_icache(int n) { (void)n; block_cache_flush(); }
+#else
 static inline void flush_icache(int n) { (void)n; }
+#endif
 static inline void flush_icache_range(uint8 *start, uint32 length) { (void)start; (void)length; }
 
 // JIT cache pointers (stubs)
@@ -53,7 +53,8 @@ enum {
 	FLAYOUT_DIRECT,				// Frame buffer is in MacOS layout, no conversion needed
 	FLAYOUT_HOST_555,			// 16 bit, RGB 555, host byte order
 	FLAYOUT_HOST_565,			// 16 bit, RGB 565, host byte order
-	FLAYOUT_HOST_888			// 32 bit, RGB 888, host byte order
+	FLAYOUT_HOST_888,			// 32 bit, RGB 888, host byte order
+	FLAYOUT_BE_565				// 16 bit, RGB 565, big endian (converted from 555 on store)
 };
 
 // Mac memory access functions
@@ -67,10 +68,18 @@ static inline void WriteMacInt8(uint32 addr, uint32 b) {put_byte(addr, b);}
 static inline uint8 *Mac2HostAddr(uint32 addr) {return get_real_address(addr);}
 static inline uint32 Host2MacAddr(uint8 *addr) {return get_virtual_address(addr);}
 
+#if USE_LOW_MEM_MIRROR
+// Writes through host pointers must refresh the low memory mirror (memory.h)
+static inline void *Mac_memset(uint32 addr, int c, size_t n) {void *p = memset(Mac2HostAddr(addr), c, n); low_mem_mirror_sync(p, n); return p;}
+static inline void *Mac2Host_memcpy(void *dest, uint32 src, size_t n) {return memcpy(dest, Mac2HostAddr(src), n);}
+static inline void *Host2Mac_memcpy(uint32 dest, const void *src, size_t n) {void *p = memcpy(Mac2HostAddr(dest), src, n); low_mem_mirror_sync(p, n); return p;}
+static inline void *Mac2Mac_memcpy(uint32 dest, uint32 src, size_t n) {void *p = memcpy(Mac2HostAddr(dest), Mac2HostAddr(src), n); low_mem_mirror_sync(p, n); return p;}
+#else
 static inline void *Mac_memset(uint32 addr, int c, size_t n) {return memset(Mac2HostAddr(addr), c, n);}
 static inline void *Mac2Host_memcpy(void *dest, uint32 src, size_t n) {return memcpy(dest, Mac2HostAddr(src), n);}
 static inline void *Host2Mac_memcpy(uint32 dest, const void *src, size_t n) {return memcpy(Mac2HostAddr(dest), src, n);}
 static inline void *Mac2Mac_memcpy(uint32 dest, uint32 src, size_t n) {return memcpy(Mac2HostAddr(dest), Mac2HostAddr(src), n);}
+#endif
 
 
 /*
@@ -82,6 +91,18 @@ extern bool Init680x0(void);	// This routine may want to look at CPUType/FPUType
 extern void Exit680x0(void);
 extern void InitFrameBufferMapping(void);
 
+// Tables of the CPU emulation, in internal SRAM or PSRAM. Internal SRAM is
+// budgeted (CPU_SRAM_BUDGET in basilisk_glue.cpp): a table asking for it
+// that does not fit goes to PSRAM, or is not allocated with TABLE_SRAM_ONLY.
+// Init680x0() logs the total against the budget.
+enum {
+	TABLE_SRAM,				// Internal SRAM, PSRAM past the budget
+	TABLE_SRAM_ONLY,		// Internal SRAM or nothing (the caller does without)
+	TABLE_PSRAM				// PSRAM
+};
+extern void *AllocCPUTable(const char *name, size_t size, int placement);
+extern void FreeCPUTable(void *p);
+
 // 680x0 dynamic recompilation activation flag
 #if USE_JIT
 extern bool UseJIT;
@@ -0,0 +1,13639 @@
+#include "sysdeps.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "cputbl.h"
+#if USE_COMPACT_DISPATCH
+extern cpuop_func op_illg_1;
+
+/* CPU level 4: 1869 handlers, 242 pages */
+static cpuop_func *const op_dispatch_handlers_0[] = {
+op_illg_1,
+op_0_0_ff,
+op_10_0_ff,
+op_18_0_ff,
+op_20_0_ff,
+op_28_0_ff,
+op_30_0_ff,
+op_38_0_ff,
+op_39_0_ff,
+op_3c_0_ff,
+op_40_0_ff,
+op_50_0_ff,
+op_58_0_ff,
+op_60_0_ff,
+op_68_0_ff,
+op_70_0_ff,
+op_78_0_ff,
+op_79_0_ff,
+op_7c_0_ff,
+op_80_0_ff,
+op_90_0_ff,
+op_98_0_ff,
+op_a0_0_ff,
+op_a8_0_ff,
+op_b0_0_ff,
+op_b8_0_ff,
+op_b9_0_ff,
+op_d0_0_ff,
+op_e8_0_ff,
+op_f0_0_ff,
+op_f8_0_ff,
+op_f9_0_ff,
+op_fa_0_ff,
+op_fb_0_ff,
+op_100_0_ff,
+op_108_0_ff,
+op_110_0_ff,
+op_118_0_ff,
+op_120_0_ff,
+op_128_0_ff,
+op_130_0_ff,
+op_138_0_ff,
+op_139_0_ff,
+op_13a_0_ff,
+op_13b_0_ff,
+op_13c_0_ff,
+op_140_0_ff,
+op_148_0_ff,
+op_150_0_ff,
+op_158_0_ff,
+op_160_0_ff,
+op_168_0_ff,
+op_170_0_ff,
+op_178_0_ff,
+op_179_0_ff,
+op_17a_0_ff,
+op_17b_0_ff,
+op_180_0_ff,
+op_188_0_ff,
+op_190_0_ff,
+op_198_0_ff,
+op_1a0_0_ff,
+op_1a8_0_ff,
+op_1b0_0_ff,
+op_1b8_0_ff,
+op_1b9_0_ff,
+op_1ba_0_ff,
+op_1bb_0_ff,
+op_1c0_0_ff,
+op_1c8_0_ff,
+op_1d0_0_ff,
+op_1d8_0_ff,
+op_1e0_0_ff,
+op_1e8_0_ff,
+op_1f0_0_ff,
+op_1f8_0_ff,
+op_1f9_0_ff,
+op_1fa_0_ff,
+op_1fb_0_ff,
+op_200_0_ff,
+op_210_0_ff,
+op_218_0_ff,
+op_220_0_ff,
+op_228_0_ff,
+op_230_0_ff,
+op_238_0_ff,
+op_239_0_ff,
+op_23c_0_ff,
+op_240_0_ff,
+op_250_0_ff,
+op_258_0_ff,
+op_260_0_ff,
+op_268_0_ff,
+op_270_0_ff,
+op_278_0_ff,
+op_279_0_ff,
+op_27c_0_ff,
+op_280_0_ff,
+op_290_0_ff,
+op_298_0_ff,
+op_2a0_0_ff,
+op_2a8_0_ff,
+op_2b0_0_ff,
+op_2b8_0_ff,
+op_2b9_0_ff,
+op_2d0_0_ff,
+op_2e8_0_ff,
+op_2f0_0_ff,
+op_2f8_0_ff,
+op_2f9_0_ff,
+op_2fa_0_ff,
+op_2fb_0_ff,
+op_400_0_ff,
+op_410_0_ff,
+op_418_0_ff,
+op_420_0_ff,
+op_428_0_ff,
+op_430_0_ff,
+op_438_0_ff,
+op_439_0_ff,
+op_440_0_ff,
+op_450_0_ff,
+op_458_0_ff,
+op_460_0_ff,
+op_468_0_ff,
+op_470_0_ff,
+op_478_0_ff,
+op_479_0_ff,
+op_480_0_ff,
+op_490_0_ff,
+op_498_0_ff,
+op_4a0_0_ff,
+op_4a8_0_ff,
+op_4b0_0_ff,
+op_4b8_0_ff,
+op_4b9_0_ff,
+op_4d0_0_ff,
+op_4e8_0_ff,
+op_4f0_0_ff,
+op_4f8_0_ff,
+op_4f9_0_ff,
+op_4fa_0_ff,
+op_4fb_0_ff,
+op_600_0_ff,
+op_610_0_ff,
+op_618_0_ff,
+op_620_0_ff,
+op_628_0_ff,
+op_630_0_ff,
+op_638_0_ff,
+op_639_0_ff,
+op_640_0_ff,
+op_650_0_ff,
+op_658_0_ff,
+op_660_0_ff,
+op_668_0_ff,
+op_670_0_ff,
+op_678_0_ff,
+op_679_0_ff,
+op_680_0_ff,
+op_690_0_ff,
+op_698_0_ff,
+op_6a0_0_ff,
+op_6a8_0_ff,
+op_6b0_0_ff,
+op_6b8_0_ff,
+op_6b9_0_ff,
+op_6c0_0_ff,
+op_6c8_0_ff,
+op_6d0_0_ff,
+op_6e8_0_ff,
+op_6f0_0_ff,
+op_6f8_0_ff,
+op_6f9_0_ff,
+op_6fa_0_ff,
+op_6fb_0_ff,
+op_800_0_ff,
+op_810_0_ff,
+op_818_0_ff,
+op_820_0_ff,
+op_828_0_ff,
+op_830_0_ff,
+op_838_0_ff,
+op_839_0_ff,
+op_83a_0_ff,
+op_83b_0_ff,
+op_83c_0_ff,
+op_840_0_ff,
+op_850_0_ff,
+op_858_0_ff,
+op_860_0_ff,
+op_868_0_ff,
+op_870_0_ff,
+op_878_0_ff,
+op_879_0_ff,
+op_87a_0_ff,
+op_87b_0_ff,
+op_880_0_ff,
+op_890_0_ff,
+op_898_0_ff,
+op_8a0_0_ff,
+op_8a8_0_ff,
+op_8b0_0_ff,
+op_8b8_0_ff,
+op_8b9_0_ff,
+op_8ba_0_ff,
+op_8bb_0_ff,
+op_8c0_0_ff,
+op_8d0_0_ff,
+op_8d8_0_ff,
+op_8e0_0_ff,
+op_8e8_0_ff,
+op_8f0_0_ff,
+op_8f8_0_ff,
+op_8f9_0_ff,
+op_8fa_0_ff,
+op_8fb_0_ff,
+op_a00_0_ff,
+op_a10_0_ff,
+op_a18_0_ff,
+op_a20_0_ff,
+op_a28_0_ff,
+op_a30_0_ff,
+op_a38_0_ff,
+op_a39_0_ff,
+op_a3c_0_ff,
+op_a40_0_ff,
+op_a50_0_ff,
+op_a58_0_ff,
+op_a60_0_ff,
+op_a68_0_ff,
+op_a70_0_ff,
+op_a78_0_ff,
+op_a79_0_ff,
+op_a7c_0_ff,
+op_a80_0_ff,
+op_a90_0_ff,
+op_a98_0_ff,
+op_aa0_0_ff,
+op_aa8_0_ff,
+op_ab0_0_ff,
+op_ab8_0_ff,
+op_ab9_0_ff,
+op_ad0_0_ff,
+op_ad8_0_ff,
+op_ae0_0_ff,
+op_ae8_0_ff,
+op_af0_0_ff,
+op_af8_0_ff,
+op_af9_0_ff,
+op_c00_0_ff,
+op_c10_0_ff,
+op_c18_0_ff,
+op_c20_0_ff,
+op_c28_0_ff,
+op_c30_0_ff,
+op_c38_0_ff,
+op_c39_0_ff,
+op_c3a_0_ff,
+op_c3b_0_ff,
+op_c40_0_ff,
+op_c50_0_ff,
+op_c58_0_ff,
+op_c60_0_ff,
+op_c68_0_ff,
+op_c70_0_ff,
+op_c78_0_ff,
+op_c79_0_ff,
+op_c7a_0_ff,
+op_c7b_0_ff,
+op_c80_0_ff,
+op_c90_0_ff,
+op_c98_0_ff,
+op_ca0_0_ff,
+op_ca8_0_ff,
+op_cb0_0_ff,
+op_cb8_0_ff,
+op_cb9_0_ff,
+op_cba_0_ff,
+op_cbb_0_ff,
+op_cd0_0_ff,
+op_cd8_0_ff,
+op_ce0_0_ff,
+op_ce8_0_ff,
+op_cf0_0_ff,
+op_cf8_0_ff,
+op_cf9_0_ff,
+op_cfc_0_ff,
+op_e10_0_ff,
+op_e18_0_ff,
+op_e20_0_ff,
+op_e28_0_ff,
+op_e30_0_ff,
+op_e38_0_ff,
+op_e39_0_ff,
+op_e50_0_ff,
+op_e58_0_ff,
+op_e60_0_ff,
+op_e68_0_ff,
+op_e70_0_ff,
+op_e78_0_ff,
+op_e79_0_ff,
+op_e90_0_ff,
+op_e98_0_ff,
+op_ea0_0_ff,
+op_ea8_0_ff,
+op_eb0_0_ff,
+op_eb8_0_ff,
+op_eb9_0_ff,
+op_ed0_0_ff,
+op_ed8_0_ff,
+op_ee0_0_ff,
+op_ee8_0_ff,
+op_ef0_0_ff,
+op_ef8_0_ff,
+op_ef9_0_ff,
+op_efc_0_ff,
+op_1000_0_ff,
+op_1010_0_ff,
+op_1018_0_ff,
+op_1020_0_ff,
+op_1028_0_ff,
+op_1030_0_ff,
+op_1038_0_ff,
+op_1039_0_ff,
+op_103a_0_ff,
+op_103b_0_ff,
+op_103c_0_ff,
+op_1080_0_ff,
+op_1090_0_ff,
+op_1098_0_ff,
+op_10a0_0_ff,
+op_10a8_0_ff,
+op_10b0_0_ff,
+op_10b8_0_ff,
+op_10b9_0_ff,
+op_10ba_0_ff,
+op_10bb_0_ff,
+op_10bc_0_ff,
+op_10c0_0_ff,
+op_10d0_0_ff,
+op_10d8_0_ff,
+op_10e0_0_ff,
+op_10e8_0_ff,
+op_10f0_0_ff,
+op_10f8_0_ff,
+op_10f9_0_ff,
+op_10fa_0_ff,
+op_10fb_0_ff,
+op_10fc_0_ff,
+op_1100_0_ff,
+op_1110_0_ff,
+op_1118_0_ff,
+op_1120_0_ff,
+op_1128_0_ff,
+op_1130_0_ff,
+op_1138_0_ff,
+op_1139_0_ff,
+op_113a_0_ff,
+op_113b_0_ff,
+op_113c_0_ff,
+op_1140_0_ff,
+op_1150_0_ff,
+op_1158_0_ff,
+op_1160_0_ff,
+op_1168_0_ff,
+op_1170_0_ff,
+op_1178_0_ff,
+op_1179_0_ff,
+op_117a_0_ff,
+op_117b_0_ff,
+op_117c_0_ff,
+op_1180_0_ff,
+op_1190_0_ff,
+op_1198_0_ff,
+op_11a0_0_ff,
+op_11a8_0_ff,
+op_11b0_0_ff,
+op_11b8_0_ff,
+op_11b9_0_ff,
+op_11ba_0_ff,
+op_11bb_0_ff,
+op_11bc_0_ff,
+op_11c0_0_ff,
+op_11d0_0_ff,
+op_11d8_0_ff,
+op_11e0_0_ff,
+op_11e8_0_ff,
+op_11f0_0_ff,
+op_11f8_0_ff,
+op_11f9_0_ff,
+op_11fa_0_ff,
+op_11fb_0_ff,
+op_11fc_0_ff,
+op_13c0_0_ff,
+op_13d0_0_ff,
+op_13d8_0_ff,
+op_13e0_0_ff,
+op_13e8_0_ff,
+op_13f0_0_ff,
+op_13f8_0_ff,
+op_13f9_0_ff,
+op_13fa_0_ff,
+op_13fb_0_ff,
+op_13fc_0_ff,
+op_2000_0_ff,
+op_2008_0_ff,
+op_2010_0_ff,
+op_2018_0_ff,
+op_2020_0_ff,
+op_2028_0_ff,
+op_2030_0_ff,
+op_2038_0_ff,
+op_2039_0_ff,
+op_203a_0_ff,
+op_203b_0_ff,
+op_203c_0_ff,
+op_2040_0_ff,
+op_2048_0_ff,
+op_2050_0_ff,
+op_2058_0_ff,
+op_2060_0_ff,
+op_2068_0_ff,
+op_2070_0_ff,
+op_2078_0_ff,
+op_2079_0_ff,
+op_207a_0_ff,
+op_207b_0_ff,
+op_207c_0_ff,
+op_2080_0_ff,
+op_2088_0_ff,
+op_2090_0_ff,
+op_2098_0_ff,
+op_20a0_0_ff,
+op_20a8_0_ff,
+op_20b0_0_ff,
+op_20b8_0_ff,
+op_20b9_0_ff,
+op_20ba_0_ff,
+op_20bb_0_ff,
+op_20bc_0_ff,
+op_20c0_0_ff,
+op_20c8_0_ff,
+op_20d0_0_ff,
+op_20d8_0_ff,
+op_20e0_0_ff,
+op_20e8_0_ff,
+op_20f0_0_ff,
+op_20f8_0_ff,
+op_20f9_0_ff,
+op_20fa_0_ff,
+op_20fb_0_ff,
+op_20fc_0_ff,
+op_2100_0_ff,
+op_2108_0_ff,
+op_2110_0_ff,
+op_2118_0_ff,
+op_2120_0_ff,
+op_2128_0_ff,
+op_2130_0_ff,
+op_2138_0_ff,
+op_2139_0_ff,
+op_213a_0_ff,
+op_213b_0_ff,
+op_213c_0_ff,
+op_2140_0_ff,
+op_2148_0_ff,
+op_2150_0_ff,
+op_2158_0_ff,
+op_2160_0_ff,
+op_2168_0_ff,
+op_2170_0_ff,
+op_2178_0_ff,
+op_2179_0_ff,
+op_217a_0_ff,
+op_217b_0_ff,
+op_217c_0_ff,
+op_2180_0_ff,
+op_2188_0_ff,
+op_2190_0_ff,
+op_2198_0_ff,
+op_21a0_0_ff,
+op_21a8_0_ff,
+op_21b0_0_ff,
+op_21b8_0_ff,
+op_21b9_0_ff,
+op_21ba_0_ff,
+op_21bb_0_ff,
+op_21bc_0_ff,
+op_21c0_0_ff,
+op_21c8_0_ff,
+op_21d0_0_ff,
+op_21d8_0_ff,
+op_21e0_0_ff,
+op_21e8_0_ff,
+op_21f0_0_ff,
+op_21f8_0_ff,
+op_21f9_0_ff,
+op_21fa_0_ff,
+op_21fb_0_ff,
+op_21fc_0_ff,
+op_23c0_0_ff,
+op_23c8_0_ff,
+op_23d0_0_ff,
+op_23d8_0_ff,
+op_23e0_0_ff,
+op_23e8_0_ff,
+op_23f0_0_ff,
+op_23f8_0_ff,
+op_23f9_0_ff,
+op_23fa_0_ff,
+op_23fb_0_ff,
+op_23fc_0_ff,
+op_3000_0_ff,
+op_3008_0_ff,
+op_3010_0_ff,
+op_3018_0_ff,
+op_3020_0_ff,
+op_3028_0_ff,
+op_3030_0_ff,
+op_3038_0_ff,
+op_3039_0_ff,
+op_303a_0_ff,
+op_303b_0_ff,
+op_303c_0_ff,
+op_3040_0_ff,
+op_3048_0_ff,
+op_3050_0_ff,
+op_3058_0_ff,
+op_3060_0_ff,
+op_3068_0_ff,
+op_3070_0_ff,
+op_3078_0_ff,
+op_3079_0_ff,
+op_307a_0_ff,
+op_307b_0_ff,
+op_307c_0_ff,
+op_3080_0_ff,
+op_3088_0_ff,
+op_3090_0_ff,
+op_3098_0_ff,
+op_30a0_0_ff,
+op_30a8_0_ff,
+op_30b0_0_ff,
+op_30b8_0_ff,
+op_30b9_0_ff,
+op_30ba_0_ff,
+op_30bb_0_ff,
+op_30bc_0_ff,
+op_30c0_0_ff,
+op_30c8_0_ff,
+op_30d0_0_ff,
+op_30d8_0_ff,
+op_30e0_0_ff,
+op_30e8_0_ff,
+op_30f0_0_ff,
+op_30f8_0_ff,
+op_30f9_0_ff,
+op_30fa_0_ff,
+op_30fb_0_ff,
+op_30fc_0_ff,
+op_3100_0_ff,
+op_3108_0_ff,
+op_3110_0_ff,
+op_3118_0_ff,
+op_3120_0_ff,
+op_3128_0_ff,
+op_3130_0_ff,
+op_3138_0_ff,
+op_3139_0_ff,
+op_313a_0_ff,
+op_313b_0_ff,
+op_313c_0_ff,
+op_3140_0_ff,
+op_3148_0_ff,
+op_3150_0_ff,
+op_3158_0_ff,
+op_3160_0_ff,
+op_3168_0_ff,
+op_3170_0_ff,
+op_3178_0_ff,
+op_3179_0_ff,
+op_317a_0_ff,
+op_317b_0_ff,
+op_317c_0_ff,
+op_3180_0_ff,
+op_3188_0_ff,
+op_3190_0_ff,
+op_3198_0_ff,
+op_31a0_0_ff,
+op_31a8_0_ff,
+op_31b0_0_ff,
+op_31b8_0_ff,
+op_31b9_0_ff,
+op_31ba_0_ff,
+op_31bb_0_ff,
+op_31bc_0_ff,
+op_31c0_0_ff,
+op_31c8_0_ff,
+op_31d0_0_ff,
+op_31d8_0_ff,
+op_31e0_0_ff,
+op_31e8_0_ff,
+op_31f0_0_ff,
+op_31f8_0_ff,
+op_31f9_0_ff,
+op_31fa_0_ff,
+op_31fb_0_ff,
+op_31fc_0_ff,
+op_33c0_0_ff,
+op_33c8_0_ff,
+op_33d0_0_ff,
+op_33d8_0_ff,
+op_33e0_0_ff,
+op_33e8_0_ff,
+op_33f0_0_ff,
+op_33f8_0_ff,
+op_33f9_0_ff,
+op_33fa_0_ff,
+op_33fb_0_ff,
+op_33fc_0_ff,
+op_4000_0_ff,
+op_4010_0_ff,
+op_4018_0_ff,
+op_4020_0_ff,
+op_4028_0_ff,
+op_4030_0_ff,
+op_4038_0_ff,
+op_4039_0_ff,
+op_4040_0_ff,
+op_4050_0_ff,
+op_4058_0_ff,
+op_4060_0_ff,
+op_4068_0_ff,
+op_4070_0_ff,
+op_4078_0_ff,
+op_4079_0_ff,
+op_4080_0_ff,
+op_4090_0_ff,
+op_4098_0_ff,
+op_40a0_0_ff,
+op_40a8_0_ff,
+op_40b0_0_ff,
+op_40b8_0_ff,
+op_40b9_0_ff,
+op_40c0_0_ff,
+op_40d0_0_ff,
+op_40d8_0_ff,
+op_40e0_0_ff,
+op_40e8_0_ff,
+op_40f0_0_ff,
+op_40f8_0_ff,
+op_40f9_0_ff,
+op_4100_0_ff,
+op_4110_0_ff,
+op_4118_0_ff,
+op_4120_0_ff,
+op_4128_0_ff,
+op_4130_0_ff,
+op_4138_0_ff,
+op_4139_0_ff,
+op_413a_0_ff,
+op_413b_0_ff,
+op_413c_0_ff,
+op_4180_0_ff,
+op_4190_0_ff,
+op_4198_0_ff,
+op_41a0_0_ff,
+op_41a8_0_ff,
+op_41b0_0_ff,
+op_41b8_0_ff,
+op_41b9_0_ff,
+op_41ba_0_ff,
+op_41bb_0_ff,
+op_41bc_0_ff,
+op_41d0_0_ff,
+op_41e8_0_ff,
+op_41f0_0_ff,
+op_41f8_0_ff,
+op_41f9_0_ff,
+op_41fa_0_ff,
+op_41fb_0_ff,
+op_4200_0_ff,
+op_4210_0_ff,
+op_4218_0_ff,
+op_4220_0_ff,
+op_4228_0_ff,
+op_4230_0_ff,
+op_4238_0_ff,
+op_4239_0_ff,
+op_4240_0_ff,
+op_4250_0_ff,
+op_4258_0_ff,
+op_4260_0_ff,
+op_4268_0_ff,
+op_4270_0_ff,
+op_4278_0_ff,
+op_4279_0_ff,
+op_4280_0_ff,
+op_4290_0_ff,
+op_4298_0_ff,
+op_42a0_0_ff,
+op_42a8_0_ff,
+op_42b0_0_ff,
+op_42b8_0_ff,
+op_42b9_0_ff,
+op_42c0_0_ff,
+op_42d0_0_ff,
+op_42d8_0_ff,
+op_42e0_0_ff,
+op_42e8_0_ff,
+op_42f0_0_ff,
+op_42f8_0_ff,
+op_42f9_0_ff,
+op_4400_0_ff,
+op_4410_0_ff,
+op_4418_0_ff,
+op_4420_0_ff,
+op_4428_0_ff,
+op_4430_0_ff,
+op_4438_0_ff,
+op_4439_0_ff,
+op_4440_0_ff,
+op_4450_0_ff,
+op_4458_0_ff,
+op_4460_0_ff,
+op_4468_0_ff,
+op_4470_0_ff,
+op_4478_0_ff,
+op_4479_0_ff,
+op_4480_0_ff,
+op_4490_0_ff,
+op_4498_0_ff,
+op_44a0_0_ff,
+op_44a8_0_ff,
+op_44b0_0_ff,
+op_44b8_0_ff,
+op_44b9_0_ff,
+op_44c0_0_ff,
+op_44d0_0_ff,
+op_44d8_0_ff,
+op_44e0_0_ff,
+op_44e8_0_ff,
+op_44f0_0_ff,
+op_44f8_0_ff,
+op_44f9_0_ff,
+op_44fa_0_ff,
+op_44fb_0_ff,
+op_44fc_0_ff,
+op_4600_0_ff,
+op_4610_0_ff,
+op_4618_0_ff,
+op_4620_0_ff,
+op_4628_0_ff,
+op_4630_0_ff,
+op_4638_0_ff,
+op_4639_0_ff,
+op_4640_0_ff,
+op_4650_0_ff,
+op_4658_0_ff,
+op_4660_0_ff,
+op_4668_0_ff,
+op_4670_0_ff,
+op_4678_0_ff,
+op_4679_0_ff,
+op_4680_0_ff,
+op_4690_0_ff,
+op_4698_0_ff,
+op_46a0_0_ff,
+op_46a8_0_ff,
+op_46b0_0_ff,
+op_46b8_0_ff,
+op_46b9_0_ff,
+op_46c0_0_ff,
+op_46d0_0_ff,
+op_46d8_0_ff,
+op_46e0_0_ff,
+op_46e8_0_ff,
+op_46f0_0_ff,
+op_46f8_0_ff,
+op_46f9_0_ff,
+op_46fa_0_ff,
+op_46fb_0_ff,
+op_46fc_0_ff,
+op_4800_0_ff,
+op_4808_0_ff,
+op_4810_0_ff,
+op_4818_0_ff,
+op_4820_0_ff,
+op_4828_0_ff,
+op_4830_0_ff,
+op_4838_0_ff,
+op_4839_0_ff,
+op_4840_0_ff,
+op_4848_0_ff,
+op_4850_0_ff,
+op_4868_0_ff,
+op_4870_0_ff,
+op_4878_0_ff,
+op_4879_0_ff,
+op_487a_0_ff,
+op_487b_0_ff,
+op_4880_0_ff,
+op_4890_0_ff,
+op_48a0_0_ff,
+op_48a8_0_ff,
+op_48b0_0_ff,
+op_48b8_0_ff,
+op_48b9_0_ff,
+op_48c0_0_ff,
+op_48d0_0_ff,
+op_48e0_0_ff,
+op_48e8_0_ff,
+op_48f0_0_ff,
+op_48f8_0_ff,
+op_48f9_0_ff,
+op_49c0_0_ff,
+op_4a00_0_ff,
+op_4a10_0_ff,
+op_4a18_0_ff,
+op_4a20_0_ff,
+op_4a28_0_ff,
+op_4a30_0_ff,
+op_4a38_0_ff,
+op_4a39_0_ff,
+op_4a3a_0_ff,
+op_4a3b_0_ff,
+op_4a3c_0_ff,
+op_4a40_0_ff,
+op_4a48_0_ff,
+op_4a50_0_ff,
+op_4a58_0_ff,
+op_4a60_0_ff,
+op_4a68_0_ff,
+op_4a70_0_ff,
+op_4a78_0_ff,
+op_4a79_0_ff,
+op_4a7a_0_ff,
+op_4a7b_0_ff,
+op_4a7c_0_ff,
+op_4a80_0_ff,
+op_4a88_0_ff,
+op_4a90_0_ff,
+op_4a98_0_ff,
+op_4aa0_0_ff,
+op_4aa8_0_ff,
+op_4ab0_0_ff,
+op_4ab8_0_ff,
+op_4ab9_0_ff,
+op_4aba_0_ff,
+op_4abb_0_ff,
+op_4abc_0_ff,
+op_4ac0_0_ff,
+op_4ad0_0_ff,
+op_4ad8_0_ff,
+op_4ae0_0_ff,
+op_4ae8_0_ff,
+op_4af0_0_ff,
+op_4af8_0_ff,
+op_4af9_0_ff,
+op_4c00_0_ff,
+op_4c10_0_ff,
+op_4c18_0_ff,
+op_4c20_0_ff,
+op_4c28_0_ff,
+op_4c30_0_ff,
+op_4c38_0_ff,
+op_4c39_0_ff,
+op_4c3a_0_ff,
+op_4c3b_0_ff,
+op_4c3c_0_ff,
+op_4c40_0_ff,
+op_4c50_0_ff,
+op_4c58_0_ff,
+op_4c60_0_ff,
+op_4c68_0_ff,
+op_4c70_0_ff,
+op_4c78_0_ff,
+op_4c79_0_ff,
+op_4c7a_0_ff,
+op_4c7b_0_ff,
+op_4c7c_0_ff,
+op_4c90_0_ff,
+op_4c98_0_ff,
+op_4ca8_0_ff,
+op_4cb0_0_ff,
+op_4cb8_0_ff,
+op_4cb9_0_ff,
+op_4cba_0_ff,
+op_4cbb_0_ff,
+op_4cd0_0_ff,
+op_4cd8_0_ff,
+op_4ce8_0_ff,
+op_4cf0_0_ff,
+op_4cf8_0_ff,
+op_4cf9_0_ff,
+op_4cfa_0_ff,
+op_4cfb_0_ff,
+op_4e40_0_ff,
+op_4e50_0_ff,
+op_4e58_0_ff,
+op_4e60_0_ff,
+op_4e68_0_ff,
+op_4e70_0_ff,
+op_4e71_0_ff,
+op_4e72_0_ff,
+op_4e73_0_ff,
+op_4e74_0_ff,
+op_4e75_0_ff,
+op_4e76_0_ff,
+op_4e77_0_ff,
+op_4e7a_0_ff,
+op_4e7b_0_ff,
+op_4e90_0_ff,
+op_4ea8_0_ff,
+op_4eb0_0_ff,
+op_4eb8_0_ff,
+op_4eb9_0_ff,
+op_4eba_0_ff,
+op_4ebb_0_ff,
+op_4ed0_0_ff,
+op_4ee8_0_ff,
+op_4ef0_0_ff,
+op_4ef8_0_ff,
+op_4ef9_0_ff,
+op_4efa_0_ff,
+op_4efb_0_ff,
+op_5000_0_ff,
+op_5010_0_ff,
+op_5018_0_ff,
+op_5020_0_ff,
+op_5028_0_ff,
+op_5030_0_ff,
+op_5038_0_ff,
+op_5039_0_ff,
+op_5040_0_ff,
+op_5048_0_ff,
+op_5050_0_ff,
+op_5058_0_ff,
+op_5060_0_ff,
+op_5068_0_ff,
+op_5070_0_ff,
+op_5078_0_ff,
+op_5079_0_ff,
+op_5080_0_ff,
+op_5088_0_ff,
+op_5090_0_ff,
+op_5098_0_ff,
+op_50a0_0_ff,
+op_50a8_0_ff,
+op_50b0_0_ff,
+op_50b8_0_ff,
+op_50b9_0_ff,
+op_50c0_0_ff,
+op_50c8_0_ff,
+op_50d0_0_ff,
+op_50d8_0_ff,
+op_50e0_0_ff,
+op_50e8_0_ff,
+op_50f0_0_ff,
+op_50f8_0_ff,
+op_50f9_0_ff,
+op_50fa_0_ff,
+op_50fb_0_ff,
+op_50fc_0_ff,
+op_5100_0_ff,
+op_5110_0_ff,
+op_5118_0_ff,
+op_5120_0_ff,
+op_5128_0_ff,
+op_5130_0_ff,
+op_5138_0_ff,
+op_5139_0_ff,
+op_5140_0_ff,
+op_5148_0_ff,
+op_5150_0_ff,
+op_5158_0_ff,
+op_5160_0_ff,
+op_5168_0_ff,
+op_5170_0_ff,
+op_5178_0_ff,
+op_5179_0_ff,
+op_5180_0_ff,
+op_5188_0_ff,
+op_5190_0_ff,
+op_5198_0_ff,
+op_51a0_0_ff,
+op_51a8_0_ff,
+op_51b0_0_ff,
+op_51b8_0_ff,
+op_51b9_0_ff,
+op_51c0_0_ff,
+op_51c8_0_ff,
+op_51d0_0_ff,
+op_51d8_0_ff,
+op_51e0_0_ff,
+op_51e8_0_ff,
+op_51f0_0_ff,
+op_51f8_0_ff,
+op_51f9_0_ff,
+op_51fa_0_ff,
+op_51fb_0_ff,
+op_51fc_0_ff,
+op_52c0_0_ff,
+op_52c8_0_ff,
+op_52d0_0_ff,
+op_52d8_0_ff,
+op_52e0_0_ff,
+op_52e8_0_ff,
+op_52f0_0_ff,
+op_52f8_0_ff,
+op_52f9_0_ff,
+op_52fa_0_ff,
+op_52fb_0_ff,
+op_52fc_0_ff,
+op_53c0_0_ff,
+op_53c8_0_ff,
+op_53d0_0_ff,
+op_53d8_0_ff,
+op_53e0_0_ff,
+op_53e8_0_ff,
+op_53f0_0_ff,
+op_53f8_0_ff,
+op_53f9_0_ff,
+op_53fa_0_ff,
+op_53fb_0_ff,
+op_53fc_0_ff,
+op_54c0_0_ff,
+op_54c8_0_ff,
+op_54d0_0_ff,
+op_54d8_0_ff,
+op_54e0_0_ff,
+op_54e8_0_ff,
+op_54f0_0_ff,
+op_54f8_0_ff,
+op_54f9_0_ff,
+op_54fa_0_ff,
+op_54fb_0_ff,
+op_54fc_0_ff,
+op_55c0_0_ff,
+op_55c8_0_ff,
+op_55d0_0_ff,
+op_55d8_0_ff,
+op_55e0_0_ff,
+op_55e8_0_ff,
+op_55f0_0_ff,
+op_55f8_0_ff,
+op_55f9_0_ff,
+op_55fa_0_ff,
+op_55fb_0_ff,
+op_55fc_0_ff,
+op_56c0_0_ff,
+op_56c8_0_ff,
+op_56d0_0_ff,
+op_56d8_0_ff,
+op_56e0_0_ff,
+op_56e8_0_ff,
+op_56f0_0_ff,
+op_56f8_0_ff,
+op_56f9_0_ff,
+op_56fa_0_ff,
+op_56fb_0_ff,
+op_56fc_0_ff,
+op_57c0_0_ff,
+op_57c8_0_ff,
+op_57d0_0_ff,
+op_57d8_0_ff,
+op_57e0_0_ff,
+op_57e8_0_ff,
+op_57f0_0_ff,
+op_57f8_0_ff,
+op_57f9_0_ff,
+op_57fa_0_ff,
+op_57fb_0_ff,
+op_57fc_0_ff,
+op_58c0_0_ff,
+op_58c8_0_ff,
+op_58d0_0_ff,
+op_58d8_0_ff,
+op_58e0_0_ff,
+op_58e8_0_ff,
+op_58f0_0_ff,
+op_58f8_0_ff,
+op_58f9_0_ff,
+op_58fa_0_ff,
+op_58fb_0_ff,
+op_58fc_0_ff,
+op_59c0_0_ff,
+op_59c8_0_ff,
+op_59d0_0_ff,
+op_59d8_0_ff,
+op_59e0_0_ff,
+op_59e8_0_ff,
+op_59f0_0_ff,
+op_59f8_0_ff,
+op_59f9_0_ff,
+op_59fa_0_ff,
+op_59fb_0_ff,
+op_59fc_0_ff,
+op_5ac0_0_ff,
+op_5ac8_0_ff,
+op_5ad0_0_ff,
+op_5ad8_0_ff,
+op_5ae0_0_ff,
+op_5ae8_0_ff,
+op_5af0_0_ff,
+op_5af8_0_ff,
+op_5af9_0_ff,
+op_5afa_0_ff,
+op_5afb_0_ff,
+op_5afc_0_ff,
+op_5bc0_0_ff,
+op_5bc8_0_ff,
+op_5bd0_0_ff,
+op_5bd8_0_ff,
+op_5be0_0_ff,
+op_5be8_0_ff,
+op_5bf0_0_ff,
+op_5bf8_0_ff,
+op_5bf9_0_ff,
+op_5bfa_0_ff,
+op_5bfb_0_ff,
+op_5bfc_0_ff,
+op_5cc0_0_ff,
+op_5cc8_0_ff,
+op_5cd0_0_ff,
+op_5cd8_0_ff,
+op_5ce0_0_ff,
+op_5ce8_0_ff,
+op_5cf0_0_ff,
+op_5cf8_0_ff,
+op_5cf9_0_ff,
+op_5cfa_0_ff,
+op_5cfb_0_ff,
+op_5cfc_0_ff,
+op_5dc0_0_ff,
+op_5dc8_0_ff,
+op_5dd0_0_ff,
+op_5dd8_0_ff,
+op_5de0_0_ff,
+op_5de8_0_ff,
+op_5df0_0_ff,
+op_5df8_0_ff,
+op_5df9_0_ff,
+op_5dfa_0_ff,
+op_5dfb_0_ff,
+op_5dfc_0_ff,
+op_5ec0_0_ff,
+op_5ec8_0_ff,
+op_5ed0_0_ff,
+op_5ed8_0_ff,
+op_5ee0_0_ff,
+op_5ee8_0_ff,
+op_5ef0_0_ff,
+op_5ef8_0_ff,
+op_5ef9_0_ff,
+op_5efa_0_ff,
+op_5efb_0_ff,
+op_5efc_0_ff,
+op_5fc0_0_ff,
+op_5fc8_0_ff,
+op_5fd0_0_ff,
+op_5fd8_0_ff,
+op_5fe0_0_ff,
+op_5fe8_0_ff,
+op_5ff0_0_ff,
+op_5ff8_0_ff,
+op_5ff9_0_ff,
+op_5ffa_0_ff,
+op_5ffb_0_ff,
+op_5ffc_0_ff,
+op_6000_0_ff,
+op_6001_0_ff,
+op_60ff_0_ff,
+op_6100_0_ff,
+op_6101_0_ff,
+op_61ff_0_ff,
+op_6200_0_ff,
+op_6201_0_ff,
+op_62ff_0_ff,
+op_6300_0_ff,
+op_6301_0_ff,
+op_63ff_0_ff,
+op_6400_0_ff,
+op_6401_0_ff,
+op_64ff_0_ff,
+op_6500_0_ff,
+op_6501_0_ff,
+op_65ff_0_ff,
+op_6600_0_ff,
+op_6601_0_ff,
+op_66ff_0_ff,
+op_6700_0_ff,
+op_6701_0_ff,
+op_67ff_0_ff,
+op_6800_0_ff,
+op_6801_0_ff,
+op_68ff_0_ff,
+op_6900_0_ff,
+op_6901_0_ff,
+op_69ff_0_ff,
+op_6a00_0_ff,
+op_6a01_0_ff,
+op_6aff_0_ff,
+op_6b00_0_ff,
+op_6b01_0_ff,
+op_6bff_0_ff,
+op_6c00_0_ff,
+op_6c01_0_ff,
+op_6cff_0_ff,
+op_6d00_0_ff,
+op_6d01_0_ff,
+op_6dff_0_ff,
+op_6e00_0_ff,
+op_6e01_0_ff,
+op_6eff_0_ff,
+op_6f00_0_ff,
+op_6f01_0_ff,
+op_6fff_0_ff,
+op_7000_0_ff,
+op_7100_0_ff,
+op_7101_0_ff,
+op_8000_0_ff,
+op_8010_0_ff,
+op_8018_0_ff,
+op_8020_0_ff,
+op_8028_0_ff,
+op_8030_0_ff,
+op_8038_0_ff,
+op_8039_0_ff,
+op_803a_0_ff,
+op_803b_0_ff,
+op_803c_0_ff,
+op_8040_0_ff,
+op_8050_0_ff,
+op_8058_0_ff,
+op_8060_0_ff,
+op_8068_0_ff,
+op_8070_0_ff,
+op_8078_0_ff,
+op_8079_0_ff,
+op_807a_0_ff,
+op_807b_0_ff,
+op_807c_0_ff,
+op_8080_0_ff,
+op_8090_0_ff,
+op_8098_0_ff,
+op_80a0_0_ff,
+op_80a8_0_ff,
+op_80b0_0_ff,
+op_80b8_0_ff,
+op_80b9_0_ff,
+op_80ba_0_ff,
+op_80bb_0_ff,
+op_80bc_0_ff,
+op_80c0_0_ff,
+op_80d0_0_ff,
+op_80d8_0_ff,
+op_80e0_0_ff,
+op_80e8_0_ff,
+op_80f0_0_ff,
+op_80f8_0_ff,
+op_80f9_0_ff,
+op_80fa_0_ff,
+op_80fb_0_ff,
+op_80fc_0_ff,
+op_8100_0_ff,
+op_8108_0_ff,
+op_8110_0_ff,
+op_8118_0_ff,
+op_8120_0_ff,
+op_8128_0_ff,
+op_8130_0_ff,
+op_8138_0_ff,
+op_8139_0_ff,
+op_8140_0_ff,
+op_8148_0_ff,
+op_8150_0_ff,
+op_8158_0_ff,
+op_8160_0_ff,
+op_8168_0_ff,
+op_8170_0_ff,
+op_8178_0_ff,
+op_8179_0_ff,
+op_8180_0_ff,
+op_8188_0_ff,
+op_8190_0_ff,
+op_8198_0_ff,
+op_81a0_0_ff,
+op_81a8_0_ff,
+op_81b0_0_ff,
+op_81b8_0_ff,
+op_81b9_0_ff,
+op_81c0_0_ff,
+op_81d0_0_ff,
+op_81d8_0_ff,
+op_81e0_0_ff,
+op_81e8_0_ff,
+op_81f0_0_ff,
+op_81f8_0_ff,
+op_81f9_0_ff,
+op_81fa_0_ff,
+op_81fb_0_ff,
+op_81fc_0_ff,
+op_9000_0_ff,
+op_9010_0_ff,
+op_9018_0_ff,
+op_9020_0_ff,
+op_9028_0_ff,
+op_9030_0_ff,
+op_9038_0_ff,
+op_9039_0_ff,
+op_903a_0_ff,
+op_903b_0_ff,
+op_903c_0_ff,
+op_9040_0_ff,
+op_9048_0_ff,
+op_9050_0_ff,
+op_9058_0_ff,
+op_9060_0_ff,
+op_9068_0_ff,
+op_9070_0_ff,
+op_9078_0_ff,
+op_9079_0_ff,
+op_907a_0_ff,
+op_907b_0_ff,
+op_907c_0_ff,
+op_9080_0_ff,
+op_9088_0_ff,
+op_9090_0_ff,
+op_9098_0_ff,
+op_90a0_0_ff,
+op_90a8_0_ff,
+op_90b0_0_ff,
+op_90b8_0_ff,
+op_90b9_0_ff,
+op_90ba_0_ff,
+op_90bb_0_ff,
+op_90bc_0_ff,
+op_90c0_0_ff,
+op_90c8_0_ff,
+op_90d0_0_ff,
+op_90d8_0_ff,
+op_90e0_0_ff,
+op_90e8_0_ff,
+op_90f0_0_ff,
+op_90f8_0_ff,
+op_90f9_0_ff,
+op_90fa_0_ff,
+op_90fb_0_ff,
+op_90fc_0_ff,
+op_9100_0_ff,
+op_9108_0_ff,
+op_9110_0_ff,
+op_9118_0_ff,
+op_9120_0_ff,
+op_9128_0_ff,
+op_9130_0_ff,
+op_9138_0_ff,
+op_9139_0_ff,
+op_9140_0_ff,
+op_9148_0_ff,
+op_9150_0_ff,
+op_9158_0_ff,
+op_9160_0_ff,
+op_9168_0_ff,
+op_9170_0_ff,
+op_9178_0_ff,
+op_9179_0_ff,
+op_9180_0_ff,
+op_9188_0_ff,
+op_9190_0_ff,
+op_9198_0_ff,
+op_91a0_0_ff,
+op_91a8_0_ff,
+op_91b0_0_ff,
+op_91b8_0_ff,
+op_91b9_0_ff,
+op_91c0_0_ff,
+op_91c8_0_ff,
+op_91d0_0_ff,
+op_91d8_0_ff,
+op_91e0_0_ff,
+op_91e8_0_ff,
+op_91f0_0_ff,
+op_91f8_0_ff,
+op_91f9_0_ff,
+op_91fa_0_ff,
+op_91fb_0_ff,
+op_91fc_0_ff,
+op_b000_0_ff,
+op_b010_0_ff,
+op_b018_0_ff,
+op_b020_0_ff,
+op_b028_0_ff,
+op_b030_0_ff,
+op_b038_0_ff,
+op_b039_0_ff,
+op_b03a_0_ff,
+op_b03b_0_ff,
+op_b03c_0_ff,
+op_b040_0_ff,
+op_b048_0_ff,
+op_b050_0_ff,
+op_b058_0_ff,
+op_b060_0_ff,
+op_b068_0_ff,
+op_b070_0_ff,
+op_b078_0_ff,
+op_b079_0_ff,
+op_b07a_0_ff,
+op_b07b_0_ff,
+op_b07c_0_ff,
+op_b080_0_ff,
+op_b088_0_ff,
+op_b090_0_ff,
+op_b098_0_ff,
+op_b0a0_0_ff,
+op_b0a8_0_ff,
+op_b0b0_0_ff,
+op_b0b8_0_ff,
+op_b0b9_0_ff,
+op_b0ba_0_ff,
+op_b0bb_0_ff,
+op_b0bc_0_ff,
+op_b0c0_0_ff,
+op_b0c8_0_ff,
+op_b0d0_0_ff,
+op_b0d8_0_ff,
+op_b0e0_0_ff,
+op_b0e8_0_ff,
+op_b0f0_0_ff,
+op_b0f8_0_ff,
+op_b0f9_0_ff,
+op_b0fa_0_ff,
+op_b0fb_0_ff,
+op_b0fc_0_ff,
+op_b100_0_ff,
+op_b108_0_ff,
+op_b110_0_ff,
+op_b118_0_ff,
+op_b120_0_ff,
+op_b128_0_ff,
+op_b130_0_ff,
+op_b138_0_ff,
+op_b139_0_ff,
+op_b140_0_ff,
+op_b148_0_ff,
+op_b150_0_ff,
+op_b158_0_ff,
+op_b160_0_ff,
+op_b168_0_ff,
+op_b170_0_ff,
+op_b178_0_ff,
+op_b179_0_ff,
+op_b180_0_ff,
+op_b188_0_ff,
+op_b190_0_ff,
+op_b198_0_ff,
+op_b1a0_0_ff,
+op_b1a8_0_ff,
+op_b1b0_0_ff,
+op_b1b8_0_ff,
+op_b1b9_0_ff,
+op_b1c0_0_ff,
+op_b1c8_0_ff,
+op_b1d0_0_ff,
+op_b1d8_0_ff,
+op_b1e0_0_ff,
+op_b1e8_0_ff,
+op_b1f0_0_ff,
+op_b1f8_0_ff,
+op_b1f9_0_ff,
+op_b1fa_0_ff,
+op_b1fb_0_ff,
+op_b1fc_0_ff,
+op_c000_0_ff,
+op_c010_0_ff,
+op_c018_0_ff,
+op_c020_0_ff,
+op_c028_0_ff,
+op_c030_0_ff,
+op_c038_0_ff,
+op_c039_0_ff,
+op_c03a_0_ff,
+op_c03b_0_ff,
+op_c03c_0_ff,
+op_c040_0_ff,
+op_c050_0_ff,
+op_c058_0_ff,
+op_c060_0_ff,
+op_c068_0_ff,
+op_c070_0_ff,
+op_c078_0_ff,
+op_c079_0_ff,
+op_c07a_0_ff,
+op_c07b_0_ff,
+op_c07c_0_ff,
+op_c080_0_ff,
+op_c090_0_ff,
+op_c098_0_ff,
+op_c0a0_0_ff,
+op_c0a8_0_ff,
+op_c0b0_0_ff,
+op_c0b8_0_ff,
+op_c0b9_0_ff,
+op_c0ba_0_ff,
+op_c0bb_0_ff,
+op_c0bc_0_ff,
+op_c0c0_0_ff,
+op_c0d0_0_ff,
+op_c0d8_0_ff,
+op_c0e0_0_ff,
+op_c0e8_0_ff,
+op_c0f0_0_ff,
+op_c0f8_0_ff,
+op_c0f9_0_ff,
+op_c0fa_0_ff,
+op_c0fb_0_ff,
+op_c0fc_0_ff,
+op_c100_0_ff,
+op_c108_0_ff,
+op_c110_0_ff,
+op_c118_0_ff,
+op_c120_0_ff,
+op_c128_0_ff,
+op_c130_0_ff,
+op_c138_0_ff,
+op_c139_0_ff,
+op_c140_0_ff,
+op_c148_0_ff,
+op_c150_0_ff,
+op_c158_0_ff,
+op_c160_0_ff,
+op_c168_0_ff,
+op_c170_0_ff,
+op_c178_0_ff,
+op_c179_0_ff,
+op_c188_0_ff,
+op_c190_0_ff,
+op_c198_0_ff,
+op_c1a0_0_ff,
+op_c1a8_0_ff,
+op_c1b0_0_ff,
+op_c1b8_0_ff,
+op_c1b9_0_ff,
+op_c1c0_0_ff,
+op_c1d0_0_ff,
+op_c1d8_0_ff,
+op_c1e0_0_ff,
+op_c1e8_0_ff,
+op_c1f0_0_ff,
+op_c1f8_0_ff,
+op_c1f9_0_ff,
+op_c1fa_0_ff,
+op_c1fb_0_ff,
+op_c1fc_0_ff,
+op_d000_0_ff,
+op_d010_0_ff,
+op_d018_0_ff,
+op_d020_0_ff,
+op_d028_0_ff,
+op_d030_0_ff,
+op_d038_0_ff,
+op_d039_0_ff,
+op_d03a_0_ff,
+op_d03b_0_ff,
+op_d03c_0_ff,
+op_d040_0_ff,
+op_d048_0_ff,
+op_d050_0_ff,
+op_d058_0_ff,
+op_d060_0_ff,
+op_d068_0_ff,
+op_d070_0_ff,
+op_d078_0_ff,
+op_d079_0_ff,
+op_d07a_0_ff,
+op_d07b_0_ff,
+op_d07c_0_ff,
+op_d080_0_ff,
+op_d088_0_ff,
+op_d090_0_ff,
+op_d098_0_ff,
+op_d0a0_0_ff,
+op_d0a8_0_ff,
+op_d0b0_0_ff,
+op_d0b8_0_ff,
+op_d0b9_0_ff,
+op_d0ba_0_ff,
+op_d0bb_0_ff,
+op_d0bc_0_ff,
+op_d0c0_0_ff,
+op_d0c8_0_ff,
+op_d0d0_0_ff,
+op_d0d8_0_ff,
+op_d0e0_0_ff,
+op_d0e8_0_ff,
+op_d0f0_0_ff,
+op_d0f8_0_ff,
+op_d0f9_0_ff,
+op_d0fa_0_ff,
+op_d0fb_0_ff,
+op_d0fc_0_ff,
+op_d100_0_ff,
+op_d108_0_ff,
+op_d110_0_ff,
+op_d118_0_ff,
+op_d120_0_ff,
+op_d128_0_ff,
+op_d130_0_ff,
+op_d138_0_ff,
+op_d139_0_ff,
+op_d140_0_ff,
+op_d148_0_ff,
+op_d150_0_ff,
+op_d158_0_ff,
+op_d160_0_ff,
+op_d168_0_ff,
+op_d170_0_ff,
+op_d178_0_ff,
+op_d179_0_ff,
+op_d180_0_ff,
+op_d188_0_ff,
+op_d190_0_ff,
+op_d198_0_ff,
+op_d1a0_0_ff,
+op_d1a8_0_ff,
+op_d1b0_0_ff,
+op_d1b8_0_ff,
+op_d1b9_0_ff,
+op_d1c0_0_ff,
+op_d1c8_0_ff,
+op_d1d0_0_ff,
+op_d1d8_0_ff,
+op_d1e0_0_ff,
+op_d1e8_0_ff,
+op_d1f0_0_ff,
+op_d1f8_0_ff,
+op_d1f9_0_ff,
+op_d1fa_0_ff,
+op_d1fb_0_ff,
+op_d1fc_0_ff,
+op_e000_0_ff,
+op_e008_0_ff,
+op_e010_0_ff,
+op_e018_0_ff,
+op_e020_0_ff,
+op_e028_0_ff,
+op_e030_0_ff,
+op_e038_0_ff,
+op_e040_0_ff,
+op_e048_0_ff,
+op_e050_0_ff,
+op_e058_0_ff,
+op_e060_0_ff,
+op_e068_0_ff,
+op_e070_0_ff,
+op_e078_0_ff,
+op_e080_0_ff,
+op_e088_0_ff,
+op_e090_0_ff,
+op_e098_0_ff,
+op_e0a0_0_ff,
+op_e0a8_0_ff,
+op_e0b0_0_ff,
+op_e0b8_0_ff,
+op_e0d0_0_ff,
+op_e0d8_0_ff,
+op_e0e0_0_ff,
+op_e0e8_0_ff,
+op_e0f0_0_ff,
+op_e0f8_0_ff,
+op_e0f9_0_ff,
+op_e100_0_ff,
+op_e108_0_ff,
+op_e110_0_ff,
+op_e118_0_ff,
+op_e120_0_ff,
+op_e128_0_ff,
+op_e130_0_ff,
+op_e138_0_ff,
+op_e140_0_ff,
+op_e148_0_ff,
+op_e150_0_ff,
+op_e158_0_ff,
+op_e160_0_ff,
+op_e168_0_ff,
+op_e170_0_ff,
+op_e178_0_ff,
+op_e180_0_ff,
+op_e188_0_ff,
+op_e190_0_ff,
+op_e198_0_ff,
+op_e1a0_0_ff,
+op_e1a8_0_ff,
+op_e1b0_0_ff,
+op_e1b8_0_ff,
+op_e1d0_0_ff,
+op_e1d8_0_ff,
+op_e1e0_0_ff,
+op_e1e8_0_ff,
+op_e1f0_0_ff,
+op_e1f8_0_ff,
+op_e1f9_0_ff,
+op_e2d0_0_ff,
+op_e2d8_0_ff,
+op_e2e0_0_ff,
+op_e2e8_0_ff,
+op_e2f0_0_ff,
+op_e2f8_0_ff,
+op_e2f9_0_ff,
+op_e3d0_0_ff,
+op_e3d8_0_ff,
+op_e3e0_0_ff,
+op_e3e8_0_ff,
+op_e3f0_0_ff,
+op_e3f8_0_ff,
+op_e3f9_0_ff,
+op_e4d0_0_ff,
+op_e4d8_0_ff,
+op_e4e0_0_ff,
+op_e4e8_0_ff,
+op_e4f0_0_ff,
+op_e4f8_0_ff,
+op_e4f9_0_ff,
+op_e5d0_0_ff,
+op_e5d8_0_ff,
+op_e5e0_0_ff,
+op_e5e8_0_ff,
+op_e5f0_0_ff,
+op_e5f8_0_ff,
+op_e5f9_0_ff,
+op_e6d0_0_ff,
+op_e6d8_0_ff,
+op_e6e0_0_ff,
+op_e6e8_0_ff,
+op_e6f0_0_ff,
+op_e6f8_0_ff,
+op_e6f9_0_ff,
+op_e7d0_0_ff,
+op_e7d8_0_ff,
+op_e7e0_0_ff,
+op_e7e8_0_ff,
+op_e7f0_0_ff,
+op_e7f8_0_ff,
+op_e7f9_0_ff,
+op_e8c0_0_ff,
+op_e8d0_0_ff,
+op_e8e8_0_ff,
+op_e8f0_0_ff,
+op_e8f8_0_ff,
+op_e8f9_0_ff,
+op_e8fa_0_ff,
+op_e8fb_0_ff,
+op_e9c0_0_ff,
+op_e9d0_0_ff,
+op_e9e8_0_ff,
+op_e9f0_0_ff,
+op_e9f8_0_ff,
+op_e9f9_0_ff,
+op_e9fa_0_ff,
+op_e9fb_0_ff,
+op_eac0_0_ff,
+op_ead0_0_ff,
+op_eae8_0_ff,
+op_eaf0_0_ff,
+op_eaf8_0_ff,
+op_eaf9_0_ff,
+op_ebc0_0_ff,
+op_ebd0_0_ff,
+op_ebe8_0_ff,
+op_ebf0_0_ff,
+op_ebf8_0_ff,
+op_ebf9_0_ff,
+op_ebfa_0_ff,
+op_ebfb_0_ff,
+op_ecc0_0_ff,
+op_ecd0_0_ff,
+op_ece8_0_ff,
+op_ecf0_0_ff,
+op_ecf8_0_ff,
+op_ecf9_0_ff,
+op_edc0_0_ff,
+op_edd0_0_ff,
+op_ede8_0_ff,
+op_edf0_0_ff,
+op_edf8_0_ff,
+op_edf9_0_ff,
+op_edfa_0_ff,
+op_edfb_0_ff,
+op_eec0_0_ff,
+op_eed0_0_ff,
+op_eee8_0_ff,
+op_eef0_0_ff,
+op_eef8_0_ff,
+op_eef9_0_ff,
+op_efc0_0_ff,
+op_efd0_0_ff,
+op_efe8_0_ff,
+op_eff0_0_ff,
+op_eff8_0_ff,
+op_eff9_0_ff,
+op_f200_0_ff,
+op_f208_0_ff,
+op_f210_0_ff,
+op_f218_0_ff,
+op_f220_0_ff,
+op_f228_0_ff,
+op_f230_0_ff,
+op_f238_0_ff,
+op_f239_0_ff,
+op_f23a_0_ff,
+op_f23b_0_ff,
+op_f23c_0_ff,
+op_f240_0_ff,
+op_f248_0_ff,
+op_f250_0_ff,
+op_f258_0_ff,
+op_f260_0_ff,
+op_f268_0_ff,
+op_f270_0_ff,
+op_f278_0_ff,
+op_f279_0_ff,
+op_f27a_0_ff,
+op_f27b_0_ff,
+op_f27c_0_ff,
+op_f280_0_ff,
+op_f2c0_0_ff,
+op_f310_0_ff,
+op_f320_0_ff,
+op_f328_0_ff,
+op_f330_0_ff,
+op_f338_0_ff,
+op_f339_0_ff,
+op_f350_0_ff,
+op_f358_0_ff,
+op_f368_0_ff,
+op_f370_0_ff,
+op_f378_0_ff,
+op_f379_0_ff,
+op_f37a_0_ff,
+op_f37b_0_ff,
+op_f408_0_ff,
+op_f410_0_ff,
+op_f418_0_ff,
+op_f419_0_ff,
+op_f41a_0_ff,
+op_f41b_0_ff,
+op_f41c_0_ff,
+op_f41d_0_ff,
+op_f41e_0_ff,
+op_f41f_0_ff,
+op_f428_0_ff,
+op_f430_0_ff,
+op_f438_0_ff,
+op_f439_0_ff,
+op_f43a_0_ff,
+op_f43b_0_ff,
+op_f43c_0_ff,
+op_f43d_0_ff,
+op_f43e_0_ff,
+op_f43f_0_ff,
+op_f500_0_ff,
+op_f600_0_ff,
+op_f608_0_ff,
+op_f610_0_ff,
+op_f618_0_ff,
+op_f620_0_ff,
+};
+static const uae_u16 op_dispatch_pages_0[] = {
+1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,6,7,8,0,0,9,0,0,0,
+10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,
+11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,
+13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,
+15,15,15,15,15,15,15,15,16,17,0,0,18,0,0,0,
+19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,
+20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,
+22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,
+24,24,24,24,24,24,24,24,25,26,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+27,27,27,27,27,27,27,27,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,28,28,28,28,28,28,28,28,
+29,29,29,29,29,29,29,29,30,31,32,33,0,0,0,0,
+34,34,34,34,34,34,34,34,35,35,35,35,35,35,35,35,
+36,36,36,36,36,36,36,36,37,37,37,37,37,37,37,37,
+38,38,38,38,38,38,38,38,39,39,39,39,39,39,39,39,
+40,40,40,40,40,40,40,40,41,42,43,44,45,0,0,0,
+46,46,46,46,46,46,46,46,47,47,47,47,47,47,47,47,
+48,48,48,48,48,48,48,48,49,49,49,49,49,49,49,49,
+50,50,50,50,50,50,50,50,51,51,51,51,51,51,51,51,
+52,52,52,52,52,52,52,52,53,54,55,56,0,0,0,0,
+57,57,57,57,57,57,57,57,58,58,58,58,58,58,58,58,
+59,59,59,59,59,59,59,59,60,60,60,60,60,60,60,60,
+61,61,61,61,61,61,61,61,62,62,62,62,62,62,62,62,
+63,63,63,63,63,63,63,63,64,65,66,67,0,0,0,0,
+68,68,68,68,68,68,68,68,69,69,69,69,69,69,69,69,
+70,70,70,70,70,70,70,70,71,71,71,71,71,71,71,71,
+72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,
+74,74,74,74,74,74,74,74,75,76,77,78,0,0,0,0,
+79,79,79,79,79,79,79,79,0,0,0,0,0,0,0,0,
+80,80,80,80,80,80,80,80,81,81,81,81,81,81,81,81,
+82,82,82,82,82,82,82,82,83,83,83,83,83,83,83,83,
+84,84,84,84,84,84,84,84,85,86,0,0,87,0,0,0,
+88,88,88,88,88,88,88,88,0,0,0,0,0,0,0,0,
+89,89,89,89,89,89,89,89,90,90,90,90,90,90,90,90,
+91,91,91,91,91,91,91,91,92,92,92,92,92,92,92,92,
+93,93,93,93,93,93,93,93,94,95,0,0,96,0,0,0,
+97,97,97,97,97,97,97,97,0,0,0,0,0,0,0,0,
+98,98,98,98,98,98,98,98,99,99,99,99,99,99,99,99,
+100,100,100,100,100,100,100,100,101,101,101,101,101,101,101,101,
+102,102,102,102,102,102,102,102,103,104,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+105,105,105,105,105,105,105,105,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,106,106,106,106,106,106,106,106,
+107,107,107,107,107,107,107,107,108,109,110,111,0,0,0,0,
+112,112,112,112,112,112,112,112,0,0,0,0,0,0,0,0,
+113,113,113,113,113,113,113,113,114,114,114,114,114,114,114,114,
+115,115,115,115,115,115,115,115,116,116,116,116,116,116,116,116,
+117,117,117,117,117,117,117,117,118,119,0,0,0,0,0,0,
+120,120,120,120,120,120,120,120,0,0,0,0,0,0,0,0,
+121,121,121,121,121,121,121,121,122,122,122,122,122,122,122,122,
+123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+125,125,125,125,125,125,125,125,126,127,0,0,0,0,0,0,
+128,128,128,128,128,128,128,128,0,0,0,0,0,0,0,0,
+129,129,129,129,129,129,129,129,130,130,130,130,130,130,130,130,
+131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+133,133,133,133,133,133,133,133,134,135,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,136,136,136,136,136,136,136,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,137,137,137,137,137,137,137,137,
+138,138,138,138,138,138,138,138,139,140,141,142,0,0,0,0,
+143,143,143,143,143,143,143,143,0,0,0,0,0,0,0,0,
+144,144,144,144,144,144,144,144,145,145,145,145,145,145,145,145,
+146,146,146,146,146,146,146,146,147,147,147,147,147,147,147,147,
+148,148,148,148,148,148,148,148,149,150,0,0,0,0,0,0,
+151,151,151,151,151,151,151,151,0,0,0,0,0,0,0,0,
+152,152,152,152,152,152,152,152,153,153,153,153,153,153,153,153,
+154,154,154,154,154,154,154,154,155,155,155,155,155,155,155,155,
+156,156,156,156,156,156,156,156,157,158,0,0,0,0,0,0,
+159,159,159,159,159,159,159,159,0,0,0,0,0,0,0,0,
+160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,161,
+162,162,162,162,162,162,162,162,163,163,163,163,163,163,163,163,
+164,164,164,164,164,164,164,164,165,166,0,0,0,0,0,0,
+167,167,167,167,167,167,167,167,168,168,168,168,168,168,168,168,
+169,169,169,169,169,169,169,169,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,170,170,170,170,170,170,170,170,
+171,171,171,171,171,171,171,171,172,173,174,175,0,0,0,0,
+176,176,176,176,176,176,176,176,0,0,0,0,0,0,0,0,
+177,177,177,177,177,177,177,177,178,178,178,178,178,178,178,178,
+179,179,179,179,179,179,179,179,180,180,180,180,180,180,180,180,
+181,181,181,181,181,181,181,181,182,183,184,185,186,0,0,0,
+187,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,
+188,188,188,188,188,188,188,188,189,189,189,189,189,189,189,189,
+190,190,190,190,190,190,190,190,191,191,191,191,191,191,191,191,
+192,192,192,192,192,192,192,192,193,194,195,196,0,0,0,0,
+197,197,197,197,197,197,197,197,0,0,0,0,0,0,0,0,
+198,198,198,198,198,198,198,198,199,199,199,199,199,199,199,199,
+200,200,200,200,200,200,200,200,201,201,201,201,201,201,201,201,
+202,202,202,202,202,202,202,202,203,204,205,206,0,0,0,0,
+207,207,207,207,207,207,207,207,0,0,0,0,0,0,0,0,
+208,208,208,208,208,208,208,208,209,209,209,209,209,209,209,209,
+210,210,210,210,210,210,210,210,211,211,211,211,211,211,211,211,
+212,212,212,212,212,212,212,212,213,214,215,216,0,0,0,0,
+217,217,217,217,217,217,217,217,0,0,0,0,0,0,0,0,
+218,218,218,218,218,218,218,218,219,219,219,219,219,219,219,219,
+220,220,220,220,220,220,220,220,221,221,221,221,221,221,221,221,
+222,222,222,222,222,222,222,222,223,224,0,0,225,0,0,0,
+226,226,226,226,226,226,226,226,0,0,0,0,0,0,0,0,
+227,227,227,227,227,227,227,227,228,228,228,228,228,228,228,228,
+229,229,229,229,229,229,229,229,230,230,230,230,230,230,230,230,
+231,231,231,231,231,231,231,231,232,233,0,0,234,0,0,0,
+235,235,235,235,235,235,235,235,0,0,0,0,0,0,0,0,
+236,236,236,236,236,236,236,236,237,237,237,237,237,237,237,237,
+238,238,238,238,238,238,238,238,239,239,239,239,239,239,239,239,
+240,240,240,240,240,240,240,240,241,242,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+243,243,243,243,243,243,243,243,244,244,244,244,244,244,244,244,
+245,245,245,245,245,245,245,245,246,246,246,246,246,246,246,246,
+247,247,247,247,247,247,247,247,248,249,0,0,0,0,0,0,
+250,250,250,250,250,250,250,250,0,0,0,0,0,0,0,0,
+251,251,251,251,251,251,251,251,252,252,252,252,252,252,252,252,
+253,253,253,253,253,253,253,253,254,254,254,254,254,254,254,254,
+255,255,255,255,255,255,255,255,256,257,258,259,0,0,0,0,
+260,260,260,260,260,260,260,260,0,0,0,0,0,0,0,0,
+261,261,261,261,261,261,261,261,262,262,262,262,262,262,262,262,
+263,263,263,263,263,263,263,263,264,264,264,264,264,264,264,264,
+265,265,265,265,265,265,265,265,266,267,268,269,0,0,0,0,
+270,270,270,270,270,270,270,270,0,0,0,0,0,0,0,0,
+271,271,271,271,271,271,271,271,272,272,272,272,272,272,272,272,
+273,273,273,273,273,273,273,273,274,274,274,274,274,274,274,274,
+275,275,275,275,275,275,275,275,276,277,278,279,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+280,280,280,280,280,280,280,280,281,281,281,281,281,281,281,281,
+282,282,282,282,282,282,282,282,283,283,283,283,283,283,283,283,
+284,284,284,284,284,284,284,284,285,286,0,0,287,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+288,288,288,288,288,288,288,288,289,289,289,289,289,289,289,289,
+290,290,290,290,290,290,290,290,291,291,291,291,291,291,291,291,
+292,292,292,292,292,292,292,292,293,294,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+295,295,295,295,295,295,295,295,296,296,296,296,296,296,296,296,
+297,297,297,297,297,297,297,297,298,298,298,298,298,298,298,298,
+299,299,299,299,299,299,299,299,300,301,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+302,302,302,302,302,302,302,302,303,303,303,303,303,303,303,303,
+304,304,304,304,304,304,304,304,305,305,305,305,305,305,305,305,
+306,306,306,306,306,306,306,306,307,308,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+309,309,309,309,309,309,309,309,310,310,310,310,310,310,310,310,
+311,311,311,311,311,311,311,311,312,312,312,312,312,312,312,312,
+313,313,313,313,313,313,313,313,314,315,0,0,316,0,0,0,
+317,317,317,317,317,317,317,317,0,0,0,0,0,0,0,0,
+318,318,318,318,318,318,318,318,319,319,319,319,319,319,319,319,
+320,320,320,320,320,320,320,320,321,321,321,321,321,321,321,321,
+322,322,322,322,322,322,322,322,323,324,325,326,327,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+328,328,328,328,328,328,328,328,0,0,0,0,0,0,0,0,
+329,329,329,329,329,329,329,329,330,330,330,330,330,330,330,330,
+331,331,331,331,331,331,331,331,332,332,332,332,332,332,332,332,
+333,333,333,333,333,333,333,333,334,335,336,337,338,0,0,0,
+339,339,339,339,339,339,339,339,0,0,0,0,0,0,0,0,
+340,340,340,340,340,340,340,340,341,341,341,341,341,341,341,341,
+342,342,342,342,342,342,342,342,343,343,343,343,343,343,343,343,
+344,344,344,344,344,344,344,344,345,346,347,348,349,0,0,0,
+350,350,350,350,350,350,350,350,0,0,0,0,0,0,0,0,
+351,351,351,351,351,351,351,351,352,352,352,352,352,352,352,352,
+353,353,353,353,353,353,353,353,354,354,354,354,354,354,354,354,
+355,355,355,355,355,355,355,355,356,357,358,359,360,0,0,0,
+361,361,361,361,361,361,361,361,0,0,0,0,0,0,0,0,
+362,362,362,362,362,362,362,362,363,363,363,363,363,363,363,363,
+364,364,364,364,364,364,364,364,365,365,365,365,365,365,365,365,
+366,366,366,366,366,366,366,366,367,368,369,370,371,0,0,0,
+372,372,372,372,372,372,372,372,0,0,0,0,0,0,0,0,
+373,373,373,373,373,373,373,373,374,374,374,374,374,374,374,374,
+375,375,375,375,375,375,375,375,376,376,376,376,376,376,376,376,
+377,377,377,377,377,377,377,377,378,379,380,381,382,0,0,0,
+383,383,383,383,383,383,383,383,0,0,0,0,0,0,0,0,
+384,384,384,384,384,384,384,384,385,385,385,385,385,385,385,385,
+386,386,386,386,386,386,386,386,387,387,387,387,387,387,387,387,
+388,388,388,388,388,388,388,388,389,390,391,392,393,0,0,0,
+394,394,394,394,394,394,394,394,0,0,0,0,0,0,0,0,
+395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,
+397,397,397,397,397,397,397,397,398,398,398,398,398,398,398,398,
+399,399,399,399,399,399,399,399,400,401,402,403,404,0,0,0,
+405,405,405,405,405,405,405,405,406,406,406,406,406,406,406,406,
+407,407,407,407,407,407,407,407,408,408,408,408,408,408,408,408,
+409,409,409,409,409,409,409,409,410,410,410,410,410,410,410,410,
+411,411,411,411,411,411,411,411,412,413,414,415,416,0,0,0,
+417,417,417,417,417,417,417,417,418,418,418,418,418,418,418,418,
+419,419,419,419,419,419,419,419,420,420,420,420,420,420,420,420,
+421,421,421,421,421,421,421,421,422,422,422,422,422,422,422,422,
+423,423,423,423,423,423,423,423,424,425,426,427,428,0,0,0,
+429,429,429,429,429,429,429,429,430,430,430,430,430,430,430,430,
+431,431,431,431,431,431,431,431,432,432,432,432,432,432,432,432,
+433,433,433,433,433,433,433,433,434,434,434,434,434,434,434,434,
+435,435,435,435,435,435,435,435,436,437,438,439,440,0,0,0,
+441,441,441,441,441,441,441,441,442,442,442,442,442,442,442,442,
+443,443,443,443,443,443,443,443,444,444,444,444,444,444,444,444,
+445,445,445,445,445,445,445,445,446,446,446,446,446,446,446,446,
+447,447,447,447,447,447,447,447,448,449,450,451,452,0,0,0,
+453,453,453,453,453,453,453,453,454,454,454,454,454,454,454,454,
+455,455,455,455,455,455,455,455,456,456,456,456,456,456,456,456,
+457,457,457,457,457,457,457,457,458,458,458,458,458,458,458,458,
+459,459,459,459,459,459,459,459,460,461,462,463,464,0,0,0,
+465,465,465,465,465,465,465,465,466,466,466,466,466,466,466,466,
+467,467,467,467,467,467,467,467,468,468,468,468,468,468,468,468,
+469,469,469,469,469,469,469,469,470,470,470,470,470,470,470,470,
+471,471,471,471,471,471,471,471,472,473,474,475,476,0,0,0,
+477,477,477,477,477,477,477,477,478,478,478,478,478,478,478,478,
+479,479,479,479,479,479,479,479,480,480,480,480,480,480,480,480,
+481,481,481,481,481,481,481,481,482,482,482,482,482,482,482,482,
+483,483,483,483,483,483,483,483,484,485,486,487,488,0,0,0,
+489,489,489,489,489,489,489,489,490,490,490,490,490,490,490,490,
+491,491,491,491,491,491,491,491,492,492,492,492,492,492,492,492,
+493,493,493,493,493,493,493,493,494,494,494,494,494,494,494,494,
+495,495,495,495,495,495,495,495,496,497,498,499,500,0,0,0,
+501,501,501,501,501,501,501,501,502,502,502,502,502,502,502,502,
+503,503,503,503,503,503,503,503,504,504,504,504,504,504,504,504,
+505,505,505,505,505,505,505,505,506,506,506,506,506,506,506,506,
+507,507,507,507,507,507,507,507,508,509,510,511,512,0,0,0,
+513,513,513,513,513,513,513,513,514,514,514,514,514,514,514,514,
+515,515,515,515,515,515,515,515,516,516,516,516,516,516,516,516,
+517,517,517,517,517,517,517,517,518,518,518,518,518,518,518,518,
+519,519,519,519,519,519,519,519,520,521,522,523,524,0,0,0,
+525,525,525,525,525,525,525,525,526,526,526,526,526,526,526,526,
+527,527,527,527,527,527,527,527,528,528,528,528,528,528,528,528,
+529,529,529,529,529,529,529,529,530,530,530,530,530,530,530,530,
+531,531,531,531,531,531,531,531,532,533,534,535,536,0,0,0,
+537,537,537,537,537,537,537,537,538,538,538,538,538,538,538,538,
+539,539,539,539,539,539,539,539,540,540,540,540,540,540,540,540,
+541,541,541,541,541,541,541,541,542,542,542,542,542,542,542,542,
+543,543,543,543,543,543,543,543,544,545,546,547,548,0,0,0,
+549,549,549,549,549,549,549,549,550,550,550,550,550,550,550,550,
+551,551,551,551,551,551,551,551,552,552,552,552,552,552,552,552,
+553,553,553,553,553,553,553,553,554,554,554,554,554,554,554,554,
+555,555,555,555,555,555,555,555,556,557,558,559,560,0,0,0,
+561,561,561,561,561,561,561,561,562,562,562,562,562,562,562,562,
+563,563,563,563,563,563,563,563,564,564,564,564,564,564,564,564,
+565,565,565,565,565,565,565,565,566,566,566,566,566,566,566,566,
+567,567,567,567,567,567,567,567,568,569,570,571,572,0,0,0,
+573,573,573,573,573,573,573,573,574,574,574,574,574,574,574,574,
+575,575,575,575,575,575,575,575,576,576,576,576,576,576,576,576,
+577,577,577,577,577,577,577,577,578,578,578,578,578,578,578,578,
+579,579,579,579,579,579,579,579,580,581,582,583,584,0,0,0,
+585,585,585,585,585,585,585,585,586,586,586,586,586,586,586,586,
+587,587,587,587,587,587,587,587,588,588,588,588,588,588,588,588,
+589,589,589,589,589,589,589,589,590,590,590,590,590,590,590,590,
+591,591,591,591,591,591,591,591,592,593,594,595,596,0,0,0,
+597,597,597,597,597,597,597,597,598,598,598,598,598,598,598,598,
+599,599,599,599,599,599,599,599,600,600,600,600,600,600,600,600,
+601,601,601,601,601,601,601,601,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,608,0,0,0,
+609,609,609,609,609,609,609,609,610,610,610,610,610,610,610,610,
+611,611,611,611,611,611,611,611,612,612,612,612,612,612,612,612,
+613,613,613,613,613,613,613,613,614,614,614,614,614,614,614,614,
+615,615,615,615,615,615,615,615,616,617,618,619,620,0,0,0,
+621,621,621,621,621,621,621,621,0,0,0,0,0,0,0,0,
+622,622,622,622,622,622,622,622,623,623,623,623,623,623,623,623,
+624,624,624,624,624,624,624,624,625,625,625,625,625,625,625,625,
+626,626,626,626,626,626,626,626,627,628,0,0,0,0,0,0,
+629,629,629,629,629,629,629,629,0,0,0,0,0,0,0,0,
+630,630,630,630,630,630,630,630,631,631,631,631,631,631,631,631,
+632,632,632,632,632,632,632,632,633,633,633,633,633,633,633,633,
+634,634,634,634,634,634,634,634,635,636,0,0,0,0,0,0,
+637,637,637,637,637,637,637,637,0,0,0,0,0,0,0,0,
+638,638,638,638,638,638,638,638,639,639,639,639,639,639,639,639,
+640,640,640,640,640,640,640,640,641,641,641,641,641,641,641,641,
+642,642,642,642,642,642,642,642,643,644,0,0,0,0,0,0,
+645,645,645,645,645,645,645,645,0,0,0,0,0,0,0,0,
+646,646,646,646,646,646,646,646,647,647,647,647,647,647,647,647,
+648,648,648,648,648,648,648,648,649,649,649,649,649,649,649,649,
+650,650,650,650,650,650,650,650,651,652,0,0,0,0,0,0,
+653,653,653,653,653,653,653,653,0,0,0,0,0,0,0,0,
+654,654,654,654,654,654,654,654,655,655,655,655,655,655,655,655,
+656,656,656,656,656,656,656,656,657,657,657,657,657,657,657,657,
+658,658,658,658,658,658,658,658,659,660,661,662,663,0,0,0,
+664,664,664,664,664,664,664,664,0,0,0,0,0,0,0,0,
+665,665,665,665,665,665,665,665,666,666,666,666,666,666,666,666,
+667,667,667,667,667,667,667,667,668,668,668,668,668,668,668,668,
+669,669,669,669,669,669,669,669,670,671,672,673,674,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,676,676,676,676,676,676,676,676,
+677,677,677,677,677,677,677,677,678,679,680,681,0,0,0,0,
+682,682,682,682,682,682,682,682,0,0,0,0,0,0,0,0,
+683,683,683,683,683,683,683,683,684,684,684,684,684,684,684,684,
+685,685,685,685,685,685,685,685,686,686,686,686,686,686,686,686,
+687,687,687,687,687,687,687,687,688,689,0,0,0,0,0,0,
+690,690,690,690,690,690,690,690,0,0,0,0,0,0,0,0,
+691,691,691,691,691,691,691,691,692,692,692,692,692,692,692,692,
+693,693,693,693,693,693,693,693,694,694,694,694,694,694,694,694,
+695,695,695,695,695,695,695,695,696,697,0,0,0,0,0,0,
+698,698,698,698,698,698,698,698,0,0,0,0,0,0,0,0,
+699,699,699,699,699,699,699,699,700,700,700,700,700,700,700,700,
+701,701,701,701,701,701,701,701,702,702,702,702,702,702,702,702,
+703,703,703,703,703,703,703,703,704,705,0,0,0,0,0,0,
+706,706,706,706,706,706,706,706,0,0,0,0,0,0,0,0,
+707,707,707,707,707,707,707,707,708,708,708,708,708,708,708,708,
+709,709,709,709,709,709,709,709,710,710,710,710,710,710,710,710,
+711,711,711,711,711,711,711,711,712,713,0,0,0,0,0,0,
+714,714,714,714,714,714,714,714,0,0,0,0,0,0,0,0,
+715,715,715,715,715,715,715,715,716,716,716,716,716,716,716,716,
+717,717,717,717,717,717,717,717,718,718,718,718,718,718,718,718,
+719,719,719,719,719,719,719,719,720,721,0,0,0,0,0,0,
+722,722,722,722,722,722,722,722,0,0,0,0,0,0,0,0,
+723,723,723,723,723,723,723,723,724,724,724,724,724,724,724,724,
+725,725,725,725,725,725,725,725,726,726,726,726,726,726,726,726,
+727,727,727,727,727,727,727,727,728,729,0,0,0,0,0,0,
+730,730,730,730,730,730,730,730,0,0,0,0,0,0,0,0,
+731,731,731,731,731,731,731,731,732,732,732,732,732,732,732,732,
+733,733,733,733,733,733,733,733,734,734,734,734,734,734,734,734,
+735,735,735,735,735,735,735,735,736,737,0,0,0,0,0,0,
+738,738,738,738,738,738,738,738,0,0,0,0,0,0,0,0,
+739,739,739,739,739,739,739,739,740,740,740,740,740,740,740,740,
+741,741,741,741,741,741,741,741,742,742,742,742,742,742,742,742,
+743,743,743,743,743,743,743,743,744,745,746,747,748,0,0,0,
+749,749,749,749,749,749,749,749,0,0,0,0,0,0,0,0,
+750,750,750,750,750,750,750,750,751,751,751,751,751,751,751,751,
+752,752,752,752,752,752,752,752,753,753,753,753,753,753,753,753,
+754,754,754,754,754,754,754,754,755,756,0,0,0,0,0,0,
+757,757,757,757,757,757,757,757,0,0,0,0,0,0,0,0,
+758,758,758,758,758,758,758,758,759,759,759,759,759,759,759,759,
+760,760,760,760,760,760,760,760,761,761,761,761,761,761,761,761,
+762,762,762,762,762,762,762,762,763,764,0,0,0,0,0,0,
+765,765,765,765,765,765,765,765,0,0,0,0,0,0,0,0,
+766,766,766,766,766,766,766,766,767,767,767,767,767,767,767,767,
+768,768,768,768,768,768,768,768,769,769,769,769,769,769,769,769,
+770,770,770,770,770,770,770,770,771,772,0,0,0,0,0,0,
+773,773,773,773,773,773,773,773,0,0,0,0,0,0,0,0,
+774,774,774,774,774,774,774,774,775,775,775,775,775,775,775,775,
+776,776,776,776,776,776,776,776,777,777,777,777,777,777,777,777,
+778,778,778,778,778,778,778,778,779,780,781,782,783,0,0,0,
+784,784,784,784,784,784,784,784,785,785,785,785,785,785,785,785,
+786,786,786,786,786,786,786,786,787,787,787,787,787,787,787,787,
+788,788,788,788,788,788,788,788,789,789,789,789,789,789,789,789,
+790,790,790,790,790,790,790,790,791,792,0,0,0,0,0,0,
+793,793,793,793,793,793,793,793,794,794,794,794,794,794,794,794,
+795,795,795,795,795,795,795,795,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,796,796,796,796,796,796,796,796,
+797,797,797,797,797,797,797,797,798,799,800,801,0,0,0,0,
+802,802,802,802,802,802,802,802,0,0,0,0,0,0,0,0,
+803,803,803,803,803,803,803,803,0,0,0,0,0,0,0,0,
+804,804,804,804,804,804,804,804,805,805,805,805,805,805,805,805,
+806,806,806,806,806,806,806,806,807,808,0,0,0,0,0,0,
+809,809,809,809,809,809,809,809,0,0,0,0,0,0,0,0,
+810,810,810,810,810,810,810,810,0,0,0,0,0,0,0,0,
+811,811,811,811,811,811,811,811,812,812,812,812,812,812,812,812,
+813,813,813,813,813,813,813,813,814,815,0,0,0,0,0,0,
+816,816,816,816,816,816,816,816,0,0,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,676,676,676,676,676,676,676,676,
+677,677,677,677,677,677,677,677,678,679,680,681,0,0,0,0,
+817,817,817,817,817,817,817,817,0,0,0,0,0,0,0,0,
+818,818,818,818,818,818,818,818,819,819,819,819,819,819,819,819,
+820,820,820,820,820,820,820,820,821,821,821,821,821,821,821,821,
+822,822,822,822,822,822,822,822,823,824,825,826,827,0,0,0,
+828,828,828,828,828,828,828,828,829,829,829,829,829,829,829,829,
+830,830,830,830,830,830,830,830,831,831,831,831,831,831,831,831,
+832,832,832,832,832,832,832,832,833,833,833,833,833,833,833,833,
+834,834,834,834,834,834,834,834,835,836,837,838,839,0,0,0,
+840,840,840,840,840,840,840,840,841,841,841,841,841,841,841,841,
+842,842,842,842,842,842,842,842,843,843,843,843,843,843,843,843,
+844,844,844,844,844,844,844,844,845,845,845,845,845,845,845,845,
+846,846,846,846,846,846,846,846,847,848,849,850,851,0,0,0,
+852,852,852,852,852,852,852,852,0,0,0,0,0,0,0,0,
+853,853,853,853,853,853,853,853,854,854,854,854,854,854,854,854,
+855,855,855,855,855,855,855,855,856,856,856,856,856,856,856,856,
+857,857,857,857,857,857,857,857,858,859,0,0,0,0,0,0,
+860,860,860,860,860,860,860,860,0,0,0,0,0,0,0,0,
+861,861,861,861,861,861,861,861,862,862,862,862,862,862,862,862,
+863,863,863,863,863,863,863,863,864,864,864,864,864,864,864,864,
+865,865,865,865,865,865,865,865,866,867,868,869,870,0,0,0,
+871,871,871,871,871,871,871,871,0,0,0,0,0,0,0,0,
+872,872,872,872,872,872,872,872,873,873,873,873,873,873,873,873,
+874,874,874,874,874,874,874,874,875,875,875,875,875,875,875,875,
+876,876,876,876,876,876,876,876,877,878,879,880,881,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+882,882,882,882,882,882,882,882,883,883,883,883,883,883,883,883,
+0,0,0,0,0,0,0,0,884,884,884,884,884,884,884,884,
+885,885,885,885,885,885,885,885,886,887,888,889,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+890,890,890,890,890,890,890,890,891,891,891,891,891,891,891,891,
+0,0,0,0,0,0,0,0,892,892,892,892,892,892,892,892,
+893,893,893,893,893,893,893,893,894,895,896,897,0,0,0,0,
+898,898,898,898,898,898,898,898,898,898,898,898,898,898,898,898,
+899,899,899,899,899,899,899,899,900,900,900,900,900,900,900,900,
+901,901,901,901,901,901,901,901,902,902,902,902,902,902,902,902,
+903,904,905,906,907,908,909,910,0,0,911,912,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+913,913,913,913,913,913,913,913,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,914,914,914,914,914,914,914,914,
+915,915,915,915,915,915,915,915,916,917,918,919,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+920,920,920,920,920,920,920,920,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,921,921,921,921,921,921,921,921,
+922,922,922,922,922,922,922,922,923,924,925,926,0,0,0,0,
+927,927,927,927,927,927,927,927,0,0,0,0,0,0,0,0,
+928,928,928,928,928,928,928,928,929,929,929,929,929,929,929,929,
+930,930,930,930,930,930,930,930,931,931,931,931,931,931,931,931,
+932,932,932,932,932,932,932,932,933,934,0,0,0,0,0,0,
+935,935,935,935,935,935,935,935,936,936,936,936,936,936,936,936,
+937,937,937,937,937,937,937,937,938,938,938,938,938,938,938,938,
+939,939,939,939,939,939,939,939,940,940,940,940,940,940,940,940,
+941,941,941,941,941,941,941,941,942,943,0,0,0,0,0,0,
+944,944,944,944,944,944,944,944,945,945,945,945,945,945,945,945,
+946,946,946,946,946,946,946,946,947,947,947,947,947,947,947,947,
+948,948,948,948,948,948,948,948,949,949,949,949,949,949,949,949,
+950,950,950,950,950,950,950,950,951,952,0,0,0,0,0,0,
+953,953,953,953,953,953,953,953,954,954,954,954,954,954,954,954,
+955,955,955,955,955,955,955,955,956,956,956,956,956,956,956,956,
+957,957,957,957,957,957,957,957,958,958,958,958,958,958,958,958,
+959,959,959,959,959,959,959,959,960,961,962,963,964,0,0,0,
+965,965,965,965,965,965,965,965,0,0,0,0,0,0,0,0,
+966,966,966,966,966,966,966,966,967,967,967,967,967,967,967,967,
+968,968,968,968,968,968,968,968,969,969,969,969,969,969,969,969,
+970,970,970,970,970,970,970,970,971,972,0,0,0,0,0,0,
+973,973,973,973,973,973,973,973,974,974,974,974,974,974,974,974,
+975,975,975,975,975,975,975,975,976,976,976,976,976,976,976,976,
+977,977,977,977,977,977,977,977,978,978,978,978,978,978,978,978,
+979,979,979,979,979,979,979,979,980,981,0,0,0,0,0,0,
+982,982,982,982,982,982,982,982,983,983,983,983,983,983,983,983,
+984,984,984,984,984,984,984,984,985,985,985,985,985,985,985,985,
+986,986,986,986,986,986,986,986,987,987,987,987,987,987,987,987,
+988,988,988,988,988,988,988,988,989,990,0,0,0,0,0,0,
+991,991,991,991,991,991,991,991,992,992,992,992,992,992,992,992,
+993,993,993,993,993,993,993,993,994,994,994,994,994,994,994,994,
+995,995,995,995,995,995,995,995,996,996,996,996,996,996,996,996,
+997,997,997,997,997,997,997,997,998,999,1000,1001,1002,0,0,0,
+1003,1003,1003,1003,1003,1003,1003,1003,1004,1004,1004,1004,1004,1004,1004,1004,
+1005,1005,1005,1005,1005,1005,1005,1005,1006,1006,1006,1006,1006,1006,1006,1006,
+1007,1007,1007,1007,1007,1007,1007,1007,1008,1008,1008,1008,1008,1008,1008,1008,
+1009,1009,1009,1009,1009,1009,1009,1009,1010,1011,1012,1013,1014,0,0,0,
+1015,1015,1015,1015,1015,1015,1015,1015,1016,1016,1016,1016,1016,1016,1016,1016,
+1017,1017,1017,1017,1017,1017,1017,1017,1018,1018,1018,1018,1018,1018,1018,1018,
+1019,1019,1019,1019,1019,1019,1019,1019,1020,1020,1020,1020,1020,1020,1020,1020,
+1021,1021,1021,1021,1021,1021,1021,1021,1022,1023,1024,1025,1026,0,0,0,
+1027,1027,1027,1027,1027,1027,1027,1027,1028,1028,1028,1028,1028,1028,1028,1028,
+1029,1029,1029,1029,1029,1029,1029,1029,1030,1030,1030,1030,1030,1030,1030,1030,
+1031,1031,1031,1031,1031,1031,1031,1031,1032,1032,1032,1032,1032,1032,1032,1032,
+1033,1033,1033,1033,1033,1033,1033,1033,1034,1035,1036,1037,1038,0,0,0,
+1039,1039,1039,1039,1039,1039,1039,1039,1040,1040,1040,1040,1040,1040,1040,1040,
+1041,1041,1041,1041,1041,1041,1041,1041,1042,1042,1042,1042,1042,1042,1042,1042,
+1043,1043,1043,1043,1043,1043,1043,1043,1044,1044,1044,1044,1044,1044,1044,1044,
+1045,1045,1045,1045,1045,1045,1045,1045,1046,1047,1048,1049,1050,0,0,0,
+1051,1051,1051,1051,1051,1051,1051,1051,1052,1052,1052,1052,1052,1052,1052,1052,
+1053,1053,1053,1053,1053,1053,1053,1053,1054,1054,1054,1054,1054,1054,1054,1054,
+1055,1055,1055,1055,1055,1055,1055,1055,1056,1056,1056,1056,1056,1056,1056,1056,
+1057,1057,1057,1057,1057,1057,1057,1057,1058,1059,1060,1061,1062,0,0,0,
+1063,1063,1063,1063,1063,1063,1063,1063,1064,1064,1064,1064,1064,1064,1064,1064,
+1065,1065,1065,1065,1065,1065,1065,1065,1066,1066,1066,1066,1066,1066,1066,1066,
+1067,1067,1067,1067,1067,1067,1067,1067,1068,1068,1068,1068,1068,1068,1068,1068,
+1069,1069,1069,1069,1069,1069,1069,1069,1070,1071,1072,1073,1074,0,0,0,
+1075,1075,1075,1075,1075,1075,1075,1075,1076,1076,1076,1076,1076,1076,1076,1076,
+1077,1077,1077,1077,1077,1077,1077,1077,1078,1078,1078,1078,1078,1078,1078,1078,
+1079,1079,1079,1079,1079,1079,1079,1079,1080,1080,1080,1080,1080,1080,1080,1080,
+1081,1081,1081,1081,1081,1081,1081,1081,1082,1083,1084,1085,1086,0,0,0,
+1087,1087,1087,1087,1087,1087,1087,1087,1088,1088,1088,1088,1088,1088,1088,1088,
+1089,1089,1089,1089,1089,1089,1089,1089,1090,1090,1090,1090,1090,1090,1090,1090,
+1091,1091,1091,1091,1091,1091,1091,1091,1092,1092,1092,1092,1092,1092,1092,1092,
+1093,1093,1093,1093,1093,1093,1093,1093,1094,1095,1096,1097,1098,0,0,0,
+1099,1099,1099,1099,1099,1099,1099,1099,1100,1100,1100,1100,1100,1100,1100,1100,
+1101,1101,1101,1101,1101,1101,1101,1101,1102,1102,1102,1102,1102,1102,1102,1102,
+1103,1103,1103,1103,1103,1103,1103,1103,1104,1104,1104,1104,1104,1104,1104,1104,
+1105,1105,1105,1105,1105,1105,1105,1105,1106,1107,1108,1109,1110,0,0,0,
+1111,1111,1111,1111,1111,1111,1111,1111,1112,1112,1112,1112,1112,1112,1112,1112,
+1113,1113,1113,1113,1113,1113,1113,1113,1114,1114,1114,1114,1114,1114,1114,1114,
+1115,1115,1115,1115,1115,1115,1115,1115,1116,1116,1116,1116,1116,1116,1116,1116,
+1117,1117,1117,1117,1117,1117,1117,1117,1118,1119,1120,1121,1122,0,0,0,
+1123,1123,1123,1123,1123,1123,1123,1123,1124,1124,1124,1124,1124,1124,1124,1124,
+1125,1125,1125,1125,1125,1125,1125,1125,1126,1126,1126,1126,1126,1126,1126,1126,
+1127,1127,1127,1127,1127,1127,1127,1127,1128,1128,1128,1128,1128,1128,1128,1128,
+1129,1129,1129,1129,1129,1129,1129,1129,1130,1131,1132,1133,1134,0,0,0,
+1135,1135,1135,1135,1135,1135,1135,1135,1136,1136,1136,1136,1136,1136,1136,1136,
+1137,1137,1137,1137,1137,1137,1137,1137,1138,1138,1138,1138,1138,1138,1138,1138,
+1139,1139,1139,1139,1139,1139,1139,1139,1140,1140,1140,1140,1140,1140,1140,1140,
+1141,1141,1141,1141,1141,1141,1141,1141,1142,1143,1144,1145,1146,0,0,0,
+1147,1147,1147,1147,1147,1147,1147,1147,1148,1148,1148,1148,1148,1148,1148,1148,
+1149,1149,1149,1149,1149,1149,1149,1149,1150,1150,1150,1150,1150,1150,1150,1150,
+1151,1151,1151,1151,1151,1151,1151,1151,1152,1152,1152,1152,1152,1152,1152,1152,
+1153,1153,1153,1153,1153,1153,1153,1153,1154,1155,1156,1157,1158,0,0,0,
+1159,1159,1159,1159,1159,1159,1159,1159,1160,1160,1160,1160,1160,1160,1160,1160,
+1161,1161,1161,1161,1161,1161,1161,1161,1162,1162,1162,1162,1162,1162,1162,1162,
+1163,1163,1163,1163,1163,1163,1163,1163,1164,1164,1164,1164,1164,1164,1164,1164,
+1165,1165,1165,1165,1165,1165,1165,1165,1166,1167,1168,1169,1170,0,0,0,
+1171,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1173,
+1174,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1176,
+1177,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1179,
+1180,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1182,
+1183,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1185,
+1186,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1188,
+1189,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1191,
+1192,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1194,
+1195,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1197,
+1198,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1200,
+1201,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1203,
+1204,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1206,
+1207,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1209,
+1210,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1212,
+1213,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1215,
+1216,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1218,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1220,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1222,1222,1222,1222,1222,1222,1222,1222,0,0,0,0,0,0,0,0,
+1223,1223,1223,1223,1223,1223,1223,1223,1224,1224,1224,1224,1224,1224,1224,1224,
+1225,1225,1225,1225,1225,1225,1225,1225,1226,1226,1226,1226,1226,1226,1226,1226,
+1227,1227,1227,1227,1227,1227,1227,1227,1228,1229,1230,1231,1232,0,0,0,
+1233,1233,1233,1233,1233,1233,1233,1233,0,0,0,0,0,0,0,0,
+1234,1234,1234,1234,1234,1234,1234,1234,1235,1235,1235,1235,1235,1235,1235,1235,
+1236,1236,1236,1236,1236,1236,1236,1236,1237,1237,1237,1237,1237,1237,1237,1237,
+1238,1238,1238,1238,1238,1238,1238,1238,1239,1240,1241,1242,1243,0,0,0,
+1244,1244,1244,1244,1244,1244,1244,1244,0,0,0,0,0,0,0,0,
+1245,1245,1245,1245,1245,1245,1245,1245,1246,1246,1246,1246,1246,1246,1246,1246,
+1247,1247,1247,1247,1247,1247,1247,1247,1248,1248,1248,1248,1248,1248,1248,1248,
+1249,1249,1249,1249,1249,1249,1249,1249,1250,1251,1252,1253,1254,0,0,0,
+1255,1255,1255,1255,1255,1255,1255,1255,0,0,0,0,0,0,0,0,
+1256,1256,1256,1256,1256,1256,1256,1256,1257,1257,1257,1257,1257,1257,1257,1257,
+1258,1258,1258,1258,1258,1258,1258,1258,1259,1259,1259,1259,1259,1259,1259,1259,
+1260,1260,1260,1260,1260,1260,1260,1260,1261,1262,1263,1264,1265,0,0,0,
+1266,1266,1266,1266,1266,1266,1266,1266,1267,1267,1267,1267,1267,1267,1267,1267,
+1268,1268,1268,1268,1268,1268,1268,1268,1269,1269,1269,1269,1269,1269,1269,1269,
+1270,1270,1270,1270,1270,1270,1270,1270,1271,1271,1271,1271,1271,1271,1271,1271,
+1272,1272,1272,1272,1272,1272,1272,1272,1273,1274,0,0,0,0,0,0,
+1275,1275,1275,1275,1275,1275,1275,1275,1276,1276,1276,1276,1276,1276,1276,1276,
+1277,1277,1277,1277,1277,1277,1277,1277,1278,1278,1278,1278,1278,1278,1278,1278,
+1279,1279,1279,1279,1279,1279,1279,1279,1280,1280,1280,1280,1280,1280,1280,1280,
+1281,1281,1281,1281,1281,1281,1281,1281,1282,1283,0,0,0,0,0,0,
+1284,1284,1284,1284,1284,1284,1284,1284,1285,1285,1285,1285,1285,1285,1285,1285,
+1286,1286,1286,1286,1286,1286,1286,1286,1287,1287,1287,1287,1287,1287,1287,1287,
+1288,1288,1288,1288,1288,1288,1288,1288,1289,1289,1289,1289,1289,1289,1289,1289,
+1290,1290,1290,1290,1290,1290,1290,1290,1291,1292,0,0,0,0,0,0,
+1293,1293,1293,1293,1293,1293,1293,1293,0,0,0,0,0,0,0,0,
+1294,1294,1294,1294,1294,1294,1294,1294,1295,1295,1295,1295,1295,1295,1295,1295,
+1296,1296,1296,1296,1296,1296,1296,1296,1297,1297,1297,1297,1297,1297,1297,1297,
+1298,1298,1298,1298,1298,1298,1298,1298,1299,1300,1301,1302,1303,0,0,0,
+1304,1304,1304,1304,1304,1304,1304,1304,0,0,0,0,0,0,0,0,
+1305,1305,1305,1305,1305,1305,1305,1305,1306,1306,1306,1306,1306,1306,1306,1306,
+1307,1307,1307,1307,1307,1307,1307,1307,1308,1308,1308,1308,1308,1308,1308,1308,
+1309,1309,1309,1309,1309,1309,1309,1309,1310,1311,1312,1313,1314,0,0,0,
+1315,1315,1315,1315,1315,1315,1315,1315,1316,1316,1316,1316,1316,1316,1316,1316,
+1317,1317,1317,1317,1317,1317,1317,1317,1318,1318,1318,1318,1318,1318,1318,1318,
+1319,1319,1319,1319,1319,1319,1319,1319,1320,1320,1320,1320,1320,1320,1320,1320,
+1321,1321,1321,1321,1321,1321,1321,1321,1322,1323,1324,1325,1326,0,0,0,
+1327,1327,1327,1327,1327,1327,1327,1327,1328,1328,1328,1328,1328,1328,1328,1328,
+1329,1329,1329,1329,1329,1329,1329,1329,1330,1330,1330,1330,1330,1330,1330,1330,
+1331,1331,1331,1331,1331,1331,1331,1331,1332,1332,1332,1332,1332,1332,1332,1332,
+1333,1333,1333,1333,1333,1333,1333,1333,1334,1335,1336,1337,1338,0,0,0,
+1339,1339,1339,1339,1339,1339,1339,1339,1340,1340,1340,1340,1340,1340,1340,1340,
+1341,1341,1341,1341,1341,1341,1341,1341,1342,1342,1342,1342,1342,1342,1342,1342,
+1343,1343,1343,1343,1343,1343,1343,1343,1344,1344,1344,1344,1344,1344,1344,1344,
+1345,1345,1345,1345,1345,1345,1345,1345,1346,1347,1348,1349,1350,0,0,0,
+1351,1351,1351,1351,1351,1351,1351,1351,1352,1352,1352,1352,1352,1352,1352,1352,
+1353,1353,1353,1353,1353,1353,1353,1353,1354,1354,1354,1354,1354,1354,1354,1354,
+1355,1355,1355,1355,1355,1355,1355,1355,1356,1356,1356,1356,1356,1356,1356,1356,
+1357,1357,1357,1357,1357,1357,1357,1357,1358,1359,0,0,0,0,0,0,
+1360,1360,1360,1360,1360,1360,1360,1360,1361,1361,1361,1361,1361,1361,1361,1361,
+1362,1362,1362,1362,1362,1362,1362,1362,1363,1363,1363,1363,1363,1363,1363,1363,
+1364,1364,1364,1364,1364,1364,1364,1364,1365,1365,1365,1365,1365,1365,1365,1365,
+1366,1366,1366,1366,1366,1366,1366,1366,1367,1368,0,0,0,0,0,0,
+1369,1369,1369,1369,1369,1369,1369,1369,1370,1370,1370,1370,1370,1370,1370,1370,
+1371,1371,1371,1371,1371,1371,1371,1371,1372,1372,1372,1372,1372,1372,1372,1372,
+1373,1373,1373,1373,1373,1373,1373,1373,1374,1374,1374,1374,1374,1374,1374,1374,
+1375,1375,1375,1375,1375,1375,1375,1375,1376,1377,0,0,0,0,0,0,
+1378,1378,1378,1378,1378,1378,1378,1378,1379,1379,1379,1379,1379,1379,1379,1379,
+1380,1380,1380,1380,1380,1380,1380,1380,1381,1381,1381,1381,1381,1381,1381,1381,
+1382,1382,1382,1382,1382,1382,1382,1382,1383,1383,1383,1383,1383,1383,1383,1383,
+1384,1384,1384,1384,1384,1384,1384,1384,1385,1386,1387,1388,1389,0,0,0,
+1390,1390,1390,1390,1390,1390,1390,1390,0,0,0,0,0,0,0,0,
+1391,1391,1391,1391,1391,1391,1391,1391,1392,1392,1392,1392,1392,1392,1392,1392,
+1393,1393,1393,1393,1393,1393,1393,1393,1394,1394,1394,1394,1394,1394,1394,1394,
+1395,1395,1395,1395,1395,1395,1395,1395,1396,1397,1398,1399,1400,0,0,0,
+1401,1401,1401,1401,1401,1401,1401,1401,1402,1402,1402,1402,1402,1402,1402,1402,
+1403,1403,1403,1403,1403,1403,1403,1403,1404,1404,1404,1404,1404,1404,1404,1404,
+1405,1405,1405,1405,1405,1405,1405,1405,1406,1406,1406,1406,1406,1406,1406,1406,
+1407,1407,1407,1407,1407,1407,1407,1407,1408,1409,1410,1411,1412,0,0,0,
+1413,1413,1413,1413,1413,1413,1413,1413,1414,1414,1414,1414,1414,1414,1414,1414,
+1415,1415,1415,1415,1415,1415,1415,1415,1416,1416,1416,1416,1416,1416,1416,1416,
+1417,1417,1417,1417,1417,1417,1417,1417,1418,1418,1418,1418,1418,1418,1418,1418,
+1419,1419,1419,1419,1419,1419,1419,1419,1420,1421,1422,1423,1424,0,0,0,
+1425,1425,1425,1425,1425,1425,1425,1425,1426,1426,1426,1426,1426,1426,1426,1426,
+1427,1427,1427,1427,1427,1427,1427,1427,1428,1428,1428,1428,1428,1428,1428,1428,
+1429,1429,1429,1429,1429,1429,1429,1429,1430,1430,1430,1430,1430,1430,1430,1430,
+1431,1431,1431,1431,1431,1431,1431,1431,1432,1433,1434,1435,1436,0,0,0,
+1437,1437,1437,1437,1437,1437,1437,1437,1438,1438,1438,1438,1438,1438,1438,1438,
+1439,1439,1439,1439,1439,1439,1439,1439,1440,1440,1440,1440,1440,1440,1440,1440,
+1441,1441,1441,1441,1441,1441,1441,1441,1442,1442,1442,1442,1442,1442,1442,1442,
+1443,1443,1443,1443,1443,1443,1443,1443,1444,1445,0,0,0,0,0,0,
+1446,1446,1446,1446,1446,1446,1446,1446,1447,1447,1447,1447,1447,1447,1447,1447,
+1448,1448,1448,1448,1448,1448,1448,1448,1449,1449,1449,1449,1449,1449,1449,1449,
+1450,1450,1450,1450,1450,1450,1450,1450,1451,1451,1451,1451,1451,1451,1451,1451,
+1452,1452,1452,1452,1452,1452,1452,1452,1453,1454,0,0,0,0,0,0,
+1455,1455,1455,1455,1455,1455,1455,1455,1456,1456,1456,1456,1456,1456,1456,1456,
+1457,1457,1457,1457,1457,1457,1457,1457,1458,1458,1458,1458,1458,1458,1458,1458,
+1459,1459,1459,1459,1459,1459,1459,1459,1460,1460,1460,1460,1460,1460,1460,1460,
+1461,1461,1461,1461,1461,1461,1461,1461,1462,1463,0,0,0,0,0,0,
+1464,1464,1464,1464,1464,1464,1464,1464,1465,1465,1465,1465,1465,1465,1465,1465,
+1466,1466,1466,1466,1466,1466,1466,1466,1467,1467,1467,1467,1467,1467,1467,1467,
+1468,1468,1468,1468,1468,1468,1468,1468,1469,1469,1469,1469,1469,1469,1469,1469,
+1470,1470,1470,1470,1470,1470,1470,1470,1471,1472,1473,1474,1475,0,0,0,
+1476,1476,1476,1476,1476,1476,1476,1476,0,0,0,0,0,0,0,0,
+1477,1477,1477,1477,1477,1477,1477,1477,1478,1478,1478,1478,1478,1478,1478,1478,
+1479,1479,1479,1479,1479,1479,1479,1479,1480,1480,1480,1480,1480,1480,1480,1480,
+1481,1481,1481,1481,1481,1481,1481,1481,1482,1483,1484,1485,1486,0,0,0,
+1487,1487,1487,1487,1487,1487,1487,1487,0,0,0,0,0,0,0,0,
+1488,1488,1488,1488,1488,1488,1488,1488,1489,1489,1489,1489,1489,1489,1489,1489,
+1490,1490,1490,1490,1490,1490,1490,1490,1491,1491,1491,1491,1491,1491,1491,1491,
+1492,1492,1492,1492,1492,1492,1492,1492,1493,1494,1495,1496,1497,0,0,0,
+1498,1498,1498,1498,1498,1498,1498,1498,0,0,0,0,0,0,0,0,
+1499,1499,1499,1499,1499,1499,1499,1499,1500,1500,1500,1500,1500,1500,1500,1500,
+1501,1501,1501,1501,1501,1501,1501,1501,1502,1502,1502,1502,1502,1502,1502,1502,
+1503,1503,1503,1503,1503,1503,1503,1503,1504,1505,1506,1507,1508,0,0,0,
+1509,1509,1509,1509,1509,1509,1509,1509,0,0,0,0,0,0,0,0,
+1510,1510,1510,1510,1510,1510,1510,1510,1511,1511,1511,1511,1511,1511,1511,1511,
+1512,1512,1512,1512,1512,1512,1512,1512,1513,1513,1513,1513,1513,1513,1513,1513,
+1514,1514,1514,1514,1514,1514,1514,1514,1515,1516,1517,1518,1519,0,0,0,
+1520,1520,1520,1520,1520,1520,1520,1520,1521,1521,1521,1521,1521,1521,1521,1521,
+1522,1522,1522,1522,1522,1522,1522,1522,1523,1523,1523,1523,1523,1523,1523,1523,
+1524,1524,1524,1524,1524,1524,1524,1524,1525,1525,1525,1525,1525,1525,1525,1525,
+1526,1526,1526,1526,1526,1526,1526,1526,1527,1528,0,0,0,0,0,0,
+1529,1529,1529,1529,1529,1529,1529,1529,1530,1530,1530,1530,1530,1530,1530,1530,
+1531,1531,1531,1531,1531,1531,1531,1531,1532,1532,1532,1532,1532,1532,1532,1532,
+1533,1533,1533,1533,1533,1533,1533,1533,1534,1534,1534,1534,1534,1534,1534,1534,
+1535,1535,1535,1535,1535,1535,1535,1535,1536,1537,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1538,1538,1538,1538,1538,1538,1538,1538,
+1539,1539,1539,1539,1539,1539,1539,1539,1540,1540,1540,1540,1540,1540,1540,1540,
+1541,1541,1541,1541,1541,1541,1541,1541,1542,1542,1542,1542,1542,1542,1542,1542,
+1543,1543,1543,1543,1543,1543,1543,1543,1544,1545,0,0,0,0,0,0,
+1546,1546,1546,1546,1546,1546,1546,1546,0,0,0,0,0,0,0,0,
+1547,1547,1547,1547,1547,1547,1547,1547,1548,1548,1548,1548,1548,1548,1548,1548,
+1549,1549,1549,1549,1549,1549,1549,1549,1550,1550,1550,1550,1550,1550,1550,1550,
+1551,1551,1551,1551,1551,1551,1551,1551,1552,1553,1554,1555,1556,0,0,0,
+1557,1557,1557,1557,1557,1557,1557,1557,0,0,0,0,0,0,0,0,
+1558,1558,1558,1558,1558,1558,1558,1558,1559,1559,1559,1559,1559,1559,1559,1559,
+1560,1560,1560,1560,1560,1560,1560,1560,1561,1561,1561,1561,1561,1561,1561,1561,
+1562,1562,1562,1562,1562,1562,1562,1562,1563,1564,1565,1566,1567,0,0,0,
+1568,1568,1568,1568,1568,1568,1568,1568,1569,1569,1569,1569,1569,1569,1569,1569,
+1570,1570,1570,1570,1570,1570,1570,1570,1571,1571,1571,1571,1571,1571,1571,1571,
+1572,1572,1572,1572,1572,1572,1572,1572,1573,1573,1573,1573,1573,1573,1573,1573,
+1574,1574,1574,1574,1574,1574,1574,1574,1575,1576,1577,1578,1579,0,0,0,
+1580,1580,1580,1580,1580,1580,1580,1580,1581,1581,1581,1581,1581,1581,1581,1581,
+1582,1582,1582,1582,1582,1582,1582,1582,1583,1583,1583,1583,1583,1583,1583,1583,
+1584,1584,1584,1584,1584,1584,1584,1584,1585,1585,1585,1585,1585,1585,1585,1585,
+1586,1586,1586,1586,1586,1586,1586,1586,1587,1588,1589,1590,1591,0,0,0,
+1592,1592,1592,1592,1592,1592,1592,1592,1593,1593,1593,1593,1593,1593,1593,1593,
+1594,1594,1594,1594,1594,1594,1594,1594,1595,1595,1595,1595,1595,1595,1595,1595,
+1596,1596,1596,1596,1596,1596,1596,1596,1597,1597,1597,1597,1597,1597,1597,1597,
+1598,1598,1598,1598,1598,1598,1598,1598,1599,1600,1601,1602,1603,0,0,0,
+1604,1604,1604,1604,1604,1604,1604,1604,1605,1605,1605,1605,1605,1605,1605,1605,
+1606,1606,1606,1606,1606,1606,1606,1606,1607,1607,1607,1607,1607,1607,1607,1607,
+1608,1608,1608,1608,1608,1608,1608,1608,1609,1609,1609,1609,1609,1609,1609,1609,
+1610,1610,1610,1610,1610,1610,1610,1610,1611,1612,0,0,0,0,0,0,
+1613,1613,1613,1613,1613,1613,1613,1613,1614,1614,1614,1614,1614,1614,1614,1614,
+1615,1615,1615,1615,1615,1615,1615,1615,1616,1616,1616,1616,1616,1616,1616,1616,
+1617,1617,1617,1617,1617,1617,1617,1617,1618,1618,1618,1618,1618,1618,1618,1618,
+1619,1619,1619,1619,1619,1619,1619,1619,1620,1621,0,0,0,0,0,0,
+1622,1622,1622,1622,1622,1622,1622,1622,1623,1623,1623,1623,1623,1623,1623,1623,
+1624,1624,1624,1624,1624,1624,1624,1624,1625,1625,1625,1625,1625,1625,1625,1625,
+1626,1626,1626,1626,1626,1626,1626,1626,1627,1627,1627,1627,1627,1627,1627,1627,
+1628,1628,1628,1628,1628,1628,1628,1628,1629,1630,0,0,0,0,0,0,
+1631,1631,1631,1631,1631,1631,1631,1631,1632,1632,1632,1632,1632,1632,1632,1632,
+1633,1633,1633,1633,1633,1633,1633,1633,1634,1634,1634,1634,1634,1634,1634,1634,
+1635,1635,1635,1635,1635,1635,1635,1635,1636,1636,1636,1636,1636,1636,1636,1636,
+1637,1637,1637,1637,1637,1637,1637,1637,1638,1639,1640,1641,1642,0,0,0,
+1643,1643,1643,1643,1643,1643,1643,1643,1644,1644,1644,1644,1644,1644,1644,1644,
+1645,1645,1645,1645,1645,1645,1645,1645,1646,1646,1646,1646,1646,1646,1646,1646,
+1647,1647,1647,1647,1647,1647,1647,1647,1648,1648,1648,1648,1648,1648,1648,1648,
+1649,1649,1649,1649,1649,1649,1649,1649,1650,1650,1650,1650,1650,1650,1650,1650,
+1651,1651,1651,1651,1651,1651,1651,1651,1652,1652,1652,1652,1652,1652,1652,1652,
+1653,1653,1653,1653,1653,1653,1653,1653,1654,1654,1654,1654,1654,1654,1654,1654,
+1655,1655,1655,1655,1655,1655,1655,1655,1656,1656,1656,1656,1656,1656,1656,1656,
+1657,1657,1657,1657,1657,1657,1657,1657,1658,1658,1658,1658,1658,1658,1658,1658,
+1659,1659,1659,1659,1659,1659,1659,1659,1660,1660,1660,1660,1660,1660,1660,1660,
+1661,1661,1661,1661,1661,1661,1661,1661,1662,1662,1662,1662,1662,1662,1662,1662,
+1663,1663,1663,1663,1663,1663,1663,1663,1664,1664,1664,1664,1664,1664,1664,1664,
+1665,1665,1665,1665,1665,1665,1665,1665,1666,1666,1666,1666,1666,1666,1666,1666,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1667,1667,1667,1667,1667,1667,1667,1667,1668,1668,1668,1668,1668,1668,1668,1668,
+1669,1669,1669,1669,1669,1669,1669,1669,1670,1670,1670,1670,1670,1670,1670,1670,
+1671,1671,1671,1671,1671,1671,1671,1671,1672,1673,0,0,0,0,0,0,
+1674,1674,1674,1674,1674,1674,1674,1674,1675,1675,1675,1675,1675,1675,1675,1675,
+1676,1676,1676,1676,1676,1676,1676,1676,1677,1677,1677,1677,1677,1677,1677,1677,
+1678,1678,1678,1678,1678,1678,1678,1678,1679,1679,1679,1679,1679,1679,1679,1679,
+1680,1680,1680,1680,1680,1680,1680,1680,1681,1681,1681,1681,1681,1681,1681,1681,
+1682,1682,1682,1682,1682,1682,1682,1682,1683,1683,1683,1683,1683,1683,1683,1683,
+1684,1684,1684,1684,1684,1684,1684,1684,1685,1685,1685,1685,1685,1685,1685,1685,
+1686,1686,1686,1686,1686,1686,1686,1686,1687,1687,1687,1687,1687,1687,1687,1687,
+1688,1688,1688,1688,1688,1688,1688,1688,1689,1689,1689,1689,1689,1689,1689,1689,
+1690,1690,1690,1690,1690,1690,1690,1690,1691,1691,1691,1691,1691,1691,1691,1691,
+1692,1692,1692,1692,1692,1692,1692,1692,1693,1693,1693,1693,1693,1693,1693,1693,
+1694,1694,1694,1694,1694,1694,1694,1694,1695,1695,1695,1695,1695,1695,1695,1695,
+1696,1696,1696,1696,1696,1696,1696,1696,1697,1697,1697,1697,1697,1697,1697,1697,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1698,1698,1698,1698,1698,1698,1698,1698,1699,1699,1699,1699,1699,1699,1699,1699,
+1700,1700,1700,1700,1700,1700,1700,1700,1701,1701,1701,1701,1701,1701,1701,1701,
+1702,1702,1702,1702,1702,1702,1702,1702,1703,1704,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1705,1705,1705,1705,1705,1705,1705,1705,1706,1706,1706,1706,1706,1706,1706,1706,
+1707,1707,1707,1707,1707,1707,1707,1707,1708,1708,1708,1708,1708,1708,1708,1708,
+1709,1709,1709,1709,1709,1709,1709,1709,1710,1711,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1712,1712,1712,1712,1712,1712,1712,1712,1713,1713,1713,1713,1713,1713,1713,1713,
+1714,1714,1714,1714,1714,1714,1714,1714,1715,1715,1715,1715,1715,1715,1715,1715,
+1716,1716,1716,1716,1716,1716,1716,1716,1717,1718,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1719,1719,1719,1719,1719,1719,1719,1719,1720,1720,1720,1720,1720,1720,1720,1720,
+1721,1721,1721,1721,1721,1721,1721,1721,1722,1722,1722,1722,1722,1722,1722,1722,
+1723,1723,1723,1723,1723,1723,1723,1723,1724,1725,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1726,1726,1726,1726,1726,1726,1726,1726,1727,1727,1727,1727,1727,1727,1727,1727,
+1728,1728,1728,1728,1728,1728,1728,1728,1729,1729,1729,1729,1729,1729,1729,1729,
+1730,1730,1730,1730,1730,1730,1730,1730,1731,1732,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1733,1733,1733,1733,1733,1733,1733,1733,1734,1734,1734,1734,1734,1734,1734,1734,
+1735,1735,1735,1735,1735,1735,1735,1735,1736,1736,1736,1736,1736,1736,1736,1736,
+1737,1737,1737,1737,1737,1737,1737,1737,1738,1739,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1740,1740,1740,1740,1740,1740,1740,1740,1741,1741,1741,1741,1741,1741,1741,1741,
+1742,1742,1742,1742,1742,1742,1742,1742,1743,1743,1743,1743,1743,1743,1743,1743,
+1744,1744,1744,1744,1744,1744,1744,1744,1745,1746,0,0,0,0,0,0,
+1747,1747,1747,1747,1747,1747,1747,1747,0,0,0,0,0,0,0,0,
+1748,1748,1748,1748,1748,1748,1748,1748,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1749,1749,1749,1749,1749,1749,1749,1749,
+1750,1750,1750,1750,1750,1750,1750,1750,1751,1752,1753,1754,0,0,0,0,
+1755,1755,1755,1755,1755,1755,1755,1755,0,0,0,0,0,0,0,0,
+1756,1756,1756,1756,1756,1756,1756,1756,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1757,1757,1757,1757,1757,1757,1757,1757,
+1758,1758,1758,1758,1758,1758,1758,1758,1759,1760,1761,1762,0,0,0,0,
+1763,1763,1763,1763,1763,1763,1763,1763,0,0,0,0,0,0,0,0,
+1764,1764,1764,1764,1764,1764,1764,1764,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1765,1765,1765,1765,1765,1765,1765,1765,
+1766,1766,1766,1766,1766,1766,1766,1766,1767,1768,0,0,0,0,0,0,
+1769,1769,1769,1769,1769,1769,1769,1769,0,0,0,0,0,0,0,0,
+1770,1770,1770,1770,1770,1770,1770,1770,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1771,1771,1771,1771,1771,1771,1771,1771,
+1772,1772,1772,1772,1772,1772,1772,1772,1773,1774,1775,1776,0,0,0,0,
+1777,1777,1777,1777,1777,1777,1777,1777,0,0,0,0,0,0,0,0,
+1778,1778,1778,1778,1778,1778,1778,1778,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1779,1779,1779,1779,1779,1779,1779,1779,
+1780,1780,1780,1780,1780,1780,1780,1780,1781,1782,0,0,0,0,0,0,
+1783,1783,1783,1783,1783,1783,1783,1783,0,0,0,0,0,0,0,0,
+1784,1784,1784,1784,1784,1784,1784,1784,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1785,1785,1785,1785,1785,1785,1785,1785,
+1786,1786,1786,1786,1786,1786,1786,1786,1787,1788,1789,1790,0,0,0,0,
+1791,1791,1791,1791,1791,1791,1791,1791,0,0,0,0,0,0,0,0,
+1792,1792,1792,1792,1792,1792,1792,1792,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1793,1793,1793,1793,1793,1793,1793,1793,
+1794,1794,1794,1794,1794,1794,1794,1794,1795,1796,0,0,0,0,0,0,
+1797,1797,1797,1797,1797,1797,1797,1797,0,0,0,0,0,0,0,0,
+1798,1798,1798,1798,1798,1798,1798,1798,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1799,1799,1799,1799,1799,1799,1799,1799,
+1800,1800,1800,1800,1800,1800,1800,1800,1801,1802,0,0,0,0,0,0,
+1803,1803,1803,1803,1803,1803,1803,1803,1804,1804,1804,1804,1804,1804,1804,1804,
+1805,1805,1805,1805,1805,1805,1805,1805,1806,1806,1806,1806,1806,1806,1806,1806,
+1807,1807,1807,1807,1807,1807,1807,1807,1808,1808,1808,1808,1808,1808,1808,1808,
+1809,1809,1809,1809,1809,1809,1809,1809,1810,1811,1812,1813,1814,0,0,0,
+1815,1815,1815,1815,1815,1815,1815,1815,1816,1816,1816,1816,1816,1816,1816,1816,
+1817,1817,1817,1817,1817,1817,1817,1817,1818,1818,1818,1818,1818,1818,1818,1818,
+1819,1819,1819,1819,1819,1819,1819,1819,1820,1820,1820,1820,1820,1820,1820,1820,
+1821,1821,1821,1821,1821,1821,1821,1821,1822,1823,1824,1825,1826,0,0,0,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1829,1829,1829,1829,1829,1829,1829,1829,0,0,0,0,0,0,0,0,
+1830,1830,1830,1830,1830,1830,1830,1830,1831,1831,1831,1831,1831,1831,1831,1831,
+1832,1832,1832,1832,1832,1832,1832,1832,1833,1834,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1835,1835,1835,1835,1835,1835,1835,1835,1836,1836,1836,1836,1836,1836,1836,1836,
+0,0,0,0,0,0,0,0,1837,1837,1837,1837,1837,1837,1837,1837,
+1838,1838,1838,1838,1838,1838,1838,1838,1839,1840,1841,1842,0,0,0,0,
+0,0,0,0,0,0,0,0,1843,1843,1843,1843,1843,1843,1843,1843,
+1844,1844,1844,1844,1844,1844,1844,1844,1845,1846,1847,1848,1849,1850,1851,1852,
+0,0,0,0,0,0,0,0,1853,1853,1853,1853,1853,1853,1853,1853,
+1854,1854,1854,1854,1854,1854,1854,1854,1855,1856,1857,1858,1859,1860,1861,1862,
+1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,
+1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,
+1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,
+1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,1863,
+1864,1864,1864,1864,1864,1864,1864,1864,1865,1865,1865,1865,1865,1865,1865,1865,
+1866,1866,1866,1866,1866,1866,1866,1866,1867,1867,1867,1867,1867,1867,1867,1867,
+1868,1868,1868,1868,1868,1868,1868,1868,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+static const uae_u16 op_dispatch_index_0[] = {
+0,1,2,3,4,5,6,7,8,9,10,11,4,5,6,7,
+12,13,14,15,4,5,6,7,16,17,18,19,4,5,6,7,
+20,21,22,23,4,5,6,7,24,25,26,27,4,5,6,7,
+28,29,30,31,4,5,6,7,32,33,34,35,4,5,6,7,
+36,37,38,39,40,41,42,43,36,37,38,39,40,41,42,44,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+45,46,47,48,49,50,51,52,45,46,47,48,49,50,51,53,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+54,55,56,57,58,59,60,61,54,55,56,57,58,59,60,62,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+63,64,65,66,67,37,68,69,70,71,72,73,67,37,68,69,
+74,75,76,77,67,37,68,69,78,79,80,81,67,37,68,69,
+82,83,84,85,67,37,68,86,87,88,89,90,67,37,68,69,
+91,92,93,94,67,37,68,69,37,95,96,97,67,37,68,69,
+98,99,100,101,102,103,104,105,98,99,100,106,102,103,104,107,
+98,99,100,108,102,103,104,109,98,99,100,110,102,103,104,111,
+98,99,100,112,102,103,104,113,98,99,100,114,102,103,104,115,
+98,99,100,116,102,103,104,117,98,99,100,118,102,103,104,119,
+120,121,121,122,123,124,124,125,126,127,127,128,129,130,130,131,
+132,133,133,134,135,136,136,137,138,139,139,140,141,142,142,143,
+144,145,145,146,147,148,148,149,150,151,151,152,153,154,154,155,
+156,157,157,158,159,160,160,161,162,163,163,164,165,166,166,167,
+168,168,168,168,169,170,170,170,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+211,212,213,214,215,216,217,218,211,212,213,219,215,216,217,220,
+211,212,213,221,215,216,217,222,211,212,213,223,215,216,217,224,
+211,212,213,225,215,216,217,226,211,212,213,227,215,216,217,228,
+211,212,213,229,215,216,217,230,211,212,213,231,215,216,217,232,
+37,37,37,37,37,37,37,37,233,234,235,236,237,238,37,37,
+239,239,239,239,240,240,240,240,241,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+};
+const struct cpudispatch_tbl op_dispatch_0 = {
+	op_dispatch_handlers_0, op_dispatch_pages_0, op_dispatch_index_0, 1869, 242
+};
+
+/* CPU level 3: 1843 handlers, 239 pages */
+static cpuop_func *const op_dispatch_handlers_1[] = {
+op_illg_1,
+op_0_0_ff,
+op_10_0_ff,
+op_18_0_ff,
+op_20_0_ff,
+op_28_0_ff,
+op_30_0_ff,
+op_38_0_ff,
+op_39_0_ff,
+op_3c_0_ff,
+op_40_0_ff,
+op_50_0_ff,
+op_58_0_ff,
+op_60_0_ff,
+op_68_0_ff,
+op_70_0_ff,
+op_78_0_ff,
+op_79_0_ff,
+op_7c_0_ff,
+op_80_0_ff,
+op_90_0_ff,
+op_98_0_ff,
+op_a0_0_ff,
+op_a8_0_ff,
+op_b0_0_ff,
+op_b8_0_ff,
+op_b9_0_ff,
+op_d0_0_ff,
+op_e8_0_ff,
+op_f0_0_ff,
+op_f8_0_ff,
+op_f9_0_ff,
+op_fa_0_ff,
+op_fb_0_ff,
+op_100_0_ff,
+op_108_0_ff,
+op_110_0_ff,
+op_118_0_ff,
+op_120_0_ff,
+op_128_0_ff,
+op_130_0_ff,
+op_138_0_ff,
+op_139_0_ff,
+op_13a_0_ff,
+op_13b_0_ff,
+op_13c_0_ff,
+op_140_0_ff,
+op_148_0_ff,
+op_150_0_ff,
+op_158_0_ff,
+op_160_0_ff,
+op_168_0_ff,
+op_170_0_ff,
+op_178_0_ff,
+op_179_0_ff,
+op_17a_0_ff,
+op_17b_0_ff,
+op_180_0_ff,
+op_188_0_ff,
+op_190_0_ff,
+op_198_0_ff,
+op_1a0_0_ff,
+op_1a8_0_ff,
+op_1b0_0_ff,
+op_1b8_0_ff,
+op_1b9_0_ff,
+op_1ba_0_ff,
+op_1bb_0_ff,
+op_1c0_0_ff,
+op_1c8_0_ff,
+op_1d0_0_ff,
+op_1d8_0_ff,
+op_1e0_0_ff,
+op_1e8_0_ff,
+op_1f0_0_ff,
+op_1f8_0_ff,
+op_1f9_0_ff,
+op_1fa_0_ff,
+op_1fb_0_ff,
+op_200_0_ff,
+op_210_0_ff,
+op_218_0_ff,
+op_220_0_ff,
+op_228_0_ff,
+op_230_0_ff,
+op_238_0_ff,
+op_239_0_ff,
+op_23c_0_ff,
+op_240_0_ff,
+op_250_0_ff,
+op_258_0_ff,
+op_260_0_ff,
+op_268_0_ff,
+op_270_0_ff,
+op_278_0_ff,
+op_279_0_ff,
+op_27c_0_ff,
+op_280_0_ff,
+op_290_0_ff,
+op_298_0_ff,
+op_2a0_0_ff,
+op_2a8_0_ff,
+op_2b0_0_ff,
+op_2b8_0_ff,
+op_2b9_0_ff,
+op_2d0_0_ff,
+op_2e8_0_ff,
+op_2f0_0_ff,
+op_2f8_0_ff,
+op_2f9_0_ff,
+op_2fa_0_ff,
+op_2fb_0_ff,
+op_400_0_ff,
+op_410_0_ff,
+op_418_0_ff,
+op_420_0_ff,
+op_428_0_ff,
+op_430_0_ff,
+op_438_0_ff,
+op_439_0_ff,
+op_440_0_ff,
+op_450_0_ff,
+op_458_0_ff,
+op_460_0_ff,
+op_468_0_ff,
+op_470_0_ff,
+op_478_0_ff,
+op_479_0_ff,
+op_480_0_ff,
+op_490_0_ff,
+op_498_0_ff,
+op_4a0_0_ff,
+op_4a8_0_ff,
+op_4b0_0_ff,
+op_4b8_0_ff,
+op_4b9_0_ff,
+op_4d0_0_ff,
+op_4e8_0_ff,
+op_4f0_0_ff,
+op_4f8_0_ff,
+op_4f9_0_ff,
+op_4fa_0_ff,
+op_4fb_0_ff,
+op_600_0_ff,
+op_610_0_ff,
+op_618_0_ff,
+op_620_0_ff,
+op_628_0_ff,
+op_630_0_ff,
+op_638_0_ff,
+op_639_0_ff,
+op_640_0_ff,
+op_650_0_ff,
+op_658_0_ff,
+op_660_0_ff,
+op_668_0_ff,
+op_670_0_ff,
+op_678_0_ff,
+op_679_0_ff,
+op_680_0_ff,
+op_690_0_ff,
+op_698_0_ff,
+op_6a0_0_ff,
+op_6a8_0_ff,
+op_6b0_0_ff,
+op_6b8_0_ff,
+op_6b9_0_ff,
+op_6c0_0_ff,
+op_6c8_0_ff,
+op_6d0_0_ff,
+op_6e8_0_ff,
+op_6f0_0_ff,
+op_6f8_0_ff,
+op_6f9_0_ff,
+op_6fa_0_ff,
+op_6fb_0_ff,
+op_800_0_ff,
+op_810_0_ff,
+op_818_0_ff,
+op_820_0_ff,
+op_828_0_ff,
+op_830_0_ff,
+op_838_0_ff,
+op_839_0_ff,
+op_83a_0_ff,
+op_83b_0_ff,
+op_83c_0_ff,
+op_840_0_ff,
+op_850_0_ff,
+op_858_0_ff,
+op_860_0_ff,
+op_868_0_ff,
+op_870_0_ff,
+op_878_0_ff,
+op_879_0_ff,
+op_87a_0_ff,
+op_87b_0_ff,
+op_880_0_ff,
+op_890_0_ff,
+op_898_0_ff,
+op_8a0_0_ff,
+op_8a8_0_ff,
+op_8b0_0_ff,
+op_8b8_0_ff,
+op_8b9_0_ff,
+op_8ba_0_ff,
+op_8bb_0_ff,
+op_8c0_0_ff,
+op_8d0_0_ff,
+op_8d8_0_ff,
+op_8e0_0_ff,
+op_8e8_0_ff,
+op_8f0_0_ff,
+op_8f8_0_ff,
+op_8f9_0_ff,
+op_8fa_0_ff,
+op_8fb_0_ff,
+op_a00_0_ff,
+op_a10_0_ff,
+op_a18_0_ff,
+op_a20_0_ff,
+op_a28_0_ff,
+op_a30_0_ff,
+op_a38_0_ff,
+op_a39_0_ff,
+op_a3c_0_ff,
+op_a40_0_ff,
+op_a50_0_ff,
+op_a58_0_ff,
+op_a60_0_ff,
+op_a68_0_ff,
+op_a70_0_ff,
+op_a78_0_ff,
+op_a79_0_ff,
+op_a7c_0_ff,
+op_a80_0_ff,
+op_a90_0_ff,
+op_a98_0_ff,
+op_aa0_0_ff,
+op_aa8_0_ff,
+op_ab0_0_ff,
+op_ab8_0_ff,
+op_ab9_0_ff,
+op_ad0_0_ff,
+op_ad8_0_ff,
+op_ae0_0_ff,
+op_ae8_0_ff,
+op_af0_0_ff,
+op_af8_0_ff,
+op_af9_0_ff,
+op_c00_0_ff,
+op_c10_0_ff,
+op_c18_0_ff,
+op_c20_0_ff,
+op_c28_0_ff,
+op_c30_0_ff,
+op_c38_0_ff,
+op_c39_0_ff,
+op_c3a_0_ff,
+op_c3b_0_ff,
+op_c40_0_ff,
+op_c50_0_ff,
+op_c58_0_ff,
+op_c60_0_ff,
+op_c68_0_ff,
+op_c70_0_ff,
+op_c78_0_ff,
+op_c79_0_ff,
+op_c7a_0_ff,
+op_c7b_0_ff,
+op_c80_0_ff,
+op_c90_0_ff,
+op_c98_0_ff,
+op_ca0_0_ff,
+op_ca8_0_ff,
+op_cb0_0_ff,
+op_cb8_0_ff,
+op_cb9_0_ff,
+op_cba_0_ff,
+op_cbb_0_ff,
+op_cd0_0_ff,
+op_cd8_0_ff,
+op_ce0_0_ff,
+op_ce8_0_ff,
+op_cf0_0_ff,
+op_cf8_0_ff,
+op_cf9_0_ff,
+op_cfc_0_ff,
+op_e10_0_ff,
+op_e18_0_ff,
+op_e20_0_ff,
+op_e28_0_ff,
+op_e30_0_ff,
+op_e38_0_ff,
+op_e39_0_ff,
+op_e50_0_ff,
+op_e58_0_ff,
+op_e60_0_ff,
+op_e68_0_ff,
+op_e70_0_ff,
+op_e78_0_ff,
+op_e79_0_ff,
+op_e90_0_ff,
+op_e98_0_ff,
+op_ea0_0_ff,
+op_ea8_0_ff,
+op_eb0_0_ff,
+op_eb8_0_ff,
+op_eb9_0_ff,
+op_ed0_0_ff,
+op_ed8_0_ff,
+op_ee0_0_ff,
+op_ee8_0_ff,
+op_ef0_0_ff,
+op_ef8_0_ff,
+op_ef9_0_ff,
+op_efc_0_ff,
+op_1000_0_ff,
+op_1010_0_ff,
+op_1018_0_ff,
+op_1020_0_ff,
+op_1028_0_ff,
+op_1030_0_ff,
+op_1038_0_ff,
+op_1039_0_ff,
+op_103a_0_ff,
+op_103b_0_ff,
+op_103c_0_ff,
+op_1080_0_ff,
+op_1090_0_ff,
+op_1098_0_ff,
+op_10a0_0_ff,
+op_10a8_0_ff,
+op_10b0_0_ff,
+op_10b8_0_ff,
+op_10b9_0_ff,
+op_10ba_0_ff,
+op_10bb_0_ff,
+op_10bc_0_ff,
+op_10c0_0_ff,
+op_10d0_0_ff,
+op_10d8_0_ff,
+op_10e0_0_ff,
+op_10e8_0_ff,
+op_10f0_0_ff,
+op_10f8_0_ff,
+op_10f9_0_ff,
+op_10fa_0_ff,
+op_10fb_0_ff,
+op_10fc_0_ff,
+op_1100_0_ff,
+op_1110_0_ff,
+op_1118_0_ff,
+op_1120_0_ff,
+op_1128_0_ff,
+op_1130_0_ff,
+op_1138_0_ff,
+op_1139_0_ff,
+op_113a_0_ff,
+op_113b_0_ff,
+op_113c_0_ff,
+op_1140_0_ff,
+op_1150_0_ff,
+op_1158_0_ff,
+op_1160_0_ff,
+op_1168_0_ff,
+op_1170_0_ff,
+op_1178_0_ff,
+op_1179_0_ff,
+op_117a_0_ff,
+op_117b_0_ff,
+op_117c_0_ff,
+op_1180_0_ff,
+op_1190_0_ff,
+op_1198_0_ff,
+op_11a0_0_ff,
+op_11a8_0_ff,
+op_11b0_0_ff,
+op_11b8_0_ff,
+op_11b9_0_ff,
+op_11ba_0_ff,
+op_11bb_0_ff,
+op_11bc_0_ff,
+op_11c0_0_ff,
+op_11d0_0_ff,
+op_11d8_0_ff,
+op_11e0_0_ff,
+op_11e8_0_ff,
+op_11f0_0_ff,
+op_11f8_0_ff,
+op_11f9_0_ff,
+op_11fa_0_ff,
+op_11fb_0_ff,
+op_11fc_0_ff,
+op_13c0_0_ff,
+op_13d0_0_ff,
+op_13d8_0_ff,
+op_13e0_0_ff,
+op_13e8_0_ff,
+op_13f0_0_ff,
+op_13f8_0_ff,
+op_13f9_0_ff,
+op_13fa_0_ff,
+op_13fb_0_ff,
+op_13fc_0_ff,
+op_2000_0_ff,
+op_2008_0_ff,
+op_2010_0_ff,
+op_2018_0_ff,
+op_2020_0_ff,
+op_2028_0_ff,
+op_2030_0_ff,
+op_2038_0_ff,
+op_2039_0_ff,
+op_203a_0_ff,
+op_203b_0_ff,
+op_203c_0_ff,
+op_2040_0_ff,
+op_2048_0_ff,
+op_2050_0_ff,
+op_2058_0_ff,
+op_2060_0_ff,
+op_2068_0_ff,
+op_2070_0_ff,
+op_2078_0_ff,
+op_2079_0_ff,
+op_207a_0_ff,
+op_207b_0_ff,
+op_207c_0_ff,
+op_2080_0_ff,
+op_2088_0_ff,
+op_2090_0_ff,
+op_2098_0_ff,
+op_20a0_0_ff,
+op_20a8_0_ff,
+op_20b0_0_ff,
+op_20b8_0_ff,
+op_20b9_0_ff,
+op_20ba_0_ff,
+op_20bb_0_ff,
+op_20bc_0_ff,
+op_20c0_0_ff,
+op_20c8_0_ff,
+op_20d0_0_ff,
+op_20d8_0_ff,
+op_20e0_0_ff,
+op_20e8_0_ff,
+op_20f0_0_ff,
+op_20f8_0_ff,
+op_20f9_0_ff,
+op_20fa_0_ff,
+op_20fb_0_ff,
+op_20fc_0_ff,
+op_2100_0_ff,
+op_2108_0_ff,
+op_2110_0_ff,
+op_2118_0_ff,
+op_2120_0_ff,
+op_2128_0_ff,
+op_2130_0_ff,
+op_2138_0_ff,
+op_2139_0_ff,
+op_213a_0_ff,
+op_213b_0_ff,
+op_213c_0_ff,
+op_2140_0_ff,
+op_2148_0_ff,
+op_2150_0_ff,
+op_2158_0_ff,
+op_2160_0_ff,
+op_2168_0_ff,
+op_2170_0_ff,
+op_2178_0_ff,
+op_2179_0_ff,
+op_217a_0_ff,
+op_217b_0_ff,
+op_217c_0_ff,
+op_2180_0_ff,
+op_2188_0_ff,
+op_2190_0_ff,
+op_2198_0_ff,
+op_21a0_0_ff,
+op_21a8_0_ff,
+op_21b0_0_ff,
+op_21b8_0_ff,
+op_21b9_0_ff,
+op_21ba_0_ff,
+op_21bb_0_ff,
+op_21bc_0_ff,
+op_21c0_0_ff,
+op_21c8_0_ff,
+op_21d0_0_ff,
+op_21d8_0_ff,
+op_21e0_0_ff,
+op_21e8_0_ff,
+op_21f0_0_ff,
+op_21f8_0_ff,
+op_21f9_0_ff,
+op_21fa_0_ff,
+op_21fb_0_ff,
+op_21fc_0_ff,
+op_23c0_0_ff,
+op_23c8_0_ff,
+op_23d0_0_ff,
+op_23d8_0_ff,
+op_23e0_0_ff,
+op_23e8_0_ff,
+op_23f0_0_ff,
+op_23f8_0_ff,
+op_23f9_0_ff,
+op_23fa_0_ff,
+op_23fb_0_ff,
+op_23fc_0_ff,
+op_3000_0_ff,
+op_3008_0_ff,
+op_3010_0_ff,
+op_3018_0_ff,
+op_3020_0_ff,
+op_3028_0_ff,
+op_3030_0_ff,
+op_3038_0_ff,
+op_3039_0_ff,
+op_303a_0_ff,
+op_303b_0_ff,
+op_303c_0_ff,
+op_3040_0_ff,
+op_3048_0_ff,
+op_3050_0_ff,
+op_3058_0_ff,
+op_3060_0_ff,
+op_3068_0_ff,
+op_3070_0_ff,
+op_3078_0_ff,
+op_3079_0_ff,
+op_307a_0_ff,
+op_307b_0_ff,
+op_307c_0_ff,
+op_3080_0_ff,
+op_3088_0_ff,
+op_3090_0_ff,
+op_3098_0_ff,
+op_30a0_0_ff,
+op_30a8_0_ff,
+op_30b0_0_ff,
+op_30b8_0_ff,
+op_30b9_0_ff,
+op_30ba_0_ff,
+op_30bb_0_ff,
+op_30bc_0_ff,
+op_30c0_0_ff,
+op_30c8_0_ff,
+op_30d0_0_ff,
+op_30d8_0_ff,
+op_30e0_0_ff,
+op_30e8_0_ff,
+op_30f0_0_ff,
+op_30f8_0_ff,
+op_30f9_0_ff,
+op_30fa_0_ff,
+op_30fb_0_ff,
+op_30fc_0_ff,
+op_3100_0_ff,
+op_3108_0_ff,
+op_3110_0_ff,
+op_3118_0_ff,
+op_3120_0_ff,
+op_3128_0_ff,
+op_3130_0_ff,
+op_3138_0_ff,
+op_3139_0_ff,
+op_313a_0_ff,
+op_313b_0_ff,
+op_313c_0_ff,
+op_3140_0_ff,
+op_3148_0_ff,
+op_3150_0_ff,
+op_3158_0_ff,
+op_3160_0_ff,
+op_3168_0_ff,
+op_3170_0_ff,
+op_3178_0_ff,
+op_3179_0_ff,
+op_317a_0_ff,
+op_317b_0_ff,
+op_317c_0_ff,
+op_3180_0_ff,
+op_3188_0_ff,
+op_3190_0_ff,
+op_3198_0_ff,
+op_31a0_0_ff,
+op_31a8_0_ff,
+op_31b0_0_ff,
+op_31b8_0_ff,
+op_31b9_0_ff,
+op_31ba_0_ff,
+op_31bb_0_ff,
+op_31bc_0_ff,
+op_31c0_0_ff,
+op_31c8_0_ff,
+op_31d0_0_ff,
+op_31d8_0_ff,
+op_31e0_0_ff,
+op_31e8_0_ff,
+op_31f0_0_ff,
+op_31f8_0_ff,
+op_31f9_0_ff,
+op_31fa_0_ff,
+op_31fb_0_ff,
+op_31fc_0_ff,
+op_33c0_0_ff,
+op_33c8_0_ff,
+op_33d0_0_ff,
+op_33d8_0_ff,
+op_33e0_0_ff,
+op_33e8_0_ff,
+op_33f0_0_ff,
+op_33f8_0_ff,
+op_33f9_0_ff,
+op_33fa_0_ff,
+op_33fb_0_ff,
+op_33fc_0_ff,
+op_4000_0_ff,
+op_4010_0_ff,
+op_4018_0_ff,
+op_4020_0_ff,
+op_4028_0_ff,
+op_4030_0_ff,
+op_4038_0_ff,
+op_4039_0_ff,
+op_4040_0_ff,
+op_4050_0_ff,
+op_4058_0_ff,
+op_4060_0_ff,
+op_4068_0_ff,
+op_4070_0_ff,
+op_4078_0_ff,
+op_4079_0_ff,
+op_4080_0_ff,
+op_4090_0_ff,
+op_4098_0_ff,
+op_40a0_0_ff,
+op_40a8_0_ff,
+op_40b0_0_ff,
+op_40b8_0_ff,
+op_40b9_0_ff,
+op_40c0_0_ff,
+op_40d0_0_ff,
+op_40d8_0_ff,
+op_40e0_0_ff,
+op_40e8_0_ff,
+op_40f0_0_ff,
+op_40f8_0_ff,
+op_40f9_0_ff,
+op_4100_0_ff,
+op_4110_0_ff,
+op_4118_0_ff,
+op_4120_0_ff,
+op_4128_0_ff,
+op_4130_0_ff,
+op_4138_0_ff,
+op_4139_0_ff,
+op_413a_0_ff,
+op_413b_0_ff,
+op_413c_0_ff,
+op_4180_0_ff,
+op_4190_0_ff,
+op_4198_0_ff,
+op_41a0_0_ff,
+op_41a8_0_ff,
+op_41b0_0_ff,
+op_41b8_0_ff,
+op_41b9_0_ff,
+op_41ba_0_ff,
+op_41bb_0_ff,
+op_41bc_0_ff,
+op_41d0_0_ff,
+op_41e8_0_ff,
+op_41f0_0_ff,
+op_41f8_0_ff,
+op_41f9_0_ff,
+op_41fa_0_ff,
+op_41fb_0_ff,
+op_4200_0_ff,
+op_4210_0_ff,
+op_4218_0_ff,
+op_4220_0_ff,
+op_4228_0_ff,
+op_4230_0_ff,
+op_4238_0_ff,
+op_4239_0_ff,
+op_4240_0_ff,
+op_4250_0_ff,
+op_4258_0_ff,
+op_4260_0_ff,
+op_4268_0_ff,
+op_4270_0_ff,
+op_4278_0_ff,
+op_4279_0_ff,
+op_4280_0_ff,
+op_4290_0_ff,
+op_4298_0_ff,
+op_42a0_0_ff,
+op_42a8_0_ff,
+op_42b0_0_ff,
+op_42b8_0_ff,
+op_42b9_0_ff,
+op_42c0_0_ff,
+op_42d0_0_ff,
+op_42d8_0_ff,
+op_42e0_0_ff,
+op_42e8_0_ff,
+op_42f0_0_ff,
+op_42f8_0_ff,
+op_42f9_0_ff,
+op_4400_0_ff,
+op_4410_0_ff,
+op_4418_0_ff,
+op_4420_0_ff,
+op_4428_0_ff,
+op_4430_0_ff,
+op_4438_0_ff,
+op_4439_0_ff,
+op_4440_0_ff,
+op_4450_0_ff,
+op_4458_0_ff,
+op_4460_0_ff,
+op_4468_0_ff,
+op_4470_0_ff,
+op_4478_0_ff,
+op_4479_0_ff,
+op_4480_0_ff,
+op_4490_0_ff,
+op_4498_0_ff,
+op_44a0_0_ff,
+op_44a8_0_ff,
+op_44b0_0_ff,
+op_44b8_0_ff,
+op_44b9_0_ff,
+op_44c0_0_ff,
+op_44d0_0_ff,
+op_44d8_0_ff,
+op_44e0_0_ff,
+op_44e8_0_ff,
+op_44f0_0_ff,
+op_44f8_0_ff,
+op_44f9_0_ff,
+op_44fa_0_ff,
+op_44fb_0_ff,
+op_44fc_0_ff,
+op_4600_0_ff,
+op_4610_0_ff,
+op_4618_0_ff,
+op_4620_0_ff,
+op_4628_0_ff,
+op_4630_0_ff,
+op_4638_0_ff,
+op_4639_0_ff,
+op_4640_0_ff,
+op_4650_0_ff,
+op_4658_0_ff,
+op_4660_0_ff,
+op_4668_0_ff,
+op_4670_0_ff,
+op_4678_0_ff,
+op_4679_0_ff,
+op_4680_0_ff,
+op_4690_0_ff,
+op_4698_0_ff,
+op_46a0_0_ff,
+op_46a8_0_ff,
+op_46b0_0_ff,
+op_46b8_0_ff,
+op_46b9_0_ff,
+op_46c0_0_ff,
+op_46d0_0_ff,
+op_46d8_0_ff,
+op_46e0_0_ff,
+op_46e8_0_ff,
+op_46f0_0_ff,
+op_46f8_0_ff,
+op_46f9_0_ff,
+op_46fa_0_ff,
+op_46fb_0_ff,
+op_46fc_0_ff,
+op_4800_1_ff,
+op_4808_0_ff,
+op_4810_1_ff,
+op_4818_1_ff,
+op_4820_1_ff,
+op_4828_1_ff,
+op_4830_1_ff,
+op_4838_1_ff,
+op_4839_1_ff,
+op_4840_0_ff,
+op_4848_0_ff,
+op_4850_0_ff,
+op_4868_0_ff,
+op_4870_0_ff,
+op_4878_0_ff,
+op_4879_0_ff,
+op_487a_0_ff,
+op_487b_0_ff,
+op_4880_0_ff,
+op_4890_0_ff,
+op_48a0_0_ff,
+op_48a8_0_ff,
+op_48b0_0_ff,
+op_48b8_0_ff,
+op_48b9_0_ff,
+op_48c0_0_ff,
+op_48d0_0_ff,
+op_48e0_0_ff,
+op_48e8_0_ff,
+op_48f0_0_ff,
+op_48f8_0_ff,
+op_48f9_0_ff,
+op_49c0_0_ff,
+op_4a00_0_ff,
+op_4a10_0_ff,
+op_4a18_0_ff,
+op_4a20_0_ff,
+op_4a28_0_ff,
+op_4a30_0_ff,
+op_4a38_0_ff,
+op_4a39_0_ff,
+op_4a3a_0_ff,
+op_4a3b_0_ff,
+op_4a3c_0_ff,
+op_4a40_0_ff,
+op_4a48_0_ff,
+op_4a50_0_ff,
+op_4a58_0_ff,
+op_4a60_0_ff,
+op_4a68_0_ff,
+op_4a70_0_ff,
+op_4a78_0_ff,
+op_4a79_0_ff,
+op_4a7a_0_ff,
+op_4a7b_0_ff,
+op_4a7c_0_ff,
+op_4a80_0_ff,
+op_4a88_0_ff,
+op_4a90_0_ff,
+op_4a98_0_ff,
+op_4aa0_0_ff,
+op_4aa8_0_ff,
+op_4ab0_0_ff,
+op_4ab8_0_ff,
+op_4ab9_0_ff,
+op_4aba_0_ff,
+op_4abb_0_ff,
+op_4abc_0_ff,
+op_4ac0_0_ff,
+op_4ad0_0_ff,
+op_4ad8_0_ff,
+op_4ae0_0_ff,
+op_4ae8_0_ff,
+op_4af0_0_ff,
+op_4af8_0_ff,
+op_4af9_0_ff,
+op_4c00_0_ff,
+op_4c10_0_ff,
+op_4c18_0_ff,
+op_4c20_0_ff,
+op_4c28_0_ff,
+op_4c30_0_ff,
+op_4c38_0_ff,
+op_4c39_0_ff,
+op_4c3a_0_ff,
+op_4c3b_0_ff,
+op_4c3c_0_ff,
+op_4c40_0_ff,
+op_4c50_0_ff,
+op_4c58_0_ff,
+op_4c60_0_ff,
+op_4c68_0_ff,
+op_4c70_0_ff,
+op_4c78_0_ff,
+op_4c79_0_ff,
+op_4c7a_0_ff,
+op_4c7b_0_ff,
+op_4c7c_0_ff,
+op_4c90_0_ff,
+op_4c98_0_ff,
+op_4ca8_0_ff,
+op_4cb0_0_ff,
+op_4cb8_0_ff,
+op_4cb9_0_ff,
+op_4cba_0_ff,
+op_4cbb_0_ff,
+op_4cd0_0_ff,
+op_4cd8_0_ff,
+op_4ce8_0_ff,
+op_4cf0_0_ff,
+op_4cf8_0_ff,
+op_4cf9_0_ff,
+op_4cfa_0_ff,
+op_4cfb_0_ff,
+op_4e40_0_ff,
+op_4e50_0_ff,
+op_4e58_0_ff,
+op_4e60_0_ff,
+op_4e68_0_ff,
+op_4e70_0_ff,
+op_4e71_0_ff,
+op_4e72_0_ff,
+op_4e73_0_ff,
+op_4e74_0_ff,
+op_4e75_0_ff,
+op_4e76_0_ff,
+op_4e77_0_ff,
+op_4e7a_0_ff,
+op_4e7b_0_ff,
+op_4e90_0_ff,
+op_4ea8_0_ff,
+op_4eb0_0_ff,
+op_4eb8_0_ff,
+op_4eb9_0_ff,
+op_4eba_0_ff,
+op_4ebb_0_ff,
+op_4ed0_0_ff,
+op_4ee8_0_ff,
+op_4ef0_0_ff,
+op_4ef8_0_ff,
+op_4ef9_0_ff,
+op_4efa_0_ff,
+op_4efb_0_ff,
+op_5000_0_ff,
+op_5010_0_ff,
+op_5018_0_ff,
+op_5020_0_ff,
+op_5028_0_ff,
+op_5030_0_ff,
+op_5038_0_ff,
+op_5039_0_ff,
+op_5040_0_ff,
+op_5048_0_ff,
+op_5050_0_ff,
+op_5058_0_ff,
+op_5060_0_ff,
+op_5068_0_ff,
+op_5070_0_ff,
+op_5078_0_ff,
+op_5079_0_ff,
+op_5080_0_ff,
+op_5088_0_ff,
+op_5090_0_ff,
+op_5098_0_ff,
+op_50a0_0_ff,
+op_50a8_0_ff,
+op_50b0_0_ff,
+op_50b8_0_ff,
+op_50b9_0_ff,
+op_50c0_0_ff,
+op_50c8_0_ff,
+op_50d0_0_ff,
+op_50d8_0_ff,
+op_50e0_0_ff,
+op_50e8_0_ff,
+op_50f0_0_ff,
+op_50f8_0_ff,
+op_50f9_0_ff,
+op_50fa_0_ff,
+op_50fb_0_ff,
+op_50fc_0_ff,
+op_5100_0_ff,
+op_5110_0_ff,
+op_5118_0_ff,
+op_5120_0_ff,
+op_5128_0_ff,
+op_5130_0_ff,
+op_5138_0_ff,
+op_5139_0_ff,
+op_5140_0_ff,
+op_5148_0_ff,
+op_5150_0_ff,
+op_5158_0_ff,
+op_5160_0_ff,
+op_5168_0_ff,
+op_5170_0_ff,
+op_5178_0_ff,
+op_5179_0_ff,
+op_5180_0_ff,
+op_5188_0_ff,
+op_5190_0_ff,
+op_5198_0_ff,
+op_51a0_0_ff,
+op_51a8_0_ff,
+op_51b0_0_ff,
+op_51b8_0_ff,
+op_51b9_0_ff,
+op_51c0_0_ff,
+op_51c8_0_ff,
+op_51d0_0_ff,
+op_51d8_0_ff,
+op_51e0_0_ff,
+op_51e8_0_ff,
+op_51f0_0_ff,
+op_51f8_0_ff,
+op_51f9_0_ff,
+op_51fa_0_ff,
+op_51fb_0_ff,
+op_51fc_0_ff,
+op_52c0_0_ff,
+op_52c8_0_ff,
+op_52d0_0_ff,
+op_52d8_0_ff,
+op_52e0_0_ff,
+op_52e8_0_ff,
+op_52f0_0_ff,
+op_52f8_0_ff,
+op_52f9_0_ff,
+op_52fa_0_ff,
+op_52fb_0_ff,
+op_52fc_0_ff,
+op_53c0_0_ff,
+op_53c8_0_ff,
+op_53d0_0_ff,
+op_53d8_0_ff,
+op_53e0_0_ff,
+op_53e8_0_ff,
+op_53f0_0_ff,
+op_53f8_0_ff,
+op_53f9_0_ff,
+op_53fa_0_ff,
+op_53fb_0_ff,
+op_53fc_0_ff,
+op_54c0_0_ff,
+op_54c8_0_ff,
+op_54d0_0_ff,
+op_54d8_0_ff,
+op_54e0_0_ff,
+op_54e8_0_ff,
+op_54f0_0_ff,
+op_54f8_0_ff,
+op_54f9_0_ff,
+op_54fa_0_ff,
+op_54fb_0_ff,
+op_54fc_0_ff,
+op_55c0_0_ff,
+op_55c8_0_ff,
+op_55d0_0_ff,
+op_55d8_0_ff,
+op_55e0_0_ff,
+op_55e8_0_ff,
+op_55f0_0_ff,
+op_55f8_0_ff,
+op_55f9_0_ff,
+op_55fa_0_ff,
+op_55fb_0_ff,
+op_55fc_0_ff,
+op_56c0_0_ff,
+op_56c8_0_ff,
+op_56d0_0_ff,
+op_56d8_0_ff,
+op_56e0_0_ff,
+op_56e8_0_ff,
+op_56f0_0_ff,
+op_56f8_0_ff,
+op_56f9_0_ff,
+op_56fa_0_ff,
+op_56fb_0_ff,
+op_56fc_0_ff,
+op_57c0_0_ff,
+op_57c8_0_ff,
+op_57d0_0_ff,
+op_57d8_0_ff,
+op_57e0_0_ff,
+op_57e8_0_ff,
+op_57f0_0_ff,
+op_57f8_0_ff,
+op_57f9_0_ff,
+op_57fa_0_ff,
+op_57fb_0_ff,
+op_57fc_0_ff,
+op_58c0_0_ff,
+op_58c8_0_ff,
+op_58d0_0_ff,
+op_58d8_0_ff,
+op_58e0_0_ff,
+op_58e8_0_ff,
+op_58f0_0_ff,
+op_58f8_0_ff,
+op_58f9_0_ff,
+op_58fa_0_ff,
+op_58fb_0_ff,
+op_58fc_0_ff,
+op_59c0_0_ff,
+op_59c8_0_ff,
+op_59d0_0_ff,
+op_59d8_0_ff,
+op_59e0_0_ff,
+op_59e8_0_ff,
+op_59f0_0_ff,
+op_59f8_0_ff,
+op_59f9_0_ff,
+op_59fa_0_ff,
+op_59fb_0_ff,
+op_59fc_0_ff,
+op_5ac0_0_ff,
+op_5ac8_0_ff,
+op_5ad0_0_ff,
+op_5ad8_0_ff,
+op_5ae0_0_ff,
+op_5ae8_0_ff,
+op_5af0_0_ff,
+op_5af8_0_ff,
+op_5af9_0_ff,
+op_5afa_0_ff,
+op_5afb_0_ff,
+op_5afc_0_ff,
+op_5bc0_0_ff,
+op_5bc8_0_ff,
+op_5bd0_0_ff,
+op_5bd8_0_ff,
+op_5be0_0_ff,
+op_5be8_0_ff,
+op_5bf0_0_ff,
+op_5bf8_0_ff,
+op_5bf9_0_ff,
+op_5bfa_0_ff,
+op_5bfb_0_ff,
+op_5bfc_0_ff,
+op_5cc0_0_ff,
+op_5cc8_0_ff,
+op_5cd0_0_ff,
+op_5cd8_0_ff,
+op_5ce0_0_ff,
+op_5ce8_0_ff,
+op_5cf0_0_ff,
+op_5cf8_0_ff,
+op_5cf9_0_ff,
+op_5cfa_0_ff,
+op_5cfb_0_ff,
+op_5cfc_0_ff,
+op_5dc0_0_ff,
+op_5dc8_0_ff,
+op_5dd0_0_ff,
+op_5dd8_0_ff,
+op_5de0_0_ff,
+op_5de8_0_ff,
+op_5df0_0_ff,
+op_5df8_0_ff,
+op_5df9_0_ff,
+op_5dfa_0_ff,
+op_5dfb_0_ff,
+op_5dfc_0_ff,
+op_5ec0_0_ff,
+op_5ec8_0_ff,
+op_5ed0_0_ff,
+op_5ed8_0_ff,
+op_5ee0_0_ff,
+op_5ee8_0_ff,
+op_5ef0_0_ff,
+op_5ef8_0_ff,
+op_5ef9_0_ff,
+op_5efa_0_ff,
+op_5efb_0_ff,
+op_5efc_0_ff,
+op_5fc0_0_ff,
+op_5fc8_0_ff,
+op_5fd0_0_ff,
+op_5fd8_0_ff,
+op_5fe0_0_ff,
+op_5fe8_0_ff,
+op_5ff0_0_ff,
+op_5ff8_0_ff,
+op_5ff9_0_ff,
+op_5ffa_0_ff,
+op_5ffb_0_ff,
+op_5ffc_0_ff,
+op_6000_0_ff,
+op_6001_0_ff,
+op_60ff_0_ff,
+op_6100_0_ff,
+op_6101_0_ff,
+op_61ff_0_ff,
+op_6200_0_ff,
+op_6201_0_ff,
+op_62ff_0_ff,
+op_6300_0_ff,
+op_6301_0_ff,
+op_63ff_0_ff,
+op_6400_0_ff,
+op_6401_0_ff,
+op_64ff_0_ff,
+op_6500_0_ff,
+op_6501_0_ff,
+op_65ff_0_ff,
+op_6600_0_ff,
+op_6601_0_ff,
+op_66ff_0_ff,
+op_6700_0_ff,
+op_6701_0_ff,
+op_67ff_0_ff,
+op_6800_0_ff,
+op_6801_0_ff,
+op_68ff_0_ff,
+op_6900_0_ff,
+op_6901_0_ff,
+op_69ff_0_ff,
+op_6a00_0_ff,
+op_6a01_0_ff,
+op_6aff_0_ff,
+op_6b00_0_ff,
+op_6b01_0_ff,
+op_6bff_0_ff,
+op_6c00_0_ff,
+op_6c01_0_ff,
+op_6cff_0_ff,
+op_6d00_0_ff,
+op_6d01_0_ff,
+op_6dff_0_ff,
+op_6e00_0_ff,
+op_6e01_0_ff,
+op_6eff_0_ff,
+op_6f00_0_ff,
+op_6f01_0_ff,
+op_6fff_0_ff,
+op_7000_0_ff,
+op_7100_0_ff,
+op_7101_0_ff,
+op_8000_0_ff,
+op_8010_0_ff,
+op_8018_0_ff,
+op_8020_0_ff,
+op_8028_0_ff,
+op_8030_0_ff,
+op_8038_0_ff,
+op_8039_0_ff,
+op_803a_0_ff,
+op_803b_0_ff,
+op_803c_0_ff,
+op_8040_0_ff,
+op_8050_0_ff,
+op_8058_0_ff,
+op_8060_0_ff,
+op_8068_0_ff,
+op_8070_0_ff,
+op_8078_0_ff,
+op_8079_0_ff,
+op_807a_0_ff,
+op_807b_0_ff,
+op_807c_0_ff,
+op_8080_0_ff,
+op_8090_0_ff,
+op_8098_0_ff,
+op_80a0_0_ff,
+op_80a8_0_ff,
+op_80b0_0_ff,
+op_80b8_0_ff,
+op_80b9_0_ff,
+op_80ba_0_ff,
+op_80bb_0_ff,
+op_80bc_0_ff,
+op_80c0_0_ff,
+op_80d0_0_ff,
+op_80d8_0_ff,
+op_80e0_0_ff,
+op_80e8_0_ff,
+op_80f0_0_ff,
+op_80f8_0_ff,
+op_80f9_0_ff,
+op_80fa_0_ff,
+op_80fb_0_ff,
+op_80fc_0_ff,
+op_8100_1_ff,
+op_8108_1_ff,
+op_8110_0_ff,
+op_8118_0_ff,
+op_8120_0_ff,
+op_8128_0_ff,
+op_8130_0_ff,
+op_8138_0_ff,
+op_8139_0_ff,
+op_8140_0_ff,
+op_8148_0_ff,
+op_8150_0_ff,
+op_8158_0_ff,
+op_8160_0_ff,
+op_8168_0_ff,
+op_8170_0_ff,
+op_8178_0_ff,
+op_8179_0_ff,
+op_8180_0_ff,
+op_8188_0_ff,
+op_8190_0_ff,
+op_8198_0_ff,
+op_81a0_0_ff,
+op_81a8_0_ff,
+op_81b0_0_ff,
+op_81b8_0_ff,
+op_81b9_0_ff,
+op_81c0_0_ff,
+op_81d0_0_ff,
+op_81d8_0_ff,
+op_81e0_0_ff,
+op_81e8_0_ff,
+op_81f0_0_ff,
+op_81f8_0_ff,
+op_81f9_0_ff,
+op_81fa_0_ff,
+op_81fb_0_ff,
+op_81fc_0_ff,
+op_9000_0_ff,
+op_9010_0_ff,
+op_9018_0_ff,
+op_9020_0_ff,
+op_9028_0_ff,
+op_9030_0_ff,
+op_9038_0_ff,
+op_9039_0_ff,
+op_903a_0_ff,
+op_903b_0_ff,
+op_903c_0_ff,
+op_9040_0_ff,
+op_9048_0_ff,
+op_9050_0_ff,
+op_9058_0_ff,
+op_9060_0_ff,
+op_9068_0_ff,
+op_9070_0_ff,
+op_9078_0_ff,
+op_9079_0_ff,
+op_907a_0_ff,
+op_907b_0_ff,
+op_907c_0_ff,
+op_9080_0_ff,
+op_9088_0_ff,
+op_9090_0_ff,
+op_9098_0_ff,
+op_90a0_0_ff,
+op_90a8_0_ff,
+op_90b0_0_ff,
+op_90b8_0_ff,
+op_90b9_0_ff,
+op_90ba_0_ff,
+op_90bb_0_ff,
+op_90bc_0_ff,
+op_90c0_0_ff,
+op_90c8_0_ff,
+op_90d0_0_ff,
+op_90d8_0_ff,
+op_90e0_0_ff,
+op_90e8_0_ff,
+op_90f0_0_ff,
+op_90f8_0_ff,
+op_90f9_0_ff,
+op_90fa_0_ff,
+op_90fb_0_ff,
+op_90fc_0_ff,
+op_9100_0_ff,
+op_9108_0_ff,
+op_9110_0_ff,
+op_9118_0_ff,
+op_9120_0_ff,
+op_9128_0_ff,
+op_9130_0_ff,
+op_9138_0_ff,
+op_9139_0_ff,
+op_9140_0_ff,
+op_9148_0_ff,
+op_9150_0_ff,
+op_9158_0_ff,
+op_9160_0_ff,
+op_9168_0_ff,
+op_9170_0_ff,
+op_9178_0_ff,
+op_9179_0_ff,
+op_9180_0_ff,
+op_9188_0_ff,
+op_9190_0_ff,
+op_9198_0_ff,
+op_91a0_0_ff,
+op_91a8_0_ff,
+op_91b0_0_ff,
+op_91b8_0_ff,
+op_91b9_0_ff,
+op_91c0_0_ff,
+op_91c8_0_ff,
+op_91d0_0_ff,
+op_91d8_0_ff,
+op_91e0_0_ff,
+op_91e8_0_ff,
+op_91f0_0_ff,
+op_91f8_0_ff,
+op_91f9_0_ff,
+op_91fa_0_ff,
+op_91fb_0_ff,
+op_91fc_0_ff,
+op_b000_0_ff,
+op_b010_0_ff,
+op_b018_0_ff,
+op_b020_0_ff,
+op_b028_0_ff,
+op_b030_0_ff,
+op_b038_0_ff,
+op_b039_0_ff,
+op_b03a_0_ff,
+op_b03b_0_ff,
+op_b03c_0_ff,
+op_b040_0_ff,
+op_b048_0_ff,
+op_b050_0_ff,
+op_b058_0_ff,
+op_b060_0_ff,
+op_b068_0_ff,
+op_b070_0_ff,
+op_b078_0_ff,
+op_b079_0_ff,
+op_b07a_0_ff,
+op_b07b_0_ff,
+op_b07c_0_ff,
+op_b080_0_ff,
+op_b088_0_ff,
+op_b090_0_ff,
+op_b098_0_ff,
+op_b0a0_0_ff,
+op_b0a8_0_ff,
+op_b0b0_0_ff,
+op_b0b8_0_ff,
+op_b0b9_0_ff,
+op_b0ba_0_ff,
+op_b0bb_0_ff,
+op_b0bc_0_ff,
+op_b0c0_0_ff,
+op_b0c8_0_ff,
+op_b0d0_0_ff,
+op_b0d8_0_ff,
+op_b0e0_0_ff,
+op_b0e8_0_ff,
+op_b0f0_0_ff,
+op_b0f8_0_ff,
+op_b0f9_0_ff,
+op_b0fa_0_ff,
+op_b0fb_0_ff,
+op_b0fc_0_ff,
+op_b100_0_ff,
+op_b108_0_ff,
+op_b110_0_ff,
+op_b118_0_ff,
+op_b120_0_ff,
+op_b128_0_ff,
+op_b130_0_ff,
+op_b138_0_ff,
+op_b139_0_ff,
+op_b140_0_ff,
+op_b148_0_ff,
+op_b150_0_ff,
+op_b158_0_ff,
+op_b160_0_ff,
+op_b168_0_ff,
+op_b170_0_ff,
+op_b178_0_ff,
+op_b179_0_ff,
+op_b180_0_ff,
+op_b188_0_ff,
+op_b190_0_ff,
+op_b198_0_ff,
+op_b1a0_0_ff,
+op_b1a8_0_ff,
+op_b1b0_0_ff,
+op_b1b8_0_ff,
+op_b1b9_0_ff,
+op_b1c0_0_ff,
+op_b1c8_0_ff,
+op_b1d0_0_ff,
+op_b1d8_0_ff,
+op_b1e0_0_ff,
+op_b1e8_0_ff,
+op_b1f0_0_ff,
+op_b1f8_0_ff,
+op_b1f9_0_ff,
+op_b1fa_0_ff,
+op_b1fb_0_ff,
+op_b1fc_0_ff,
+op_c000_0_ff,
+op_c010_0_ff,
+op_c018_0_ff,
+op_c020_0_ff,
+op_c028_0_ff,
+op_c030_0_ff,
+op_c038_0_ff,
+op_c039_0_ff,
+op_c03a_0_ff,
+op_c03b_0_ff,
+op_c03c_0_ff,
+op_c040_0_ff,
+op_c050_0_ff,
+op_c058_0_ff,
+op_c060_0_ff,
+op_c068_0_ff,
+op_c070_0_ff,
+op_c078_0_ff,
+op_c079_0_ff,
+op_c07a_0_ff,
+op_c07b_0_ff,
+op_c07c_0_ff,
+op_c080_0_ff,
+op_c090_0_ff,
+op_c098_0_ff,
+op_c0a0_0_ff,
+op_c0a8_0_ff,
+op_c0b0_0_ff,
+op_c0b8_0_ff,
+op_c0b9_0_ff,
+op_c0ba_0_ff,
+op_c0bb_0_ff,
+op_c0bc_0_ff,
+op_c0c0_0_ff,
+op_c0d0_0_ff,
+op_c0d8_0_ff,
+op_c0e0_0_ff,
+op_c0e8_0_ff,
+op_c0f0_0_ff,
+op_c0f8_0_ff,
+op_c0f9_0_ff,
+op_c0fa_0_ff,
+op_c0fb_0_ff,
+op_c0fc_0_ff,
+op_c100_1_ff,
+op_c108_1_ff,
+op_c110_0_ff,
+op_c118_0_ff,
+op_c120_0_ff,
+op_c128_0_ff,
+op_c130_0_ff,
+op_c138_0_ff,
+op_c139_0_ff,
+op_c140_0_ff,
+op_c148_0_ff,
+op_c150_0_ff,
+op_c158_0_ff,
+op_c160_0_ff,
+op_c168_0_ff,
+op_c170_0_ff,
+op_c178_0_ff,
+op_c179_0_ff,
+op_c188_0_ff,
+op_c190_0_ff,
+op_c198_0_ff,
+op_c1a0_0_ff,
+op_c1a8_0_ff,
+op_c1b0_0_ff,
+op_c1b8_0_ff,
+op_c1b9_0_ff,
+op_c1c0_0_ff,
+op_c1d0_0_ff,
+op_c1d8_0_ff,
+op_c1e0_0_ff,
+op_c1e8_0_ff,
+op_c1f0_0_ff,
+op_c1f8_0_ff,
+op_c1f9_0_ff,
+op_c1fa_0_ff,
+op_c1fb_0_ff,
+op_c1fc_0_ff,
+op_d000_0_ff,
+op_d010_0_ff,
+op_d018_0_ff,
+op_d020_0_ff,
+op_d028_0_ff,
+op_d030_0_ff,
+op_d038_0_ff,
+op_d039_0_ff,
+op_d03a_0_ff,
+op_d03b_0_ff,
+op_d03c_0_ff,
+op_d040_0_ff,
+op_d048_0_ff,
+op_d050_0_ff,
+op_d058_0_ff,
+op_d060_0_ff,
+op_d068_0_ff,
+op_d070_0_ff,
+op_d078_0_ff,
+op_d079_0_ff,
+op_d07a_0_ff,
+op_d07b_0_ff,
+op_d07c_0_ff,
+op_d080_0_ff,
+op_d088_0_ff,
+op_d090_0_ff,
+op_d098_0_ff,
+op_d0a0_0_ff,
+op_d0a8_0_ff,
+op_d0b0_0_ff,
+op_d0b8_0_ff,
+op_d0b9_0_ff,
+op_d0ba_0_ff,
+op_d0bb_0_ff,
+op_d0bc_0_ff,
+op_d0c0_0_ff,
+op_d0c8_0_ff,
+op_d0d0_0_ff,
+op_d0d8_0_ff,
+op_d0e0_0_ff,
+op_d0e8_0_ff,
+op_d0f0_0_ff,
+op_d0f8_0_ff,
+op_d0f9_0_ff,
+op_d0fa_0_ff,
+op_d0fb_0_ff,
+op_d0fc_0_ff,
+op_d100_0_ff,
+op_d108_0_ff,
+op_d110_0_ff,
+op_d118_0_ff,
+op_d120_0_ff,
+op_d128_0_ff,
+op_d130_0_ff,
+op_d138_0_ff,
+op_d139_0_ff,
+op_d140_0_ff,
+op_d148_0_ff,
+op_d150_0_ff,
+op_d158_0_ff,
+op_d160_0_ff,
+op_d168_0_ff,
+op_d170_0_ff,
+op_d178_0_ff,
+op_d179_0_ff,
+op_d180_0_ff,
+op_d188_0_ff,
+op_d190_0_ff,
+op_d198_0_ff,
+op_d1a0_0_ff,
+op_d1a8_0_ff,
+op_d1b0_0_ff,
+op_d1b8_0_ff,
+op_d1b9_0_ff,
+op_d1c0_0_ff,
+op_d1c8_0_ff,
+op_d1d0_0_ff,
+op_d1d8_0_ff,
+op_d1e0_0_ff,
+op_d1e8_0_ff,
+op_d1f0_0_ff,
+op_d1f8_0_ff,
+op_d1f9_0_ff,
+op_d1fa_0_ff,
+op_d1fb_0_ff,
+op_d1fc_0_ff,
+op_e000_0_ff,
+op_e008_0_ff,
+op_e010_0_ff,
+op_e018_0_ff,
+op_e020_0_ff,
+op_e028_0_ff,
+op_e030_0_ff,
+op_e038_0_ff,
+op_e040_0_ff,
+op_e048_0_ff,
+op_e050_0_ff,
+op_e058_0_ff,
+op_e060_0_ff,
+op_e068_0_ff,
+op_e070_0_ff,
+op_e078_0_ff,
+op_e080_0_ff,
+op_e088_0_ff,
+op_e090_0_ff,
+op_e098_0_ff,
+op_e0a0_0_ff,
+op_e0a8_0_ff,
+op_e0b0_0_ff,
+op_e0b8_0_ff,
+op_e0d0_0_ff,
+op_e0d8_0_ff,
+op_e0e0_0_ff,
+op_e0e8_0_ff,
+op_e0f0_0_ff,
+op_e0f8_0_ff,
+op_e0f9_0_ff,
+op_e100_0_ff,
+op_e108_0_ff,
+op_e110_0_ff,
+op_e118_0_ff,
+op_e120_0_ff,
+op_e128_0_ff,
+op_e130_0_ff,
+op_e138_0_ff,
+op_e140_0_ff,
+op_e148_0_ff,
+op_e150_0_ff,
+op_e158_0_ff,
+op_e160_0_ff,
+op_e168_0_ff,
+op_e170_0_ff,
+op_e178_0_ff,
+op_e180_0_ff,
+op_e188_0_ff,
+op_e190_0_ff,
+op_e198_0_ff,
+op_e1a0_0_ff,
+op_e1a8_0_ff,
+op_e1b0_0_ff,
+op_e1b8_0_ff,
+op_e1d0_0_ff,
+op_e1d8_0_ff,
+op_e1e0_0_ff,
+op_e1e8_0_ff,
+op_e1f0_0_ff,
+op_e1f8_0_ff,
+op_e1f9_0_ff,
+op_e2d0_0_ff,
+op_e2d8_0_ff,
+op_e2e0_0_ff,
+op_e2e8_0_ff,
+op_e2f0_0_ff,
+op_e2f8_0_ff,
+op_e2f9_0_ff,
+op_e3d0_0_ff,
+op_e3d8_0_ff,
+op_e3e0_0_ff,
+op_e3e8_0_ff,
+op_e3f0_0_ff,
+op_e3f8_0_ff,
+op_e3f9_0_ff,
+op_e4d0_0_ff,
+op_e4d8_0_ff,
+op_e4e0_0_ff,
+op_e4e8_0_ff,
+op_e4f0_0_ff,
+op_e4f8_0_ff,
+op_e4f9_0_ff,
+op_e5d0_0_ff,
+op_e5d8_0_ff,
+op_e5e0_0_ff,
+op_e5e8_0_ff,
+op_e5f0_0_ff,
+op_e5f8_0_ff,
+op_e5f9_0_ff,
+op_e6d0_0_ff,
+op_e6d8_0_ff,
+op_e6e0_0_ff,
+op_e6e8_0_ff,
+op_e6f0_0_ff,
+op_e6f8_0_ff,
+op_e6f9_0_ff,
+op_e7d0_0_ff,
+op_e7d8_0_ff,
+op_e7e0_0_ff,
+op_e7e8_0_ff,
+op_e7f0_0_ff,
+op_e7f8_0_ff,
+op_e7f9_0_ff,
+op_e8c0_0_ff,
+op_e8d0_0_ff,
+op_e8e8_0_ff,
+op_e8f0_0_ff,
+op_e8f8_0_ff,
+op_e8f9_0_ff,
+op_e8fa_0_ff,
+op_e8fb_0_ff,
+op_e9c0_0_ff,
+op_e9d0_0_ff,
+op_e9e8_0_ff,
+op_e9f0_0_ff,
+op_e9f8_0_ff,
+op_e9f9_0_ff,
+op_e9fa_0_ff,
+op_e9fb_0_ff,
+op_eac0_0_ff,
+op_ead0_0_ff,
+op_eae8_0_ff,
+op_eaf0_0_ff,
+op_eaf8_0_ff,
+op_eaf9_0_ff,
+op_ebc0_0_ff,
+op_ebd0_0_ff,
+op_ebe8_0_ff,
+op_ebf0_0_ff,
+op_ebf8_0_ff,
+op_ebf9_0_ff,
+op_ebfa_0_ff,
+op_ebfb_0_ff,
+op_ecc0_0_ff,
+op_ecd0_0_ff,
+op_ece8_0_ff,
+op_ecf0_0_ff,
+op_ecf8_0_ff,
+op_ecf9_0_ff,
+op_edc0_0_ff,
+op_edd0_0_ff,
+op_ede8_0_ff,
+op_edf0_0_ff,
+op_edf8_0_ff,
+op_edf9_0_ff,
+op_edfa_0_ff,
+op_edfb_0_ff,
+op_eec0_0_ff,
+op_eed0_0_ff,
+op_eee8_0_ff,
+op_eef0_0_ff,
+op_eef8_0_ff,
+op_eef9_0_ff,
+op_efc0_0_ff,
+op_efd0_0_ff,
+op_efe8_0_ff,
+op_eff0_0_ff,
+op_eff8_0_ff,
+op_eff9_0_ff,
+op_f200_0_ff,
+op_f208_0_ff,
+op_f210_0_ff,
+op_f218_0_ff,
+op_f220_0_ff,
+op_f228_0_ff,
+op_f230_0_ff,
+op_f238_0_ff,
+op_f239_0_ff,
+op_f23a_0_ff,
+op_f23b_0_ff,
+op_f23c_0_ff,
+op_f240_0_ff,
+op_f248_0_ff,
+op_f250_0_ff,
+op_f258_0_ff,
+op_f260_0_ff,
+op_f268_0_ff,
+op_f270_0_ff,
+op_f278_0_ff,
+op_f279_0_ff,
+op_f27a_0_ff,
+op_f27b_0_ff,
+op_f27c_0_ff,
+op_f280_0_ff,
+op_f2c0_0_ff,
+op_f310_0_ff,
+op_f320_0_ff,
+op_f328_0_ff,
+op_f330_0_ff,
+op_f338_0_ff,
+op_f339_0_ff,
+op_f350_0_ff,
+op_f358_0_ff,
+op_f368_0_ff,
+op_f370_0_ff,
+op_f378_0_ff,
+op_f379_0_ff,
+op_f37a_0_ff,
+op_f37b_0_ff,
+};
+static const uae_u16 op_dispatch_pages_1[] = {
+1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,6,7,8,0,0,9,0,0,0,
+10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,
+11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,
+13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,
+15,15,15,15,15,15,15,15,16,17,0,0,18,0,0,0,
+19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,
+20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,
+22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,
+24,24,24,24,24,24,24,24,25,26,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+27,27,27,27,27,27,27,27,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,28,28,28,28,28,28,28,28,
+29,29,29,29,29,29,29,29,30,31,32,33,0,0,0,0,
+34,34,34,34,34,34,34,34,35,35,35,35,35,35,35,35,
+36,36,36,36,36,36,36,36,37,37,37,37,37,37,37,37,
+38,38,38,38,38,38,38,38,39,39,39,39,39,39,39,39,
+40,40,40,40,40,40,40,40,41,42,43,44,45,0,0,0,
+46,46,46,46,46,46,46,46,47,47,47,47,47,47,47,47,
+48,48,48,48,48,48,48,48,49,49,49,49,49,49,49,49,
+50,50,50,50,50,50,50,50,51,51,51,51,51,51,51,51,
+52,52,52,52,52,52,52,52,53,54,55,56,0,0,0,0,
+57,57,57,57,57,57,57,57,58,58,58,58,58,58,58,58,
+59,59,59,59,59,59,59,59,60,60,60,60,60,60,60,60,
+61,61,61,61,61,61,61,61,62,62,62,62,62,62,62,62,
+63,63,63,63,63,63,63,63,64,65,66,67,0,0,0,0,
+68,68,68,68,68,68,68,68,69,69,69,69,69,69,69,69,
+70,70,70,70,70,70,70,70,71,71,71,71,71,71,71,71,
+72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,
+74,74,74,74,74,74,74,74,75,76,77,78,0,0,0,0,
+79,79,79,79,79,79,79,79,0,0,0,0,0,0,0,0,
+80,80,80,80,80,80,80,80,81,81,81,81,81,81,81,81,
+82,82,82,82,82,82,82,82,83,83,83,83,83,83,83,83,
+84,84,84,84,84,84,84,84,85,86,0,0,87,0,0,0,
+88,88,88,88,88,88,88,88,0,0,0,0,0,0,0,0,
+89,89,89,89,89,89,89,89,90,90,90,90,90,90,90,90,
+91,91,91,91,91,91,91,91,92,92,92,92,92,92,92,92,
+93,93,93,93,93,93,93,93,94,95,0,0,96,0,0,0,
+97,97,97,97,97,97,97,97,0,0,0,0,0,0,0,0,
+98,98,98,98,98,98,98,98,99,99,99,99,99,99,99,99,
+100,100,100,100,100,100,100,100,101,101,101,101,101,101,101,101,
+102,102,102,102,102,102,102,102,103,104,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+105,105,105,105,105,105,105,105,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,106,106,106,106,106,106,106,106,
+107,107,107,107,107,107,107,107,108,109,110,111,0,0,0,0,
+112,112,112,112,112,112,112,112,0,0,0,0,0,0,0,0,
+113,113,113,113,113,113,113,113,114,114,114,114,114,114,114,114,
+115,115,115,115,115,115,115,115,116,116,116,116,116,116,116,116,
+117,117,117,117,117,117,117,117,118,119,0,0,0,0,0,0,
+120,120,120,120,120,120,120,120,0,0,0,0,0,0,0,0,
+121,121,121,121,121,121,121,121,122,122,122,122,122,122,122,122,
+123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+125,125,125,125,125,125,125,125,126,127,0,0,0,0,0,0,
+128,128,128,128,128,128,128,128,0,0,0,0,0,0,0,0,
+129,129,129,129,129,129,129,129,130,130,130,130,130,130,130,130,
+131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+133,133,133,133,133,133,133,133,134,135,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,136,136,136,136,136,136,136,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,137,137,137,137,137,137,137,137,
+138,138,138,138,138,138,138,138,139,140,141,142,0,0,0,0,
+143,143,143,143,143,143,143,143,0,0,0,0,0,0,0,0,
+144,144,144,144,144,144,144,144,145,145,145,145,145,145,145,145,
+146,146,146,146,146,146,146,146,147,147,147,147,147,147,147,147,
+148,148,148,148,148,148,148,148,149,150,0,0,0,0,0,0,
+151,151,151,151,151,151,151,151,0,0,0,0,0,0,0,0,
+152,152,152,152,152,152,152,152,153,153,153,153,153,153,153,153,
+154,154,154,154,154,154,154,154,155,155,155,155,155,155,155,155,
+156,156,156,156,156,156,156,156,157,158,0,0,0,0,0,0,
+159,159,159,159,159,159,159,159,0,0,0,0,0,0,0,0,
+160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,161,
+162,162,162,162,162,162,162,162,163,163,163,163,163,163,163,163,
+164,164,164,164,164,164,164,164,165,166,0,0,0,0,0,0,
+167,167,167,167,167,167,167,167,168,168,168,168,168,168,168,168,
+169,169,169,169,169,169,169,169,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,170,170,170,170,170,170,170,170,
+171,171,171,171,171,171,171,171,172,173,174,175,0,0,0,0,
+176,176,176,176,176,176,176,176,0,0,0,0,0,0,0,0,
+177,177,177,177,177,177,177,177,178,178,178,178,178,178,178,178,
+179,179,179,179,179,179,179,179,180,180,180,180,180,180,180,180,
+181,181,181,181,181,181,181,181,182,183,184,185,186,0,0,0,
+187,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,
+188,188,188,188,188,188,188,188,189,189,189,189,189,189,189,189,
+190,190,190,190,190,190,190,190,191,191,191,191,191,191,191,191,
+192,192,192,192,192,192,192,192,193,194,195,196,0,0,0,0,
+197,197,197,197,197,197,197,197,0,0,0,0,0,0,0,0,
+198,198,198,198,198,198,198,198,199,199,199,199,199,199,199,199,
+200,200,200,200,200,200,200,200,201,201,201,201,201,201,201,201,
+202,202,202,202,202,202,202,202,203,204,205,206,0,0,0,0,
+207,207,207,207,207,207,207,207,0,0,0,0,0,0,0,0,
+208,208,208,208,208,208,208,208,209,209,209,209,209,209,209,209,
+210,210,210,210,210,210,210,210,211,211,211,211,211,211,211,211,
+212,212,212,212,212,212,212,212,213,214,215,216,0,0,0,0,
+217,217,217,217,217,217,217,217,0,0,0,0,0,0,0,0,
+218,218,218,218,218,218,218,218,219,219,219,219,219,219,219,219,
+220,220,220,220,220,220,220,220,221,221,221,221,221,221,221,221,
+222,222,222,222,222,222,222,222,223,224,0,0,225,0,0,0,
+226,226,226,226,226,226,226,226,0,0,0,0,0,0,0,0,
+227,227,227,227,227,227,227,227,228,228,228,228,228,228,228,228,
+229,229,229,229,229,229,229,229,230,230,230,230,230,230,230,230,
+231,231,231,231,231,231,231,231,232,233,0,0,234,0,0,0,
+235,235,235,235,235,235,235,235,0,0,0,0,0,0,0,0,
+236,236,236,236,236,236,236,236,237,237,237,237,237,237,237,237,
+238,238,238,238,238,238,238,238,239,239,239,239,239,239,239,239,
+240,240,240,240,240,240,240,240,241,242,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+243,243,243,243,243,243,243,243,244,244,244,244,244,244,244,244,
+245,245,245,245,245,245,245,245,246,246,246,246,246,246,246,246,
+247,247,247,247,247,247,247,247,248,249,0,0,0,0,0,0,
+250,250,250,250,250,250,250,250,0,0,0,0,0,0,0,0,
+251,251,251,251,251,251,251,251,252,252,252,252,252,252,252,252,
+253,253,253,253,253,253,253,253,254,254,254,254,254,254,254,254,
+255,255,255,255,255,255,255,255,256,257,258,259,0,0,0,0,
+260,260,260,260,260,260,260,260,0,0,0,0,0,0,0,0,
+261,261,261,261,261,261,261,261,262,262,262,262,262,262,262,262,
+263,263,263,263,263,263,263,263,264,264,264,264,264,264,264,264,
+265,265,265,265,265,265,265,265,266,267,268,269,0,0,0,0,
+270,270,270,270,270,270,270,270,0,0,0,0,0,0,0,0,
+271,271,271,271,271,271,271,271,272,272,272,272,272,272,272,272,
+273,273,273,273,273,273,273,273,274,274,274,274,274,274,274,274,
+275,275,275,275,275,275,275,275,276,277,278,279,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+280,280,280,280,280,280,280,280,281,281,281,281,281,281,281,281,
+282,282,282,282,282,282,282,282,283,283,283,283,283,283,283,283,
+284,284,284,284,284,284,284,284,285,286,0,0,287,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+288,288,288,288,288,288,288,288,289,289,289,289,289,289,289,289,
+290,290,290,290,290,290,290,290,291,291,291,291,291,291,291,291,
+292,292,292,292,292,292,292,292,293,294,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+295,295,295,295,295,295,295,295,296,296,296,296,296,296,296,296,
+297,297,297,297,297,297,297,297,298,298,298,298,298,298,298,298,
+299,299,299,299,299,299,299,299,300,301,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+302,302,302,302,302,302,302,302,303,303,303,303,303,303,303,303,
+304,304,304,304,304,304,304,304,305,305,305,305,305,305,305,305,
+306,306,306,306,306,306,306,306,307,308,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+309,309,309,309,309,309,309,309,310,310,310,310,310,310,310,310,
+311,311,311,311,311,311,311,311,312,312,312,312,312,312,312,312,
+313,313,313,313,313,313,313,313,314,315,0,0,316,0,0,0,
+317,317,317,317,317,317,317,317,0,0,0,0,0,0,0,0,
+318,318,318,318,318,318,318,318,319,319,319,319,319,319,319,319,
+320,320,320,320,320,320,320,320,321,321,321,321,321,321,321,321,
+322,322,322,322,322,322,322,322,323,324,325,326,327,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+328,328,328,328,328,328,328,328,0,0,0,0,0,0,0,0,
+329,329,329,329,329,329,329,329,330,330,330,330,330,330,330,330,
+331,331,331,331,331,331,331,331,332,332,332,332,332,332,332,332,
+333,333,333,333,333,333,333,333,334,335,336,337,338,0,0,0,
+339,339,339,339,339,339,339,339,0,0,0,0,0,0,0,0,
+340,340,340,340,340,340,340,340,341,341,341,341,341,341,341,341,
+342,342,342,342,342,342,342,342,343,343,343,343,343,343,343,343,
+344,344,344,344,344,344,344,344,345,346,347,348,349,0,0,0,
+350,350,350,350,350,350,350,350,0,0,0,0,0,0,0,0,
+351,351,351,351,351,351,351,351,352,352,352,352,352,352,352,352,
+353,353,353,353,353,353,353,353,354,354,354,354,354,354,354,354,
+355,355,355,355,355,355,355,355,356,357,358,359,360,0,0,0,
+361,361,361,361,361,361,361,361,0,0,0,0,0,0,0,0,
+362,362,362,362,362,362,362,362,363,363,363,363,363,363,363,363,
+364,364,364,364,364,364,364,364,365,365,365,365,365,365,365,365,
+366,366,366,366,366,366,366,366,367,368,369,370,371,0,0,0,
+372,372,372,372,372,372,372,372,0,0,0,0,0,0,0,0,
+373,373,373,373,373,373,373,373,374,374,374,374,374,374,374,374,
+375,375,375,375,375,375,375,375,376,376,376,376,376,376,376,376,
+377,377,377,377,377,377,377,377,378,379,380,381,382,0,0,0,
+383,383,383,383,383,383,383,383,0,0,0,0,0,0,0,0,
+384,384,384,384,384,384,384,384,385,385,385,385,385,385,385,385,
+386,386,386,386,386,386,386,386,387,387,387,387,387,387,387,387,
+388,388,388,388,388,388,388,388,389,390,391,392,393,0,0,0,
+394,394,394,394,394,394,394,394,0,0,0,0,0,0,0,0,
+395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,
+397,397,397,397,397,397,397,397,398,398,398,398,398,398,398,398,
+399,399,399,399,399,399,399,399,400,401,402,403,404,0,0,0,
+405,405,405,405,405,405,405,405,406,406,406,406,406,406,406,406,
+407,407,407,407,407,407,407,407,408,408,408,408,408,408,408,408,
+409,409,409,409,409,409,409,409,410,410,410,410,410,410,410,410,
+411,411,411,411,411,411,411,411,412,413,414,415,416,0,0,0,
+417,417,417,417,417,417,417,417,418,418,418,418,418,418,418,418,
+419,419,419,419,419,419,419,419,420,420,420,420,420,420,420,420,
+421,421,421,421,421,421,421,421,422,422,422,422,422,422,422,422,
+423,423,423,423,423,423,423,423,424,425,426,427,428,0,0,0,
+429,429,429,429,429,429,429,429,430,430,430,430,430,430,430,430,
+431,431,431,431,431,431,431,431,432,432,432,432,432,432,432,432,
+433,433,433,433,433,433,433,433,434,434,434,434,434,434,434,434,
+435,435,435,435,435,435,435,435,436,437,438,439,440,0,0,0,
+441,441,441,441,441,441,441,441,442,442,442,442,442,442,442,442,
+443,443,443,443,443,443,443,443,444,444,444,444,444,444,444,444,
+445,445,445,445,445,445,445,445,446,446,446,446,446,446,446,446,
+447,447,447,447,447,447,447,447,448,449,450,451,452,0,0,0,
+453,453,453,453,453,453,453,453,454,454,454,454,454,454,454,454,
+455,455,455,455,455,455,455,455,456,456,456,456,456,456,456,456,
+457,457,457,457,457,457,457,457,458,458,458,458,458,458,458,458,
+459,459,459,459,459,459,459,459,460,461,462,463,464,0,0,0,
+465,465,465,465,465,465,465,465,466,466,466,466,466,466,466,466,
+467,467,467,467,467,467,467,467,468,468,468,468,468,468,468,468,
+469,469,469,469,469,469,469,469,470,470,470,470,470,470,470,470,
+471,471,471,471,471,471,471,471,472,473,474,475,476,0,0,0,
+477,477,477,477,477,477,477,477,478,478,478,478,478,478,478,478,
+479,479,479,479,479,479,479,479,480,480,480,480,480,480,480,480,
+481,481,481,481,481,481,481,481,482,482,482,482,482,482,482,482,
+483,483,483,483,483,483,483,483,484,485,486,487,488,0,0,0,
+489,489,489,489,489,489,489,489,490,490,490,490,490,490,490,490,
+491,491,491,491,491,491,491,491,492,492,492,492,492,492,492,492,
+493,493,493,493,493,493,493,493,494,494,494,494,494,494,494,494,
+495,495,495,495,495,495,495,495,496,497,498,499,500,0,0,0,
+501,501,501,501,501,501,501,501,502,502,502,502,502,502,502,502,
+503,503,503,503,503,503,503,503,504,504,504,504,504,504,504,504,
+505,505,505,505,505,505,505,505,506,506,506,506,506,506,506,506,
+507,507,507,507,507,507,507,507,508,509,510,511,512,0,0,0,
+513,513,513,513,513,513,513,513,514,514,514,514,514,514,514,514,
+515,515,515,515,515,515,515,515,516,516,516,516,516,516,516,516,
+517,517,517,517,517,517,517,517,518,518,518,518,518,518,518,518,
+519,519,519,519,519,519,519,519,520,521,522,523,524,0,0,0,
+525,525,525,525,525,525,525,525,526,526,526,526,526,526,526,526,
+527,527,527,527,527,527,527,527,528,528,528,528,528,528,528,528,
+529,529,529,529,529,529,529,529,530,530,530,530,530,530,530,530,
+531,531,531,531,531,531,531,531,532,533,534,535,536,0,0,0,
+537,537,537,537,537,537,537,537,538,538,538,538,538,538,538,538,
+539,539,539,539,539,539,539,539,540,540,540,540,540,540,540,540,
+541,541,541,541,541,541,541,541,542,542,542,542,542,542,542,542,
+543,543,543,543,543,543,543,543,544,545,546,547,548,0,0,0,
+549,549,549,549,549,549,549,549,550,550,550,550,550,550,550,550,
+551,551,551,551,551,551,551,551,552,552,552,552,552,552,552,552,
+553,553,553,553,553,553,553,553,554,554,554,554,554,554,554,554,
+555,555,555,555,555,555,555,555,556,557,558,559,560,0,0,0,
+561,561,561,561,561,561,561,561,562,562,562,562,562,562,562,562,
+563,563,563,563,563,563,563,563,564,564,564,564,564,564,564,564,
+565,565,565,565,565,565,565,565,566,566,566,566,566,566,566,566,
+567,567,567,567,567,567,567,567,568,569,570,571,572,0,0,0,
+573,573,573,573,573,573,573,573,574,574,574,574,574,574,574,574,
+575,575,575,575,575,575,575,575,576,576,576,576,576,576,576,576,
+577,577,577,577,577,577,577,577,578,578,578,578,578,578,578,578,
+579,579,579,579,579,579,579,579,580,581,582,583,584,0,0,0,
+585,585,585,585,585,585,585,585,586,586,586,586,586,586,586,586,
+587,587,587,587,587,587,587,587,588,588,588,588,588,588,588,588,
+589,589,589,589,589,589,589,589,590,590,590,590,590,590,590,590,
+591,591,591,591,591,591,591,591,592,593,594,595,596,0,0,0,
+597,597,597,597,597,597,597,597,598,598,598,598,598,598,598,598,
+599,599,599,599,599,599,599,599,600,600,600,600,600,600,600,600,
+601,601,601,601,601,601,601,601,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,608,0,0,0,
+609,609,609,609,609,609,609,609,610,610,610,610,610,610,610,610,
+611,611,611,611,611,611,611,611,612,612,612,612,612,612,612,612,
+613,613,613,613,613,613,613,613,614,614,614,614,614,614,614,614,
+615,615,615,615,615,615,615,615,616,617,618,619,620,0,0,0,
+621,621,621,621,621,621,621,621,0,0,0,0,0,0,0,0,
+622,622,622,622,622,622,622,622,623,623,623,623,623,623,623,623,
+624,624,624,624,624,624,624,624,625,625,625,625,625,625,625,625,
+626,626,626,626,626,626,626,626,627,628,0,0,0,0,0,0,
+629,629,629,629,629,629,629,629,0,0,0,0,0,0,0,0,
+630,630,630,630,630,630,630,630,631,631,631,631,631,631,631,631,
+632,632,632,632,632,632,632,632,633,633,633,633,633,633,633,633,
+634,634,634,634,634,634,634,634,635,636,0,0,0,0,0,0,
+637,637,637,637,637,637,637,637,0,0,0,0,0,0,0,0,
+638,638,638,638,638,638,638,638,639,639,639,639,639,639,639,639,
+640,640,640,640,640,640,640,640,641,641,641,641,641,641,641,641,
+642,642,642,642,642,642,642,642,643,644,0,0,0,0,0,0,
+645,645,645,645,645,645,645,645,0,0,0,0,0,0,0,0,
+646,646,646,646,646,646,646,646,647,647,647,647,647,647,647,647,
+648,648,648,648,648,648,648,648,649,649,649,649,649,649,649,649,
+650,650,650,650,650,650,650,650,651,652,0,0,0,0,0,0,
+653,653,653,653,653,653,653,653,0,0,0,0,0,0,0,0,
+654,654,654,654,654,654,654,654,655,655,655,655,655,655,655,655,
+656,656,656,656,656,656,656,656,657,657,657,657,657,657,657,657,
+658,658,658,658,658,658,658,658,659,660,661,662,663,0,0,0,
+664,664,664,664,664,664,664,664,0,0,0,0,0,0,0,0,
+665,665,665,665,665,665,665,665,666,666,666,666,666,666,666,666,
+667,667,667,667,667,667,667,667,668,668,668,668,668,668,668,668,
+669,669,669,669,669,669,669,669,670,671,672,673,674,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,676,676,676,676,676,676,676,676,
+677,677,677,677,677,677,677,677,678,679,680,681,0,0,0,0,
+682,682,682,682,682,682,682,682,0,0,0,0,0,0,0,0,
+683,683,683,683,683,683,683,683,684,684,684,684,684,684,684,684,
+685,685,685,685,685,685,685,685,686,686,686,686,686,686,686,686,
+687,687,687,687,687,687,687,687,688,689,0,0,0,0,0,0,
+690,690,690,690,690,690,690,690,0,0,0,0,0,0,0,0,
+691,691,691,691,691,691,691,691,692,692,692,692,692,692,692,692,
+693,693,693,693,693,693,693,693,694,694,694,694,694,694,694,694,
+695,695,695,695,695,695,695,695,696,697,0,0,0,0,0,0,
+698,698,698,698,698,698,698,698,0,0,0,0,0,0,0,0,
+699,699,699,699,699,699,699,699,700,700,700,700,700,700,700,700,
+701,701,701,701,701,701,701,701,702,702,702,702,702,702,702,702,
+703,703,703,703,703,703,703,703,704,705,0,0,0,0,0,0,
+706,706,706,706,706,706,706,706,0,0,0,0,0,0,0,0,
+707,707,707,707,707,707,707,707,708,708,708,708,708,708,708,708,
+709,709,709,709,709,709,709,709,710,710,710,710,710,710,710,710,
+711,711,711,711,711,711,711,711,712,713,0,0,0,0,0,0,
+714,714,714,714,714,714,714,714,0,0,0,0,0,0,0,0,
+715,715,715,715,715,715,715,715,716,716,716,716,716,716,716,716,
+717,717,717,717,717,717,717,717,718,718,718,718,718,718,718,718,
+719,719,719,719,719,719,719,719,720,721,0,0,0,0,0,0,
+722,722,722,722,722,722,722,722,0,0,0,0,0,0,0,0,
+723,723,723,723,723,723,723,723,724,724,724,724,724,724,724,724,
+725,725,725,725,725,725,725,725,726,726,726,726,726,726,726,726,
+727,727,727,727,727,727,727,727,728,729,0,0,0,0,0,0,
+730,730,730,730,730,730,730,730,0,0,0,0,0,0,0,0,
+731,731,731,731,731,731,731,731,732,732,732,732,732,732,732,732,
+733,733,733,733,733,733,733,733,734,734,734,734,734,734,734,734,
+735,735,735,735,735,735,735,735,736,737,0,0,0,0,0,0,
+738,738,738,738,738,738,738,738,0,0,0,0,0,0,0,0,
+739,739,739,739,739,739,739,739,740,740,740,740,740,740,740,740,
+741,741,741,741,741,741,741,741,742,742,742,742,742,742,742,742,
+743,743,743,743,743,743,743,743,744,745,746,747,748,0,0,0,
+749,749,749,749,749,749,749,749,0,0,0,0,0,0,0,0,
+750,750,750,750,750,750,750,750,751,751,751,751,751,751,751,751,
+752,752,752,752,752,752,752,752,753,753,753,753,753,753,753,753,
+754,754,754,754,754,754,754,754,755,756,0,0,0,0,0,0,
+757,757,757,757,757,757,757,757,0,0,0,0,0,0,0,0,
+758,758,758,758,758,758,758,758,759,759,759,759,759,759,759,759,
+760,760,760,760,760,760,760,760,761,761,761,761,761,761,761,761,
+762,762,762,762,762,762,762,762,763,764,0,0,0,0,0,0,
+765,765,765,765,765,765,765,765,0,0,0,0,0,0,0,0,
+766,766,766,766,766,766,766,766,767,767,767,767,767,767,767,767,
+768,768,768,768,768,768,768,768,769,769,769,769,769,769,769,769,
+770,770,770,770,770,770,770,770,771,772,0,0,0,0,0,0,
+773,773,773,773,773,773,773,773,0,0,0,0,0,0,0,0,
+774,774,774,774,774,774,774,774,775,775,775,775,775,775,775,775,
+776,776,776,776,776,776,776,776,777,777,777,777,777,777,777,777,
+778,778,778,778,778,778,778,778,779,780,781,782,783,0,0,0,
+784,784,784,784,784,784,784,784,785,785,785,785,785,785,785,785,
+786,786,786,786,786,786,786,786,787,787,787,787,787,787,787,787,
+788,788,788,788,788,788,788,788,789,789,789,789,789,789,789,789,
+790,790,790,790,790,790,790,790,791,792,0,0,0,0,0,0,
+793,793,793,793,793,793,793,793,794,794,794,794,794,794,794,794,
+795,795,795,795,795,795,795,795,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,796,796,796,796,796,796,796,796,
+797,797,797,797,797,797,797,797,798,799,800,801,0,0,0,0,
+802,802,802,802,802,802,802,802,0,0,0,0,0,0,0,0,
+803,803,803,803,803,803,803,803,0,0,0,0,0,0,0,0,
+804,804,804,804,804,804,804,804,805,805,805,805,805,805,805,805,
+806,806,806,806,806,806,806,806,807,808,0,0,0,0,0,0,
+809,809,809,809,809,809,809,809,0,0,0,0,0,0,0,0,
+810,810,810,810,810,810,810,810,0,0,0,0,0,0,0,0,
+811,811,811,811,811,811,811,811,812,812,812,812,812,812,812,812,
+813,813,813,813,813,813,813,813,814,815,0,0,0,0,0,0,
+816,816,816,816,816,816,816,816,0,0,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,676,676,676,676,676,676,676,676,
+677,677,677,677,677,677,677,677,678,679,680,681,0,0,0,0,
+817,817,817,817,817,817,817,817,0,0,0,0,0,0,0,0,
+818,818,818,818,818,818,818,818,819,819,819,819,819,819,819,819,
+820,820,820,820,820,820,820,820,821,821,821,821,821,821,821,821,
+822,822,822,822,822,822,822,822,823,824,825,826,827,0,0,0,
+828,828,828,828,828,828,828,828,829,829,829,829,829,829,829,829,
+830,830,830,830,830,830,830,830,831,831,831,831,831,831,831,831,
+832,832,832,832,832,832,832,832,833,833,833,833,833,833,833,833,
+834,834,834,834,834,834,834,834,835,836,837,838,839,0,0,0,
+840,840,840,840,840,840,840,840,841,841,841,841,841,841,841,841,
+842,842,842,842,842,842,842,842,843,843,843,843,843,843,843,843,
+844,844,844,844,844,844,844,844,845,845,845,845,845,845,845,845,
+846,846,846,846,846,846,846,846,847,848,849,850,851,0,0,0,
+852,852,852,852,852,852,852,852,0,0,0,0,0,0,0,0,
+853,853,853,853,853,853,853,853,854,854,854,854,854,854,854,854,
+855,855,855,855,855,855,855,855,856,856,856,856,856,856,856,856,
+857,857,857,857,857,857,857,857,858,859,0,0,0,0,0,0,
+860,860,860,860,860,860,860,860,0,0,0,0,0,0,0,0,
+861,861,861,861,861,861,861,861,862,862,862,862,862,862,862,862,
+863,863,863,863,863,863,863,863,864,864,864,864,864,864,864,864,
+865,865,865,865,865,865,865,865,866,867,868,869,870,0,0,0,
+871,871,871,871,871,871,871,871,0,0,0,0,0,0,0,0,
+872,872,872,872,872,872,872,872,873,873,873,873,873,873,873,873,
+874,874,874,874,874,874,874,874,875,875,875,875,875,875,875,875,
+876,876,876,876,876,876,876,876,877,878,879,880,881,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+882,882,882,882,882,882,882,882,883,883,883,883,883,883,883,883,
+0,0,0,0,0,0,0,0,884,884,884,884,884,884,884,884,
+885,885,885,885,885,885,885,885,886,887,888,889,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+890,890,890,890,890,890,890,890,891,891,891,891,891,891,891,891,
+0,0,0,0,0,0,0,0,892,892,892,892,892,892,892,892,
+893,893,893,893,893,893,893,893,894,895,896,897,0,0,0,0,
+898,898,898,898,898,898,898,898,898,898,898,898,898,898,898,898,
+899,899,899,899,899,899,899,899,900,900,900,900,900,900,900,900,
+901,901,901,901,901,901,901,901,902,902,902,902,902,902,902,902,
+903,904,905,906,907,908,909,910,0,0,911,912,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+913,913,913,913,913,913,913,913,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,914,914,914,914,914,914,914,914,
+915,915,915,915,915,915,915,915,916,917,918,919,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+920,920,920,920,920,920,920,920,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,921,921,921,921,921,921,921,921,
+922,922,922,922,922,922,922,922,923,924,925,926,0,0,0,0,
+927,927,927,927,927,927,927,927,0,0,0,0,0,0,0,0,
+928,928,928,928,928,928,928,928,929,929,929,929,929,929,929,929,
+930,930,930,930,930,930,930,930,931,931,931,931,931,931,931,931,
+932,932,932,932,932,932,932,932,933,934,0,0,0,0,0,0,
+935,935,935,935,935,935,935,935,936,936,936,936,936,936,936,936,
+937,937,937,937,937,937,937,937,938,938,938,938,938,938,938,938,
+939,939,939,939,939,939,939,939,940,940,940,940,940,940,940,940,
+941,941,941,941,941,941,941,941,942,943,0,0,0,0,0,0,
+944,944,944,944,944,944,944,944,945,945,945,945,945,945,945,945,
+946,946,946,946,946,946,946,946,947,947,947,947,947,947,947,947,
+948,948,948,948,948,948,948,948,949,949,949,949,949,949,949,949,
+950,950,950,950,950,950,950,950,951,952,0,0,0,0,0,0,
+953,953,953,953,953,953,953,953,954,954,954,954,954,954,954,954,
+955,955,955,955,955,955,955,955,956,956,956,956,956,956,956,956,
+957,957,957,957,957,957,957,957,958,958,958,958,958,958,958,958,
+959,959,959,959,959,959,959,959,960,961,962,963,964,0,0,0,
+965,965,965,965,965,965,965,965,0,0,0,0,0,0,0,0,
+966,966,966,966,966,966,966,966,967,967,967,967,967,967,967,967,
+968,968,968,968,968,968,968,968,969,969,969,969,969,969,969,969,
+970,970,970,970,970,970,970,970,971,972,0,0,0,0,0,0,
+973,973,973,973,973,973,973,973,974,974,974,974,974,974,974,974,
+975,975,975,975,975,975,975,975,976,976,976,976,976,976,976,976,
+977,977,977,977,977,977,977,977,978,978,978,978,978,978,978,978,
+979,979,979,979,979,979,979,979,980,981,0,0,0,0,0,0,
+982,982,982,982,982,982,982,982,983,983,983,983,983,983,983,983,
+984,984,984,984,984,984,984,984,985,985,985,985,985,985,985,985,
+986,986,986,986,986,986,986,986,987,987,987,987,987,987,987,987,
+988,988,988,988,988,988,988,988,989,990,0,0,0,0,0,0,
+991,991,991,991,991,991,991,991,992,992,992,992,992,992,992,992,
+993,993,993,993,993,993,993,993,994,994,994,994,994,994,994,994,
+995,995,995,995,995,995,995,995,996,996,996,996,996,996,996,996,
+997,997,997,997,997,997,997,997,998,999,1000,1001,1002,0,0,0,
+1003,1003,1003,1003,1003,1003,1003,1003,1004,1004,1004,1004,1004,1004,1004,1004,
+1005,1005,1005,1005,1005,1005,1005,1005,1006,1006,1006,1006,1006,1006,1006,1006,
+1007,1007,1007,1007,1007,1007,1007,1007,1008,1008,1008,1008,1008,1008,1008,1008,
+1009,1009,1009,1009,1009,1009,1009,1009,1010,1011,1012,1013,1014,0,0,0,
+1015,1015,1015,1015,1015,1015,1015,1015,1016,1016,1016,1016,1016,1016,1016,1016,
+1017,1017,1017,1017,1017,1017,1017,1017,1018,1018,1018,1018,1018,1018,1018,1018,
+1019,1019,1019,1019,1019,1019,1019,1019,1020,1020,1020,1020,1020,1020,1020,1020,
+1021,1021,1021,1021,1021,1021,1021,1021,1022,1023,1024,1025,1026,0,0,0,
+1027,1027,1027,1027,1027,1027,1027,1027,1028,1028,1028,1028,1028,1028,1028,1028,
+1029,1029,1029,1029,1029,1029,1029,1029,1030,1030,1030,1030,1030,1030,1030,1030,
+1031,1031,1031,1031,1031,1031,1031,1031,1032,1032,1032,1032,1032,1032,1032,1032,
+1033,1033,1033,1033,1033,1033,1033,1033,1034,1035,1036,1037,1038,0,0,0,
+1039,1039,1039,1039,1039,1039,1039,1039,1040,1040,1040,1040,1040,1040,1040,1040,
+1041,1041,1041,1041,1041,1041,1041,1041,1042,1042,1042,1042,1042,1042,1042,1042,
+1043,1043,1043,1043,1043,1043,1043,1043,1044,1044,1044,1044,1044,1044,1044,1044,
+1045,1045,1045,1045,1045,1045,1045,1045,1046,1047,1048,1049,1050,0,0,0,
+1051,1051,1051,1051,1051,1051,1051,1051,1052,1052,1052,1052,1052,1052,1052,1052,
+1053,1053,1053,1053,1053,1053,1053,1053,1054,1054,1054,1054,1054,1054,1054,1054,
+1055,1055,1055,1055,1055,1055,1055,1055,1056,1056,1056,1056,1056,1056,1056,1056,
+1057,1057,1057,1057,1057,1057,1057,1057,1058,1059,1060,1061,1062,0,0,0,
+1063,1063,1063,1063,1063,1063,1063,1063,1064,1064,1064,1064,1064,1064,1064,1064,
+1065,1065,1065,1065,1065,1065,1065,1065,1066,1066,1066,1066,1066,1066,1066,1066,
+1067,1067,1067,1067,1067,1067,1067,1067,1068,1068,1068,1068,1068,1068,1068,1068,
+1069,1069,1069,1069,1069,1069,1069,1069,1070,1071,1072,1073,1074,0,0,0,
+1075,1075,1075,1075,1075,1075,1075,1075,1076,1076,1076,1076,1076,1076,1076,1076,
+1077,1077,1077,1077,1077,1077,1077,1077,1078,1078,1078,1078,1078,1078,1078,1078,
+1079,1079,1079,1079,1079,1079,1079,1079,1080,1080,1080,1080,1080,1080,1080,1080,
+1081,1081,1081,1081,1081,1081,1081,1081,1082,1083,1084,1085,1086,0,0,0,
+1087,1087,1087,1087,1087,1087,1087,1087,1088,1088,1088,1088,1088,1088,1088,1088,
+1089,1089,1089,1089,1089,1089,1089,1089,1090,1090,1090,1090,1090,1090,1090,1090,
+1091,1091,1091,1091,1091,1091,1091,1091,1092,1092,1092,1092,1092,1092,1092,1092,
+1093,1093,1093,1093,1093,1093,1093,1093,1094,1095,1096,1097,1098,0,0,0,
+1099,1099,1099,1099,1099,1099,1099,1099,1100,1100,1100,1100,1100,1100,1100,1100,
+1101,1101,1101,1101,1101,1101,1101,1101,1102,1102,1102,1102,1102,1102,1102,1102,
+1103,1103,1103,1103,1103,1103,1103,1103,1104,1104,1104,1104,1104,1104,1104,1104,
+1105,1105,1105,1105,1105,1105,1105,1105,1106,1107,1108,1109,1110,0,0,0,
+1111,1111,1111,1111,1111,1111,1111,1111,1112,1112,1112,1112,1112,1112,1112,1112,
+1113,1113,1113,1113,1113,1113,1113,1113,1114,1114,1114,1114,1114,1114,1114,1114,
+1115,1115,1115,1115,1115,1115,1115,1115,1116,1116,1116,1116,1116,1116,1116,1116,
+1117,1117,1117,1117,1117,1117,1117,1117,1118,1119,1120,1121,1122,0,0,0,
+1123,1123,1123,1123,1123,1123,1123,1123,1124,1124,1124,1124,1124,1124,1124,1124,
+1125,1125,1125,1125,1125,1125,1125,1125,1126,1126,1126,1126,1126,1126,1126,1126,
+1127,1127,1127,1127,1127,1127,1127,1127,1128,1128,1128,1128,1128,1128,1128,1128,
+1129,1129,1129,1129,1129,1129,1129,1129,1130,1131,1132,1133,1134,0,0,0,
+1135,1135,1135,1135,1135,1135,1135,1135,1136,1136,1136,1136,1136,1136,1136,1136,
+1137,1137,1137,1137,1137,1137,1137,1137,1138,1138,1138,1138,1138,1138,1138,1138,
+1139,1139,1139,1139,1139,1139,1139,1139,1140,1140,1140,1140,1140,1140,1140,1140,
+1141,1141,1141,1141,1141,1141,1141,1141,1142,1143,1144,1145,1146,0,0,0,
+1147,1147,1147,1147,1147,1147,1147,1147,1148,1148,1148,1148,1148,1148,1148,1148,
+1149,1149,1149,1149,1149,1149,1149,1149,1150,1150,1150,1150,1150,1150,1150,1150,
+1151,1151,1151,1151,1151,1151,1151,1151,1152,1152,1152,1152,1152,1152,1152,1152,
+1153,1153,1153,1153,1153,1153,1153,1153,1154,1155,1156,1157,1158,0,0,0,
+1159,1159,1159,1159,1159,1159,1159,1159,1160,1160,1160,1160,1160,1160,1160,1160,
+1161,1161,1161,1161,1161,1161,1161,1161,1162,1162,1162,1162,1162,1162,1162,1162,
+1163,1163,1163,1163,1163,1163,1163,1163,1164,1164,1164,1164,1164,1164,1164,1164,
+1165,1165,1165,1165,1165,1165,1165,1165,1166,1167,1168,1169,1170,0,0,0,
+1171,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1173,
+1174,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1176,
+1177,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1179,
+1180,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1182,
+1183,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1185,
+1186,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1188,
+1189,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1191,
+1192,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1194,
+1195,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1197,
+1198,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1200,
+1201,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1203,
+1204,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1206,
+1207,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1209,
+1210,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1212,
+1213,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1215,
+1216,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1218,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1220,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1222,1222,1222,1222,1222,1222,1222,1222,0,0,0,0,0,0,0,0,
+1223,1223,1223,1223,1223,1223,1223,1223,1224,1224,1224,1224,1224,1224,1224,1224,
+1225,1225,1225,1225,1225,1225,1225,1225,1226,1226,1226,1226,1226,1226,1226,1226,
+1227,1227,1227,1227,1227,1227,1227,1227,1228,1229,1230,1231,1232,0,0,0,
+1233,1233,1233,1233,1233,1233,1233,1233,0,0,0,0,0,0,0,0,
+1234,1234,1234,1234,1234,1234,1234,1234,1235,1235,1235,1235,1235,1235,1235,1235,
+1236,1236,1236,1236,1236,1236,1236,1236,1237,1237,1237,1237,1237,1237,1237,1237,
+1238,1238,1238,1238,1238,1238,1238,1238,1239,1240,1241,1242,1243,0,0,0,
+1244,1244,1244,1244,1244,1244,1244,1244,0,0,0,0,0,0,0,0,
+1245,1245,1245,1245,1245,1245,1245,1245,1246,1246,1246,1246,1246,1246,1246,1246,
+1247,1247,1247,1247,1247,1247,1247,1247,1248,1248,1248,1248,1248,1248,1248,1248,
+1249,1249,1249,1249,1249,1249,1249,1249,1250,1251,1252,1253,1254,0,0,0,
+1255,1255,1255,1255,1255,1255,1255,1255,0,0,0,0,0,0,0,0,
+1256,1256,1256,1256,1256,1256,1256,1256,1257,1257,1257,1257,1257,1257,1257,1257,
+1258,1258,1258,1258,1258,1258,1258,1258,1259,1259,1259,1259,1259,1259,1259,1259,
+1260,1260,1260,1260,1260,1260,1260,1260,1261,1262,1263,1264,1265,0,0,0,
+1266,1266,1266,1266,1266,1266,1266,1266,1267,1267,1267,1267,1267,1267,1267,1267,
+1268,1268,1268,1268,1268,1268,1268,1268,1269,1269,1269,1269,1269,1269,1269,1269,
+1270,1270,1270,1270,1270,1270,1270,1270,1271,1271,1271,1271,1271,1271,1271,1271,
+1272,1272,1272,1272,1272,1272,1272,1272,1273,1274,0,0,0,0,0,0,
+1275,1275,1275,1275,1275,1275,1275,1275,1276,1276,1276,1276,1276,1276,1276,1276,
+1277,1277,1277,1277,1277,1277,1277,1277,1278,1278,1278,1278,1278,1278,1278,1278,
+1279,1279,1279,1279,1279,1279,1279,1279,1280,1280,1280,1280,1280,1280,1280,1280,
+1281,1281,1281,1281,1281,1281,1281,1281,1282,1283,0,0,0,0,0,0,
+1284,1284,1284,1284,1284,1284,1284,1284,1285,1285,1285,1285,1285,1285,1285,1285,
+1286,1286,1286,1286,1286,1286,1286,1286,1287,1287,1287,1287,1287,1287,1287,1287,
+1288,1288,1288,1288,1288,1288,1288,1288,1289,1289,1289,1289,1289,1289,1289,1289,
+1290,1290,1290,1290,1290,1290,1290,1290,1291,1292,0,0,0,0,0,0,
+1293,1293,1293,1293,1293,1293,1293,1293,0,0,0,0,0,0,0,0,
+1294,1294,1294,1294,1294,1294,1294,1294,1295,1295,1295,1295,1295,1295,1295,1295,
+1296,1296,1296,1296,1296,1296,1296,1296,1297,1297,1297,1297,1297,1297,1297,1297,
+1298,1298,1298,1298,1298,1298,1298,1298,1299,1300,1301,1302,1303,0,0,0,
+1304,1304,1304,1304,1304,1304,1304,1304,0,0,0,0,0,0,0,0,
+1305,1305,1305,1305,1305,1305,1305,1305,1306,1306,1306,1306,1306,1306,1306,1306,
+1307,1307,1307,1307,1307,1307,1307,1307,1308,1308,1308,1308,1308,1308,1308,1308,
+1309,1309,1309,1309,1309,1309,1309,1309,1310,1311,1312,1313,1314,0,0,0,
+1315,1315,1315,1315,1315,1315,1315,1315,1316,1316,1316,1316,1316,1316,1316,1316,
+1317,1317,1317,1317,1317,1317,1317,1317,1318,1318,1318,1318,1318,1318,1318,1318,
+1319,1319,1319,1319,1319,1319,1319,1319,1320,1320,1320,1320,1320,1320,1320,1320,
+1321,1321,1321,1321,1321,1321,1321,1321,1322,1323,1324,1325,1326,0,0,0,
+1327,1327,1327,1327,1327,1327,1327,1327,1328,1328,1328,1328,1328,1328,1328,1328,
+1329,1329,1329,1329,1329,1329,1329,1329,1330,1330,1330,1330,1330,1330,1330,1330,
+1331,1331,1331,1331,1331,1331,1331,1331,1332,1332,1332,1332,1332,1332,1332,1332,
+1333,1333,1333,1333,1333,1333,1333,1333,1334,1335,1336,1337,1338,0,0,0,
+1339,1339,1339,1339,1339,1339,1339,1339,1340,1340,1340,1340,1340,1340,1340,1340,
+1341,1341,1341,1341,1341,1341,1341,1341,1342,1342,1342,1342,1342,1342,1342,1342,
+1343,1343,1343,1343,1343,1343,1343,1343,1344,1344,1344,1344,1344,1344,1344,1344,
+1345,1345,1345,1345,1345,1345,1345,1345,1346,1347,1348,1349,1350,0,0,0,
+1351,1351,1351,1351,1351,1351,1351,1351,1352,1352,1352,1352,1352,1352,1352,1352,
+1353,1353,1353,1353,1353,1353,1353,1353,1354,1354,1354,1354,1354,1354,1354,1354,
+1355,1355,1355,1355,1355,1355,1355,1355,1356,1356,1356,1356,1356,1356,1356,1356,
+1357,1357,1357,1357,1357,1357,1357,1357,1358,1359,0,0,0,0,0,0,
+1360,1360,1360,1360,1360,1360,1360,1360,1361,1361,1361,1361,1361,1361,1361,1361,
+1362,1362,1362,1362,1362,1362,1362,1362,1363,1363,1363,1363,1363,1363,1363,1363,
+1364,1364,1364,1364,1364,1364,1364,1364,1365,1365,1365,1365,1365,1365,1365,1365,
+1366,1366,1366,1366,1366,1366,1366,1366,1367,1368,0,0,0,0,0,0,
+1369,1369,1369,1369,1369,1369,1369,1369,1370,1370,1370,1370,1370,1370,1370,1370,
+1371,1371,1371,1371,1371,1371,1371,1371,1372,1372,1372,1372,1372,1372,1372,1372,
+1373,1373,1373,1373,1373,1373,1373,1373,1374,1374,1374,1374,1374,1374,1374,1374,
+1375,1375,1375,1375,1375,1375,1375,1375,1376,1377,0,0,0,0,0,0,
+1378,1378,1378,1378,1378,1378,1378,1378,1379,1379,1379,1379,1379,1379,1379,1379,
+1380,1380,1380,1380,1380,1380,1380,1380,1381,1381,1381,1381,1381,1381,1381,1381,
+1382,1382,1382,1382,1382,1382,1382,1382,1383,1383,1383,1383,1383,1383,1383,1383,
+1384,1384,1384,1384,1384,1384,1384,1384,1385,1386,1387,1388,1389,0,0,0,
+1390,1390,1390,1390,1390,1390,1390,1390,0,0,0,0,0,0,0,0,
+1391,1391,1391,1391,1391,1391,1391,1391,1392,1392,1392,1392,1392,1392,1392,1392,
+1393,1393,1393,1393,1393,1393,1393,1393,1394,1394,1394,1394,1394,1394,1394,1394,
+1395,1395,1395,1395,1395,1395,1395,1395,1396,1397,1398,1399,1400,0,0,0,
+1401,1401,1401,1401,1401,1401,1401,1401,1402,1402,1402,1402,1402,1402,1402,1402,
+1403,1403,1403,1403,1403,1403,1403,1403,1404,1404,1404,1404,1404,1404,1404,1404,
+1405,1405,1405,1405,1405,1405,1405,1405,1406,1406,1406,1406,1406,1406,1406,1406,
+1407,1407,1407,1407,1407,1407,1407,1407,1408,1409,1410,1411,1412,0,0,0,
+1413,1413,1413,1413,1413,1413,1413,1413,1414,1414,1414,1414,1414,1414,1414,1414,
+1415,1415,1415,1415,1415,1415,1415,1415,1416,1416,1416,1416,1416,1416,1416,1416,
+1417,1417,1417,1417,1417,1417,1417,1417,1418,1418,1418,1418,1418,1418,1418,1418,
+1419,1419,1419,1419,1419,1419,1419,1419,1420,1421,1422,1423,1424,0,0,0,
+1425,1425,1425,1425,1425,1425,1425,1425,1426,1426,1426,1426,1426,1426,1426,1426,
+1427,1427,1427,1427,1427,1427,1427,1427,1428,1428,1428,1428,1428,1428,1428,1428,
+1429,1429,1429,1429,1429,1429,1429,1429,1430,1430,1430,1430,1430,1430,1430,1430,
+1431,1431,1431,1431,1431,1431,1431,1431,1432,1433,1434,1435,1436,0,0,0,
+1437,1437,1437,1437,1437,1437,1437,1437,1438,1438,1438,1438,1438,1438,1438,1438,
+1439,1439,1439,1439,1439,1439,1439,1439,1440,1440,1440,1440,1440,1440,1440,1440,
+1441,1441,1441,1441,1441,1441,1441,1441,1442,1442,1442,1442,1442,1442,1442,1442,
+1443,1443,1443,1443,1443,1443,1443,1443,1444,1445,0,0,0,0,0,0,
+1446,1446,1446,1446,1446,1446,1446,1446,1447,1447,1447,1447,1447,1447,1447,1447,
+1448,1448,1448,1448,1448,1448,1448,1448,1449,1449,1449,1449,1449,1449,1449,1449,
+1450,1450,1450,1450,1450,1450,1450,1450,1451,1451,1451,1451,1451,1451,1451,1451,
+1452,1452,1452,1452,1452,1452,1452,1452,1453,1454,0,0,0,0,0,0,
+1455,1455,1455,1455,1455,1455,1455,1455,1456,1456,1456,1456,1456,1456,1456,1456,
+1457,1457,1457,1457,1457,1457,1457,1457,1458,1458,1458,1458,1458,1458,1458,1458,
+1459,1459,1459,1459,1459,1459,1459,1459,1460,1460,1460,1460,1460,1460,1460,1460,
+1461,1461,1461,1461,1461,1461,1461,1461,1462,1463,0,0,0,0,0,0,
+1464,1464,1464,1464,1464,1464,1464,1464,1465,1465,1465,1465,1465,1465,1465,1465,
+1466,1466,1466,1466,1466,1466,1466,1466,1467,1467,1467,1467,1467,1467,1467,1467,
+1468,1468,1468,1468,1468,1468,1468,1468,1469,1469,1469,1469,1469,1469,1469,1469,
+1470,1470,1470,1470,1470,1470,1470,1470,1471,1472,1473,1474,1475,0,0,0,
+1476,1476,1476,1476,1476,1476,1476,1476,0,0,0,0,0,0,0,0,
+1477,1477,1477,1477,1477,1477,1477,1477,1478,1478,1478,1478,1478,1478,1478,1478,
+1479,1479,1479,1479,1479,1479,1479,1479,1480,1480,1480,1480,1480,1480,1480,1480,
+1481,1481,1481,1481,1481,1481,1481,1481,1482,1483,1484,1485,1486,0,0,0,
+1487,1487,1487,1487,1487,1487,1487,1487,0,0,0,0,0,0,0,0,
+1488,1488,1488,1488,1488,1488,1488,1488,1489,1489,1489,1489,1489,1489,1489,1489,
+1490,1490,1490,1490,1490,1490,1490,1490,1491,1491,1491,1491,1491,1491,1491,1491,
+1492,1492,1492,1492,1492,1492,1492,1492,1493,1494,1495,1496,1497,0,0,0,
+1498,1498,1498,1498,1498,1498,1498,1498,0,0,0,0,0,0,0,0,
+1499,1499,1499,1499,1499,1499,1499,1499,1500,1500,1500,1500,1500,1500,1500,1500,
+1501,1501,1501,1501,1501,1501,1501,1501,1502,1502,1502,1502,1502,1502,1502,1502,
+1503,1503,1503,1503,1503,1503,1503,1503,1504,1505,1506,1507,1508,0,0,0,
+1509,1509,1509,1509,1509,1509,1509,1509,0,0,0,0,0,0,0,0,
+1510,1510,1510,1510,1510,1510,1510,1510,1511,1511,1511,1511,1511,1511,1511,1511,
+1512,1512,1512,1512,1512,1512,1512,1512,1513,1513,1513,1513,1513,1513,1513,1513,
+1514,1514,1514,1514,1514,1514,1514,1514,1515,1516,1517,1518,1519,0,0,0,
+1520,1520,1520,1520,1520,1520,1520,1520,1521,1521,1521,1521,1521,1521,1521,1521,
+1522,1522,1522,1522,1522,1522,1522,1522,1523,1523,1523,1523,1523,1523,1523,1523,
+1524,1524,1524,1524,1524,1524,1524,1524,1525,1525,1525,1525,1525,1525,1525,1525,
+1526,1526,1526,1526,1526,1526,1526,1526,1527,1528,0,0,0,0,0,0,
+1529,1529,1529,1529,1529,1529,1529,1529,1530,1530,1530,1530,1530,1530,1530,1530,
+1531,1531,1531,1531,1531,1531,1531,1531,1532,1532,1532,1532,1532,1532,1532,1532,
+1533,1533,1533,1533,1533,1533,1533,1533,1534,1534,1534,1534,1534,1534,1534,1534,
+1535,1535,1535,1535,1535,1535,1535,1535,1536,1537,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1538,1538,1538,1538,1538,1538,1538,1538,
+1539,1539,1539,1539,1539,1539,1539,1539,1540,1540,1540,1540,1540,1540,1540,1540,
+1541,1541,1541,1541,1541,1541,1541,1541,1542,1542,1542,1542,1542,1542,1542,1542,
+1543,1543,1543,1543,1543,1543,1543,1543,1544,1545,0,0,0,0,0,0,
+1546,1546,1546,1546,1546,1546,1546,1546,0,0,0,0,0,0,0,0,
+1547,1547,1547,1547,1547,1547,1547,1547,1548,1548,1548,1548,1548,1548,1548,1548,
+1549,1549,1549,1549,1549,1549,1549,1549,1550,1550,1550,1550,1550,1550,1550,1550,
+1551,1551,1551,1551,1551,1551,1551,1551,1552,1553,1554,1555,1556,0,0,0,
+1557,1557,1557,1557,1557,1557,1557,1557,0,0,0,0,0,0,0,0,
+1558,1558,1558,1558,1558,1558,1558,1558,1559,1559,1559,1559,1559,1559,1559,1559,
+1560,1560,1560,1560,1560,1560,1560,1560,1561,1561,1561,1561,1561,1561,1561,1561,
+1562,1562,1562,1562,1562,1562,1562,1562,1563,1564,1565,1566,1567,0,0,0,
+1568,1568,1568,1568,1568,1568,1568,1568,1569,1569,1569,1569,1569,1569,1569,1569,
+1570,1570,1570,1570,1570,1570,1570,1570,1571,1571,1571,1571,1571,1571,1571,1571,
+1572,1572,1572,1572,1572,1572,1572,1572,1573,1573,1573,1573,1573,1573,1573,1573,
+1574,1574,1574,1574,1574,1574,1574,1574,1575,1576,1577,1578,1579,0,0,0,
+1580,1580,1580,1580,1580,1580,1580,1580,1581,1581,1581,1581,1581,1581,1581,1581,
+1582,1582,1582,1582,1582,1582,1582,1582,1583,1583,1583,1583,1583,1583,1583,1583,
+1584,1584,1584,1584,1584,1584,1584,1584,1585,1585,1585,1585,1585,1585,1585,1585,
+1586,1586,1586,1586,1586,1586,1586,1586,1587,1588,1589,1590,1591,0,0,0,
+1592,1592,1592,1592,1592,1592,1592,1592,1593,1593,1593,1593,1593,1593,1593,1593,
+1594,1594,1594,1594,1594,1594,1594,1594,1595,1595,1595,1595,1595,1595,1595,1595,
+1596,1596,1596,1596,1596,1596,1596,1596,1597,1597,1597,1597,1597,1597,1597,1597,
+1598,1598,1598,1598,1598,1598,1598,1598,1599,1600,1601,1602,1603,0,0,0,
+1604,1604,1604,1604,1604,1604,1604,1604,1605,1605,1605,1605,1605,1605,1605,1605,
+1606,1606,1606,1606,1606,1606,1606,1606,1607,1607,1607,1607,1607,1607,1607,1607,
+1608,1608,1608,1608,1608,1608,1608,1608,1609,1609,1609,1609,1609,1609,1609,1609,
+1610,1610,1610,1610,1610,1610,1610,1610,1611,1612,0,0,0,0,0,0,
+1613,1613,1613,1613,1613,1613,1613,1613,1614,1614,1614,1614,1614,1614,1614,1614,
+1615,1615,1615,1615,1615,1615,1615,1615,1616,1616,1616,1616,1616,1616,1616,1616,
+1617,1617,1617,1617,1617,1617,1617,1617,1618,1618,1618,1618,1618,1618,1618,1618,
+1619,1619,1619,1619,1619,1619,1619,1619,1620,1621,0,0,0,0,0,0,
+1622,1622,1622,1622,1622,1622,1622,1622,1623,1623,1623,1623,1623,1623,1623,1623,
+1624,1624,1624,1624,1624,1624,1624,1624,1625,1625,1625,1625,1625,1625,1625,1625,
+1626,1626,1626,1626,1626,1626,1626,1626,1627,1627,1627,1627,1627,1627,1627,1627,
+1628,1628,1628,1628,1628,1628,1628,1628,1629,1630,0,0,0,0,0,0,
+1631,1631,1631,1631,1631,1631,1631,1631,1632,1632,1632,1632,1632,1632,1632,1632,
+1633,1633,1633,1633,1633,1633,1633,1633,1634,1634,1634,1634,1634,1634,1634,1634,
+1635,1635,1635,1635,1635,1635,1635,1635,1636,1636,1636,1636,1636,1636,1636,1636,
+1637,1637,1637,1637,1637,1637,1637,1637,1638,1639,1640,1641,1642,0,0,0,
+1643,1643,1643,1643,1643,1643,1643,1643,1644,1644,1644,1644,1644,1644,1644,1644,
+1645,1645,1645,1645,1645,1645,1645,1645,1646,1646,1646,1646,1646,1646,1646,1646,
+1647,1647,1647,1647,1647,1647,1647,1647,1648,1648,1648,1648,1648,1648,1648,1648,
+1649,1649,1649,1649,1649,1649,1649,1649,1650,1650,1650,1650,1650,1650,1650,1650,
+1651,1651,1651,1651,1651,1651,1651,1651,1652,1652,1652,1652,1652,1652,1652,1652,
+1653,1653,1653,1653,1653,1653,1653,1653,1654,1654,1654,1654,1654,1654,1654,1654,
+1655,1655,1655,1655,1655,1655,1655,1655,1656,1656,1656,1656,1656,1656,1656,1656,
+1657,1657,1657,1657,1657,1657,1657,1657,1658,1658,1658,1658,1658,1658,1658,1658,
+1659,1659,1659,1659,1659,1659,1659,1659,1660,1660,1660,1660,1660,1660,1660,1660,
+1661,1661,1661,1661,1661,1661,1661,1661,1662,1662,1662,1662,1662,1662,1662,1662,
+1663,1663,1663,1663,1663,1663,1663,1663,1664,1664,1664,1664,1664,1664,1664,1664,
+1665,1665,1665,1665,1665,1665,1665,1665,1666,1666,1666,1666,1666,1666,1666,1666,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1667,1667,1667,1667,1667,1667,1667,1667,1668,1668,1668,1668,1668,1668,1668,1668,
+1669,1669,1669,1669,1669,1669,1669,1669,1670,1670,1670,1670,1670,1670,1670,1670,
+1671,1671,1671,1671,1671,1671,1671,1671,1672,1673,0,0,0,0,0,0,
+1674,1674,1674,1674,1674,1674,1674,1674,1675,1675,1675,1675,1675,1675,1675,1675,
+1676,1676,1676,1676,1676,1676,1676,1676,1677,1677,1677,1677,1677,1677,1677,1677,
+1678,1678,1678,1678,1678,1678,1678,1678,1679,1679,1679,1679,1679,1679,1679,1679,
+1680,1680,1680,1680,1680,1680,1680,1680,1681,1681,1681,1681,1681,1681,1681,1681,
+1682,1682,1682,1682,1682,1682,1682,1682,1683,1683,1683,1683,1683,1683,1683,1683,
+1684,1684,1684,1684,1684,1684,1684,1684,1685,1685,1685,1685,1685,1685,1685,1685,
+1686,1686,1686,1686,1686,1686,1686,1686,1687,1687,1687,1687,1687,1687,1687,1687,
+1688,1688,1688,1688,1688,1688,1688,1688,1689,1689,1689,1689,1689,1689,1689,1689,
+1690,1690,1690,1690,1690,1690,1690,1690,1691,1691,1691,1691,1691,1691,1691,1691,
+1692,1692,1692,1692,1692,1692,1692,1692,1693,1693,1693,1693,1693,1693,1693,1693,
+1694,1694,1694,1694,1694,1694,1694,1694,1695,1695,1695,1695,1695,1695,1695,1695,
+1696,1696,1696,1696,1696,1696,1696,1696,1697,1697,1697,1697,1697,1697,1697,1697,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1698,1698,1698,1698,1698,1698,1698,1698,1699,1699,1699,1699,1699,1699,1699,1699,
+1700,1700,1700,1700,1700,1700,1700,1700,1701,1701,1701,1701,1701,1701,1701,1701,
+1702,1702,1702,1702,1702,1702,1702,1702,1703,1704,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1705,1705,1705,1705,1705,1705,1705,1705,1706,1706,1706,1706,1706,1706,1706,1706,
+1707,1707,1707,1707,1707,1707,1707,1707,1708,1708,1708,1708,1708,1708,1708,1708,
+1709,1709,1709,1709,1709,1709,1709,1709,1710,1711,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1712,1712,1712,1712,1712,1712,1712,1712,1713,1713,1713,1713,1713,1713,1713,1713,
+1714,1714,1714,1714,1714,1714,1714,1714,1715,1715,1715,1715,1715,1715,1715,1715,
+1716,1716,1716,1716,1716,1716,1716,1716,1717,1718,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1719,1719,1719,1719,1719,1719,1719,1719,1720,1720,1720,1720,1720,1720,1720,1720,
+1721,1721,1721,1721,1721,1721,1721,1721,1722,1722,1722,1722,1722,1722,1722,1722,
+1723,1723,1723,1723,1723,1723,1723,1723,1724,1725,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1726,1726,1726,1726,1726,1726,1726,1726,1727,1727,1727,1727,1727,1727,1727,1727,
+1728,1728,1728,1728,1728,1728,1728,1728,1729,1729,1729,1729,1729,1729,1729,1729,
+1730,1730,1730,1730,1730,1730,1730,1730,1731,1732,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1733,1733,1733,1733,1733,1733,1733,1733,1734,1734,1734,1734,1734,1734,1734,1734,
+1735,1735,1735,1735,1735,1735,1735,1735,1736,1736,1736,1736,1736,1736,1736,1736,
+1737,1737,1737,1737,1737,1737,1737,1737,1738,1739,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1740,1740,1740,1740,1740,1740,1740,1740,1741,1741,1741,1741,1741,1741,1741,1741,
+1742,1742,1742,1742,1742,1742,1742,1742,1743,1743,1743,1743,1743,1743,1743,1743,
+1744,1744,1744,1744,1744,1744,1744,1744,1745,1746,0,0,0,0,0,0,
+1747,1747,1747,1747,1747,1747,1747,1747,0,0,0,0,0,0,0,0,
+1748,1748,1748,1748,1748,1748,1748,1748,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1749,1749,1749,1749,1749,1749,1749,1749,
+1750,1750,1750,1750,1750,1750,1750,1750,1751,1752,1753,1754,0,0,0,0,
+1755,1755,1755,1755,1755,1755,1755,1755,0,0,0,0,0,0,0,0,
+1756,1756,1756,1756,1756,1756,1756,1756,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1757,1757,1757,1757,1757,1757,1757,1757,
+1758,1758,1758,1758,1758,1758,1758,1758,1759,1760,1761,1762,0,0,0,0,
+1763,1763,1763,1763,1763,1763,1763,1763,0,0,0,0,0,0,0,0,
+1764,1764,1764,1764,1764,1764,1764,1764,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1765,1765,1765,1765,1765,1765,1765,1765,
+1766,1766,1766,1766,1766,1766,1766,1766,1767,1768,0,0,0,0,0,0,
+1769,1769,1769,1769,1769,1769,1769,1769,0,0,0,0,0,0,0,0,
+1770,1770,1770,1770,1770,1770,1770,1770,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1771,1771,1771,1771,1771,1771,1771,1771,
+1772,1772,1772,1772,1772,1772,1772,1772,1773,1774,1775,1776,0,0,0,0,
+1777,1777,1777,1777,1777,1777,1777,1777,0,0,0,0,0,0,0,0,
+1778,1778,1778,1778,1778,1778,1778,1778,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1779,1779,1779,1779,1779,1779,1779,1779,
+1780,1780,1780,1780,1780,1780,1780,1780,1781,1782,0,0,0,0,0,0,
+1783,1783,1783,1783,1783,1783,1783,1783,0,0,0,0,0,0,0,0,
+1784,1784,1784,1784,1784,1784,1784,1784,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1785,1785,1785,1785,1785,1785,1785,1785,
+1786,1786,1786,1786,1786,1786,1786,1786,1787,1788,1789,1790,0,0,0,0,
+1791,1791,1791,1791,1791,1791,1791,1791,0,0,0,0,0,0,0,0,
+1792,1792,1792,1792,1792,1792,1792,1792,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1793,1793,1793,1793,1793,1793,1793,1793,
+1794,1794,1794,1794,1794,1794,1794,1794,1795,1796,0,0,0,0,0,0,
+1797,1797,1797,1797,1797,1797,1797,1797,0,0,0,0,0,0,0,0,
+1798,1798,1798,1798,1798,1798,1798,1798,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1799,1799,1799,1799,1799,1799,1799,1799,
+1800,1800,1800,1800,1800,1800,1800,1800,1801,1802,0,0,0,0,0,0,
+1803,1803,1803,1803,1803,1803,1803,1803,1804,1804,1804,1804,1804,1804,1804,1804,
+1805,1805,1805,1805,1805,1805,1805,1805,1806,1806,1806,1806,1806,1806,1806,1806,
+1807,1807,1807,1807,1807,1807,1807,1807,1808,1808,1808,1808,1808,1808,1808,1808,
+1809,1809,1809,1809,1809,1809,1809,1809,1810,1811,1812,1813,1814,0,0,0,
+1815,1815,1815,1815,1815,1815,1815,1815,1816,1816,1816,1816,1816,1816,1816,1816,
+1817,1817,1817,1817,1817,1817,1817,1817,1818,1818,1818,1818,1818,1818,1818,1818,
+1819,1819,1819,1819,1819,1819,1819,1819,1820,1820,1820,1820,1820,1820,1820,1820,
+1821,1821,1821,1821,1821,1821,1821,1821,1822,1823,1824,1825,1826,0,0,0,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,1827,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,1828,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1829,1829,1829,1829,1829,1829,1829,1829,0,0,0,0,0,0,0,0,
+1830,1830,1830,1830,1830,1830,1830,1830,1831,1831,1831,1831,1831,1831,1831,1831,
+1832,1832,1832,1832,1832,1832,1832,1832,1833,1834,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1835,1835,1835,1835,1835,1835,1835,1835,1836,1836,1836,1836,1836,1836,1836,1836,
+0,0,0,0,0,0,0,0,1837,1837,1837,1837,1837,1837,1837,1837,
+1838,1838,1838,1838,1838,1838,1838,1838,1839,1840,1841,1842,0,0,0,0,
+};
+static const uae_u16 op_dispatch_index_1[] = {
+0,1,2,3,4,5,6,7,8,9,10,11,4,5,6,7,
+12,13,14,15,4,5,6,7,16,17,18,19,4,5,6,7,
+20,21,22,23,4,5,6,7,24,25,26,27,4,5,6,7,
+28,29,30,31,4,5,6,7,32,33,34,35,4,5,6,7,
+36,37,38,39,40,41,42,43,36,37,38,39,40,41,42,44,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+45,46,47,48,49,50,51,52,45,46,47,48,49,50,51,53,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+54,55,56,57,58,59,60,61,54,55,56,57,58,59,60,62,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+63,64,65,66,67,37,68,69,70,71,72,73,67,37,68,69,
+74,75,76,77,67,37,68,69,78,79,80,81,67,37,68,69,
+82,83,84,85,67,37,68,86,87,88,89,90,67,37,68,69,
+91,92,93,94,67,37,68,69,37,95,96,97,67,37,68,69,
+98,99,100,101,102,103,104,105,98,99,100,106,102,103,104,107,
+98,99,100,108,102,103,104,109,98,99,100,110,102,103,104,111,
+98,99,100,112,102,103,104,113,98,99,100,114,102,103,104,115,
+98,99,100,116,102,103,104,117,98,99,100,118,102,103,104,119,
+120,121,121,122,123,124,124,125,126,127,127,128,129,130,130,131,
+132,133,133,134,135,136,136,137,138,139,139,140,141,142,142,143,
+144,145,145,146,147,148,148,149,150,151,151,152,153,154,154,155,
+156,157,157,158,159,160,160,161,162,163,163,164,165,166,166,167,
+168,168,168,168,169,170,170,170,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+211,212,213,214,215,216,217,218,211,212,213,219,215,216,217,220,
+211,212,213,221,215,216,217,222,211,212,213,223,215,216,217,224,
+211,212,213,225,215,216,217,226,211,212,213,227,215,216,217,228,
+211,212,213,229,215,216,217,230,211,212,213,231,215,216,217,232,
+37,37,37,37,37,37,37,37,233,234,235,236,237,238,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+};
+const struct cpudispatch_tbl op_dispatch_1 = {
+	op_dispatch_handlers_1, op_dispatch_pages_1, op_dispatch_index_1, 1843, 239
+};
+
+/* CPU level 2: 1803 handlers, 233 pages */
+static cpuop_func *const op_dispatch_handlers_2[] = {
+op_illg_1,
+op_0_0_ff,
+op_10_0_ff,
+op_18_0_ff,
+op_20_0_ff,
+op_28_0_ff,
+op_30_0_ff,
+op_38_0_ff,
+op_39_0_ff,
+op_3c_0_ff,
+op_40_0_ff,
+op_50_0_ff,
+op_58_0_ff,
+op_60_0_ff,
+op_68_0_ff,
+op_70_0_ff,
+op_78_0_ff,
+op_79_0_ff,
+op_7c_0_ff,
+op_80_0_ff,
+op_90_0_ff,
+op_98_0_ff,
+op_a0_0_ff,
+op_a8_0_ff,
+op_b0_0_ff,
+op_b8_0_ff,
+op_b9_0_ff,
+op_d0_0_ff,
+op_e8_0_ff,
+op_f0_0_ff,
+op_f8_0_ff,
+op_f9_0_ff,
+op_fa_0_ff,
+op_fb_0_ff,
+op_100_0_ff,
+op_108_0_ff,
+op_110_0_ff,
+op_118_0_ff,
+op_120_0_ff,
+op_128_0_ff,
+op_130_0_ff,
+op_138_0_ff,
+op_139_0_ff,
+op_13a_0_ff,
+op_13b_0_ff,
+op_13c_0_ff,
+op_140_0_ff,
+op_148_0_ff,
+op_150_0_ff,
+op_158_0_ff,
+op_160_0_ff,
+op_168_0_ff,
+op_170_0_ff,
+op_178_0_ff,
+op_179_0_ff,
+op_17a_0_ff,
+op_17b_0_ff,
+op_180_0_ff,
+op_188_0_ff,
+op_190_0_ff,
+op_198_0_ff,
+op_1a0_0_ff,
+op_1a8_0_ff,
+op_1b0_0_ff,
+op_1b8_0_ff,
+op_1b9_0_ff,
+op_1ba_0_ff,
+op_1bb_0_ff,
+op_1c0_0_ff,
+op_1c8_0_ff,
+op_1d0_0_ff,
+op_1d8_0_ff,
+op_1e0_0_ff,
+op_1e8_0_ff,
+op_1f0_0_ff,
+op_1f8_0_ff,
+op_1f9_0_ff,
+op_1fa_0_ff,
+op_1fb_0_ff,
+op_200_0_ff,
+op_210_0_ff,
+op_218_0_ff,
+op_220_0_ff,
+op_228_0_ff,
+op_230_0_ff,
+op_238_0_ff,
+op_239_0_ff,
+op_23c_0_ff,
+op_240_0_ff,
+op_250_0_ff,
+op_258_0_ff,
+op_260_0_ff,
+op_268_0_ff,
+op_270_0_ff,
+op_278_0_ff,
+op_279_0_ff,
+op_27c_0_ff,
+op_280_0_ff,
+op_290_0_ff,
+op_298_0_ff,
+op_2a0_0_ff,
+op_2a8_0_ff,
+op_2b0_0_ff,
+op_2b8_0_ff,
+op_2b9_0_ff,
+op_2d0_0_ff,
+op_2e8_0_ff,
+op_2f0_0_ff,
+op_2f8_0_ff,
+op_2f9_0_ff,
+op_2fa_0_ff,
+op_2fb_0_ff,
+op_400_0_ff,
+op_410_0_ff,
+op_418_0_ff,
+op_420_0_ff,
+op_428_0_ff,
+op_430_0_ff,
+op_438_0_ff,
+op_439_0_ff,
+op_440_0_ff,
+op_450_0_ff,
+op_458_0_ff,
+op_460_0_ff,
+op_468_0_ff,
+op_470_0_ff,
+op_478_0_ff,
+op_479_0_ff,
+op_480_0_ff,
+op_490_0_ff,
+op_498_0_ff,
+op_4a0_0_ff,
+op_4a8_0_ff,
+op_4b0_0_ff,
+op_4b8_0_ff,
+op_4b9_0_ff,
+op_4d0_0_ff,
+op_4e8_0_ff,
+op_4f0_0_ff,
+op_4f8_0_ff,
+op_4f9_0_ff,
+op_4fa_0_ff,
+op_4fb_0_ff,
+op_600_0_ff,
+op_610_0_ff,
+op_618_0_ff,
+op_620_0_ff,
+op_628_0_ff,
+op_630_0_ff,
+op_638_0_ff,
+op_639_0_ff,
+op_640_0_ff,
+op_650_0_ff,
+op_658_0_ff,
+op_660_0_ff,
+op_668_0_ff,
+op_670_0_ff,
+op_678_0_ff,
+op_679_0_ff,
+op_680_0_ff,
+op_690_0_ff,
+op_698_0_ff,
+op_6a0_0_ff,
+op_6a8_0_ff,
+op_6b0_0_ff,
+op_6b8_0_ff,
+op_6b9_0_ff,
+op_6c0_0_ff,
+op_6c8_0_ff,
+op_6d0_0_ff,
+op_6e8_0_ff,
+op_6f0_0_ff,
+op_6f8_0_ff,
+op_6f9_0_ff,
+op_6fa_0_ff,
+op_6fb_0_ff,
+op_800_0_ff,
+op_810_0_ff,
+op_818_0_ff,
+op_820_0_ff,
+op_828_0_ff,
+op_830_0_ff,
+op_838_0_ff,
+op_839_0_ff,
+op_83a_0_ff,
+op_83b_0_ff,
+op_83c_0_ff,
+op_840_0_ff,
+op_850_0_ff,
+op_858_0_ff,
+op_860_0_ff,
+op_868_0_ff,
+op_870_0_ff,
+op_878_0_ff,
+op_879_0_ff,
+op_87a_0_ff,
+op_87b_0_ff,
+op_880_0_ff,
+op_890_0_ff,
+op_898_0_ff,
+op_8a0_0_ff,
+op_8a8_0_ff,
+op_8b0_0_ff,
+op_8b8_0_ff,
+op_8b9_0_ff,
+op_8ba_0_ff,
+op_8bb_0_ff,
+op_8c0_0_ff,
+op_8d0_0_ff,
+op_8d8_0_ff,
+op_8e0_0_ff,
+op_8e8_0_ff,
+op_8f0_0_ff,
+op_8f8_0_ff,
+op_8f9_0_ff,
+op_8fa_0_ff,
+op_8fb_0_ff,
+op_a00_0_ff,
+op_a10_0_ff,
+op_a18_0_ff,
+op_a20_0_ff,
+op_a28_0_ff,
+op_a30_0_ff,
+op_a38_0_ff,
+op_a39_0_ff,
+op_a3c_0_ff,
+op_a40_0_ff,
+op_a50_0_ff,
+op_a58_0_ff,
+op_a60_0_ff,
+op_a68_0_ff,
+op_a70_0_ff,
+op_a78_0_ff,
+op_a79_0_ff,
+op_a7c_0_ff,
+op_a80_0_ff,
+op_a90_0_ff,
+op_a98_0_ff,
+op_aa0_0_ff,
+op_aa8_0_ff,
+op_ab0_0_ff,
+op_ab8_0_ff,
+op_ab9_0_ff,
+op_ad0_0_ff,
+op_ad8_0_ff,
+op_ae0_0_ff,
+op_ae8_0_ff,
+op_af0_0_ff,
+op_af8_0_ff,
+op_af9_0_ff,
+op_c00_0_ff,
+op_c10_0_ff,
+op_c18_0_ff,
+op_c20_0_ff,
+op_c28_0_ff,
+op_c30_0_ff,
+op_c38_0_ff,
+op_c39_0_ff,
+op_c3a_0_ff,
+op_c3b_0_ff,
+op_c40_0_ff,
+op_c50_0_ff,
+op_c58_0_ff,
+op_c60_0_ff,
+op_c68_0_ff,
+op_c70_0_ff,
+op_c78_0_ff,
+op_c79_0_ff,
+op_c7a_0_ff,
+op_c7b_0_ff,
+op_c80_0_ff,
+op_c90_0_ff,
+op_c98_0_ff,
+op_ca0_0_ff,
+op_ca8_0_ff,
+op_cb0_0_ff,
+op_cb8_0_ff,
+op_cb9_0_ff,
+op_cba_0_ff,
+op_cbb_0_ff,
+op_cd0_0_ff,
+op_cd8_0_ff,
+op_ce0_0_ff,
+op_ce8_0_ff,
+op_cf0_0_ff,
+op_cf8_0_ff,
+op_cf9_0_ff,
+op_cfc_0_ff,
+op_e10_0_ff,
+op_e18_0_ff,
+op_e20_0_ff,
+op_e28_0_ff,
+op_e30_0_ff,
+op_e38_0_ff,
+op_e39_0_ff,
+op_e50_0_ff,
+op_e58_0_ff,
+op_e60_0_ff,
+op_e68_0_ff,
+op_e70_0_ff,
+op_e78_0_ff,
+op_e79_0_ff,
+op_e90_0_ff,
+op_e98_0_ff,
+op_ea0_0_ff,
+op_ea8_0_ff,
+op_eb0_0_ff,
+op_eb8_0_ff,
+op_eb9_0_ff,
+op_ed0_0_ff,
+op_ed8_0_ff,
+op_ee0_0_ff,
+op_ee8_0_ff,
+op_ef0_0_ff,
+op_ef8_0_ff,
+op_ef9_0_ff,
+op_efc_0_ff,
+op_1000_0_ff,
+op_1010_0_ff,
+op_1018_0_ff,
+op_1020_0_ff,
+op_1028_0_ff,
+op_1030_0_ff,
+op_1038_0_ff,
+op_1039_0_ff,
+op_103a_0_ff,
+op_103b_0_ff,
+op_103c_0_ff,
+op_1080_0_ff,
+op_1090_0_ff,
+op_1098_0_ff,
+op_10a0_0_ff,
+op_10a8_0_ff,
+op_10b0_0_ff,
+op_10b8_0_ff,
+op_10b9_0_ff,
+op_10ba_0_ff,
+op_10bb_0_ff,
+op_10bc_0_ff,
+op_10c0_0_ff,
+op_10d0_0_ff,
+op_10d8_0_ff,
+op_10e0_0_ff,
+op_10e8_0_ff,
+op_10f0_0_ff,
+op_10f8_0_ff,
+op_10f9_0_ff,
+op_10fa_0_ff,
+op_10fb_0_ff,
+op_10fc_0_ff,
+op_1100_0_ff,
+op_1110_0_ff,
+op_1118_0_ff,
+op_1120_0_ff,
+op_1128_0_ff,
+op_1130_0_ff,
+op_1138_0_ff,
+op_1139_0_ff,
+op_113a_0_ff,
+op_113b_0_ff,
+op_113c_0_ff,
+op_1140_0_ff,
+op_1150_0_ff,
+op_1158_0_ff,
+op_1160_0_ff,
+op_1168_0_ff,
+op_1170_0_ff,
+op_1178_0_ff,
+op_1179_0_ff,
+op_117a_0_ff,
+op_117b_0_ff,
+op_117c_0_ff,
+op_1180_0_ff,
+op_1190_0_ff,
+op_1198_0_ff,
+op_11a0_0_ff,
+op_11a8_0_ff,
+op_11b0_0_ff,
+op_11b8_0_ff,
+op_11b9_0_ff,
+op_11ba_0_ff,
+op_11bb_0_ff,
+op_11bc_0_ff,
+op_11c0_0_ff,
+op_11d0_0_ff,
+op_11d8_0_ff,
+op_11e0_0_ff,
+op_11e8_0_ff,
+op_11f0_0_ff,
+op_11f8_0_ff,
+op_11f9_0_ff,
+op_11fa_0_ff,
+op_11fb_0_ff,
+op_11fc_0_ff,
+op_13c0_0_ff,
+op_13d0_0_ff,
+op_13d8_0_ff,
+op_13e0_0_ff,
+op_13e8_0_ff,
+op_13f0_0_ff,
+op_13f8_0_ff,
+op_13f9_0_ff,
+op_13fa_0_ff,
+op_13fb_0_ff,
+op_13fc_0_ff,
+op_2000_0_ff,
+op_2008_0_ff,
+op_2010_0_ff,
+op_2018_0_ff,
+op_2020_0_ff,
+op_2028_0_ff,
+op_2030_0_ff,
+op_2038_0_ff,
+op_2039_0_ff,
+op_203a_0_ff,
+op_203b_0_ff,
+op_203c_0_ff,
+op_2040_0_ff,
+op_2048_0_ff,
+op_2050_0_ff,
+op_2058_0_ff,
+op_2060_0_ff,
+op_2068_0_ff,
+op_2070_0_ff,
+op_2078_0_ff,
+op_2079_0_ff,
+op_207a_0_ff,
+op_207b_0_ff,
+op_207c_0_ff,
+op_2080_0_ff,
+op_2088_0_ff,
+op_2090_0_ff,
+op_2098_0_ff,
+op_20a0_0_ff,
+op_20a8_0_ff,
+op_20b0_0_ff,
+op_20b8_0_ff,
+op_20b9_0_ff,
+op_20ba_0_ff,
+op_20bb_0_ff,
+op_20bc_0_ff,
+op_20c0_0_ff,
+op_20c8_0_ff,
+op_20d0_0_ff,
+op_20d8_0_ff,
+op_20e0_0_ff,
+op_20e8_0_ff,
+op_20f0_0_ff,
+op_20f8_0_ff,
+op_20f9_0_ff,
+op_20fa_0_ff,
+op_20fb_0_ff,
+op_20fc_0_ff,
+op_2100_0_ff,
+op_2108_0_ff,
+op_2110_0_ff,
+op_2118_0_ff,
+op_2120_0_ff,
+op_2128_0_ff,
+op_2130_0_ff,
+op_2138_0_ff,
+op_2139_0_ff,
+op_213a_0_ff,
+op_213b_0_ff,
+op_213c_0_ff,
+op_2140_0_ff,
+op_2148_0_ff,
+op_2150_0_ff,
+op_2158_0_ff,
+op_2160_0_ff,
+op_2168_0_ff,
+op_2170_0_ff,
+op_2178_0_ff,
+op_2179_0_ff,
+op_217a_0_ff,
+op_217b_0_ff,
+op_217c_0_ff,
+op_2180_0_ff,
+op_2188_0_ff,
+op_2190_0_ff,
+op_2198_0_ff,
+op_21a0_0_ff,
+op_21a8_0_ff,
+op_21b0_0_ff,
+op_21b8_0_ff,
+op_21b9_0_ff,
+op_21ba_0_ff,
+op_21bb_0_ff,
+op_21bc_0_ff,
+op_21c0_0_ff,
+op_21c8_0_ff,
+op_21d0_0_ff,
+op_21d8_0_ff,
+op_21e0_0_ff,
+op_21e8_0_ff,
+op_21f0_0_ff,
+op_21f8_0_ff,
+op_21f9_0_ff,
+op_21fa_0_ff,
+op_21fb_0_ff,
+op_21fc_0_ff,
+op_23c0_0_ff,
+op_23c8_0_ff,
+op_23d0_0_ff,
+op_23d8_0_ff,
+op_23e0_0_ff,
+op_23e8_0_ff,
+op_23f0_0_ff,
+op_23f8_0_ff,
+op_23f9_0_ff,
+op_23fa_0_ff,
+op_23fb_0_ff,
+op_23fc_0_ff,
+op_3000_0_ff,
+op_3008_0_ff,
+op_3010_0_ff,
+op_3018_0_ff,
+op_3020_0_ff,
+op_3028_0_ff,
+op_3030_0_ff,
+op_3038_0_ff,
+op_3039_0_ff,
+op_303a_0_ff,
+op_303b_0_ff,
+op_303c_0_ff,
+op_3040_0_ff,
+op_3048_0_ff,
+op_3050_0_ff,
+op_3058_0_ff,
+op_3060_0_ff,
+op_3068_0_ff,
+op_3070_0_ff,
+op_3078_0_ff,
+op_3079_0_ff,
+op_307a_0_ff,
+op_307b_0_ff,
+op_307c_0_ff,
+op_3080_0_ff,
+op_3088_0_ff,
+op_3090_0_ff,
+op_3098_0_ff,
+op_30a0_0_ff,
+op_30a8_0_ff,
+op_30b0_0_ff,
+op_30b8_0_ff,
+op_30b9_0_ff,
+op_30ba_0_ff,
+op_30bb_0_ff,
+op_30bc_0_ff,
+op_30c0_0_ff,
+op_30c8_0_ff,
+op_30d0_0_ff,
+op_30d8_0_ff,
+op_30e0_0_ff,
+op_30e8_0_ff,
+op_30f0_0_ff,
+op_30f8_0_ff,
+op_30f9_0_ff,
+op_30fa_0_ff,
+op_30fb_0_ff,
+op_30fc_0_ff,
+op_3100_0_ff,
+op_3108_0_ff,
+op_3110_0_ff,
+op_3118_0_ff,
+op_3120_0_ff,
+op_3128_0_ff,
+op_3130_0_ff,
+op_3138_0_ff,
+op_3139_0_ff,
+op_313a_0_ff,
+op_313b_0_ff,
+op_313c_0_ff,
+op_3140_0_ff,
+op_3148_0_ff,
+op_3150_0_ff,
+op_3158_0_ff,
+op_3160_0_ff,
+op_3168_0_ff,
+op_3170_0_ff,
+op_3178_0_ff,
+op_3179_0_ff,
+op_317a_0_ff,
+op_317b_0_ff,
+op_317c_0_ff,
+op_3180_0_ff,
+op_3188_0_ff,
+op_3190_0_ff,
+op_3198_0_ff,
+op_31a0_0_ff,
+op_31a8_0_ff,
+op_31b0_0_ff,
+op_31b8_0_ff,
+op_31b9_0_ff,
+op_31ba_0_ff,
+op_31bb_0_ff,
+op_31bc_0_ff,
+op_31c0_0_ff,
+op_31c8_0_ff,
+op_31d0_0_ff,
+op_31d8_0_ff,
+op_31e0_0_ff,
+op_31e8_0_ff,
+op_31f0_0_ff,
+op_31f8_0_ff,
+op_31f9_0_ff,
+op_31fa_0_ff,
+op_31fb_0_ff,
+op_31fc_0_ff,
+op_33c0_0_ff,
+op_33c8_0_ff,
+op_33d0_0_ff,
+op_33d8_0_ff,
+op_33e0_0_ff,
+op_33e8_0_ff,
+op_33f0_0_ff,
+op_33f8_0_ff,
+op_33f9_0_ff,
+op_33fa_0_ff,
+op_33fb_0_ff,
+op_33fc_0_ff,
+op_4000_0_ff,
+op_4010_0_ff,
+op_4018_0_ff,
+op_4020_0_ff,
+op_4028_0_ff,
+op_4030_0_ff,
+op_4038_0_ff,
+op_4039_0_ff,
+op_4040_0_ff,
+op_4050_0_ff,
+op_4058_0_ff,
+op_4060_0_ff,
+op_4068_0_ff,
+op_4070_0_ff,
+op_4078_0_ff,
+op_4079_0_ff,
+op_4080_0_ff,
+op_4090_0_ff,
+op_4098_0_ff,
+op_40a0_0_ff,
+op_40a8_0_ff,
+op_40b0_0_ff,
+op_40b8_0_ff,
+op_40b9_0_ff,
+op_40c0_0_ff,
+op_40d0_0_ff,
+op_40d8_0_ff,
+op_40e0_0_ff,
+op_40e8_0_ff,
+op_40f0_0_ff,
+op_40f8_0_ff,
+op_40f9_0_ff,
+op_4100_0_ff,
+op_4110_0_ff,
+op_4118_0_ff,
+op_4120_0_ff,
+op_4128_0_ff,
+op_4130_0_ff,
+op_4138_0_ff,
+op_4139_0_ff,
+op_413a_0_ff,
+op_413b_0_ff,
+op_413c_0_ff,
+op_4180_0_ff,
+op_4190_0_ff,
+op_4198_0_ff,
+op_41a0_0_ff,
+op_41a8_0_ff,
+op_41b0_0_ff,
+op_41b8_0_ff,
+op_41b9_0_ff,
+op_41ba_0_ff,
+op_41bb_0_ff,
+op_41bc_0_ff,
+op_41d0_0_ff,
+op_41e8_0_ff,
+op_41f0_0_ff,
+op_41f8_0_ff,
+op_41f9_0_ff,
+op_41fa_0_ff,
+op_41fb_0_ff,
+op_4200_0_ff,
+op_4210_0_ff,
+op_4218_0_ff,
+op_4220_0_ff,
+op_4228_0_ff,
+op_4230_0_ff,
+op_4238_0_ff,
+op_4239_0_ff,
+op_4240_0_ff,
+op_4250_0_ff,
+op_4258_0_ff,
+op_4260_0_ff,
+op_4268_0_ff,
+op_4270_0_ff,
+op_4278_0_ff,
+op_4279_0_ff,
+op_4280_0_ff,
+op_4290_0_ff,
+op_4298_0_ff,
+op_42a0_0_ff,
+op_42a8_0_ff,
+op_42b0_0_ff,
+op_42b8_0_ff,
+op_42b9_0_ff,
+op_42c0_0_ff,
+op_42d0_0_ff,
+op_42d8_0_ff,
+op_42e0_0_ff,
+op_42e8_0_ff,
+op_42f0_0_ff,
+op_42f8_0_ff,
+op_42f9_0_ff,
+op_4400_0_ff,
+op_4410_0_ff,
+op_4418_0_ff,
+op_4420_0_ff,
+op_4428_0_ff,
+op_4430_0_ff,
+op_4438_0_ff,
+op_4439_0_ff,
+op_4440_0_ff,
+op_4450_0_ff,
+op_4458_0_ff,
+op_4460_0_ff,
+op_4468_0_ff,
+op_4470_0_ff,
+op_4478_0_ff,
+op_4479_0_ff,
+op_4480_0_ff,
+op_4490_0_ff,
+op_4498_0_ff,
+op_44a0_0_ff,
+op_44a8_0_ff,
+op_44b0_0_ff,
+op_44b8_0_ff,
+op_44b9_0_ff,
+op_44c0_0_ff,
+op_44d0_0_ff,
+op_44d8_0_ff,
+op_44e0_0_ff,
+op_44e8_0_ff,
+op_44f0_0_ff,
+op_44f8_0_ff,
+op_44f9_0_ff,
+op_44fa_0_ff,
+op_44fb_0_ff,
+op_44fc_0_ff,
+op_4600_0_ff,
+op_4610_0_ff,
+op_4618_0_ff,
+op_4620_0_ff,
+op_4628_0_ff,
+op_4630_0_ff,
+op_4638_0_ff,
+op_4639_0_ff,
+op_4640_0_ff,
+op_4650_0_ff,
+op_4658_0_ff,
+op_4660_0_ff,
+op_4668_0_ff,
+op_4670_0_ff,
+op_4678_0_ff,
+op_4679_0_ff,
+op_4680_0_ff,
+op_4690_0_ff,
+op_4698_0_ff,
+op_46a0_0_ff,
+op_46a8_0_ff,
+op_46b0_0_ff,
+op_46b8_0_ff,
+op_46b9_0_ff,
+op_46c0_0_ff,
+op_46d0_0_ff,
+op_46d8_0_ff,
+op_46e0_0_ff,
+op_46e8_0_ff,
+op_46f0_0_ff,
+op_46f8_0_ff,
+op_46f9_0_ff,
+op_46fa_0_ff,
+op_46fb_0_ff,
+op_46fc_0_ff,
+op_4800_1_ff,
+op_4808_0_ff,
+op_4810_1_ff,
+op_4818_1_ff,
+op_4820_1_ff,
+op_4828_1_ff,
+op_4830_1_ff,
+op_4838_1_ff,
+op_4839_1_ff,
+op_4840_0_ff,
+op_4848_0_ff,
+op_4850_0_ff,
+op_4868_0_ff,
+op_4870_0_ff,
+op_4878_0_ff,
+op_4879_0_ff,
+op_487a_0_ff,
+op_487b_0_ff,
+op_4880_0_ff,
+op_4890_0_ff,
+op_48a0_0_ff,
+op_48a8_0_ff,
+op_48b0_0_ff,
+op_48b8_0_ff,
+op_48b9_0_ff,
+op_48c0_0_ff,
+op_48d0_0_ff,
+op_48e0_0_ff,
+op_48e8_0_ff,
+op_48f0_0_ff,
+op_48f8_0_ff,
+op_48f9_0_ff,
+op_49c0_0_ff,
+op_4a00_0_ff,
+op_4a10_0_ff,
+op_4a18_0_ff,
+op_4a20_0_ff,
+op_4a28_0_ff,
+op_4a30_0_ff,
+op_4a38_0_ff,
+op_4a39_0_ff,
+op_4a3a_0_ff,
+op_4a3b_0_ff,
+op_4a3c_0_ff,
+op_4a40_0_ff,
+op_4a48_0_ff,
+op_4a50_0_ff,
+op_4a58_0_ff,
+op_4a60_0_ff,
+op_4a68_0_ff,
+op_4a70_0_ff,
+op_4a78_0_ff,
+op_4a79_0_ff,
+op_4a7a_0_ff,
+op_4a7b_0_ff,
+op_4a7c_0_ff,
+op_4a80_0_ff,
+op_4a88_0_ff,
+op_4a90_0_ff,
+op_4a98_0_ff,
+op_4aa0_0_ff,
+op_4aa8_0_ff,
+op_4ab0_0_ff,
+op_4ab8_0_ff,
+op_4ab9_0_ff,
+op_4aba_0_ff,
+op_4abb_0_ff,
+op_4abc_0_ff,
+op_4ac0_0_ff,
+op_4ad0_0_ff,
+op_4ad8_0_ff,
+op_4ae0_0_ff,
+op_4ae8_0_ff,
+op_4af0_0_ff,
+op_4af8_0_ff,
+op_4af9_0_ff,
+op_4c00_0_ff,
+op_4c10_0_ff,
+op_4c18_0_ff,
+op_4c20_0_ff,
+op_4c28_0_ff,
+op_4c30_0_ff,
+op_4c38_0_ff,
+op_4c39_0_ff,
+op_4c3a_0_ff,
+op_4c3b_0_ff,
+op_4c3c_0_ff,
+op_4c40_0_ff,
+op_4c50_0_ff,
+op_4c58_0_ff,
+op_4c60_0_ff,
+op_4c68_0_ff,
+op_4c70_0_ff,
+op_4c78_0_ff,
+op_4c79_0_ff,
+op_4c7a_0_ff,
+op_4c7b_0_ff,
+op_4c7c_0_ff,
+op_4c90_0_ff,
+op_4c98_0_ff,
+op_4ca8_0_ff,
+op_4cb0_0_ff,
+op_4cb8_0_ff,
+op_4cb9_0_ff,
+op_4cba_0_ff,
+op_4cbb_0_ff,
+op_4cd0_0_ff,
+op_4cd8_0_ff,
+op_4ce8_0_ff,
+op_4cf0_0_ff,
+op_4cf8_0_ff,
+op_4cf9_0_ff,
+op_4cfa_0_ff,
+op_4cfb_0_ff,
+op_4e40_0_ff,
+op_4e50_0_ff,
+op_4e58_0_ff,
+op_4e60_0_ff,
+op_4e68_0_ff,
+op_4e70_0_ff,
+op_4e71_0_ff,
+op_4e72_0_ff,
+op_4e73_0_ff,
+op_4e74_0_ff,
+op_4e75_0_ff,
+op_4e76_0_ff,
+op_4e77_0_ff,
+op_4e7a_0_ff,
+op_4e7b_0_ff,
+op_4e90_0_ff,
+op_4ea8_0_ff,
+op_4eb0_0_ff,
+op_4eb8_0_ff,
+op_4eb9_0_ff,
+op_4eba_0_ff,
+op_4ebb_0_ff,
+op_4ed0_0_ff,
+op_4ee8_0_ff,
+op_4ef0_0_ff,
+op_4ef8_0_ff,
+op_4ef9_0_ff,
+op_4efa_0_ff,
+op_4efb_0_ff,
+op_5000_0_ff,
+op_5010_0_ff,
+op_5018_0_ff,
+op_5020_0_ff,
+op_5028_0_ff,
+op_5030_0_ff,
+op_5038_0_ff,
+op_5039_0_ff,
+op_5040_0_ff,
+op_5048_0_ff,
+op_5050_0_ff,
+op_5058_0_ff,
+op_5060_0_ff,
+op_5068_0_ff,
+op_5070_0_ff,
+op_5078_0_ff,
+op_5079_0_ff,
+op_5080_0_ff,
+op_5088_0_ff,
+op_5090_0_ff,
+op_5098_0_ff,
+op_50a0_0_ff,
+op_50a8_0_ff,
+op_50b0_0_ff,
+op_50b8_0_ff,
+op_50b9_0_ff,
+op_50c0_0_ff,
+op_50c8_0_ff,
+op_50d0_0_ff,
+op_50d8_0_ff,
+op_50e0_0_ff,
+op_50e8_0_ff,
+op_50f0_0_ff,
+op_50f8_0_ff,
+op_50f9_0_ff,
+op_50fa_0_ff,
+op_50fb_0_ff,
+op_50fc_0_ff,
+op_5100_0_ff,
+op_5110_0_ff,
+op_5118_0_ff,
+op_5120_0_ff,
+op_5128_0_ff,
+op_5130_0_ff,
+op_5138_0_ff,
+op_5139_0_ff,
+op_5140_0_ff,
+op_5148_0_ff,
+op_5150_0_ff,
+op_5158_0_ff,
+op_5160_0_ff,
+op_5168_0_ff,
+op_5170_0_ff,
+op_5178_0_ff,
+op_5179_0_ff,
+op_5180_0_ff,
+op_5188_0_ff,
+op_5190_0_ff,
+op_5198_0_ff,
+op_51a0_0_ff,
+op_51a8_0_ff,
+op_51b0_0_ff,
+op_51b8_0_ff,
+op_51b9_0_ff,
+op_51c0_0_ff,
+op_51c8_0_ff,
+op_51d0_0_ff,
+op_51d8_0_ff,
+op_51e0_0_ff,
+op_51e8_0_ff,
+op_51f0_0_ff,
+op_51f8_0_ff,
+op_51f9_0_ff,
+op_51fa_0_ff,
+op_51fb_0_ff,
+op_51fc_0_ff,
+op_52c0_0_ff,
+op_52c8_0_ff,
+op_52d0_0_ff,
+op_52d8_0_ff,
+op_52e0_0_ff,
+op_52e8_0_ff,
+op_52f0_0_ff,
+op_52f8_0_ff,
+op_52f9_0_ff,
+op_52fa_0_ff,
+op_52fb_0_ff,
+op_52fc_0_ff,
+op_53c0_0_ff,
+op_53c8_0_ff,
+op_53d0_0_ff,
+op_53d8_0_ff,
+op_53e0_0_ff,
+op_53e8_0_ff,
+op_53f0_0_ff,
+op_53f8_0_ff,
+op_53f9_0_ff,
+op_53fa_0_ff,
+op_53fb_0_ff,
+op_53fc_0_ff,
+op_54c0_0_ff,
+op_54c8_0_ff,
+op_54d0_0_ff,
+op_54d8_0_ff,
+op_54e0_0_ff,
+op_54e8_0_ff,
+op_54f0_0_ff,
+op_54f8_0_ff,
+op_54f9_0_ff,
+op_54fa_0_ff,
+op_54fb_0_ff,
+op_54fc_0_ff,
+op_55c0_0_ff,
+op_55c8_0_ff,
+op_55d0_0_ff,
+op_55d8_0_ff,
+op_55e0_0_ff,
+op_55e8_0_ff,
+op_55f0_0_ff,
+op_55f8_0_ff,
+op_55f9_0_ff,
+op_55fa_0_ff,
+op_55fb_0_ff,
+op_55fc_0_ff,
+op_56c0_0_ff,
+op_56c8_0_ff,
+op_56d0_0_ff,
+op_56d8_0_ff,
+op_56e0_0_ff,
+op_56e8_0_ff,
+op_56f0_0_ff,
+op_56f8_0_ff,
+op_56f9_0_ff,
+op_56fa_0_ff,
+op_56fb_0_ff,
+op_56fc_0_ff,
+op_57c0_0_ff,
+op_57c8_0_ff,
+op_57d0_0_ff,
+op_57d8_0_ff,
+op_57e0_0_ff,
+op_57e8_0_ff,
+op_57f0_0_ff,
+op_57f8_0_ff,
+op_57f9_0_ff,
+op_57fa_0_ff,
+op_57fb_0_ff,
+op_57fc_0_ff,
+op_58c0_0_ff,
+op_58c8_0_ff,
+op_58d0_0_ff,
+op_58d8_0_ff,
+op_58e0_0_ff,
+op_58e8_0_ff,
+op_58f0_0_ff,
+op_58f8_0_ff,
+op_58f9_0_ff,
+op_58fa_0_ff,
+op_58fb_0_ff,
+op_58fc_0_ff,
+op_59c0_0_ff,
+op_59c8_0_ff,
+op_59d0_0_ff,
+op_59d8_0_ff,
+op_59e0_0_ff,
+op_59e8_0_ff,
+op_59f0_0_ff,
+op_59f8_0_ff,
+op_59f9_0_ff,
+op_59fa_0_ff,
+op_59fb_0_ff,
+op_59fc_0_ff,
+op_5ac0_0_ff,
+op_5ac8_0_ff,
+op_5ad0_0_ff,
+op_5ad8_0_ff,
+op_5ae0_0_ff,
+op_5ae8_0_ff,
+op_5af0_0_ff,
+op_5af8_0_ff,
+op_5af9_0_ff,
+op_5afa_0_ff,
+op_5afb_0_ff,
+op_5afc_0_ff,
+op_5bc0_0_ff,
+op_5bc8_0_ff,
+op_5bd0_0_ff,
+op_5bd8_0_ff,
+op_5be0_0_ff,
+op_5be8_0_ff,
+op_5bf0_0_ff,
+op_5bf8_0_ff,
+op_5bf9_0_ff,
+op_5bfa_0_ff,
+op_5bfb_0_ff,
+op_5bfc_0_ff,
+op_5cc0_0_ff,
+op_5cc8_0_ff,
+op_5cd0_0_ff,
+op_5cd8_0_ff,
+op_5ce0_0_ff,
+op_5ce8_0_ff,
+op_5cf0_0_ff,
+op_5cf8_0_ff,
+op_5cf9_0_ff,
+op_5cfa_0_ff,
+op_5cfb_0_ff,
+op_5cfc_0_ff,
+op_5dc0_0_ff,
+op_5dc8_0_ff,
+op_5dd0_0_ff,
+op_5dd8_0_ff,
+op_5de0_0_ff,
+op_5de8_0_ff,
+op_5df0_0_ff,
+op_5df8_0_ff,
+op_5df9_0_ff,
+op_5dfa_0_ff,
+op_5dfb_0_ff,
+op_5dfc_0_ff,
+op_5ec0_0_ff,
+op_5ec8_0_ff,
+op_5ed0_0_ff,
+op_5ed8_0_ff,
+op_5ee0_0_ff,
+op_5ee8_0_ff,
+op_5ef0_0_ff,
+op_5ef8_0_ff,
+op_5ef9_0_ff,
+op_5efa_0_ff,
+op_5efb_0_ff,
+op_5efc_0_ff,
+op_5fc0_0_ff,
+op_5fc8_0_ff,
+op_5fd0_0_ff,
+op_5fd8_0_ff,
+op_5fe0_0_ff,
+op_5fe8_0_ff,
+op_5ff0_0_ff,
+op_5ff8_0_ff,
+op_5ff9_0_ff,
+op_5ffa_0_ff,
+op_5ffb_0_ff,
+op_5ffc_0_ff,
+op_6000_0_ff,
+op_6001_0_ff,
+op_60ff_0_ff,
+op_6100_0_ff,
+op_6101_0_ff,
+op_61ff_0_ff,
+op_6200_0_ff,
+op_6201_0_ff,
+op_62ff_0_ff,
+op_6300_0_ff,
+op_6301_0_ff,
+op_63ff_0_ff,
+op_6400_0_ff,
+op_6401_0_ff,
+op_64ff_0_ff,
+op_6500_0_ff,
+op_6501_0_ff,
+op_65ff_0_ff,
+op_6600_0_ff,
+op_6601_0_ff,
+op_66ff_0_ff,
+op_6700_0_ff,
+op_6701_0_ff,
+op_67ff_0_ff,
+op_6800_0_ff,
+op_6801_0_ff,
+op_68ff_0_ff,
+op_6900_0_ff,
+op_6901_0_ff,
+op_69ff_0_ff,
+op_6a00_0_ff,
+op_6a01_0_ff,
+op_6aff_0_ff,
+op_6b00_0_ff,
+op_6b01_0_ff,
+op_6bff_0_ff,
+op_6c00_0_ff,
+op_6c01_0_ff,
+op_6cff_0_ff,
+op_6d00_0_ff,
+op_6d01_0_ff,
+op_6dff_0_ff,
+op_6e00_0_ff,
+op_6e01_0_ff,
+op_6eff_0_ff,
+op_6f00_0_ff,
+op_6f01_0_ff,
+op_6fff_0_ff,
+op_7000_0_ff,
+op_7100_0_ff,
+op_7101_0_ff,
+op_8000_0_ff,
+op_8010_0_ff,
+op_8018_0_ff,
+op_8020_0_ff,
+op_8028_0_ff,
+op_8030_0_ff,
+op_8038_0_ff,
+op_8039_0_ff,
+op_803a_0_ff,
+op_803b_0_ff,
+op_803c_0_ff,
+op_8040_0_ff,
+op_8050_0_ff,
+op_8058_0_ff,
+op_8060_0_ff,
+op_8068_0_ff,
+op_8070_0_ff,
+op_8078_0_ff,
+op_8079_0_ff,
+op_807a_0_ff,
+op_807b_0_ff,
+op_807c_0_ff,
+op_8080_0_ff,
+op_8090_0_ff,
+op_8098_0_ff,
+op_80a0_0_ff,
+op_80a8_0_ff,
+op_80b0_0_ff,
+op_80b8_0_ff,
+op_80b9_0_ff,
+op_80ba_0_ff,
+op_80bb_0_ff,
+op_80bc_0_ff,
+op_80c0_0_ff,
+op_80d0_0_ff,
+op_80d8_0_ff,
+op_80e0_0_ff,
+op_80e8_0_ff,
+op_80f0_0_ff,
+op_80f8_0_ff,
+op_80f9_0_ff,
+op_80fa_0_ff,
+op_80fb_0_ff,
+op_80fc_0_ff,
+op_8100_1_ff,
+op_8108_1_ff,
+op_8110_0_ff,
+op_8118_0_ff,
+op_8120_0_ff,
+op_8128_0_ff,
+op_8130_0_ff,
+op_8138_0_ff,
+op_8139_0_ff,
+op_8140_0_ff,
+op_8148_0_ff,
+op_8150_0_ff,
+op_8158_0_ff,
+op_8160_0_ff,
+op_8168_0_ff,
+op_8170_0_ff,
+op_8178_0_ff,
+op_8179_0_ff,
+op_8180_0_ff,
+op_8188_0_ff,
+op_8190_0_ff,
+op_8198_0_ff,
+op_81a0_0_ff,
+op_81a8_0_ff,
+op_81b0_0_ff,
+op_81b8_0_ff,
+op_81b9_0_ff,
+op_81c0_0_ff,
+op_81d0_0_ff,
+op_81d8_0_ff,
+op_81e0_0_ff,
+op_81e8_0_ff,
+op_81f0_0_ff,
+op_81f8_0_ff,
+op_81f9_0_ff,
+op_81fa_0_ff,
+op_81fb_0_ff,
+op_81fc_0_ff,
+op_9000_0_ff,
+op_9010_0_ff,
+op_9018_0_ff,
+op_9020_0_ff,
+op_9028_0_ff,
+op_9030_0_ff,
+op_9038_0_ff,
+op_9039_0_ff,
+op_903a_0_ff,
+op_903b_0_ff,
+op_903c_0_ff,
+op_9040_0_ff,
+op_9048_0_ff,
+op_9050_0_ff,
+op_9058_0_ff,
+op_9060_0_ff,
+op_9068_0_ff,
+op_9070_0_ff,
+op_9078_0_ff,
+op_9079_0_ff,
+op_907a_0_ff,
+op_907b_0_ff,
+op_907c_0_ff,
+op_9080_0_ff,
+op_9088_0_ff,
+op_9090_0_ff,
+op_9098_0_ff,
+op_90a0_0_ff,
+op_90a8_0_ff,
+op_90b0_0_ff,
+op_90b8_0_ff,
+op_90b9_0_ff,
+op_90ba_0_ff,
+op_90bb_0_ff,
+op_90bc_0_ff,
+op_90c0_0_ff,
+op_90c8_0_ff,
+op_90d0_0_ff,
+op_90d8_0_ff,
+op_90e0_0_ff,
+op_90e8_0_ff,
+op_90f0_0_ff,
+op_90f8_0_ff,
+op_90f9_0_ff,
+op_90fa_0_ff,
+op_90fb_0_ff,
+op_90fc_0_ff,
+op_9100_0_ff,
+op_9108_0_ff,
+op_9110_0_ff,
+op_9118_0_ff,
+op_9120_0_ff,
+op_9128_0_ff,
+op_9130_0_ff,
+op_9138_0_ff,
+op_9139_0_ff,
+op_9140_0_ff,
+op_9148_0_ff,
+op_9150_0_ff,
+op_9158_0_ff,
+op_9160_0_ff,
+op_9168_0_ff,
+op_9170_0_ff,
+op_9178_0_ff,
+op_9179_0_ff,
+op_9180_0_ff,
+op_9188_0_ff,
+op_9190_0_ff,
+op_9198_0_ff,
+op_91a0_0_ff,
+op_91a8_0_ff,
+op_91b0_0_ff,
+op_91b8_0_ff,
+op_91b9_0_ff,
+op_91c0_0_ff,
+op_91c8_0_ff,
+op_91d0_0_ff,
+op_91d8_0_ff,
+op_91e0_0_ff,
+op_91e8_0_ff,
+op_91f0_0_ff,
+op_91f8_0_ff,
+op_91f9_0_ff,
+op_91fa_0_ff,
+op_91fb_0_ff,
+op_91fc_0_ff,
+op_b000_0_ff,
+op_b010_0_ff,
+op_b018_0_ff,
+op_b020_0_ff,
+op_b028_0_ff,
+op_b030_0_ff,
+op_b038_0_ff,
+op_b039_0_ff,
+op_b03a_0_ff,
+op_b03b_0_ff,
+op_b03c_0_ff,
+op_b040_0_ff,
+op_b048_0_ff,
+op_b050_0_ff,
+op_b058_0_ff,
+op_b060_0_ff,
+op_b068_0_ff,
+op_b070_0_ff,
+op_b078_0_ff,
+op_b079_0_ff,
+op_b07a_0_ff,
+op_b07b_0_ff,
+op_b07c_0_ff,
+op_b080_0_ff,
+op_b088_0_ff,
+op_b090_0_ff,
+op_b098_0_ff,
+op_b0a0_0_ff,
+op_b0a8_0_ff,
+op_b0b0_0_ff,
+op_b0b8_0_ff,
+op_b0b9_0_ff,
+op_b0ba_0_ff,
+op_b0bb_0_ff,
+op_b0bc_0_ff,
+op_b0c0_0_ff,
+op_b0c8_0_ff,
+op_b0d0_0_ff,
+op_b0d8_0_ff,
+op_b0e0_0_ff,
+op_b0e8_0_ff,
+op_b0f0_0_ff,
+op_b0f8_0_ff,
+op_b0f9_0_ff,
+op_b0fa_0_ff,
+op_b0fb_0_ff,
+op_b0fc_0_ff,
+op_b100_0_ff,
+op_b108_0_ff,
+op_b110_0_ff,
+op_b118_0_ff,
+op_b120_0_ff,
+op_b128_0_ff,
+op_b130_0_ff,
+op_b138_0_ff,
+op_b139_0_ff,
+op_b140_0_ff,
+op_b148_0_ff,
+op_b150_0_ff,
+op_b158_0_ff,
+op_b160_0_ff,
+op_b168_0_ff,
+op_b170_0_ff,
+op_b178_0_ff,
+op_b179_0_ff,
+op_b180_0_ff,
+op_b188_0_ff,
+op_b190_0_ff,
+op_b198_0_ff,
+op_b1a0_0_ff,
+op_b1a8_0_ff,
+op_b1b0_0_ff,
+op_b1b8_0_ff,
+op_b1b9_0_ff,
+op_b1c0_0_ff,
+op_b1c8_0_ff,
+op_b1d0_0_ff,
+op_b1d8_0_ff,
+op_b1e0_0_ff,
+op_b1e8_0_ff,
+op_b1f0_0_ff,
+op_b1f8_0_ff,
+op_b1f9_0_ff,
+op_b1fa_0_ff,
+op_b1fb_0_ff,
+op_b1fc_0_ff,
+op_c000_0_ff,
+op_c010_0_ff,
+op_c018_0_ff,
+op_c020_0_ff,
+op_c028_0_ff,
+op_c030_0_ff,
+op_c038_0_ff,
+op_c039_0_ff,
+op_c03a_0_ff,
+op_c03b_0_ff,
+op_c03c_0_ff,
+op_c040_0_ff,
+op_c050_0_ff,
+op_c058_0_ff,
+op_c060_0_ff,
+op_c068_0_ff,
+op_c070_0_ff,
+op_c078_0_ff,
+op_c079_0_ff,
+op_c07a_0_ff,
+op_c07b_0_ff,
+op_c07c_0_ff,
+op_c080_0_ff,
+op_c090_0_ff,
+op_c098_0_ff,
+op_c0a0_0_ff,
+op_c0a8_0_ff,
+op_c0b0_0_ff,
+op_c0b8_0_ff,
+op_c0b9_0_ff,
+op_c0ba_0_ff,
+op_c0bb_0_ff,
+op_c0bc_0_ff,
+op_c0c0_0_ff,
+op_c0d0_0_ff,
+op_c0d8_0_ff,
+op_c0e0_0_ff,
+op_c0e8_0_ff,
+op_c0f0_0_ff,
+op_c0f8_0_ff,
+op_c0f9_0_ff,
+op_c0fa_0_ff,
+op_c0fb_0_ff,
+op_c0fc_0_ff,
+op_c100_1_ff,
+op_c108_1_ff,
+op_c110_0_ff,
+op_c118_0_ff,
+op_c120_0_ff,
+op_c128_0_ff,
+op_c130_0_ff,
+op_c138_0_ff,
+op_c139_0_ff,
+op_c140_0_ff,
+op_c148_0_ff,
+op_c150_0_ff,
+op_c158_0_ff,
+op_c160_0_ff,
+op_c168_0_ff,
+op_c170_0_ff,
+op_c178_0_ff,
+op_c179_0_ff,
+op_c188_0_ff,
+op_c190_0_ff,
+op_c198_0_ff,
+op_c1a0_0_ff,
+op_c1a8_0_ff,
+op_c1b0_0_ff,
+op_c1b8_0_ff,
+op_c1b9_0_ff,
+op_c1c0_0_ff,
+op_c1d0_0_ff,
+op_c1d8_0_ff,
+op_c1e0_0_ff,
+op_c1e8_0_ff,
+op_c1f0_0_ff,
+op_c1f8_0_ff,
+op_c1f9_0_ff,
+op_c1fa_0_ff,
+op_c1fb_0_ff,
+op_c1fc_0_ff,
+op_d000_0_ff,
+op_d010_0_ff,
+op_d018_0_ff,
+op_d020_0_ff,
+op_d028_0_ff,
+op_d030_0_ff,
+op_d038_0_ff,
+op_d039_0_ff,
+op_d03a_0_ff,
+op_d03b_0_ff,
+op_d03c_0_ff,
+op_d040_0_ff,
+op_d048_0_ff,
+op_d050_0_ff,
+op_d058_0_ff,
+op_d060_0_ff,
+op_d068_0_ff,
+op_d070_0_ff,
+op_d078_0_ff,
+op_d079_0_ff,
+op_d07a_0_ff,
+op_d07b_0_ff,
+op_d07c_0_ff,
+op_d080_0_ff,
+op_d088_0_ff,
+op_d090_0_ff,
+op_d098_0_ff,
+op_d0a0_0_ff,
+op_d0a8_0_ff,
+op_d0b0_0_ff,
+op_d0b8_0_ff,
+op_d0b9_0_ff,
+op_d0ba_0_ff,
+op_d0bb_0_ff,
+op_d0bc_0_ff,
+op_d0c0_0_ff,
+op_d0c8_0_ff,
+op_d0d0_0_ff,
+op_d0d8_0_ff,
+op_d0e0_0_ff,
+op_d0e8_0_ff,
+op_d0f0_0_ff,
+op_d0f8_0_ff,
+op_d0f9_0_ff,
+op_d0fa_0_ff,
+op_d0fb_0_ff,
+op_d0fc_0_ff,
+op_d100_0_ff,
+op_d108_0_ff,
+op_d110_0_ff,
+op_d118_0_ff,
+op_d120_0_ff,
+op_d128_0_ff,
+op_d130_0_ff,
+op_d138_0_ff,
+op_d139_0_ff,
+op_d140_0_ff,
+op_d148_0_ff,
+op_d150_0_ff,
+op_d158_0_ff,
+op_d160_0_ff,
+op_d168_0_ff,
+op_d170_0_ff,
+op_d178_0_ff,
+op_d179_0_ff,
+op_d180_0_ff,
+op_d188_0_ff,
+op_d190_0_ff,
+op_d198_0_ff,
+op_d1a0_0_ff,
+op_d1a8_0_ff,
+op_d1b0_0_ff,
+op_d1b8_0_ff,
+op_d1b9_0_ff,
+op_d1c0_0_ff,
+op_d1c8_0_ff,
+op_d1d0_0_ff,
+op_d1d8_0_ff,
+op_d1e0_0_ff,
+op_d1e8_0_ff,
+op_d1f0_0_ff,
+op_d1f8_0_ff,
+op_d1f9_0_ff,
+op_d1fa_0_ff,
+op_d1fb_0_ff,
+op_d1fc_0_ff,
+op_e000_0_ff,
+op_e008_0_ff,
+op_e010_0_ff,
+op_e018_0_ff,
+op_e020_0_ff,
+op_e028_0_ff,
+op_e030_0_ff,
+op_e038_0_ff,
+op_e040_0_ff,
+op_e048_0_ff,
+op_e050_0_ff,
+op_e058_0_ff,
+op_e060_0_ff,
+op_e068_0_ff,
+op_e070_0_ff,
+op_e078_0_ff,
+op_e080_0_ff,
+op_e088_0_ff,
+op_e090_0_ff,
+op_e098_0_ff,
+op_e0a0_0_ff,
+op_e0a8_0_ff,
+op_e0b0_0_ff,
+op_e0b8_0_ff,
+op_e0d0_0_ff,
+op_e0d8_0_ff,
+op_e0e0_0_ff,
+op_e0e8_0_ff,
+op_e0f0_0_ff,
+op_e0f8_0_ff,
+op_e0f9_0_ff,
+op_e100_0_ff,
+op_e108_0_ff,
+op_e110_0_ff,
+op_e118_0_ff,
+op_e120_0_ff,
+op_e128_0_ff,
+op_e130_0_ff,
+op_e138_0_ff,
+op_e140_0_ff,
+op_e148_0_ff,
+op_e150_0_ff,
+op_e158_0_ff,
+op_e160_0_ff,
+op_e168_0_ff,
+op_e170_0_ff,
+op_e178_0_ff,
+op_e180_0_ff,
+op_e188_0_ff,
+op_e190_0_ff,
+op_e198_0_ff,
+op_e1a0_0_ff,
+op_e1a8_0_ff,
+op_e1b0_0_ff,
+op_e1b8_0_ff,
+op_e1d0_0_ff,
+op_e1d8_0_ff,
+op_e1e0_0_ff,
+op_e1e8_0_ff,
+op_e1f0_0_ff,
+op_e1f8_0_ff,
+op_e1f9_0_ff,
+op_e2d0_0_ff,
+op_e2d8_0_ff,
+op_e2e0_0_ff,
+op_e2e8_0_ff,
+op_e2f0_0_ff,
+op_e2f8_0_ff,
+op_e2f9_0_ff,
+op_e3d0_0_ff,
+op_e3d8_0_ff,
+op_e3e0_0_ff,
+op_e3e8_0_ff,
+op_e3f0_0_ff,
+op_e3f8_0_ff,
+op_e3f9_0_ff,
+op_e4d0_0_ff,
+op_e4d8_0_ff,
+op_e4e0_0_ff,
+op_e4e8_0_ff,
+op_e4f0_0_ff,
+op_e4f8_0_ff,
+op_e4f9_0_ff,
+op_e5d0_0_ff,
+op_e5d8_0_ff,
+op_e5e0_0_ff,
+op_e5e8_0_ff,
+op_e5f0_0_ff,
+op_e5f8_0_ff,
+op_e5f9_0_ff,
+op_e6d0_0_ff,
+op_e6d8_0_ff,
+op_e6e0_0_ff,
+op_e6e8_0_ff,
+op_e6f0_0_ff,
+op_e6f8_0_ff,
+op_e6f9_0_ff,
+op_e7d0_0_ff,
+op_e7d8_0_ff,
+op_e7e0_0_ff,
+op_e7e8_0_ff,
+op_e7f0_0_ff,
+op_e7f8_0_ff,
+op_e7f9_0_ff,
+op_e8c0_0_ff,
+op_e8d0_0_ff,
+op_e8e8_0_ff,
+op_e8f0_0_ff,
+op_e8f8_0_ff,
+op_e8f9_0_ff,
+op_e8fa_0_ff,
+op_e8fb_0_ff,
+op_e9c0_0_ff,
+op_e9d0_0_ff,
+op_e9e8_0_ff,
+op_e9f0_0_ff,
+op_e9f8_0_ff,
+op_e9f9_0_ff,
+op_e9fa_0_ff,
+op_e9fb_0_ff,
+op_eac0_0_ff,
+op_ead0_0_ff,
+op_eae8_0_ff,
+op_eaf0_0_ff,
+op_eaf8_0_ff,
+op_eaf9_0_ff,
+op_ebc0_0_ff,
+op_ebd0_0_ff,
+op_ebe8_0_ff,
+op_ebf0_0_ff,
+op_ebf8_0_ff,
+op_ebf9_0_ff,
+op_ebfa_0_ff,
+op_ebfb_0_ff,
+op_ecc0_0_ff,
+op_ecd0_0_ff,
+op_ece8_0_ff,
+op_ecf0_0_ff,
+op_ecf8_0_ff,
+op_ecf9_0_ff,
+op_edc0_0_ff,
+op_edd0_0_ff,
+op_ede8_0_ff,
+op_edf0_0_ff,
+op_edf8_0_ff,
+op_edf9_0_ff,
+op_edfa_0_ff,
+op_edfb_0_ff,
+op_eec0_0_ff,
+op_eed0_0_ff,
+op_eee8_0_ff,
+op_eef0_0_ff,
+op_eef8_0_ff,
+op_eef9_0_ff,
+op_efc0_0_ff,
+op_efd0_0_ff,
+op_efe8_0_ff,
+op_eff0_0_ff,
+op_eff8_0_ff,
+op_eff9_0_ff,
+};
+static const uae_u16 op_dispatch_pages_2[] = {
+1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,6,7,8,0,0,9,0,0,0,
+10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,
+11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,
+13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,
+15,15,15,15,15,15,15,15,16,17,0,0,18,0,0,0,
+19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,
+20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,
+22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,
+24,24,24,24,24,24,24,24,25,26,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+27,27,27,27,27,27,27,27,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,28,28,28,28,28,28,28,28,
+29,29,29,29,29,29,29,29,30,31,32,33,0,0,0,0,
+34,34,34,34,34,34,34,34,35,35,35,35,35,35,35,35,
+36,36,36,36,36,36,36,36,37,37,37,37,37,37,37,37,
+38,38,38,38,38,38,38,38,39,39,39,39,39,39,39,39,
+40,40,40,40,40,40,40,40,41,42,43,44,45,0,0,0,
+46,46,46,46,46,46,46,46,47,47,47,47,47,47,47,47,
+48,48,48,48,48,48,48,48,49,49,49,49,49,49,49,49,
+50,50,50,50,50,50,50,50,51,51,51,51,51,51,51,51,
+52,52,52,52,52,52,52,52,53,54,55,56,0,0,0,0,
+57,57,57,57,57,57,57,57,58,58,58,58,58,58,58,58,
+59,59,59,59,59,59,59,59,60,60,60,60,60,60,60,60,
+61,61,61,61,61,61,61,61,62,62,62,62,62,62,62,62,
+63,63,63,63,63,63,63,63,64,65,66,67,0,0,0,0,
+68,68,68,68,68,68,68,68,69,69,69,69,69,69,69,69,
+70,70,70,70,70,70,70,70,71,71,71,71,71,71,71,71,
+72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,
+74,74,74,74,74,74,74,74,75,76,77,78,0,0,0,0,
+79,79,79,79,79,79,79,79,0,0,0,0,0,0,0,0,
+80,80,80,80,80,80,80,80,81,81,81,81,81,81,81,81,
+82,82,82,82,82,82,82,82,83,83,83,83,83,83,83,83,
+84,84,84,84,84,84,84,84,85,86,0,0,87,0,0,0,
+88,88,88,88,88,88,88,88,0,0,0,0,0,0,0,0,
+89,89,89,89,89,89,89,89,90,90,90,90,90,90,90,90,
+91,91,91,91,91,91,91,91,92,92,92,92,92,92,92,92,
+93,93,93,93,93,93,93,93,94,95,0,0,96,0,0,0,
+97,97,97,97,97,97,97,97,0,0,0,0,0,0,0,0,
+98,98,98,98,98,98,98,98,99,99,99,99,99,99,99,99,
+100,100,100,100,100,100,100,100,101,101,101,101,101,101,101,101,
+102,102,102,102,102,102,102,102,103,104,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+105,105,105,105,105,105,105,105,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,106,106,106,106,106,106,106,106,
+107,107,107,107,107,107,107,107,108,109,110,111,0,0,0,0,
+112,112,112,112,112,112,112,112,0,0,0,0,0,0,0,0,
+113,113,113,113,113,113,113,113,114,114,114,114,114,114,114,114,
+115,115,115,115,115,115,115,115,116,116,116,116,116,116,116,116,
+117,117,117,117,117,117,117,117,118,119,0,0,0,0,0,0,
+120,120,120,120,120,120,120,120,0,0,0,0,0,0,0,0,
+121,121,121,121,121,121,121,121,122,122,122,122,122,122,122,122,
+123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+125,125,125,125,125,125,125,125,126,127,0,0,0,0,0,0,
+128,128,128,128,128,128,128,128,0,0,0,0,0,0,0,0,
+129,129,129,129,129,129,129,129,130,130,130,130,130,130,130,130,
+131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+133,133,133,133,133,133,133,133,134,135,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,136,136,136,136,136,136,136,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,137,137,137,137,137,137,137,137,
+138,138,138,138,138,138,138,138,139,140,141,142,0,0,0,0,
+143,143,143,143,143,143,143,143,0,0,0,0,0,0,0,0,
+144,144,144,144,144,144,144,144,145,145,145,145,145,145,145,145,
+146,146,146,146,146,146,146,146,147,147,147,147,147,147,147,147,
+148,148,148,148,148,148,148,148,149,150,0,0,0,0,0,0,
+151,151,151,151,151,151,151,151,0,0,0,0,0,0,0,0,
+152,152,152,152,152,152,152,152,153,153,153,153,153,153,153,153,
+154,154,154,154,154,154,154,154,155,155,155,155,155,155,155,155,
+156,156,156,156,156,156,156,156,157,158,0,0,0,0,0,0,
+159,159,159,159,159,159,159,159,0,0,0,0,0,0,0,0,
+160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,161,
+162,162,162,162,162,162,162,162,163,163,163,163,163,163,163,163,
+164,164,164,164,164,164,164,164,165,166,0,0,0,0,0,0,
+167,167,167,167,167,167,167,167,168,168,168,168,168,168,168,168,
+169,169,169,169,169,169,169,169,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,170,170,170,170,170,170,170,170,
+171,171,171,171,171,171,171,171,172,173,174,175,0,0,0,0,
+176,176,176,176,176,176,176,176,0,0,0,0,0,0,0,0,
+177,177,177,177,177,177,177,177,178,178,178,178,178,178,178,178,
+179,179,179,179,179,179,179,179,180,180,180,180,180,180,180,180,
+181,181,181,181,181,181,181,181,182,183,184,185,186,0,0,0,
+187,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,
+188,188,188,188,188,188,188,188,189,189,189,189,189,189,189,189,
+190,190,190,190,190,190,190,190,191,191,191,191,191,191,191,191,
+192,192,192,192,192,192,192,192,193,194,195,196,0,0,0,0,
+197,197,197,197,197,197,197,197,0,0,0,0,0,0,0,0,
+198,198,198,198,198,198,198,198,199,199,199,199,199,199,199,199,
+200,200,200,200,200,200,200,200,201,201,201,201,201,201,201,201,
+202,202,202,202,202,202,202,202,203,204,205,206,0,0,0,0,
+207,207,207,207,207,207,207,207,0,0,0,0,0,0,0,0,
+208,208,208,208,208,208,208,208,209,209,209,209,209,209,209,209,
+210,210,210,210,210,210,210,210,211,211,211,211,211,211,211,211,
+212,212,212,212,212,212,212,212,213,214,215,216,0,0,0,0,
+217,217,217,217,217,217,217,217,0,0,0,0,0,0,0,0,
+218,218,218,218,218,218,218,218,219,219,219,219,219,219,219,219,
+220,220,220,220,220,220,220,220,221,221,221,221,221,221,221,221,
+222,222,222,222,222,222,222,222,223,224,0,0,225,0,0,0,
+226,226,226,226,226,226,226,226,0,0,0,0,0,0,0,0,
+227,227,227,227,227,227,227,227,228,228,228,228,228,228,228,228,
+229,229,229,229,229,229,229,229,230,230,230,230,230,230,230,230,
+231,231,231,231,231,231,231,231,232,233,0,0,234,0,0,0,
+235,235,235,235,235,235,235,235,0,0,0,0,0,0,0,0,
+236,236,236,236,236,236,236,236,237,237,237,237,237,237,237,237,
+238,238,238,238,238,238,238,238,239,239,239,239,239,239,239,239,
+240,240,240,240,240,240,240,240,241,242,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+243,243,243,243,243,243,243,243,244,244,244,244,244,244,244,244,
+245,245,245,245,245,245,245,245,246,246,246,246,246,246,246,246,
+247,247,247,247,247,247,247,247,248,249,0,0,0,0,0,0,
+250,250,250,250,250,250,250,250,0,0,0,0,0,0,0,0,
+251,251,251,251,251,251,251,251,252,252,252,252,252,252,252,252,
+253,253,253,253,253,253,253,253,254,254,254,254,254,254,254,254,
+255,255,255,255,255,255,255,255,256,257,258,259,0,0,0,0,
+260,260,260,260,260,260,260,260,0,0,0,0,0,0,0,0,
+261,261,261,261,261,261,261,261,262,262,262,262,262,262,262,262,
+263,263,263,263,263,263,263,263,264,264,264,264,264,264,264,264,
+265,265,265,265,265,265,265,265,266,267,268,269,0,0,0,0,
+270,270,270,270,270,270,270,270,0,0,0,0,0,0,0,0,
+271,271,271,271,271,271,271,271,272,272,272,272,272,272,272,272,
+273,273,273,273,273,273,273,273,274,274,274,274,274,274,274,274,
+275,275,275,275,275,275,275,275,276,277,278,279,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+280,280,280,280,280,280,280,280,281,281,281,281,281,281,281,281,
+282,282,282,282,282,282,282,282,283,283,283,283,283,283,283,283,
+284,284,284,284,284,284,284,284,285,286,0,0,287,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+288,288,288,288,288,288,288,288,289,289,289,289,289,289,289,289,
+290,290,290,290,290,290,290,290,291,291,291,291,291,291,291,291,
+292,292,292,292,292,292,292,292,293,294,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+295,295,295,295,295,295,295,295,296,296,296,296,296,296,296,296,
+297,297,297,297,297,297,297,297,298,298,298,298,298,298,298,298,
+299,299,299,299,299,299,299,299,300,301,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+302,302,302,302,302,302,302,302,303,303,303,303,303,303,303,303,
+304,304,304,304,304,304,304,304,305,305,305,305,305,305,305,305,
+306,306,306,306,306,306,306,306,307,308,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+309,309,309,309,309,309,309,309,310,310,310,310,310,310,310,310,
+311,311,311,311,311,311,311,311,312,312,312,312,312,312,312,312,
+313,313,313,313,313,313,313,313,314,315,0,0,316,0,0,0,
+317,317,317,317,317,317,317,317,0,0,0,0,0,0,0,0,
+318,318,318,318,318,318,318,318,319,319,319,319,319,319,319,319,
+320,320,320,320,320,320,320,320,321,321,321,321,321,321,321,321,
+322,322,322,322,322,322,322,322,323,324,325,326,327,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+328,328,328,328,328,328,328,328,0,0,0,0,0,0,0,0,
+329,329,329,329,329,329,329,329,330,330,330,330,330,330,330,330,
+331,331,331,331,331,331,331,331,332,332,332,332,332,332,332,332,
+333,333,333,333,333,333,333,333,334,335,336,337,338,0,0,0,
+339,339,339,339,339,339,339,339,0,0,0,0,0,0,0,0,
+340,340,340,340,340,340,340,340,341,341,341,341,341,341,341,341,
+342,342,342,342,342,342,342,342,343,343,343,343,343,343,343,343,
+344,344,344,344,344,344,344,344,345,346,347,348,349,0,0,0,
+350,350,350,350,350,350,350,350,0,0,0,0,0,0,0,0,
+351,351,351,351,351,351,351,351,352,352,352,352,352,352,352,352,
+353,353,353,353,353,353,353,353,354,354,354,354,354,354,354,354,
+355,355,355,355,355,355,355,355,356,357,358,359,360,0,0,0,
+361,361,361,361,361,361,361,361,0,0,0,0,0,0,0,0,
+362,362,362,362,362,362,362,362,363,363,363,363,363,363,363,363,
+364,364,364,364,364,364,364,364,365,365,365,365,365,365,365,365,
+366,366,366,366,366,366,366,366,367,368,369,370,371,0,0,0,
+372,372,372,372,372,372,372,372,0,0,0,0,0,0,0,0,
+373,373,373,373,373,373,373,373,374,374,374,374,374,374,374,374,
+375,375,375,375,375,375,375,375,376,376,376,376,376,376,376,376,
+377,377,377,377,377,377,377,377,378,379,380,381,382,0,0,0,
+383,383,383,383,383,383,383,383,0,0,0,0,0,0,0,0,
+384,384,384,384,384,384,384,384,385,385,385,385,385,385,385,385,
+386,386,386,386,386,386,386,386,387,387,387,387,387,387,387,387,
+388,388,388,388,388,388,388,388,389,390,391,392,393,0,0,0,
+394,394,394,394,394,394,394,394,0,0,0,0,0,0,0,0,
+395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,
+397,397,397,397,397,397,397,397,398,398,398,398,398,398,398,398,
+399,399,399,399,399,399,399,399,400,401,402,403,404,0,0,0,
+405,405,405,405,405,405,405,405,406,406,406,406,406,406,406,406,
+407,407,407,407,407,407,407,407,408,408,408,408,408,408,408,408,
+409,409,409,409,409,409,409,409,410,410,410,410,410,410,410,410,
+411,411,411,411,411,411,411,411,412,413,414,415,416,0,0,0,
+417,417,417,417,417,417,417,417,418,418,418,418,418,418,418,418,
+419,419,419,419,419,419,419,419,420,420,420,420,420,420,420,420,
+421,421,421,421,421,421,421,421,422,422,422,422,422,422,422,422,
+423,423,423,423,423,423,423,423,424,425,426,427,428,0,0,0,
+429,429,429,429,429,429,429,429,430,430,430,430,430,430,430,430,
+431,431,431,431,431,431,431,431,432,432,432,432,432,432,432,432,
+433,433,433,433,433,433,433,433,434,434,434,434,434,434,434,434,
+435,435,435,435,435,435,435,435,436,437,438,439,440,0,0,0,
+441,441,441,441,441,441,441,441,442,442,442,442,442,442,442,442,
+443,443,443,443,443,443,443,443,444,444,444,444,444,444,444,444,
+445,445,445,445,445,445,445,445,446,446,446,446,446,446,446,446,
+447,447,447,447,447,447,447,447,448,449,450,451,452,0,0,0,
+453,453,453,453,453,453,453,453,454,454,454,454,454,454,454,454,
+455,455,455,455,455,455,455,455,456,456,456,456,456,456,456,456,
+457,457,457,457,457,457,457,457,458,458,458,458,458,458,458,458,
+459,459,459,459,459,459,459,459,460,461,462,463,464,0,0,0,
+465,465,465,465,465,465,465,465,466,466,466,466,466,466,466,466,
+467,467,467,467,467,467,467,467,468,468,468,468,468,468,468,468,
+469,469,469,469,469,469,469,469,470,470,470,470,470,470,470,470,
+471,471,471,471,471,471,471,471,472,473,474,475,476,0,0,0,
+477,477,477,477,477,477,477,477,478,478,478,478,478,478,478,478,
+479,479,479,479,479,479,479,479,480,480,480,480,480,480,480,480,
+481,481,481,481,481,481,481,481,482,482,482,482,482,482,482,482,
+483,483,483,483,483,483,483,483,484,485,486,487,488,0,0,0,
+489,489,489,489,489,489,489,489,490,490,490,490,490,490,490,490,
+491,491,491,491,491,491,491,491,492,492,492,492,492,492,492,492,
+493,493,493,493,493,493,493,493,494,494,494,494,494,494,494,494,
+495,495,495,495,495,495,495,495,496,497,498,499,500,0,0,0,
+501,501,501,501,501,501,501,501,502,502,502,502,502,502,502,502,
+503,503,503,503,503,503,503,503,504,504,504,504,504,504,504,504,
+505,505,505,505,505,505,505,505,506,506,506,506,506,506,506,506,
+507,507,507,507,507,507,507,507,508,509,510,511,512,0,0,0,
+513,513,513,513,513,513,513,513,514,514,514,514,514,514,514,514,
+515,515,515,515,515,515,515,515,516,516,516,516,516,516,516,516,
+517,517,517,517,517,517,517,517,518,518,518,518,518,518,518,518,
+519,519,519,519,519,519,519,519,520,521,522,523,524,0,0,0,
+525,525,525,525,525,525,525,525,526,526,526,526,526,526,526,526,
+527,527,527,527,527,527,527,527,528,528,528,528,528,528,528,528,
+529,529,529,529,529,529,529,529,530,530,530,530,530,530,530,530,
+531,531,531,531,531,531,531,531,532,533,534,535,536,0,0,0,
+537,537,537,537,537,537,537,537,538,538,538,538,538,538,538,538,
+539,539,539,539,539,539,539,539,540,540,540,540,540,540,540,540,
+541,541,541,541,541,541,541,541,542,542,542,542,542,542,542,542,
+543,543,543,543,543,543,543,543,544,545,546,547,548,0,0,0,
+549,549,549,549,549,549,549,549,550,550,550,550,550,550,550,550,
+551,551,551,551,551,551,551,551,552,552,552,552,552,552,552,552,
+553,553,553,553,553,553,553,553,554,554,554,554,554,554,554,554,
+555,555,555,555,555,555,555,555,556,557,558,559,560,0,0,0,
+561,561,561,561,561,561,561,561,562,562,562,562,562,562,562,562,
+563,563,563,563,563,563,563,563,564,564,564,564,564,564,564,564,
+565,565,565,565,565,565,565,565,566,566,566,566,566,566,566,566,
+567,567,567,567,567,567,567,567,568,569,570,571,572,0,0,0,
+573,573,573,573,573,573,573,573,574,574,574,574,574,574,574,574,
+575,575,575,575,575,575,575,575,576,576,576,576,576,576,576,576,
+577,577,577,577,577,577,577,577,578,578,578,578,578,578,578,578,
+579,579,579,579,579,579,579,579,580,581,582,583,584,0,0,0,
+585,585,585,585,585,585,585,585,586,586,586,586,586,586,586,586,
+587,587,587,587,587,587,587,587,588,588,588,588,588,588,588,588,
+589,589,589,589,589,589,589,589,590,590,590,590,590,590,590,590,
+591,591,591,591,591,591,591,591,592,593,594,595,596,0,0,0,
+597,597,597,597,597,597,597,597,598,598,598,598,598,598,598,598,
+599,599,599,599,599,599,599,599,600,600,600,600,600,600,600,600,
+601,601,601,601,601,601,601,601,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,608,0,0,0,
+609,609,609,609,609,609,609,609,610,610,610,610,610,610,610,610,
+611,611,611,611,611,611,611,611,612,612,612,612,612,612,612,612,
+613,613,613,613,613,613,613,613,614,614,614,614,614,614,614,614,
+615,615,615,615,615,615,615,615,616,617,618,619,620,0,0,0,
+621,621,621,621,621,621,621,621,0,0,0,0,0,0,0,0,
+622,622,622,622,622,622,622,622,623,623,623,623,623,623,623,623,
+624,624,624,624,624,624,624,624,625,625,625,625,625,625,625,625,
+626,626,626,626,626,626,626,626,627,628,0,0,0,0,0,0,
+629,629,629,629,629,629,629,629,0,0,0,0,0,0,0,0,
+630,630,630,630,630,630,630,630,631,631,631,631,631,631,631,631,
+632,632,632,632,632,632,632,632,633,633,633,633,633,633,633,633,
+634,634,634,634,634,634,634,634,635,636,0,0,0,0,0,0,
+637,637,637,637,637,637,637,637,0,0,0,0,0,0,0,0,
+638,638,638,638,638,638,638,638,639,639,639,639,639,639,639,639,
+640,640,640,640,640,640,640,640,641,641,641,641,641,641,641,641,
+642,642,642,642,642,642,642,642,643,644,0,0,0,0,0,0,
+645,645,645,645,645,645,645,645,0,0,0,0,0,0,0,0,
+646,646,646,646,646,646,646,646,647,647,647,647,647,647,647,647,
+648,648,648,648,648,648,648,648,649,649,649,649,649,649,649,649,
+650,650,650,650,650,650,650,650,651,652,0,0,0,0,0,0,
+653,653,653,653,653,653,653,653,0,0,0,0,0,0,0,0,
+654,654,654,654,654,654,654,654,655,655,655,655,655,655,655,655,
+656,656,656,656,656,656,656,656,657,657,657,657,657,657,657,657,
+658,658,658,658,658,658,658,658,659,660,661,662,663,0,0,0,
+664,664,664,664,664,664,664,664,0,0,0,0,0,0,0,0,
+665,665,665,665,665,665,665,665,666,666,666,666,666,666,666,666,
+667,667,667,667,667,667,667,667,668,668,668,668,668,668,668,668,
+669,669,669,669,669,669,669,669,670,671,672,673,674,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,676,676,676,676,676,676,676,676,
+677,677,677,677,677,677,677,677,678,679,680,681,0,0,0,0,
+682,682,682,682,682,682,682,682,0,0,0,0,0,0,0,0,
+683,683,683,683,683,683,683,683,684,684,684,684,684,684,684,684,
+685,685,685,685,685,685,685,685,686,686,686,686,686,686,686,686,
+687,687,687,687,687,687,687,687,688,689,0,0,0,0,0,0,
+690,690,690,690,690,690,690,690,0,0,0,0,0,0,0,0,
+691,691,691,691,691,691,691,691,692,692,692,692,692,692,692,692,
+693,693,693,693,693,693,693,693,694,694,694,694,694,694,694,694,
+695,695,695,695,695,695,695,695,696,697,0,0,0,0,0,0,
+698,698,698,698,698,698,698,698,0,0,0,0,0,0,0,0,
+699,699,699,699,699,699,699,699,700,700,700,700,700,700,700,700,
+701,701,701,701,701,701,701,701,702,702,702,702,702,702,702,702,
+703,703,703,703,703,703,703,703,704,705,0,0,0,0,0,0,
+706,706,706,706,706,706,706,706,0,0,0,0,0,0,0,0,
+707,707,707,707,707,707,707,707,708,708,708,708,708,708,708,708,
+709,709,709,709,709,709,709,709,710,710,710,710,710,710,710,710,
+711,711,711,711,711,711,711,711,712,713,0,0,0,0,0,0,
+714,714,714,714,714,714,714,714,0,0,0,0,0,0,0,0,
+715,715,715,715,715,715,715,715,716,716,716,716,716,716,716,716,
+717,717,717,717,717,717,717,717,718,718,718,718,718,718,718,718,
+719,719,719,719,719,719,719,719,720,721,0,0,0,0,0,0,
+722,722,722,722,722,722,722,722,0,0,0,0,0,0,0,0,
+723,723,723,723,723,723,723,723,724,724,724,724,724,724,724,724,
+725,725,725,725,725,725,725,725,726,726,726,726,726,726,726,726,
+727,727,727,727,727,727,727,727,728,729,0,0,0,0,0,0,
+730,730,730,730,730,730,730,730,0,0,0,0,0,0,0,0,
+731,731,731,731,731,731,731,731,732,732,732,732,732,732,732,732,
+733,733,733,733,733,733,733,733,734,734,734,734,734,734,734,734,
+735,735,735,735,735,735,735,735,736,737,0,0,0,0,0,0,
+738,738,738,738,738,738,738,738,0,0,0,0,0,0,0,0,
+739,739,739,739,739,739,739,739,740,740,740,740,740,740,740,740,
+741,741,741,741,741,741,741,741,742,742,742,742,742,742,742,742,
+743,743,743,743,743,743,743,743,744,745,746,747,748,0,0,0,
+749,749,749,749,749,749,749,749,0,0,0,0,0,0,0,0,
+750,750,750,750,750,750,750,750,751,751,751,751,751,751,751,751,
+752,752,752,752,752,752,752,752,753,753,753,753,753,753,753,753,
+754,754,754,754,754,754,754,754,755,756,0,0,0,0,0,0,
+757,757,757,757,757,757,757,757,0,0,0,0,0,0,0,0,
+758,758,758,758,758,758,758,758,759,759,759,759,759,759,759,759,
+760,760,760,760,760,760,760,760,761,761,761,761,761,761,761,761,
+762,762,762,762,762,762,762,762,763,764,0,0,0,0,0,0,
+765,765,765,765,765,765,765,765,0,0,0,0,0,0,0,0,
+766,766,766,766,766,766,766,766,767,767,767,767,767,767,767,767,
+768,768,768,768,768,768,768,768,769,769,769,769,769,769,769,769,
+770,770,770,770,770,770,770,770,771,772,0,0,0,0,0,0,
+773,773,773,773,773,773,773,773,0,0,0,0,0,0,0,0,
+774,774,774,774,774,774,774,774,775,775,775,775,775,775,775,775,
+776,776,776,776,776,776,776,776,777,777,777,777,777,777,777,777,
+778,778,778,778,778,778,778,778,779,780,781,782,783,0,0,0,
+784,784,784,784,784,784,784,784,785,785,785,785,785,785,785,785,
+786,786,786,786,786,786,786,786,787,787,787,787,787,787,787,787,
+788,788,788,788,788,788,788,788,789,789,789,789,789,789,789,789,
+790,790,790,790,790,790,790,790,791,792,0,0,0,0,0,0,
+793,793,793,793,793,793,793,793,794,794,794,794,794,794,794,794,
+795,795,795,795,795,795,795,795,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,796,796,796,796,796,796,796,796,
+797,797,797,797,797,797,797,797,798,799,800,801,0,0,0,0,
+802,802,802,802,802,802,802,802,0,0,0,0,0,0,0,0,
+803,803,803,803,803,803,803,803,0,0,0,0,0,0,0,0,
+804,804,804,804,804,804,804,804,805,805,805,805,805,805,805,805,
+806,806,806,806,806,806,806,806,807,808,0,0,0,0,0,0,
+809,809,809,809,809,809,809,809,0,0,0,0,0,0,0,0,
+810,810,810,810,810,810,810,810,0,0,0,0,0,0,0,0,
+811,811,811,811,811,811,811,811,812,812,812,812,812,812,812,812,
+813,813,813,813,813,813,813,813,814,815,0,0,0,0,0,0,
+816,816,816,816,816,816,816,816,0,0,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,676,676,676,676,676,676,676,676,
+677,677,677,677,677,677,677,677,678,679,680,681,0,0,0,0,
+817,817,817,817,817,817,817,817,0,0,0,0,0,0,0,0,
+818,818,818,818,818,818,818,818,819,819,819,819,819,819,819,819,
+820,820,820,820,820,820,820,820,821,821,821,821,821,821,821,821,
+822,822,822,822,822,822,822,822,823,824,825,826,827,0,0,0,
+828,828,828,828,828,828,828,828,829,829,829,829,829,829,829,829,
+830,830,830,830,830,830,830,830,831,831,831,831,831,831,831,831,
+832,832,832,832,832,832,832,832,833,833,833,833,833,833,833,833,
+834,834,834,834,834,834,834,834,835,836,837,838,839,0,0,0,
+840,840,840,840,840,840,840,840,841,841,841,841,841,841,841,841,
+842,842,842,842,842,842,842,842,843,843,843,843,843,843,843,843,
+844,844,844,844,844,844,844,844,845,845,845,845,845,845,845,845,
+846,846,846,846,846,846,846,846,847,848,849,850,851,0,0,0,
+852,852,852,852,852,852,852,852,0,0,0,0,0,0,0,0,
+853,853,853,853,853,853,853,853,854,854,854,854,854,854,854,854,
+855,855,855,855,855,855,855,855,856,856,856,856,856,856,856,856,
+857,857,857,857,857,857,857,857,858,859,0,0,0,0,0,0,
+860,860,860,860,860,860,860,860,0,0,0,0,0,0,0,0,
+861,861,861,861,861,861,861,861,862,862,862,862,862,862,862,862,
+863,863,863,863,863,863,863,863,864,864,864,864,864,864,864,864,
+865,865,865,865,865,865,865,865,866,867,868,869,870,0,0,0,
+871,871,871,871,871,871,871,871,0,0,0,0,0,0,0,0,
+872,872,872,872,872,872,872,872,873,873,873,873,873,873,873,873,
+874,874,874,874,874,874,874,874,875,875,875,875,875,875,875,875,
+876,876,876,876,876,876,876,876,877,878,879,880,881,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+882,882,882,882,882,882,882,882,883,883,883,883,883,883,883,883,
+0,0,0,0,0,0,0,0,884,884,884,884,884,884,884,884,
+885,885,885,885,885,885,885,885,886,887,888,889,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+890,890,890,890,890,890,890,890,891,891,891,891,891,891,891,891,
+0,0,0,0,0,0,0,0,892,892,892,892,892,892,892,892,
+893,893,893,893,893,893,893,893,894,895,896,897,0,0,0,0,
+898,898,898,898,898,898,898,898,898,898,898,898,898,898,898,898,
+899,899,899,899,899,899,899,899,900,900,900,900,900,900,900,900,
+901,901,901,901,901,901,901,901,902,902,902,902,902,902,902,902,
+903,904,905,906,907,908,909,910,0,0,911,912,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+913,913,913,913,913,913,913,913,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,914,914,914,914,914,914,914,914,
+915,915,915,915,915,915,915,915,916,917,918,919,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+920,920,920,920,920,920,920,920,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,921,921,921,921,921,921,921,921,
+922,922,922,922,922,922,922,922,923,924,925,926,0,0,0,0,
+927,927,927,927,927,927,927,927,0,0,0,0,0,0,0,0,
+928,928,928,928,928,928,928,928,929,929,929,929,929,929,929,929,
+930,930,930,930,930,930,930,930,931,931,931,931,931,931,931,931,
+932,932,932,932,932,932,932,932,933,934,0,0,0,0,0,0,
+935,935,935,935,935,935,935,935,936,936,936,936,936,936,936,936,
+937,937,937,937,937,937,937,937,938,938,938,938,938,938,938,938,
+939,939,939,939,939,939,939,939,940,940,940,940,940,940,940,940,
+941,941,941,941,941,941,941,941,942,943,0,0,0,0,0,0,
+944,944,944,944,944,944,944,944,945,945,945,945,945,945,945,945,
+946,946,946,946,946,946,946,946,947,947,947,947,947,947,947,947,
+948,948,948,948,948,948,948,948,949,949,949,949,949,949,949,949,
+950,950,950,950,950,950,950,950,951,952,0,0,0,0,0,0,
+953,953,953,953,953,953,953,953,954,954,954,954,954,954,954,954,
+955,955,955,955,955,955,955,955,956,956,956,956,956,956,956,956,
+957,957,957,957,957,957,957,957,958,958,958,958,958,958,958,958,
+959,959,959,959,959,959,959,959,960,961,962,963,964,0,0,0,
+965,965,965,965,965,965,965,965,0,0,0,0,0,0,0,0,
+966,966,966,966,966,966,966,966,967,967,967,967,967,967,967,967,
+968,968,968,968,968,968,968,968,969,969,969,969,969,969,969,969,
+970,970,970,970,970,970,970,970,971,972,0,0,0,0,0,0,
+973,973,973,973,973,973,973,973,974,974,974,974,974,974,974,974,
+975,975,975,975,975,975,975,975,976,976,976,976,976,976,976,976,
+977,977,977,977,977,977,977,977,978,978,978,978,978,978,978,978,
+979,979,979,979,979,979,979,979,980,981,0,0,0,0,0,0,
+982,982,982,982,982,982,982,982,983,983,983,983,983,983,983,983,
+984,984,984,984,984,984,984,984,985,985,985,985,985,985,985,985,
+986,986,986,986,986,986,986,986,987,987,987,987,987,987,987,987,
+988,988,988,988,988,988,988,988,989,990,0,0,0,0,0,0,
+991,991,991,991,991,991,991,991,992,992,992,992,992,992,992,992,
+993,993,993,993,993,993,993,993,994,994,994,994,994,994,994,994,
+995,995,995,995,995,995,995,995,996,996,996,996,996,996,996,996,
+997,997,997,997,997,997,997,997,998,999,1000,1001,1002,0,0,0,
+1003,1003,1003,1003,1003,1003,1003,1003,1004,1004,1004,1004,1004,1004,1004,1004,
+1005,1005,1005,1005,1005,1005,1005,1005,1006,1006,1006,1006,1006,1006,1006,1006,
+1007,1007,1007,1007,1007,1007,1007,1007,1008,1008,1008,1008,1008,1008,1008,1008,
+1009,1009,1009,1009,1009,1009,1009,1009,1010,1011,1012,1013,1014,0,0,0,
+1015,1015,1015,1015,1015,1015,1015,1015,1016,1016,1016,1016,1016,1016,1016,1016,
+1017,1017,1017,1017,1017,1017,1017,1017,1018,1018,1018,1018,1018,1018,1018,1018,
+1019,1019,1019,1019,1019,1019,1019,1019,1020,1020,1020,1020,1020,1020,1020,1020,
+1021,1021,1021,1021,1021,1021,1021,1021,1022,1023,1024,1025,1026,0,0,0,
+1027,1027,1027,1027,1027,1027,1027,1027,1028,1028,1028,1028,1028,1028,1028,1028,
+1029,1029,1029,1029,1029,1029,1029,1029,1030,1030,1030,1030,1030,1030,1030,1030,
+1031,1031,1031,1031,1031,1031,1031,1031,1032,1032,1032,1032,1032,1032,1032,1032,
+1033,1033,1033,1033,1033,1033,1033,1033,1034,1035,1036,1037,1038,0,0,0,
+1039,1039,1039,1039,1039,1039,1039,1039,1040,1040,1040,1040,1040,1040,1040,1040,
+1041,1041,1041,1041,1041,1041,1041,1041,1042,1042,1042,1042,1042,1042,1042,1042,
+1043,1043,1043,1043,1043,1043,1043,1043,1044,1044,1044,1044,1044,1044,1044,1044,
+1045,1045,1045,1045,1045,1045,1045,1045,1046,1047,1048,1049,1050,0,0,0,
+1051,1051,1051,1051,1051,1051,1051,1051,1052,1052,1052,1052,1052,1052,1052,1052,
+1053,1053,1053,1053,1053,1053,1053,1053,1054,1054,1054,1054,1054,1054,1054,1054,
+1055,1055,1055,1055,1055,1055,1055,1055,1056,1056,1056,1056,1056,1056,1056,1056,
+1057,1057,1057,1057,1057,1057,1057,1057,1058,1059,1060,1061,1062,0,0,0,
+1063,1063,1063,1063,1063,1063,1063,1063,1064,1064,1064,1064,1064,1064,1064,1064,
+1065,1065,1065,1065,1065,1065,1065,1065,1066,1066,1066,1066,1066,1066,1066,1066,
+1067,1067,1067,1067,1067,1067,1067,1067,1068,1068,1068,1068,1068,1068,1068,1068,
+1069,1069,1069,1069,1069,1069,1069,1069,1070,1071,1072,1073,1074,0,0,0,
+1075,1075,1075,1075,1075,1075,1075,1075,1076,1076,1076,1076,1076,1076,1076,1076,
+1077,1077,1077,1077,1077,1077,1077,1077,1078,1078,1078,1078,1078,1078,1078,1078,
+1079,1079,1079,1079,1079,1079,1079,1079,1080,1080,1080,1080,1080,1080,1080,1080,
+1081,1081,1081,1081,1081,1081,1081,1081,1082,1083,1084,1085,1086,0,0,0,
+1087,1087,1087,1087,1087,1087,1087,1087,1088,1088,1088,1088,1088,1088,1088,1088,
+1089,1089,1089,1089,1089,1089,1089,1089,1090,1090,1090,1090,1090,1090,1090,1090,
+1091,1091,1091,1091,1091,1091,1091,1091,1092,1092,1092,1092,1092,1092,1092,1092,
+1093,1093,1093,1093,1093,1093,1093,1093,1094,1095,1096,1097,1098,0,0,0,
+1099,1099,1099,1099,1099,1099,1099,1099,1100,1100,1100,1100,1100,1100,1100,1100,
+1101,1101,1101,1101,1101,1101,1101,1101,1102,1102,1102,1102,1102,1102,1102,1102,
+1103,1103,1103,1103,1103,1103,1103,1103,1104,1104,1104,1104,1104,1104,1104,1104,
+1105,1105,1105,1105,1105,1105,1105,1105,1106,1107,1108,1109,1110,0,0,0,
+1111,1111,1111,1111,1111,1111,1111,1111,1112,1112,1112,1112,1112,1112,1112,1112,
+1113,1113,1113,1113,1113,1113,1113,1113,1114,1114,1114,1114,1114,1114,1114,1114,
+1115,1115,1115,1115,1115,1115,1115,1115,1116,1116,1116,1116,1116,1116,1116,1116,
+1117,1117,1117,1117,1117,1117,1117,1117,1118,1119,1120,1121,1122,0,0,0,
+1123,1123,1123,1123,1123,1123,1123,1123,1124,1124,1124,1124,1124,1124,1124,1124,
+1125,1125,1125,1125,1125,1125,1125,1125,1126,1126,1126,1126,1126,1126,1126,1126,
+1127,1127,1127,1127,1127,1127,1127,1127,1128,1128,1128,1128,1128,1128,1128,1128,
+1129,1129,1129,1129,1129,1129,1129,1129,1130,1131,1132,1133,1134,0,0,0,
+1135,1135,1135,1135,1135,1135,1135,1135,1136,1136,1136,1136,1136,1136,1136,1136,
+1137,1137,1137,1137,1137,1137,1137,1137,1138,1138,1138,1138,1138,1138,1138,1138,
+1139,1139,1139,1139,1139,1139,1139,1139,1140,1140,1140,1140,1140,1140,1140,1140,
+1141,1141,1141,1141,1141,1141,1141,1141,1142,1143,1144,1145,1146,0,0,0,
+1147,1147,1147,1147,1147,1147,1147,1147,1148,1148,1148,1148,1148,1148,1148,1148,
+1149,1149,1149,1149,1149,1149,1149,1149,1150,1150,1150,1150,1150,1150,1150,1150,
+1151,1151,1151,1151,1151,1151,1151,1151,1152,1152,1152,1152,1152,1152,1152,1152,
+1153,1153,1153,1153,1153,1153,1153,1153,1154,1155,1156,1157,1158,0,0,0,
+1159,1159,1159,1159,1159,1159,1159,1159,1160,1160,1160,1160,1160,1160,1160,1160,
+1161,1161,1161,1161,1161,1161,1161,1161,1162,1162,1162,1162,1162,1162,1162,1162,
+1163,1163,1163,1163,1163,1163,1163,1163,1164,1164,1164,1164,1164,1164,1164,1164,
+1165,1165,1165,1165,1165,1165,1165,1165,1166,1167,1168,1169,1170,0,0,0,
+1171,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1173,
+1174,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,
+1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1175,1176,
+1177,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,
+1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1179,
+1180,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,
+1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1181,1182,
+1183,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,
+1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1184,1185,
+1186,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,
+1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,1188,
+1189,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,
+1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1190,1191,
+1192,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,
+1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1194,
+1195,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,
+1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1196,1197,
+1198,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,
+1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1200,
+1201,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,
+1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1203,
+1204,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,
+1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1206,
+1207,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,
+1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1209,
+1210,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,
+1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1211,1212,
+1213,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,
+1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1214,1215,
+1216,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1218,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,1219,
+1220,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,1221,
+1222,1222,1222,1222,1222,1222,1222,1222,0,0,0,0,0,0,0,0,
+1223,1223,1223,1223,1223,1223,1223,1223,1224,1224,1224,1224,1224,1224,1224,1224,
+1225,1225,1225,1225,1225,1225,1225,1225,1226,1226,1226,1226,1226,1226,1226,1226,
+1227,1227,1227,1227,1227,1227,1227,1227,1228,1229,1230,1231,1232,0,0,0,
+1233,1233,1233,1233,1233,1233,1233,1233,0,0,0,0,0,0,0,0,
+1234,1234,1234,1234,1234,1234,1234,1234,1235,1235,1235,1235,1235,1235,1235,1235,
+1236,1236,1236,1236,1236,1236,1236,1236,1237,1237,1237,1237,1237,1237,1237,1237,
+1238,1238,1238,1238,1238,1238,1238,1238,1239,1240,1241,1242,1243,0,0,0,
+1244,1244,1244,1244,1244,1244,1244,1244,0,0,0,0,0,0,0,0,
+1245,1245,1245,1245,1245,1245,1245,1245,1246,1246,1246,1246,1246,1246,1246,1246,
+1247,1247,1247,1247,1247,1247,1247,1247,1248,1248,1248,1248,1248,1248,1248,1248,
+1249,1249,1249,1249,1249,1249,1249,1249,1250,1251,1252,1253,1254,0,0,0,
+1255,1255,1255,1255,1255,1255,1255,1255,0,0,0,0,0,0,0,0,
+1256,1256,1256,1256,1256,1256,1256,1256,1257,1257,1257,1257,1257,1257,1257,1257,
+1258,1258,1258,1258,1258,1258,1258,1258,1259,1259,1259,1259,1259,1259,1259,1259,
+1260,1260,1260,1260,1260,1260,1260,1260,1261,1262,1263,1264,1265,0,0,0,
+1266,1266,1266,1266,1266,1266,1266,1266,1267,1267,1267,1267,1267,1267,1267,1267,
+1268,1268,1268,1268,1268,1268,1268,1268,1269,1269,1269,1269,1269,1269,1269,1269,
+1270,1270,1270,1270,1270,1270,1270,1270,1271,1271,1271,1271,1271,1271,1271,1271,
+1272,1272,1272,1272,1272,1272,1272,1272,1273,1274,0,0,0,0,0,0,
+1275,1275,1275,1275,1275,1275,1275,1275,1276,1276,1276,1276,1276,1276,1276,1276,
+1277,1277,1277,1277,1277,1277,1277,1277,1278,1278,1278,1278,1278,1278,1278,1278,
+1279,1279,1279,1279,1279,1279,1279,1279,1280,1280,1280,1280,1280,1280,1280,1280,
+1281,1281,1281,1281,1281,1281,1281,1281,1282,1283,0,0,0,0,0,0,
+1284,1284,1284,1284,1284,1284,1284,1284,1285,1285,1285,1285,1285,1285,1285,1285,
+1286,1286,1286,1286,1286,1286,1286,1286,1287,1287,1287,1287,1287,1287,1287,1287,
+1288,1288,1288,1288,1288,1288,1288,1288,1289,1289,1289,1289,1289,1289,1289,1289,
+1290,1290,1290,1290,1290,1290,1290,1290,1291,1292,0,0,0,0,0,0,
+1293,1293,1293,1293,1293,1293,1293,1293,0,0,0,0,0,0,0,0,
+1294,1294,1294,1294,1294,1294,1294,1294,1295,1295,1295,1295,1295,1295,1295,1295,
+1296,1296,1296,1296,1296,1296,1296,1296,1297,1297,1297,1297,1297,1297,1297,1297,
+1298,1298,1298,1298,1298,1298,1298,1298,1299,1300,1301,1302,1303,0,0,0,
+1304,1304,1304,1304,1304,1304,1304,1304,0,0,0,0,0,0,0,0,
+1305,1305,1305,1305,1305,1305,1305,1305,1306,1306,1306,1306,1306,1306,1306,1306,
+1307,1307,1307,1307,1307,1307,1307,1307,1308,1308,1308,1308,1308,1308,1308,1308,
+1309,1309,1309,1309,1309,1309,1309,1309,1310,1311,1312,1313,1314,0,0,0,
+1315,1315,1315,1315,1315,1315,1315,1315,1316,1316,1316,1316,1316,1316,1316,1316,
+1317,1317,1317,1317,1317,1317,1317,1317,1318,1318,1318,1318,1318,1318,1318,1318,
+1319,1319,1319,1319,1319,1319,1319,1319,1320,1320,1320,1320,1320,1320,1320,1320,
+1321,1321,1321,1321,1321,1321,1321,1321,1322,1323,1324,1325,1326,0,0,0,
+1327,1327,1327,1327,1327,1327,1327,1327,1328,1328,1328,1328,1328,1328,1328,1328,
+1329,1329,1329,1329,1329,1329,1329,1329,1330,1330,1330,1330,1330,1330,1330,1330,
+1331,1331,1331,1331,1331,1331,1331,1331,1332,1332,1332,1332,1332,1332,1332,1332,
+1333,1333,1333,1333,1333,1333,1333,1333,1334,1335,1336,1337,1338,0,0,0,
+1339,1339,1339,1339,1339,1339,1339,1339,1340,1340,1340,1340,1340,1340,1340,1340,
+1341,1341,1341,1341,1341,1341,1341,1341,1342,1342,1342,1342,1342,1342,1342,1342,
+1343,1343,1343,1343,1343,1343,1343,1343,1344,1344,1344,1344,1344,1344,1344,1344,
+1345,1345,1345,1345,1345,1345,1345,1345,1346,1347,1348,1349,1350,0,0,0,
+1351,1351,1351,1351,1351,1351,1351,1351,1352,1352,1352,1352,1352,1352,1352,1352,
+1353,1353,1353,1353,1353,1353,1353,1353,1354,1354,1354,1354,1354,1354,1354,1354,
+1355,1355,1355,1355,1355,1355,1355,1355,1356,1356,1356,1356,1356,1356,1356,1356,
+1357,1357,1357,1357,1357,1357,1357,1357,1358,1359,0,0,0,0,0,0,
+1360,1360,1360,1360,1360,1360,1360,1360,1361,1361,1361,1361,1361,1361,1361,1361,
+1362,1362,1362,1362,1362,1362,1362,1362,1363,1363,1363,1363,1363,1363,1363,1363,
+1364,1364,1364,1364,1364,1364,1364,1364,1365,1365,1365,1365,1365,1365,1365,1365,
+1366,1366,1366,1366,1366,1366,1366,1366,1367,1368,0,0,0,0,0,0,
+1369,1369,1369,1369,1369,1369,1369,1369,1370,1370,1370,1370,1370,1370,1370,1370,
+1371,1371,1371,1371,1371,1371,1371,1371,1372,1372,1372,1372,1372,1372,1372,1372,
+1373,1373,1373,1373,1373,1373,1373,1373,1374,1374,1374,1374,1374,1374,1374,1374,
+1375,1375,1375,1375,1375,1375,1375,1375,1376,1377,0,0,0,0,0,0,
+1378,1378,1378,1378,1378,1378,1378,1378,1379,1379,1379,1379,1379,1379,1379,1379,
+1380,1380,1380,1380,1380,1380,1380,1380,1381,1381,1381,1381,1381,1381,1381,1381,
+1382,1382,1382,1382,1382,1382,1382,1382,1383,1383,1383,1383,1383,1383,1383,1383,
+1384,1384,1384,1384,1384,1384,1384,1384,1385,1386,1387,1388,1389,0,0,0,
+1390,1390,1390,1390,1390,1390,1390,1390,0,0,0,0,0,0,0,0,
+1391,1391,1391,1391,1391,1391,1391,1391,1392,1392,1392,1392,1392,1392,1392,1392,
+1393,1393,1393,1393,1393,1393,1393,1393,1394,1394,1394,1394,1394,1394,1394,1394,
+1395,1395,1395,1395,1395,1395,1395,1395,1396,1397,1398,1399,1400,0,0,0,
+1401,1401,1401,1401,1401,1401,1401,1401,1402,1402,1402,1402,1402,1402,1402,1402,
+1403,1403,1403,1403,1403,1403,1403,1403,1404,1404,1404,1404,1404,1404,1404,1404,
+1405,1405,1405,1405,1405,1405,1405,1405,1406,1406,1406,1406,1406,1406,1406,1406,
+1407,1407,1407,1407,1407,1407,1407,1407,1408,1409,1410,1411,1412,0,0,0,
+1413,1413,1413,1413,1413,1413,1413,1413,1414,1414,1414,1414,1414,1414,1414,1414,
+1415,1415,1415,1415,1415,1415,1415,1415,1416,1416,1416,1416,1416,1416,1416,1416,
+1417,1417,1417,1417,1417,1417,1417,1417,1418,1418,1418,1418,1418,1418,1418,1418,
+1419,1419,1419,1419,1419,1419,1419,1419,1420,1421,1422,1423,1424,0,0,0,
+1425,1425,1425,1425,1425,1425,1425,1425,1426,1426,1426,1426,1426,1426,1426,1426,
+1427,1427,1427,1427,1427,1427,1427,1427,1428,1428,1428,1428,1428,1428,1428,1428,
+1429,1429,1429,1429,1429,1429,1429,1429,1430,1430,1430,1430,1430,1430,1430,1430,
+1431,1431,1431,1431,1431,1431,1431,1431,1432,1433,1434,1435,1436,0,0,0,
+1437,1437,1437,1437,1437,1437,1437,1437,1438,1438,1438,1438,1438,1438,1438,1438,
+1439,1439,1439,1439,1439,1439,1439,1439,1440,1440,1440,1440,1440,1440,1440,1440,
+1441,1441,1441,1441,1441,1441,1441,1441,1442,1442,1442,1442,1442,1442,1442,1442,
+1443,1443,1443,1443,1443,1443,1443,1443,1444,1445,0,0,0,0,0,0,
+1446,1446,1446,1446,1446,1446,1446,1446,1447,1447,1447,1447,1447,1447,1447,1447,
+1448,1448,1448,1448,1448,1448,1448,1448,1449,1449,1449,1449,1449,1449,1449,1449,
+1450,1450,1450,1450,1450,1450,1450,1450,1451,1451,1451,1451,1451,1451,1451,1451,
+1452,1452,1452,1452,1452,1452,1452,1452,1453,1454,0,0,0,0,0,0,
+1455,1455,1455,1455,1455,1455,1455,1455,1456,1456,1456,1456,1456,1456,1456,1456,
+1457,1457,1457,1457,1457,1457,1457,1457,1458,1458,1458,1458,1458,1458,1458,1458,
+1459,1459,1459,1459,1459,1459,1459,1459,1460,1460,1460,1460,1460,1460,1460,1460,
+1461,1461,1461,1461,1461,1461,1461,1461,1462,1463,0,0,0,0,0,0,
+1464,1464,1464,1464,1464,1464,1464,1464,1465,1465,1465,1465,1465,1465,1465,1465,
+1466,1466,1466,1466,1466,1466,1466,1466,1467,1467,1467,1467,1467,1467,1467,1467,
+1468,1468,1468,1468,1468,1468,1468,1468,1469,1469,1469,1469,1469,1469,1469,1469,
+1470,1470,1470,1470,1470,1470,1470,1470,1471,1472,1473,1474,1475,0,0,0,
+1476,1476,1476,1476,1476,1476,1476,1476,0,0,0,0,0,0,0,0,
+1477,1477,1477,1477,1477,1477,1477,1477,1478,1478,1478,1478,1478,1478,1478,1478,
+1479,1479,1479,1479,1479,1479,1479,1479,1480,1480,1480,1480,1480,1480,1480,1480,
+1481,1481,1481,1481,1481,1481,1481,1481,1482,1483,1484,1485,1486,0,0,0,
+1487,1487,1487,1487,1487,1487,1487,1487,0,0,0,0,0,0,0,0,
+1488,1488,1488,1488,1488,1488,1488,1488,1489,1489,1489,1489,1489,1489,1489,1489,
+1490,1490,1490,1490,1490,1490,1490,1490,1491,1491,1491,1491,1491,1491,1491,1491,
+1492,1492,1492,1492,1492,1492,1492,1492,1493,1494,1495,1496,1497,0,0,0,
+1498,1498,1498,1498,1498,1498,1498,1498,0,0,0,0,0,0,0,0,
+1499,1499,1499,1499,1499,1499,1499,1499,1500,1500,1500,1500,1500,1500,1500,1500,
+1501,1501,1501,1501,1501,1501,1501,1501,1502,1502,1502,1502,1502,1502,1502,1502,
+1503,1503,1503,1503,1503,1503,1503,1503,1504,1505,1506,1507,1508,0,0,0,
+1509,1509,1509,1509,1509,1509,1509,1509,0,0,0,0,0,0,0,0,
+1510,1510,1510,1510,1510,1510,1510,1510,1511,1511,1511,1511,1511,1511,1511,1511,
+1512,1512,1512,1512,1512,1512,1512,1512,1513,1513,1513,1513,1513,1513,1513,1513,
+1514,1514,1514,1514,1514,1514,1514,1514,1515,1516,1517,1518,1519,0,0,0,
+1520,1520,1520,1520,1520,1520,1520,1520,1521,1521,1521,1521,1521,1521,1521,1521,
+1522,1522,1522,1522,1522,1522,1522,1522,1523,1523,1523,1523,1523,1523,1523,1523,
+1524,1524,1524,1524,1524,1524,1524,1524,1525,1525,1525,1525,1525,1525,1525,1525,
+1526,1526,1526,1526,1526,1526,1526,1526,1527,1528,0,0,0,0,0,0,
+1529,1529,1529,1529,1529,1529,1529,1529,1530,1530,1530,1530,1530,1530,1530,1530,
+1531,1531,1531,1531,1531,1531,1531,1531,1532,1532,1532,1532,1532,1532,1532,1532,
+1533,1533,1533,1533,1533,1533,1533,1533,1534,1534,1534,1534,1534,1534,1534,1534,
+1535,1535,1535,1535,1535,1535,1535,1535,1536,1537,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1538,1538,1538,1538,1538,1538,1538,1538,
+1539,1539,1539,1539,1539,1539,1539,1539,1540,1540,1540,1540,1540,1540,1540,1540,
+1541,1541,1541,1541,1541,1541,1541,1541,1542,1542,1542,1542,1542,1542,1542,1542,
+1543,1543,1543,1543,1543,1543,1543,1543,1544,1545,0,0,0,0,0,0,
+1546,1546,1546,1546,1546,1546,1546,1546,0,0,0,0,0,0,0,0,
+1547,1547,1547,1547,1547,1547,1547,1547,1548,1548,1548,1548,1548,1548,1548,1548,
+1549,1549,1549,1549,1549,1549,1549,1549,1550,1550,1550,1550,1550,1550,1550,1550,
+1551,1551,1551,1551,1551,1551,1551,1551,1552,1553,1554,1555,1556,0,0,0,
+1557,1557,1557,1557,1557,1557,1557,1557,0,0,0,0,0,0,0,0,
+1558,1558,1558,1558,1558,1558,1558,1558,1559,1559,1559,1559,1559,1559,1559,1559,
+1560,1560,1560,1560,1560,1560,1560,1560,1561,1561,1561,1561,1561,1561,1561,1561,
+1562,1562,1562,1562,1562,1562,1562,1562,1563,1564,1565,1566,1567,0,0,0,
+1568,1568,1568,1568,1568,1568,1568,1568,1569,1569,1569,1569,1569,1569,1569,1569,
+1570,1570,1570,1570,1570,1570,1570,1570,1571,1571,1571,1571,1571,1571,1571,1571,
+1572,1572,1572,1572,1572,1572,1572,1572,1573,1573,1573,1573,1573,1573,1573,1573,
+1574,1574,1574,1574,1574,1574,1574,1574,1575,1576,1577,1578,1579,0,0,0,
+1580,1580,1580,1580,1580,1580,1580,1580,1581,1581,1581,1581,1581,1581,1581,1581,
+1582,1582,1582,1582,1582,1582,1582,1582,1583,1583,1583,1583,1583,1583,1583,1583,
+1584,1584,1584,1584,1584,1584,1584,1584,1585,1585,1585,1585,1585,1585,1585,1585,
+1586,1586,1586,1586,1586,1586,1586,1586,1587,1588,1589,1590,1591,0,0,0,
+1592,1592,1592,1592,1592,1592,1592,1592,1593,1593,1593,1593,1593,1593,1593,1593,
+1594,1594,1594,1594,1594,1594,1594,1594,1595,1595,1595,1595,1595,1595,1595,1595,
+1596,1596,1596,1596,1596,1596,1596,1596,1597,1597,1597,1597,1597,1597,1597,1597,
+1598,1598,1598,1598,1598,1598,1598,1598,1599,1600,1601,1602,1603,0,0,0,
+1604,1604,1604,1604,1604,1604,1604,1604,1605,1605,1605,1605,1605,1605,1605,1605,
+1606,1606,1606,1606,1606,1606,1606,1606,1607,1607,1607,1607,1607,1607,1607,1607,
+1608,1608,1608,1608,1608,1608,1608,1608,1609,1609,1609,1609,1609,1609,1609,1609,
+1610,1610,1610,1610,1610,1610,1610,1610,1611,1612,0,0,0,0,0,0,
+1613,1613,1613,1613,1613,1613,1613,1613,1614,1614,1614,1614,1614,1614,1614,1614,
+1615,1615,1615,1615,1615,1615,1615,1615,1616,1616,1616,1616,1616,1616,1616,1616,
+1617,1617,1617,1617,1617,1617,1617,1617,1618,1618,1618,1618,1618,1618,1618,1618,
+1619,1619,1619,1619,1619,1619,1619,1619,1620,1621,0,0,0,0,0,0,
+1622,1622,1622,1622,1622,1622,1622,1622,1623,1623,1623,1623,1623,1623,1623,1623,
+1624,1624,1624,1624,1624,1624,1624,1624,1625,1625,1625,1625,1625,1625,1625,1625,
+1626,1626,1626,1626,1626,1626,1626,1626,1627,1627,1627,1627,1627,1627,1627,1627,
+1628,1628,1628,1628,1628,1628,1628,1628,1629,1630,0,0,0,0,0,0,
+1631,1631,1631,1631,1631,1631,1631,1631,1632,1632,1632,1632,1632,1632,1632,1632,
+1633,1633,1633,1633,1633,1633,1633,1633,1634,1634,1634,1634,1634,1634,1634,1634,
+1635,1635,1635,1635,1635,1635,1635,1635,1636,1636,1636,1636,1636,1636,1636,1636,
+1637,1637,1637,1637,1637,1637,1637,1637,1638,1639,1640,1641,1642,0,0,0,
+1643,1643,1643,1643,1643,1643,1643,1643,1644,1644,1644,1644,1644,1644,1644,1644,
+1645,1645,1645,1645,1645,1645,1645,1645,1646,1646,1646,1646,1646,1646,1646,1646,
+1647,1647,1647,1647,1647,1647,1647,1647,1648,1648,1648,1648,1648,1648,1648,1648,
+1649,1649,1649,1649,1649,1649,1649,1649,1650,1650,1650,1650,1650,1650,1650,1650,
+1651,1651,1651,1651,1651,1651,1651,1651,1652,1652,1652,1652,1652,1652,1652,1652,
+1653,1653,1653,1653,1653,1653,1653,1653,1654,1654,1654,1654,1654,1654,1654,1654,
+1655,1655,1655,1655,1655,1655,1655,1655,1656,1656,1656,1656,1656,1656,1656,1656,
+1657,1657,1657,1657,1657,1657,1657,1657,1658,1658,1658,1658,1658,1658,1658,1658,
+1659,1659,1659,1659,1659,1659,1659,1659,1660,1660,1660,1660,1660,1660,1660,1660,
+1661,1661,1661,1661,1661,1661,1661,1661,1662,1662,1662,1662,1662,1662,1662,1662,
+1663,1663,1663,1663,1663,1663,1663,1663,1664,1664,1664,1664,1664,1664,1664,1664,
+1665,1665,1665,1665,1665,1665,1665,1665,1666,1666,1666,1666,1666,1666,1666,1666,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1667,1667,1667,1667,1667,1667,1667,1667,1668,1668,1668,1668,1668,1668,1668,1668,
+1669,1669,1669,1669,1669,1669,1669,1669,1670,1670,1670,1670,1670,1670,1670,1670,
+1671,1671,1671,1671,1671,1671,1671,1671,1672,1673,0,0,0,0,0,0,
+1674,1674,1674,1674,1674,1674,1674,1674,1675,1675,1675,1675,1675,1675,1675,1675,
+1676,1676,1676,1676,1676,1676,1676,1676,1677,1677,1677,1677,1677,1677,1677,1677,
+1678,1678,1678,1678,1678,1678,1678,1678,1679,1679,1679,1679,1679,1679,1679,1679,
+1680,1680,1680,1680,1680,1680,1680,1680,1681,1681,1681,1681,1681,1681,1681,1681,
+1682,1682,1682,1682,1682,1682,1682,1682,1683,1683,1683,1683,1683,1683,1683,1683,
+1684,1684,1684,1684,1684,1684,1684,1684,1685,1685,1685,1685,1685,1685,1685,1685,
+1686,1686,1686,1686,1686,1686,1686,1686,1687,1687,1687,1687,1687,1687,1687,1687,
+1688,1688,1688,1688,1688,1688,1688,1688,1689,1689,1689,1689,1689,1689,1689,1689,
+1690,1690,1690,1690,1690,1690,1690,1690,1691,1691,1691,1691,1691,1691,1691,1691,
+1692,1692,1692,1692,1692,1692,1692,1692,1693,1693,1693,1693,1693,1693,1693,1693,
+1694,1694,1694,1694,1694,1694,1694,1694,1695,1695,1695,1695,1695,1695,1695,1695,
+1696,1696,1696,1696,1696,1696,1696,1696,1697,1697,1697,1697,1697,1697,1697,1697,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1698,1698,1698,1698,1698,1698,1698,1698,1699,1699,1699,1699,1699,1699,1699,1699,
+1700,1700,1700,1700,1700,1700,1700,1700,1701,1701,1701,1701,1701,1701,1701,1701,
+1702,1702,1702,1702,1702,1702,1702,1702,1703,1704,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1705,1705,1705,1705,1705,1705,1705,1705,1706,1706,1706,1706,1706,1706,1706,1706,
+1707,1707,1707,1707,1707,1707,1707,1707,1708,1708,1708,1708,1708,1708,1708,1708,
+1709,1709,1709,1709,1709,1709,1709,1709,1710,1711,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1712,1712,1712,1712,1712,1712,1712,1712,1713,1713,1713,1713,1713,1713,1713,1713,
+1714,1714,1714,1714,1714,1714,1714,1714,1715,1715,1715,1715,1715,1715,1715,1715,
+1716,1716,1716,1716,1716,1716,1716,1716,1717,1718,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1719,1719,1719,1719,1719,1719,1719,1719,1720,1720,1720,1720,1720,1720,1720,1720,
+1721,1721,1721,1721,1721,1721,1721,1721,1722,1722,1722,1722,1722,1722,1722,1722,
+1723,1723,1723,1723,1723,1723,1723,1723,1724,1725,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1726,1726,1726,1726,1726,1726,1726,1726,1727,1727,1727,1727,1727,1727,1727,1727,
+1728,1728,1728,1728,1728,1728,1728,1728,1729,1729,1729,1729,1729,1729,1729,1729,
+1730,1730,1730,1730,1730,1730,1730,1730,1731,1732,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1733,1733,1733,1733,1733,1733,1733,1733,1734,1734,1734,1734,1734,1734,1734,1734,
+1735,1735,1735,1735,1735,1735,1735,1735,1736,1736,1736,1736,1736,1736,1736,1736,
+1737,1737,1737,1737,1737,1737,1737,1737,1738,1739,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1740,1740,1740,1740,1740,1740,1740,1740,1741,1741,1741,1741,1741,1741,1741,1741,
+1742,1742,1742,1742,1742,1742,1742,1742,1743,1743,1743,1743,1743,1743,1743,1743,
+1744,1744,1744,1744,1744,1744,1744,1744,1745,1746,0,0,0,0,0,0,
+1747,1747,1747,1747,1747,1747,1747,1747,0,0,0,0,0,0,0,0,
+1748,1748,1748,1748,1748,1748,1748,1748,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1749,1749,1749,1749,1749,1749,1749,1749,
+1750,1750,1750,1750,1750,1750,1750,1750,1751,1752,1753,1754,0,0,0,0,
+1755,1755,1755,1755,1755,1755,1755,1755,0,0,0,0,0,0,0,0,
+1756,1756,1756,1756,1756,1756,1756,1756,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1757,1757,1757,1757,1757,1757,1757,1757,
+1758,1758,1758,1758,1758,1758,1758,1758,1759,1760,1761,1762,0,0,0,0,
+1763,1763,1763,1763,1763,1763,1763,1763,0,0,0,0,0,0,0,0,
+1764,1764,1764,1764,1764,1764,1764,1764,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1765,1765,1765,1765,1765,1765,1765,1765,
+1766,1766,1766,1766,1766,1766,1766,1766,1767,1768,0,0,0,0,0,0,
+1769,1769,1769,1769,1769,1769,1769,1769,0,0,0,0,0,0,0,0,
+1770,1770,1770,1770,1770,1770,1770,1770,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1771,1771,1771,1771,1771,1771,1771,1771,
+1772,1772,1772,1772,1772,1772,1772,1772,1773,1774,1775,1776,0,0,0,0,
+1777,1777,1777,1777,1777,1777,1777,1777,0,0,0,0,0,0,0,0,
+1778,1778,1778,1778,1778,1778,1778,1778,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1779,1779,1779,1779,1779,1779,1779,1779,
+1780,1780,1780,1780,1780,1780,1780,1780,1781,1782,0,0,0,0,0,0,
+1783,1783,1783,1783,1783,1783,1783,1783,0,0,0,0,0,0,0,0,
+1784,1784,1784,1784,1784,1784,1784,1784,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1785,1785,1785,1785,1785,1785,1785,1785,
+1786,1786,1786,1786,1786,1786,1786,1786,1787,1788,1789,1790,0,0,0,0,
+1791,1791,1791,1791,1791,1791,1791,1791,0,0,0,0,0,0,0,0,
+1792,1792,1792,1792,1792,1792,1792,1792,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1793,1793,1793,1793,1793,1793,1793,1793,
+1794,1794,1794,1794,1794,1794,1794,1794,1795,1796,0,0,0,0,0,0,
+1797,1797,1797,1797,1797,1797,1797,1797,0,0,0,0,0,0,0,0,
+1798,1798,1798,1798,1798,1798,1798,1798,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1799,1799,1799,1799,1799,1799,1799,1799,
+1800,1800,1800,1800,1800,1800,1800,1800,1801,1802,0,0,0,0,0,0,
+};
+static const uae_u16 op_dispatch_index_2[] = {
+0,1,2,3,4,5,6,7,8,9,10,11,4,5,6,7,
+12,13,14,15,4,5,6,7,16,17,18,19,4,5,6,7,
+20,21,22,23,4,5,6,7,24,25,26,27,4,5,6,7,
+28,29,30,31,4,5,6,7,32,33,34,35,4,5,6,7,
+36,37,38,39,40,41,42,43,36,37,38,39,40,41,42,44,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+36,37,38,39,40,41,42,37,36,37,38,39,40,41,42,37,
+45,46,47,48,49,50,51,52,45,46,47,48,49,50,51,53,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+45,46,47,48,49,50,51,37,45,46,47,48,49,50,51,37,
+54,55,56,57,58,59,60,61,54,55,56,57,58,59,60,62,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+54,55,56,57,58,59,60,37,54,55,56,57,58,59,60,37,
+63,64,65,66,67,37,68,69,70,71,72,73,67,37,68,69,
+74,75,76,77,67,37,68,69,78,79,80,81,67,37,68,69,
+82,83,84,85,67,37,68,86,87,88,89,90,67,37,68,69,
+91,92,93,94,67,37,68,69,37,95,96,97,67,37,68,69,
+98,99,100,101,102,103,104,105,98,99,100,106,102,103,104,107,
+98,99,100,108,102,103,104,109,98,99,100,110,102,103,104,111,
+98,99,100,112,102,103,104,113,98,99,100,114,102,103,104,115,
+98,99,100,116,102,103,104,117,98,99,100,118,102,103,104,119,
+120,121,121,122,123,124,124,125,126,127,127,128,129,130,130,131,
+132,133,133,134,135,136,136,137,138,139,139,140,141,142,142,143,
+144,145,145,146,147,148,148,149,150,151,151,152,153,154,154,155,
+156,157,157,158,159,160,160,161,162,163,163,164,165,166,166,167,
+168,168,168,168,169,170,170,170,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+168,168,168,168,37,37,37,37,168,168,168,168,37,37,37,37,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+171,172,173,174,175,176,177,178,171,172,173,174,175,176,177,178,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+179,180,181,182,183,184,185,186,179,180,181,182,183,184,185,186,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+187,188,189,190,191,192,193,194,187,188,189,190,191,192,193,194,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+195,196,197,198,199,200,201,202,195,196,197,198,199,200,201,202,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+203,204,205,206,207,208,209,210,203,204,205,206,207,208,209,210,
+211,212,213,214,215,216,217,218,211,212,213,219,215,216,217,220,
+211,212,213,221,215,216,217,222,211,212,213,223,215,216,217,224,
+211,212,213,225,215,216,217,226,211,212,213,227,215,216,217,228,
+211,212,213,229,215,216,217,230,211,212,213,231,215,216,217,232,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+};
+const struct cpudispatch_tbl op_dispatch_2 = {
+	op_dispatch_handlers_2, op_dispatch_pages_2, op_dispatch_index_2, 1803, 233
+};
+
+/* CPU level 1: 1597 handlers, 213 pages */
+static cpuop_func *const op_dispatch_handlers_3[] = {
+op_illg_1,
+op_0_0_ff,
+op_10_0_ff,
+op_18_0_ff,
+op_20_0_ff,
+op_28_0_ff,
+op_30_3_ff,
+op_38_0_ff,
+op_39_0_ff,
+op_3c_0_ff,
+op_40_0_ff,
+op_50_0_ff,
+op_58_0_ff,
+op_60_0_ff,
+op_68_0_ff,
+op_70_3_ff,
+op_78_0_ff,
+op_79_0_ff,
+op_7c_0_ff,
+op_80_0_ff,
+op_90_0_ff,
+op_98_0_ff,
+op_a0_0_ff,
+op_a8_0_ff,
+op_b0_3_ff,
+op_b8_0_ff,
+op_b9_0_ff,
+op_100_0_ff,
+op_108_0_ff,
+op_110_0_ff,
+op_118_0_ff,
+op_120_0_ff,
+op_128_0_ff,
+op_130_3_ff,
+op_138_0_ff,
+op_139_0_ff,
+op_13a_0_ff,
+op_13b_3_ff,
+op_13c_0_ff,
+op_140_0_ff,
+op_148_0_ff,
+op_150_0_ff,
+op_158_0_ff,
+op_160_0_ff,
+op_168_0_ff,
+op_170_3_ff,
+op_178_0_ff,
+op_179_0_ff,
+op_17a_0_ff,
+op_17b_3_ff,
+op_180_0_ff,
+op_188_0_ff,
+op_190_0_ff,
+op_198_0_ff,
+op_1a0_0_ff,
+op_1a8_0_ff,
+op_1b0_3_ff,
+op_1b8_0_ff,
+op_1b9_0_ff,
+op_1ba_0_ff,
+op_1bb_3_ff,
+op_1c0_0_ff,
+op_1c8_0_ff,
+op_1d0_0_ff,
+op_1d8_0_ff,
+op_1e0_0_ff,
+op_1e8_0_ff,
+op_1f0_3_ff,
+op_1f8_0_ff,
+op_1f9_0_ff,
+op_1fa_0_ff,
+op_1fb_3_ff,
+op_200_0_ff,
+op_210_0_ff,
+op_218_0_ff,
+op_220_0_ff,
+op_228_0_ff,
+op_230_3_ff,
+op_238_0_ff,
+op_239_0_ff,
+op_23c_0_ff,
+op_240_0_ff,
+op_250_0_ff,
+op_258_0_ff,
+op_260_0_ff,
+op_268_0_ff,
+op_270_3_ff,
+op_278_0_ff,
+op_279_0_ff,
+op_27c_0_ff,
+op_280_0_ff,
+op_290_0_ff,
+op_298_0_ff,
+op_2a0_0_ff,
+op_2a8_0_ff,
+op_2b0_3_ff,
+op_2b8_0_ff,
+op_2b9_0_ff,
+op_400_0_ff,
+op_410_0_ff,
+op_418_0_ff,
+op_420_0_ff,
+op_428_0_ff,
+op_430_3_ff,
+op_438_0_ff,
+op_439_0_ff,
+op_440_0_ff,
+op_450_0_ff,
+op_458_0_ff,
+op_460_0_ff,
+op_468_0_ff,
+op_470_3_ff,
+op_478_0_ff,
+op_479_0_ff,
+op_480_0_ff,
+op_490_0_ff,
+op_498_0_ff,
+op_4a0_0_ff,
+op_4a8_0_ff,
+op_4b0_3_ff,
+op_4b8_0_ff,
+op_4b9_0_ff,
+op_600_0_ff,
+op_610_0_ff,
+op_618_0_ff,
+op_620_0_ff,
+op_628_0_ff,
+op_630_3_ff,
+op_638_0_ff,
+op_639_0_ff,
+op_640_0_ff,
+op_650_0_ff,
+op_658_0_ff,
+op_660_0_ff,
+op_668_0_ff,
+op_670_3_ff,
+op_678_0_ff,
+op_679_0_ff,
+op_680_0_ff,
+op_690_0_ff,
+op_698_0_ff,
+op_6a0_0_ff,
+op_6a8_0_ff,
+op_6b0_3_ff,
+op_6b8_0_ff,
+op_6b9_0_ff,
+op_800_0_ff,
+op_810_0_ff,
+op_818_0_ff,
+op_820_0_ff,
+op_828_0_ff,
+op_830_3_ff,
+op_838_0_ff,
+op_839_0_ff,
+op_83a_0_ff,
+op_83b_3_ff,
+op_83c_0_ff,
+op_840_0_ff,
+op_850_0_ff,
+op_858_0_ff,
+op_860_0_ff,
+op_868_0_ff,
+op_870_3_ff,
+op_878_0_ff,
+op_879_0_ff,
+op_87a_0_ff,
+op_87b_3_ff,
+op_880_0_ff,
+op_890_0_ff,
+op_898_0_ff,
+op_8a0_0_ff,
+op_8a8_0_ff,
+op_8b0_3_ff,
+op_8b8_0_ff,
+op_8b9_0_ff,
+op_8ba_0_ff,
+op_8bb_3_ff,
+op_8c0_0_ff,
+op_8d0_0_ff,
+op_8d8_0_ff,
+op_8e0_0_ff,
+op_8e8_0_ff,
+op_8f0_3_ff,
+op_8f8_0_ff,
+op_8f9_0_ff,
+op_8fa_0_ff,
+op_8fb_3_ff,
+op_a00_0_ff,
+op_a10_0_ff,
+op_a18_0_ff,
+op_a20_0_ff,
+op_a28_0_ff,
+op_a30_3_ff,
+op_a38_0_ff,
+op_a39_0_ff,
+op_a3c_0_ff,
+op_a40_0_ff,
+op_a50_0_ff,
+op_a58_0_ff,
+op_a60_0_ff,
+op_a68_0_ff,
+op_a70_3_ff,
+op_a78_0_ff,
+op_a79_0_ff,
+op_a7c_0_ff,
+op_a80_0_ff,
+op_a90_0_ff,
+op_a98_0_ff,
+op_aa0_0_ff,
+op_aa8_0_ff,
+op_ab0_3_ff,
+op_ab8_0_ff,
+op_ab9_0_ff,
+op_c00_0_ff,
+op_c10_0_ff,
+op_c18_0_ff,
+op_c20_0_ff,
+op_c28_0_ff,
+op_c30_3_ff,
+op_c38_0_ff,
+op_c39_0_ff,
+op_c3a_0_ff,
+op_c3b_3_ff,
+op_c40_0_ff,
+op_c50_0_ff,
+op_c58_0_ff,
+op_c60_0_ff,
+op_c68_0_ff,
+op_c70_3_ff,
+op_c78_0_ff,
+op_c79_0_ff,
+op_c7a_0_ff,
+op_c7b_3_ff,
+op_c80_0_ff,
+op_c90_0_ff,
+op_c98_0_ff,
+op_ca0_0_ff,
+op_ca8_0_ff,
+op_cb0_3_ff,
+op_cb8_0_ff,
+op_cb9_0_ff,
+op_cba_0_ff,
+op_cbb_3_ff,
+op_1000_0_ff,
+op_1010_0_ff,
+op_1018_0_ff,
+op_1020_0_ff,
+op_1028_0_ff,
+op_1030_3_ff,
+op_1038_0_ff,
+op_1039_0_ff,
+op_103a_0_ff,
+op_103b_3_ff,
+op_103c_0_ff,
+op_1080_0_ff,
+op_1090_0_ff,
+op_1098_0_ff,
+op_10a0_0_ff,
+op_10a8_0_ff,
+op_10b0_3_ff,
+op_10b8_0_ff,
+op_10b9_0_ff,
+op_10ba_0_ff,
+op_10bb_3_ff,
+op_10bc_0_ff,
+op_10c0_0_ff,
+op_10d0_0_ff,
+op_10d8_0_ff,
+op_10e0_0_ff,
+op_10e8_0_ff,
+op_10f0_3_ff,
+op_10f8_0_ff,
+op_10f9_0_ff,
+op_10fa_0_ff,
+op_10fb_3_ff,
+op_10fc_0_ff,
+op_1100_0_ff,
+op_1110_0_ff,
+op_1118_0_ff,
+op_1120_0_ff,
+op_1128_0_ff,
+op_1130_3_ff,
+op_1138_0_ff,
+op_1139_0_ff,
+op_113a_0_ff,
+op_113b_3_ff,
+op_113c_0_ff,
+op_1140_0_ff,
+op_1150_0_ff,
+op_1158_0_ff,
+op_1160_0_ff,
+op_1168_0_ff,
+op_1170_3_ff,
+op_1178_0_ff,
+op_1179_0_ff,
+op_117a_0_ff,
+op_117b_3_ff,
+op_117c_0_ff,
+op_1180_3_ff,
+op_1190_3_ff,
+op_1198_3_ff,
+op_11a0_3_ff,
+op_11a8_3_ff,
+op_11b0_3_ff,
+op_11b8_3_ff,
+op_11b9_3_ff,
+op_11ba_3_ff,
+op_11bb_3_ff,
+op_11bc_3_ff,
+op_11c0_0_ff,
+op_11d0_0_ff,
+op_11d8_0_ff,
+op_11e0_0_ff,
+op_11e8_0_ff,
+op_11f0_3_ff,
+op_11f8_0_ff,
+op_11f9_0_ff,
+op_11fa_0_ff,
+op_11fb_3_ff,
+op_11fc_0_ff,
+op_13c0_0_ff,
+op_13d0_0_ff,
+op_13d8_0_ff,
+op_13e0_0_ff,
+op_13e8_0_ff,
+op_13f0_3_ff,
+op_13f8_0_ff,
+op_13f9_0_ff,
+op_13fa_0_ff,
+op_13fb_3_ff,
+op_13fc_0_ff,
+op_2000_0_ff,
+op_2008_0_ff,
+op_2010_0_ff,
+op_2018_0_ff,
+op_2020_0_ff,
+op_2028_0_ff,
+op_2030_3_ff,
+op_2038_0_ff,
+op_2039_0_ff,
+op_203a_0_ff,
+op_203b_3_ff,
+op_203c_0_ff,
+op_2040_0_ff,
+op_2048_0_ff,
+op_2050_0_ff,
+op_2058_0_ff,
+op_2060_0_ff,
+op_2068_0_ff,
+op_2070_3_ff,
+op_2078_0_ff,
+op_2079_0_ff,
+op_207a_0_ff,
+op_207b_3_ff,
+op_207c_0_ff,
+op_2080_0_ff,
+op_2088_0_ff,
+op_2090_0_ff,
+op_2098_0_ff,
+op_20a0_0_ff,
+op_20a8_0_ff,
+op_20b0_3_ff,
+op_20b8_0_ff,
+op_20b9_0_ff,
+op_20ba_0_ff,
+op_20bb_3_ff,
+op_20bc_0_ff,
+op_20c0_0_ff,
+op_20c8_0_ff,
+op_20d0_0_ff,
+op_20d8_0_ff,
+op_20e0_0_ff,
+op_20e8_0_ff,
+op_20f0_3_ff,
+op_20f8_0_ff,
+op_20f9_0_ff,
+op_20fa_0_ff,
+op_20fb_3_ff,
+op_20fc_0_ff,
+op_2100_0_ff,
+op_2108_0_ff,
+op_2110_0_ff,
+op_2118_0_ff,
+op_2120_0_ff,
+op_2128_0_ff,
+op_2130_3_ff,
+op_2138_0_ff,
+op_2139_0_ff,
+op_213a_0_ff,
+op_213b_3_ff,
+op_213c_0_ff,
+op_2140_0_ff,
+op_2148_0_ff,
+op_2150_0_ff,
+op_2158_0_ff,
+op_2160_0_ff,
+op_2168_0_ff,
+op_2170_3_ff,
+op_2178_0_ff,
+op_2179_0_ff,
+op_217a_0_ff,
+op_217b_3_ff,
+op_217c_0_ff,
+op_2180_3_ff,
+op_2188_3_ff,
+op_2190_3_ff,
+op_2198_3_ff,
+op_21a0_3_ff,
+op_21a8_3_ff,
+op_21b0_3_ff,
+op_21b8_3_ff,
+op_21b9_3_ff,
+op_21ba_3_ff,
+op_21bb_3_ff,
+op_21bc_3_ff,
+op_21c0_0_ff,
+op_21c8_0_ff,
+op_21d0_0_ff,
+op_21d8_0_ff,
+op_21e0_0_ff,
+op_21e8_0_ff,
+op_21f0_3_ff,
+op_21f8_0_ff,
+op_21f9_0_ff,
+op_21fa_0_ff,
+op_21fb_3_ff,
+op_21fc_0_ff,
+op_23c0_0_ff,
+op_23c8_0_ff,
+op_23d0_0_ff,
+op_23d8_0_ff,
+op_23e0_0_ff,
+op_23e8_0_ff,
+op_23f0_3_ff,
+op_23f8_0_ff,
+op_23f9_0_ff,
+op_23fa_0_ff,
+op_23fb_3_ff,
+op_23fc_0_ff,
+op_3000_0_ff,
+op_3008_0_ff,
+op_3010_0_ff,
+op_3018_0_ff,
+op_3020_0_ff,
+op_3028_0_ff,
+op_3030_3_ff,
+op_3038_0_ff,
+op_3039_0_ff,
+op_303a_0_ff,
+op_303b_3_ff,
+op_303c_0_ff,
+op_3040_0_ff,
+op_3048_0_ff,
+op_3050_0_ff,
+op_3058_0_ff,
+op_3060_0_ff,
+op_3068_0_ff,
+op_3070_3_ff,
+op_3078_0_ff,
+op_3079_0_ff,
+op_307a_0_ff,
+op_307b_3_ff,
+op_307c_0_ff,
+op_3080_0_ff,
+op_3088_0_ff,
+op_3090_0_ff,
+op_3098_0_ff,
+op_30a0_0_ff,
+op_30a8_0_ff,
+op_30b0_3_ff,
+op_30b8_0_ff,
+op_30b9_0_ff,
+op_30ba_0_ff,
+op_30bb_3_ff,
+op_30bc_0_ff,
+op_30c0_0_ff,
+op_30c8_0_ff,
+op_30d0_0_ff,
+op_30d8_0_ff,
+op_30e0_0_ff,
+op_30e8_0_ff,
+op_30f0_3_ff,
+op_30f8_0_ff,
+op_30f9_0_ff,
+op_30fa_0_ff,
+op_30fb_3_ff,
+op_30fc_0_ff,
+op_3100_0_ff,
+op_3108_0_ff,
+op_3110_0_ff,
+op_3118_0_ff,
+op_3120_0_ff,
+op_3128_0_ff,
+op_3130_3_ff,
+op_3138_0_ff,
+op_3139_0_ff,
+op_313a_0_ff,
+op_313b_3_ff,
+op_313c_0_ff,
+op_3140_0_ff,
+op_3148_0_ff,
+op_3150_0_ff,
+op_3158_0_ff,
+op_3160_0_ff,
+op_3168_0_ff,
+op_3170_3_ff,
+op_3178_0_ff,
+op_3179_0_ff,
+op_317a_0_ff,
+op_317b_3_ff,
+op_317c_0_ff,
+op_3180_3_ff,
+op_3188_3_ff,
+op_3190_3_ff,
+op_3198_3_ff,
+op_31a0_3_ff,
+op_31a8_3_ff,
+op_31b0_3_ff,
+op_31b8_3_ff,
+op_31b9_3_ff,
+op_31ba_3_ff,
+op_31bb_3_ff,
+op_31bc_3_ff,
+op_31c0_0_ff,
+op_31c8_0_ff,
+op_31d0_0_ff,
+op_31d8_0_ff,
+op_31e0_0_ff,
+op_31e8_0_ff,
+op_31f0_3_ff,
+op_31f8_0_ff,
+op_31f9_0_ff,
+op_31fa_0_ff,
+op_31fb_3_ff,
+op_31fc_0_ff,
+op_33c0_0_ff,
+op_33c8_0_ff,
+op_33d0_0_ff,
+op_33d8_0_ff,
+op_33e0_0_ff,
+op_33e8_0_ff,
+op_33f0_3_ff,
+op_33f8_0_ff,
+op_33f9_0_ff,
+op_33fa_0_ff,
+op_33fb_3_ff,
+op_33fc_0_ff,
+op_4000_0_ff,
+op_4010_0_ff,
+op_4018_0_ff,
+op_4020_0_ff,
+op_4028_0_ff,
+op_4030_3_ff,
+op_4038_0_ff,
+op_4039_0_ff,
+op_4040_0_ff,
+op_4050_0_ff,
+op_4058_0_ff,
+op_4060_0_ff,
+op_4068_0_ff,
+op_4070_3_ff,
+op_4078_0_ff,
+op_4079_0_ff,
+op_4080_0_ff,
+op_4090_0_ff,
+op_4098_0_ff,
+op_40a0_0_ff,
+op_40a8_0_ff,
+op_40b0_3_ff,
+op_40b8_0_ff,
+op_40b9_0_ff,
+op_40c0_0_ff,
+op_40d0_0_ff,
+op_40d8_0_ff,
+op_40e0_0_ff,
+op_40e8_0_ff,
+op_40f0_3_ff,
+op_40f8_0_ff,
+op_40f9_0_ff,
+op_4100_0_ff,
+op_4110_0_ff,
+op_4118_0_ff,
+op_4120_0_ff,
+op_4128_0_ff,
+op_4130_3_ff,
+op_4138_0_ff,
+op_4139_0_ff,
+op_413a_0_ff,
+op_413b_3_ff,
+op_413c_0_ff,
+op_4180_0_ff,
+op_4190_0_ff,
+op_4198_0_ff,
+op_41a0_0_ff,
+op_41a8_0_ff,
+op_41b0_3_ff,
+op_41b8_0_ff,
+op_41b9_0_ff,
+op_41ba_0_ff,
+op_41bb_3_ff,
+op_41bc_0_ff,
+op_41d0_0_ff,
+op_41e8_0_ff,
+op_41f0_3_ff,
+op_41f8_0_ff,
+op_41f9_0_ff,
+op_41fa_0_ff,
+op_41fb_3_ff,
+op_4200_0_ff,
+op_4210_0_ff,
+op_4218_0_ff,
+op_4220_0_ff,
+op_4228_0_ff,
+op_4230_3_ff,
+op_4238_0_ff,
+op_4239_0_ff,
+op_4240_0_ff,
+op_4250_0_ff,
+op_4258_0_ff,
+op_4260_0_ff,
+op_4268_0_ff,
+op_4270_3_ff,
+op_4278_0_ff,
+op_4279_0_ff,
+op_4280_0_ff,
+op_4290_0_ff,
+op_4298_0_ff,
+op_42a0_0_ff,
+op_42a8_0_ff,
+op_42b0_3_ff,
+op_42b8_0_ff,
+op_42b9_0_ff,
+op_42c0_0_ff,
+op_42d0_0_ff,
+op_42d8_0_ff,
+op_42e0_0_ff,
+op_42e8_0_ff,
+op_42f0_3_ff,
+op_42f8_0_ff,
+op_42f9_0_ff,
+op_4400_0_ff,
+op_4410_0_ff,
+op_4418_0_ff,
+op_4420_0_ff,
+op_4428_0_ff,
+op_4430_3_ff,
+op_4438_0_ff,
+op_4439_0_ff,
+op_4440_0_ff,
+op_4450_0_ff,
+op_4458_0_ff,
+op_4460_0_ff,
+op_4468_0_ff,
+op_4470_3_ff,
+op_4478_0_ff,
+op_4479_0_ff,
+op_4480_0_ff,
+op_4490_0_ff,
+op_4498_0_ff,
+op_44a0_0_ff,
+op_44a8_0_ff,
+op_44b0_3_ff,
+op_44b8_0_ff,
+op_44b9_0_ff,
+op_44c0_0_ff,
+op_44d0_0_ff,
+op_44d8_0_ff,
+op_44e0_0_ff,
+op_44e8_0_ff,
+op_44f0_3_ff,
+op_44f8_0_ff,
+op_44f9_0_ff,
+op_44fa_0_ff,
+op_44fb_3_ff,
+op_44fc_0_ff,
+op_4600_0_ff,
+op_4610_0_ff,
+op_4618_0_ff,
+op_4620_0_ff,
+op_4628_0_ff,
+op_4630_3_ff,
+op_4638_0_ff,
+op_4639_0_ff,
+op_4640_0_ff,
+op_4650_0_ff,
+op_4658_0_ff,
+op_4660_0_ff,
+op_4668_0_ff,
+op_4670_3_ff,
+op_4678_0_ff,
+op_4679_0_ff,
+op_4680_0_ff,
+op_4690_0_ff,
+op_4698_0_ff,
+op_46a0_0_ff,
+op_46a8_0_ff,
+op_46b0_3_ff,
+op_46b8_0_ff,
+op_46b9_0_ff,
+op_46c0_0_ff,
+op_46d0_0_ff,
+op_46d8_0_ff,
+op_46e0_0_ff,
+op_46e8_0_ff,
+op_46f0_3_ff,
+op_46f8_0_ff,
+op_46f9_0_ff,
+op_46fa_0_ff,
+op_46fb_3_ff,
+op_46fc_0_ff,
+op_4800_1_ff,
+op_4810_1_ff,
+op_4818_1_ff,
+op_4820_1_ff,
+op_4828_1_ff,
+op_4830_3_ff,
+op_4838_1_ff,
+op_4839_1_ff,
+op_4840_0_ff,
+op_4850_0_ff,
+op_4868_0_ff,
+op_4870_3_ff,
+op_4878_0_ff,
+op_4879_0_ff,
+op_487a_0_ff,
+op_487b_3_ff,
+op_4880_0_ff,
+op_4890_0_ff,
+op_48a0_0_ff,
+op_48a8_0_ff,
+op_48b0_3_ff,
+op_48b8_0_ff,
+op_48b9_0_ff,
+op_48c0_0_ff,
+op_48d0_0_ff,
+op_48e0_0_ff,
+op_48e8_0_ff,
+op_48f0_3_ff,
+op_48f8_0_ff,
+op_48f9_0_ff,
+op_49c0_0_ff,
+op_4a00_0_ff,
+op_4a10_0_ff,
+op_4a18_0_ff,
+op_4a20_0_ff,
+op_4a28_0_ff,
+op_4a30_3_ff,
+op_4a38_0_ff,
+op_4a39_0_ff,
+op_4a3a_0_ff,
+op_4a3b_3_ff,
+op_4a3c_0_ff,
+op_4a40_0_ff,
+op_4a48_0_ff,
+op_4a50_0_ff,
+op_4a58_0_ff,
+op_4a60_0_ff,
+op_4a68_0_ff,
+op_4a70_3_ff,
+op_4a78_0_ff,
+op_4a79_0_ff,
+op_4a7a_0_ff,
+op_4a7b_3_ff,
+op_4a7c_0_ff,
+op_4a80_0_ff,
+op_4a88_0_ff,
+op_4a90_0_ff,
+op_4a98_0_ff,
+op_4aa0_0_ff,
+op_4aa8_0_ff,
+op_4ab0_3_ff,
+op_4ab8_0_ff,
+op_4ab9_0_ff,
+op_4aba_0_ff,
+op_4abb_3_ff,
+op_4abc_0_ff,
+op_4ac0_0_ff,
+op_4ad0_0_ff,
+op_4ad8_0_ff,
+op_4ae0_0_ff,
+op_4ae8_0_ff,
+op_4af0_3_ff,
+op_4af8_0_ff,
+op_4af9_0_ff,
+op_4c90_0_ff,
+op_4c98_0_ff,
+op_4ca8_0_ff,
+op_4cb0_3_ff,
+op_4cb8_0_ff,
+op_4cb9_0_ff,
+op_4cba_0_ff,
+op_4cbb_3_ff,
+op_4cd0_0_ff,
+op_4cd8_0_ff,
+op_4ce8_0_ff,
+op_4cf0_3_ff,
+op_4cf8_0_ff,
+op_4cf9_0_ff,
+op_4cfa_0_ff,
+op_4cfb_3_ff,
+op_4e40_0_ff,
+op_4e50_0_ff,
+op_4e58_0_ff,
+op_4e60_0_ff,
+op_4e68_0_ff,
+op_4e70_0_ff,
+op_4e71_0_ff,
+op_4e72_0_ff,
+op_4e73_0_ff,
+op_4e74_0_ff,
+op_4e75_0_ff,
+op_4e76_0_ff,
+op_4e77_0_ff,
+op_4e7a_0_ff,
+op_4e7b_0_ff,
+op_4e90_0_ff,
+op_4ea8_0_ff,
+op_4eb0_3_ff,
+op_4eb8_0_ff,
+op_4eb9_0_ff,
+op_4eba_0_ff,
+op_4ebb_3_ff,
+op_4ed0_0_ff,
+op_4ee8_0_ff,
+op_4ef0_3_ff,
+op_4ef8_0_ff,
+op_4ef9_0_ff,
+op_4efa_0_ff,
+op_4efb_3_ff,
+op_5000_0_ff,
+op_5010_0_ff,
+op_5018_0_ff,
+op_5020_0_ff,
+op_5028_0_ff,
+op_5030_3_ff,
+op_5038_0_ff,
+op_5039_0_ff,
+op_5040_0_ff,
+op_5048_0_ff,
+op_5050_0_ff,
+op_5058_0_ff,
+op_5060_0_ff,
+op_5068_0_ff,
+op_5070_3_ff,
+op_5078_0_ff,
+op_5079_0_ff,
+op_5080_0_ff,
+op_5088_0_ff,
+op_5090_0_ff,
+op_5098_0_ff,
+op_50a0_0_ff,
+op_50a8_0_ff,
+op_50b0_3_ff,
+op_50b8_0_ff,
+op_50b9_0_ff,
+op_50c0_0_ff,
+op_50c8_0_ff,
+op_50d0_0_ff,
+op_50d8_0_ff,
+op_50e0_0_ff,
+op_50e8_0_ff,
+op_50f0_3_ff,
+op_50f8_0_ff,
+op_50f9_0_ff,
+op_5100_0_ff,
+op_5110_0_ff,
+op_5118_0_ff,
+op_5120_0_ff,
+op_5128_0_ff,
+op_5130_3_ff,
+op_5138_0_ff,
+op_5139_0_ff,
+op_5140_0_ff,
+op_5148_0_ff,
+op_5150_0_ff,
+op_5158_0_ff,
+op_5160_0_ff,
+op_5168_0_ff,
+op_5170_3_ff,
+op_5178_0_ff,
+op_5179_0_ff,
+op_5180_0_ff,
+op_5188_0_ff,
+op_5190_0_ff,
+op_5198_0_ff,
+op_51a0_0_ff,
+op_51a8_0_ff,
+op_51b0_3_ff,
+op_51b8_0_ff,
+op_51b9_0_ff,
+op_51c0_0_ff,
+op_51c8_0_ff,
+op_51d0_0_ff,
+op_51d8_0_ff,
+op_51e0_0_ff,
+op_51e8_0_ff,
+op_51f0_3_ff,
+op_51f8_0_ff,
+op_51f9_0_ff,
+op_52c0_0_ff,
+op_52c8_0_ff,
+op_52d0_0_ff,
+op_52d8_0_ff,
+op_52e0_0_ff,
+op_52e8_0_ff,
+op_52f0_3_ff,
+op_52f8_0_ff,
+op_52f9_0_ff,
+op_53c0_0_ff,
+op_53c8_0_ff,
+op_53d0_0_ff,
+op_53d8_0_ff,
+op_53e0_0_ff,
+op_53e8_0_ff,
+op_53f0_3_ff,
+op_53f8_0_ff,
+op_53f9_0_ff,
+op_54c0_0_ff,
+op_54c8_0_ff,
+op_54d0_0_ff,
+op_54d8_0_ff,
+op_54e0_0_ff,
+op_54e8_0_ff,
+op_54f0_3_ff,
+op_54f8_0_ff,
+op_54f9_0_ff,
+op_55c0_0_ff,
+op_55c8_0_ff,
+op_55d0_0_ff,
+op_55d8_0_ff,
+op_55e0_0_ff,
+op_55e8_0_ff,
+op_55f0_3_ff,
+op_55f8_0_ff,
+op_55f9_0_ff,
+op_56c0_0_ff,
+op_56c8_0_ff,
+op_56d0_0_ff,
+op_56d8_0_ff,
+op_56e0_0_ff,
+op_56e8_0_ff,
+op_56f0_3_ff,
+op_56f8_0_ff,
+op_56f9_0_ff,
+op_57c0_0_ff,
+op_57c8_0_ff,
+op_57d0_0_ff,
+op_57d8_0_ff,
+op_57e0_0_ff,
+op_57e8_0_ff,
+op_57f0_3_ff,
+op_57f8_0_ff,
+op_57f9_0_ff,
+op_58c0_0_ff,
+op_58c8_0_ff,
+op_58d0_0_ff,
+op_58d8_0_ff,
+op_58e0_0_ff,
+op_58e8_0_ff,
+op_58f0_3_ff,
+op_58f8_0_ff,
+op_58f9_0_ff,
+op_59c0_0_ff,
+op_59c8_0_ff,
+op_59d0_0_ff,
+op_59d8_0_ff,
+op_59e0_0_ff,
+op_59e8_0_ff,
+op_59f0_3_ff,
+op_59f8_0_ff,
+op_59f9_0_ff,
+op_5ac0_0_ff,
+op_5ac8_0_ff,
+op_5ad0_0_ff,
+op_5ad8_0_ff,
+op_5ae0_0_ff,
+op_5ae8_0_ff,
+op_5af0_3_ff,
+op_5af8_0_ff,
+op_5af9_0_ff,
+op_5bc0_0_ff,
+op_5bc8_0_ff,
+op_5bd0_0_ff,
+op_5bd8_0_ff,
+op_5be0_0_ff,
+op_5be8_0_ff,
+op_5bf0_3_ff,
+op_5bf8_0_ff,
+op_5bf9_0_ff,
+op_5cc0_0_ff,
+op_5cc8_0_ff,
+op_5cd0_0_ff,
+op_5cd8_0_ff,
+op_5ce0_0_ff,
+op_5ce8_0_ff,
+op_5cf0_3_ff,
+op_5cf8_0_ff,
+op_5cf9_0_ff,
+op_5dc0_0_ff,
+op_5dc8_0_ff,
+op_5dd0_0_ff,
+op_5dd8_0_ff,
+op_5de0_0_ff,
+op_5de8_0_ff,
+op_5df0_3_ff,
+op_5df8_0_ff,
+op_5df9_0_ff,
+op_5ec0_0_ff,
+op_5ec8_0_ff,
+op_5ed0_0_ff,
+op_5ed8_0_ff,
+op_5ee0_0_ff,
+op_5ee8_0_ff,
+op_5ef0_3_ff,
+op_5ef8_0_ff,
+op_5ef9_0_ff,
+op_5fc0_0_ff,
+op_5fc8_0_ff,
+op_5fd0_0_ff,
+op_5fd8_0_ff,
+op_5fe0_0_ff,
+op_5fe8_0_ff,
+op_5ff0_3_ff,
+op_5ff8_0_ff,
+op_5ff9_0_ff,
+op_6000_0_ff,
+op_6001_0_ff,
+op_60ff_3_ff,
+op_6100_0_ff,
+op_6101_0_ff,
+op_61ff_0_ff,
+op_6200_0_ff,
+op_6201_0_ff,
+op_62ff_3_ff,
+op_6300_0_ff,
+op_6301_0_ff,
+op_63ff_3_ff,
+op_6400_0_ff,
+op_6401_0_ff,
+op_64ff_3_ff,
+op_6500_0_ff,
+op_6501_0_ff,
+op_65ff_3_ff,
+op_6600_0_ff,
+op_6601_0_ff,
+op_66ff_3_ff,
+op_6700_0_ff,
+op_6701_0_ff,
+op_67ff_3_ff,
+op_6800_0_ff,
+op_6801_0_ff,
+op_68ff_3_ff,
+op_6900_0_ff,
+op_6901_0_ff,
+op_69ff_3_ff,
+op_6a00_0_ff,
+op_6a01_0_ff,
+op_6aff_3_ff,
+op_6b00_0_ff,
+op_6b01_0_ff,
+op_6bff_3_ff,
+op_6c00_0_ff,
+op_6c01_0_ff,
+op_6cff_3_ff,
+op_6d00_0_ff,
+op_6d01_0_ff,
+op_6dff_3_ff,
+op_6e00_0_ff,
+op_6e01_0_ff,
+op_6eff_3_ff,
+op_6f00_0_ff,
+op_6f01_0_ff,
+op_6fff_3_ff,
+op_7000_0_ff,
+op_7100_0_ff,
+op_7101_0_ff,
+op_8000_0_ff,
+op_8010_0_ff,
+op_8018_0_ff,
+op_8020_0_ff,
+op_8028_0_ff,
+op_8030_3_ff,
+op_8038_0_ff,
+op_8039_0_ff,
+op_803a_0_ff,
+op_803b_3_ff,
+op_803c_0_ff,
+op_8040_0_ff,
+op_8050_0_ff,
+op_8058_0_ff,
+op_8060_0_ff,
+op_8068_0_ff,
+op_8070_3_ff,
+op_8078_0_ff,
+op_8079_0_ff,
+op_807a_0_ff,
+op_807b_3_ff,
+op_807c_0_ff,
+op_8080_0_ff,
+op_8090_0_ff,
+op_8098_0_ff,
+op_80a0_0_ff,
+op_80a8_0_ff,
+op_80b0_3_ff,
+op_80b8_0_ff,
+op_80b9_0_ff,
+op_80ba_0_ff,
+op_80bb_3_ff,
+op_80bc_0_ff,
+op_80c0_0_ff,
+op_80d0_0_ff,
+op_80d8_0_ff,
+op_80e0_0_ff,
+op_80e8_0_ff,
+op_80f0_3_ff,
+op_80f8_0_ff,
+op_80f9_0_ff,
+op_80fa_0_ff,
+op_80fb_3_ff,
+op_80fc_0_ff,
+op_8100_1_ff,
+op_8108_1_ff,
+op_8110_0_ff,
+op_8118_0_ff,
+op_8120_0_ff,
+op_8128_0_ff,
+op_8130_3_ff,
+op_8138_0_ff,
+op_8139_0_ff,
+op_8150_0_ff,
+op_8158_0_ff,
+op_8160_0_ff,
+op_8168_0_ff,
+op_8170_3_ff,
+op_8178_0_ff,
+op_8179_0_ff,
+op_8190_0_ff,
+op_8198_0_ff,
+op_81a0_0_ff,
+op_81a8_0_ff,
+op_81b0_3_ff,
+op_81b8_0_ff,
+op_81b9_0_ff,
+op_81c0_0_ff,
+op_81d0_0_ff,
+op_81d8_0_ff,
+op_81e0_0_ff,
+op_81e8_0_ff,
+op_81f0_3_ff,
+op_81f8_0_ff,
+op_81f9_0_ff,
+op_81fa_0_ff,
+op_81fb_3_ff,
+op_81fc_0_ff,
+op_9000_0_ff,
+op_9010_0_ff,
+op_9018_0_ff,
+op_9020_0_ff,
+op_9028_0_ff,
+op_9030_3_ff,
+op_9038_0_ff,
+op_9039_0_ff,
+op_903a_0_ff,
+op_903b_3_ff,
+op_903c_0_ff,
+op_9040_0_ff,
+op_9048_0_ff,
+op_9050_0_ff,
+op_9058_0_ff,
+op_9060_0_ff,
+op_9068_0_ff,
+op_9070_3_ff,
+op_9078_0_ff,
+op_9079_0_ff,
+op_907a_0_ff,
+op_907b_3_ff,
+op_907c_0_ff,
+op_9080_0_ff,
+op_9088_0_ff,
+op_9090_0_ff,
+op_9098_0_ff,
+op_90a0_0_ff,
+op_90a8_0_ff,
+op_90b0_3_ff,
+op_90b8_0_ff,
+op_90b9_0_ff,
+op_90ba_0_ff,
+op_90bb_3_ff,
+op_90bc_0_ff,
+op_90c0_0_ff,
+op_90c8_0_ff,
+op_90d0_0_ff,
+op_90d8_0_ff,
+op_90e0_0_ff,
+op_90e8_0_ff,
+op_90f0_3_ff,
+op_90f8_0_ff,
+op_90f9_0_ff,
+op_90fa_0_ff,
+op_90fb_3_ff,
+op_90fc_0_ff,
+op_9100_0_ff,
+op_9108_0_ff,
+op_9110_0_ff,
+op_9118_0_ff,
+op_9120_0_ff,
+op_9128_0_ff,
+op_9130_3_ff,
+op_9138_0_ff,
+op_9139_0_ff,
+op_9140_0_ff,
+op_9148_0_ff,
+op_9150_0_ff,
+op_9158_0_ff,
+op_9160_0_ff,
+op_9168_0_ff,
+op_9170_3_ff,
+op_9178_0_ff,
+op_9179_0_ff,
+op_9180_0_ff,
+op_9188_0_ff,
+op_9190_0_ff,
+op_9198_0_ff,
+op_91a0_0_ff,
+op_91a8_0_ff,
+op_91b0_3_ff,
+op_91b8_0_ff,
+op_91b9_0_ff,
+op_91c0_0_ff,
+op_91c8_0_ff,
+op_91d0_0_ff,
+op_91d8_0_ff,
+op_91e0_0_ff,
+op_91e8_0_ff,
+op_91f0_3_ff,
+op_91f8_0_ff,
+op_91f9_0_ff,
+op_91fa_0_ff,
+op_91fb_3_ff,
+op_91fc_0_ff,
+op_b000_0_ff,
+op_b010_0_ff,
+op_b018_0_ff,
+op_b020_0_ff,
+op_b028_0_ff,
+op_b030_3_ff,
+op_b038_0_ff,
+op_b039_0_ff,
+op_b03a_0_ff,
+op_b03b_3_ff,
+op_b03c_0_ff,
+op_b040_0_ff,
+op_b048_0_ff,
+op_b050_0_ff,
+op_b058_0_ff,
+op_b060_0_ff,
+op_b068_0_ff,
+op_b070_3_ff,
+op_b078_0_ff,
+op_b079_0_ff,
+op_b07a_0_ff,
+op_b07b_3_ff,
+op_b07c_0_ff,
+op_b080_0_ff,
+op_b088_0_ff,
+op_b090_0_ff,
+op_b098_0_ff,
+op_b0a0_0_ff,
+op_b0a8_0_ff,
+op_b0b0_3_ff,
+op_b0b8_0_ff,
+op_b0b9_0_ff,
+op_b0ba_0_ff,
+op_b0bb_3_ff,
+op_b0bc_0_ff,
+op_b0c0_0_ff,
+op_b0c8_0_ff,
+op_b0d0_0_ff,
+op_b0d8_0_ff,
+op_b0e0_0_ff,
+op_b0e8_0_ff,
+op_b0f0_3_ff,
+op_b0f8_0_ff,
+op_b0f9_0_ff,
+op_b0fa_0_ff,
+op_b0fb_3_ff,
+op_b0fc_0_ff,
+op_b100_0_ff,
+op_b108_0_ff,
+op_b110_0_ff,
+op_b118_0_ff,
+op_b120_0_ff,
+op_b128_0_ff,
+op_b130_3_ff,
+op_b138_0_ff,
+op_b139_0_ff,
+op_b140_0_ff,
+op_b148_0_ff,
+op_b150_0_ff,
+op_b158_0_ff,
+op_b160_0_ff,
+op_b168_0_ff,
+op_b170_3_ff,
+op_b178_0_ff,
+op_b179_0_ff,
+op_b180_0_ff,
+op_b188_0_ff,
+op_b190_0_ff,
+op_b198_0_ff,
+op_b1a0_0_ff,
+op_b1a8_0_ff,
+op_b1b0_3_ff,
+op_b1b8_0_ff,
+op_b1b9_0_ff,
+op_b1c0_0_ff,
+op_b1c8_0_ff,
+op_b1d0_0_ff,
+op_b1d8_0_ff,
+op_b1e0_0_ff,
+op_b1e8_0_ff,
+op_b1f0_3_ff,
+op_b1f8_0_ff,
+op_b1f9_0_ff,
+op_b1fa_0_ff,
+op_b1fb_3_ff,
+op_b1fc_0_ff,
+op_c000_0_ff,
+op_c010_0_ff,
+op_c018_0_ff,
+op_c020_0_ff,
+op_c028_0_ff,
+op_c030_3_ff,
+op_c038_0_ff,
+op_c039_0_ff,
+op_c03a_0_ff,
+op_c03b_3_ff,
+op_c03c_0_ff,
+op_c040_0_ff,
+op_c050_0_ff,
+op_c058_0_ff,
+op_c060_0_ff,
+op_c068_0_ff,
+op_c070_3_ff,
+op_c078_0_ff,
+op_c079_0_ff,
+op_c07a_0_ff,
+op_c07b_3_ff,
+op_c07c_0_ff,
+op_c080_0_ff,
+op_c090_0_ff,
+op_c098_0_ff,
+op_c0a0_0_ff,
+op_c0a8_0_ff,
+op_c0b0_3_ff,
+op_c0b8_0_ff,
+op_c0b9_0_ff,
+op_c0ba_0_ff,
+op_c0bb_3_ff,
+op_c0bc_0_ff,
+op_c0c0_0_ff,
+op_c0d0_0_ff,
+op_c0d8_0_ff,
+op_c0e0_0_ff,
+op_c0e8_0_ff,
+op_c0f0_3_ff,
+op_c0f8_0_ff,
+op_c0f9_0_ff,
+op_c0fa_0_ff,
+op_c0fb_3_ff,
+op_c0fc_0_ff,
+op_c100_1_ff,
+op_c108_1_ff,
+op_c110_0_ff,
+op_c118_0_ff,
+op_c120_0_ff,
+op_c128_0_ff,
+op_c130_3_ff,
+op_c138_0_ff,
+op_c139_0_ff,
+op_c140_0_ff,
+op_c148_0_ff,
+op_c150_0_ff,
+op_c158_0_ff,
+op_c160_0_ff,
+op_c168_0_ff,
+op_c170_3_ff,
+op_c178_0_ff,
+op_c179_0_ff,
+op_c188_0_ff,
+op_c190_0_ff,
+op_c198_0_ff,
+op_c1a0_0_ff,
+op_c1a8_0_ff,
+op_c1b0_3_ff,
+op_c1b8_0_ff,
+op_c1b9_0_ff,
+op_c1c0_0_ff,
+op_c1d0_0_ff,
+op_c1d8_0_ff,
+op_c1e0_0_ff,
+op_c1e8_0_ff,
+op_c1f0_3_ff,
+op_c1f8_0_ff,
+op_c1f9_0_ff,
+op_c1fa_0_ff,
+op_c1fb_3_ff,
+op_c1fc_0_ff,
+op_d000_0_ff,
+op_d010_0_ff,
+op_d018_0_ff,
+op_d020_0_ff,
+op_d028_0_ff,
+op_d030_3_ff,
+op_d038_0_ff,
+op_d039_0_ff,
+op_d03a_0_ff,
+op_d03b_3_ff,
+op_d03c_0_ff,
+op_d040_0_ff,
+op_d048_0_ff,
+op_d050_0_ff,
+op_d058_0_ff,
+op_d060_0_ff,
+op_d068_0_ff,
+op_d070_3_ff,
+op_d078_0_ff,
+op_d079_0_ff,
+op_d07a_0_ff,
+op_d07b_3_ff,
+op_d07c_0_ff,
+op_d080_0_ff,
+op_d088_0_ff,
+op_d090_0_ff,
+op_d098_0_ff,
+op_d0a0_0_ff,
+op_d0a8_0_ff,
+op_d0b0_3_ff,
+op_d0b8_0_ff,
+op_d0b9_0_ff,
+op_d0ba_0_ff,
+op_d0bb_3_ff,
+op_d0bc_0_ff,
+op_d0c0_0_ff,
+op_d0c8_0_ff,
+op_d0d0_0_ff,
+op_d0d8_0_ff,
+op_d0e0_0_ff,
+op_d0e8_0_ff,
+op_d0f0_3_ff,
+op_d0f8_0_ff,
+op_d0f9_0_ff,
+op_d0fa_0_ff,
+op_d0fb_3_ff,
+op_d0fc_0_ff,
+op_d100_0_ff,
+op_d108_0_ff,
+op_d110_0_ff,
+op_d118_0_ff,
+op_d120_0_ff,
+op_d128_0_ff,
+op_d130_3_ff,
+op_d138_0_ff,
+op_d139_0_ff,
+op_d140_0_ff,
+op_d148_0_ff,
+op_d150_0_ff,
+op_d158_0_ff,
+op_d160_0_ff,
+op_d168_0_ff,
+op_d170_3_ff,
+op_d178_0_ff,
+op_d179_0_ff,
+op_d180_0_ff,
+op_d188_0_ff,
+op_d190_0_ff,
+op_d198_0_ff,
+op_d1a0_0_ff,
+op_d1a8_0_ff,
+op_d1b0_3_ff,
+op_d1b8_0_ff,
+op_d1b9_0_ff,
+op_d1c0_0_ff,
+op_d1c8_0_ff,
+op_d1d0_0_ff,
+op_d1d8_0_ff,
+op_d1e0_0_ff,
+op_d1e8_0_ff,
+op_d1f0_3_ff,
+op_d1f8_0_ff,
+op_d1f9_0_ff,
+op_d1fa_0_ff,
+op_d1fb_3_ff,
+op_d1fc_0_ff,
+op_e000_0_ff,
+op_e008_0_ff,
+op_e010_0_ff,
+op_e018_0_ff,
+op_e020_0_ff,
+op_e028_0_ff,
+op_e030_0_ff,
+op_e038_0_ff,
+op_e040_0_ff,
+op_e048_0_ff,
+op_e050_0_ff,
+op_e058_0_ff,
+op_e060_0_ff,
+op_e068_0_ff,
+op_e070_0_ff,
+op_e078_0_ff,
+op_e080_0_ff,
+op_e088_0_ff,
+op_e090_0_ff,
+op_e098_0_ff,
+op_e0a0_0_ff,
+op_e0a8_0_ff,
+op_e0b0_0_ff,
+op_e0b8_0_ff,
+op_e0d0_0_ff,
+op_e0d8_0_ff,
+op_e0e0_0_ff,
+op_e0e8_0_ff,
+op_e0f0_3_ff,
+op_e0f8_0_ff,
+op_e0f9_0_ff,
+op_e100_0_ff,
+op_e108_0_ff,
+op_e110_0_ff,
+op_e118_0_ff,
+op_e120_0_ff,
+op_e128_0_ff,
+op_e130_0_ff,
+op_e138_0_ff,
+op_e140_0_ff,
+op_e148_0_ff,
+op_e150_0_ff,
+op_e158_0_ff,
+op_e160_0_ff,
+op_e168_0_ff,
+op_e170_0_ff,
+op_e178_0_ff,
+op_e180_0_ff,
+op_e188_0_ff,
+op_e190_0_ff,
+op_e198_0_ff,
+op_e1a0_0_ff,
+op_e1a8_0_ff,
+op_e1b0_0_ff,
+op_e1b8_0_ff,
+op_e1d0_0_ff,
+op_e1d8_0_ff,
+op_e1e0_0_ff,
+op_e1e8_0_ff,
+op_e1f0_3_ff,
+op_e1f8_0_ff,
+op_e1f9_0_ff,
+op_e2d0_0_ff,
+op_e2d8_0_ff,
+op_e2e0_0_ff,
+op_e2e8_0_ff,
+op_e2f0_3_ff,
+op_e2f8_0_ff,
+op_e2f9_0_ff,
+op_e3d0_0_ff,
+op_e3d8_0_ff,
+op_e3e0_0_ff,
+op_e3e8_0_ff,
+op_e3f0_3_ff,
+op_e3f8_0_ff,
+op_e3f9_0_ff,
+op_e4d0_0_ff,
+op_e4d8_0_ff,
+op_e4e0_0_ff,
+op_e4e8_0_ff,
+op_e4f0_3_ff,
+op_e4f8_0_ff,
+op_e4f9_0_ff,
+op_e5d0_0_ff,
+op_e5d8_0_ff,
+op_e5e0_0_ff,
+op_e5e8_0_ff,
+op_e5f0_3_ff,
+op_e5f8_0_ff,
+op_e5f9_0_ff,
+op_e6d0_0_ff,
+op_e6d8_0_ff,
+op_e6e0_0_ff,
+op_e6e8_0_ff,
+op_e6f0_3_ff,
+op_e6f8_0_ff,
+op_e6f9_0_ff,
+op_e7d0_0_ff,
+op_e7d8_0_ff,
+op_e7e0_0_ff,
+op_e7e8_0_ff,
+op_e7f0_3_ff,
+op_e7f8_0_ff,
+op_e7f9_0_ff,
+};
+static const uae_u16 op_dispatch_pages_3[] = {
+1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,6,7,8,0,0,9,0,0,0,
+10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,
+11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,
+13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,
+15,15,15,15,15,15,15,15,16,17,0,0,18,0,0,0,
+19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,
+20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,
+22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,
+24,24,24,24,24,24,24,24,25,26,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,
+29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,
+31,31,31,31,31,31,31,31,32,32,32,32,32,32,32,32,
+33,33,33,33,33,33,33,33,34,35,36,37,38,0,0,0,
+39,39,39,39,39,39,39,39,40,40,40,40,40,40,40,40,
+41,41,41,41,41,41,41,41,42,42,42,42,42,42,42,42,
+43,43,43,43,43,43,43,43,44,44,44,44,44,44,44,44,
+45,45,45,45,45,45,45,45,46,47,48,49,0,0,0,0,
+50,50,50,50,50,50,50,50,51,51,51,51,51,51,51,51,
+52,52,52,52,52,52,52,52,53,53,53,53,53,53,53,53,
+54,54,54,54,54,54,54,54,55,55,55,55,55,55,55,55,
+56,56,56,56,56,56,56,56,57,58,59,60,0,0,0,0,
+61,61,61,61,61,61,61,61,62,62,62,62,62,62,62,62,
+63,63,63,63,63,63,63,63,64,64,64,64,64,64,64,64,
+65,65,65,65,65,65,65,65,66,66,66,66,66,66,66,66,
+67,67,67,67,67,67,67,67,68,69,70,71,0,0,0,0,
+72,72,72,72,72,72,72,72,0,0,0,0,0,0,0,0,
+73,73,73,73,73,73,73,73,74,74,74,74,74,74,74,74,
+75,75,75,75,75,75,75,75,76,76,76,76,76,76,76,76,
+77,77,77,77,77,77,77,77,78,79,0,0,80,0,0,0,
+81,81,81,81,81,81,81,81,0,0,0,0,0,0,0,0,
+82,82,82,82,82,82,82,82,83,83,83,83,83,83,83,83,
+84,84,84,84,84,84,84,84,85,85,85,85,85,85,85,85,
+86,86,86,86,86,86,86,86,87,88,0,0,89,0,0,0,
+90,90,90,90,90,90,90,90,0,0,0,0,0,0,0,0,
+91,91,91,91,91,91,91,91,92,92,92,92,92,92,92,92,
+93,93,93,93,93,93,93,93,94,94,94,94,94,94,94,94,
+95,95,95,95,95,95,95,95,96,97,0,0,0,0,0,0,
+98,98,98,98,98,98,98,98,0,0,0,0,0,0,0,0,
+99,99,99,99,99,99,99,99,100,100,100,100,100,100,100,100,
+101,101,101,101,101,101,101,101,102,102,102,102,102,102,102,102,
+103,103,103,103,103,103,103,103,104,105,0,0,0,0,0,0,
+106,106,106,106,106,106,106,106,0,0,0,0,0,0,0,0,
+107,107,107,107,107,107,107,107,108,108,108,108,108,108,108,108,
+109,109,109,109,109,109,109,109,110,110,110,110,110,110,110,110,
+111,111,111,111,111,111,111,111,112,113,0,0,0,0,0,0,
+114,114,114,114,114,114,114,114,0,0,0,0,0,0,0,0,
+115,115,115,115,115,115,115,115,116,116,116,116,116,116,116,116,
+117,117,117,117,117,117,117,117,118,118,118,118,118,118,118,118,
+119,119,119,119,119,119,119,119,120,121,0,0,0,0,0,0,
+122,122,122,122,122,122,122,122,0,0,0,0,0,0,0,0,
+123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+125,125,125,125,125,125,125,125,126,126,126,126,126,126,126,126,
+127,127,127,127,127,127,127,127,128,129,0,0,0,0,0,0,
+130,130,130,130,130,130,130,130,0,0,0,0,0,0,0,0,
+131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+133,133,133,133,133,133,133,133,134,134,134,134,134,134,134,134,
+135,135,135,135,135,135,135,135,136,137,0,0,0,0,0,0,
+138,138,138,138,138,138,138,138,0,0,0,0,0,0,0,0,
+139,139,139,139,139,139,139,139,140,140,140,140,140,140,140,140,
+141,141,141,141,141,141,141,141,142,142,142,142,142,142,142,142,
+143,143,143,143,143,143,143,143,144,145,0,0,0,0,0,0,
+146,146,146,146,146,146,146,146,0,0,0,0,0,0,0,0,
+147,147,147,147,147,147,147,147,148,148,148,148,148,148,148,148,
+149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150,
+151,151,151,151,151,151,151,151,152,153,154,155,156,0,0,0,
+157,157,157,157,157,157,157,157,0,0,0,0,0,0,0,0,
+158,158,158,158,158,158,158,158,159,159,159,159,159,159,159,159,
+160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,161,
+162,162,162,162,162,162,162,162,163,164,165,166,0,0,0,0,
+167,167,167,167,167,167,167,167,0,0,0,0,0,0,0,0,
+168,168,168,168,168,168,168,168,169,169,169,169,169,169,169,169,
+170,170,170,170,170,170,170,170,171,171,171,171,171,171,171,171,
+172,172,172,172,172,172,172,172,173,174,175,176,0,0,0,0,
+177,177,177,177,177,177,177,177,0,0,0,0,0,0,0,0,
+178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,
+180,180,180,180,180,180,180,180,181,181,181,181,181,181,181,181,
+182,182,182,182,182,182,182,182,183,184,185,186,0,0,0,0,
+187,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,
+188,188,188,188,188,188,188,188,189,189,189,189,189,189,189,189,
+190,190,190,190,190,190,190,190,191,191,191,191,191,191,191,191,
+192,192,192,192,192,192,192,192,193,194,0,0,195,0,0,0,
+196,196,196,196,196,196,196,196,0,0,0,0,0,0,0,0,
+197,197,197,197,197,197,197,197,198,198,198,198,198,198,198,198,
+199,199,199,199,199,199,199,199,200,200,200,200,200,200,200,200,
+201,201,201,201,201,201,201,201,202,203,0,0,204,0,0,0,
+205,205,205,205,205,205,205,205,0,0,0,0,0,0,0,0,
+206,206,206,206,206,206,206,206,207,207,207,207,207,207,207,207,
+208,208,208,208,208,208,208,208,209,209,209,209,209,209,209,209,
+210,210,210,210,210,210,210,210,211,212,0,0,0,0,0,0,
+213,213,213,213,213,213,213,213,0,0,0,0,0,0,0,0,
+214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+216,216,216,216,216,216,216,216,217,217,217,217,217,217,217,217,
+218,218,218,218,218,218,218,218,219,220,221,222,0,0,0,0,
+223,223,223,223,223,223,223,223,0,0,0,0,0,0,0,0,
+224,224,224,224,224,224,224,224,225,225,225,225,225,225,225,225,
+226,226,226,226,226,226,226,226,227,227,227,227,227,227,227,227,
+228,228,228,228,228,228,228,228,229,230,231,232,0,0,0,0,
+233,233,233,233,233,233,233,233,0,0,0,0,0,0,0,0,
+234,234,234,234,234,234,234,234,235,235,235,235,235,235,235,235,
+236,236,236,236,236,236,236,236,237,237,237,237,237,237,237,237,
+238,238,238,238,238,238,238,238,239,240,241,242,0,0,0,0,
+243,243,243,243,243,243,243,243,0,0,0,0,0,0,0,0,
+244,244,244,244,244,244,244,244,245,245,245,245,245,245,245,245,
+246,246,246,246,246,246,246,246,247,247,247,247,247,247,247,247,
+248,248,248,248,248,248,248,248,249,250,251,252,253,0,0,0,
+254,254,254,254,254,254,254,254,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,256,256,256,256,256,256,256,256,
+257,257,257,257,257,257,257,257,258,258,258,258,258,258,258,258,
+259,259,259,259,259,259,259,259,260,261,262,263,264,0,0,0,
+265,265,265,265,265,265,265,265,0,0,0,0,0,0,0,0,
+266,266,266,266,266,266,266,266,267,267,267,267,267,267,267,267,
+268,268,268,268,268,268,268,268,269,269,269,269,269,269,269,269,
+270,270,270,270,270,270,270,270,271,272,273,274,275,0,0,0,
+276,276,276,276,276,276,276,276,0,0,0,0,0,0,0,0,
+277,277,277,277,277,277,277,277,278,278,278,278,278,278,278,278,
+279,279,279,279,279,279,279,279,280,280,280,280,280,280,280,280,
+281,281,281,281,281,281,281,281,282,283,284,285,286,0,0,0,
+287,287,287,287,287,287,287,287,0,0,0,0,0,0,0,0,
+288,288,288,288,288,288,288,288,289,289,289,289,289,289,289,289,
+290,290,290,290,290,290,290,290,291,291,291,291,291,291,291,291,
+292,292,292,292,292,292,292,292,293,294,295,296,297,0,0,0,
+298,298,298,298,298,298,298,298,0,0,0,0,0,0,0,0,
+299,299,299,299,299,299,299,299,300,300,300,300,300,300,300,300,
+301,301,301,301,301,301,301,301,302,302,302,302,302,302,302,302,
+303,303,303,303,303,303,303,303,304,305,306,307,308,0,0,0,
+309,309,309,309,309,309,309,309,0,0,0,0,0,0,0,0,
+310,310,310,310,310,310,310,310,311,311,311,311,311,311,311,311,
+312,312,312,312,312,312,312,312,313,313,313,313,313,313,313,313,
+314,314,314,314,314,314,314,314,315,316,317,318,319,0,0,0,
+320,320,320,320,320,320,320,320,0,0,0,0,0,0,0,0,
+321,321,321,321,321,321,321,321,322,322,322,322,322,322,322,322,
+323,323,323,323,323,323,323,323,324,324,324,324,324,324,324,324,
+325,325,325,325,325,325,325,325,326,327,328,329,330,0,0,0,
+331,331,331,331,331,331,331,331,332,332,332,332,332,332,332,332,
+333,333,333,333,333,333,333,333,334,334,334,334,334,334,334,334,
+335,335,335,335,335,335,335,335,336,336,336,336,336,336,336,336,
+337,337,337,337,337,337,337,337,338,339,340,341,342,0,0,0,
+343,343,343,343,343,343,343,343,344,344,344,344,344,344,344,344,
+345,345,345,345,345,345,345,345,346,346,346,346,346,346,346,346,
+347,347,347,347,347,347,347,347,348,348,348,348,348,348,348,348,
+349,349,349,349,349,349,349,349,350,351,352,353,354,0,0,0,
+355,355,355,355,355,355,355,355,356,356,356,356,356,356,356,356,
+357,357,357,357,357,357,357,357,358,358,358,358,358,358,358,358,
+359,359,359,359,359,359,359,359,360,360,360,360,360,360,360,360,
+361,361,361,361,361,361,361,361,362,363,364,365,366,0,0,0,
+367,367,367,367,367,367,367,367,368,368,368,368,368,368,368,368,
+369,369,369,369,369,369,369,369,370,370,370,370,370,370,370,370,
+371,371,371,371,371,371,371,371,372,372,372,372,372,372,372,372,
+373,373,373,373,373,373,373,373,374,375,376,377,378,0,0,0,
+379,379,379,379,379,379,379,379,380,380,380,380,380,380,380,380,
+381,381,381,381,381,381,381,381,382,382,382,382,382,382,382,382,
+383,383,383,383,383,383,383,383,384,384,384,384,384,384,384,384,
+385,385,385,385,385,385,385,385,386,387,388,389,390,0,0,0,
+391,391,391,391,391,391,391,391,392,392,392,392,392,392,392,392,
+393,393,393,393,393,393,393,393,394,394,394,394,394,394,394,394,
+395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,
+397,397,397,397,397,397,397,397,398,399,400,401,402,0,0,0,
+403,403,403,403,403,403,403,403,404,404,404,404,404,404,404,404,
+405,405,405,405,405,405,405,405,406,406,406,406,406,406,406,406,
+407,407,407,407,407,407,407,407,408,408,408,408,408,408,408,408,
+409,409,409,409,409,409,409,409,410,411,412,413,414,0,0,0,
+415,415,415,415,415,415,415,415,416,416,416,416,416,416,416,416,
+417,417,417,417,417,417,417,417,418,418,418,418,418,418,418,418,
+419,419,419,419,419,419,419,419,420,420,420,420,420,420,420,420,
+421,421,421,421,421,421,421,421,422,423,424,425,426,0,0,0,
+427,427,427,427,427,427,427,427,428,428,428,428,428,428,428,428,
+429,429,429,429,429,429,429,429,430,430,430,430,430,430,430,430,
+431,431,431,431,431,431,431,431,432,432,432,432,432,432,432,432,
+433,433,433,433,433,433,433,433,434,435,436,437,438,0,0,0,
+439,439,439,439,439,439,439,439,440,440,440,440,440,440,440,440,
+441,441,441,441,441,441,441,441,442,442,442,442,442,442,442,442,
+443,443,443,443,443,443,443,443,444,444,444,444,444,444,444,444,
+445,445,445,445,445,445,445,445,446,447,448,449,450,0,0,0,
+451,451,451,451,451,451,451,451,452,452,452,452,452,452,452,452,
+453,453,453,453,453,453,453,453,454,454,454,454,454,454,454,454,
+455,455,455,455,455,455,455,455,456,456,456,456,456,456,456,456,
+457,457,457,457,457,457,457,457,458,459,460,461,462,0,0,0,
+463,463,463,463,463,463,463,463,464,464,464,464,464,464,464,464,
+465,465,465,465,465,465,465,465,466,466,466,466,466,466,466,466,
+467,467,467,467,467,467,467,467,468,468,468,468,468,468,468,468,
+469,469,469,469,469,469,469,469,470,471,472,473,474,0,0,0,
+475,475,475,475,475,475,475,475,476,476,476,476,476,476,476,476,
+477,477,477,477,477,477,477,477,478,478,478,478,478,478,478,478,
+479,479,479,479,479,479,479,479,480,480,480,480,480,480,480,480,
+481,481,481,481,481,481,481,481,482,483,484,485,486,0,0,0,
+487,487,487,487,487,487,487,487,488,488,488,488,488,488,488,488,
+489,489,489,489,489,489,489,489,490,490,490,490,490,490,490,490,
+491,491,491,491,491,491,491,491,492,492,492,492,492,492,492,492,
+493,493,493,493,493,493,493,493,494,495,496,497,498,0,0,0,
+499,499,499,499,499,499,499,499,500,500,500,500,500,500,500,500,
+501,501,501,501,501,501,501,501,502,502,502,502,502,502,502,502,
+503,503,503,503,503,503,503,503,504,504,504,504,504,504,504,504,
+505,505,505,505,505,505,505,505,506,507,508,509,510,0,0,0,
+511,511,511,511,511,511,511,511,512,512,512,512,512,512,512,512,
+513,513,513,513,513,513,513,513,514,514,514,514,514,514,514,514,
+515,515,515,515,515,515,515,515,516,516,516,516,516,516,516,516,
+517,517,517,517,517,517,517,517,518,519,520,521,522,0,0,0,
+523,523,523,523,523,523,523,523,524,524,524,524,524,524,524,524,
+525,525,525,525,525,525,525,525,526,526,526,526,526,526,526,526,
+527,527,527,527,527,527,527,527,528,528,528,528,528,528,528,528,
+529,529,529,529,529,529,529,529,530,531,532,533,534,0,0,0,
+535,535,535,535,535,535,535,535,536,536,536,536,536,536,536,536,
+537,537,537,537,537,537,537,537,538,538,538,538,538,538,538,538,
+539,539,539,539,539,539,539,539,540,540,540,540,540,540,540,540,
+541,541,541,541,541,541,541,541,542,543,544,545,546,0,0,0,
+547,547,547,547,547,547,547,547,0,0,0,0,0,0,0,0,
+548,548,548,548,548,548,548,548,549,549,549,549,549,549,549,549,
+550,550,550,550,550,550,550,550,551,551,551,551,551,551,551,551,
+552,552,552,552,552,552,552,552,553,554,0,0,0,0,0,0,
+555,555,555,555,555,555,555,555,0,0,0,0,0,0,0,0,
+556,556,556,556,556,556,556,556,557,557,557,557,557,557,557,557,
+558,558,558,558,558,558,558,558,559,559,559,559,559,559,559,559,
+560,560,560,560,560,560,560,560,561,562,0,0,0,0,0,0,
+563,563,563,563,563,563,563,563,0,0,0,0,0,0,0,0,
+564,564,564,564,564,564,564,564,565,565,565,565,565,565,565,565,
+566,566,566,566,566,566,566,566,567,567,567,567,567,567,567,567,
+568,568,568,568,568,568,568,568,569,570,0,0,0,0,0,0,
+571,571,571,571,571,571,571,571,0,0,0,0,0,0,0,0,
+572,572,572,572,572,572,572,572,573,573,573,573,573,573,573,573,
+574,574,574,574,574,574,574,574,575,575,575,575,575,575,575,575,
+576,576,576,576,576,576,576,576,577,578,0,0,0,0,0,0,
+579,579,579,579,579,579,579,579,0,0,0,0,0,0,0,0,
+580,580,580,580,580,580,580,580,581,581,581,581,581,581,581,581,
+582,582,582,582,582,582,582,582,583,583,583,583,583,583,583,583,
+584,584,584,584,584,584,584,584,585,586,587,588,589,0,0,0,
+590,590,590,590,590,590,590,590,0,0,0,0,0,0,0,0,
+591,591,591,591,591,591,591,591,592,592,592,592,592,592,592,592,
+593,593,593,593,593,593,593,593,594,594,594,594,594,594,594,594,
+595,595,595,595,595,595,595,595,596,597,598,599,600,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+601,601,601,601,601,601,601,601,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,0,0,0,0,
+608,608,608,608,608,608,608,608,0,0,0,0,0,0,0,0,
+609,609,609,609,609,609,609,609,610,610,610,610,610,610,610,610,
+611,611,611,611,611,611,611,611,612,612,612,612,612,612,612,612,
+613,613,613,613,613,613,613,613,614,615,0,0,0,0,0,0,
+616,616,616,616,616,616,616,616,0,0,0,0,0,0,0,0,
+617,617,617,617,617,617,617,617,618,618,618,618,618,618,618,618,
+619,619,619,619,619,619,619,619,620,620,620,620,620,620,620,620,
+621,621,621,621,621,621,621,621,622,623,0,0,0,0,0,0,
+624,624,624,624,624,624,624,624,0,0,0,0,0,0,0,0,
+625,625,625,625,625,625,625,625,626,626,626,626,626,626,626,626,
+627,627,627,627,627,627,627,627,628,628,628,628,628,628,628,628,
+629,629,629,629,629,629,629,629,630,631,0,0,0,0,0,0,
+632,632,632,632,632,632,632,632,0,0,0,0,0,0,0,0,
+633,633,633,633,633,633,633,633,634,634,634,634,634,634,634,634,
+635,635,635,635,635,635,635,635,636,636,636,636,636,636,636,636,
+637,637,637,637,637,637,637,637,638,639,0,0,0,0,0,0,
+640,640,640,640,640,640,640,640,0,0,0,0,0,0,0,0,
+641,641,641,641,641,641,641,641,642,642,642,642,642,642,642,642,
+643,643,643,643,643,643,643,643,644,644,644,644,644,644,644,644,
+645,645,645,645,645,645,645,645,646,647,0,0,0,0,0,0,
+648,648,648,648,648,648,648,648,0,0,0,0,0,0,0,0,
+649,649,649,649,649,649,649,649,650,650,650,650,650,650,650,650,
+651,651,651,651,651,651,651,651,652,652,652,652,652,652,652,652,
+653,653,653,653,653,653,653,653,654,655,0,0,0,0,0,0,
+656,656,656,656,656,656,656,656,0,0,0,0,0,0,0,0,
+657,657,657,657,657,657,657,657,658,658,658,658,658,658,658,658,
+659,659,659,659,659,659,659,659,660,660,660,660,660,660,660,660,
+661,661,661,661,661,661,661,661,662,663,0,0,0,0,0,0,
+664,664,664,664,664,664,664,664,0,0,0,0,0,0,0,0,
+665,665,665,665,665,665,665,665,666,666,666,666,666,666,666,666,
+667,667,667,667,667,667,667,667,668,668,668,668,668,668,668,668,
+669,669,669,669,669,669,669,669,670,671,672,673,674,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+676,676,676,676,676,676,676,676,677,677,677,677,677,677,677,677,
+678,678,678,678,678,678,678,678,679,679,679,679,679,679,679,679,
+680,680,680,680,680,680,680,680,681,682,0,0,0,0,0,0,
+683,683,683,683,683,683,683,683,0,0,0,0,0,0,0,0,
+684,684,684,684,684,684,684,684,685,685,685,685,685,685,685,685,
+686,686,686,686,686,686,686,686,687,687,687,687,687,687,687,687,
+688,688,688,688,688,688,688,688,689,690,0,0,0,0,0,0,
+691,691,691,691,691,691,691,691,0,0,0,0,0,0,0,0,
+692,692,692,692,692,692,692,692,693,693,693,693,693,693,693,693,
+694,694,694,694,694,694,694,694,695,695,695,695,695,695,695,695,
+696,696,696,696,696,696,696,696,697,698,0,0,0,0,0,0,
+699,699,699,699,699,699,699,699,0,0,0,0,0,0,0,0,
+700,700,700,700,700,700,700,700,701,701,701,701,701,701,701,701,
+702,702,702,702,702,702,702,702,703,703,703,703,703,703,703,703,
+704,704,704,704,704,704,704,704,705,706,707,708,709,0,0,0,
+710,710,710,710,710,710,710,710,0,0,0,0,0,0,0,0,
+711,711,711,711,711,711,711,711,712,712,712,712,712,712,712,712,
+713,713,713,713,713,713,713,713,714,714,714,714,714,714,714,714,
+715,715,715,715,715,715,715,715,716,717,0,0,0,0,0,0,
+718,718,718,718,718,718,718,718,0,0,0,0,0,0,0,0,
+719,719,719,719,719,719,719,719,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,720,720,720,720,720,720,720,720,
+721,721,721,721,721,721,721,721,722,723,724,725,0,0,0,0,
+726,726,726,726,726,726,726,726,0,0,0,0,0,0,0,0,
+727,727,727,727,727,727,727,727,0,0,0,0,0,0,0,0,
+728,728,728,728,728,728,728,728,729,729,729,729,729,729,729,729,
+730,730,730,730,730,730,730,730,731,732,0,0,0,0,0,0,
+733,733,733,733,733,733,733,733,0,0,0,0,0,0,0,0,
+734,734,734,734,734,734,734,734,0,0,0,0,0,0,0,0,
+735,735,735,735,735,735,735,735,736,736,736,736,736,736,736,736,
+737,737,737,737,737,737,737,737,738,739,0,0,0,0,0,0,
+740,740,740,740,740,740,740,740,0,0,0,0,0,0,0,0,
+601,601,601,601,601,601,601,601,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,0,0,0,0,
+741,741,741,741,741,741,741,741,0,0,0,0,0,0,0,0,
+742,742,742,742,742,742,742,742,743,743,743,743,743,743,743,743,
+744,744,744,744,744,744,744,744,745,745,745,745,745,745,745,745,
+746,746,746,746,746,746,746,746,747,748,749,750,751,0,0,0,
+752,752,752,752,752,752,752,752,753,753,753,753,753,753,753,753,
+754,754,754,754,754,754,754,754,755,755,755,755,755,755,755,755,
+756,756,756,756,756,756,756,756,757,757,757,757,757,757,757,757,
+758,758,758,758,758,758,758,758,759,760,761,762,763,0,0,0,
+764,764,764,764,764,764,764,764,765,765,765,765,765,765,765,765,
+766,766,766,766,766,766,766,766,767,767,767,767,767,767,767,767,
+768,768,768,768,768,768,768,768,769,769,769,769,769,769,769,769,
+770,770,770,770,770,770,770,770,771,772,773,774,775,0,0,0,
+776,776,776,776,776,776,776,776,0,0,0,0,0,0,0,0,
+777,777,777,777,777,777,777,777,778,778,778,778,778,778,778,778,
+779,779,779,779,779,779,779,779,780,780,780,780,780,780,780,780,
+781,781,781,781,781,781,781,781,782,783,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+784,784,784,784,784,784,784,784,785,785,785,785,785,785,785,785,
+0,0,0,0,0,0,0,0,786,786,786,786,786,786,786,786,
+787,787,787,787,787,787,787,787,788,789,790,791,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+792,792,792,792,792,792,792,792,793,793,793,793,793,793,793,793,
+0,0,0,0,0,0,0,0,794,794,794,794,794,794,794,794,
+795,795,795,795,795,795,795,795,796,797,798,799,0,0,0,0,
+800,800,800,800,800,800,800,800,800,800,800,800,800,800,800,800,
+801,801,801,801,801,801,801,801,802,802,802,802,802,802,802,802,
+803,803,803,803,803,803,803,803,804,804,804,804,804,804,804,804,
+805,806,807,808,809,810,811,812,0,0,813,814,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+815,815,815,815,815,815,815,815,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,816,816,816,816,816,816,816,816,
+817,817,817,817,817,817,817,817,818,819,820,821,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+822,822,822,822,822,822,822,822,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,823,823,823,823,823,823,823,823,
+824,824,824,824,824,824,824,824,825,826,827,828,0,0,0,0,
+829,829,829,829,829,829,829,829,0,0,0,0,0,0,0,0,
+830,830,830,830,830,830,830,830,831,831,831,831,831,831,831,831,
+832,832,832,832,832,832,832,832,833,833,833,833,833,833,833,833,
+834,834,834,834,834,834,834,834,835,836,0,0,0,0,0,0,
+837,837,837,837,837,837,837,837,838,838,838,838,838,838,838,838,
+839,839,839,839,839,839,839,839,840,840,840,840,840,840,840,840,
+841,841,841,841,841,841,841,841,842,842,842,842,842,842,842,842,
+843,843,843,843,843,843,843,843,844,845,0,0,0,0,0,0,
+846,846,846,846,846,846,846,846,847,847,847,847,847,847,847,847,
+848,848,848,848,848,848,848,848,849,849,849,849,849,849,849,849,
+850,850,850,850,850,850,850,850,851,851,851,851,851,851,851,851,
+852,852,852,852,852,852,852,852,853,854,0,0,0,0,0,0,
+855,855,855,855,855,855,855,855,856,856,856,856,856,856,856,856,
+857,857,857,857,857,857,857,857,858,858,858,858,858,858,858,858,
+859,859,859,859,859,859,859,859,860,860,860,860,860,860,860,860,
+861,861,861,861,861,861,861,861,862,863,0,0,0,0,0,0,
+864,864,864,864,864,864,864,864,0,0,0,0,0,0,0,0,
+865,865,865,865,865,865,865,865,866,866,866,866,866,866,866,866,
+867,867,867,867,867,867,867,867,868,868,868,868,868,868,868,868,
+869,869,869,869,869,869,869,869,870,871,0,0,0,0,0,0,
+872,872,872,872,872,872,872,872,873,873,873,873,873,873,873,873,
+874,874,874,874,874,874,874,874,875,875,875,875,875,875,875,875,
+876,876,876,876,876,876,876,876,877,877,877,877,877,877,877,877,
+878,878,878,878,878,878,878,878,879,880,0,0,0,0,0,0,
+881,881,881,881,881,881,881,881,882,882,882,882,882,882,882,882,
+883,883,883,883,883,883,883,883,884,884,884,884,884,884,884,884,
+885,885,885,885,885,885,885,885,886,886,886,886,886,886,886,886,
+887,887,887,887,887,887,887,887,888,889,0,0,0,0,0,0,
+890,890,890,890,890,890,890,890,891,891,891,891,891,891,891,891,
+892,892,892,892,892,892,892,892,893,893,893,893,893,893,893,893,
+894,894,894,894,894,894,894,894,895,895,895,895,895,895,895,895,
+896,896,896,896,896,896,896,896,897,898,0,0,0,0,0,0,
+899,899,899,899,899,899,899,899,900,900,900,900,900,900,900,900,
+901,901,901,901,901,901,901,901,902,902,902,902,902,902,902,902,
+903,903,903,903,903,903,903,903,904,904,904,904,904,904,904,904,
+905,905,905,905,905,905,905,905,906,907,0,0,0,0,0,0,
+908,908,908,908,908,908,908,908,909,909,909,909,909,909,909,909,
+910,910,910,910,910,910,910,910,911,911,911,911,911,911,911,911,
+912,912,912,912,912,912,912,912,913,913,913,913,913,913,913,913,
+914,914,914,914,914,914,914,914,915,916,0,0,0,0,0,0,
+917,917,917,917,917,917,917,917,918,918,918,918,918,918,918,918,
+919,919,919,919,919,919,919,919,920,920,920,920,920,920,920,920,
+921,921,921,921,921,921,921,921,922,922,922,922,922,922,922,922,
+923,923,923,923,923,923,923,923,924,925,0,0,0,0,0,0,
+926,926,926,926,926,926,926,926,927,927,927,927,927,927,927,927,
+928,928,928,928,928,928,928,928,929,929,929,929,929,929,929,929,
+930,930,930,930,930,930,930,930,931,931,931,931,931,931,931,931,
+932,932,932,932,932,932,932,932,933,934,0,0,0,0,0,0,
+935,935,935,935,935,935,935,935,936,936,936,936,936,936,936,936,
+937,937,937,937,937,937,937,937,938,938,938,938,938,938,938,938,
+939,939,939,939,939,939,939,939,940,940,940,940,940,940,940,940,
+941,941,941,941,941,941,941,941,942,943,0,0,0,0,0,0,
+944,944,944,944,944,944,944,944,945,945,945,945,945,945,945,945,
+946,946,946,946,946,946,946,946,947,947,947,947,947,947,947,947,
+948,948,948,948,948,948,948,948,949,949,949,949,949,949,949,949,
+950,950,950,950,950,950,950,950,951,952,0,0,0,0,0,0,
+953,953,953,953,953,953,953,953,954,954,954,954,954,954,954,954,
+955,955,955,955,955,955,955,955,956,956,956,956,956,956,956,956,
+957,957,957,957,957,957,957,957,958,958,958,958,958,958,958,958,
+959,959,959,959,959,959,959,959,960,961,0,0,0,0,0,0,
+962,962,962,962,962,962,962,962,963,963,963,963,963,963,963,963,
+964,964,964,964,964,964,964,964,965,965,965,965,965,965,965,965,
+966,966,966,966,966,966,966,966,967,967,967,967,967,967,967,967,
+968,968,968,968,968,968,968,968,969,970,0,0,0,0,0,0,
+971,971,971,971,971,971,971,971,972,972,972,972,972,972,972,972,
+973,973,973,973,973,973,973,973,974,974,974,974,974,974,974,974,
+975,975,975,975,975,975,975,975,976,976,976,976,976,976,976,976,
+977,977,977,977,977,977,977,977,978,979,0,0,0,0,0,0,
+980,980,980,980,980,980,980,980,981,981,981,981,981,981,981,981,
+982,982,982,982,982,982,982,982,983,983,983,983,983,983,983,983,
+984,984,984,984,984,984,984,984,985,985,985,985,985,985,985,985,
+986,986,986,986,986,986,986,986,987,988,0,0,0,0,0,0,
+989,989,989,989,989,989,989,989,990,990,990,990,990,990,990,990,
+991,991,991,991,991,991,991,991,992,992,992,992,992,992,992,992,
+993,993,993,993,993,993,993,993,994,994,994,994,994,994,994,994,
+995,995,995,995,995,995,995,995,996,997,0,0,0,0,0,0,
+998,998,998,998,998,998,998,998,999,999,999,999,999,999,999,999,
+1000,1000,1000,1000,1000,1000,1000,1000,1001,1001,1001,1001,1001,1001,1001,1001,
+1002,1002,1002,1002,1002,1002,1002,1002,1003,1003,1003,1003,1003,1003,1003,1003,
+1004,1004,1004,1004,1004,1004,1004,1004,1005,1006,0,0,0,0,0,0,
+1007,1007,1007,1007,1007,1007,1007,1007,1008,1008,1008,1008,1008,1008,1008,1008,
+1009,1009,1009,1009,1009,1009,1009,1009,1010,1010,1010,1010,1010,1010,1010,1010,
+1011,1011,1011,1011,1011,1011,1011,1011,1012,1012,1012,1012,1012,1012,1012,1012,
+1013,1013,1013,1013,1013,1013,1013,1013,1014,1015,0,0,0,0,0,0,
+1016,1016,1016,1016,1016,1016,1016,1016,1017,1017,1017,1017,1017,1017,1017,1017,
+1018,1018,1018,1018,1018,1018,1018,1018,1019,1019,1019,1019,1019,1019,1019,1019,
+1020,1020,1020,1020,1020,1020,1020,1020,1021,1021,1021,1021,1021,1021,1021,1021,
+1022,1022,1022,1022,1022,1022,1022,1022,1023,1024,0,0,0,0,0,0,
+1025,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,
+1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1026,1027,
+1028,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,
+1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1030,
+1031,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,
+1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1032,1033,
+1034,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,1036,
+1037,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,
+1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1039,
+1040,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1042,
+1043,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,
+1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1044,1045,
+1046,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,
+1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1047,1048,
+1049,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,
+1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1050,1051,
+1052,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,
+1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1053,1054,
+1055,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,
+1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1056,1057,
+1058,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,
+1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1059,1060,
+1061,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1062,1063,
+1064,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1066,
+1067,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1069,
+1070,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,
+1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1071,1072,
+1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,
+1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,
+1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,
+1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,1073,
+1074,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,1075,
+1076,1076,1076,1076,1076,1076,1076,1076,0,0,0,0,0,0,0,0,
+1077,1077,1077,1077,1077,1077,1077,1077,1078,1078,1078,1078,1078,1078,1078,1078,
+1079,1079,1079,1079,1079,1079,1079,1079,1080,1080,1080,1080,1080,1080,1080,1080,
+1081,1081,1081,1081,1081,1081,1081,1081,1082,1083,1084,1085,1086,0,0,0,
+1087,1087,1087,1087,1087,1087,1087,1087,0,0,0,0,0,0,0,0,
+1088,1088,1088,1088,1088,1088,1088,1088,1089,1089,1089,1089,1089,1089,1089,1089,
+1090,1090,1090,1090,1090,1090,1090,1090,1091,1091,1091,1091,1091,1091,1091,1091,
+1092,1092,1092,1092,1092,1092,1092,1092,1093,1094,1095,1096,1097,0,0,0,
+1098,1098,1098,1098,1098,1098,1098,1098,0,0,0,0,0,0,0,0,
+1099,1099,1099,1099,1099,1099,1099,1099,1100,1100,1100,1100,1100,1100,1100,1100,
+1101,1101,1101,1101,1101,1101,1101,1101,1102,1102,1102,1102,1102,1102,1102,1102,
+1103,1103,1103,1103,1103,1103,1103,1103,1104,1105,1106,1107,1108,0,0,0,
+1109,1109,1109,1109,1109,1109,1109,1109,0,0,0,0,0,0,0,0,
+1110,1110,1110,1110,1110,1110,1110,1110,1111,1111,1111,1111,1111,1111,1111,1111,
+1112,1112,1112,1112,1112,1112,1112,1112,1113,1113,1113,1113,1113,1113,1113,1113,
+1114,1114,1114,1114,1114,1114,1114,1114,1115,1116,1117,1118,1119,0,0,0,
+1120,1120,1120,1120,1120,1120,1120,1120,1121,1121,1121,1121,1121,1121,1121,1121,
+1122,1122,1122,1122,1122,1122,1122,1122,1123,1123,1123,1123,1123,1123,1123,1123,
+1124,1124,1124,1124,1124,1124,1124,1124,1125,1125,1125,1125,1125,1125,1125,1125,
+1126,1126,1126,1126,1126,1126,1126,1126,1127,1128,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1129,1129,1129,1129,1129,1129,1129,1129,1130,1130,1130,1130,1130,1130,1130,1130,
+1131,1131,1131,1131,1131,1131,1131,1131,1132,1132,1132,1132,1132,1132,1132,1132,
+1133,1133,1133,1133,1133,1133,1133,1133,1134,1135,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1136,1136,1136,1136,1136,1136,1136,1136,1137,1137,1137,1137,1137,1137,1137,1137,
+1138,1138,1138,1138,1138,1138,1138,1138,1139,1139,1139,1139,1139,1139,1139,1139,
+1140,1140,1140,1140,1140,1140,1140,1140,1141,1142,0,0,0,0,0,0,
+1143,1143,1143,1143,1143,1143,1143,1143,0,0,0,0,0,0,0,0,
+1144,1144,1144,1144,1144,1144,1144,1144,1145,1145,1145,1145,1145,1145,1145,1145,
+1146,1146,1146,1146,1146,1146,1146,1146,1147,1147,1147,1147,1147,1147,1147,1147,
+1148,1148,1148,1148,1148,1148,1148,1148,1149,1150,1151,1152,1153,0,0,0,
+1154,1154,1154,1154,1154,1154,1154,1154,0,0,0,0,0,0,0,0,
+1155,1155,1155,1155,1155,1155,1155,1155,1156,1156,1156,1156,1156,1156,1156,1156,
+1157,1157,1157,1157,1157,1157,1157,1157,1158,1158,1158,1158,1158,1158,1158,1158,
+1159,1159,1159,1159,1159,1159,1159,1159,1160,1161,1162,1163,1164,0,0,0,
+1165,1165,1165,1165,1165,1165,1165,1165,1166,1166,1166,1166,1166,1166,1166,1166,
+1167,1167,1167,1167,1167,1167,1167,1167,1168,1168,1168,1168,1168,1168,1168,1168,
+1169,1169,1169,1169,1169,1169,1169,1169,1170,1170,1170,1170,1170,1170,1170,1170,
+1171,1171,1171,1171,1171,1171,1171,1171,1172,1173,1174,1175,1176,0,0,0,
+1177,1177,1177,1177,1177,1177,1177,1177,1178,1178,1178,1178,1178,1178,1178,1178,
+1179,1179,1179,1179,1179,1179,1179,1179,1180,1180,1180,1180,1180,1180,1180,1180,
+1181,1181,1181,1181,1181,1181,1181,1181,1182,1182,1182,1182,1182,1182,1182,1182,
+1183,1183,1183,1183,1183,1183,1183,1183,1184,1185,1186,1187,1188,0,0,0,
+1189,1189,1189,1189,1189,1189,1189,1189,1190,1190,1190,1190,1190,1190,1190,1190,
+1191,1191,1191,1191,1191,1191,1191,1191,1192,1192,1192,1192,1192,1192,1192,1192,
+1193,1193,1193,1193,1193,1193,1193,1193,1194,1194,1194,1194,1194,1194,1194,1194,
+1195,1195,1195,1195,1195,1195,1195,1195,1196,1197,1198,1199,1200,0,0,0,
+1201,1201,1201,1201,1201,1201,1201,1201,1202,1202,1202,1202,1202,1202,1202,1202,
+1203,1203,1203,1203,1203,1203,1203,1203,1204,1204,1204,1204,1204,1204,1204,1204,
+1205,1205,1205,1205,1205,1205,1205,1205,1206,1206,1206,1206,1206,1206,1206,1206,
+1207,1207,1207,1207,1207,1207,1207,1207,1208,1209,0,0,0,0,0,0,
+1210,1210,1210,1210,1210,1210,1210,1210,1211,1211,1211,1211,1211,1211,1211,1211,
+1212,1212,1212,1212,1212,1212,1212,1212,1213,1213,1213,1213,1213,1213,1213,1213,
+1214,1214,1214,1214,1214,1214,1214,1214,1215,1215,1215,1215,1215,1215,1215,1215,
+1216,1216,1216,1216,1216,1216,1216,1216,1217,1218,0,0,0,0,0,0,
+1219,1219,1219,1219,1219,1219,1219,1219,1220,1220,1220,1220,1220,1220,1220,1220,
+1221,1221,1221,1221,1221,1221,1221,1221,1222,1222,1222,1222,1222,1222,1222,1222,
+1223,1223,1223,1223,1223,1223,1223,1223,1224,1224,1224,1224,1224,1224,1224,1224,
+1225,1225,1225,1225,1225,1225,1225,1225,1226,1227,0,0,0,0,0,0,
+1228,1228,1228,1228,1228,1228,1228,1228,1229,1229,1229,1229,1229,1229,1229,1229,
+1230,1230,1230,1230,1230,1230,1230,1230,1231,1231,1231,1231,1231,1231,1231,1231,
+1232,1232,1232,1232,1232,1232,1232,1232,1233,1233,1233,1233,1233,1233,1233,1233,
+1234,1234,1234,1234,1234,1234,1234,1234,1235,1236,1237,1238,1239,0,0,0,
+1240,1240,1240,1240,1240,1240,1240,1240,0,0,0,0,0,0,0,0,
+1241,1241,1241,1241,1241,1241,1241,1241,1242,1242,1242,1242,1242,1242,1242,1242,
+1243,1243,1243,1243,1243,1243,1243,1243,1244,1244,1244,1244,1244,1244,1244,1244,
+1245,1245,1245,1245,1245,1245,1245,1245,1246,1247,1248,1249,1250,0,0,0,
+1251,1251,1251,1251,1251,1251,1251,1251,1252,1252,1252,1252,1252,1252,1252,1252,
+1253,1253,1253,1253,1253,1253,1253,1253,1254,1254,1254,1254,1254,1254,1254,1254,
+1255,1255,1255,1255,1255,1255,1255,1255,1256,1256,1256,1256,1256,1256,1256,1256,
+1257,1257,1257,1257,1257,1257,1257,1257,1258,1259,1260,1261,1262,0,0,0,
+1263,1263,1263,1263,1263,1263,1263,1263,1264,1264,1264,1264,1264,1264,1264,1264,
+1265,1265,1265,1265,1265,1265,1265,1265,1266,1266,1266,1266,1266,1266,1266,1266,
+1267,1267,1267,1267,1267,1267,1267,1267,1268,1268,1268,1268,1268,1268,1268,1268,
+1269,1269,1269,1269,1269,1269,1269,1269,1270,1271,1272,1273,1274,0,0,0,
+1275,1275,1275,1275,1275,1275,1275,1275,1276,1276,1276,1276,1276,1276,1276,1276,
+1277,1277,1277,1277,1277,1277,1277,1277,1278,1278,1278,1278,1278,1278,1278,1278,
+1279,1279,1279,1279,1279,1279,1279,1279,1280,1280,1280,1280,1280,1280,1280,1280,
+1281,1281,1281,1281,1281,1281,1281,1281,1282,1283,1284,1285,1286,0,0,0,
+1287,1287,1287,1287,1287,1287,1287,1287,1288,1288,1288,1288,1288,1288,1288,1288,
+1289,1289,1289,1289,1289,1289,1289,1289,1290,1290,1290,1290,1290,1290,1290,1290,
+1291,1291,1291,1291,1291,1291,1291,1291,1292,1292,1292,1292,1292,1292,1292,1292,
+1293,1293,1293,1293,1293,1293,1293,1293,1294,1295,0,0,0,0,0,0,
+1296,1296,1296,1296,1296,1296,1296,1296,1297,1297,1297,1297,1297,1297,1297,1297,
+1298,1298,1298,1298,1298,1298,1298,1298,1299,1299,1299,1299,1299,1299,1299,1299,
+1300,1300,1300,1300,1300,1300,1300,1300,1301,1301,1301,1301,1301,1301,1301,1301,
+1302,1302,1302,1302,1302,1302,1302,1302,1303,1304,0,0,0,0,0,0,
+1305,1305,1305,1305,1305,1305,1305,1305,1306,1306,1306,1306,1306,1306,1306,1306,
+1307,1307,1307,1307,1307,1307,1307,1307,1308,1308,1308,1308,1308,1308,1308,1308,
+1309,1309,1309,1309,1309,1309,1309,1309,1310,1310,1310,1310,1310,1310,1310,1310,
+1311,1311,1311,1311,1311,1311,1311,1311,1312,1313,0,0,0,0,0,0,
+1314,1314,1314,1314,1314,1314,1314,1314,1315,1315,1315,1315,1315,1315,1315,1315,
+1316,1316,1316,1316,1316,1316,1316,1316,1317,1317,1317,1317,1317,1317,1317,1317,
+1318,1318,1318,1318,1318,1318,1318,1318,1319,1319,1319,1319,1319,1319,1319,1319,
+1320,1320,1320,1320,1320,1320,1320,1320,1321,1322,1323,1324,1325,0,0,0,
+1326,1326,1326,1326,1326,1326,1326,1326,0,0,0,0,0,0,0,0,
+1327,1327,1327,1327,1327,1327,1327,1327,1328,1328,1328,1328,1328,1328,1328,1328,
+1329,1329,1329,1329,1329,1329,1329,1329,1330,1330,1330,1330,1330,1330,1330,1330,
+1331,1331,1331,1331,1331,1331,1331,1331,1332,1333,1334,1335,1336,0,0,0,
+1337,1337,1337,1337,1337,1337,1337,1337,0,0,0,0,0,0,0,0,
+1338,1338,1338,1338,1338,1338,1338,1338,1339,1339,1339,1339,1339,1339,1339,1339,
+1340,1340,1340,1340,1340,1340,1340,1340,1341,1341,1341,1341,1341,1341,1341,1341,
+1342,1342,1342,1342,1342,1342,1342,1342,1343,1344,1345,1346,1347,0,0,0,
+1348,1348,1348,1348,1348,1348,1348,1348,0,0,0,0,0,0,0,0,
+1349,1349,1349,1349,1349,1349,1349,1349,1350,1350,1350,1350,1350,1350,1350,1350,
+1351,1351,1351,1351,1351,1351,1351,1351,1352,1352,1352,1352,1352,1352,1352,1352,
+1353,1353,1353,1353,1353,1353,1353,1353,1354,1355,1356,1357,1358,0,0,0,
+1359,1359,1359,1359,1359,1359,1359,1359,0,0,0,0,0,0,0,0,
+1360,1360,1360,1360,1360,1360,1360,1360,1361,1361,1361,1361,1361,1361,1361,1361,
+1362,1362,1362,1362,1362,1362,1362,1362,1363,1363,1363,1363,1363,1363,1363,1363,
+1364,1364,1364,1364,1364,1364,1364,1364,1365,1366,1367,1368,1369,0,0,0,
+1370,1370,1370,1370,1370,1370,1370,1370,1371,1371,1371,1371,1371,1371,1371,1371,
+1372,1372,1372,1372,1372,1372,1372,1372,1373,1373,1373,1373,1373,1373,1373,1373,
+1374,1374,1374,1374,1374,1374,1374,1374,1375,1375,1375,1375,1375,1375,1375,1375,
+1376,1376,1376,1376,1376,1376,1376,1376,1377,1378,0,0,0,0,0,0,
+1379,1379,1379,1379,1379,1379,1379,1379,1380,1380,1380,1380,1380,1380,1380,1380,
+1381,1381,1381,1381,1381,1381,1381,1381,1382,1382,1382,1382,1382,1382,1382,1382,
+1383,1383,1383,1383,1383,1383,1383,1383,1384,1384,1384,1384,1384,1384,1384,1384,
+1385,1385,1385,1385,1385,1385,1385,1385,1386,1387,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1388,1388,1388,1388,1388,1388,1388,1388,
+1389,1389,1389,1389,1389,1389,1389,1389,1390,1390,1390,1390,1390,1390,1390,1390,
+1391,1391,1391,1391,1391,1391,1391,1391,1392,1392,1392,1392,1392,1392,1392,1392,
+1393,1393,1393,1393,1393,1393,1393,1393,1394,1395,0,0,0,0,0,0,
+1396,1396,1396,1396,1396,1396,1396,1396,0,0,0,0,0,0,0,0,
+1397,1397,1397,1397,1397,1397,1397,1397,1398,1398,1398,1398,1398,1398,1398,1398,
+1399,1399,1399,1399,1399,1399,1399,1399,1400,1400,1400,1400,1400,1400,1400,1400,
+1401,1401,1401,1401,1401,1401,1401,1401,1402,1403,1404,1405,1406,0,0,0,
+1407,1407,1407,1407,1407,1407,1407,1407,0,0,0,0,0,0,0,0,
+1408,1408,1408,1408,1408,1408,1408,1408,1409,1409,1409,1409,1409,1409,1409,1409,
+1410,1410,1410,1410,1410,1410,1410,1410,1411,1411,1411,1411,1411,1411,1411,1411,
+1412,1412,1412,1412,1412,1412,1412,1412,1413,1414,1415,1416,1417,0,0,0,
+1418,1418,1418,1418,1418,1418,1418,1418,1419,1419,1419,1419,1419,1419,1419,1419,
+1420,1420,1420,1420,1420,1420,1420,1420,1421,1421,1421,1421,1421,1421,1421,1421,
+1422,1422,1422,1422,1422,1422,1422,1422,1423,1423,1423,1423,1423,1423,1423,1423,
+1424,1424,1424,1424,1424,1424,1424,1424,1425,1426,1427,1428,1429,0,0,0,
+1430,1430,1430,1430,1430,1430,1430,1430,1431,1431,1431,1431,1431,1431,1431,1431,
+1432,1432,1432,1432,1432,1432,1432,1432,1433,1433,1433,1433,1433,1433,1433,1433,
+1434,1434,1434,1434,1434,1434,1434,1434,1435,1435,1435,1435,1435,1435,1435,1435,
+1436,1436,1436,1436,1436,1436,1436,1436,1437,1438,1439,1440,1441,0,0,0,
+1442,1442,1442,1442,1442,1442,1442,1442,1443,1443,1443,1443,1443,1443,1443,1443,
+1444,1444,1444,1444,1444,1444,1444,1444,1445,1445,1445,1445,1445,1445,1445,1445,
+1446,1446,1446,1446,1446,1446,1446,1446,1447,1447,1447,1447,1447,1447,1447,1447,
+1448,1448,1448,1448,1448,1448,1448,1448,1449,1450,1451,1452,1453,0,0,0,
+1454,1454,1454,1454,1454,1454,1454,1454,1455,1455,1455,1455,1455,1455,1455,1455,
+1456,1456,1456,1456,1456,1456,1456,1456,1457,1457,1457,1457,1457,1457,1457,1457,
+1458,1458,1458,1458,1458,1458,1458,1458,1459,1459,1459,1459,1459,1459,1459,1459,
+1460,1460,1460,1460,1460,1460,1460,1460,1461,1462,0,0,0,0,0,0,
+1463,1463,1463,1463,1463,1463,1463,1463,1464,1464,1464,1464,1464,1464,1464,1464,
+1465,1465,1465,1465,1465,1465,1465,1465,1466,1466,1466,1466,1466,1466,1466,1466,
+1467,1467,1467,1467,1467,1467,1467,1467,1468,1468,1468,1468,1468,1468,1468,1468,
+1469,1469,1469,1469,1469,1469,1469,1469,1470,1471,0,0,0,0,0,0,
+1472,1472,1472,1472,1472,1472,1472,1472,1473,1473,1473,1473,1473,1473,1473,1473,
+1474,1474,1474,1474,1474,1474,1474,1474,1475,1475,1475,1475,1475,1475,1475,1475,
+1476,1476,1476,1476,1476,1476,1476,1476,1477,1477,1477,1477,1477,1477,1477,1477,
+1478,1478,1478,1478,1478,1478,1478,1478,1479,1480,0,0,0,0,0,0,
+1481,1481,1481,1481,1481,1481,1481,1481,1482,1482,1482,1482,1482,1482,1482,1482,
+1483,1483,1483,1483,1483,1483,1483,1483,1484,1484,1484,1484,1484,1484,1484,1484,
+1485,1485,1485,1485,1485,1485,1485,1485,1486,1486,1486,1486,1486,1486,1486,1486,
+1487,1487,1487,1487,1487,1487,1487,1487,1488,1489,1490,1491,1492,0,0,0,
+1493,1493,1493,1493,1493,1493,1493,1493,1494,1494,1494,1494,1494,1494,1494,1494,
+1495,1495,1495,1495,1495,1495,1495,1495,1496,1496,1496,1496,1496,1496,1496,1496,
+1497,1497,1497,1497,1497,1497,1497,1497,1498,1498,1498,1498,1498,1498,1498,1498,
+1499,1499,1499,1499,1499,1499,1499,1499,1500,1500,1500,1500,1500,1500,1500,1500,
+1501,1501,1501,1501,1501,1501,1501,1501,1502,1502,1502,1502,1502,1502,1502,1502,
+1503,1503,1503,1503,1503,1503,1503,1503,1504,1504,1504,1504,1504,1504,1504,1504,
+1505,1505,1505,1505,1505,1505,1505,1505,1506,1506,1506,1506,1506,1506,1506,1506,
+1507,1507,1507,1507,1507,1507,1507,1507,1508,1508,1508,1508,1508,1508,1508,1508,
+1509,1509,1509,1509,1509,1509,1509,1509,1510,1510,1510,1510,1510,1510,1510,1510,
+1511,1511,1511,1511,1511,1511,1511,1511,1512,1512,1512,1512,1512,1512,1512,1512,
+1513,1513,1513,1513,1513,1513,1513,1513,1514,1514,1514,1514,1514,1514,1514,1514,
+1515,1515,1515,1515,1515,1515,1515,1515,1516,1516,1516,1516,1516,1516,1516,1516,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1517,1517,1517,1517,1517,1517,1517,1517,1518,1518,1518,1518,1518,1518,1518,1518,
+1519,1519,1519,1519,1519,1519,1519,1519,1520,1520,1520,1520,1520,1520,1520,1520,
+1521,1521,1521,1521,1521,1521,1521,1521,1522,1523,0,0,0,0,0,0,
+1524,1524,1524,1524,1524,1524,1524,1524,1525,1525,1525,1525,1525,1525,1525,1525,
+1526,1526,1526,1526,1526,1526,1526,1526,1527,1527,1527,1527,1527,1527,1527,1527,
+1528,1528,1528,1528,1528,1528,1528,1528,1529,1529,1529,1529,1529,1529,1529,1529,
+1530,1530,1530,1530,1530,1530,1530,1530,1531,1531,1531,1531,1531,1531,1531,1531,
+1532,1532,1532,1532,1532,1532,1532,1532,1533,1533,1533,1533,1533,1533,1533,1533,
+1534,1534,1534,1534,1534,1534,1534,1534,1535,1535,1535,1535,1535,1535,1535,1535,
+1536,1536,1536,1536,1536,1536,1536,1536,1537,1537,1537,1537,1537,1537,1537,1537,
+1538,1538,1538,1538,1538,1538,1538,1538,1539,1539,1539,1539,1539,1539,1539,1539,
+1540,1540,1540,1540,1540,1540,1540,1540,1541,1541,1541,1541,1541,1541,1541,1541,
+1542,1542,1542,1542,1542,1542,1542,1542,1543,1543,1543,1543,1543,1543,1543,1543,
+1544,1544,1544,1544,1544,1544,1544,1544,1545,1545,1545,1545,1545,1545,1545,1545,
+1546,1546,1546,1546,1546,1546,1546,1546,1547,1547,1547,1547,1547,1547,1547,1547,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1548,1548,1548,1548,1548,1548,1548,1548,1549,1549,1549,1549,1549,1549,1549,1549,
+1550,1550,1550,1550,1550,1550,1550,1550,1551,1551,1551,1551,1551,1551,1551,1551,
+1552,1552,1552,1552,1552,1552,1552,1552,1553,1554,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1555,1555,1555,1555,1555,1555,1555,1555,1556,1556,1556,1556,1556,1556,1556,1556,
+1557,1557,1557,1557,1557,1557,1557,1557,1558,1558,1558,1558,1558,1558,1558,1558,
+1559,1559,1559,1559,1559,1559,1559,1559,1560,1561,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1562,1562,1562,1562,1562,1562,1562,1562,1563,1563,1563,1563,1563,1563,1563,1563,
+1564,1564,1564,1564,1564,1564,1564,1564,1565,1565,1565,1565,1565,1565,1565,1565,
+1566,1566,1566,1566,1566,1566,1566,1566,1567,1568,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1569,1569,1569,1569,1569,1569,1569,1569,1570,1570,1570,1570,1570,1570,1570,1570,
+1571,1571,1571,1571,1571,1571,1571,1571,1572,1572,1572,1572,1572,1572,1572,1572,
+1573,1573,1573,1573,1573,1573,1573,1573,1574,1575,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1576,1576,1576,1576,1576,1576,1576,1576,1577,1577,1577,1577,1577,1577,1577,1577,
+1578,1578,1578,1578,1578,1578,1578,1578,1579,1579,1579,1579,1579,1579,1579,1579,
+1580,1580,1580,1580,1580,1580,1580,1580,1581,1582,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1583,1583,1583,1583,1583,1583,1583,1583,1584,1584,1584,1584,1584,1584,1584,1584,
+1585,1585,1585,1585,1585,1585,1585,1585,1586,1586,1586,1586,1586,1586,1586,1586,
+1587,1587,1587,1587,1587,1587,1587,1587,1588,1589,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1590,1590,1590,1590,1590,1590,1590,1590,1591,1591,1591,1591,1591,1591,1591,1591,
+1592,1592,1592,1592,1592,1592,1592,1592,1593,1593,1593,1593,1593,1593,1593,1593,
+1594,1594,1594,1594,1594,1594,1594,1594,1595,1596,0,0,0,0,0,0,
+};
+static const uae_u16 op_dispatch_index_3[] = {
+0,1,2,3,4,5,6,7,8,9,10,3,4,5,6,7,
+11,12,13,3,4,5,6,7,14,15,16,3,4,5,6,7,
+17,18,19,20,4,5,6,7,21,22,23,3,4,5,6,7,
+24,25,26,3,4,5,6,7,3,3,3,3,4,5,6,7,
+27,3,28,29,30,31,32,33,27,3,28,29,30,31,32,34,
+27,3,28,29,30,31,32,3,27,3,28,29,30,31,32,3,
+27,3,28,29,30,31,32,3,27,3,28,29,30,31,32,3,
+27,3,28,29,30,31,32,3,27,3,28,29,30,31,32,3,
+35,36,37,38,39,40,41,42,35,36,37,38,39,40,41,43,
+35,36,37,38,39,40,41,3,35,36,37,38,39,40,41,3,
+35,36,37,38,39,40,41,3,35,36,37,38,39,40,41,3,
+35,36,37,38,39,40,41,3,35,36,37,38,39,40,41,3,
+44,45,46,47,48,49,50,51,44,45,46,47,48,49,50,52,
+44,45,46,47,48,49,50,3,44,45,46,47,48,49,50,3,
+44,45,46,47,48,49,50,3,44,45,46,47,48,49,50,3,
+44,45,46,47,48,49,50,3,44,45,46,47,48,49,50,3,
+53,54,55,56,57,3,58,59,60,61,62,63,57,3,58,59,
+64,65,66,67,57,3,58,59,68,69,70,71,57,3,58,59,
+72,73,74,75,57,3,58,76,77,78,79,80,57,3,58,59,
+3,3,81,82,57,3,58,59,3,83,84,85,57,3,58,59,
+86,87,88,89,90,91,92,93,86,87,88,94,90,91,92,95,
+86,87,88,96,90,91,92,97,86,87,88,98,90,91,92,99,
+86,87,88,100,90,91,92,101,86,87,88,102,90,91,92,103,
+86,87,88,104,90,91,92,105,86,87,88,106,90,91,92,107,
+108,109,109,110,111,112,112,113,114,115,115,116,117,118,118,119,
+120,121,121,122,123,124,124,125,126,127,127,128,129,130,130,131,
+132,133,133,134,135,136,136,137,138,139,139,140,141,142,142,143,
+144,145,145,146,147,148,148,149,150,151,151,152,153,154,154,155,
+156,156,156,156,157,158,158,158,156,156,156,156,3,3,3,3,
+156,156,156,156,3,3,3,3,156,156,156,156,3,3,3,3,
+156,156,156,156,3,3,3,3,156,156,156,156,3,3,3,3,
+156,156,156,156,3,3,3,3,156,156,156,156,3,3,3,3,
+159,160,161,162,163,164,165,166,159,160,161,162,163,164,165,166,
+159,160,161,162,163,164,165,166,159,160,161,162,163,164,165,166,
+159,160,161,162,163,164,165,166,159,160,161,162,163,164,165,166,
+159,160,161,162,163,164,165,166,159,160,161,162,163,164,165,166,
+167,168,169,170,171,172,173,174,167,168,169,170,171,172,173,174,
+167,168,169,170,171,172,173,174,167,168,169,170,171,172,173,174,
+167,168,169,170,171,172,173,174,167,168,169,170,171,172,173,174,
+167,168,169,170,171,172,173,174,167,168,169,170,171,172,173,174,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+175,176,177,178,179,180,181,182,175,176,177,178,179,180,181,182,
+175,176,177,178,179,180,181,182,175,176,177,178,179,180,181,182,
+175,176,177,178,179,180,181,182,175,176,177,178,179,180,181,182,
+175,176,177,178,179,180,181,182,175,176,177,178,179,180,181,182,
+183,184,185,186,187,188,189,190,183,184,185,186,187,188,189,190,
+183,184,185,186,187,188,189,190,183,184,185,186,187,188,189,190,
+183,184,185,186,187,188,189,190,183,184,185,186,187,188,189,190,
+183,184,185,186,187,188,189,190,183,184,185,186,187,188,189,190,
+191,192,193,194,195,196,197,198,191,192,193,194,195,196,197,198,
+191,192,193,194,195,196,197,198,191,192,193,194,195,196,197,198,
+191,192,193,194,195,196,197,198,191,192,193,194,195,196,197,198,
+191,192,193,194,195,196,197,198,191,192,193,194,195,196,197,198,
+199,200,201,202,203,204,205,206,199,200,201,207,203,204,205,208,
+199,200,201,209,203,204,205,210,199,200,201,211,203,204,205,212,
+199,200,201,3,203,204,205,3,199,200,201,3,203,204,205,3,
+199,200,201,3,203,204,205,3,199,200,201,3,203,204,205,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+};
+const struct cpudispatch_tbl op_dispatch_3 = {
+	op_dispatch_handlers_3, op_dispatch_pages_3, op_dispatch_index_3, 1597, 213
+};
+
+/* CPU level 0: 1587 handlers, 212 pages */
+static cpuop_func *const op_dispatch_handlers_4[] = {
+op_illg_1,
+op_0_0_ff,
+op_10_0_ff,
+op_18_0_ff,
+op_20_0_ff,
+op_28_0_ff,
+op_30_3_ff,
+op_38_0_ff,
+op_39_0_ff,
+op_3c_0_ff,
+op_40_0_ff,
+op_50_0_ff,
+op_58_0_ff,
+op_60_0_ff,
+op_68_0_ff,
+op_70_3_ff,
+op_78_0_ff,
+op_79_0_ff,
+op_7c_0_ff,
+op_80_0_ff,
+op_90_0_ff,
+op_98_0_ff,
+op_a0_0_ff,
+op_a8_0_ff,
+op_b0_3_ff,
+op_b8_0_ff,
+op_b9_0_ff,
+op_100_0_ff,
+op_108_0_ff,
+op_110_0_ff,
+op_118_0_ff,
+op_120_0_ff,
+op_128_0_ff,
+op_130_3_ff,
+op_138_0_ff,
+op_139_0_ff,
+op_13a_0_ff,
+op_13b_3_ff,
+op_13c_0_ff,
+op_140_0_ff,
+op_148_0_ff,
+op_150_0_ff,
+op_158_0_ff,
+op_160_0_ff,
+op_168_0_ff,
+op_170_3_ff,
+op_178_0_ff,
+op_179_0_ff,
+op_17a_0_ff,
+op_17b_3_ff,
+op_180_0_ff,
+op_188_0_ff,
+op_190_0_ff,
+op_198_0_ff,
+op_1a0_0_ff,
+op_1a8_0_ff,
+op_1b0_3_ff,
+op_1b8_0_ff,
+op_1b9_0_ff,
+op_1ba_0_ff,
+op_1bb_3_ff,
+op_1c0_0_ff,
+op_1c8_0_ff,
+op_1d0_0_ff,
+op_1d8_0_ff,
+op_1e0_0_ff,
+op_1e8_0_ff,
+op_1f0_3_ff,
+op_1f8_0_ff,
+op_1f9_0_ff,
+op_1fa_0_ff,
+op_1fb_3_ff,
+op_200_0_ff,
+op_210_0_ff,
+op_218_0_ff,
+op_220_0_ff,
+op_228_0_ff,
+op_230_3_ff,
+op_238_0_ff,
+op_239_0_ff,
+op_23c_0_ff,
+op_240_0_ff,
+op_250_0_ff,
+op_258_0_ff,
+op_260_0_ff,
+op_268_0_ff,
+op_270_3_ff,
+op_278_0_ff,
+op_279_0_ff,
+op_27c_0_ff,
+op_280_0_ff,
+op_290_0_ff,
+op_298_0_ff,
+op_2a0_0_ff,
+op_2a8_0_ff,
+op_2b0_3_ff,
+op_2b8_0_ff,
+op_2b9_0_ff,
+op_400_0_ff,
+op_410_0_ff,
+op_418_0_ff,
+op_420_0_ff,
+op_428_0_ff,
+op_430_3_ff,
+op_438_0_ff,
+op_439_0_ff,
+op_440_0_ff,
+op_450_0_ff,
+op_458_0_ff,
+op_460_0_ff,
+op_468_0_ff,
+op_470_3_ff,
+op_478_0_ff,
+op_479_0_ff,
+op_480_0_ff,
+op_490_0_ff,
+op_498_0_ff,
+op_4a0_0_ff,
+op_4a8_0_ff,
+op_4b0_3_ff,
+op_4b8_0_ff,
+op_4b9_0_ff,
+op_600_0_ff,
+op_610_0_ff,
+op_618_0_ff,
+op_620_0_ff,
+op_628_0_ff,
+op_630_3_ff,
+op_638_0_ff,
+op_639_0_ff,
+op_640_0_ff,
+op_650_0_ff,
+op_658_0_ff,
+op_660_0_ff,
+op_668_0_ff,
+op_670_3_ff,
+op_678_0_ff,
+op_679_0_ff,
+op_680_0_ff,
+op_690_0_ff,
+op_698_0_ff,
+op_6a0_0_ff,
+op_6a8_0_ff,
+op_6b0_3_ff,
+op_6b8_0_ff,
+op_6b9_0_ff,
+op_800_0_ff,
+op_810_0_ff,
+op_818_0_ff,
+op_820_0_ff,
+op_828_0_ff,
+op_830_3_ff,
+op_838_0_ff,
+op_839_0_ff,
+op_83a_0_ff,
+op_83b_3_ff,
+op_83c_0_ff,
+op_840_0_ff,
+op_850_0_ff,
+op_858_0_ff,
+op_860_0_ff,
+op_868_0_ff,
+op_870_3_ff,
+op_878_0_ff,
+op_879_0_ff,
+op_87a_0_ff,
+op_87b_3_ff,
+op_880_0_ff,
+op_890_0_ff,
+op_898_0_ff,
+op_8a0_0_ff,
+op_8a8_0_ff,
+op_8b0_3_ff,
+op_8b8_0_ff,
+op_8b9_0_ff,
+op_8ba_0_ff,
+op_8bb_3_ff,
+op_8c0_0_ff,
+op_8d0_0_ff,
+op_8d8_0_ff,
+op_8e0_0_ff,
+op_8e8_0_ff,
+op_8f0_3_ff,
+op_8f8_0_ff,
+op_8f9_0_ff,
+op_8fa_0_ff,
+op_8fb_3_ff,
+op_a00_0_ff,
+op_a10_0_ff,
+op_a18_0_ff,
+op_a20_0_ff,
+op_a28_0_ff,
+op_a30_3_ff,
+op_a38_0_ff,
+op_a39_0_ff,
+op_a3c_0_ff,
+op_a40_0_ff,
+op_a50_0_ff,
+op_a58_0_ff,
+op_a60_0_ff,
+op_a68_0_ff,
+op_a70_3_ff,
+op_a78_0_ff,
+op_a79_0_ff,
+op_a7c_0_ff,
+op_a80_0_ff,
+op_a90_0_ff,
+op_a98_0_ff,
+op_aa0_0_ff,
+op_aa8_0_ff,
+op_ab0_3_ff,
+op_ab8_0_ff,
+op_ab9_0_ff,
+op_c00_0_ff,
+op_c10_0_ff,
+op_c18_0_ff,
+op_c20_0_ff,
+op_c28_0_ff,
+op_c30_3_ff,
+op_c38_0_ff,
+op_c39_0_ff,
+op_c3a_0_ff,
+op_c3b_3_ff,
+op_c40_0_ff,
+op_c50_0_ff,
+op_c58_0_ff,
+op_c60_0_ff,
+op_c68_0_ff,
+op_c70_3_ff,
+op_c78_0_ff,
+op_c79_0_ff,
+op_c7a_0_ff,
+op_c7b_3_ff,
+op_c80_0_ff,
+op_c90_0_ff,
+op_c98_0_ff,
+op_ca0_0_ff,
+op_ca8_0_ff,
+op_cb0_3_ff,
+op_cb8_0_ff,
+op_cb9_0_ff,
+op_cba_0_ff,
+op_cbb_3_ff,
+op_1000_0_ff,
+op_1010_0_ff,
+op_1018_0_ff,
+op_1020_0_ff,
+op_1028_0_ff,
+op_1030_3_ff,
+op_1038_0_ff,
+op_1039_0_ff,
+op_103a_0_ff,
+op_103b_3_ff,
+op_103c_0_ff,
+op_1080_0_ff,
+op_1090_0_ff,
+op_1098_0_ff,
+op_10a0_0_ff,
+op_10a8_0_ff,
+op_10b0_3_ff,
+op_10b8_0_ff,
+op_10b9_0_ff,
+op_10ba_0_ff,
+op_10bb_3_ff,
+op_10bc_0_ff,
+op_10c0_0_ff,
+op_10d0_0_ff,
+op_10d8_0_ff,
+op_10e0_0_ff,
+op_10e8_0_ff,
+op_10f0_3_ff,
+op_10f8_0_ff,
+op_10f9_0_ff,
+op_10fa_0_ff,
+op_10fb_3_ff,
+op_10fc_0_ff,
+op_1100_0_ff,
+op_1110_0_ff,
+op_1118_0_ff,
+op_1120_0_ff,
+op_1128_0_ff,
+op_1130_3_ff,
+op_1138_0_ff,
+op_1139_0_ff,
+op_113a_0_ff,
+op_113b_3_ff,
+op_113c_0_ff,
+op_1140_0_ff,
+op_1150_0_ff,
+op_1158_0_ff,
+op_1160_0_ff,
+op_1168_0_ff,
+op_1170_3_ff,
+op_1178_0_ff,
+op_1179_0_ff,
+op_117a_0_ff,
+op_117b_3_ff,
+op_117c_0_ff,
+op_1180_3_ff,
+op_1190_3_ff,
+op_1198_3_ff,
+op_11a0_3_ff,
+op_11a8_3_ff,
+op_11b0_3_ff,
+op_11b8_3_ff,
+op_11b9_3_ff,
+op_11ba_3_ff,
+op_11bb_3_ff,
+op_11bc_3_ff,
+op_11c0_0_ff,
+op_11d0_0_ff,
+op_11d8_0_ff,
+op_11e0_0_ff,
+op_11e8_0_ff,
+op_11f0_3_ff,
+op_11f8_0_ff,
+op_11f9_0_ff,
+op_11fa_0_ff,
+op_11fb_3_ff,
+op_11fc_0_ff,
+op_13c0_0_ff,
+op_13d0_0_ff,
+op_13d8_0_ff,
+op_13e0_0_ff,
+op_13e8_0_ff,
+op_13f0_3_ff,
+op_13f8_0_ff,
+op_13f9_0_ff,
+op_13fa_0_ff,
+op_13fb_3_ff,
+op_13fc_0_ff,
+op_2000_0_ff,
+op_2008_0_ff,
+op_2010_0_ff,
+op_2018_0_ff,
+op_2020_0_ff,
+op_2028_0_ff,
+op_2030_3_ff,
+op_2038_0_ff,
+op_2039_0_ff,
+op_203a_0_ff,
+op_203b_3_ff,
+op_203c_0_ff,
+op_2040_0_ff,
+op_2048_0_ff,
+op_2050_0_ff,
+op_2058_0_ff,
+op_2060_0_ff,
+op_2068_0_ff,
+op_2070_3_ff,
+op_2078_0_ff,
+op_2079_0_ff,
+op_207a_0_ff,
+op_207b_3_ff,
+op_207c_0_ff,
+op_2080_0_ff,
+op_2088_0_ff,
+op_2090_0_ff,
+op_2098_0_ff,
+op_20a0_0_ff,
+op_20a8_0_ff,
+op_20b0_3_ff,
+op_20b8_0_ff,
+op_20b9_0_ff,
+op_20ba_0_ff,
+op_20bb_3_ff,
+op_20bc_0_ff,
+op_20c0_0_ff,
+op_20c8_0_ff,
+op_20d0_0_ff,
+op_20d8_0_ff,
+op_20e0_0_ff,
+op_20e8_0_ff,
+op_20f0_3_ff,
+op_20f8_0_ff,
+op_20f9_0_ff,
+op_20fa_0_ff,
+op_20fb_3_ff,
+op_20fc_0_ff,
+op_2100_0_ff,
+op_2108_0_ff,
+op_2110_0_ff,
+op_2118_0_ff,
+op_2120_0_ff,
+op_2128_0_ff,
+op_2130_3_ff,
+op_2138_0_ff,
+op_2139_0_ff,
+op_213a_0_ff,
+op_213b_3_ff,
+op_213c_0_ff,
+op_2140_0_ff,
+op_2148_0_ff,
+op_2150_0_ff,
+op_2158_0_ff,
+op_2160_0_ff,
+op_2168_0_ff,
+op_2170_3_ff,
+op_2178_0_ff,
+op_2179_0_ff,
+op_217a_0_ff,
+op_217b_3_ff,
+op_217c_0_ff,
+op_2180_3_ff,
+op_2188_3_ff,
+op_2190_3_ff,
+op_2198_3_ff,
+op_21a0_3_ff,
+op_21a8_3_ff,
+op_21b0_3_ff,
+op_21b8_3_ff,
+op_21b9_3_ff,
+op_21ba_3_ff,
+op_21bb_3_ff,
+op_21bc_3_ff,
+op_21c0_0_ff,
+op_21c8_0_ff,
+op_21d0_0_ff,
+op_21d8_0_ff,
+op_21e0_0_ff,
+op_21e8_0_ff,
+op_21f0_3_ff,
+op_21f8_0_ff,
+op_21f9_0_ff,
+op_21fa_0_ff,
+op_21fb_3_ff,
+op_21fc_0_ff,
+op_23c0_0_ff,
+op_23c8_0_ff,
+op_23d0_0_ff,
+op_23d8_0_ff,
+op_23e0_0_ff,
+op_23e8_0_ff,
+op_23f0_3_ff,
+op_23f8_0_ff,
+op_23f9_0_ff,
+op_23fa_0_ff,
+op_23fb_3_ff,
+op_23fc_0_ff,
+op_3000_0_ff,
+op_3008_0_ff,
+op_3010_0_ff,
+op_3018_0_ff,
+op_3020_0_ff,
+op_3028_0_ff,
+op_3030_3_ff,
+op_3038_0_ff,
+op_3039_0_ff,
+op_303a_0_ff,
+op_303b_3_ff,
+op_303c_0_ff,
+op_3040_0_ff,
+op_3048_0_ff,
+op_3050_0_ff,
+op_3058_0_ff,
+op_3060_0_ff,
+op_3068_0_ff,
+op_3070_3_ff,
+op_3078_0_ff,
+op_3079_0_ff,
+op_307a_0_ff,
+op_307b_3_ff,
+op_307c_0_ff,
+op_3080_0_ff,
+op_3088_0_ff,
+op_3090_0_ff,
+op_3098_0_ff,
+op_30a0_0_ff,
+op_30a8_0_ff,
+op_30b0_3_ff,
+op_30b8_0_ff,
+op_30b9_0_ff,
+op_30ba_0_ff,
+op_30bb_3_ff,
+op_30bc_0_ff,
+op_30c0_0_ff,
+op_30c8_0_ff,
+op_30d0_0_ff,
+op_30d8_0_ff,
+op_30e0_0_ff,
+op_30e8_0_ff,
+op_30f0_3_ff,
+op_30f8_0_ff,
+op_30f9_0_ff,
+op_30fa_0_ff,
+op_30fb_3_ff,
+op_30fc_0_ff,
+op_3100_0_ff,
+op_3108_0_ff,
+op_3110_0_ff,
+op_3118_0_ff,
+op_3120_0_ff,
+op_3128_0_ff,
+op_3130_3_ff,
+op_3138_0_ff,
+op_3139_0_ff,
+op_313a_0_ff,
+op_313b_3_ff,
+op_313c_0_ff,
+op_3140_0_ff,
+op_3148_0_ff,
+op_3150_0_ff,
+op_3158_0_ff,
+op_3160_0_ff,
+op_3168_0_ff,
+op_3170_3_ff,
+op_3178_0_ff,
+op_3179_0_ff,
+op_317a_0_ff,
+op_317b_3_ff,
+op_317c_0_ff,
+op_3180_3_ff,
+op_3188_3_ff,
+op_3190_3_ff,
+op_3198_3_ff,
+op_31a0_3_ff,
+op_31a8_3_ff,
+op_31b0_3_ff,
+op_31b8_3_ff,
+op_31b9_3_ff,
+op_31ba_3_ff,
+op_31bb_3_ff,
+op_31bc_3_ff,
+op_31c0_0_ff,
+op_31c8_0_ff,
+op_31d0_0_ff,
+op_31d8_0_ff,
+op_31e0_0_ff,
+op_31e8_0_ff,
+op_31f0_3_ff,
+op_31f8_0_ff,
+op_31f9_0_ff,
+op_31fa_0_ff,
+op_31fb_3_ff,
+op_31fc_0_ff,
+op_33c0_0_ff,
+op_33c8_0_ff,
+op_33d0_0_ff,
+op_33d8_0_ff,
+op_33e0_0_ff,
+op_33e8_0_ff,
+op_33f0_3_ff,
+op_33f8_0_ff,
+op_33f9_0_ff,
+op_33fa_0_ff,
+op_33fb_3_ff,
+op_33fc_0_ff,
+op_4000_0_ff,
+op_4010_0_ff,
+op_4018_0_ff,
+op_4020_0_ff,
+op_4028_0_ff,
+op_4030_3_ff,
+op_4038_0_ff,
+op_4039_0_ff,
+op_4040_0_ff,
+op_4050_0_ff,
+op_4058_0_ff,
+op_4060_0_ff,
+op_4068_0_ff,
+op_4070_3_ff,
+op_4078_0_ff,
+op_4079_0_ff,
+op_4080_0_ff,
+op_4090_0_ff,
+op_4098_0_ff,
+op_40a0_0_ff,
+op_40a8_0_ff,
+op_40b0_3_ff,
+op_40b8_0_ff,
+op_40b9_0_ff,
+op_40c0_4_ff,
+op_40d0_4_ff,
+op_40d8_4_ff,
+op_40e0_4_ff,
+op_40e8_4_ff,
+op_40f0_4_ff,
+op_40f8_4_ff,
+op_40f9_4_ff,
+op_4100_0_ff,
+op_4110_0_ff,
+op_4118_0_ff,
+op_4120_0_ff,
+op_4128_0_ff,
+op_4130_3_ff,
+op_4138_0_ff,
+op_4139_0_ff,
+op_413a_0_ff,
+op_413b_3_ff,
+op_413c_0_ff,
+op_4180_0_ff,
+op_4190_0_ff,
+op_4198_0_ff,
+op_41a0_0_ff,
+op_41a8_0_ff,
+op_41b0_3_ff,
+op_41b8_0_ff,
+op_41b9_0_ff,
+op_41ba_0_ff,
+op_41bb_3_ff,
+op_41bc_0_ff,
+op_41d0_0_ff,
+op_41e8_0_ff,
+op_41f0_3_ff,
+op_41f8_0_ff,
+op_41f9_0_ff,
+op_41fa_0_ff,
+op_41fb_3_ff,
+op_4200_0_ff,
+op_4210_0_ff,
+op_4218_0_ff,
+op_4220_0_ff,
+op_4228_0_ff,
+op_4230_3_ff,
+op_4238_0_ff,
+op_4239_0_ff,
+op_4240_0_ff,
+op_4250_0_ff,
+op_4258_0_ff,
+op_4260_0_ff,
+op_4268_0_ff,
+op_4270_3_ff,
+op_4278_0_ff,
+op_4279_0_ff,
+op_4280_0_ff,
+op_4290_0_ff,
+op_4298_0_ff,
+op_42a0_0_ff,
+op_42a8_0_ff,
+op_42b0_3_ff,
+op_42b8_0_ff,
+op_42b9_0_ff,
+op_4400_0_ff,
+op_4410_0_ff,
+op_4418_0_ff,
+op_4420_0_ff,
+op_4428_0_ff,
+op_4430_3_ff,
+op_4438_0_ff,
+op_4439_0_ff,
+op_4440_0_ff,
+op_4450_0_ff,
+op_4458_0_ff,
+op_4460_0_ff,
+op_4468_0_ff,
+op_4470_3_ff,
+op_4478_0_ff,
+op_4479_0_ff,
+op_4480_0_ff,
+op_4490_0_ff,
+op_4498_0_ff,
+op_44a0_0_ff,
+op_44a8_0_ff,
+op_44b0_3_ff,
+op_44b8_0_ff,
+op_44b9_0_ff,
+op_44c0_0_ff,
+op_44d0_0_ff,
+op_44d8_0_ff,
+op_44e0_0_ff,
+op_44e8_0_ff,
+op_44f0_3_ff,
+op_44f8_0_ff,
+op_44f9_0_ff,
+op_44fa_0_ff,
+op_44fb_3_ff,
+op_44fc_0_ff,
+op_4600_0_ff,
+op_4610_0_ff,
+op_4618_0_ff,
+op_4620_0_ff,
+op_4628_0_ff,
+op_4630_3_ff,
+op_4638_0_ff,
+op_4639_0_ff,
+op_4640_0_ff,
+op_4650_0_ff,
+op_4658_0_ff,
+op_4660_0_ff,
+op_4668_0_ff,
+op_4670_3_ff,
+op_4678_0_ff,
+op_4679_0_ff,
+op_4680_0_ff,
+op_4690_0_ff,
+op_4698_0_ff,
+op_46a0_0_ff,
+op_46a8_0_ff,
+op_46b0_3_ff,
+op_46b8_0_ff,
+op_46b9_0_ff,
+op_46c0_0_ff,
+op_46d0_0_ff,
+op_46d8_0_ff,
+op_46e0_0_ff,
+op_46e8_0_ff,
+op_46f0_3_ff,
+op_46f8_0_ff,
+op_46f9_0_ff,
+op_46fa_0_ff,
+op_46fb_3_ff,
+op_46fc_0_ff,
+op_4800_1_ff,
+op_4810_1_ff,
+op_4818_1_ff,
+op_4820_1_ff,
+op_4828_1_ff,
+op_4830_3_ff,
+op_4838_1_ff,
+op_4839_1_ff,
+op_4840_0_ff,
+op_4850_0_ff,
+op_4868_0_ff,
+op_4870_3_ff,
+op_4878_0_ff,
+op_4879_0_ff,
+op_487a_0_ff,
+op_487b_3_ff,
+op_4880_0_ff,
+op_4890_0_ff,
+op_48a0_0_ff,
+op_48a8_0_ff,
+op_48b0_3_ff,
+op_48b8_0_ff,
+op_48b9_0_ff,
+op_48c0_0_ff,
+op_48d0_0_ff,
+op_48e0_0_ff,
+op_48e8_0_ff,
+op_48f0_3_ff,
+op_48f8_0_ff,
+op_48f9_0_ff,
+op_49c0_0_ff,
+op_4a00_0_ff,
+op_4a10_0_ff,
+op_4a18_0_ff,
+op_4a20_0_ff,
+op_4a28_0_ff,
+op_4a30_3_ff,
+op_4a38_0_ff,
+op_4a39_0_ff,
+op_4a3a_0_ff,
+op_4a3b_3_ff,
+op_4a3c_0_ff,
+op_4a40_0_ff,
+op_4a48_0_ff,
+op_4a50_0_ff,
+op_4a58_0_ff,
+op_4a60_0_ff,
+op_4a68_0_ff,
+op_4a70_3_ff,
+op_4a78_0_ff,
+op_4a79_0_ff,
+op_4a7a_0_ff,
+op_4a7b_3_ff,
+op_4a7c_0_ff,
+op_4a80_0_ff,
+op_4a88_0_ff,
+op_4a90_0_ff,
+op_4a98_0_ff,
+op_4aa0_0_ff,
+op_4aa8_0_ff,
+op_4ab0_3_ff,
+op_4ab8_0_ff,
+op_4ab9_0_ff,
+op_4aba_0_ff,
+op_4abb_3_ff,
+op_4abc_0_ff,
+op_4ac0_0_ff,
+op_4ad0_0_ff,
+op_4ad8_0_ff,
+op_4ae0_0_ff,
+op_4ae8_0_ff,
+op_4af0_3_ff,
+op_4af8_0_ff,
+op_4af9_0_ff,
+op_4c90_0_ff,
+op_4c98_0_ff,
+op_4ca8_0_ff,
+op_4cb0_3_ff,
+op_4cb8_0_ff,
+op_4cb9_0_ff,
+op_4cba_0_ff,
+op_4cbb_3_ff,
+op_4cd0_0_ff,
+op_4cd8_0_ff,
+op_4ce8_0_ff,
+op_4cf0_3_ff,
+op_4cf8_0_ff,
+op_4cf9_0_ff,
+op_4cfa_0_ff,
+op_4cfb_3_ff,
+op_4e40_0_ff,
+op_4e50_0_ff,
+op_4e58_0_ff,
+op_4e60_0_ff,
+op_4e68_0_ff,
+op_4e70_0_ff,
+op_4e71_0_ff,
+op_4e72_0_ff,
+op_4e73_4_ff,
+op_4e74_0_ff,
+op_4e75_0_ff,
+op_4e76_0_ff,
+op_4e77_0_ff,
+op_4e90_0_ff,
+op_4ea8_0_ff,
+op_4eb0_3_ff,
+op_4eb8_0_ff,
+op_4eb9_0_ff,
+op_4eba_0_ff,
+op_4ebb_3_ff,
+op_4ed0_0_ff,
+op_4ee8_0_ff,
+op_4ef0_3_ff,
+op_4ef8_0_ff,
+op_4ef9_0_ff,
+op_4efa_0_ff,
+op_4efb_3_ff,
+op_5000_0_ff,
+op_5010_0_ff,
+op_5018_0_ff,
+op_5020_0_ff,
+op_5028_0_ff,
+op_5030_3_ff,
+op_5038_0_ff,
+op_5039_0_ff,
+op_5040_0_ff,
+op_5048_0_ff,
+op_5050_0_ff,
+op_5058_0_ff,
+op_5060_0_ff,
+op_5068_0_ff,
+op_5070_3_ff,
+op_5078_0_ff,
+op_5079_0_ff,
+op_5080_0_ff,
+op_5088_0_ff,
+op_5090_0_ff,
+op_5098_0_ff,
+op_50a0_0_ff,
+op_50a8_0_ff,
+op_50b0_3_ff,
+op_50b8_0_ff,
+op_50b9_0_ff,
+op_50c0_0_ff,
+op_50c8_0_ff,
+op_50d0_0_ff,
+op_50d8_0_ff,
+op_50e0_0_ff,
+op_50e8_0_ff,
+op_50f0_3_ff,
+op_50f8_0_ff,
+op_50f9_0_ff,
+op_5100_0_ff,
+op_5110_0_ff,
+op_5118_0_ff,
+op_5120_0_ff,
+op_5128_0_ff,
+op_5130_3_ff,
+op_5138_0_ff,
+op_5139_0_ff,
+op_5140_0_ff,
+op_5148_0_ff,
+op_5150_0_ff,
+op_5158_0_ff,
+op_5160_0_ff,
+op_5168_0_ff,
+op_5170_3_ff,
+op_5178_0_ff,
+op_5179_0_ff,
+op_5180_0_ff,
+op_5188_0_ff,
+op_5190_0_ff,
+op_5198_0_ff,
+op_51a0_0_ff,
+op_51a8_0_ff,
+op_51b0_3_ff,
+op_51b8_0_ff,
+op_51b9_0_ff,
+op_51c0_0_ff,
+op_51c8_0_ff,
+op_51d0_0_ff,
+op_51d8_0_ff,
+op_51e0_0_ff,
+op_51e8_0_ff,
+op_51f0_3_ff,
+op_51f8_0_ff,
+op_51f9_0_ff,
+op_52c0_0_ff,
+op_52c8_0_ff,
+op_52d0_0_ff,
+op_52d8_0_ff,
+op_52e0_0_ff,
+op_52e8_0_ff,
+op_52f0_3_ff,
+op_52f8_0_ff,
+op_52f9_0_ff,
+op_53c0_0_ff,
+op_53c8_0_ff,
+op_53d0_0_ff,
+op_53d8_0_ff,
+op_53e0_0_ff,
+op_53e8_0_ff,
+op_53f0_3_ff,
+op_53f8_0_ff,
+op_53f9_0_ff,
+op_54c0_0_ff,
+op_54c8_0_ff,
+op_54d0_0_ff,
+op_54d8_0_ff,
+op_54e0_0_ff,
+op_54e8_0_ff,
+op_54f0_3_ff,
+op_54f8_0_ff,
+op_54f9_0_ff,
+op_55c0_0_ff,
+op_55c8_0_ff,
+op_55d0_0_ff,
+op_55d8_0_ff,
+op_55e0_0_ff,
+op_55e8_0_ff,
+op_55f0_3_ff,
+op_55f8_0_ff,
+op_55f9_0_ff,
+op_56c0_0_ff,
+op_56c8_0_ff,
+op_56d0_0_ff,
+op_56d8_0_ff,
+op_56e0_0_ff,
+op_56e8_0_ff,
+op_56f0_3_ff,
+op_56f8_0_ff,
+op_56f9_0_ff,
+op_57c0_0_ff,
+op_57c8_0_ff,
+op_57d0_0_ff,
+op_57d8_0_ff,
+op_57e0_0_ff,
+op_57e8_0_ff,
+op_57f0_3_ff,
+op_57f8_0_ff,
+op_57f9_0_ff,
+op_58c0_0_ff,
+op_58c8_0_ff,
+op_58d0_0_ff,
+op_58d8_0_ff,
+op_58e0_0_ff,
+op_58e8_0_ff,
+op_58f0_3_ff,
+op_58f8_0_ff,
+op_58f9_0_ff,
+op_59c0_0_ff,
+op_59c8_0_ff,
+op_59d0_0_ff,
+op_59d8_0_ff,
+op_59e0_0_ff,
+op_59e8_0_ff,
+op_59f0_3_ff,
+op_59f8_0_ff,
+op_59f9_0_ff,
+op_5ac0_0_ff,
+op_5ac8_0_ff,
+op_5ad0_0_ff,
+op_5ad8_0_ff,
+op_5ae0_0_ff,
+op_5ae8_0_ff,
+op_5af0_3_ff,
+op_5af8_0_ff,
+op_5af9_0_ff,
+op_5bc0_0_ff,
+op_5bc8_0_ff,
+op_5bd0_0_ff,
+op_5bd8_0_ff,
+op_5be0_0_ff,
+op_5be8_0_ff,
+op_5bf0_3_ff,
+op_5bf8_0_ff,
+op_5bf9_0_ff,
+op_5cc0_0_ff,
+op_5cc8_0_ff,
+op_5cd0_0_ff,
+op_5cd8_0_ff,
+op_5ce0_0_ff,
+op_5ce8_0_ff,
+op_5cf0_3_ff,
+op_5cf8_0_ff,
+op_5cf9_0_ff,
+op_5dc0_0_ff,
+op_5dc8_0_ff,
+op_5dd0_0_ff,
+op_5dd8_0_ff,
+op_5de0_0_ff,
+op_5de8_0_ff,
+op_5df0_3_ff,
+op_5df8_0_ff,
+op_5df9_0_ff,
+op_5ec0_0_ff,
+op_5ec8_0_ff,
+op_5ed0_0_ff,
+op_5ed8_0_ff,
+op_5ee0_0_ff,
+op_5ee8_0_ff,
+op_5ef0_3_ff,
+op_5ef8_0_ff,
+op_5ef9_0_ff,
+op_5fc0_0_ff,
+op_5fc8_0_ff,
+op_5fd0_0_ff,
+op_5fd8_0_ff,
+op_5fe0_0_ff,
+op_5fe8_0_ff,
+op_5ff0_3_ff,
+op_5ff8_0_ff,
+op_5ff9_0_ff,
+op_6000_0_ff,
+op_6001_0_ff,
+op_60ff_3_ff,
+op_6100_0_ff,
+op_6101_0_ff,
+op_61ff_0_ff,
+op_6200_0_ff,
+op_6201_0_ff,
+op_62ff_3_ff,
+op_6300_0_ff,
+op_6301_0_ff,
+op_63ff_3_ff,
+op_6400_0_ff,
+op_6401_0_ff,
+op_64ff_3_ff,
+op_6500_0_ff,
+op_6501_0_ff,
+op_65ff_3_ff,
+op_6600_0_ff,
+op_6601_0_ff,
+op_66ff_3_ff,
+op_6700_0_ff,
+op_6701_0_ff,
+op_67ff_3_ff,
+op_6800_0_ff,
+op_6801_0_ff,
+op_68ff_3_ff,
+op_6900_0_ff,
+op_6901_0_ff,
+op_69ff_3_ff,
+op_6a00_0_ff,
+op_6a01_0_ff,
+op_6aff_3_ff,
+op_6b00_0_ff,
+op_6b01_0_ff,
+op_6bff_3_ff,
+op_6c00_0_ff,
+op_6c01_0_ff,
+op_6cff_3_ff,
+op_6d00_0_ff,
+op_6d01_0_ff,
+op_6dff_3_ff,
+op_6e00_0_ff,
+op_6e01_0_ff,
+op_6eff_3_ff,
+op_6f00_0_ff,
+op_6f01_0_ff,
+op_6fff_3_ff,
+op_7000_0_ff,
+op_7100_0_ff,
+op_7101_0_ff,
+op_8000_0_ff,
+op_8010_0_ff,
+op_8018_0_ff,
+op_8020_0_ff,
+op_8028_0_ff,
+op_8030_3_ff,
+op_8038_0_ff,
+op_8039_0_ff,
+op_803a_0_ff,
+op_803b_3_ff,
+op_803c_0_ff,
+op_8040_0_ff,
+op_8050_0_ff,
+op_8058_0_ff,
+op_8060_0_ff,
+op_8068_0_ff,
+op_8070_3_ff,
+op_8078_0_ff,
+op_8079_0_ff,
+op_807a_0_ff,
+op_807b_3_ff,
+op_807c_0_ff,
+op_8080_0_ff,
+op_8090_0_ff,
+op_8098_0_ff,
+op_80a0_0_ff,
+op_80a8_0_ff,
+op_80b0_3_ff,
+op_80b8_0_ff,
+op_80b9_0_ff,
+op_80ba_0_ff,
+op_80bb_3_ff,
+op_80bc_0_ff,
+op_80c0_0_ff,
+op_80d0_0_ff,
+op_80d8_0_ff,
+op_80e0_0_ff,
+op_80e8_0_ff,
+op_80f0_3_ff,
+op_80f8_0_ff,
+op_80f9_0_ff,
+op_80fa_0_ff,
+op_80fb_3_ff,
+op_80fc_0_ff,
+op_8100_1_ff,
+op_8108_1_ff,
+op_8110_0_ff,
+op_8118_0_ff,
+op_8120_0_ff,
+op_8128_0_ff,
+op_8130_3_ff,
+op_8138_0_ff,
+op_8139_0_ff,
+op_8150_0_ff,
+op_8158_0_ff,
+op_8160_0_ff,
+op_8168_0_ff,
+op_8170_3_ff,
+op_8178_0_ff,
+op_8179_0_ff,
+op_8190_0_ff,
+op_8198_0_ff,
+op_81a0_0_ff,
+op_81a8_0_ff,
+op_81b0_3_ff,
+op_81b8_0_ff,
+op_81b9_0_ff,
+op_81c0_0_ff,
+op_81d0_0_ff,
+op_81d8_0_ff,
+op_81e0_0_ff,
+op_81e8_0_ff,
+op_81f0_3_ff,
+op_81f8_0_ff,
+op_81f9_0_ff,
+op_81fa_0_ff,
+op_81fb_3_ff,
+op_81fc_0_ff,
+op_9000_0_ff,
+op_9010_0_ff,
+op_9018_0_ff,
+op_9020_0_ff,
+op_9028_0_ff,
+op_9030_3_ff,
+op_9038_0_ff,
+op_9039_0_ff,
+op_903a_0_ff,
+op_903b_3_ff,
+op_903c_0_ff,
+op_9040_0_ff,
+op_9048_0_ff,
+op_9050_0_ff,
+op_9058_0_ff,
+op_9060_0_ff,
+op_9068_0_ff,
+op_9070_3_ff,
+op_9078_0_ff,
+op_9079_0_ff,
+op_907a_0_ff,
+op_907b_3_ff,
+op_907c_0_ff,
+op_9080_0_ff,
+op_9088_0_ff,
+op_9090_0_ff,
+op_9098_0_ff,
+op_90a0_0_ff,
+op_90a8_0_ff,
+op_90b0_3_ff,
+op_90b8_0_ff,
+op_90b9_0_ff,
+op_90ba_0_ff,
+op_90bb_3_ff,
+op_90bc_0_ff,
+op_90c0_0_ff,
+op_90c8_0_ff,
+op_90d0_0_ff,
+op_90d8_0_ff,
+op_90e0_0_ff,
+op_90e8_0_ff,
+op_90f0_3_ff,
+op_90f8_0_ff,
+op_90f9_0_ff,
+op_90fa_0_ff,
+op_90fb_3_ff,
+op_90fc_0_ff,
+op_9100_0_ff,
+op_9108_0_ff,
+op_9110_0_ff,
+op_9118_0_ff,
+op_9120_0_ff,
+op_9128_0_ff,
+op_9130_3_ff,
+op_9138_0_ff,
+op_9139_0_ff,
+op_9140_0_ff,
+op_9148_0_ff,
+op_9150_0_ff,
+op_9158_0_ff,
+op_9160_0_ff,
+op_9168_0_ff,
+op_9170_3_ff,
+op_9178_0_ff,
+op_9179_0_ff,
+op_9180_0_ff,
+op_9188_0_ff,
+op_9190_0_ff,
+op_9198_0_ff,
+op_91a0_0_ff,
+op_91a8_0_ff,
+op_91b0_3_ff,
+op_91b8_0_ff,
+op_91b9_0_ff,
+op_91c0_0_ff,
+op_91c8_0_ff,
+op_91d0_0_ff,
+op_91d8_0_ff,
+op_91e0_0_ff,
+op_91e8_0_ff,
+op_91f0_3_ff,
+op_91f8_0_ff,
+op_91f9_0_ff,
+op_91fa_0_ff,
+op_91fb_3_ff,
+op_91fc_0_ff,
+op_b000_0_ff,
+op_b010_0_ff,
+op_b018_0_ff,
+op_b020_0_ff,
+op_b028_0_ff,
+op_b030_3_ff,
+op_b038_0_ff,
+op_b039_0_ff,
+op_b03a_0_ff,
+op_b03b_3_ff,
+op_b03c_0_ff,
+op_b040_0_ff,
+op_b048_0_ff,
+op_b050_0_ff,
+op_b058_0_ff,
+op_b060_0_ff,
+op_b068_0_ff,
+op_b070_3_ff,
+op_b078_0_ff,
+op_b079_0_ff,
+op_b07a_0_ff,
+op_b07b_3_ff,
+op_b07c_0_ff,
+op_b080_0_ff,
+op_b088_0_ff,
+op_b090_0_ff,
+op_b098_0_ff,
+op_b0a0_0_ff,
+op_b0a8_0_ff,
+op_b0b0_3_ff,
+op_b0b8_0_ff,
+op_b0b9_0_ff,
+op_b0ba_0_ff,
+op_b0bb_3_ff,
+op_b0bc_0_ff,
+op_b0c0_0_ff,
+op_b0c8_0_ff,
+op_b0d0_0_ff,
+op_b0d8_0_ff,
+op_b0e0_0_ff,
+op_b0e8_0_ff,
+op_b0f0_3_ff,
+op_b0f8_0_ff,
+op_b0f9_0_ff,
+op_b0fa_0_ff,
+op_b0fb_3_ff,
+op_b0fc_0_ff,
+op_b100_0_ff,
+op_b108_0_ff,
+op_b110_0_ff,
+op_b118_0_ff,
+op_b120_0_ff,
+op_b128_0_ff,
+op_b130_3_ff,
+op_b138_0_ff,
+op_b139_0_ff,
+op_b140_0_ff,
+op_b148_0_ff,
+op_b150_0_ff,
+op_b158_0_ff,
+op_b160_0_ff,
+op_b168_0_ff,
+op_b170_3_ff,
+op_b178_0_ff,
+op_b179_0_ff,
+op_b180_0_ff,
+op_b188_0_ff,
+op_b190_0_ff,
+op_b198_0_ff,
+op_b1a0_0_ff,
+op_b1a8_0_ff,
+op_b1b0_3_ff,
+op_b1b8_0_ff,
+op_b1b9_0_ff,
+op_b1c0_0_ff,
+op_b1c8_0_ff,
+op_b1d0_0_ff,
+op_b1d8_0_ff,
+op_b1e0_0_ff,
+op_b1e8_0_ff,
+op_b1f0_3_ff,
+op_b1f8_0_ff,
+op_b1f9_0_ff,
+op_b1fa_0_ff,
+op_b1fb_3_ff,
+op_b1fc_0_ff,
+op_c000_0_ff,
+op_c010_0_ff,
+op_c018_0_ff,
+op_c020_0_ff,
+op_c028_0_ff,
+op_c030_3_ff,
+op_c038_0_ff,
+op_c039_0_ff,
+op_c03a_0_ff,
+op_c03b_3_ff,
+op_c03c_0_ff,
+op_c040_0_ff,
+op_c050_0_ff,
+op_c058_0_ff,
+op_c060_0_ff,
+op_c068_0_ff,
+op_c070_3_ff,
+op_c078_0_ff,
+op_c079_0_ff,
+op_c07a_0_ff,
+op_c07b_3_ff,
+op_c07c_0_ff,
+op_c080_0_ff,
+op_c090_0_ff,
+op_c098_0_ff,
+op_c0a0_0_ff,
+op_c0a8_0_ff,
+op_c0b0_3_ff,
+op_c0b8_0_ff,
+op_c0b9_0_ff,
+op_c0ba_0_ff,
+op_c0bb_3_ff,
+op_c0bc_0_ff,
+op_c0c0_0_ff,
+op_c0d0_0_ff,
+op_c0d8_0_ff,
+op_c0e0_0_ff,
+op_c0e8_0_ff,
+op_c0f0_3_ff,
+op_c0f8_0_ff,
+op_c0f9_0_ff,
+op_c0fa_0_ff,
+op_c0fb_3_ff,
+op_c0fc_0_ff,
+op_c100_1_ff,
+op_c108_1_ff,
+op_c110_0_ff,
+op_c118_0_ff,
+op_c120_0_ff,
+op_c128_0_ff,
+op_c130_3_ff,
+op_c138_0_ff,
+op_c139_0_ff,
+op_c140_0_ff,
+op_c148_0_ff,
+op_c150_0_ff,
+op_c158_0_ff,
+op_c160_0_ff,
+op_c168_0_ff,
+op_c170_3_ff,
+op_c178_0_ff,
+op_c179_0_ff,
+op_c188_0_ff,
+op_c190_0_ff,
+op_c198_0_ff,
+op_c1a0_0_ff,
+op_c1a8_0_ff,
+op_c1b0_3_ff,
+op_c1b8_0_ff,
+op_c1b9_0_ff,
+op_c1c0_0_ff,
+op_c1d0_0_ff,
+op_c1d8_0_ff,
+op_c1e0_0_ff,
+op_c1e8_0_ff,
+op_c1f0_3_ff,
+op_c1f8_0_ff,
+op_c1f9_0_ff,
+op_c1fa_0_ff,
+op_c1fb_3_ff,
+op_c1fc_0_ff,
+op_d000_0_ff,
+op_d010_0_ff,
+op_d018_0_ff,
+op_d020_0_ff,
+op_d028_0_ff,
+op_d030_3_ff,
+op_d038_0_ff,
+op_d039_0_ff,
+op_d03a_0_ff,
+op_d03b_3_ff,
+op_d03c_0_ff,
+op_d040_0_ff,
+op_d048_0_ff,
+op_d050_0_ff,
+op_d058_0_ff,
+op_d060_0_ff,
+op_d068_0_ff,
+op_d070_3_ff,
+op_d078_0_ff,
+op_d079_0_ff,
+op_d07a_0_ff,
+op_d07b_3_ff,
+op_d07c_0_ff,
+op_d080_0_ff,
+op_d088_0_ff,
+op_d090_0_ff,
+op_d098_0_ff,
+op_d0a0_0_ff,
+op_d0a8_0_ff,
+op_d0b0_3_ff,
+op_d0b8_0_ff,
+op_d0b9_0_ff,
+op_d0ba_0_ff,
+op_d0bb_3_ff,
+op_d0bc_0_ff,
+op_d0c0_0_ff,
+op_d0c8_0_ff,
+op_d0d0_0_ff,
+op_d0d8_0_ff,
+op_d0e0_0_ff,
+op_d0e8_0_ff,
+op_d0f0_3_ff,
+op_d0f8_0_ff,
+op_d0f9_0_ff,
+op_d0fa_0_ff,
+op_d0fb_3_ff,
+op_d0fc_0_ff,
+op_d100_0_ff,
+op_d108_0_ff,
+op_d110_0_ff,
+op_d118_0_ff,
+op_d120_0_ff,
+op_d128_0_ff,
+op_d130_3_ff,
+op_d138_0_ff,
+op_d139_0_ff,
+op_d140_0_ff,
+op_d148_0_ff,
+op_d150_0_ff,
+op_d158_0_ff,
+op_d160_0_ff,
+op_d168_0_ff,
+op_d170_3_ff,
+op_d178_0_ff,
+op_d179_0_ff,
+op_d180_0_ff,
+op_d188_0_ff,
+op_d190_0_ff,
+op_d198_0_ff,
+op_d1a0_0_ff,
+op_d1a8_0_ff,
+op_d1b0_3_ff,
+op_d1b8_0_ff,
+op_d1b9_0_ff,
+op_d1c0_0_ff,
+op_d1c8_0_ff,
+op_d1d0_0_ff,
+op_d1d8_0_ff,
+op_d1e0_0_ff,
+op_d1e8_0_ff,
+op_d1f0_3_ff,
+op_d1f8_0_ff,
+op_d1f9_0_ff,
+op_d1fa_0_ff,
+op_d1fb_3_ff,
+op_d1fc_0_ff,
+op_e000_0_ff,
+op_e008_0_ff,
+op_e010_0_ff,
+op_e018_0_ff,
+op_e020_0_ff,
+op_e028_0_ff,
+op_e030_0_ff,
+op_e038_0_ff,
+op_e040_0_ff,
+op_e048_0_ff,
+op_e050_0_ff,
+op_e058_0_ff,
+op_e060_0_ff,
+op_e068_0_ff,
+op_e070_0_ff,
+op_e078_0_ff,
+op_e080_0_ff,
+op_e088_0_ff,
+op_e090_0_ff,
+op_e098_0_ff,
+op_e0a0_0_ff,
+op_e0a8_0_ff,
+op_e0b0_0_ff,
+op_e0b8_0_ff,
+op_e0d0_0_ff,
+op_e0d8_0_ff,
+op_e0e0_0_ff,
+op_e0e8_0_ff,
+op_e0f0_3_ff,
+op_e0f8_0_ff,
+op_e0f9_0_ff,
+op_e100_0_ff,
+op_e108_0_ff,
+op_e110_0_ff,
+op_e118_0_ff,
+op_e120_0_ff,
+op_e128_0_ff,
+op_e130_0_ff,
+op_e138_0_ff,
+op_e140_0_ff,
+op_e148_0_ff,
+op_e150_0_ff,
+op_e158_0_ff,
+op_e160_0_ff,
+op_e168_0_ff,
+op_e170_0_ff,
+op_e178_0_ff,
+op_e180_0_ff,
+op_e188_0_ff,
+op_e190_0_ff,
+op_e198_0_ff,
+op_e1a0_0_ff,
+op_e1a8_0_ff,
+op_e1b0_0_ff,
+op_e1b8_0_ff,
+op_e1d0_0_ff,
+op_e1d8_0_ff,
+op_e1e0_0_ff,
+op_e1e8_0_ff,
+op_e1f0_3_ff,
+op_e1f8_0_ff,
+op_e1f9_0_ff,
+op_e2d0_0_ff,
+op_e2d8_0_ff,
+op_e2e0_0_ff,
+op_e2e8_0_ff,
+op_e2f0_3_ff,
+op_e2f8_0_ff,
+op_e2f9_0_ff,
+op_e3d0_0_ff,
+op_e3d8_0_ff,
+op_e3e0_0_ff,
+op_e3e8_0_ff,
+op_e3f0_3_ff,
+op_e3f8_0_ff,
+op_e3f9_0_ff,
+op_e4d0_0_ff,
+op_e4d8_0_ff,
+op_e4e0_0_ff,
+op_e4e8_0_ff,
+op_e4f0_3_ff,
+op_e4f8_0_ff,
+op_e4f9_0_ff,
+op_e5d0_0_ff,
+op_e5d8_0_ff,
+op_e5e0_0_ff,
+op_e5e8_0_ff,
+op_e5f0_3_ff,
+op_e5f8_0_ff,
+op_e5f9_0_ff,
+op_e6d0_0_ff,
+op_e6d8_0_ff,
+op_e6e0_0_ff,
+op_e6e8_0_ff,
+op_e6f0_3_ff,
+op_e6f8_0_ff,
+op_e6f9_0_ff,
+op_e7d0_0_ff,
+op_e7d8_0_ff,
+op_e7e0_0_ff,
+op_e7e8_0_ff,
+op_e7f0_3_ff,
+op_e7f8_0_ff,
+op_e7f9_0_ff,
+};
+static const uae_u16 op_dispatch_pages_4[] = {
+1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,6,7,8,0,0,9,0,0,0,
+10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,
+11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,
+13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,
+15,15,15,15,15,15,15,15,16,17,0,0,18,0,0,0,
+19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,
+20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,
+22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,
+24,24,24,24,24,24,24,24,25,26,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,
+29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,
+31,31,31,31,31,31,31,31,32,32,32,32,32,32,32,32,
+33,33,33,33,33,33,33,33,34,35,36,37,38,0,0,0,
+39,39,39,39,39,39,39,39,40,40,40,40,40,40,40,40,
+41,41,41,41,41,41,41,41,42,42,42,42,42,42,42,42,
+43,43,43,43,43,43,43,43,44,44,44,44,44,44,44,44,
+45,45,45,45,45,45,45,45,46,47,48,49,0,0,0,0,
+50,50,50,50,50,50,50,50,51,51,51,51,51,51,51,51,
+52,52,52,52,52,52,52,52,53,53,53,53,53,53,53,53,
+54,54,54,54,54,54,54,54,55,55,55,55,55,55,55,55,
+56,56,56,56,56,56,56,56,57,58,59,60,0,0,0,0,
+61,61,61,61,61,61,61,61,62,62,62,62,62,62,62,62,
+63,63,63,63,63,63,63,63,64,64,64,64,64,64,64,64,
+65,65,65,65,65,65,65,65,66,66,66,66,66,66,66,66,
+67,67,67,67,67,67,67,67,68,69,70,71,0,0,0,0,
+72,72,72,72,72,72,72,72,0,0,0,0,0,0,0,0,
+73,73,73,73,73,73,73,73,74,74,74,74,74,74,74,74,
+75,75,75,75,75,75,75,75,76,76,76,76,76,76,76,76,
+77,77,77,77,77,77,77,77,78,79,0,0,80,0,0,0,
+81,81,81,81,81,81,81,81,0,0,0,0,0,0,0,0,
+82,82,82,82,82,82,82,82,83,83,83,83,83,83,83,83,
+84,84,84,84,84,84,84,84,85,85,85,85,85,85,85,85,
+86,86,86,86,86,86,86,86,87,88,0,0,89,0,0,0,
+90,90,90,90,90,90,90,90,0,0,0,0,0,0,0,0,
+91,91,91,91,91,91,91,91,92,92,92,92,92,92,92,92,
+93,93,93,93,93,93,93,93,94,94,94,94,94,94,94,94,
+95,95,95,95,95,95,95,95,96,97,0,0,0,0,0,0,
+98,98,98,98,98,98,98,98,0,0,0,0,0,0,0,0,
+99,99,99,99,99,99,99,99,100,100,100,100,100,100,100,100,
+101,101,101,101,101,101,101,101,102,102,102,102,102,102,102,102,
+103,103,103,103,103,103,103,103,104,105,0,0,0,0,0,0,
+106,106,106,106,106,106,106,106,0,0,0,0,0,0,0,0,
+107,107,107,107,107,107,107,107,108,108,108,108,108,108,108,108,
+109,109,109,109,109,109,109,109,110,110,110,110,110,110,110,110,
+111,111,111,111,111,111,111,111,112,113,0,0,0,0,0,0,
+114,114,114,114,114,114,114,114,0,0,0,0,0,0,0,0,
+115,115,115,115,115,115,115,115,116,116,116,116,116,116,116,116,
+117,117,117,117,117,117,117,117,118,118,118,118,118,118,118,118,
+119,119,119,119,119,119,119,119,120,121,0,0,0,0,0,0,
+122,122,122,122,122,122,122,122,0,0,0,0,0,0,0,0,
+123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+125,125,125,125,125,125,125,125,126,126,126,126,126,126,126,126,
+127,127,127,127,127,127,127,127,128,129,0,0,0,0,0,0,
+130,130,130,130,130,130,130,130,0,0,0,0,0,0,0,0,
+131,131,131,131,131,131,131,131,132,132,132,132,132,132,132,132,
+133,133,133,133,133,133,133,133,134,134,134,134,134,134,134,134,
+135,135,135,135,135,135,135,135,136,137,0,0,0,0,0,0,
+138,138,138,138,138,138,138,138,0,0,0,0,0,0,0,0,
+139,139,139,139,139,139,139,139,140,140,140,140,140,140,140,140,
+141,141,141,141,141,141,141,141,142,142,142,142,142,142,142,142,
+143,143,143,143,143,143,143,143,144,145,0,0,0,0,0,0,
+146,146,146,146,146,146,146,146,0,0,0,0,0,0,0,0,
+147,147,147,147,147,147,147,147,148,148,148,148,148,148,148,148,
+149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150,
+151,151,151,151,151,151,151,151,152,153,154,155,156,0,0,0,
+157,157,157,157,157,157,157,157,0,0,0,0,0,0,0,0,
+158,158,158,158,158,158,158,158,159,159,159,159,159,159,159,159,
+160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,161,
+162,162,162,162,162,162,162,162,163,164,165,166,0,0,0,0,
+167,167,167,167,167,167,167,167,0,0,0,0,0,0,0,0,
+168,168,168,168,168,168,168,168,169,169,169,169,169,169,169,169,
+170,170,170,170,170,170,170,170,171,171,171,171,171,171,171,171,
+172,172,172,172,172,172,172,172,173,174,175,176,0,0,0,0,
+177,177,177,177,177,177,177,177,0,0,0,0,0,0,0,0,
+178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,
+180,180,180,180,180,180,180,180,181,181,181,181,181,181,181,181,
+182,182,182,182,182,182,182,182,183,184,185,186,0,0,0,0,
+187,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,
+188,188,188,188,188,188,188,188,189,189,189,189,189,189,189,189,
+190,190,190,190,190,190,190,190,191,191,191,191,191,191,191,191,
+192,192,192,192,192,192,192,192,193,194,0,0,195,0,0,0,
+196,196,196,196,196,196,196,196,0,0,0,0,0,0,0,0,
+197,197,197,197,197,197,197,197,198,198,198,198,198,198,198,198,
+199,199,199,199,199,199,199,199,200,200,200,200,200,200,200,200,
+201,201,201,201,201,201,201,201,202,203,0,0,204,0,0,0,
+205,205,205,205,205,205,205,205,0,0,0,0,0,0,0,0,
+206,206,206,206,206,206,206,206,207,207,207,207,207,207,207,207,
+208,208,208,208,208,208,208,208,209,209,209,209,209,209,209,209,
+210,210,210,210,210,210,210,210,211,212,0,0,0,0,0,0,
+213,213,213,213,213,213,213,213,0,0,0,0,0,0,0,0,
+214,214,214,214,214,214,214,214,215,215,215,215,215,215,215,215,
+216,216,216,216,216,216,216,216,217,217,217,217,217,217,217,217,
+218,218,218,218,218,218,218,218,219,220,221,222,0,0,0,0,
+223,223,223,223,223,223,223,223,0,0,0,0,0,0,0,0,
+224,224,224,224,224,224,224,224,225,225,225,225,225,225,225,225,
+226,226,226,226,226,226,226,226,227,227,227,227,227,227,227,227,
+228,228,228,228,228,228,228,228,229,230,231,232,0,0,0,0,
+233,233,233,233,233,233,233,233,0,0,0,0,0,0,0,0,
+234,234,234,234,234,234,234,234,235,235,235,235,235,235,235,235,
+236,236,236,236,236,236,236,236,237,237,237,237,237,237,237,237,
+238,238,238,238,238,238,238,238,239,240,241,242,0,0,0,0,
+243,243,243,243,243,243,243,243,0,0,0,0,0,0,0,0,
+244,244,244,244,244,244,244,244,245,245,245,245,245,245,245,245,
+246,246,246,246,246,246,246,246,247,247,247,247,247,247,247,247,
+248,248,248,248,248,248,248,248,249,250,251,252,253,0,0,0,
+254,254,254,254,254,254,254,254,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,256,256,256,256,256,256,256,256,
+257,257,257,257,257,257,257,257,258,258,258,258,258,258,258,258,
+259,259,259,259,259,259,259,259,260,261,262,263,264,0,0,0,
+265,265,265,265,265,265,265,265,0,0,0,0,0,0,0,0,
+266,266,266,266,266,266,266,266,267,267,267,267,267,267,267,267,
+268,268,268,268,268,268,268,268,269,269,269,269,269,269,269,269,
+270,270,270,270,270,270,270,270,271,272,273,274,275,0,0,0,
+276,276,276,276,276,276,276,276,0,0,0,0,0,0,0,0,
+277,277,277,277,277,277,277,277,278,278,278,278,278,278,278,278,
+279,279,279,279,279,279,279,279,280,280,280,280,280,280,280,280,
+281,281,281,281,281,281,281,281,282,283,284,285,286,0,0,0,
+287,287,287,287,287,287,287,287,0,0,0,0,0,0,0,0,
+288,288,288,288,288,288,288,288,289,289,289,289,289,289,289,289,
+290,290,290,290,290,290,290,290,291,291,291,291,291,291,291,291,
+292,292,292,292,292,292,292,292,293,294,295,296,297,0,0,0,
+298,298,298,298,298,298,298,298,0,0,0,0,0,0,0,0,
+299,299,299,299,299,299,299,299,300,300,300,300,300,300,300,300,
+301,301,301,301,301,301,301,301,302,302,302,302,302,302,302,302,
+303,303,303,303,303,303,303,303,304,305,306,307,308,0,0,0,
+309,309,309,309,309,309,309,309,0,0,0,0,0,0,0,0,
+310,310,310,310,310,310,310,310,311,311,311,311,311,311,311,311,
+312,312,312,312,312,312,312,312,313,313,313,313,313,313,313,313,
+314,314,314,314,314,314,314,314,315,316,317,318,319,0,0,0,
+320,320,320,320,320,320,320,320,0,0,0,0,0,0,0,0,
+321,321,321,321,321,321,321,321,322,322,322,322,322,322,322,322,
+323,323,323,323,323,323,323,323,324,324,324,324,324,324,324,324,
+325,325,325,325,325,325,325,325,326,327,328,329,330,0,0,0,
+331,331,331,331,331,331,331,331,332,332,332,332,332,332,332,332,
+333,333,333,333,333,333,333,333,334,334,334,334,334,334,334,334,
+335,335,335,335,335,335,335,335,336,336,336,336,336,336,336,336,
+337,337,337,337,337,337,337,337,338,339,340,341,342,0,0,0,
+343,343,343,343,343,343,343,343,344,344,344,344,344,344,344,344,
+345,345,345,345,345,345,345,345,346,346,346,346,346,346,346,346,
+347,347,347,347,347,347,347,347,348,348,348,348,348,348,348,348,
+349,349,349,349,349,349,349,349,350,351,352,353,354,0,0,0,
+355,355,355,355,355,355,355,355,356,356,356,356,356,356,356,356,
+357,357,357,357,357,357,357,357,358,358,358,358,358,358,358,358,
+359,359,359,359,359,359,359,359,360,360,360,360,360,360,360,360,
+361,361,361,361,361,361,361,361,362,363,364,365,366,0,0,0,
+367,367,367,367,367,367,367,367,368,368,368,368,368,368,368,368,
+369,369,369,369,369,369,369,369,370,370,370,370,370,370,370,370,
+371,371,371,371,371,371,371,371,372,372,372,372,372,372,372,372,
+373,373,373,373,373,373,373,373,374,375,376,377,378,0,0,0,
+379,379,379,379,379,379,379,379,380,380,380,380,380,380,380,380,
+381,381,381,381,381,381,381,381,382,382,382,382,382,382,382,382,
+383,383,383,383,383,383,383,383,384,384,384,384,384,384,384,384,
+385,385,385,385,385,385,385,385,386,387,388,389,390,0,0,0,
+391,391,391,391,391,391,391,391,392,392,392,392,392,392,392,392,
+393,393,393,393,393,393,393,393,394,394,394,394,394,394,394,394,
+395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,
+397,397,397,397,397,397,397,397,398,399,400,401,402,0,0,0,
+403,403,403,403,403,403,403,403,404,404,404,404,404,404,404,404,
+405,405,405,405,405,405,405,405,406,406,406,406,406,406,406,406,
+407,407,407,407,407,407,407,407,408,408,408,408,408,408,408,408,
+409,409,409,409,409,409,409,409,410,411,412,413,414,0,0,0,
+415,415,415,415,415,415,415,415,416,416,416,416,416,416,416,416,
+417,417,417,417,417,417,417,417,418,418,418,418,418,418,418,418,
+419,419,419,419,419,419,419,419,420,420,420,420,420,420,420,420,
+421,421,421,421,421,421,421,421,422,423,424,425,426,0,0,0,
+427,427,427,427,427,427,427,427,428,428,428,428,428,428,428,428,
+429,429,429,429,429,429,429,429,430,430,430,430,430,430,430,430,
+431,431,431,431,431,431,431,431,432,432,432,432,432,432,432,432,
+433,433,433,433,433,433,433,433,434,435,436,437,438,0,0,0,
+439,439,439,439,439,439,439,439,440,440,440,440,440,440,440,440,
+441,441,441,441,441,441,441,441,442,442,442,442,442,442,442,442,
+443,443,443,443,443,443,443,443,444,444,444,444,444,444,444,444,
+445,445,445,445,445,445,445,445,446,447,448,449,450,0,0,0,
+451,451,451,451,451,451,451,451,452,452,452,452,452,452,452,452,
+453,453,453,453,453,453,453,453,454,454,454,454,454,454,454,454,
+455,455,455,455,455,455,455,455,456,456,456,456,456,456,456,456,
+457,457,457,457,457,457,457,457,458,459,460,461,462,0,0,0,
+463,463,463,463,463,463,463,463,464,464,464,464,464,464,464,464,
+465,465,465,465,465,465,465,465,466,466,466,466,466,466,466,466,
+467,467,467,467,467,467,467,467,468,468,468,468,468,468,468,468,
+469,469,469,469,469,469,469,469,470,471,472,473,474,0,0,0,
+475,475,475,475,475,475,475,475,476,476,476,476,476,476,476,476,
+477,477,477,477,477,477,477,477,478,478,478,478,478,478,478,478,
+479,479,479,479,479,479,479,479,480,480,480,480,480,480,480,480,
+481,481,481,481,481,481,481,481,482,483,484,485,486,0,0,0,
+487,487,487,487,487,487,487,487,488,488,488,488,488,488,488,488,
+489,489,489,489,489,489,489,489,490,490,490,490,490,490,490,490,
+491,491,491,491,491,491,491,491,492,492,492,492,492,492,492,492,
+493,493,493,493,493,493,493,493,494,495,496,497,498,0,0,0,
+499,499,499,499,499,499,499,499,500,500,500,500,500,500,500,500,
+501,501,501,501,501,501,501,501,502,502,502,502,502,502,502,502,
+503,503,503,503,503,503,503,503,504,504,504,504,504,504,504,504,
+505,505,505,505,505,505,505,505,506,507,508,509,510,0,0,0,
+511,511,511,511,511,511,511,511,512,512,512,512,512,512,512,512,
+513,513,513,513,513,513,513,513,514,514,514,514,514,514,514,514,
+515,515,515,515,515,515,515,515,516,516,516,516,516,516,516,516,
+517,517,517,517,517,517,517,517,518,519,520,521,522,0,0,0,
+523,523,523,523,523,523,523,523,524,524,524,524,524,524,524,524,
+525,525,525,525,525,525,525,525,526,526,526,526,526,526,526,526,
+527,527,527,527,527,527,527,527,528,528,528,528,528,528,528,528,
+529,529,529,529,529,529,529,529,530,531,532,533,534,0,0,0,
+535,535,535,535,535,535,535,535,536,536,536,536,536,536,536,536,
+537,537,537,537,537,537,537,537,538,538,538,538,538,538,538,538,
+539,539,539,539,539,539,539,539,540,540,540,540,540,540,540,540,
+541,541,541,541,541,541,541,541,542,543,544,545,546,0,0,0,
+547,547,547,547,547,547,547,547,0,0,0,0,0,0,0,0,
+548,548,548,548,548,548,548,548,549,549,549,549,549,549,549,549,
+550,550,550,550,550,550,550,550,551,551,551,551,551,551,551,551,
+552,552,552,552,552,552,552,552,553,554,0,0,0,0,0,0,
+555,555,555,555,555,555,555,555,0,0,0,0,0,0,0,0,
+556,556,556,556,556,556,556,556,557,557,557,557,557,557,557,557,
+558,558,558,558,558,558,558,558,559,559,559,559,559,559,559,559,
+560,560,560,560,560,560,560,560,561,562,0,0,0,0,0,0,
+563,563,563,563,563,563,563,563,0,0,0,0,0,0,0,0,
+564,564,564,564,564,564,564,564,565,565,565,565,565,565,565,565,
+566,566,566,566,566,566,566,566,567,567,567,567,567,567,567,567,
+568,568,568,568,568,568,568,568,569,570,0,0,0,0,0,0,
+571,571,571,571,571,571,571,571,0,0,0,0,0,0,0,0,
+572,572,572,572,572,572,572,572,573,573,573,573,573,573,573,573,
+574,574,574,574,574,574,574,574,575,575,575,575,575,575,575,575,
+576,576,576,576,576,576,576,576,577,578,0,0,0,0,0,0,
+579,579,579,579,579,579,579,579,0,0,0,0,0,0,0,0,
+580,580,580,580,580,580,580,580,581,581,581,581,581,581,581,581,
+582,582,582,582,582,582,582,582,583,583,583,583,583,583,583,583,
+584,584,584,584,584,584,584,584,585,586,587,588,589,0,0,0,
+590,590,590,590,590,590,590,590,0,0,0,0,0,0,0,0,
+591,591,591,591,591,591,591,591,592,592,592,592,592,592,592,592,
+593,593,593,593,593,593,593,593,594,594,594,594,594,594,594,594,
+595,595,595,595,595,595,595,595,596,597,598,599,600,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+601,601,601,601,601,601,601,601,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,0,0,0,0,
+608,608,608,608,608,608,608,608,0,0,0,0,0,0,0,0,
+609,609,609,609,609,609,609,609,610,610,610,610,610,610,610,610,
+611,611,611,611,611,611,611,611,612,612,612,612,612,612,612,612,
+613,613,613,613,613,613,613,613,614,615,0,0,0,0,0,0,
+616,616,616,616,616,616,616,616,0,0,0,0,0,0,0,0,
+617,617,617,617,617,617,617,617,618,618,618,618,618,618,618,618,
+619,619,619,619,619,619,619,619,620,620,620,620,620,620,620,620,
+621,621,621,621,621,621,621,621,622,623,0,0,0,0,0,0,
+624,624,624,624,624,624,624,624,0,0,0,0,0,0,0,0,
+625,625,625,625,625,625,625,625,626,626,626,626,626,626,626,626,
+627,627,627,627,627,627,627,627,628,628,628,628,628,628,628,628,
+629,629,629,629,629,629,629,629,630,631,0,0,0,0,0,0,
+632,632,632,632,632,632,632,632,0,0,0,0,0,0,0,0,
+633,633,633,633,633,633,633,633,634,634,634,634,634,634,634,634,
+635,635,635,635,635,635,635,635,636,636,636,636,636,636,636,636,
+637,637,637,637,637,637,637,637,638,639,0,0,0,0,0,0,
+640,640,640,640,640,640,640,640,0,0,0,0,0,0,0,0,
+641,641,641,641,641,641,641,641,642,642,642,642,642,642,642,642,
+643,643,643,643,643,643,643,643,644,644,644,644,644,644,644,644,
+645,645,645,645,645,645,645,645,646,647,0,0,0,0,0,0,
+648,648,648,648,648,648,648,648,0,0,0,0,0,0,0,0,
+649,649,649,649,649,649,649,649,650,650,650,650,650,650,650,650,
+651,651,651,651,651,651,651,651,652,652,652,652,652,652,652,652,
+653,653,653,653,653,653,653,653,654,655,0,0,0,0,0,0,
+656,656,656,656,656,656,656,656,0,0,0,0,0,0,0,0,
+657,657,657,657,657,657,657,657,658,658,658,658,658,658,658,658,
+659,659,659,659,659,659,659,659,660,660,660,660,660,660,660,660,
+661,661,661,661,661,661,661,661,662,663,664,665,666,0,0,0,
+667,667,667,667,667,667,667,667,0,0,0,0,0,0,0,0,
+668,668,668,668,668,668,668,668,669,669,669,669,669,669,669,669,
+670,670,670,670,670,670,670,670,671,671,671,671,671,671,671,671,
+672,672,672,672,672,672,672,672,673,674,0,0,0,0,0,0,
+675,675,675,675,675,675,675,675,0,0,0,0,0,0,0,0,
+676,676,676,676,676,676,676,676,677,677,677,677,677,677,677,677,
+678,678,678,678,678,678,678,678,679,679,679,679,679,679,679,679,
+680,680,680,680,680,680,680,680,681,682,0,0,0,0,0,0,
+683,683,683,683,683,683,683,683,0,0,0,0,0,0,0,0,
+684,684,684,684,684,684,684,684,685,685,685,685,685,685,685,685,
+686,686,686,686,686,686,686,686,687,687,687,687,687,687,687,687,
+688,688,688,688,688,688,688,688,689,690,0,0,0,0,0,0,
+691,691,691,691,691,691,691,691,0,0,0,0,0,0,0,0,
+692,692,692,692,692,692,692,692,693,693,693,693,693,693,693,693,
+694,694,694,694,694,694,694,694,695,695,695,695,695,695,695,695,
+696,696,696,696,696,696,696,696,697,698,699,700,701,0,0,0,
+702,702,702,702,702,702,702,702,0,0,0,0,0,0,0,0,
+703,703,703,703,703,703,703,703,704,704,704,704,704,704,704,704,
+705,705,705,705,705,705,705,705,706,706,706,706,706,706,706,706,
+707,707,707,707,707,707,707,707,708,709,0,0,0,0,0,0,
+710,710,710,710,710,710,710,710,0,0,0,0,0,0,0,0,
+711,711,711,711,711,711,711,711,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,712,712,712,712,712,712,712,712,
+713,713,713,713,713,713,713,713,714,715,716,717,0,0,0,0,
+718,718,718,718,718,718,718,718,0,0,0,0,0,0,0,0,
+719,719,719,719,719,719,719,719,0,0,0,0,0,0,0,0,
+720,720,720,720,720,720,720,720,721,721,721,721,721,721,721,721,
+722,722,722,722,722,722,722,722,723,724,0,0,0,0,0,0,
+725,725,725,725,725,725,725,725,0,0,0,0,0,0,0,0,
+726,726,726,726,726,726,726,726,0,0,0,0,0,0,0,0,
+727,727,727,727,727,727,727,727,728,728,728,728,728,728,728,728,
+729,729,729,729,729,729,729,729,730,731,0,0,0,0,0,0,
+732,732,732,732,732,732,732,732,0,0,0,0,0,0,0,0,
+601,601,601,601,601,601,601,601,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,602,602,602,602,602,602,602,602,
+603,603,603,603,603,603,603,603,604,605,606,607,0,0,0,0,
+733,733,733,733,733,733,733,733,0,0,0,0,0,0,0,0,
+734,734,734,734,734,734,734,734,735,735,735,735,735,735,735,735,
+736,736,736,736,736,736,736,736,737,737,737,737,737,737,737,737,
+738,738,738,738,738,738,738,738,739,740,741,742,743,0,0,0,
+744,744,744,744,744,744,744,744,745,745,745,745,745,745,745,745,
+746,746,746,746,746,746,746,746,747,747,747,747,747,747,747,747,
+748,748,748,748,748,748,748,748,749,749,749,749,749,749,749,749,
+750,750,750,750,750,750,750,750,751,752,753,754,755,0,0,0,
+756,756,756,756,756,756,756,756,757,757,757,757,757,757,757,757,
+758,758,758,758,758,758,758,758,759,759,759,759,759,759,759,759,
+760,760,760,760,760,760,760,760,761,761,761,761,761,761,761,761,
+762,762,762,762,762,762,762,762,763,764,765,766,767,0,0,0,
+768,768,768,768,768,768,768,768,0,0,0,0,0,0,0,0,
+769,769,769,769,769,769,769,769,770,770,770,770,770,770,770,770,
+771,771,771,771,771,771,771,771,772,772,772,772,772,772,772,772,
+773,773,773,773,773,773,773,773,774,775,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+776,776,776,776,776,776,776,776,777,777,777,777,777,777,777,777,
+0,0,0,0,0,0,0,0,778,778,778,778,778,778,778,778,
+779,779,779,779,779,779,779,779,780,781,782,783,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+784,784,784,784,784,784,784,784,785,785,785,785,785,785,785,785,
+0,0,0,0,0,0,0,0,786,786,786,786,786,786,786,786,
+787,787,787,787,787,787,787,787,788,789,790,791,0,0,0,0,
+792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+793,793,793,793,793,793,793,793,794,794,794,794,794,794,794,794,
+795,795,795,795,795,795,795,795,796,796,796,796,796,796,796,796,
+797,798,799,800,801,802,803,804,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+805,805,805,805,805,805,805,805,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,806,806,806,806,806,806,806,806,
+807,807,807,807,807,807,807,807,808,809,810,811,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+812,812,812,812,812,812,812,812,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,813,813,813,813,813,813,813,813,
+814,814,814,814,814,814,814,814,815,816,817,818,0,0,0,0,
+819,819,819,819,819,819,819,819,0,0,0,0,0,0,0,0,
+820,820,820,820,820,820,820,820,821,821,821,821,821,821,821,821,
+822,822,822,822,822,822,822,822,823,823,823,823,823,823,823,823,
+824,824,824,824,824,824,824,824,825,826,0,0,0,0,0,0,
+827,827,827,827,827,827,827,827,828,828,828,828,828,828,828,828,
+829,829,829,829,829,829,829,829,830,830,830,830,830,830,830,830,
+831,831,831,831,831,831,831,831,832,832,832,832,832,832,832,832,
+833,833,833,833,833,833,833,833,834,835,0,0,0,0,0,0,
+836,836,836,836,836,836,836,836,837,837,837,837,837,837,837,837,
+838,838,838,838,838,838,838,838,839,839,839,839,839,839,839,839,
+840,840,840,840,840,840,840,840,841,841,841,841,841,841,841,841,
+842,842,842,842,842,842,842,842,843,844,0,0,0,0,0,0,
+845,845,845,845,845,845,845,845,846,846,846,846,846,846,846,846,
+847,847,847,847,847,847,847,847,848,848,848,848,848,848,848,848,
+849,849,849,849,849,849,849,849,850,850,850,850,850,850,850,850,
+851,851,851,851,851,851,851,851,852,853,0,0,0,0,0,0,
+854,854,854,854,854,854,854,854,0,0,0,0,0,0,0,0,
+855,855,855,855,855,855,855,855,856,856,856,856,856,856,856,856,
+857,857,857,857,857,857,857,857,858,858,858,858,858,858,858,858,
+859,859,859,859,859,859,859,859,860,861,0,0,0,0,0,0,
+862,862,862,862,862,862,862,862,863,863,863,863,863,863,863,863,
+864,864,864,864,864,864,864,864,865,865,865,865,865,865,865,865,
+866,866,866,866,866,866,866,866,867,867,867,867,867,867,867,867,
+868,868,868,868,868,868,868,868,869,870,0,0,0,0,0,0,
+871,871,871,871,871,871,871,871,872,872,872,872,872,872,872,872,
+873,873,873,873,873,873,873,873,874,874,874,874,874,874,874,874,
+875,875,875,875,875,875,875,875,876,876,876,876,876,876,876,876,
+877,877,877,877,877,877,877,877,878,879,0,0,0,0,0,0,
+880,880,880,880,880,880,880,880,881,881,881,881,881,881,881,881,
+882,882,882,882,882,882,882,882,883,883,883,883,883,883,883,883,
+884,884,884,884,884,884,884,884,885,885,885,885,885,885,885,885,
+886,886,886,886,886,886,886,886,887,888,0,0,0,0,0,0,
+889,889,889,889,889,889,889,889,890,890,890,890,890,890,890,890,
+891,891,891,891,891,891,891,891,892,892,892,892,892,892,892,892,
+893,893,893,893,893,893,893,893,894,894,894,894,894,894,894,894,
+895,895,895,895,895,895,895,895,896,897,0,0,0,0,0,0,
+898,898,898,898,898,898,898,898,899,899,899,899,899,899,899,899,
+900,900,900,900,900,900,900,900,901,901,901,901,901,901,901,901,
+902,902,902,902,902,902,902,902,903,903,903,903,903,903,903,903,
+904,904,904,904,904,904,904,904,905,906,0,0,0,0,0,0,
+907,907,907,907,907,907,907,907,908,908,908,908,908,908,908,908,
+909,909,909,909,909,909,909,909,910,910,910,910,910,910,910,910,
+911,911,911,911,911,911,911,911,912,912,912,912,912,912,912,912,
+913,913,913,913,913,913,913,913,914,915,0,0,0,0,0,0,
+916,916,916,916,916,916,916,916,917,917,917,917,917,917,917,917,
+918,918,918,918,918,918,918,918,919,919,919,919,919,919,919,919,
+920,920,920,920,920,920,920,920,921,921,921,921,921,921,921,921,
+922,922,922,922,922,922,922,922,923,924,0,0,0,0,0,0,
+925,925,925,925,925,925,925,925,926,926,926,926,926,926,926,926,
+927,927,927,927,927,927,927,927,928,928,928,928,928,928,928,928,
+929,929,929,929,929,929,929,929,930,930,930,930,930,930,930,930,
+931,931,931,931,931,931,931,931,932,933,0,0,0,0,0,0,
+934,934,934,934,934,934,934,934,935,935,935,935,935,935,935,935,
+936,936,936,936,936,936,936,936,937,937,937,937,937,937,937,937,
+938,938,938,938,938,938,938,938,939,939,939,939,939,939,939,939,
+940,940,940,940,940,940,940,940,941,942,0,0,0,0,0,0,
+943,943,943,943,943,943,943,943,944,944,944,944,944,944,944,944,
+945,945,945,945,945,945,945,945,946,946,946,946,946,946,946,946,
+947,947,947,947,947,947,947,947,948,948,948,948,948,948,948,948,
+949,949,949,949,949,949,949,949,950,951,0,0,0,0,0,0,
+952,952,952,952,952,952,952,952,953,953,953,953,953,953,953,953,
+954,954,954,954,954,954,954,954,955,955,955,955,955,955,955,955,
+956,956,956,956,956,956,956,956,957,957,957,957,957,957,957,957,
+958,958,958,958,958,958,958,958,959,960,0,0,0,0,0,0,
+961,961,961,961,961,961,961,961,962,962,962,962,962,962,962,962,
+963,963,963,963,963,963,963,963,964,964,964,964,964,964,964,964,
+965,965,965,965,965,965,965,965,966,966,966,966,966,966,966,966,
+967,967,967,967,967,967,967,967,968,969,0,0,0,0,0,0,
+970,970,970,970,970,970,970,970,971,971,971,971,971,971,971,971,
+972,972,972,972,972,972,972,972,973,973,973,973,973,973,973,973,
+974,974,974,974,974,974,974,974,975,975,975,975,975,975,975,975,
+976,976,976,976,976,976,976,976,977,978,0,0,0,0,0,0,
+979,979,979,979,979,979,979,979,980,980,980,980,980,980,980,980,
+981,981,981,981,981,981,981,981,982,982,982,982,982,982,982,982,
+983,983,983,983,983,983,983,983,984,984,984,984,984,984,984,984,
+985,985,985,985,985,985,985,985,986,987,0,0,0,0,0,0,
+988,988,988,988,988,988,988,988,989,989,989,989,989,989,989,989,
+990,990,990,990,990,990,990,990,991,991,991,991,991,991,991,991,
+992,992,992,992,992,992,992,992,993,993,993,993,993,993,993,993,
+994,994,994,994,994,994,994,994,995,996,0,0,0,0,0,0,
+997,997,997,997,997,997,997,997,998,998,998,998,998,998,998,998,
+999,999,999,999,999,999,999,999,1000,1000,1000,1000,1000,1000,1000,1000,
+1001,1001,1001,1001,1001,1001,1001,1001,1002,1002,1002,1002,1002,1002,1002,1002,
+1003,1003,1003,1003,1003,1003,1003,1003,1004,1005,0,0,0,0,0,0,
+1006,1006,1006,1006,1006,1006,1006,1006,1007,1007,1007,1007,1007,1007,1007,1007,
+1008,1008,1008,1008,1008,1008,1008,1008,1009,1009,1009,1009,1009,1009,1009,1009,
+1010,1010,1010,1010,1010,1010,1010,1010,1011,1011,1011,1011,1011,1011,1011,1011,
+1012,1012,1012,1012,1012,1012,1012,1012,1013,1014,0,0,0,0,0,0,
+1015,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,
+1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1016,1017,
+1018,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1020,
+1021,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,
+1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1022,1023,
+1024,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1026,
+1027,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,
+1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1028,1029,
+1030,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,
+1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1032,
+1033,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,
+1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1034,1035,
+1036,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,
+1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1037,1038,
+1039,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1041,
+1042,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,
+1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1043,1044,
+1045,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,
+1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1047,
+1048,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,
+1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1049,1050,
+1051,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,
+1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1052,1053,
+1054,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,
+1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1055,1056,
+1057,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,
+1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1058,1059,
+1060,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,
+1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1061,1062,
+1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,
+1064,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,1065,
+1066,1066,1066,1066,1066,1066,1066,1066,0,0,0,0,0,0,0,0,
+1067,1067,1067,1067,1067,1067,1067,1067,1068,1068,1068,1068,1068,1068,1068,1068,
+1069,1069,1069,1069,1069,1069,1069,1069,1070,1070,1070,1070,1070,1070,1070,1070,
+1071,1071,1071,1071,1071,1071,1071,1071,1072,1073,1074,1075,1076,0,0,0,
+1077,1077,1077,1077,1077,1077,1077,1077,0,0,0,0,0,0,0,0,
+1078,1078,1078,1078,1078,1078,1078,1078,1079,1079,1079,1079,1079,1079,1079,1079,
+1080,1080,1080,1080,1080,1080,1080,1080,1081,1081,1081,1081,1081,1081,1081,1081,
+1082,1082,1082,1082,1082,1082,1082,1082,1083,1084,1085,1086,1087,0,0,0,
+1088,1088,1088,1088,1088,1088,1088,1088,0,0,0,0,0,0,0,0,
+1089,1089,1089,1089,1089,1089,1089,1089,1090,1090,1090,1090,1090,1090,1090,1090,
+1091,1091,1091,1091,1091,1091,1091,1091,1092,1092,1092,1092,1092,1092,1092,1092,
+1093,1093,1093,1093,1093,1093,1093,1093,1094,1095,1096,1097,1098,0,0,0,
+1099,1099,1099,1099,1099,1099,1099,1099,0,0,0,0,0,0,0,0,
+1100,1100,1100,1100,1100,1100,1100,1100,1101,1101,1101,1101,1101,1101,1101,1101,
+1102,1102,1102,1102,1102,1102,1102,1102,1103,1103,1103,1103,1103,1103,1103,1103,
+1104,1104,1104,1104,1104,1104,1104,1104,1105,1106,1107,1108,1109,0,0,0,
+1110,1110,1110,1110,1110,1110,1110,1110,1111,1111,1111,1111,1111,1111,1111,1111,
+1112,1112,1112,1112,1112,1112,1112,1112,1113,1113,1113,1113,1113,1113,1113,1113,
+1114,1114,1114,1114,1114,1114,1114,1114,1115,1115,1115,1115,1115,1115,1115,1115,
+1116,1116,1116,1116,1116,1116,1116,1116,1117,1118,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1119,1119,1119,1119,1119,1119,1119,1119,1120,1120,1120,1120,1120,1120,1120,1120,
+1121,1121,1121,1121,1121,1121,1121,1121,1122,1122,1122,1122,1122,1122,1122,1122,
+1123,1123,1123,1123,1123,1123,1123,1123,1124,1125,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1126,1126,1126,1126,1126,1126,1126,1126,1127,1127,1127,1127,1127,1127,1127,1127,
+1128,1128,1128,1128,1128,1128,1128,1128,1129,1129,1129,1129,1129,1129,1129,1129,
+1130,1130,1130,1130,1130,1130,1130,1130,1131,1132,0,0,0,0,0,0,
+1133,1133,1133,1133,1133,1133,1133,1133,0,0,0,0,0,0,0,0,
+1134,1134,1134,1134,1134,1134,1134,1134,1135,1135,1135,1135,1135,1135,1135,1135,
+1136,1136,1136,1136,1136,1136,1136,1136,1137,1137,1137,1137,1137,1137,1137,1137,
+1138,1138,1138,1138,1138,1138,1138,1138,1139,1140,1141,1142,1143,0,0,0,
+1144,1144,1144,1144,1144,1144,1144,1144,0,0,0,0,0,0,0,0,
+1145,1145,1145,1145,1145,1145,1145,1145,1146,1146,1146,1146,1146,1146,1146,1146,
+1147,1147,1147,1147,1147,1147,1147,1147,1148,1148,1148,1148,1148,1148,1148,1148,
+1149,1149,1149,1149,1149,1149,1149,1149,1150,1151,1152,1153,1154,0,0,0,
+1155,1155,1155,1155,1155,1155,1155,1155,1156,1156,1156,1156,1156,1156,1156,1156,
+1157,1157,1157,1157,1157,1157,1157,1157,1158,1158,1158,1158,1158,1158,1158,1158,
+1159,1159,1159,1159,1159,1159,1159,1159,1160,1160,1160,1160,1160,1160,1160,1160,
+1161,1161,1161,1161,1161,1161,1161,1161,1162,1163,1164,1165,1166,0,0,0,
+1167,1167,1167,1167,1167,1167,1167,1167,1168,1168,1168,1168,1168,1168,1168,1168,
+1169,1169,1169,1169,1169,1169,1169,1169,1170,1170,1170,1170,1170,1170,1170,1170,
+1171,1171,1171,1171,1171,1171,1171,1171,1172,1172,1172,1172,1172,1172,1172,1172,
+1173,1173,1173,1173,1173,1173,1173,1173,1174,1175,1176,1177,1178,0,0,0,
+1179,1179,1179,1179,1179,1179,1179,1179,1180,1180,1180,1180,1180,1180,1180,1180,
+1181,1181,1181,1181,1181,1181,1181,1181,1182,1182,1182,1182,1182,1182,1182,1182,
+1183,1183,1183,1183,1183,1183,1183,1183,1184,1184,1184,1184,1184,1184,1184,1184,
+1185,1185,1185,1185,1185,1185,1185,1185,1186,1187,1188,1189,1190,0,0,0,
+1191,1191,1191,1191,1191,1191,1191,1191,1192,1192,1192,1192,1192,1192,1192,1192,
+1193,1193,1193,1193,1193,1193,1193,1193,1194,1194,1194,1194,1194,1194,1194,1194,
+1195,1195,1195,1195,1195,1195,1195,1195,1196,1196,1196,1196,1196,1196,1196,1196,
+1197,1197,1197,1197,1197,1197,1197,1197,1198,1199,0,0,0,0,0,0,
+1200,1200,1200,1200,1200,1200,1200,1200,1201,1201,1201,1201,1201,1201,1201,1201,
+1202,1202,1202,1202,1202,1202,1202,1202,1203,1203,1203,1203,1203,1203,1203,1203,
+1204,1204,1204,1204,1204,1204,1204,1204,1205,1205,1205,1205,1205,1205,1205,1205,
+1206,1206,1206,1206,1206,1206,1206,1206,1207,1208,0,0,0,0,0,0,
+1209,1209,1209,1209,1209,1209,1209,1209,1210,1210,1210,1210,1210,1210,1210,1210,
+1211,1211,1211,1211,1211,1211,1211,1211,1212,1212,1212,1212,1212,1212,1212,1212,
+1213,1213,1213,1213,1213,1213,1213,1213,1214,1214,1214,1214,1214,1214,1214,1214,
+1215,1215,1215,1215,1215,1215,1215,1215,1216,1217,0,0,0,0,0,0,
+1218,1218,1218,1218,1218,1218,1218,1218,1219,1219,1219,1219,1219,1219,1219,1219,
+1220,1220,1220,1220,1220,1220,1220,1220,1221,1221,1221,1221,1221,1221,1221,1221,
+1222,1222,1222,1222,1222,1222,1222,1222,1223,1223,1223,1223,1223,1223,1223,1223,
+1224,1224,1224,1224,1224,1224,1224,1224,1225,1226,1227,1228,1229,0,0,0,
+1230,1230,1230,1230,1230,1230,1230,1230,0,0,0,0,0,0,0,0,
+1231,1231,1231,1231,1231,1231,1231,1231,1232,1232,1232,1232,1232,1232,1232,1232,
+1233,1233,1233,1233,1233,1233,1233,1233,1234,1234,1234,1234,1234,1234,1234,1234,
+1235,1235,1235,1235,1235,1235,1235,1235,1236,1237,1238,1239,1240,0,0,0,
+1241,1241,1241,1241,1241,1241,1241,1241,1242,1242,1242,1242,1242,1242,1242,1242,
+1243,1243,1243,1243,1243,1243,1243,1243,1244,1244,1244,1244,1244,1244,1244,1244,
+1245,1245,1245,1245,1245,1245,1245,1245,1246,1246,1246,1246,1246,1246,1246,1246,
+1247,1247,1247,1247,1247,1247,1247,1247,1248,1249,1250,1251,1252,0,0,0,
+1253,1253,1253,1253,1253,1253,1253,1253,1254,1254,1254,1254,1254,1254,1254,1254,
+1255,1255,1255,1255,1255,1255,1255,1255,1256,1256,1256,1256,1256,1256,1256,1256,
+1257,1257,1257,1257,1257,1257,1257,1257,1258,1258,1258,1258,1258,1258,1258,1258,
+1259,1259,1259,1259,1259,1259,1259,1259,1260,1261,1262,1263,1264,0,0,0,
+1265,1265,1265,1265,1265,1265,1265,1265,1266,1266,1266,1266,1266,1266,1266,1266,
+1267,1267,1267,1267,1267,1267,1267,1267,1268,1268,1268,1268,1268,1268,1268,1268,
+1269,1269,1269,1269,1269,1269,1269,1269,1270,1270,1270,1270,1270,1270,1270,1270,
+1271,1271,1271,1271,1271,1271,1271,1271,1272,1273,1274,1275,1276,0,0,0,
+1277,1277,1277,1277,1277,1277,1277,1277,1278,1278,1278,1278,1278,1278,1278,1278,
+1279,1279,1279,1279,1279,1279,1279,1279,1280,1280,1280,1280,1280,1280,1280,1280,
+1281,1281,1281,1281,1281,1281,1281,1281,1282,1282,1282,1282,1282,1282,1282,1282,
+1283,1283,1283,1283,1283,1283,1283,1283,1284,1285,0,0,0,0,0,0,
+1286,1286,1286,1286,1286,1286,1286,1286,1287,1287,1287,1287,1287,1287,1287,1287,
+1288,1288,1288,1288,1288,1288,1288,1288,1289,1289,1289,1289,1289,1289,1289,1289,
+1290,1290,1290,1290,1290,1290,1290,1290,1291,1291,1291,1291,1291,1291,1291,1291,
+1292,1292,1292,1292,1292,1292,1292,1292,1293,1294,0,0,0,0,0,0,
+1295,1295,1295,1295,1295,1295,1295,1295,1296,1296,1296,1296,1296,1296,1296,1296,
+1297,1297,1297,1297,1297,1297,1297,1297,1298,1298,1298,1298,1298,1298,1298,1298,
+1299,1299,1299,1299,1299,1299,1299,1299,1300,1300,1300,1300,1300,1300,1300,1300,
+1301,1301,1301,1301,1301,1301,1301,1301,1302,1303,0,0,0,0,0,0,
+1304,1304,1304,1304,1304,1304,1304,1304,1305,1305,1305,1305,1305,1305,1305,1305,
+1306,1306,1306,1306,1306,1306,1306,1306,1307,1307,1307,1307,1307,1307,1307,1307,
+1308,1308,1308,1308,1308,1308,1308,1308,1309,1309,1309,1309,1309,1309,1309,1309,
+1310,1310,1310,1310,1310,1310,1310,1310,1311,1312,1313,1314,1315,0,0,0,
+1316,1316,1316,1316,1316,1316,1316,1316,0,0,0,0,0,0,0,0,
+1317,1317,1317,1317,1317,1317,1317,1317,1318,1318,1318,1318,1318,1318,1318,1318,
+1319,1319,1319,1319,1319,1319,1319,1319,1320,1320,1320,1320,1320,1320,1320,1320,
+1321,1321,1321,1321,1321,1321,1321,1321,1322,1323,1324,1325,1326,0,0,0,
+1327,1327,1327,1327,1327,1327,1327,1327,0,0,0,0,0,0,0,0,
+1328,1328,1328,1328,1328,1328,1328,1328,1329,1329,1329,1329,1329,1329,1329,1329,
+1330,1330,1330,1330,1330,1330,1330,1330,1331,1331,1331,1331,1331,1331,1331,1331,
+1332,1332,1332,1332,1332,1332,1332,1332,1333,1334,1335,1336,1337,0,0,0,
+1338,1338,1338,1338,1338,1338,1338,1338,0,0,0,0,0,0,0,0,
+1339,1339,1339,1339,1339,1339,1339,1339,1340,1340,1340,1340,1340,1340,1340,1340,
+1341,1341,1341,1341,1341,1341,1341,1341,1342,1342,1342,1342,1342,1342,1342,1342,
+1343,1343,1343,1343,1343,1343,1343,1343,1344,1345,1346,1347,1348,0,0,0,
+1349,1349,1349,1349,1349,1349,1349,1349,0,0,0,0,0,0,0,0,
+1350,1350,1350,1350,1350,1350,1350,1350,1351,1351,1351,1351,1351,1351,1351,1351,
+1352,1352,1352,1352,1352,1352,1352,1352,1353,1353,1353,1353,1353,1353,1353,1353,
+1354,1354,1354,1354,1354,1354,1354,1354,1355,1356,1357,1358,1359,0,0,0,
+1360,1360,1360,1360,1360,1360,1360,1360,1361,1361,1361,1361,1361,1361,1361,1361,
+1362,1362,1362,1362,1362,1362,1362,1362,1363,1363,1363,1363,1363,1363,1363,1363,
+1364,1364,1364,1364,1364,1364,1364,1364,1365,1365,1365,1365,1365,1365,1365,1365,
+1366,1366,1366,1366,1366,1366,1366,1366,1367,1368,0,0,0,0,0,0,
+1369,1369,1369,1369,1369,1369,1369,1369,1370,1370,1370,1370,1370,1370,1370,1370,
+1371,1371,1371,1371,1371,1371,1371,1371,1372,1372,1372,1372,1372,1372,1372,1372,
+1373,1373,1373,1373,1373,1373,1373,1373,1374,1374,1374,1374,1374,1374,1374,1374,
+1375,1375,1375,1375,1375,1375,1375,1375,1376,1377,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1378,1378,1378,1378,1378,1378,1378,1378,
+1379,1379,1379,1379,1379,1379,1379,1379,1380,1380,1380,1380,1380,1380,1380,1380,
+1381,1381,1381,1381,1381,1381,1381,1381,1382,1382,1382,1382,1382,1382,1382,1382,
+1383,1383,1383,1383,1383,1383,1383,1383,1384,1385,0,0,0,0,0,0,
+1386,1386,1386,1386,1386,1386,1386,1386,0,0,0,0,0,0,0,0,
+1387,1387,1387,1387,1387,1387,1387,1387,1388,1388,1388,1388,1388,1388,1388,1388,
+1389,1389,1389,1389,1389,1389,1389,1389,1390,1390,1390,1390,1390,1390,1390,1390,
+1391,1391,1391,1391,1391,1391,1391,1391,1392,1393,1394,1395,1396,0,0,0,
+1397,1397,1397,1397,1397,1397,1397,1397,0,0,0,0,0,0,0,0,
+1398,1398,1398,1398,1398,1398,1398,1398,1399,1399,1399,1399,1399,1399,1399,1399,
+1400,1400,1400,1400,1400,1400,1400,1400,1401,1401,1401,1401,1401,1401,1401,1401,
+1402,1402,1402,1402,1402,1402,1402,1402,1403,1404,1405,1406,1407,0,0,0,
+1408,1408,1408,1408,1408,1408,1408,1408,1409,1409,1409,1409,1409,1409,1409,1409,
+1410,1410,1410,1410,1410,1410,1410,1410,1411,1411,1411,1411,1411,1411,1411,1411,
+1412,1412,1412,1412,1412,1412,1412,1412,1413,1413,1413,1413,1413,1413,1413,1413,
+1414,1414,1414,1414,1414,1414,1414,1414,1415,1416,1417,1418,1419,0,0,0,
+1420,1420,1420,1420,1420,1420,1420,1420,1421,1421,1421,1421,1421,1421,1421,1421,
+1422,1422,1422,1422,1422,1422,1422,1422,1423,1423,1423,1423,1423,1423,1423,1423,
+1424,1424,1424,1424,1424,1424,1424,1424,1425,1425,1425,1425,1425,1425,1425,1425,
+1426,1426,1426,1426,1426,1426,1426,1426,1427,1428,1429,1430,1431,0,0,0,
+1432,1432,1432,1432,1432,1432,1432,1432,1433,1433,1433,1433,1433,1433,1433,1433,
+1434,1434,1434,1434,1434,1434,1434,1434,1435,1435,1435,1435,1435,1435,1435,1435,
+1436,1436,1436,1436,1436,1436,1436,1436,1437,1437,1437,1437,1437,1437,1437,1437,
+1438,1438,1438,1438,1438,1438,1438,1438,1439,1440,1441,1442,1443,0,0,0,
+1444,1444,1444,1444,1444,1444,1444,1444,1445,1445,1445,1445,1445,1445,1445,1445,
+1446,1446,1446,1446,1446,1446,1446,1446,1447,1447,1447,1447,1447,1447,1447,1447,
+1448,1448,1448,1448,1448,1448,1448,1448,1449,1449,1449,1449,1449,1449,1449,1449,
+1450,1450,1450,1450,1450,1450,1450,1450,1451,1452,0,0,0,0,0,0,
+1453,1453,1453,1453,1453,1453,1453,1453,1454,1454,1454,1454,1454,1454,1454,1454,
+1455,1455,1455,1455,1455,1455,1455,1455,1456,1456,1456,1456,1456,1456,1456,1456,
+1457,1457,1457,1457,1457,1457,1457,1457,1458,1458,1458,1458,1458,1458,1458,1458,
+1459,1459,1459,1459,1459,1459,1459,1459,1460,1461,0,0,0,0,0,0,
+1462,1462,1462,1462,1462,1462,1462,1462,1463,1463,1463,1463,1463,1463,1463,1463,
+1464,1464,1464,1464,1464,1464,1464,1464,1465,1465,1465,1465,1465,1465,1465,1465,
+1466,1466,1466,1466,1466,1466,1466,1466,1467,1467,1467,1467,1467,1467,1467,1467,
+1468,1468,1468,1468,1468,1468,1468,1468,1469,1470,0,0,0,0,0,0,
+1471,1471,1471,1471,1471,1471,1471,1471,1472,1472,1472,1472,1472,1472,1472,1472,
+1473,1473,1473,1473,1473,1473,1473,1473,1474,1474,1474,1474,1474,1474,1474,1474,
+1475,1475,1475,1475,1475,1475,1475,1475,1476,1476,1476,1476,1476,1476,1476,1476,
+1477,1477,1477,1477,1477,1477,1477,1477,1478,1479,1480,1481,1482,0,0,0,
+1483,1483,1483,1483,1483,1483,1483,1483,1484,1484,1484,1484,1484,1484,1484,1484,
+1485,1485,1485,1485,1485,1485,1485,1485,1486,1486,1486,1486,1486,1486,1486,1486,
+1487,1487,1487,1487,1487,1487,1487,1487,1488,1488,1488,1488,1488,1488,1488,1488,
+1489,1489,1489,1489,1489,1489,1489,1489,1490,1490,1490,1490,1490,1490,1490,1490,
+1491,1491,1491,1491,1491,1491,1491,1491,1492,1492,1492,1492,1492,1492,1492,1492,
+1493,1493,1493,1493,1493,1493,1493,1493,1494,1494,1494,1494,1494,1494,1494,1494,
+1495,1495,1495,1495,1495,1495,1495,1495,1496,1496,1496,1496,1496,1496,1496,1496,
+1497,1497,1497,1497,1497,1497,1497,1497,1498,1498,1498,1498,1498,1498,1498,1498,
+1499,1499,1499,1499,1499,1499,1499,1499,1500,1500,1500,1500,1500,1500,1500,1500,
+1501,1501,1501,1501,1501,1501,1501,1501,1502,1502,1502,1502,1502,1502,1502,1502,
+1503,1503,1503,1503,1503,1503,1503,1503,1504,1504,1504,1504,1504,1504,1504,1504,
+1505,1505,1505,1505,1505,1505,1505,1505,1506,1506,1506,1506,1506,1506,1506,1506,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1507,1507,1507,1507,1507,1507,1507,1507,1508,1508,1508,1508,1508,1508,1508,1508,
+1509,1509,1509,1509,1509,1509,1509,1509,1510,1510,1510,1510,1510,1510,1510,1510,
+1511,1511,1511,1511,1511,1511,1511,1511,1512,1513,0,0,0,0,0,0,
+1514,1514,1514,1514,1514,1514,1514,1514,1515,1515,1515,1515,1515,1515,1515,1515,
+1516,1516,1516,1516,1516,1516,1516,1516,1517,1517,1517,1517,1517,1517,1517,1517,
+1518,1518,1518,1518,1518,1518,1518,1518,1519,1519,1519,1519,1519,1519,1519,1519,
+1520,1520,1520,1520,1520,1520,1520,1520,1521,1521,1521,1521,1521,1521,1521,1521,
+1522,1522,1522,1522,1522,1522,1522,1522,1523,1523,1523,1523,1523,1523,1523,1523,
+1524,1524,1524,1524,1524,1524,1524,1524,1525,1525,1525,1525,1525,1525,1525,1525,
+1526,1526,1526,1526,1526,1526,1526,1526,1527,1527,1527,1527,1527,1527,1527,1527,
+1528,1528,1528,1528,1528,1528,1528,1528,1529,1529,1529,1529,1529,1529,1529,1529,
+1530,1530,1530,1530,1530,1530,1530,1530,1531,1531,1531,1531,1531,1531,1531,1531,
+1532,1532,1532,1532,1532,1532,1532,1532,1533,1533,1533,1533,1533,1533,1533,1533,
+1534,1534,1534,1534,1534,1534,1534,1534,1535,1535,1535,1535,1535,1535,1535,1535,
+1536,1536,1536,1536,1536,1536,1536,1536,1537,1537,1537,1537,1537,1537,1537,1537,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1538,1538,1538,1538,1538,1538,1538,1538,1539,1539,1539,1539,1539,1539,1539,1539,
+1540,1540,1540,1540,1540,1540,1540,1540,1541,1541,1541,1541,1541,1541,1541,1541,
+1542,1542,1542,1542,1542,1542,1542,1542,1543,1544,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1545,1545,1545,1545,1545,1545,1545,1545,1546,1546,1546,1546,1546,1546,1546,1546,
+1547,1547,1547,1547,1547,1547,1547,1547,1548,1548,1548,1548,1548,1548,1548,1548,
+1549,1549,1549,1549,1549,1549,1549,1549,1550,1551,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1552,1552,1552,1552,1552,1552,1552,1552,1553,1553,1553,1553,1553,1553,1553,1553,
+1554,1554,1554,1554,1554,1554,1554,1554,1555,1555,1555,1555,1555,1555,1555,1555,
+1556,1556,1556,1556,1556,1556,1556,1556,1557,1558,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1559,1559,1559,1559,1559,1559,1559,1559,1560,1560,1560,1560,1560,1560,1560,1560,
+1561,1561,1561,1561,1561,1561,1561,1561,1562,1562,1562,1562,1562,1562,1562,1562,
+1563,1563,1563,1563,1563,1563,1563,1563,1564,1565,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1566,1566,1566,1566,1566,1566,1566,1566,1567,1567,1567,1567,1567,1567,1567,1567,
+1568,1568,1568,1568,1568,1568,1568,1568,1569,1569,1569,1569,1569,1569,1569,1569,
+1570,1570,1570,1570,1570,1570,1570,1570,1571,1572,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1573,1573,1573,1573,1573,1573,1573,1573,1574,1574,1574,1574,1574,1574,1574,1574,
+1575,1575,1575,1575,1575,1575,1575,1575,1576,1576,1576,1576,1576,1576,1576,1576,
+1577,1577,1577,1577,1577,1577,1577,1577,1578,1579,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1580,1580,1580,1580,1580,1580,1580,1580,1581,1581,1581,1581,1581,1581,1581,1581,
+1582,1582,1582,1582,1582,1582,1582,1582,1583,1583,1583,1583,1583,1583,1583,1583,
+1584,1584,1584,1584,1584,1584,1584,1584,1585,1586,0,0,0,0,0,0,
+};
+static const uae_u16 op_dispatch_index_4[] = {
+0,1,2,3,4,5,6,7,8,9,10,3,4,5,6,7,
+11,12,13,3,4,5,6,7,14,15,16,3,4,5,6,7,
+17,18,19,20,4,5,6,7,21,22,23,3,4,5,6,7,
+24,25,26,3,4,5,6,7,3,3,3,3,4,5,6,7,
+27,3,28,29,30,31,32,33,27,3,28,29,30,31,32,34,
+27,3,28,29,30,31,32,3,27,3,28,29,30,31,32,3,
+27,3,28,29,30,31,32,3,27,3,28,29,30,31,32,3,
+27,3,28,29,30,31,32,3,27,3,28,29,30,31,32,3,
+35,36,37,38,39,40,41,42,35,36,37,38,39,40,41,43,
+35,36,37,38,39,40,41,3,35,36,37,38,39,40,41,3,
+35,36,37,38,39,40,41,3,35,36,37,38,39,40,41,3,
+35,36,37,38,39,40,41,3,35,36,37,38,39,40,41,3,
+44,45,46,47,48,49,50,51,44,45,46,47,48,49,50,52,
+44,45,46,47,48,49,50,3,44,45,46,47,48,49,50,3,
+44,45,46,47,48,49,50,3,44,45,46,47,48,49,50,3,
+44,45,46,47,48,49,50,3,44,45,46,47,48,49,50,3,
+53,54,55,56,57,3,58,59,60,61,62,3,57,3,58,59,
+63,64,65,66,57,3,58,59,67,68,69,70,57,3,58,59,
+71,72,73,74,57,3,58,75,76,77,78,79,57,3,58,59,
+3,3,80,81,57,3,58,59,3,82,83,84,57,3,58,59,
+85,86,87,88,89,90,91,92,85,86,87,93,89,90,91,94,
+85,86,87,95,89,90,91,96,85,86,87,97,89,90,91,98,
+85,86,87,99,89,90,91,100,85,86,87,101,89,90,91,102,
+85,86,87,103,89,90,91,104,85,86,87,105,89,90,91,106,
+107,108,108,109,110,111,111,112,113,114,114,115,116,117,117,118,
+119,120,120,121,122,123,123,124,125,126,126,127,128,129,129,130,
+131,132,132,133,134,135,135,136,137,138,138,139,140,141,141,142,
+143,144,144,145,146,147,147,148,149,150,150,151,152,153,153,154,
+155,155,155,155,156,157,157,157,155,155,155,155,3,3,3,3,
+155,155,155,155,3,3,3,3,155,155,155,155,3,3,3,3,
+155,155,155,155,3,3,3,3,155,155,155,155,3,3,3,3,
+155,155,155,155,3,3,3,3,155,155,155,155,3,3,3,3,
+158,159,160,161,162,163,164,165,158,159,160,161,162,163,164,165,
+158,159,160,161,162,163,164,165,158,159,160,161,162,163,164,165,
+158,159,160,161,162,163,164,165,158,159,160,161,162,163,164,165,
+158,159,160,161,162,163,164,165,158,159,160,161,162,163,164,165,
+166,167,168,169,170,171,172,173,166,167,168,169,170,171,172,173,
+166,167,168,169,170,171,172,173,166,167,168,169,170,171,172,173,
+166,167,168,169,170,171,172,173,166,167,168,169,170,171,172,173,
+166,167,168,169,170,171,172,173,166,167,168,169,170,171,172,173,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+174,175,176,177,178,179,180,181,174,175,176,177,178,179,180,181,
+174,175,176,177,178,179,180,181,174,175,176,177,178,179,180,181,
+174,175,176,177,178,179,180,181,174,175,176,177,178,179,180,181,
+174,175,176,177,178,179,180,181,174,175,176,177,178,179,180,181,
+182,183,184,185,186,187,188,189,182,183,184,185,186,187,188,189,
+182,183,184,185,186,187,188,189,182,183,184,185,186,187,188,189,
+182,183,184,185,186,187,188,189,182,183,184,185,186,187,188,189,
+182,183,184,185,186,187,188,189,182,183,184,185,186,187,188,189,
+190,191,192,193,194,195,196,197,190,191,192,193,194,195,196,197,
+190,191,192,193,194,195,196,197,190,191,192,193,194,195,196,197,
+190,191,192,193,194,195,196,197,190,191,192,193,194,195,196,197,
+190,191,192,193,194,195,196,197,190,191,192,193,194,195,196,197,
+198,199,200,201,202,203,204,205,198,199,200,206,202,203,204,207,
+198,199,200,208,202,203,204,209,198,199,200,210,202,203,204,211,
+198,199,200,3,202,203,204,3,198,199,200,3,202,203,204,3,
+198,199,200,3,202,203,204,3,198,199,200,3,202,203,204,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+};
+const struct cpudispatch_tbl op_dispatch_4 = {
+	op_dispatch_handlers_4, op_dispatch_pages_4, op_dispatch_index_4, 1587, 212
+};
+#endif
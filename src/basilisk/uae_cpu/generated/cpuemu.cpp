@@ -14,6 +14,9 @@
 #ifdef NOFLAGS
 # include "noflags.h"
 #endif
+#if defined(ARDUINO) && USE_HOT_HANDLERS
+# include "cpuhot.h"
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(disable:4102)	/* unreferenced label */
@@ -42,9 +45,7 @@ void REGPARAM2 CPUFUNC(op_0_0)(uae_u32 opcode) /* OR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -61,9 +62,7 @@ void REGPARAM2 CPUFUNC(op_10_0)(uae_u32 opcode) /* OR.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -81,9 +80,7 @@ void REGPARAM2 CPUFUNC(op_18_0)(uae_u32 opcode) /* OR.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -101,9 +98,7 @@ void REGPARAM2 CPUFUNC(op_20_0)(uae_u32 opcode) /* OR.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -120,9 +115,7 @@ void REGPARAM2 CPUFUNC(op_28_0)(uae_u32 opcode) /* OR.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -140,9 +133,7 @@ void REGPARAM2 CPUFUNC(op_30_0)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -153,9 +144,7 @@ void REGPARAM2 CPUFUNC(op_38_0)(uae_u32 opcode) /* OR.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -167,9 +156,7 @@ void REGPARAM2 CPUFUNC(op_39_0)(uae_u32 opcode) /* OR.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -196,9 +183,7 @@ void REGPARAM2 CPUFUNC(op_40_0)(uae_u32 opcode) /* OR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -215,9 +200,7 @@ void REGPARAM2 CPUFUNC(op_50_0)(uae_u32 opcode) /* OR.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -235,9 +218,7 @@ void REGPARAM2 CPUFUNC(op_58_0)(uae_u32 opcode) /* OR.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -255,9 +236,7 @@ void REGPARAM2 CPUFUNC(op_60_0)(uae_u32 opcode) /* OR.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -274,9 +253,7 @@ void REGPARAM2 CPUFUNC(op_68_0)(uae_u32 opcode) /* OR.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -294,9 +271,7 @@ void REGPARAM2 CPUFUNC(op_70_0)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -307,9 +282,7 @@ void REGPARAM2 CPUFUNC(op_78_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -321,9 +294,7 @@ void REGPARAM2 CPUFUNC(op_79_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -351,9 +322,7 @@ void REGPARAM2 CPUFUNC(op_80_0)(uae_u32 opcode) /* OR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -370,9 +339,7 @@ void REGPARAM2 CPUFUNC(op_90_0)(uae_u32 opcode) /* OR.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -390,9 +357,7 @@ void REGPARAM2 CPUFUNC(op_98_0)(uae_u32 opcode) /* OR.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -410,9 +375,7 @@ void REGPARAM2 CPUFUNC(op_a0_0)(uae_u32 opcode) /* OR.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -429,9 +392,7 @@ void REGPARAM2 CPUFUNC(op_a8_0)(uae_u32 opcode) /* OR.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -449,9 +410,7 @@ void REGPARAM2 CPUFUNC(op_b0_0)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -462,9 +421,7 @@ void REGPARAM2 CPUFUNC(op_b8_0)(uae_u32 opcode) /* OR.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -476,9 +433,7 @@ void REGPARAM2 CPUFUNC(op_b9_0)(uae_u32 opcode) /* OR.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -1577,9 +1532,7 @@ void REGPARAM2 CPUFUNC(op_200_0)(uae_u32 opcode) /* AND.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -1596,9 +1549,7 @@ void REGPARAM2 CPUFUNC(op_210_0)(uae_u32 opcode) /* AND.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1616,9 +1567,7 @@ void REGPARAM2 CPUFUNC(op_218_0)(uae_u32 opcode) /* AND.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1636,9 +1585,7 @@ void REGPARAM2 CPUFUNC(op_220_0)(uae_u32 opcode) /* AND.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1655,9 +1602,7 @@ void REGPARAM2 CPUFUNC(op_228_0)(uae_u32 opcode) /* AND.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1675,9 +1620,7 @@ void REGPARAM2 CPUFUNC(op_230_0)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1688,9 +1631,7 @@ void REGPARAM2 CPUFUNC(op_238_0)(uae_u32 opcode) /* AND.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1702,9 +1643,7 @@ void REGPARAM2 CPUFUNC(op_239_0)(uae_u32 opcode) /* AND.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1731,9 +1670,7 @@ void REGPARAM2 CPUFUNC(op_240_0)(uae_u32 opcode) /* AND.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -1750,9 +1687,7 @@ void REGPARAM2 CPUFUNC(op_250_0)(uae_u32 opcode) /* AND.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1770,9 +1705,7 @@ void REGPARAM2 CPUFUNC(op_258_0)(uae_u32 opcode) /* AND.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1790,9 +1723,7 @@ void REGPARAM2 CPUFUNC(op_260_0)(uae_u32 opcode) /* AND.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1809,9 +1740,7 @@ void REGPARAM2 CPUFUNC(op_268_0)(uae_u32 opcode) /* AND.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1829,9 +1758,7 @@ void REGPARAM2 CPUFUNC(op_270_0)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1842,9 +1769,7 @@ void REGPARAM2 CPUFUNC(op_278_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1856,9 +1781,7 @@ void REGPARAM2 CPUFUNC(op_279_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1886,9 +1809,7 @@ void REGPARAM2 CPUFUNC(op_280_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -1905,9 +1826,7 @@ void REGPARAM2 CPUFUNC(op_290_0)(uae_u32 opcode) /* AND.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1925,9 +1844,7 @@ void REGPARAM2 CPUFUNC(op_298_0)(uae_u32 opcode) /* AND.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1945,9 +1862,7 @@ void REGPARAM2 CPUFUNC(op_2a0_0)(uae_u32 opcode) /* AND.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1964,9 +1879,7 @@ void REGPARAM2 CPUFUNC(op_2a8_0)(uae_u32 opcode) /* AND.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1984,9 +1897,7 @@ void REGPARAM2 CPUFUNC(op_2b0_0)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1997,9 +1908,7 @@ void REGPARAM2 CPUFUNC(op_2b8_0)(uae_u32 opcode) /* AND.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -2011,9 +1920,7 @@ void REGPARAM2 CPUFUNC(op_2b9_0)(uae_u32 opcode) /* AND.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -2167,16 +2074,9 @@ void REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
@@ -2191,16 +2091,9 @@ void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
@@ -2216,16 +2109,9 @@ void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
@@ -2241,16 +2127,9 @@ void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
@@ -2265,16 +2144,9 @@ void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) */
@@ -2290,16 +2162,9 @@ void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 {
@@ -2308,16 +2173,9 @@ void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
@@ -2327,16 +2185,9 @@ void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
@@ -2350,16 +2201,9 @@ void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
@@ -2374,16 +2218,9 @@ void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
@@ -2399,16 +2236,9 @@ void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
@@ -2424,16 +2254,9 @@ void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
@@ -2448,16 +2271,9 @@ void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) */
@@ -2473,16 +2289,9 @@ void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 {
@@ -2491,16 +2300,9 @@ void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
@@ -2510,16 +2312,9 @@ void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
@@ -2533,16 +2328,9 @@ void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
@@ -2557,16 +2345,9 @@ void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
@@ -2582,16 +2363,9 @@ void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
@@ -2607,16 +2381,9 @@ void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
@@ -2631,16 +2398,9 @@ void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) */
@@ -2656,16 +2416,9 @@ void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 {
@@ -2674,16 +2427,9 @@ void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
@@ -2693,16 +2439,9 @@ void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4d0_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(An) */
@@ -2847,16 +2586,9 @@ void REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
@@ -2871,16 +2603,9 @@ void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
@@ -2896,16 +2621,9 @@ void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
@@ -2921,16 +2639,9 @@ void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
@@ -2945,16 +2656,9 @@ void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) */
@@ -2970,16 +2674,9 @@ void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 {
@@ -2988,16 +2685,9 @@ void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
@@ -3007,16 +2697,9 @@ void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
@@ -3030,16 +2713,9 @@ void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
@@ -3054,16 +2730,9 @@ void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
@@ -3079,16 +2748,9 @@ void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
@@ -3104,16 +2766,9 @@ void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
@@ -3128,16 +2783,9 @@ void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) */
@@ -3153,16 +2801,9 @@ void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 {
@@ -3171,16 +2812,9 @@ void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
@@ -3190,16 +2824,9 @@ void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
@@ -3213,16 +2840,9 @@ void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
@@ -3237,16 +2857,9 @@ void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
@@ -3262,16 +2875,9 @@ void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
@@ -3287,16 +2893,9 @@ void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
@@ -3311,16 +2910,9 @@ void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) */
@@ -3336,16 +2928,9 @@ void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 {
@@ -3354,16 +2939,9 @@ void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
@@ -3373,16 +2951,9 @@ void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6c0_0)(uae_u32 opcode) /* RTM.L Dn */
@@ -4155,9 +3726,7 @@ void REGPARAM2 CPUFUNC(op_a00_0)(uae_u32 opcode) /* EOR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -4174,9 +3743,7 @@ void REGPARAM2 CPUFUNC(op_a10_0)(uae_u32 opcode) /* EOR.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4194,9 +3761,7 @@ void REGPARAM2 CPUFUNC(op_a18_0)(uae_u32 opcode) /* EOR.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4214,9 +3779,7 @@ void REGPARAM2 CPUFUNC(op_a20_0)(uae_u32 opcode) /* EOR.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4233,9 +3796,7 @@ void REGPARAM2 CPUFUNC(op_a28_0)(uae_u32 opcode) /* EOR.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4253,9 +3814,7 @@ void REGPARAM2 CPUFUNC(op_a30_0)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4266,9 +3825,7 @@ void REGPARAM2 CPUFUNC(op_a38_0)(uae_u32 opcode) /* EOR.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4280,9 +3837,7 @@ void REGPARAM2 CPUFUNC(op_a39_0)(uae_u32 opcode) /* EOR.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4309,9 +3864,7 @@ void REGPARAM2 CPUFUNC(op_a40_0)(uae_u32 opcode) /* EOR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -4328,9 +3881,7 @@ void REGPARAM2 CPUFUNC(op_a50_0)(uae_u32 opcode) /* EOR.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4348,9 +3899,7 @@ void REGPARAM2 CPUFUNC(op_a58_0)(uae_u32 opcode) /* EOR.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4368,9 +3917,7 @@ void REGPARAM2 CPUFUNC(op_a60_0)(uae_u32 opcode) /* EOR.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4387,9 +3934,7 @@ void REGPARAM2 CPUFUNC(op_a68_0)(uae_u32 opcode) /* EOR.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4407,9 +3952,7 @@ void REGPARAM2 CPUFUNC(op_a70_0)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4420,9 +3963,7 @@ void REGPARAM2 CPUFUNC(op_a78_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4434,9 +3975,7 @@ void REGPARAM2 CPUFUNC(op_a79_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4467,9 +4006,7 @@ void REGPARAM2 CPUFUNC(op_a80_0)(uae_u32 opcode) /* EOR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -4486,9 +4023,7 @@ void REGPARAM2 CPUFUNC(op_a90_0)(uae_u32 opcode) /* EOR.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4506,9 +4041,7 @@ void REGPARAM2 CPUFUNC(op_a98_0)(uae_u32 opcode) /* EOR.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4526,9 +4059,7 @@ void REGPARAM2 CPUFUNC(op_aa0_0)(uae_u32 opcode) /* EOR.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4545,9 +4076,7 @@ void REGPARAM2 CPUFUNC(op_aa8_0)(uae_u32 opcode) /* EOR.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4565,9 +4094,7 @@ void REGPARAM2 CPUFUNC(op_ab0_0)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4578,9 +4105,7 @@ void REGPARAM2 CPUFUNC(op_ab8_0)(uae_u32 opcode) /* EOR.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4592,9 +4117,7 @@ void REGPARAM2 CPUFUNC(op_ab9_0)(uae_u32 opcode) /* EOR.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -4613,16 +4136,10 @@ void REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
@@ -4640,16 +4157,10 @@ void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
@@ -4667,16 +4178,10 @@ void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
@@ -4693,16 +4198,10 @@ void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) */
@@ -4720,16 +4219,10 @@ void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}}	cpuop_end();
+}}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 {
@@ -4740,16 +4233,10 @@ void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
@@ -4761,16 +4248,10 @@ void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpb (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(8);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
@@ -4784,14 +4265,8 @@ void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
@@ -4806,14 +4281,8 @@ void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
@@ -4829,14 +4298,8 @@ void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
@@ -4852,14 +4315,8 @@ void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
@@ -4874,14 +4331,8 @@ void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) */
@@ -4897,14 +4348,8 @@ void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 {
@@ -4913,14 +4358,8 @@ void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
@@ -4930,14 +4369,8 @@ void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
@@ -4949,14 +4382,8 @@ void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
@@ -4969,14 +4396,8 @@ void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {
@@ -4989,14 +4410,8 @@ void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
@@ -5011,14 +4426,8 @@ void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
@@ -5034,14 +4443,8 @@ void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
@@ -5057,14 +4460,8 @@ void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
@@ -5079,14 +4476,8 @@ void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
@@ -5102,14 +4493,8 @@ void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 {
@@ -5118,14 +4503,8 @@ void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
@@ -5135,14 +4514,8 @@ void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
@@ -5154,14 +4527,8 @@ void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
@@ -5174,14 +4541,8 @@ void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {
@@ -5194,14 +4555,8 @@ void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
@@ -5216,14 +4571,8 @@ void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
@@ -5239,14 +4588,8 @@ void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
@@ -5262,14 +4605,8 @@ void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
@@ -5284,14 +4621,8 @@ void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
@@ -5307,14 +4638,8 @@ void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 {
@@ -5323,14 +4648,8 @@ void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
@@ -5340,14 +4659,8 @@ void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(10);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(10);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
@@ -5359,14 +4672,8 @@ void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
@@ -5379,14 +4686,8 @@ void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 {
@@ -5402,16 +4703,10 @@ void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
@@ -5429,16 +4724,10 @@ void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
@@ -5456,16 +4745,10 @@ void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
@@ -5482,16 +4765,10 @@ void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) */
@@ -5509,16 +4786,10 @@ void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}}	cpuop_end();
+}}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 {
@@ -5529,16 +4800,10 @@ void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
@@ -5550,16 +4815,10 @@ void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(8);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
@@ -5570,27 +4829,15 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	uae_u32 rn2 = regs.regs[(extra >> 12) & 15];
 	uae_u16 dst1 = get_word(rn1), dst2 = get_word(rn2);
 {uae_u32 newv = ((uae_s16)(dst1)) - ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
-	int flgo = ((uae_s16)(dst1)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, (extra >> 16) & 7), dst1);
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg(regs, extra & 7)));
-{	int flgs = ((uae_s16)(m68k_dreg(regs, extra & 7))) < 0;
-	int flgo = ((uae_s16)(dst2)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg(regs, extra & 7))) > ((uae_u16)(dst2)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpw (newv, m68k_dreg(regs, extra & 7), dst2);
 	if (GET_ZFLG) {
 	put_word(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_word(rn1, m68k_dreg(regs, (extra >> 6) & 7));
 	}}
-}}}}	if (! GET_ZFLG) {
+}}	if (! GET_ZFLG) {
 	m68k_dreg(regs, (extra >> 22) & 7) = (m68k_dreg(regs, (extra >> 22) & 7) & ~0xffff) | (dst1 & 0xffff);
 	m68k_dreg(regs, (extra >> 6) & 7) = (m68k_dreg(regs, (extra >> 6) & 7) & ~0xffff) | (dst2 & 0xffff);
 	}
@@ -6181,16 +5428,10 @@ void REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
@@ -6208,16 +5449,10 @@ void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
@@ -6235,16 +5470,10 @@ void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(4);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
@@ -6261,16 +5490,10 @@ void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) */
@@ -6288,16 +5511,10 @@ void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}}	cpuop_end();
+}}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 {
@@ -6308,16 +5525,10 @@ void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(6);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
@@ -6329,16 +5540,10 @@ void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, rc), dst);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
-}}}}}}}}m68k_incpc(8);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
@@ -6349,27 +5554,15 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	uae_u32 rn2 = regs.regs[(extra >> 12) & 15];
 	uae_u32 dst1 = get_long(rn1), dst2 = get_long(rn2);
 {uae_u32 newv = ((uae_s32)(dst1)) - ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
-	int flgo = ((uae_s32)(dst1)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, (extra >> 16) & 7), dst1);
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg(regs, extra & 7)));
-{	int flgs = ((uae_s32)(m68k_dreg(regs, extra & 7))) < 0;
-	int flgo = ((uae_s32)(dst2)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg(regs, extra & 7))) > ((uae_u32)(dst2)));
-	SET_NFLG (flgn != 0);
+	lazyflag_cmpl (newv, m68k_dreg(regs, extra & 7), dst2);
 	if (GET_ZFLG) {
 	put_long(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_long(rn1, m68k_dreg(regs, (extra >> 6) & 7));
 	}}
-}}}}	if (! GET_ZFLG) {
+}}	if (! GET_ZFLG) {
 	m68k_dreg(regs, (extra >> 22) & 7) = dst1;
 	m68k_dreg(regs, (extra >> 6) & 7) = dst2;
 	}
@@ -6390,9 +5583,7 @@ void REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE.B Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6412,9 +5603,7 @@ void REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE.B (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6435,9 +5624,7 @@ void REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE.B (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6458,9 +5645,7 @@ void REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE.B -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6480,9 +5665,7 @@ void REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE.B (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6503,9 +5686,7 @@ void REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -6519,9 +5700,7 @@ void REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE.B (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6536,9 +5715,7 @@ void REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE.B (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -6554,9 +5731,7 @@ void REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6573,9 +5748,7 @@ void REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -6588,9 +5761,7 @@ void REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s8 src = get_ibyte(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -6610,9 +5781,7 @@ void REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE.B Dn,(An) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6633,9 +5802,7 @@ void REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE.B (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6657,9 +5824,7 @@ void REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE.B (An)+,(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6681,9 +5846,7 @@ void REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE.B -(An),(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6704,9 +5867,7 @@ void REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6728,9 +5889,7 @@ void REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6745,9 +5904,7 @@ void REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6763,9 +5920,7 @@ void REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -6782,9 +5937,7 @@ void REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6802,9 +5955,7 @@ void REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6818,9 +5969,7 @@ void REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(An) */
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -6841,9 +5990,7 @@ void REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE.B Dn,(An)+ */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6865,9 +6012,7 @@ void REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE.B (An),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6890,9 +6035,7 @@ void REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6915,9 +6058,7 @@ void REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE.B -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6939,9 +6080,7 @@ void REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6964,9 +6103,7 @@ void REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6982,9 +6119,7 @@ void REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7001,9 +6136,7 @@ void REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7021,9 +6154,7 @@ void REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7042,9 +6173,7 @@ void REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7059,9 +6188,7 @@ void REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(An)+ */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7082,9 +6209,7 @@ void REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE.B Dn,-(An) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -7106,9 +6231,7 @@ void REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE.B (An),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7131,9 +6254,7 @@ void REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE.B (An)+,-(An) */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7156,9 +6277,7 @@ void REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE.B -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7180,9 +6299,7 @@ void REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE.B (d16,An),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7205,9 +6322,7 @@ void REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7223,9 +6338,7 @@ void REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE.B (xxx).W,-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7242,9 +6355,7 @@ void REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE.B (xxx).L,-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7262,9 +6373,7 @@ void REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7283,9 +6392,7 @@ void REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7300,9 +6407,7 @@ void REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,-(An) */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7322,9 +6427,7 @@ void REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE.B Dn,(d16,An) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7345,9 +6448,7 @@ void REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE.B (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7369,9 +6470,7 @@ void REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE.B (An)+,(d16,An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7393,9 +6492,7 @@ void REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE.B -(An),(d16,An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7416,9 +6513,7 @@ void REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE.B (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7440,9 +6535,7 @@ void REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7458,9 +6551,7 @@ void REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7476,9 +6567,7 @@ void REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -7495,9 +6584,7 @@ void REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7515,9 +6602,7 @@ void REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7532,9 +6617,7 @@ void REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(d16,An) *
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7555,9 +6638,7 @@ void REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}	cpuop_end();
 }
@@ -7578,9 +6659,7 @@ void REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7602,9 +6681,7 @@ void REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7626,9 +6703,7 @@ void REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7649,9 +6724,7 @@ void REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn)
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7672,9 +6745,7 @@ void REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -7690,9 +6761,7 @@ void REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) *
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7708,9 +6777,7 @@ void REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) *
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7727,9 +6794,7 @@ void REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn)
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7746,9 +6811,7 @@ void REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -7763,9 +6826,7 @@ void REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn)
 {{	uae_s8 src = get_ibyte(2);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}	cpuop_end();
 }
@@ -7779,9 +6840,7 @@ void REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE.B Dn,(xxx).W */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7797,9 +6856,7 @@ void REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE.B (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7816,9 +6873,7 @@ void REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(xxx).W */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7835,9 +6890,7 @@ void REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE.B -(An),(xxx).W */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7853,9 +6906,7 @@ void REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7872,9 +6923,7 @@ void REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7885,9 +6934,7 @@ void REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7898,9 +6945,7 @@ void REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -7912,9 +6957,7 @@ void REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7927,9 +6970,7 @@ void REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7939,9 +6980,7 @@ void REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(xxx).W */
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7956,9 +6995,7 @@ void REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE.B Dn,(xxx).L */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7974,9 +7011,7 @@ void REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE.B (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7993,9 +7028,7 @@ void REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(xxx).L */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8012,9 +7045,7 @@ void REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE.B -(An),(xxx).L */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8030,9 +7061,7 @@ void REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8049,9 +7078,7 @@ void REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -8062,9 +7089,7 @@ void REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8075,9 +7100,7 @@ void REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -8089,9 +7112,7 @@ void REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8104,9 +7125,7 @@ void REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -8116,9 +7135,7 @@ void REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(xxx).L */
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -8137,9 +7154,7 @@ void REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE.L Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8158,9 +7173,7 @@ void REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE.L An,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8180,9 +7193,7 @@ void REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE.L (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8203,9 +7214,7 @@ void REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE.L (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8226,9 +7235,7 @@ void REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE.L -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8248,9 +7255,7 @@ void REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE.L (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8271,9 +7276,7 @@ void REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -8287,9 +7290,7 @@ void REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE.L (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8304,9 +7305,7 @@ void REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE.L (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8322,9 +7321,7 @@ void REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8341,9 +7338,7 @@ void REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -8356,9 +7351,7 @@ void REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = get_ilong(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -8630,9 +7623,7 @@ void REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE.L Dn,(An) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8652,9 +7643,7 @@ void REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE.L An,(An) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8675,9 +7664,7 @@ void REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE.L (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8699,9 +7686,7 @@ void REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE.L (An)+,(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8723,9 +7708,7 @@ void REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE.L -(An),(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8746,9 +7729,7 @@ void REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8770,9 +7751,7 @@ void REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -8787,9 +7766,7 @@ void REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8805,9 +7782,7 @@ void REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8824,9 +7799,7 @@ void REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8844,9 +7817,7 @@ void REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -8860,9 +7831,7 @@ void REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(An) */
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -8883,9 +7852,7 @@ void REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE.L Dn,(An)+ */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8906,9 +7873,7 @@ void REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE.L An,(An)+ */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8930,9 +7895,7 @@ void REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE.L (An),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8955,9 +7918,7 @@ void REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8980,9 +7941,7 @@ void REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE.L -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9004,9 +7963,7 @@ void REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9029,9 +7986,7 @@ void REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9047,9 +8002,7 @@ void REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9066,9 +8019,7 @@ void REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9086,9 +8037,7 @@ void REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9107,9 +8056,7 @@ void REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9124,9 +8071,7 @@ void REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(An)+ */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -9147,9 +8092,7 @@ void REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE.L Dn,-(An) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -9170,9 +8113,7 @@ void REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE.L An,-(An) */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -9194,9 +8135,7 @@ void REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE.L (An),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9219,9 +8158,7 @@ void REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE.L (An)+,-(An) */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9244,9 +8181,7 @@ void REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE.L -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9268,9 +8203,7 @@ void REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE.L (d16,An),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9293,9 +8226,7 @@ void REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9311,9 +8242,7 @@ void REGPARAM2 CPUFUNC(op_2138_0)(uae_u32 opcode) /* MOVE.L (xxx).W,-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9330,9 +8259,7 @@ void REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE.L (xxx).L,-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9350,9 +8277,7 @@ void REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9371,9 +8296,7 @@ void REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9388,9 +8311,7 @@ void REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,-(An) */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -9410,9 +8331,7 @@ void REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE.L Dn,(d16,An) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9432,9 +8351,7 @@ void REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE.L An,(d16,An) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9455,9 +8372,7 @@ void REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE.L (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9482,9 +8397,7 @@ void REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE.L (An)+,(d16,An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9506,9 +8419,7 @@ void REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE.L -(An),(d16,An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9529,9 +8440,7 @@ void REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE.L (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9553,9 +8462,7 @@ void REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -9571,9 +8478,7 @@ void REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9589,9 +8494,7 @@ void REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -9608,9 +8511,7 @@ void REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9628,9 +8529,7 @@ void REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -9645,9 +8544,7 @@ void REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(d16,An) *
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -9668,9 +8565,7 @@ void REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9690,9 +8585,7 @@ void REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9713,9 +8606,7 @@ void REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9737,9 +8628,7 @@ void REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += 4;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9761,9 +8650,7 @@ void REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9784,9 +8671,7 @@ void REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9807,9 +8692,7 @@ void REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -9825,9 +8708,7 @@ void REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) *
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9843,9 +8724,7 @@ void REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) *
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9862,9 +8741,7 @@ void REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn)
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9881,9 +8758,7 @@ void REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -9898,9 +8773,7 @@ void REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn)
 {{	uae_s32 src = get_ilong(2);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9914,9 +8787,7 @@ void REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE.L Dn,(xxx).W */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9931,9 +8802,7 @@ void REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE.L An,(xxx).W */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9949,9 +8818,7 @@ void REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE.L (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9968,9 +8835,7 @@ void REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(xxx).W */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9987,9 +8852,7 @@ void REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE.L -(An),(xxx).W */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10005,9 +8868,7 @@ void REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10024,9 +8885,7 @@ void REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -10037,9 +8896,7 @@ void REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10050,9 +8907,7 @@ void REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10064,9 +8919,7 @@ void REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10079,9 +8932,7 @@ void REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -10091,9 +8942,7 @@ void REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(xxx).W */
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -10108,9 +8957,7 @@ void REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE.L Dn,(xxx).L */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -10125,9 +8972,7 @@ void REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE.L An,(xxx).L */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -10143,9 +8988,7 @@ void REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE.L (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10162,9 +9005,7 @@ void REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(xxx).L */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10181,9 +9022,7 @@ void REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE.L -(An),(xxx).L */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10199,9 +9038,7 @@ void REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10218,9 +9055,7 @@ void REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -10231,9 +9066,7 @@ void REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10244,9 +9077,7 @@ void REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -10258,9 +9089,7 @@ void REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10273,9 +9102,7 @@ void REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -10285,9 +9112,7 @@ void REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(xxx).L */
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(10);
 	cpuop_end();
@@ -10306,9 +9131,7 @@ void REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE.W Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10327,9 +9150,7 @@ void REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE.W An,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10349,9 +9170,7 @@ void REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE.W (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10372,9 +9191,7 @@ void REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE.W (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10395,9 +9212,7 @@ void REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE.W -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10417,9 +9232,7 @@ void REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE.W (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10440,9 +9253,7 @@ void REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -10456,9 +9267,7 @@ void REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE.W (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10473,9 +9282,7 @@ void REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE.W (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10491,9 +9298,7 @@ void REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10510,9 +9315,7 @@ void REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -10525,9 +9328,7 @@ void REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -10799,9 +9600,7 @@ void REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE.W Dn,(An) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10821,9 +9620,7 @@ void REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE.W An,(An) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10844,9 +9641,7 @@ void REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE.W (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10868,9 +9663,7 @@ void REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE.W (An)+,(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10892,9 +9685,7 @@ void REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE.W -(An),(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10915,9 +9706,7 @@ void REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10939,9 +9728,7 @@ void REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -10956,9 +9743,7 @@ void REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10974,9 +9759,7 @@ void REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10993,9 +9776,7 @@ void REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11013,9 +9794,7 @@ void REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11029,9 +9808,7 @@ void REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(An) */
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11052,9 +9829,7 @@ void REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE.W Dn,(An)+ */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11075,9 +9850,7 @@ void REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE.W An,(An)+ */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11099,9 +9872,7 @@ void REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE.W (An),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11124,9 +9895,7 @@ void REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11149,9 +9918,7 @@ void REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE.W -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11173,9 +9940,7 @@ void REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11198,9 +9963,7 @@ void REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11216,9 +9979,7 @@ void REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11235,9 +9996,7 @@ void REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11255,9 +10014,7 @@ void REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11276,9 +10033,7 @@ void REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11293,9 +10048,7 @@ void REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(An)+ */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11316,9 +10069,7 @@ void REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE.W Dn,-(An) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11339,9 +10090,7 @@ void REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE.W An,-(An) */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11363,9 +10112,7 @@ void REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE.W (An),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11388,9 +10135,7 @@ void REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE.W (An)+,-(An) */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11413,9 +10158,7 @@ void REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE.W -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11437,9 +10180,7 @@ void REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE.W (d16,An),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11462,9 +10203,7 @@ void REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11480,9 +10219,7 @@ void REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE.W (xxx).W,-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11499,9 +10236,7 @@ void REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE.W (xxx).L,-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11519,9 +10254,7 @@ void REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11540,9 +10273,7 @@ void REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11557,9 +10288,7 @@ void REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,-(An) */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11579,9 +10308,7 @@ void REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE.W Dn,(d16,An) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11601,9 +10328,7 @@ void REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE.W An,(d16,An) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11624,9 +10349,7 @@ void REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE.W (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11648,9 +10371,7 @@ void REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE.W (An)+,(d16,An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11672,9 +10393,7 @@ void REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE.W -(An),(d16,An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11695,9 +10414,7 @@ void REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE.W (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11719,9 +10436,7 @@ void REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -11737,9 +10452,7 @@ void REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11755,9 +10468,7 @@ void REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -11774,9 +10485,7 @@ void REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11794,9 +10503,7 @@ void REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -11811,9 +10518,7 @@ void REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(d16,An) *
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -11834,9 +10539,7 @@ void REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -11856,9 +10559,7 @@ void REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -11879,9 +10580,7 @@ void REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11903,9 +10602,7 @@ void REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += 2;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11927,9 +10624,7 @@ void REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11950,9 +10645,7 @@ void REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn)
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11973,9 +10666,7 @@ void REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -11991,9 +10682,7 @@ void REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) *
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12009,9 +10698,7 @@ void REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) *
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12028,9 +10715,7 @@ void REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn)
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12047,9 +10732,7 @@ void REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -12064,9 +10747,7 @@ void REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn)
 {{	uae_s16 src = get_iword(2);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -12080,9 +10761,7 @@ void REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).W */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -12097,9 +10776,7 @@ void REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE.W An,(xxx).W */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -12115,9 +10792,7 @@ void REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE.W (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12134,9 +10809,7 @@ void REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(xxx).W */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12153,9 +10826,7 @@ void REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE.W -(An),(xxx).W */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12171,9 +10842,7 @@ void REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12190,9 +10859,7 @@ void REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -12203,9 +10870,7 @@ void REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12216,9 +10881,7 @@ void REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12230,9 +10893,7 @@ void REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12245,9 +10906,7 @@ void REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -12257,9 +10916,7 @@ void REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(xxx).W */
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12274,9 +10931,7 @@ void REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).L */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12291,9 +10946,7 @@ void REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE.W An,(xxx).L */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12309,9 +10962,7 @@ void REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE.W (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12328,9 +10979,7 @@ void REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(xxx).L */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12347,9 +10996,7 @@ void REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE.W -(An),(xxx).L */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12365,9 +11012,7 @@ void REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12384,9 +11029,7 @@ void REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -12397,9 +11040,7 @@ void REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12410,9 +11051,7 @@ void REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -12424,9 +11063,7 @@ void REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12439,9 +11076,7 @@ void REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -12451,9 +11086,7 @@ void REGPARAM2 CPUFUNC(op_33fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(xxx).L */
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -13723,9 +12356,7 @@ void REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR.B Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+{{	lazyflag_testb (0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13739,9 +12370,7 @@ void REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR.B (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13756,9 +12385,7 @@ void REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR.B (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13773,9 +12400,7 @@ void REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR.B -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13789,9 +12414,7 @@ void REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR.B (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13806,9 +12429,7 @@ void REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}}	cpuop_end();
 }
@@ -13816,9 +12437,7 @@ void REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR.B (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13827,9 +12446,7 @@ void REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR.B (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -13842,9 +12459,7 @@ void REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR.W Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+{{	lazyflag_testw (0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13858,9 +12473,7 @@ void REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR.W (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13875,9 +12488,7 @@ void REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR.W (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13892,9 +12503,7 @@ void REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR.W -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13908,9 +12517,7 @@ void REGPARAM2 CPUFUNC(op_4268_0)(uae_u32 opcode) /* CLR.W (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13925,9 +12532,7 @@ void REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}}	cpuop_end();
 }
@@ -13935,9 +12540,7 @@ void REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR.W (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13946,9 +12549,7 @@ void REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR.W (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -13961,9 +12562,7 @@ void REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR.L Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+{{	lazyflag_testl (0);
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13977,9 +12576,7 @@ void REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR.L (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13994,9 +12591,7 @@ void REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR.L (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -14014,9 +12609,7 @@ void REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR.L -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -14030,9 +12623,7 @@ void REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR.L (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -14047,9 +12638,7 @@ void REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}}	cpuop_end();
 }
@@ -14057,9 +12646,7 @@ void REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR.L (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -14068,9 +12655,7 @@ void REGPARAM2 CPUFUNC(op_42b9_0)(uae_u32 opcode) /* CLR.L (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -14212,16 +12797,9 @@ void REGPARAM2 CPUFUNC(op_4400_0)(uae_u32 opcode) /* NEG.B Dn */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
@@ -14235,16 +12813,9 @@ void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
@@ -14259,16 +12830,9 @@ void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
@@ -14283,16 +12847,9 @@ void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
@@ -14306,16 +12863,9 @@ void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
@@ -14330,16 +12880,9 @@ void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}}	cpuop_end();
+}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 {
@@ -14347,16 +12890,9 @@ void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
@@ -14365,16 +12901,9 @@ void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
@@ -14387,16 +12916,9 @@ void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
@@ -14410,16 +12932,9 @@ void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
@@ -14434,16 +12949,9 @@ void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
@@ -14458,16 +12966,9 @@ void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
@@ -14481,16 +12982,9 @@ void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
@@ -14505,16 +12999,9 @@ void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}}	cpuop_end();
+}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 {
@@ -14522,16 +13009,9 @@ void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
@@ -14540,16 +13020,9 @@ void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
@@ -14562,16 +13035,9 @@ void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	m68k_dreg(regs, srcreg) = (dst);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
@@ -14585,16 +13051,9 @@ void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
@@ -14609,16 +13068,9 @@ void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
@@ -14633,16 +13085,9 @@ void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
@@ -14656,16 +13101,9 @@ void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
@@ -14680,16 +13118,9 @@ void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}}	cpuop_end();
+}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 {
@@ -14697,16 +13128,9 @@ void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
@@ -14715,16 +13139,9 @@ void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44c0_0)(uae_u32 opcode) /* MV2SR.B Dn */
@@ -14901,9 +13318,7 @@ void REGPARAM2 CPUFUNC(op_4600_0)(uae_u32 opcode) /* NOT.B Dn */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -14919,9 +13334,7 @@ void REGPARAM2 CPUFUNC(op_4610_0)(uae_u32 opcode) /* NOT.B (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14938,9 +13351,7 @@ void REGPARAM2 CPUFUNC(op_4618_0)(uae_u32 opcode) /* NOT.B (An)+ */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14957,9 +13368,7 @@ void REGPARAM2 CPUFUNC(op_4620_0)(uae_u32 opcode) /* NOT.B -(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14975,9 +13384,7 @@ void REGPARAM2 CPUFUNC(op_4628_0)(uae_u32 opcode) /* NOT.B (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -14994,9 +13401,7 @@ void REGPARAM2 CPUFUNC(op_4630_0)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15006,9 +13411,7 @@ void REGPARAM2 CPUFUNC(op_4638_0)(uae_u32 opcode) /* NOT.B (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15019,9 +13422,7 @@ void REGPARAM2 CPUFUNC(op_4639_0)(uae_u32 opcode) /* NOT.B (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15036,9 +13437,7 @@ void REGPARAM2 CPUFUNC(op_4640_0)(uae_u32 opcode) /* NOT.W Dn */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15054,9 +13453,7 @@ void REGPARAM2 CPUFUNC(op_4650_0)(uae_u32 opcode) /* NOT.W (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15073,9 +13470,7 @@ void REGPARAM2 CPUFUNC(op_4658_0)(uae_u32 opcode) /* NOT.W (An)+ */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15092,9 +13487,7 @@ void REGPARAM2 CPUFUNC(op_4660_0)(uae_u32 opcode) /* NOT.W -(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15110,9 +13503,7 @@ void REGPARAM2 CPUFUNC(op_4668_0)(uae_u32 opcode) /* NOT.W (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15129,9 +13520,7 @@ void REGPARAM2 CPUFUNC(op_4670_0)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15141,9 +13530,7 @@ void REGPARAM2 CPUFUNC(op_4678_0)(uae_u32 opcode) /* NOT.W (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15154,9 +13541,7 @@ void REGPARAM2 CPUFUNC(op_4679_0)(uae_u32 opcode) /* NOT.W (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15171,9 +13556,7 @@ void REGPARAM2 CPUFUNC(op_4680_0)(uae_u32 opcode) /* NOT.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15189,9 +13572,7 @@ void REGPARAM2 CPUFUNC(op_4690_0)(uae_u32 opcode) /* NOT.L (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15208,9 +13589,7 @@ void REGPARAM2 CPUFUNC(op_4698_0)(uae_u32 opcode) /* NOT.L (An)+ */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15227,9 +13606,7 @@ void REGPARAM2 CPUFUNC(op_46a0_0)(uae_u32 opcode) /* NOT.L -(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15245,9 +13622,7 @@ void REGPARAM2 CPUFUNC(op_46a8_0)(uae_u32 opcode) /* NOT.L (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15264,9 +13639,7 @@ void REGPARAM2 CPUFUNC(op_46b0_0)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15276,9 +13649,7 @@ void REGPARAM2 CPUFUNC(op_46b8_0)(uae_u32 opcode) /* NOT.L (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15289,9 +13660,7 @@ void REGPARAM2 CPUFUNC(op_46b9_0)(uae_u32 opcode) /* NOT.L (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15682,9 +14051,7 @@ void REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP.W Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15822,9 +14189,7 @@ void REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT.W Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15944,9 +14309,7 @@ void REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -16066,9 +14429,7 @@ void REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT.B Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -16082,9 +14443,7 @@ void REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST.B Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16098,9 +14457,7 @@ void REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST.B (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16115,9 +14472,7 @@ void REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST.B (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16132,9 +14487,7 @@ void REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST.B -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16148,9 +14501,7 @@ void REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST.B (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16165,9 +14516,7 @@ void REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST.B (xxx).W */
@@ -16175,9 +14524,7 @@ void REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST.B (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16186,9 +14533,7 @@ void REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST.B (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16198,9 +14543,7 @@ void REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST.B (d16,PC) */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16211,18 +14554,14 @@ void REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST.B #<data>.B */
 {
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16235,9 +14574,7 @@ void REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST.W Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16250,9 +14587,7 @@ void REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST.W An */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16266,9 +14601,7 @@ void REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST.W (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16283,9 +14616,7 @@ void REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST.W (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16300,9 +14631,7 @@ void REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST.W -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16316,9 +14645,7 @@ void REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST.W (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16333,9 +14660,7 @@ void REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST.W (xxx).W */
@@ -16343,9 +14668,7 @@ void REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST.W (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16354,9 +14677,7 @@ void REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST.W (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16366,9 +14687,7 @@ void REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST.W (d16,PC) */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16379,18 +14698,14 @@ void REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST.W #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16403,9 +14718,7 @@ void REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST.L Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16418,9 +14731,7 @@ void REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST.L An */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16434,9 +14745,7 @@ void REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST.L (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16451,9 +14760,7 @@ void REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST.L (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16468,9 +14775,7 @@ void REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST.L -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
@@ -16484,9 +14789,7 @@ void REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST.L (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16501,9 +14804,7 @@ void REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST.L (xxx).W */
@@ -16511,9 +14812,7 @@ void REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST.L (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16522,9 +14821,7 @@ void REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST.L (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16534,9 +14831,7 @@ void REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST.L (d16,PC) */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -16547,18 +14842,14 @@ void REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16571,9 +14862,7 @@ void REGPARAM2 CPUFUNC(op_4ac0_0)(uae_u32 opcode) /* TAS.B Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -16589,9 +14878,7 @@ void REGPARAM2 CPUFUNC(op_4ad0_0)(uae_u32 opcode) /* TAS.B (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16608,9 +14895,7 @@ void REGPARAM2 CPUFUNC(op_4ad8_0)(uae_u32 opcode) /* TAS.B (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16627,9 +14912,7 @@ void REGPARAM2 CPUFUNC(op_4ae0_0)(uae_u32 opcode) /* TAS.B -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16645,9 +14928,7 @@ void REGPARAM2 CPUFUNC(op_4ae8_0)(uae_u32 opcode) /* TAS.B (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -16664,9 +14945,7 @@ void REGPARAM2 CPUFUNC(op_4af0_0)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}}	cpuop_end();
@@ -16676,9 +14955,7 @@ void REGPARAM2 CPUFUNC(op_4af8_0)(uae_u32 opcode) /* TAS.B (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -16689,9 +14966,7 @@ void REGPARAM2 CPUFUNC(op_4af9_0)(uae_u32 opcode) /* TAS.B (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(6);
@@ -17710,16 +15985,9 @@ void REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD.B #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
@@ -17739,16 +16007,9 @@ void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
@@ -17769,16 +16030,9 @@ void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
@@ -17799,16 +16053,9 @@ void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
@@ -17828,16 +16075,9 @@ void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
@@ -17858,16 +16098,9 @@ void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 {
@@ -17881,16 +16114,9 @@ void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
@@ -17905,16 +16131,9 @@ void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #endif
@@ -17936,16 +16155,9 @@ void REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD.W #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -17988,16 +16200,9 @@ void REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD.W #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
@@ -18018,16 +16223,9 @@ void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
@@ -18048,16 +16246,9 @@ void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
@@ -18077,16 +16268,9 @@ void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
@@ -18107,16 +16291,9 @@ void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 {
@@ -18130,16 +16307,9 @@ void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
@@ -18154,16 +16324,9 @@ void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
@@ -18182,16 +16345,9 @@ void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -18234,16 +16390,9 @@ void REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD.L #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
@@ -18264,16 +16413,9 @@ void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
@@ -18294,16 +16436,9 @@ void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
@@ -18323,16 +16458,9 @@ void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
@@ -18353,16 +16481,9 @@ void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 {
@@ -18376,16 +16497,9 @@ void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
@@ -18400,16 +16514,9 @@ void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -18614,16 +16721,9 @@ void REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB.B #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
@@ -18643,16 +16743,9 @@ void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
@@ -18673,16 +16766,9 @@ void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
@@ -18703,16 +16789,9 @@ void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
@@ -18732,16 +16811,9 @@ void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
@@ -18762,16 +16834,9 @@ void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 {
@@ -18785,16 +16850,9 @@ void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
@@ -18809,16 +16867,9 @@ void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
@@ -18837,16 +16888,9 @@ void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -18889,16 +16933,9 @@ void REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB.W #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
@@ -18919,16 +16956,9 @@ void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
@@ -18949,16 +16979,9 @@ void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
@@ -18978,16 +17001,9 @@ void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
@@ -19008,16 +17024,9 @@ void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 {
@@ -19031,16 +17040,9 @@ void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
@@ -19055,16 +17057,9 @@ void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
@@ -19083,16 +17078,9 @@ void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -19135,16 +17123,9 @@ void REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB.L #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
@@ -19165,16 +17146,9 @@ void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
@@ -19195,16 +17169,9 @@ void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
@@ -19224,16 +17191,9 @@ void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
@@ -19254,16 +17214,9 @@ void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 {
@@ -19277,16 +17230,9 @@ void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
@@ -19301,16 +17247,9 @@ void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -22908,9 +20847,7 @@ void REGPARAM2 CPUFUNC(op_7000_0)(uae_u32 opcode) /* MOVE.L #<data>,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -22954,9 +20891,7 @@ void REGPARAM2 CPUFUNC(op_8000_0)(uae_u32 opcode) /* OR.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -22978,9 +20913,7 @@ void REGPARAM2 CPUFUNC(op_8010_0)(uae_u32 opcode) /* OR.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23003,9 +20936,7 @@ void REGPARAM2 CPUFUNC(op_8018_0)(uae_u32 opcode) /* OR.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23028,9 +20959,7 @@ void REGPARAM2 CPUFUNC(op_8020_0)(uae_u32 opcode) /* OR.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23052,9 +20981,7 @@ void REGPARAM2 CPUFUNC(op_8028_0)(uae_u32 opcode) /* OR.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23077,9 +21004,7 @@ void REGPARAM2 CPUFUNC(op_8030_0)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -23095,9 +21020,7 @@ void REGPARAM2 CPUFUNC(op_8038_0)(uae_u32 opcode) /* OR.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23114,9 +21037,7 @@ void REGPARAM2 CPUFUNC(op_8039_0)(uae_u32 opcode) /* OR.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23134,9 +21055,7 @@ void REGPARAM2 CPUFUNC(op_803a_0)(uae_u32 opcode) /* OR.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23155,9 +21074,7 @@ void REGPARAM2 CPUFUNC(op_803b_0)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -23172,9 +21089,7 @@ void REGPARAM2 CPUFUNC(op_803c_0)(uae_u32 opcode) /* OR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -23195,9 +21110,7 @@ void REGPARAM2 CPUFUNC(op_8040_0)(uae_u32 opcode) /* OR.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -23219,9 +21132,7 @@ void REGPARAM2 CPUFUNC(op_8050_0)(uae_u32 opcode) /* OR.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23244,9 +21155,7 @@ void REGPARAM2 CPUFUNC(op_8058_0)(uae_u32 opcode) /* OR.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23269,9 +21178,7 @@ void REGPARAM2 CPUFUNC(op_8060_0)(uae_u32 opcode) /* OR.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23293,9 +21200,7 @@ void REGPARAM2 CPUFUNC(op_8068_0)(uae_u32 opcode) /* OR.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23318,9 +21223,7 @@ void REGPARAM2 CPUFUNC(op_8070_0)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -23336,9 +21239,7 @@ void REGPARAM2 CPUFUNC(op_8078_0)(uae_u32 opcode) /* OR.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23355,9 +21256,7 @@ void REGPARAM2 CPUFUNC(op_8079_0)(uae_u32 opcode) /* OR.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23375,9 +21274,7 @@ void REGPARAM2 CPUFUNC(op_807a_0)(uae_u32 opcode) /* OR.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23396,9 +21293,7 @@ void REGPARAM2 CPUFUNC(op_807b_0)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -23413,9 +21308,7 @@ void REGPARAM2 CPUFUNC(op_807c_0)(uae_u32 opcode) /* OR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -23436,9 +21329,7 @@ void REGPARAM2 CPUFUNC(op_8080_0)(uae_u32 opcode) /* OR.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -23460,9 +21351,7 @@ void REGPARAM2 CPUFUNC(op_8090_0)(uae_u32 opcode) /* OR.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23485,9 +21374,7 @@ void REGPARAM2 CPUFUNC(op_8098_0)(uae_u32 opcode) /* OR.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23510,9 +21397,7 @@ void REGPARAM2 CPUFUNC(op_80a0_0)(uae_u32 opcode) /* OR.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23534,9 +21419,7 @@ void REGPARAM2 CPUFUNC(op_80a8_0)(uae_u32 opcode) /* OR.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23559,9 +21442,7 @@ void REGPARAM2 CPUFUNC(op_80b0_0)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -23577,9 +21458,7 @@ void REGPARAM2 CPUFUNC(op_80b8_0)(uae_u32 opcode) /* OR.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23596,9 +21475,7 @@ void REGPARAM2 CPUFUNC(op_80b9_0)(uae_u32 opcode) /* OR.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23616,9 +21493,7 @@ void REGPARAM2 CPUFUNC(op_80ba_0)(uae_u32 opcode) /* OR.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23637,9 +21512,7 @@ void REGPARAM2 CPUFUNC(op_80bb_0)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -23654,9 +21527,7 @@ void REGPARAM2 CPUFUNC(op_80bc_0)(uae_u32 opcode) /* OR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -23683,9 +21554,7 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23716,9 +21585,7 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23750,9 +21617,7 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23784,9 +21649,7 @@ m68k_incpc(2);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23817,9 +21680,7 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23850,9 +21711,7 @@ void REGPARAM2 CPUFUNC(op_80f0_0)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23878,9 +21737,7 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23906,9 +21763,7 @@ m68k_incpc(6);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23935,9 +21790,7 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23964,9 +21817,7 @@ void REGPARAM2 CPUFUNC(op_80fb_0)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -23991,9 +21842,7 @@ m68k_incpc(4);
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24080,9 +21929,7 @@ void REGPARAM2 CPUFUNC(op_8110_0)(uae_u32 opcode) /* OR.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24105,9 +21952,7 @@ void REGPARAM2 CPUFUNC(op_8118_0)(uae_u32 opcode) /* OR.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24130,9 +21975,7 @@ void REGPARAM2 CPUFUNC(op_8120_0)(uae_u32 opcode) /* OR.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24154,9 +21997,7 @@ void REGPARAM2 CPUFUNC(op_8128_0)(uae_u32 opcode) /* OR.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24179,9 +22020,7 @@ void REGPARAM2 CPUFUNC(op_8130_0)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24197,9 +22036,7 @@ void REGPARAM2 CPUFUNC(op_8138_0)(uae_u32 opcode) /* OR.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24216,9 +22053,7 @@ void REGPARAM2 CPUFUNC(op_8139_0)(uae_u32 opcode) /* OR.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24287,9 +22122,7 @@ void REGPARAM2 CPUFUNC(op_8150_0)(uae_u32 opcode) /* OR.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24312,9 +22145,7 @@ void REGPARAM2 CPUFUNC(op_8158_0)(uae_u32 opcode) /* OR.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24337,9 +22168,7 @@ void REGPARAM2 CPUFUNC(op_8160_0)(uae_u32 opcode) /* OR.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24361,9 +22190,7 @@ void REGPARAM2 CPUFUNC(op_8168_0)(uae_u32 opcode) /* OR.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24386,9 +22213,7 @@ void REGPARAM2 CPUFUNC(op_8170_0)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24404,9 +22229,7 @@ void REGPARAM2 CPUFUNC(op_8178_0)(uae_u32 opcode) /* OR.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24423,9 +22246,7 @@ void REGPARAM2 CPUFUNC(op_8179_0)(uae_u32 opcode) /* OR.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24496,9 +22317,7 @@ void REGPARAM2 CPUFUNC(op_8190_0)(uae_u32 opcode) /* OR.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24521,9 +22340,7 @@ void REGPARAM2 CPUFUNC(op_8198_0)(uae_u32 opcode) /* OR.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24546,9 +22363,7 @@ void REGPARAM2 CPUFUNC(op_81a0_0)(uae_u32 opcode) /* OR.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24570,9 +22385,7 @@ void REGPARAM2 CPUFUNC(op_81a8_0)(uae_u32 opcode) /* OR.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24595,9 +22408,7 @@ void REGPARAM2 CPUFUNC(op_81b0_0)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24613,9 +22424,7 @@ void REGPARAM2 CPUFUNC(op_81b8_0)(uae_u32 opcode) /* OR.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24632,9 +22441,7 @@ void REGPARAM2 CPUFUNC(op_81b9_0)(uae_u32 opcode) /* OR.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24657,14 +22464,12 @@ void REGPARAM2 CPUFUNC(op_81c0_0)(uae_u32 opcode) /* DIVS.W Dn,Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1293; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24691,14 +22496,12 @@ void REGPARAM2 CPUFUNC(op_81d0_0)(uae_u32 opcode) /* DIVS.W (An),Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1294; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24726,14 +22529,12 @@ void REGPARAM2 CPUFUNC(op_81d8_0)(uae_u32 opcode) /* DIVS.W (An)+,Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1295; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24761,14 +22562,12 @@ void REGPARAM2 CPUFUNC(op_81e0_0)(uae_u32 opcode) /* DIVS.W -(An),Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1296; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24795,14 +22594,12 @@ void REGPARAM2 CPUFUNC(op_81e8_0)(uae_u32 opcode) /* DIVS.W (d16,An),Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1297; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24829,14 +22626,12 @@ void REGPARAM2 CPUFUNC(op_81f0_0)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1298; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24858,14 +22653,12 @@ void REGPARAM2 CPUFUNC(op_81f8_0)(uae_u32 opcode) /* DIVS.W (xxx).W,Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1299; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24887,14 +22680,12 @@ void REGPARAM2 CPUFUNC(op_81f9_0)(uae_u32 opcode) /* DIVS.W (xxx).L,Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(6);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1300; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24917,14 +22708,12 @@ void REGPARAM2 CPUFUNC(op_81fa_0)(uae_u32 opcode) /* DIVS.W (d16,PC),Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1301; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24947,14 +22736,12 @@ void REGPARAM2 CPUFUNC(op_81fb_0)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1302; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -24975,14 +22762,12 @@ void REGPARAM2 CPUFUNC(op_81fc_0)(uae_u32 opcode) /* DIVS.W #<data>.W,Dn */
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
 	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1303; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -25006,16 +22791,9 @@ void REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
@@ -25035,16 +22813,9 @@ void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
@@ -25065,16 +22836,9 @@ void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
@@ -25095,16 +22859,9 @@ void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
@@ -25124,16 +22881,9 @@ void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
@@ -25154,16 +22904,9 @@ void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 {
@@ -25177,16 +22920,9 @@ void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
@@ -25201,16 +22937,9 @@ void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
@@ -25226,16 +22955,9 @@ void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
@@ -25252,16 +22974,9 @@ void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {
@@ -25274,16 +22989,9 @@ void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
@@ -25302,16 +23010,9 @@ void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
@@ -25330,16 +23031,9 @@ void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
@@ -25359,16 +23053,9 @@ void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
@@ -25389,16 +23076,9 @@ void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
@@ -25419,16 +23099,9 @@ void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
@@ -25448,16 +23121,9 @@ void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
@@ -25478,16 +23144,9 @@ void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 {
@@ -25501,16 +23160,9 @@ void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
@@ -25525,16 +23177,9 @@ void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
@@ -25550,16 +23195,9 @@ void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
@@ -25576,16 +23214,9 @@ void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {
@@ -25598,16 +23229,9 @@ void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
@@ -25626,16 +23250,9 @@ void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
@@ -25654,16 +23271,9 @@ void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
@@ -25683,16 +23293,9 @@ void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
@@ -25713,16 +23316,9 @@ void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
@@ -25743,16 +23339,9 @@ void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
@@ -25772,16 +23361,9 @@ void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
@@ -25802,16 +23384,9 @@ void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 {
@@ -25825,16 +23400,9 @@ void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
@@ -25849,16 +23417,9 @@ void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
@@ -25874,16 +23435,9 @@ void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
@@ -25900,16 +23454,9 @@ void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {
@@ -25922,16 +23469,9 @@ void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -26275,16 +23815,9 @@ void REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
@@ -26305,16 +23838,9 @@ void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
@@ -26335,16 +23861,9 @@ void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
@@ -26364,16 +23883,9 @@ void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
@@ -26394,16 +23906,9 @@ void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 {
@@ -26417,16 +23922,9 @@ void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
@@ -26441,16 +23939,9 @@ void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9140_0)(uae_u32 opcode) /* SUBX.W Dn,Dn */
@@ -26530,16 +24021,9 @@ void REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
@@ -26560,16 +24044,9 @@ void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
@@ -26590,16 +24067,9 @@ void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
@@ -26619,16 +24089,9 @@ void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
@@ -26649,16 +24112,9 @@ void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 {
@@ -26672,16 +24128,9 @@ void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
@@ -26696,16 +24145,9 @@ void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9180_0)(uae_u32 opcode) /* SUBX.L Dn,Dn */
@@ -26785,16 +24227,9 @@ void REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
@@ -26815,16 +24250,9 @@ void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
@@ -26845,16 +24273,9 @@ void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
@@ -26874,16 +24295,9 @@ void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
@@ -26904,16 +24318,9 @@ void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 {
@@ -26927,16 +24334,9 @@ void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
@@ -26951,16 +24351,9 @@ void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -27243,14 +24636,8 @@ void REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
@@ -27270,14 +24657,8 @@ void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
@@ -27298,14 +24679,8 @@ void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
@@ -27326,14 +24701,8 @@ void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
@@ -27353,14 +24722,8 @@ void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
@@ -27381,14 +24744,8 @@ void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 {
@@ -27402,14 +24759,8 @@ void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
@@ -27424,14 +24775,8 @@ void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
@@ -27447,14 +24792,8 @@ void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
@@ -27471,14 +24810,8 @@ void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {
@@ -27491,14 +24824,8 @@ void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
@@ -27517,14 +24844,8 @@ void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #endif
@@ -27546,14 +24867,8 @@ void REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
@@ -27573,14 +24888,8 @@ void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
@@ -27601,14 +24910,8 @@ void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
@@ -27629,14 +24932,8 @@ void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
@@ -27656,14 +24953,8 @@ void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
@@ -27684,14 +24975,8 @@ void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
 {
@@ -27705,14 +24990,8 @@ void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
@@ -27727,14 +25006,8 @@ void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
@@ -27750,14 +25023,8 @@ void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
@@ -27774,14 +25041,8 @@ void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {
@@ -27794,14 +25055,8 @@ void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
@@ -27820,14 +25075,8 @@ void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
@@ -27846,14 +25095,8 @@ void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
@@ -27873,14 +25116,8 @@ void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
@@ -27901,14 +25138,8 @@ void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
@@ -27929,14 +25160,8 @@ void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
@@ -27956,14 +25181,8 @@ void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
@@ -27984,14 +25203,8 @@ void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
 {
@@ -28005,14 +25218,8 @@ void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
@@ -28027,14 +25234,8 @@ void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
@@ -28050,14 +25251,8 @@ void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
@@ -28074,14 +25269,8 @@ void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {
@@ -28094,14 +25283,8 @@ void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
@@ -28120,14 +25303,8 @@ void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
@@ -28146,14 +25323,8 @@ void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
@@ -28173,14 +25344,8 @@ void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
@@ -28201,14 +25366,8 @@ void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
@@ -28229,14 +25388,8 @@ void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
@@ -28256,14 +25409,8 @@ void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
@@ -28284,14 +25431,8 @@ void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 {
@@ -28305,14 +25446,8 @@ void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
@@ -28327,14 +25462,8 @@ void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
@@ -28350,14 +25479,8 @@ void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
@@ -28374,14 +25497,8 @@ void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 {
@@ -28394,14 +25511,8 @@ void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 {{	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR.B Dn,Dn */
@@ -28420,9 +25531,7 @@ void REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28447,14 +25556,8 @@ void REGPARAM2 CPUFUNC(op_b108_0)(uae_u32 opcode) /* CMPM.B (An)+,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR.B Dn,(An) */
@@ -28474,9 +25577,7 @@ void REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28499,9 +25600,7 @@ void REGPARAM2 CPUFUNC(op_b118_0)(uae_u32 opcode) /* EOR.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28524,9 +25623,7 @@ void REGPARAM2 CPUFUNC(op_b120_0)(uae_u32 opcode) /* EOR.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28548,9 +25645,7 @@ void REGPARAM2 CPUFUNC(op_b128_0)(uae_u32 opcode) /* EOR.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28573,9 +25668,7 @@ void REGPARAM2 CPUFUNC(op_b130_0)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -28591,9 +25684,7 @@ void REGPARAM2 CPUFUNC(op_b138_0)(uae_u32 opcode) /* EOR.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28610,9 +25701,7 @@ void REGPARAM2 CPUFUNC(op_b139_0)(uae_u32 opcode) /* EOR.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -28633,9 +25722,7 @@ void REGPARAM2 CPUFUNC(op_b140_0)(uae_u32 opcode) /* EOR.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28660,14 +25747,8 @@ void REGPARAM2 CPUFUNC(op_b148_0)(uae_u32 opcode) /* CMPM.W (An)+,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR.W Dn,(An) */
@@ -28687,9 +25768,7 @@ void REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28712,9 +25791,7 @@ void REGPARAM2 CPUFUNC(op_b158_0)(uae_u32 opcode) /* EOR.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28737,9 +25814,7 @@ void REGPARAM2 CPUFUNC(op_b160_0)(uae_u32 opcode) /* EOR.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28761,9 +25836,7 @@ void REGPARAM2 CPUFUNC(op_b168_0)(uae_u32 opcode) /* EOR.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28786,9 +25859,7 @@ void REGPARAM2 CPUFUNC(op_b170_0)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -28804,9 +25875,7 @@ void REGPARAM2 CPUFUNC(op_b178_0)(uae_u32 opcode) /* EOR.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28823,9 +25892,7 @@ void REGPARAM2 CPUFUNC(op_b179_0)(uae_u32 opcode) /* EOR.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -28846,9 +25913,7 @@ void REGPARAM2 CPUFUNC(op_b180_0)(uae_u32 opcode) /* EOR.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28873,14 +25938,8 @@ void REGPARAM2 CPUFUNC(op_b188_0)(uae_u32 opcode) /* CMPM.L (An)+,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR.L Dn,(An) */
@@ -28900,9 +25959,7 @@ void REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28925,9 +25982,7 @@ void REGPARAM2 CPUFUNC(op_b198_0)(uae_u32 opcode) /* EOR.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28950,9 +26005,7 @@ void REGPARAM2 CPUFUNC(op_b1a0_0)(uae_u32 opcode) /* EOR.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28974,9 +26027,7 @@ void REGPARAM2 CPUFUNC(op_b1a8_0)(uae_u32 opcode) /* EOR.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28999,9 +26050,7 @@ void REGPARAM2 CPUFUNC(op_b1b0_0)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -29017,9 +26066,7 @@ void REGPARAM2 CPUFUNC(op_b1b8_0)(uae_u32 opcode) /* EOR.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29036,9 +26083,7 @@ void REGPARAM2 CPUFUNC(op_b1b9_0)(uae_u32 opcode) /* EOR.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29059,14 +26104,8 @@ void REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA.L Dn,An */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
@@ -29085,14 +26124,8 @@ void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
@@ -29112,14 +26145,8 @@ void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
@@ -29140,14 +26167,8 @@ void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
@@ -29168,14 +26189,8 @@ void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
@@ -29195,14 +26210,8 @@ void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
@@ -29223,14 +26232,8 @@ void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 {
@@ -29244,14 +26247,8 @@ void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
@@ -29266,14 +26263,8 @@ void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
@@ -29289,14 +26280,8 @@ void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
@@ -29313,14 +26298,8 @@ void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 {
@@ -29333,14 +26312,8 @@ void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND.B Dn,Dn */
@@ -29359,9 +26332,7 @@ void REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29383,9 +26354,7 @@ void REGPARAM2 CPUFUNC(op_c010_0)(uae_u32 opcode) /* AND.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29408,9 +26377,7 @@ void REGPARAM2 CPUFUNC(op_c018_0)(uae_u32 opcode) /* AND.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29433,9 +26400,7 @@ void REGPARAM2 CPUFUNC(op_c020_0)(uae_u32 opcode) /* AND.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29457,9 +26422,7 @@ void REGPARAM2 CPUFUNC(op_c028_0)(uae_u32 opcode) /* AND.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29482,9 +26445,7 @@ void REGPARAM2 CPUFUNC(op_c030_0)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -29500,9 +26461,7 @@ void REGPARAM2 CPUFUNC(op_c038_0)(uae_u32 opcode) /* AND.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29519,9 +26478,7 @@ void REGPARAM2 CPUFUNC(op_c039_0)(uae_u32 opcode) /* AND.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29539,9 +26496,7 @@ void REGPARAM2 CPUFUNC(op_c03a_0)(uae_u32 opcode) /* AND.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29560,9 +26515,7 @@ void REGPARAM2 CPUFUNC(op_c03b_0)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -29577,9 +26530,7 @@ void REGPARAM2 CPUFUNC(op_c03c_0)(uae_u32 opcode) /* AND.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -29600,9 +26551,7 @@ void REGPARAM2 CPUFUNC(op_c040_0)(uae_u32 opcode) /* AND.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29624,9 +26573,7 @@ void REGPARAM2 CPUFUNC(op_c050_0)(uae_u32 opcode) /* AND.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29649,9 +26596,7 @@ void REGPARAM2 CPUFUNC(op_c058_0)(uae_u32 opcode) /* AND.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29674,9 +26619,7 @@ void REGPARAM2 CPUFUNC(op_c060_0)(uae_u32 opcode) /* AND.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29698,9 +26641,7 @@ void REGPARAM2 CPUFUNC(op_c068_0)(uae_u32 opcode) /* AND.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29723,9 +26664,7 @@ void REGPARAM2 CPUFUNC(op_c070_0)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -29741,9 +26680,7 @@ void REGPARAM2 CPUFUNC(op_c078_0)(uae_u32 opcode) /* AND.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29760,9 +26697,7 @@ void REGPARAM2 CPUFUNC(op_c079_0)(uae_u32 opcode) /* AND.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29780,9 +26715,7 @@ void REGPARAM2 CPUFUNC(op_c07a_0)(uae_u32 opcode) /* AND.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29801,9 +26734,7 @@ void REGPARAM2 CPUFUNC(op_c07b_0)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -29818,9 +26749,7 @@ void REGPARAM2 CPUFUNC(op_c07c_0)(uae_u32 opcode) /* AND.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -29841,9 +26770,7 @@ void REGPARAM2 CPUFUNC(op_c080_0)(uae_u32 opcode) /* AND.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29865,9 +26792,7 @@ void REGPARAM2 CPUFUNC(op_c090_0)(uae_u32 opcode) /* AND.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29890,9 +26815,7 @@ void REGPARAM2 CPUFUNC(op_c098_0)(uae_u32 opcode) /* AND.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29915,9 +26838,7 @@ void REGPARAM2 CPUFUNC(op_c0a0_0)(uae_u32 opcode) /* AND.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29939,9 +26860,7 @@ void REGPARAM2 CPUFUNC(op_c0a8_0)(uae_u32 opcode) /* AND.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29964,9 +26883,7 @@ void REGPARAM2 CPUFUNC(op_c0b0_0)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -29982,9 +26899,7 @@ void REGPARAM2 CPUFUNC(op_c0b8_0)(uae_u32 opcode) /* AND.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30001,9 +26916,7 @@ void REGPARAM2 CPUFUNC(op_c0b9_0)(uae_u32 opcode) /* AND.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30021,9 +26934,7 @@ void REGPARAM2 CPUFUNC(op_c0ba_0)(uae_u32 opcode) /* AND.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30042,9 +26953,7 @@ void REGPARAM2 CPUFUNC(op_c0bb_0)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -30059,9 +26968,7 @@ void REGPARAM2 CPUFUNC(op_c0bc_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -30082,9 +26989,7 @@ void REGPARAM2 CPUFUNC(op_c0c0_0)(uae_u32 opcode) /* MULU.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30106,9 +27011,7 @@ void REGPARAM2 CPUFUNC(op_c0d0_0)(uae_u32 opcode) /* MULU.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30131,9 +27034,7 @@ void REGPARAM2 CPUFUNC(op_c0d8_0)(uae_u32 opcode) /* MULU.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30156,9 +27057,7 @@ void REGPARAM2 CPUFUNC(op_c0e0_0)(uae_u32 opcode) /* MULU.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30180,9 +27079,7 @@ void REGPARAM2 CPUFUNC(op_c0e8_0)(uae_u32 opcode) /* MULU.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30205,9 +27102,7 @@ void REGPARAM2 CPUFUNC(op_c0f0_0)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -30223,9 +27118,7 @@ void REGPARAM2 CPUFUNC(op_c0f8_0)(uae_u32 opcode) /* MULU.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30242,9 +27135,7 @@ void REGPARAM2 CPUFUNC(op_c0f9_0)(uae_u32 opcode) /* MULU.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 	cpuop_end();
@@ -30262,9 +27153,7 @@ void REGPARAM2 CPUFUNC(op_c0fa_0)(uae_u32 opcode) /* MULU.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30283,9 +27172,7 @@ void REGPARAM2 CPUFUNC(op_c0fb_0)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -30300,9 +27187,7 @@ void REGPARAM2 CPUFUNC(op_c0fc_0)(uae_u32 opcode) /* MULU.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30388,9 +27273,7 @@ void REGPARAM2 CPUFUNC(op_c110_0)(uae_u32 opcode) /* AND.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30413,9 +27296,7 @@ void REGPARAM2 CPUFUNC(op_c118_0)(uae_u32 opcode) /* AND.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30438,9 +27319,7 @@ void REGPARAM2 CPUFUNC(op_c120_0)(uae_u32 opcode) /* AND.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30462,9 +27341,7 @@ void REGPARAM2 CPUFUNC(op_c128_0)(uae_u32 opcode) /* AND.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30487,9 +27364,7 @@ void REGPARAM2 CPUFUNC(op_c130_0)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30505,9 +27380,7 @@ void REGPARAM2 CPUFUNC(op_c138_0)(uae_u32 opcode) /* AND.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30524,9 +27397,7 @@ void REGPARAM2 CPUFUNC(op_c139_0)(uae_u32 opcode) /* AND.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30594,9 +27465,7 @@ void REGPARAM2 CPUFUNC(op_c150_0)(uae_u32 opcode) /* AND.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30619,9 +27488,7 @@ void REGPARAM2 CPUFUNC(op_c158_0)(uae_u32 opcode) /* AND.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30644,9 +27511,7 @@ void REGPARAM2 CPUFUNC(op_c160_0)(uae_u32 opcode) /* AND.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30668,9 +27533,7 @@ void REGPARAM2 CPUFUNC(op_c168_0)(uae_u32 opcode) /* AND.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30693,9 +27556,7 @@ void REGPARAM2 CPUFUNC(op_c170_0)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30711,9 +27572,7 @@ void REGPARAM2 CPUFUNC(op_c178_0)(uae_u32 opcode) /* AND.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30730,9 +27589,7 @@ void REGPARAM2 CPUFUNC(op_c179_0)(uae_u32 opcode) /* AND.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30777,9 +27634,7 @@ void REGPARAM2 CPUFUNC(op_c190_0)(uae_u32 opcode) /* AND.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30802,9 +27657,7 @@ void REGPARAM2 CPUFUNC(op_c198_0)(uae_u32 opcode) /* AND.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30827,9 +27680,7 @@ void REGPARAM2 CPUFUNC(op_c1a0_0)(uae_u32 opcode) /* AND.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30851,9 +27702,7 @@ void REGPARAM2 CPUFUNC(op_c1a8_0)(uae_u32 opcode) /* AND.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30876,9 +27725,7 @@ void REGPARAM2 CPUFUNC(op_c1b0_0)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30894,9 +27741,7 @@ void REGPARAM2 CPUFUNC(op_c1b8_0)(uae_u32 opcode) /* AND.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30913,9 +27758,7 @@ void REGPARAM2 CPUFUNC(op_c1b9_0)(uae_u32 opcode) /* AND.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30936,9 +27779,7 @@ void REGPARAM2 CPUFUNC(op_c1c0_0)(uae_u32 opcode) /* MULS.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30960,9 +27801,7 @@ void REGPARAM2 CPUFUNC(op_c1d0_0)(uae_u32 opcode) /* MULS.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30985,9 +27824,7 @@ void REGPARAM2 CPUFUNC(op_c1d8_0)(uae_u32 opcode) /* MULS.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31010,9 +27847,7 @@ void REGPARAM2 CPUFUNC(op_c1e0_0)(uae_u32 opcode) /* MULS.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31034,9 +27869,7 @@ void REGPARAM2 CPUFUNC(op_c1e8_0)(uae_u32 opcode) /* MULS.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31059,9 +27892,7 @@ void REGPARAM2 CPUFUNC(op_c1f0_0)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -31077,9 +27908,7 @@ void REGPARAM2 CPUFUNC(op_c1f8_0)(uae_u32 opcode) /* MULS.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31096,9 +27925,7 @@ void REGPARAM2 CPUFUNC(op_c1f9_0)(uae_u32 opcode) /* MULS.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 	cpuop_end();
@@ -31116,9 +27943,7 @@ void REGPARAM2 CPUFUNC(op_c1fa_0)(uae_u32 opcode) /* MULS.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31137,9 +27962,7 @@ void REGPARAM2 CPUFUNC(op_c1fb_0)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -31154,9 +27977,7 @@ void REGPARAM2 CPUFUNC(op_c1fc_0)(uae_u32 opcode) /* MULS.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -31177,16 +27998,9 @@ void REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
@@ -31206,16 +28020,9 @@ void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
@@ -31236,16 +28043,9 @@ void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
@@ -31266,16 +28066,9 @@ void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
@@ -31295,16 +28088,9 @@ void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
@@ -31325,16 +28111,9 @@ void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 {
@@ -31348,16 +28127,9 @@ void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
@@ -31372,16 +28144,9 @@ void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
@@ -31397,16 +28162,9 @@ void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
@@ -31423,16 +28181,9 @@ void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {
@@ -31445,16 +28196,9 @@ void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
@@ -31473,16 +28217,9 @@ void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
@@ -31501,16 +28238,9 @@ void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
@@ -31530,16 +28260,9 @@ void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
@@ -31560,16 +28283,9 @@ void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
@@ -31590,16 +28306,9 @@ void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
@@ -31619,16 +28328,9 @@ void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
@@ -31649,16 +28351,9 @@ void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 {
@@ -31672,16 +28367,9 @@ void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
@@ -31696,16 +28384,9 @@ void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
@@ -31721,16 +28402,9 @@ void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
@@ -31747,16 +28421,9 @@ void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {
@@ -31769,16 +28436,9 @@ void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
@@ -31797,16 +28457,9 @@ void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
@@ -31825,16 +28478,9 @@ void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
@@ -31854,16 +28500,9 @@ void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
@@ -31884,16 +28523,9 @@ void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
@@ -31914,16 +28546,9 @@ void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
@@ -31943,16 +28568,9 @@ void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
@@ -31973,16 +28591,9 @@ void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 {
@@ -31996,16 +28607,9 @@ void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
@@ -32020,16 +28624,9 @@ void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
@@ -32045,16 +28642,9 @@ void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
@@ -32071,16 +28661,9 @@ void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {
@@ -32093,16 +28676,9 @@ void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -32446,16 +29022,9 @@ void REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
@@ -32476,16 +29045,9 @@ void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
@@ -32506,16 +29068,9 @@ void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
@@ -32535,16 +29090,9 @@ void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
@@ -32565,16 +29113,9 @@ void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 {
@@ -32588,16 +29129,9 @@ void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
@@ -32612,16 +29146,9 @@ void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d140_0)(uae_u32 opcode) /* ADDX.W Dn,Dn */
@@ -32701,16 +29228,9 @@ void REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
@@ -32731,16 +29251,9 @@ void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
@@ -32761,16 +29274,9 @@ void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
@@ -32790,16 +29296,9 @@ void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
@@ -32820,16 +29319,9 @@ void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 {
@@ -32843,16 +29335,9 @@ void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
@@ -32867,16 +29352,9 @@ void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d180_0)(uae_u32 opcode) /* ADDX.L Dn,Dn */
@@ -32956,16 +29434,9 @@ void REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
@@ -32986,16 +29457,9 @@ void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
@@ -33016,16 +29480,9 @@ void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
@@ -33045,16 +29502,9 @@ void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
@@ -33075,16 +29525,9 @@ void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}}	cpuop_end();
+}}}}}}}	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 {
@@ -33098,16 +29541,9 @@ void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
@@ -33122,16 +29558,9 @@ void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -34264,9 +30693,7 @@ void REGPARAM2 CPUFUNC(op_e0d0_0)(uae_u32 opcode) /* ASRW.W (An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34288,9 +30715,7 @@ void REGPARAM2 CPUFUNC(op_e0d8_0)(uae_u32 opcode) /* ASRW.W (An)+ */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34312,9 +30737,7 @@ void REGPARAM2 CPUFUNC(op_e0e0_0)(uae_u32 opcode) /* ASRW.W -(An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34335,9 +30758,7 @@ void REGPARAM2 CPUFUNC(op_e0e8_0)(uae_u32 opcode) /* ASRW.W (d16,An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34359,9 +30780,7 @@ void REGPARAM2 CPUFUNC(op_e0f0_0)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34376,9 +30795,7 @@ void REGPARAM2 CPUFUNC(op_e0f8_0)(uae_u32 opcode) /* ASRW.W (xxx).W */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34394,9 +30811,7 @@ void REGPARAM2 CPUFUNC(op_e0f9_0)(uae_u32 opcode) /* ASRW.W (xxx).L */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35263,9 +31678,7 @@ void REGPARAM2 CPUFUNC(op_e1d0_0)(uae_u32 opcode) /* ASLW.W (An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35289,9 +31702,7 @@ void REGPARAM2 CPUFUNC(op_e1d8_0)(uae_u32 opcode) /* ASLW.W (An)+ */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35315,9 +31726,7 @@ void REGPARAM2 CPUFUNC(op_e1e0_0)(uae_u32 opcode) /* ASLW.W -(An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35340,9 +31749,7 @@ void REGPARAM2 CPUFUNC(op_e1e8_0)(uae_u32 opcode) /* ASLW.W (d16,An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35366,9 +31773,7 @@ void REGPARAM2 CPUFUNC(op_e1f0_0)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35385,9 +31790,7 @@ void REGPARAM2 CPUFUNC(op_e1f8_0)(uae_u32 opcode) /* ASLW.W (xxx).W */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35405,9 +31808,7 @@ void REGPARAM2 CPUFUNC(op_e1f9_0)(uae_u32 opcode) /* ASLW.W (xxx).L */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35429,9 +31830,7 @@ void REGPARAM2 CPUFUNC(op_e2d0_0)(uae_u32 opcode) /* LSRW.W (An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35452,9 +31851,7 @@ void REGPARAM2 CPUFUNC(op_e2d8_0)(uae_u32 opcode) /* LSRW.W (An)+ */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35475,9 +31872,7 @@ void REGPARAM2 CPUFUNC(op_e2e0_0)(uae_u32 opcode) /* LSRW.W -(An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35497,9 +31892,7 @@ void REGPARAM2 CPUFUNC(op_e2e8_0)(uae_u32 opcode) /* LSRW.W (d16,An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35520,9 +31913,7 @@ void REGPARAM2 CPUFUNC(op_e2f0_0)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35536,9 +31927,7 @@ void REGPARAM2 CPUFUNC(op_e2f8_0)(uae_u32 opcode) /* LSRW.W (xxx).W */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35553,9 +31942,7 @@ void REGPARAM2 CPUFUNC(op_e2f9_0)(uae_u32 opcode) /* LSRW.W (xxx).L */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35575,9 +31962,7 @@ void REGPARAM2 CPUFUNC(op_e3d0_0)(uae_u32 opcode) /* LSLW.W (An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35598,9 +31983,7 @@ void REGPARAM2 CPUFUNC(op_e3d8_0)(uae_u32 opcode) /* LSLW.W (An)+ */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35621,9 +32004,7 @@ void REGPARAM2 CPUFUNC(op_e3e0_0)(uae_u32 opcode) /* LSLW.W -(An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35643,9 +32024,7 @@ void REGPARAM2 CPUFUNC(op_e3e8_0)(uae_u32 opcode) /* LSLW.W (d16,An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35666,9 +32045,7 @@ void REGPARAM2 CPUFUNC(op_e3f0_0)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35682,9 +32059,7 @@ void REGPARAM2 CPUFUNC(op_e3f8_0)(uae_u32 opcode) /* LSLW.W (xxx).W */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35699,9 +32074,7 @@ void REGPARAM2 CPUFUNC(op_e3f9_0)(uae_u32 opcode) /* LSLW.W (xxx).L */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35722,9 +32095,7 @@ void REGPARAM2 CPUFUNC(op_e4d0_0)(uae_u32 opcode) /* ROXRW.W (An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35746,9 +32117,7 @@ void REGPARAM2 CPUFUNC(op_e4d8_0)(uae_u32 opcode) /* ROXRW.W (An)+ */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35770,9 +32139,7 @@ void REGPARAM2 CPUFUNC(op_e4e0_0)(uae_u32 opcode) /* ROXRW.W -(An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35793,9 +32160,7 @@ void REGPARAM2 CPUFUNC(op_e4e8_0)(uae_u32 opcode) /* ROXRW.W (d16,An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35817,9 +32182,7 @@ void REGPARAM2 CPUFUNC(op_e4f0_0)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35834,9 +32197,7 @@ void REGPARAM2 CPUFUNC(op_e4f8_0)(uae_u32 opcode) /* ROXRW.W (xxx).W */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35852,9 +32213,7 @@ void REGPARAM2 CPUFUNC(op_e4f9_0)(uae_u32 opcode) /* ROXRW.W (xxx).L */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35875,9 +32234,7 @@ void REGPARAM2 CPUFUNC(op_e5d0_0)(uae_u32 opcode) /* ROXLW.W (An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35899,9 +32256,7 @@ void REGPARAM2 CPUFUNC(op_e5d8_0)(uae_u32 opcode) /* ROXLW.W (An)+ */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35923,9 +32278,7 @@ void REGPARAM2 CPUFUNC(op_e5e0_0)(uae_u32 opcode) /* ROXLW.W -(An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35946,9 +32299,7 @@ void REGPARAM2 CPUFUNC(op_e5e8_0)(uae_u32 opcode) /* ROXLW.W (d16,An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35970,9 +32321,7 @@ void REGPARAM2 CPUFUNC(op_e5f0_0)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35987,9 +32336,7 @@ void REGPARAM2 CPUFUNC(op_e5f8_0)(uae_u32 opcode) /* ROXLW.W (xxx).W */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -36005,9 +32352,7 @@ void REGPARAM2 CPUFUNC(op_e5f9_0)(uae_u32 opcode) /* ROXLW.W (xxx).L */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -36028,9 +32373,7 @@ void REGPARAM2 CPUFUNC(op_e6d0_0)(uae_u32 opcode) /* RORW.W (An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36051,9 +32394,7 @@ void REGPARAM2 CPUFUNC(op_e6d8_0)(uae_u32 opcode) /* RORW.W (An)+ */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36074,9 +32415,7 @@ void REGPARAM2 CPUFUNC(op_e6e0_0)(uae_u32 opcode) /* RORW.W -(An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36096,9 +32435,7 @@ void REGPARAM2 CPUFUNC(op_e6e8_0)(uae_u32 opcode) /* RORW.W (d16,An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36119,9 +32456,7 @@ void REGPARAM2 CPUFUNC(op_e6f0_0)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}}	cpuop_end();
@@ -36135,9 +32470,7 @@ void REGPARAM2 CPUFUNC(op_e6f8_0)(uae_u32 opcode) /* RORW.W (xxx).W */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36152,9 +32485,7 @@ void REGPARAM2 CPUFUNC(op_e6f9_0)(uae_u32 opcode) /* RORW.W (xxx).L */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -36174,9 +32505,7 @@ void REGPARAM2 CPUFUNC(op_e7d0_0)(uae_u32 opcode) /* ROLW.W (An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36197,9 +32526,7 @@ void REGPARAM2 CPUFUNC(op_e7d8_0)(uae_u32 opcode) /* ROLW.W (An)+ */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36220,9 +32547,7 @@ void REGPARAM2 CPUFUNC(op_e7e0_0)(uae_u32 opcode) /* ROLW.W -(An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36242,9 +32567,7 @@ void REGPARAM2 CPUFUNC(op_e7e8_0)(uae_u32 opcode) /* ROLW.W (d16,An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36265,9 +32588,7 @@ void REGPARAM2 CPUFUNC(op_e7f0_0)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}}	cpuop_end();
@@ -36281,9 +32602,7 @@ void REGPARAM2 CPUFUNC(op_e7f8_0)(uae_u32 opcode) /* ROLW.W (xxx).W */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36298,9 +32617,7 @@ void REGPARAM2 CPUFUNC(op_e7f9_0)(uae_u32 opcode) /* ROLW.W (xxx).L */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -38711,248 +35028,2544 @@ void REGPARAM2 CPUFUNC(op_f43a_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 14) & 3);
+	uae_u32 srcreg = ((opcode >> 14) & 3);
+#else
+	uae_u32 srcreg = ((opcode >> 6) & 3);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel1857; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1857: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f43b_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 14) & 3);
+#else
+	uae_u32 srcreg = ((opcode >> 6) & 3);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel1858; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1858: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f43c_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 14) & 3);
+#else
+	uae_u32 srcreg = ((opcode >> 6) & 3);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel1859; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1859: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f43d_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 14) & 3);
+#else
+	uae_u32 srcreg = ((opcode >> 6) & 3);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel1860; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1860: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f43e_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 14) & 3);
+#else
+	uae_u32 srcreg = ((opcode >> 6) & 3);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel1861; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1861: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f43f_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 14) & 3);
+#else
+	uae_u32 srcreg = ((opcode >> 6) & 3);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel1862; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1862: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f500_0)(uae_u32 opcode) /* MMUOP.L #<data>,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)(((opcode >> 11) | (opcode << 5)) & 7);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 3) & 255);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 extra = srcreg;
+m68k_incpc(2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+#endif
+	mmu_op(opcode,extra);
+}}	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f600_0)(uae_u32 opcode) /* MOVE16.L (An)+,(xxx).L */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr memsa = m68k_areg(regs, srcreg);
+{	uaecptr memda = get_ilong(2);
+	memsa &= ~15;
+	memda &= ~15;
+	put_long(memda, get_long(memsa));
+	put_long(memda+4, get_long(memsa+4));
+	put_long(memda+8, get_long(memsa+8));
+	put_long(memda+12, get_long(memsa+12));
+	m68k_areg(regs, srcreg) += 16;
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f608_0)(uae_u32 opcode) /* MOVE16.L (xxx).L,(An)+ */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uaecptr memsa = get_ilong(2);
+{	uaecptr memda = m68k_areg(regs, dstreg);
+	memsa &= ~15;
+	memda &= ~15;
+	put_long(memda, get_long(memsa));
+	put_long(memda+4, get_long(memsa+4));
+	put_long(memda+8, get_long(memsa+8));
+	put_long(memda+12, get_long(memsa+12));
+	m68k_areg(regs, dstreg) += 16;
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f610_0)(uae_u32 opcode) /* MOVE16.L (An),(xxx).L */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr memsa = m68k_areg(regs, srcreg);
+{	uaecptr memda = get_ilong(2);
+	memsa &= ~15;
+	memda &= ~15;
+	put_long(memda, get_long(memsa));
+	put_long(memda+4, get_long(memsa+4));
+	put_long(memda+8, get_long(memsa+8));
+	put_long(memda+12, get_long(memsa+12));
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f618_0)(uae_u32 opcode) /* MOVE16.L (xxx).L,(An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uaecptr memsa = get_ilong(2);
+{	uaecptr memda = m68k_areg(regs, dstreg);
+	memsa &= ~15;
+	memda &= ~15;
+	put_long(memda, get_long(memsa));
+	put_long(memda+4, get_long(memsa+4));
+	put_long(memda+8, get_long(memsa+8));
+	put_long(memda+12, get_long(memsa+12));
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_f620_0)(uae_u32 opcode) /* MOVE16.L (An)+,(An)+ */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+	uae_u32 dstreg = 0;
+{	uaecptr mems = m68k_areg(regs, srcreg) & ~15, memd;
+	dstreg = (get_iword(2) >> 12) & 7;
+	memd = m68k_areg(regs, dstreg) & ~15;
+	put_long(memd, get_long(mems));
+	put_long(memd+4, get_long(mems+4));
+	put_long(memd+8, get_long(mems+8));
+	put_long(memd+12, get_long(mems+12));
+	if (srcreg != dstreg)
+	m68k_areg(regs, srcreg) += 16;
+	m68k_areg(regs, dstreg) += 16;
+}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#endif
+
+#if defined(PART_8) && !defined(NOFLAGS)
+void REGPARAM2 CPUFUNC(op_4a40_0_6701_0)(uae_u32 opcode) /* TST.W Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	lazyflag_testw (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1870: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a40_0_6601_0)(uae_u32 opcode) /* TST.W Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	lazyflag_testw (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1872: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a80_0_6701_0)(uae_u32 opcode) /* TST.L Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	lazyflag_testl (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1874: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a80_0_6601_0)(uae_u32 opcode) /* TST.L Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	lazyflag_testl (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1876: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a00_0_6701_0)(uae_u32 opcode) /* TST.B Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+	lazyflag_testb (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1878: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a00_0_6601_0)(uae_u32 opcode) /* TST.B Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+	lazyflag_testb (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1880: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a10_0_6701_0)(uae_u32 opcode) /* TST.B (An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	lazyflag_testb (src);
+}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1882: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a10_0_6601_0)(uae_u32 opcode) /* TST.B (An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	lazyflag_testb (src);
+}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1884: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a50_0_6701_0)(uae_u32 opcode) /* TST.W (An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	lazyflag_testw (src);
+}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1886: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a90_0_6701_0)(uae_u32 opcode) /* TST.L (An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	lazyflag_testl (src);
+}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1888: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a90_0_6601_0)(uae_u32 opcode) /* TST.L (An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	lazyflag_testl (src);
+}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1890: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a40_0_6b01_0)(uae_u32 opcode) /* TST.W Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	lazyflag_testw (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(11)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1892: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a40_0_6a01_0)(uae_u32 opcode) /* TST.W Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	lazyflag_testw (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(10)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1894: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a80_0_6b01_0)(uae_u32 opcode) /* TST.L Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	lazyflag_testl (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(11)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1896: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a80_0_6a01_0)(uae_u32 opcode) /* TST.L Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	lazyflag_testl (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(10)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1898: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a40_0_6700_0)(uae_u32 opcode) /* TST.W Dn + Bcc.W #<data>.W */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	lazyflag_testw (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel1900: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a40_0_6600_0)(uae_u32 opcode) /* TST.W Dn + Bcc.W #<data>.W */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	lazyflag_testw (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel1902: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a80_0_6700_0)(uae_u32 opcode) /* TST.L Dn + Bcc.W #<data>.W */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	lazyflag_testl (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel1904: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a80_0_6600_0)(uae_u32 opcode) /* TST.L Dn + Bcc.W #<data>.W */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	lazyflag_testl (src);
+}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+{{	uae_s16 src = get_iword(2);
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(4);
+endlabel1906: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6701_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1908: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6601_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1910: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6501_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1912: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6401_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(4)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1914: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6201_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(2)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1916: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6301_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(3)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1918: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6c01_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1920: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b040_0_6d01_0)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(13)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1922: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b080_0_6701_0)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1924: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b080_0_6601_0)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1926: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b080_0_6501_0)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1928: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b080_0_6201_0)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(2)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1930: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b080_0_6c01_0)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1932: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b080_0_6d01_0)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(13)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1934: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b000_0_6701_0)(uae_u32 opcode) /* CMP.B Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1936: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b000_0_6601_0)(uae_u32 opcode) /* CMP.B Dn,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1938: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b018_0_6701_0)(uae_u32 opcode) /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1940: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b018_0_6601_0)(uae_u32 opcode) /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1942: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c40_0_6701_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1944: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c40_0_6601_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_cmpw (newv, src, dst);
+}}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1946: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c80_0_6701_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(6);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1948: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c80_0_6601_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(6);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1950: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c00_0_6701_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1952: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c00_0_6601_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	lazyflag_cmpb (newv, src, dst);
+}}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1954: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1c8_0_6701_0)(uae_u32 opcode) /* CMPA.L An,An + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1956: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1c8_0_6601_0)(uae_u32 opcode) /* CMPA.L An,An + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1958: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1c8_0_6501_0)(uae_u32 opcode) /* CMPA.L An,An + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1960: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1c8_0_6401_0)(uae_u32 opcode) /* CMPA.L An,An + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_cmpl (newv, src, dst);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(4)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1962: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_800_0_6701_0)(uae_u32 opcode) /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1964: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_800_0_6601_0)(uae_u32 opcode) /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1966: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_810_0_6701_0)(uae_u32 opcode) /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1968: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_810_0_6601_0)(uae_u32 opcode) /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1970: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_2010_0_6701_0)(uae_u32 opcode) /* MOVE.L (An),Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	lazyflag_testl (src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1972: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_2010_0_6601_0)(uae_u32 opcode) /* MOVE.L (An),Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	lazyflag_testl (src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1974: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_2028_0_6701_0)(uae_u32 opcode) /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	lazyflag_testl (src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1976: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_2028_0_6601_0)(uae_u32 opcode) /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	lazyflag_testl (src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1978: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_20d8_0_51c8_0)(uae_u32 opcode) /* MOVE.L (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	lazyflag_testl (src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1980: ;
+	}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_30d8_0_51c8_0)(uae_u32 opcode) /* MOVE.W (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{
+	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	lazyflag_testw (src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 6) & 3);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1857; }
-{	if (srcreg&0x2)
-		flush_icache(43);
-}}m68k_incpc(2);
-endlabel1857: ;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1982: ;
+	}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f43b_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+void REGPARAM2 CPUFUNC(op_10d8_0_51c8_0)(uae_u32 opcode) /* MOVE.B (An)+,(An)+ + DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+	{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 14) & 3);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 6) & 3);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1858; }
-{	if (srcreg&0x2)
-		flush_icache(43);
-}}m68k_incpc(2);
-endlabel1858: ;
-	cpuop_end();
-}
-
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f43c_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
-{
-	cpuop_begin();
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	lazyflag_testb (src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 14) & 3);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 6) & 3);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1859; }
-{	if (srcreg&0x2)
-		flush_icache(43);
-}}m68k_incpc(2);
-endlabel1859: ;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1984: ;
+	}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f43d_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+void REGPARAM2 CPUFUNC(op_4298_0_51c8_0)(uae_u32 opcode) /* CLR.L (An)+ + DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+	{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 14) & 3);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 6) & 3);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1860; }
-{	if (srcreg&0x2)
-		flush_icache(43);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 4;
+	lazyflag_testl (0);
+	put_long(srca,0);
 }}m68k_incpc(2);
-endlabel1860: ;
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1986: ;
+	}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f43e_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
+void REGPARAM2 CPUFUNC(op_20c0_0_51c8_0)(uae_u32 opcode) /* MOVE.L Dn,(An)+ + DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+	{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 14) & 3);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 6) & 3);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1861; }
-{	if (srcreg&0x2)
-		flush_icache(43);
-}}m68k_incpc(2);
-endlabel1861: ;
-	cpuop_end();
-}
-
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f43f_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
-{
-	cpuop_begin();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	lazyflag_testl (src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 14) & 3);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 6) & 3);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1862; }
-{	if (srcreg&0x2)
-		flush_icache(43);
-}}m68k_incpc(2);
-endlabel1862: ;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1988: ;
+	}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f500_0)(uae_u32 opcode) /* MMUOP.L #<data>,Dn */
+void REGPARAM2 CPUFUNC(op_5180_0_6601_0)(uae_u32 opcode) /* SUB.L #<data>,Dn + Bcc.B #<data> */
 {
 	cpuop_begin();
+	{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = (uae_s32)(uae_s8)(((opcode >> 11) | (opcode << 5)) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 3) & 255);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_u32 extra = srcreg;
-m68k_incpc(2);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	lazyflag_subl (newv, src, dst);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 #endif
-	mmu_op(opcode,extra);
-}}	cpuop_end();
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1990: ;
+	}
+	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f600_0)(uae_u32 opcode) /* MOVE16.L (An)+,(xxx).L */
+void REGPARAM2 CPUFUNC(op_5140_0_6601_0)(uae_u32 opcode) /* SUB.W #<data>,Dn + Bcc.B #<data> */
 {
 	cpuop_begin();
+	{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-{{	uaecptr memsa = m68k_areg(regs, srcreg);
-{	uaecptr memda = get_ilong(2);
-	memsa &= ~15;
-	memda &= ~15;
-	put_long(memda, get_long(memsa));
-	put_long(memda+4, get_long(memsa+4));
-	put_long(memda+8, get_long(memsa+8));
-	put_long(memda+12, get_long(memsa+12));
-	m68k_areg(regs, srcreg) += 16;
-}}}m68k_incpc(6);
-	cpuop_end();
-}
-
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f608_0)(uae_u32 opcode) /* MOVE16.L (xxx).L,(An)+ */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr memsa = get_ilong(2);
-{	uaecptr memda = m68k_areg(regs, dstreg);
-	memsa &= ~15;
-	memda &= ~15;
-	put_long(memda, get_long(memsa));
-	put_long(memda+4, get_long(memsa+4));
-	put_long(memda+8, get_long(memsa+8));
-	put_long(memda+12, get_long(memsa+12));
-	m68k_areg(regs, dstreg) += 16;
-}}}m68k_incpc(6);
-	cpuop_end();
-}
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f610_0)(uae_u32 opcode) /* MOVE16.L (An),(xxx).L */
-{
-	cpuop_begin();
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_subw (newv, src, dst);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 #endif
-{{	uaecptr memsa = m68k_areg(regs, srcreg);
-{	uaecptr memda = get_ilong(2);
-	memsa &= ~15;
-	memda &= ~15;
-	put_long(memda, get_long(memsa));
-	put_long(memda+4, get_long(memsa+4));
-	put_long(memda+8, get_long(memsa+8));
-	put_long(memda+12, get_long(memsa+12));
-}}}m68k_incpc(6);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1992: ;
+	}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f618_0)(uae_u32 opcode) /* MOVE16.L (xxx).L,(An) */
+void REGPARAM2 CPUFUNC(op_5140_0_6c01_0)(uae_u32 opcode) /* SUB.W #<data>,Dn + Bcc.B #<data> */
 {
 	cpuop_begin();
+	{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr memsa = get_ilong(2);
-{	uaecptr memda = m68k_areg(regs, dstreg);
-	memsa &= ~15;
-	memda &= ~15;
-	put_long(memda, get_long(memsa));
-	put_long(memda+4, get_long(memsa+4));
-	put_long(memda+8, get_long(memsa+8));
-	put_long(memda+12, get_long(memsa+12));
-}}}m68k_incpc(6);
-	cpuop_end();
-}
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_f620_0)(uae_u32 opcode) /* MOVE16.L (An)+,(An)+ */
-{
-	cpuop_begin();
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	lazyflag_subw (newv, src, dst);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+	}
+	if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+		return;
+	{
+	uae_u32 opcode = GET_OPCODE;
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 #endif
-	uae_u32 dstreg = 0;
-{	uaecptr mems = m68k_areg(regs, srcreg) & ~15, memd;
-	dstreg = (get_iword(2) >> 12) & 7;
-	memd = m68k_areg(regs, dstreg) & ~15;
-	put_long(memd, get_long(mems));
-	put_long(memd+4, get_long(mems+4));
-	put_long(memd+8, get_long(mems+8));
-	put_long(memd+12, get_long(mems+12));
-	if (srcreg != dstreg)
-	m68k_areg(regs, srcreg) += 16;
-	m68k_areg(regs, dstreg) += 16;
-}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1994: ;
+	}
 	cpuop_end();
 }
-
-#endif
 #endif
 
 
@@ -39328,6 +37941,9 @@ void REGPARAM2 CPUFUNC(op_c108_1)(uae_u32 opcode) /* ABCD.B -(An),-(An) */
 #ifdef PART_8
 #endif
 
+#if defined(PART_8) && !defined(NOFLAGS)
+#endif
+
 
 #ifdef _MSC_VER
 #pragma warning(disable:4102)	/* unreferenced label */
@@ -39368,6 +37984,9 @@ void REGPARAM2 CPUFUNC(op_c108_1)(uae_u32 opcode) /* ABCD.B -(An),-(An) */
 #ifdef PART_8
 #endif
 
+#if defined(PART_8) && !defined(NOFLAGS)
+#endif
+
 
 #ifdef _MSC_VER
 #pragma warning(disable:4102)	/* unreferenced label */
@@ -39397,9 +38016,7 @@ void REGPARAM2 CPUFUNC(op_30_3)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39416,9 +38033,7 @@ void REGPARAM2 CPUFUNC(op_70_3)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39435,9 +38050,7 @@ void REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -39622,9 +38235,7 @@ void REGPARAM2 CPUFUNC(op_230_3)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39641,9 +38252,7 @@ void REGPARAM2 CPUFUNC(op_270_3)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39660,9 +38269,7 @@ void REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -39679,16 +38286,9 @@ void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) */
@@ -39703,16 +38303,9 @@ void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) */
@@ -39727,16 +38320,9 @@ void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) */
@@ -39751,16 +38337,9 @@ void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) */
@@ -39775,16 +38354,9 @@ void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) */
@@ -39799,16 +38371,9 @@ void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn) */
@@ -39951,9 +38516,7 @@ void REGPARAM2 CPUFUNC(op_a30_3)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39970,9 +38533,7 @@ void REGPARAM2 CPUFUNC(op_a70_3)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39992,9 +38553,7 @@ void REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40011,14 +38570,8 @@ void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
@@ -40030,14 +38583,8 @@ void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
@@ -40052,14 +38599,8 @@ void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
@@ -40071,14 +38612,8 @@ void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
@@ -40093,14 +38628,8 @@ void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
@@ -40112,14 +38641,8 @@ void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
@@ -40137,9 +38660,7 @@ void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40155,9 +38676,7 @@ void REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40178,9 +38697,7 @@ void REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40197,9 +38714,7 @@ void REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40221,9 +38736,7 @@ void REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40241,9 +38754,7 @@ void REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40265,9 +38776,7 @@ void REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40285,9 +38794,7 @@ void REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40308,9 +38815,7 @@ void REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40327,9 +38832,7 @@ void REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40349,9 +38852,7 @@ void REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40372,9 +38873,7 @@ void REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40396,9 +38895,7 @@ void REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40420,9 +38917,7 @@ void REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40443,9 +38938,7 @@ void REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40466,9 +38959,7 @@ void REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40484,9 +38975,7 @@ void REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40502,9 +38991,7 @@ void REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40521,9 +39008,7 @@ void REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40540,9 +39025,7 @@ void REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40557,9 +39040,7 @@ void REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn)
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -40575,9 +39056,7 @@ void REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40589,9 +39068,7 @@ void REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40607,9 +39084,7 @@ void REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40621,9 +39096,7 @@ void REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40643,9 +39116,7 @@ void REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40661,9 +39132,7 @@ void REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40726,9 +39195,7 @@ void REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40745,9 +39212,7 @@ void REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40769,9 +39234,7 @@ void REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40789,9 +39252,7 @@ void REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40813,9 +39274,7 @@ void REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40833,9 +39292,7 @@ void REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40859,9 +39316,7 @@ void REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40878,9 +39333,7 @@ void REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40900,9 +39353,7 @@ void REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40922,9 +39373,7 @@ void REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40945,9 +39394,7 @@ void REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40969,9 +39416,7 @@ void REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40993,9 +39438,7 @@ void REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41016,9 +39459,7 @@ void REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41039,9 +39480,7 @@ void REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41057,9 +39496,7 @@ void REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41075,9 +39512,7 @@ void REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41094,9 +39529,7 @@ void REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41113,9 +39546,7 @@ void REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41130,9 +39561,7 @@ void REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn)
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -41148,9 +39577,7 @@ void REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41162,9 +39589,7 @@ void REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41180,9 +39605,7 @@ void REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41194,9 +39617,7 @@ void REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41216,9 +39637,7 @@ void REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41234,9 +39653,7 @@ void REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41299,9 +39716,7 @@ void REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41318,9 +39733,7 @@ void REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41342,9 +39755,7 @@ void REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41362,9 +39773,7 @@ void REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41386,9 +39795,7 @@ void REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41406,9 +39813,7 @@ void REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41429,9 +39834,7 @@ void REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41448,9 +39851,7 @@ void REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41470,9 +39871,7 @@ void REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -41492,9 +39891,7 @@ void REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -41515,9 +39912,7 @@ void REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41539,9 +39934,7 @@ void REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41563,9 +39956,7 @@ void REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41586,9 +39977,7 @@ void REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41609,9 +39998,7 @@ void REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41627,9 +40014,7 @@ void REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41645,9 +40030,7 @@ void REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41664,9 +40047,7 @@ void REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41683,9 +40064,7 @@ void REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41700,9 +40079,7 @@ void REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn)
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -41718,9 +40095,7 @@ void REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41732,9 +40107,7 @@ void REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41750,9 +40123,7 @@ void REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41764,9 +40135,7 @@ void REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41849,12 +40218,12 @@ void REGPARAM2 CPUFUNC(op_40f0_3)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel2002; }
+{if (!regs.s) { Exception(8,0); goto endlabel2128; }
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(4);
-endlabel2002: ;
+endlabel2128: ;
 	cpuop_end();
 }
 
@@ -41876,10 +40245,10 @@ void REGPARAM2 CPUFUNC(op_4130_3)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2003; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2003; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2129; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2129; }
 }}}}m68k_incpc(4);
-endlabel2003: ;
+endlabel2129: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
@@ -41895,10 +40264,10 @@ void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2004; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2004; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2130; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2130; }
 }}}}m68k_incpc(4);
-endlabel2004: ;
+endlabel2130: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
@@ -41918,10 +40287,10 @@ void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2005; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2005; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2131; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2131; }
 }}}}m68k_incpc(4);
-endlabel2005: ;
+endlabel2131: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
@@ -41937,10 +40306,10 @@ void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2006; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2006; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2132; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2132; }
 }}}}m68k_incpc(4);
-endlabel2006: ;
+endlabel2132: ;
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -41990,9 +40359,7 @@ void REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	lazyflag_testb (0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42006,9 +40373,7 @@ void REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	lazyflag_testw (0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42025,9 +40390,7 @@ void REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	lazyflag_testl (0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42060,16 +40423,9 @@ void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (dst, src, 0);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
@@ -42083,16 +40439,9 @@ void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (dst, src, 0);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
@@ -42106,16 +40455,9 @@ void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (dst, src, 0);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_44f0_3)(uae_u32 opcode) /* MV2SR.B (d8,An,Xn) */
@@ -42159,9 +40501,7 @@ void REGPARAM2 CPUFUNC(op_4630_3)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	lazyflag_testb (dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42177,9 +40517,7 @@ void REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	lazyflag_testw (dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42195,9 +40533,7 @@ void REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	lazyflag_testl (dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42210,26 +40546,26 @@ void REGPARAM2 CPUFUNC(op_46f0_3)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel2021; }
+{if (!regs.s) { Exception(8,0); goto endlabel2147; }
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel2021: ;
+endlabel2147: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46fb_3)(uae_u32 opcode) /* MV2SR.W (d8,PC,Xn) */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel2022; }
+{if (!regs.s) { Exception(8,0); goto endlabel2148; }
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel2022: ;
+endlabel2148: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4830_3)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
@@ -42338,9 +40674,7 @@ void REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42350,9 +40684,7 @@ void REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42366,9 +40698,7 @@ void REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42378,9 +40708,7 @@ void REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42394,9 +40722,7 @@ void REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42406,9 +40732,7 @@ void REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42422,9 +40746,7 @@ void REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -42569,16 +40891,9 @@ void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #endif
@@ -42601,16 +40916,9 @@ void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
@@ -42630,16 +40938,9 @@ void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -42676,16 +40977,9 @@ void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
@@ -42705,16 +40999,9 @@ void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
@@ -42734,16 +41021,9 @@ void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -43009,17 +41289,17 @@ void REGPARAM2 CPUFUNC(op_60ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(0)) goto endlabel2065;
+	if (!cctrue(0)) goto endlabel2191;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2065;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2191;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2065: ;
+endlabel2191: ;
 	cpuop_end();
 }
 
@@ -43029,17 +41309,17 @@ void REGPARAM2 CPUFUNC(op_62ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(2)) goto endlabel2066;
+	if (!cctrue(2)) goto endlabel2192;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2066;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2192;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2066: ;
+endlabel2192: ;
 	cpuop_end();
 }
 
@@ -43049,17 +41329,17 @@ void REGPARAM2 CPUFUNC(op_63ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(3)) goto endlabel2067;
+	if (!cctrue(3)) goto endlabel2193;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2067;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2193;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2067: ;
+endlabel2193: ;
 	cpuop_end();
 }
 
@@ -43069,17 +41349,17 @@ void REGPARAM2 CPUFUNC(op_64ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(4)) goto endlabel2068;
+	if (!cctrue(4)) goto endlabel2194;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2068;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2194;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2068: ;
+endlabel2194: ;
 	cpuop_end();
 }
 
@@ -43089,17 +41369,17 @@ void REGPARAM2 CPUFUNC(op_65ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(5)) goto endlabel2069;
+	if (!cctrue(5)) goto endlabel2195;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2069;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2195;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2069: ;
+endlabel2195: ;
 	cpuop_end();
 }
 
@@ -43109,17 +41389,17 @@ void REGPARAM2 CPUFUNC(op_66ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(6)) goto endlabel2070;
+	if (!cctrue(6)) goto endlabel2196;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2070;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2196;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2070: ;
+endlabel2196: ;
 	cpuop_end();
 }
 
@@ -43129,17 +41409,17 @@ void REGPARAM2 CPUFUNC(op_67ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(7)) goto endlabel2071;
+	if (!cctrue(7)) goto endlabel2197;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2071;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2197;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2071: ;
+endlabel2197: ;
 	cpuop_end();
 }
 
@@ -43149,17 +41429,17 @@ void REGPARAM2 CPUFUNC(op_68ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(8)) goto endlabel2072;
+	if (!cctrue(8)) goto endlabel2198;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2072;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2198;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2072: ;
+endlabel2198: ;
 	cpuop_end();
 }
 
@@ -43169,17 +41449,17 @@ void REGPARAM2 CPUFUNC(op_69ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(9)) goto endlabel2073;
+	if (!cctrue(9)) goto endlabel2199;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2073;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2199;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2073: ;
+endlabel2199: ;
 	cpuop_end();
 }
 
@@ -43189,17 +41469,17 @@ void REGPARAM2 CPUFUNC(op_6aff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(10)) goto endlabel2074;
+	if (!cctrue(10)) goto endlabel2200;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2074;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2200;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2074: ;
+endlabel2200: ;
 	cpuop_end();
 }
 
@@ -43209,17 +41489,17 @@ void REGPARAM2 CPUFUNC(op_6bff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(11)) goto endlabel2075;
+	if (!cctrue(11)) goto endlabel2201;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2075;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2201;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2075: ;
+endlabel2201: ;
 	cpuop_end();
 }
 
@@ -43229,17 +41509,17 @@ void REGPARAM2 CPUFUNC(op_6cff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(12)) goto endlabel2076;
+	if (!cctrue(12)) goto endlabel2202;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2076;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2202;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2076: ;
+endlabel2202: ;
 	cpuop_end();
 }
 
@@ -43249,17 +41529,17 @@ void REGPARAM2 CPUFUNC(op_6dff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(13)) goto endlabel2077;
+	if (!cctrue(13)) goto endlabel2203;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2077;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2203;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2077: ;
+endlabel2203: ;
 	cpuop_end();
 }
 
@@ -43269,17 +41549,17 @@ void REGPARAM2 CPUFUNC(op_6eff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(14)) goto endlabel2078;
+	if (!cctrue(14)) goto endlabel2204;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2078;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2204;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2078: ;
+endlabel2204: ;
 	cpuop_end();
 }
 
@@ -43289,17 +41569,17 @@ void REGPARAM2 CPUFUNC(op_6fff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(15)) goto endlabel2079;
+	if (!cctrue(15)) goto endlabel2205;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2079;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2205;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2079: ;
+endlabel2205: ;
 	cpuop_end();
 }
 
@@ -43321,9 +41601,7 @@ void REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43341,9 +41619,7 @@ void REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43365,9 +41641,7 @@ void REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43385,9 +41659,7 @@ void REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43409,9 +41681,7 @@ void REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43429,9 +41699,7 @@ void REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43454,19 +41722,17 @@ void REGPARAM2 CPUFUNC(op_80f0_3)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2086; } else {
+	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2212; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2086: ;
+}}}}endlabel2212: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
@@ -43483,19 +41749,17 @@ void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2087; } else {
+	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2213; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2087: ;
+}}}}endlabel2213: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
@@ -43515,9 +41779,7 @@ void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43539,9 +41801,7 @@ void REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43563,9 +41823,7 @@ void REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43588,20 +41846,18 @@ void REGPARAM2 CPUFUNC(op_81f0_3)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2091; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2217; } else {
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2091: ;
+}}}}endlabel2217: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
@@ -43618,20 +41874,18 @@ void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2092; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2218; } else {
+	uae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	lazyflag_testw (newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2092: ;
+}}}}endlabel2218: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
@@ -43651,16 +41905,9 @@ void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
@@ -43676,16 +41923,9 @@ void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
@@ -43705,16 +41945,9 @@ void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
@@ -43730,16 +41963,9 @@ void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
@@ -43759,16 +41985,9 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
@@ -43784,16 +42003,9 @@ void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -43857,16 +42069,9 @@ void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
@@ -43886,16 +42091,9 @@ void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
@@ -43915,16 +42113,9 @@ void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_subl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -43988,14 +42179,8 @@ void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
@@ -44011,14 +42196,8 @@ void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpb (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #endif
@@ -44041,14 +42220,8 @@ void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
@@ -44064,14 +42237,8 @@ void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpw (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
@@ -44091,14 +42258,8 @@ void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
@@ -44114,14 +42275,8 @@ void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
@@ -44141,14 +42296,8 @@ void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
@@ -44164,14 +42313,8 @@ void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
@@ -44191,9 +42334,7 @@ void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44215,9 +42356,7 @@ void REGPARAM2 CPUFUNC(op_b170_3)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44239,9 +42378,7 @@ void REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44263,14 +42400,8 @@ void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
@@ -44286,14 +42417,8 @@ void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	lazyflag_cmpl (newv, src, dst);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
@@ -44313,9 +42438,7 @@ void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44333,9 +42456,7 @@ void REGPARAM2 CPUFUNC(op_c03b_3)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44357,9 +42478,7 @@ void REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44377,9 +42496,7 @@ void REGPARAM2 CPUFUNC(op_c07b_3)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44401,9 +42518,7 @@ void REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44421,9 +42536,7 @@ void REGPARAM2 CPUFUNC(op_c0bb_3)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44445,9 +42558,7 @@ void REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44465,9 +42576,7 @@ void REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44489,9 +42598,7 @@ void REGPARAM2 CPUFUNC(op_c130_3)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	lazyflag_testb (src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44513,9 +42620,7 @@ void REGPARAM2 CPUFUNC(op_c170_3)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	lazyflag_testw (src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44537,9 +42642,7 @@ void REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	lazyflag_testl (src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44561,9 +42664,7 @@ void REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44581,9 +42682,7 @@ void REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	lazyflag_testl (newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44605,16 +42704,9 @@ void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
@@ -44630,16 +42722,9 @@ void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
@@ -44659,16 +42744,9 @@ void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
@@ -44684,16 +42762,9 @@ void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
@@ -44713,16 +42784,9 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
@@ -44738,16 +42802,9 @@ void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -44811,16 +42868,9 @@ void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addb (newv, src, dst);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
@@ -44840,16 +42890,9 @@ void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addw (newv, src, dst);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
@@ -44869,16 +42912,9 @@ void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	lazyflag_addl (newv, src, dst);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
 #endif
@@ -44942,9 +42978,7 @@ void REGPARAM2 CPUFUNC(op_e0f0_3)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -44965,9 +42999,7 @@ void REGPARAM2 CPUFUNC(op_e1f0_3)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -44989,9 +43021,7 @@ void REGPARAM2 CPUFUNC(op_e2f0_3)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45011,9 +43041,7 @@ void REGPARAM2 CPUFUNC(op_e3f0_3)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45034,9 +43062,7 @@ void REGPARAM2 CPUFUNC(op_e4f0_3)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45057,9 +43083,7 @@ void REGPARAM2 CPUFUNC(op_e5f0_3)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45080,9 +43104,7 @@ void REGPARAM2 CPUFUNC(op_e6f0_3)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -45102,9 +43124,7 @@ void REGPARAM2 CPUFUNC(op_e7f0_3)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	lazyflag_testw (val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -45112,6 +43132,9 @@ SET_CFLG (carry >> 15);
 }
 #endif
 
+#if defined(PART_8) && !defined(NOFLAGS)
+#endif
+
 
 #ifdef _MSC_VER
 #pragma warning(disable:4102)	/* unreferenced label */
@@ -45268,7 +43291,7 @@ void REGPARAM2 CPUFUNC(op_40f9_4)(uae_u32 opcode) /* MVSR2.W (xxx).L */
 void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel2161; }
+{if (!regs.s) { Exception(8,0); goto endlabel2287; }
 {{	uaecptr sra = m68k_areg(regs, 7);
 {	uae_s16 sr = get_word(sra);
 	m68k_areg(regs, 7) += 2;
@@ -45277,7 +43300,7 @@ void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
 	m68k_areg(regs, 7) += 4;
 	regs.sr = sr; m68k_setpc_rte(pc);
 	MakeFromSR();
-}}}}}}endlabel2161: ;
+}}}}}}endlabel2287: ;
 	cpuop_end();
 }
 #endif
@@ -45294,3 +43317,6 @@ void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
 #ifdef PART_8
 #endif
 
+#if defined(PART_8) && !defined(NOFLAGS)
+#endif
+
@@ -14,6 +14,9 @@
 #ifdef NOFLAGS
 # include "noflags.h"
 #endif
+#if defined(ARDUINO) && USE_HOT_HANDLERS
+# include "cpuhot.h"
+#endif
 struct cputbl CPUFUNC(op_smalltbl_0)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -1884,6 +1887,73 @@ struct cputbl CPUFUNC(op_smalltbl_0)[] = {
 { CPUFUNC_FF(op_f618_0), 0, 63000 }, /* MOVE16.L (xxx).L,(An) */
 { CPUFUNC_FF(op_f620_0), 0, 63008 }, /* MOVE16.L (An)+,(An)+ */
 { 0, 0, 0 }};
+#ifndef NOFLAGS
+struct cpufused CPUFUNC(op_fusedtbl_0)[] = {
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a40_0_6701_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a40_0_6601_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a80_0_6701_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a80_0_6601_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a00_0_6701_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a00_0_6601_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a10_0_6701_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a10_0_6601_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a50_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a50_0_6701_0) }, /* TST.W (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a90_0_6701_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a90_0_6601_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a40_0_6b01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a40_0_6a01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a80_0_6b01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a80_0_6a01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a40_0_6700_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a40_0_6600_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a80_0_6700_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a80_0_6600_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b040_0_6701_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b040_0_6601_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b040_0_6501_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b040_0_6401_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b040_0_6201_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6301_0), CPUFUNC(op_b040_0_6301_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b040_0_6c01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b040_0_6d01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b080_0_6701_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b080_0_6601_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b080_0_6501_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b080_0_6201_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b080_0_6c01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b080_0_6d01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b000_0_6701_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b000_0_6601_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b018_0_6701_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b018_0_6601_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c40_0_6701_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c40_0_6601_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c80_0_6701_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c80_0_6601_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c00_0_6701_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c00_0_6601_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b1c8_0_6701_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b1c8_0_6601_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b1c8_0_6501_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b1c8_0_6401_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_800_0_6701_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_800_0_6601_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_810_0_6701_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_810_0_6601_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2010_0_6701_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2010_0_6601_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2028_0_6701_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2028_0_6601_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_20d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20d8_0_51c8_0) }, /* MOVE.L (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_30d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_30d8_0_51c8_0) }, /* MOVE.W (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_10d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_10d8_0_51c8_0) }, /* MOVE.B (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_4298_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_4298_0_51c8_0) }, /* CLR.L (An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_20c0_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20c0_0_51c8_0) }, /* MOVE.L Dn,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_5180_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5180_0_6601_0) }, /* SUB.L #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5140_0_6601_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_5140_0_6c01_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ 0, 0, 0 }};
+#endif
 struct cputbl CPUFUNC(op_smalltbl_1)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -3728,6 +3798,73 @@ struct cputbl CPUFUNC(op_smalltbl_1)[] = {
 { CPUFUNC_FF(op_f37a_0), 0, 62330 }, /* FRESTORE.L (d16,PC) */
 { CPUFUNC_FF(op_f37b_0), 0, 62331 }, /* FRESTORE.L (d8,PC,Xn) */
 { 0, 0, 0 }};
+#ifndef NOFLAGS
+struct cpufused CPUFUNC(op_fusedtbl_1)[] = {
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a40_0_6701_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a40_0_6601_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a80_0_6701_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a80_0_6601_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a00_0_6701_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a00_0_6601_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a10_0_6701_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a10_0_6601_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a50_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a50_0_6701_0) }, /* TST.W (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a90_0_6701_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a90_0_6601_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a40_0_6b01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a40_0_6a01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a80_0_6b01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a80_0_6a01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a40_0_6700_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a40_0_6600_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a80_0_6700_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a80_0_6600_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b040_0_6701_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b040_0_6601_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b040_0_6501_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b040_0_6401_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b040_0_6201_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6301_0), CPUFUNC(op_b040_0_6301_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b040_0_6c01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b040_0_6d01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b080_0_6701_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b080_0_6601_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b080_0_6501_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b080_0_6201_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b080_0_6c01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b080_0_6d01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b000_0_6701_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b000_0_6601_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b018_0_6701_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b018_0_6601_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c40_0_6701_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c40_0_6601_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c80_0_6701_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c80_0_6601_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c00_0_6701_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c00_0_6601_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b1c8_0_6701_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b1c8_0_6601_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b1c8_0_6501_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b1c8_0_6401_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_800_0_6701_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_800_0_6601_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_810_0_6701_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_810_0_6601_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2010_0_6701_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2010_0_6601_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2028_0_6701_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2028_0_6601_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_20d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20d8_0_51c8_0) }, /* MOVE.L (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_30d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_30d8_0_51c8_0) }, /* MOVE.W (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_10d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_10d8_0_51c8_0) }, /* MOVE.B (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_4298_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_4298_0_51c8_0) }, /* CLR.L (An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_20c0_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20c0_0_51c8_0) }, /* MOVE.L Dn,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_5180_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5180_0_6601_0) }, /* SUB.L #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5140_0_6601_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_5140_0_6c01_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ 0, 0, 0 }};
+#endif
 struct cputbl CPUFUNC(op_smalltbl_2)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -5532,6 +5669,73 @@ struct cputbl CPUFUNC(op_smalltbl_2)[] = {
 { CPUFUNC(op_eff8_0), 0, 61432 }, /* BFINS.L #<data>.W,(xxx).W */
 { CPUFUNC(op_eff9_0), 0, 61433 }, /* BFINS.L #<data>.W,(xxx).L */
 { 0, 0, 0 }};
+#ifndef NOFLAGS
+struct cpufused CPUFUNC(op_fusedtbl_2)[] = {
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a40_0_6701_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a40_0_6601_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a80_0_6701_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a80_0_6601_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a00_0_6701_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a00_0_6601_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a10_0_6701_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a10_0_6601_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a50_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a50_0_6701_0) }, /* TST.W (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a90_0_6701_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a90_0_6601_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a40_0_6b01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a40_0_6a01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a80_0_6b01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a80_0_6a01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a40_0_6700_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a40_0_6600_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a80_0_6700_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a80_0_6600_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b040_0_6701_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b040_0_6601_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b040_0_6501_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b040_0_6401_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b040_0_6201_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6301_0), CPUFUNC(op_b040_0_6301_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b040_0_6c01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b040_0_6d01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b080_0_6701_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b080_0_6601_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b080_0_6501_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b080_0_6201_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b080_0_6c01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b080_0_6d01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b000_0_6701_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b000_0_6601_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b018_0_6701_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b018_0_6601_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c40_0_6701_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c40_0_6601_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c80_0_6701_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c80_0_6601_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c00_0_6701_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c00_0_6601_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b1c8_0_6701_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b1c8_0_6601_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b1c8_0_6501_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b1c8_0_6401_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_800_0_6701_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_800_0_6601_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_810_0_6701_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_810_0_6601_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2010_0_6701_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2010_0_6601_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2028_0_6701_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2028_0_6601_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_20d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20d8_0_51c8_0) }, /* MOVE.L (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_30d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_30d8_0_51c8_0) }, /* MOVE.W (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_10d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_10d8_0_51c8_0) }, /* MOVE.B (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_4298_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_4298_0_51c8_0) }, /* CLR.L (An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_20c0_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20c0_0_51c8_0) }, /* MOVE.L Dn,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_5180_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5180_0_6601_0) }, /* SUB.L #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5140_0_6601_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_5140_0_6c01_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ 0, 0, 0 }};
+#endif
 struct cputbl CPUFUNC(op_smalltbl_3)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -7130,6 +7334,73 @@ struct cputbl CPUFUNC(op_smalltbl_3)[] = {
 { CPUFUNC(op_e7f8_0), 0, 59384 }, /* ROLW.W (xxx).W */
 { CPUFUNC(op_e7f9_0), 0, 59385 }, /* ROLW.W (xxx).L */
 { 0, 0, 0 }};
+#ifndef NOFLAGS
+struct cpufused CPUFUNC(op_fusedtbl_3)[] = {
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a40_0_6701_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a40_0_6601_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a80_0_6701_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a80_0_6601_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a00_0_6701_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a00_0_6601_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a10_0_6701_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a10_0_6601_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a50_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a50_0_6701_0) }, /* TST.W (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a90_0_6701_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a90_0_6601_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a40_0_6b01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a40_0_6a01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a80_0_6b01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a80_0_6a01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a40_0_6700_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a40_0_6600_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a80_0_6700_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a80_0_6600_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b040_0_6701_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b040_0_6601_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b040_0_6501_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b040_0_6401_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b040_0_6201_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6301_0), CPUFUNC(op_b040_0_6301_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b040_0_6c01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b040_0_6d01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b080_0_6701_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b080_0_6601_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b080_0_6501_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b080_0_6201_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b080_0_6c01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b080_0_6d01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b000_0_6701_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b000_0_6601_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b018_0_6701_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b018_0_6601_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c40_0_6701_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c40_0_6601_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c80_0_6701_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c80_0_6601_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c00_0_6701_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c00_0_6601_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b1c8_0_6701_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b1c8_0_6601_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b1c8_0_6501_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b1c8_0_6401_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_800_0_6701_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_800_0_6601_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_810_0_6701_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_810_0_6601_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2010_0_6701_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2010_0_6601_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2028_0_6701_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2028_0_6601_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_20d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20d8_0_51c8_0) }, /* MOVE.L (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_30d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_30d8_0_51c8_0) }, /* MOVE.W (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_10d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_10d8_0_51c8_0) }, /* MOVE.B (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_4298_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_4298_0_51c8_0) }, /* CLR.L (An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_20c0_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20c0_0_51c8_0) }, /* MOVE.L Dn,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_5180_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5180_0_6601_0) }, /* SUB.L #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5140_0_6601_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_5140_0_6c01_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ 0, 0, 0 }};
+#endif
 struct cputbl CPUFUNC(op_smalltbl_4)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -8718,3 +8989,70 @@ struct cputbl CPUFUNC(op_smalltbl_4)[] = {
 { CPUFUNC(op_e7f8_0), 0, 59384 }, /* ROLW.W (xxx).W */
 { CPUFUNC(op_e7f9_0), 0, 59385 }, /* ROLW.W (xxx).L */
 { 0, 0, 0 }};
+#ifndef NOFLAGS
+struct cpufused CPUFUNC(op_fusedtbl_4)[] = {
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a40_0_6701_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a40_0_6601_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a80_0_6701_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a80_0_6601_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a00_0_6701_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a00_0_6601_0) }, /* TST.B Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a10_0_6701_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a10_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a10_0_6601_0) }, /* TST.B (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a50_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a50_0_6701_0) }, /* TST.W (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_4a90_0_6701_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a90_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_4a90_0_6601_0) }, /* TST.L (An) + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a40_0_6b01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a40_0_6a01_0) }, /* TST.W Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6b01_0), CPUFUNC(op_4a80_0_6b01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6a01_0), CPUFUNC(op_4a80_0_6a01_0) }, /* TST.L Dn + Bcc.B #<data> */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a40_0_6700_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a40_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a40_0_6600_0) }, /* TST.W Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6700_0), CPUFUNC(op_4a80_0_6700_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_4a80_0), CPUFUNC_FF(op_6600_0), CPUFUNC(op_4a80_0_6600_0) }, /* TST.L Dn + Bcc.W #<data>.W */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b040_0_6701_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b040_0_6601_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b040_0_6501_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b040_0_6401_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b040_0_6201_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6301_0), CPUFUNC(op_b040_0_6301_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b040_0_6c01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b040_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b040_0_6d01_0) }, /* CMP.W Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b080_0_6701_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b080_0_6601_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b080_0_6501_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6201_0), CPUFUNC(op_b080_0_6201_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_b080_0_6c01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b080_0), CPUFUNC_FF(op_6d01_0), CPUFUNC(op_b080_0_6d01_0) }, /* CMP.L Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b000_0_6701_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b000_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b000_0_6601_0) }, /* CMP.B Dn,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b018_0_6701_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b018_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b018_0_6601_0) }, /* CMP.B (An)+,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c40_0_6701_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c40_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c40_0_6601_0) }, /* CMP.W #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c80_0_6701_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c80_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c80_0_6601_0) }, /* CMP.L #<data>.L,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_c00_0_6701_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_c00_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_c00_0_6601_0) }, /* CMP.B #<data>.B,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_b1c8_0_6701_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_b1c8_0_6601_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6501_0), CPUFUNC(op_b1c8_0_6501_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_b1c8_0), CPUFUNC_FF(op_6401_0), CPUFUNC(op_b1c8_0_6401_0) }, /* CMPA.L An,An + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_800_0_6701_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_800_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_800_0_6601_0) }, /* BTST.L #<data>.W,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_810_0_6701_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_810_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_810_0_6601_0) }, /* BTST.B #<data>.W,(An) + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2010_0_6701_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2010_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2010_0_6601_0) }, /* MOVE.L (An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6701_0), CPUFUNC(op_2028_0_6701_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_2028_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_2028_0_6601_0) }, /* MOVE.L (d16,An),Dn + Bcc.B #<data> */
+{ CPUFUNC(op_20d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20d8_0_51c8_0) }, /* MOVE.L (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_30d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_30d8_0_51c8_0) }, /* MOVE.W (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_10d8_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_10d8_0_51c8_0) }, /* MOVE.B (An)+,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_4298_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_4298_0_51c8_0) }, /* CLR.L (An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_20c0_0), CPUFUNC_FF(op_51c8_0), CPUFUNC(op_20c0_0_51c8_0) }, /* MOVE.L Dn,(An)+ + DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_5180_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5180_0_6601_0) }, /* SUB.L #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6601_0), CPUFUNC(op_5140_0_6601_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ CPUFUNC(op_5140_0), CPUFUNC_FF(op_6c01_0), CPUFUNC(op_5140_0_6c01_0) }, /* SUB.W #<data>,Dn + Bcc.B #<data> */
+{ 0, 0, 0 }};
+#endif
@@ -3734,6 +3734,69 @@ extern cpuop_func op_f618_0_nf;
 extern cpuop_func op_f618_0_ff;
 extern cpuop_func op_f620_0_nf;
 extern cpuop_func op_f620_0_ff;
+extern cpuop_func op_4a40_0_6701_0_ff;
+extern cpuop_func op_4a40_0_6601_0_ff;
+extern cpuop_func op_4a80_0_6701_0_ff;
+extern cpuop_func op_4a80_0_6601_0_ff;
+extern cpuop_func op_4a00_0_6701_0_ff;
+extern cpuop_func op_4a00_0_6601_0_ff;
+extern cpuop_func op_4a10_0_6701_0_ff;
+extern cpuop_func op_4a10_0_6601_0_ff;
+extern cpuop_func op_4a50_0_6701_0_ff;
+extern cpuop_func op_4a90_0_6701_0_ff;
+extern cpuop_func op_4a90_0_6601_0_ff;
+extern cpuop_func op_4a40_0_6b01_0_ff;
+extern cpuop_func op_4a40_0_6a01_0_ff;
+extern cpuop_func op_4a80_0_6b01_0_ff;
+extern cpuop_func op_4a80_0_6a01_0_ff;
+extern cpuop_func op_4a40_0_6700_0_ff;
+extern cpuop_func op_4a40_0_6600_0_ff;
+extern cpuop_func op_4a80_0_6700_0_ff;
+extern cpuop_func op_4a80_0_6600_0_ff;
+extern cpuop_func op_b040_0_6701_0_ff;
+extern cpuop_func op_b040_0_6601_0_ff;
+extern cpuop_func op_b040_0_6501_0_ff;
+extern cpuop_func op_b040_0_6401_0_ff;
+extern cpuop_func op_b040_0_6201_0_ff;
+extern cpuop_func op_b040_0_6301_0_ff;
+extern cpuop_func op_b040_0_6c01_0_ff;
+extern cpuop_func op_b040_0_6d01_0_ff;
+extern cpuop_func op_b080_0_6701_0_ff;
+extern cpuop_func op_b080_0_6601_0_ff;
+extern cpuop_func op_b080_0_6501_0_ff;
+extern cpuop_func op_b080_0_6201_0_ff;
+extern cpuop_func op_b080_0_6c01_0_ff;
+extern cpuop_func op_b080_0_6d01_0_ff;
+extern cpuop_func op_b000_0_6701_0_ff;
+extern cpuop_func op_b000_0_6601_0_ff;
+extern cpuop_func op_b018_0_6701_0_ff;
+extern cpuop_func op_b018_0_6601_0_ff;
+extern cpuop_func op_c40_0_6701_0_ff;
+extern cpuop_func op_c40_0_6601_0_ff;
+extern cpuop_func op_c80_0_6701_0_ff;
+extern cpuop_func op_c80_0_6601_0_ff;
+extern cpuop_func op_c00_0_6701_0_ff;
+extern cpuop_func op_c00_0_6601_0_ff;
+extern cpuop_func op_b1c8_0_6701_0_ff;
+extern cpuop_func op_b1c8_0_6601_0_ff;
+extern cpuop_func op_b1c8_0_6501_0_ff;
+extern cpuop_func op_b1c8_0_6401_0_ff;
+extern cpuop_func op_800_0_6701_0_ff;
+extern cpuop_func op_800_0_6601_0_ff;
+extern cpuop_func op_810_0_6701_0_ff;
+extern cpuop_func op_810_0_6601_0_ff;
+extern cpuop_func op_2010_0_6701_0_ff;
+extern cpuop_func op_2010_0_6601_0_ff;
+extern cpuop_func op_2028_0_6701_0_ff;
+extern cpuop_func op_2028_0_6601_0_ff;
+extern cpuop_func op_20d8_0_51c8_0_ff;
+extern cpuop_func op_30d8_0_51c8_0_ff;
+extern cpuop_func op_10d8_0_51c8_0_ff;
+extern cpuop_func op_4298_0_51c8_0_ff;
+extern cpuop_func op_20c0_0_51c8_0_ff;
+extern cpuop_func op_5180_0_6601_0_ff;
+extern cpuop_func op_5140_0_6601_0_ff;
+extern cpuop_func op_5140_0_6c01_0_ff;
 extern cpuop_func op_4800_1_nf;
 extern cpuop_func op_4800_1_ff;
 extern cpuop_func op_4810_1_nf;
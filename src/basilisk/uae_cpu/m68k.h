@@ -1019,6 +1019,12 @@ struct flag_struct {
     unsigned int n;
     unsigned int v; 
     unsigned int x;
+#if LAZY_FLAGS
+    uae_u32 lazy_op;	/* LAZYFLAG_* | operand size in bytes, 0 if c/z/n/v are valid */
+    uae_u32 lazy_src;	/* Operands and result, truncated to the operand size */
+    uae_u32 lazy_dst;
+    uae_u32 lazy_res;
+#endif
 };
 
 extern struct flag_struct regflags;
@@ -1029,6 +1035,81 @@ extern struct flag_struct regflags;
 #define VFLG (regflags.v)
 #define XFLG (regflags.x)
 
+#if LAZY_FLAGS
+
+/* Lazy condition codes. Handlers generated with gencpu --lazy-flags only
+   record the last logical/add/sub/cmp operation; C, Z, N and V are computed
+   from it when something actually reads them. X is never lazy, add and sub
+   still update it right away. Every GET/SET below materializes pending
+   flags first, so hand-written code works unchanged.  */
+
+#define LAZYFLAG_NONE		0
+#define LAZYFLAG_LOGICAL	0x10
+#define LAZYFLAG_ADD		0x20
+#define LAZYFLAG_SUB		0x30	/* also CMP */
+
+extern void m68k_eval_lazy_flags(void);
+
+static __inline__ void m68k_flush_lazy_flags(void)
+{
+    if (regflags.lazy_op != LAZYFLAG_NONE)
+	m68k_eval_lazy_flags();
+}
+
+#define SET_CFLG(x) (m68k_flush_lazy_flags(), CFLG = (x))
+#define SET_NFLG(x) (m68k_flush_lazy_flags(), NFLG = (x))
+#define SET_VFLG(x) (m68k_flush_lazy_flags(), VFLG = (x))
+#define SET_ZFLG(x) (m68k_flush_lazy_flags(), ZFLG = (x))
+#define SET_XFLG(x) (XFLG = (x))
+
+#define GET_CFLG (m68k_flush_lazy_flags(), CFLG)
+#define GET_NFLG (m68k_flush_lazy_flags(), NFLG)
+#define GET_VFLG (m68k_flush_lazy_flags(), VFLG)
+#define GET_ZFLG (m68k_flush_lazy_flags(), ZFLG)
+#define GET_XFLG XFLG
+
+#define CLEAR_CZNV do { \
+ regflags.lazy_op = LAZYFLAG_NONE; \
+ CFLG = ZFLG = NFLG = VFLG = 0; \
+} while (0)
+
+#define lazyflag_set(op, s, d, v) do { \
+ regflags.lazy_op = (op); \
+ regflags.lazy_src = (s); \
+ regflags.lazy_dst = (d); \
+ regflags.lazy_res = (v); \
+} while (0)
+
+#define lazyflag_test(op, v) do { \
+ regflags.lazy_op = (op); \
+ regflags.lazy_res = (v); \
+} while (0)
+
+#define lazyflag_add(op, v, s, d) do { \
+ lazyflag_set (op, s, d, v); \
+ SET_XFLG (regflags.lazy_res < regflags.lazy_src); \
+} while (0)
+
+#define lazyflag_sub(op, v, s, d) do { \
+ lazyflag_set (op, s, d, v); \
+ SET_XFLG (regflags.lazy_src > regflags.lazy_dst); \
+} while (0)
+
+#define lazyflag_testb(v) lazyflag_test (LAZYFLAG_LOGICAL | 1, (uae_u8)(v))
+#define lazyflag_testw(v) lazyflag_test (LAZYFLAG_LOGICAL | 2, (uae_u16)(v))
+#define lazyflag_testl(v) lazyflag_test (LAZYFLAG_LOGICAL | 4, (uae_u32)(v))
+#define lazyflag_addb(v, s, d) lazyflag_add (LAZYFLAG_ADD | 1, (uae_u8)(v), (uae_u8)(s), (uae_u8)(d))
+#define lazyflag_addw(v, s, d) lazyflag_add (LAZYFLAG_ADD | 2, (uae_u16)(v), (uae_u16)(s), (uae_u16)(d))
+#define lazyflag_addl(v, s, d) lazyflag_add (LAZYFLAG_ADD | 4, (uae_u32)(v), (uae_u32)(s), (uae_u32)(d))
+#define lazyflag_subb(v, s, d) lazyflag_sub (LAZYFLAG_SUB | 1, (uae_u8)(v), (uae_u8)(s), (uae_u8)(d))
+#define lazyflag_subw(v, s, d) lazyflag_sub (LAZYFLAG_SUB | 2, (uae_u16)(v), (uae_u16)(s), (uae_u16)(d))
+#define lazyflag_subl(v, s, d) lazyflag_sub (LAZYFLAG_SUB | 4, (uae_u32)(v), (uae_u32)(s), (uae_u32)(d))
+#define lazyflag_cmpb(v, s, d) lazyflag_set (LAZYFLAG_SUB | 1, (uae_u8)(s), (uae_u8)(d), (uae_u8)(v))
+#define lazyflag_cmpw(v, s, d) lazyflag_set (LAZYFLAG_SUB | 2, (uae_u16)(s), (uae_u16)(d), (uae_u16)(v))
+#define lazyflag_cmpl(v, s, d) lazyflag_set (LAZYFLAG_SUB | 4, (uae_u32)(s), (uae_u32)(d), (uae_u32)(v))
+
+#else
+
 #define SET_CFLG(x) (CFLG = (x))
 #define SET_NFLG(x) (NFLG = (x))
 #define SET_VFLG(x) (VFLG = (x))
@@ -1048,10 +1129,74 @@ extern struct flag_struct regflags;
  SET_VFLG (0); \
 } while (0)
 
+#endif /* LAZY_FLAGS */
+
 #define COPY_CARRY (SET_XFLG (GET_CFLG))
 
+/* Eager flag computation, as gencpu emits it without --lazy-flags  */
+#define eagerflag_test(T, v) do { \
+ CLEAR_CZNV; \
+ SET_ZFLG (((T)(v)) == 0); \
+ SET_NFLG (((T)(v)) < 0); \
+} while (0)
+
+#define eagerflag_add(T, UT, v, s, d) do { \
+ int flgs = ((T)(s)) < 0; \
+ int flgo = ((T)(d)) < 0; \
+ int flgn = ((T)(v)) < 0; \
+ SET_ZFLG (((T)(v)) == 0); \
+ SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn)); \
+ SET_CFLG (((UT)(~(d))) < ((UT)(s))); \
+ COPY_CARRY; \
+ SET_NFLG (flgn != 0); \
+} while (0)
+
+#define eagerflag_sub(T, UT, v, s, d) do { \
+ int flgs = ((T)(s)) < 0; \
+ int flgo = ((T)(d)) < 0; \
+ int flgn = ((T)(v)) < 0; \
+ SET_ZFLG (((T)(v)) == 0); \
+ SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo)); \
+ SET_CFLG (((UT)(s)) > ((UT)(d))); \
+ COPY_CARRY; \
+ SET_NFLG (flgn != 0); \
+} while (0)
+
+#define eagerflag_cmp(T, UT, v, s, d) do { \
+ int flgs = ((T)(s)) < 0; \
+ int flgo = ((T)(d)) < 0; \
+ int flgn = ((T)(v)) < 0; \
+ SET_ZFLG (((T)(v)) == 0); \
+ SET_VFLG ((flgs != flgo) && (flgn != flgo)); \
+ SET_CFLG (((UT)(s)) > ((UT)(d))); \
+ SET_NFLG (flgn != 0); \
+} while (0)
+
+#if !LAZY_FLAGS
+#define lazyflag_testb(v) eagerflag_test (uae_s8, v)
+#define lazyflag_testw(v) eagerflag_test (uae_s16, v)
+#define lazyflag_testl(v) eagerflag_test (uae_s32, v)
+#define lazyflag_addb(v, s, d) eagerflag_add (uae_s8, uae_u8, v, s, d)
+#define lazyflag_addw(v, s, d) eagerflag_add (uae_s16, uae_u16, v, s, d)
+#define lazyflag_addl(v, s, d) eagerflag_add (uae_s32, uae_u32, v, s, d)
+#define lazyflag_subb(v, s, d) eagerflag_sub (uae_s8, uae_u8, v, s, d)
+#define lazyflag_subw(v, s, d) eagerflag_sub (uae_s16, uae_u16, v, s, d)
+#define lazyflag_subl(v, s, d) eagerflag_sub (uae_s32, uae_u32, v, s, d)
+#define lazyflag_cmpb(v, s, d) eagerflag_cmp (uae_s8, uae_u8, v, s, d)
+#define lazyflag_cmpw(v, s, d) eagerflag_cmp (uae_s16, uae_u16, v, s, d)
+#define lazyflag_cmpl(v, s, d) eagerflag_cmp (uae_s32, uae_u32, v, s, d)
+#endif
+
 static __inline__ int cctrue(const int cc)
 {
+#if LAZY_FLAGS
+    if (regflags.lazy_op != LAZYFLAG_NONE) {
+	/* Z is the recorded result, no need to compute the rest */
+	if (cc == 6) return regflags.lazy_res != 0;	/* NE */
+	if (cc == 7) return regflags.lazy_res == 0;	/* EQ */
+	m68k_eval_lazy_flags();
+    }
+#endif
     switch(cc){
      case 0: return 1;                       /* T */
      case 1: return 0;                       /* F */
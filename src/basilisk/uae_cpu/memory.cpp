@@ -42,13 +42,33 @@
 
 static bool illegal_mem = false;
 
-#ifdef SAVE_MEMORY_BANKS
-// 256KB pointer array - dynamically allocated in PSRAM on ESP32
-addrbank **mem_banks = NULL;
+#if USE_SOFT_TLB
+// Bank table and software TLB in one, an entry per 64KB bank (see memory.h)
+uintptr *mem_tlb = NULL;
+addrbank *tlb_mapped_banks[TLB_IO];
+#elif defined(SAVE_MEMORY_BANKS)
+// 64KB bank ID table, dynamically allocated on ESP32
+uae_u8 *mem_banks = NULL;
+addrbank *mem_bank_descs[MAX_MEM_BANKS];
+static int mem_bank_count = 0;
 #else
 addrbank mem_banks[65536];
 #endif
 
+#if USE_LOW_MEM_MIRROR
+// Copy of the first LOW_MEM_MIRROR_SIZE bytes of Mac RAM (see memory.h)
+uae_u8 *low_mem_mirror = NULL;
+uae_u32 low_mem_read_limit = 0;
+uae_u32 low_mem_write_limit = 0;
+bool low_mem_mirror_enabled = true;
+#endif
+
+#if USE_PC_CACHE
+struct pc_xlate_cache pc_xlate[2];
+bool pc_cache_enabled = true;
+static uint32 RAMMappedSize;	// RAM mapped by ram_bank, up to ROMBaseMac
+#endif
+
 #ifdef WORDS_BIGENDIAN
 # define swap_words(X) (X)
 #else
@@ -167,6 +187,10 @@ void REGPARAM2 ram_lput(uaecptr addr, uae_u32 l)
     uae_u32 *m;
     m = (uae_u32 *)(RAMBaseDiff + addr);
     do_put_mem_long(m, l);
+    low_mem_check_write(m, do_put_mem_long, uae_u32, l);
+#if USE_BLOCK_CACHE
+    block_cache_check_write(addr - RAMBaseMac, 4);
+#endif
 }
 
 void REGPARAM2 ram_wput(uaecptr addr, uae_u32 w)
@@ -174,11 +198,20 @@ void REGPARAM2 ram_wput(uaecptr addr, uae_u32 w)
     uae_u16 *m;
     m = (uae_u16 *)(RAMBaseDiff + addr);
     do_put_mem_word(m, w);
+    low_mem_check_write(m, do_put_mem_word, uae_u16, w);
+#if USE_BLOCK_CACHE
+    block_cache_check_write(addr - RAMBaseMac, 2);
+#endif
 }
 
 void REGPARAM2 ram_bput(uaecptr addr, uae_u32 b)
 {
-	*(uae_u8 *)(RAMBaseDiff + addr) = b;
+	uae_u8 *m = (uae_u8 *)(RAMBaseDiff + addr);
+	*m = b;
+	low_mem_check_write(m, do_put_mem_byte, uae_u8, b);
+#if USE_BLOCK_CACHE
+	block_cache_check_write(addr - RAMBaseMac, 1);
+#endif
 }
 
 uae_u8 *REGPARAM2 ram_xlate(uaecptr addr)
@@ -220,6 +253,7 @@ void REGPARAM2 ram24_lput(uaecptr addr, uae_u32 l)
     uae_u32 *m;
     m = (uae_u32 *)(RAMBaseDiff + (addr & 0xffffff));
     do_put_mem_long(m, l);
+    low_mem_check_write(m, do_put_mem_long, uae_u32, l);
 }
 
 void REGPARAM2 ram24_wput(uaecptr addr, uae_u32 w)
@@ -227,11 +261,14 @@ void REGPARAM2 ram24_wput(uaecptr addr, uae_u32 w)
     uae_u16 *m;
     m = (uae_u16 *)(RAMBaseDiff + (addr & 0xffffff));
     do_put_mem_word(m, w);
+    low_mem_check_write(m, do_put_mem_word, uae_u16, w);
 }
 
 void REGPARAM2 ram24_bput(uaecptr addr, uae_u32 b)
 {
-	*(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff)) = b;
+	uae_u8 *m = (uae_u8 *)(RAMBaseDiff + (addr & 0xffffff));
+	*m = b;
+	low_mem_check_write(m, do_put_mem_byte, uae_u8, b);
 }
 
 uae_u8 *REGPARAM2 ram24_xlate(uaecptr addr)
@@ -346,6 +383,13 @@ static void REGPARAM2 frame_host_565_wput(uaecptr, uae_u32) REGPARAM;
 static uae_u32 REGPARAM2 frame_host_888_lget(uaecptr) REGPARAM;
 static void REGPARAM2 frame_host_888_lput(uaecptr, uae_u32) REGPARAM;
 
+static uae_u32 REGPARAM2 frame_be_565_lget(uaecptr) REGPARAM;
+static uae_u32 REGPARAM2 frame_be_565_wget(uaecptr) REGPARAM;
+static uae_u32 REGPARAM2 frame_be_565_bget(uaecptr) REGPARAM;
+static void REGPARAM2 frame_be_565_lput(uaecptr, uae_u32) REGPARAM;
+static void REGPARAM2 frame_be_565_wput(uaecptr, uae_u32) REGPARAM;
+static void REGPARAM2 frame_be_565_bput(uaecptr, uae_u32) REGPARAM;
+
 static uae_u8 *REGPARAM2 frame_xlate(uaecptr addr) REGPARAM;
 
 static uintptr FrameBaseDiff;	// MacFrameBaseHost - MacFrameBaseMac
@@ -373,8 +417,10 @@ void REGPARAM2 frame_direct_lput(uaecptr addr, uae_u32 l)
 {
     uae_u32 *m;
     m = (uae_u32 *)(FrameBaseDiff + addr);
+    // Mark dirty tiles for write-time tracking (offset from frame buffer
+    // base), before the store and after it (VideoDirtyTileWritten())
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 4);
     do_put_mem_long(m, l);
-    // Mark dirty tiles for write-time tracking (offset from frame buffer base)
     VideoMarkDirtyRange(addr - MacFrameBaseMac, 4);
 }
 
@@ -382,16 +428,18 @@ void REGPARAM2 frame_direct_wput(uaecptr addr, uae_u32 w)
 {
     uae_u16 *m;
     m = (uae_u16 *)(FrameBaseDiff + addr);
-    do_put_mem_word(m, w);
     // Mark dirty tiles for write-time tracking
     VideoMarkDirtyRange(addr - MacFrameBaseMac, 2);
+    do_put_mem_word(m, w);
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 2);
 }
 
 void REGPARAM2 frame_direct_bput(uaecptr addr, uae_u32 b)
 {
-    *(uae_u8 *)(FrameBaseDiff + addr) = b;
     // Mark dirty tile for write-time tracking
     VideoMarkDirtyOffset(addr - MacFrameBaseMac);
+    *(uae_u8 *)(FrameBaseDiff + addr) = b;
+    VideoMarkDirtyOffset(addr - MacFrameBaseMac);
 }
 
 uae_u32 REGPARAM2 frame_host_555_lget(uaecptr addr)
@@ -469,6 +517,72 @@ void REGPARAM2 frame_host_888_lput(uaecptr addr, uae_u32 l)
     *m = l;
 }
 
+/*
+ *  Thousands mode for a display that takes big-endian RGB 565 (M5GFX's
+ *  swap565): the Mac's 555 pixels are converted as they are stored, so the
+ *  frame buffer is already in display format. Green gets its top bit
+ *  repeated into the new low bit (white stays 0xffff); loads drop it again,
+ *  so the Mac reads back what it wrote. Byte accesses work on the whole
+ *  pixel, the frame buffer never holds a half-converted one.
+ */
+static inline uae_u32 rgb555_to_565(uae_u32 w)
+{
+    return (w & 0x001f001f) | ((w << 1) & 0xffc0ffc0) | ((w >> 4) & 0x00200020);
+}
+
+static inline uae_u32 rgb565_to_555(uae_u32 w)
+{
+    return (w & 0x001f001f) | ((w >> 1) & 0x7fe07fe0);
+}
+
+uae_u32 REGPARAM2 frame_be_565_lget(uaecptr addr)
+{
+    uae_u32 *m;
+    m = (uae_u32 *)(FrameBaseDiff + addr);
+    return rgb565_to_555(do_get_mem_long(m));
+}
+
+uae_u32 REGPARAM2 frame_be_565_wget(uaecptr addr)
+{
+    uae_u16 *m;
+    m = (uae_u16 *)(FrameBaseDiff + addr);
+    return rgb565_to_555(do_get_mem_word(m));
+}
+
+uae_u32 REGPARAM2 frame_be_565_bget(uaecptr addr)
+{
+    uae_u32 w = frame_be_565_wget(addr & ~1);
+    return (addr & 1) ? (w & 0xff) : (w >> 8);
+}
+
+void REGPARAM2 frame_be_565_lput(uaecptr addr, uae_u32 l)
+{
+    uae_u32 *m;
+    m = (uae_u32 *)(FrameBaseDiff + addr);
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 4);
+    do_put_mem_long(m, rgb555_to_565(l));
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 4);
+}
+
+void REGPARAM2 frame_be_565_wput(uaecptr addr, uae_u32 w)
+{
+    uae_u16 *m;
+    m = (uae_u16 *)(FrameBaseDiff + addr);
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 2);
+    do_put_mem_word(m, rgb555_to_565(w & 0xffff));
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 2);
+}
+
+void REGPARAM2 frame_be_565_bput(uaecptr addr, uae_u32 b)
+{
+    uae_u32 w = frame_be_565_wget(addr & ~1);
+    if (addr & 1)
+        w = (w & 0xff00) | (b & 0xff);
+    else
+        w = (w & 0x00ff) | ((b & 0xff) << 8);
+    frame_be_565_wput(addr & ~1, w);
+}
+
 uae_u8 *REGPARAM2 frame_xlate(uaecptr addr)
 {
     return (uae_u8 *)(FrameBaseDiff + addr);
@@ -490,8 +604,10 @@ void REGPARAM2 fram24_lput(uaecptr addr, uae_u32 l)
     if (0xa700 <= page_off && page_off < 0xfc80) {
 	uae_u32 *fm;
 	fm = (uae_u32 *)(MacFrameBaseHost + page_off - 0xa700);
+	// Mark dirty tiles for write-time tracking (24-bit addressing),
+	// before and after the store as above
+	VideoMarkDirtyRange(page_off - 0xa700, 4);
 	do_put_mem_long(fm, l);
-	// Mark dirty tiles for write-time tracking (24-bit addressing)
 	VideoMarkDirtyRange(page_off - 0xa700, 4);
     }
 
@@ -506,9 +622,10 @@ void REGPARAM2 fram24_wput(uaecptr addr, uae_u32 w)
     if (0xa700 <= page_off && page_off < 0xfc80) {
 	uae_u16 *fm;
 	fm = (uae_u16 *)(MacFrameBaseHost + page_off - 0xa700);
-	do_put_mem_word(fm, w);
 	// Mark dirty tiles for write-time tracking
 	VideoMarkDirtyRange(page_off - 0xa700, 2);
+	do_put_mem_word(fm, w);
+	VideoMarkDirtyRange(page_off - 0xa700, 2);
     }
 
     uae_u16 *m;
@@ -520,9 +637,10 @@ void REGPARAM2 fram24_bput(uaecptr addr, uae_u32 b)
 {
     uaecptr page_off = addr & 0xffff;
     if (0xa700 <= page_off && page_off < 0xfc80) {
-        *(uae_u8 *)(MacFrameBaseHost + page_off - 0xa700) = b;
         // Mark dirty tile for write-time tracking
         VideoMarkDirtyOffset(page_off - 0xa700);
+        *(uae_u8 *)(MacFrameBaseHost + page_off - 0xa700) = b;
+        VideoMarkDirtyOffset(page_off - 0xa700);
     }
 
     *(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff)) = b;
@@ -592,48 +710,85 @@ addrbank frame_host_888_bank = {
     frame_xlate
 };
 
+addrbank frame_be_565_bank = {
+    frame_be_565_lget, frame_be_565_wget, frame_be_565_bget,
+    frame_be_565_lput, frame_be_565_wput, frame_be_565_bput,
+    frame_xlate
+};
+
 addrbank fram24_bank = {
     ram24_lget, ram24_wget, ram24_bget,
     fram24_lput, fram24_wput, fram24_bput,
     ram24_xlate
 };
 
+static void map_bank(addrbank *bank, int bnr);
+
+/*
+ *  Map the frame buffer with the bank for MacFrameLayout (also called by
+ *  the video driver when a mode switch changes the layout)
+ */
+void map_frame_banks(void)
+{
+	if (TwentyFourBitAddressing)
+		return;
+	switch (MacFrameLayout) {
+		case FLAYOUT_DIRECT:
+			map_banks(&frame_direct_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+			break;
+		case FLAYOUT_HOST_555:
+			map_banks(&frame_host_555_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+			break;
+		case FLAYOUT_HOST_565:
+			map_banks(&frame_host_565_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+			break;
+		case FLAYOUT_HOST_888:
+			map_banks(&frame_host_888_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+			break;
+		case FLAYOUT_BE_565:
+			map_banks(&frame_be_565_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+			break;
+	}
+}
+
 void memory_init(void)
 {
-#if defined(ARDUINO) && defined(SAVE_MEMORY_BANKS)
-	// Allocate 256KB memory bank pointer array
-	// This is accessed on EVERY memory operation (multiple times per instruction)
-	// Gets PRIORITY for internal SRAM since it's the hottest path
+#if USE_SOFT_TLB
+	// 256KB of entries on ESP32, PSRAM by the SRAM budget (basilisk_glue.cpp)
+	if (mem_tlb == NULL) {
+		mem_tlb = (uintptr *)AllocCPUTable("mem_tlb", 65536 * sizeof(uintptr), TABLE_PSRAM);
+		if (mem_tlb == NULL)
+			return;
+	}
+	// Every bank is remapped below, the first RAM, ROM and frame buffer
+	// banks mapped take the slots
+	memset(tlb_mapped_banks, 0, sizeof(tlb_mapped_banks));
+#elif defined(SAVE_MEMORY_BANKS)
+	// 64KB bank ID table, read on every memory access that misses the
+	// fast paths in memory.h. The pointer array it replaced was 256KB of
+	// PSRAM, so this adds 64KB to the internal SRAM in use.
 	if (mem_banks == NULL) {
-		// Report available internal SRAM before allocation
-		size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
-		size_t largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
-		write_log("mem_banks allocation: need 256KB, internal SRAM has %d bytes free (largest: %d)\n",
-		          free_before, largest_block);
-		
-		// Try PSRAM first - cpufunctbl gets priority for internal SRAM
-		// (cpufunctbl dispatch is per-instruction, mem_banks is per-memory-access but
-		// memory functions themselves do the heavy lifting)
-		mem_banks = (addrbank **)heap_caps_malloc(65536 * sizeof(addrbank *), MALLOC_CAP_SPIRAM);
-		if (mem_banks != NULL) {
-			write_log("Allocated mem_banks (256KB) in PSRAM (cpufunctbl has SRAM priority)\n");
-		} else {
-			// Fall back to internal SRAM if PSRAM fails
-			mem_banks = (addrbank **)heap_caps_malloc(65536 * sizeof(addrbank *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-			if (mem_banks == NULL) {
-				write_log("ERROR: Failed to allocate mem_banks!\n");
-				return;
-			}
-			write_log("Allocated mem_banks (256KB) in internal SRAM (fallback)\n");
-		}
+		mem_banks = (uae_u8 *)AllocCPUTable("mem_banks", 65536, TABLE_SRAM);
+		if (mem_banks == NULL)
+			return;
 	}
 #endif
 
+#if USE_LOW_MEM_MIRROR
+	// Three spare bytes take the tail of a write that starts just below
+	// the end. Without internal SRAM for it the mirror stays off.
+	if (low_mem_mirror == NULL)
+		low_mem_mirror = (uae_u8 *)AllocCPUTable("low memory mirror", LOW_MEM_MIRROR_SIZE + 4, TABLE_SRAM_ONLY);
+#endif
+
 	for(long i=0; i<65536; i++)
-		put_mem_bank(i<<16, &dummy_bank);
+		map_bank(&dummy_bank, i);
 
 	// Limit RAM size to not overlap ROM
 	uint32 ram_size = RAMSize > ROMBaseMac ? ROMBaseMac : RAMSize;
+#if USE_PC_CACHE
+	RAMMappedSize = ram_size & ~0xffff;
+#endif
 
 	RAMBaseDiff = (uintptr)RAMBaseHost - (uintptr)RAMBaseMac;
 	ROMBaseDiff = (uintptr)ROMBaseHost - (uintptr)ROMBaseMac;
@@ -650,22 +805,108 @@ void memory_init(void)
 		map_banks(&ram_bank, RAMBaseMac >> 16, ram_size >> 16);
 		map_banks(&rom_bank, ROMBaseMac >> 16, ROMSize >> 16);
 
-                // Map frame buffer
-		switch (MacFrameLayout) {
-			case FLAYOUT_DIRECT:
-				map_banks(&frame_direct_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
-				break;
-			case FLAYOUT_HOST_555:
-				map_banks(&frame_host_555_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
-				break;
-			case FLAYOUT_HOST_565:
-				map_banks(&frame_host_565_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
-				break;
-			case FLAYOUT_HOST_888:
-				map_banks(&frame_host_888_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
-				break;
-		}
+		// Map frame buffer
+		map_frame_banks();
 	}
+
+#if USE_LOW_MEM_MIRROR
+	low_mem_mirror_enable(low_mem_mirror_enabled);
+#endif
+}
+
+#if USE_LOW_MEM_MIRROR
+/*
+ *  Turn the low memory mirror on (copying RAM into it) or off. It needs
+ *  Mac RAM at address 0 and at least LOW_MEM_MIRROR_SIZE of it.
+ */
+void low_mem_mirror_enable(bool enable)
+{
+    low_mem_mirror_enabled = enable;
+    low_mem_read_limit = low_mem_write_limit = 0;
+    if (!enable || low_mem_mirror == NULL || RAMBaseHost == NULL
+	|| RAMBaseMac != 0 || RAMSize < LOW_MEM_MIRROR_SIZE)
+	return;
+
+    memcpy(low_mem_mirror, RAMBaseHost, LOW_MEM_MIRROR_SIZE);
+    low_mem_read_limit = LOW_MEM_MIRROR_SIZE - 3;
+    low_mem_write_limit = LOW_MEM_MIRROR_SIZE;
+}
+
+/*
+ *  Refresh the mirrored part of a host write to Mac RAM (disk reads,
+ *  Host2Mac_memcpy() and friends)
+ */
+void low_mem_mirror_sync(const void *host, uae_u32 size)
+{
+    if (low_mem_write_limit == 0 || size == 0)
+	return;
+    const uae_u8 *p = (const uae_u8 *)host;
+    if (p < RAMBaseHost || p >= RAMBaseHost + LOW_MEM_MIRROR_SIZE)
+	return;
+    uae_u32 offset = p - RAMBaseHost;
+    if (size > LOW_MEM_MIRROR_SIZE - offset)
+	size = LOW_MEM_MIRROR_SIZE - offset;
+    memcpy(low_mem_mirror + offset, p, size);
+}
+#endif
+
+#if USE_SOFT_TLB
+/*
+ *  TLB entry for a bank: host address minus Mac address of the bank start,
+ *  plus the permission bits. Banks that convert or watch every access, and
+ *  a second bank wanting the bits of one already mapped, get their addrbank
+ *  pointer plus TLB_IO.
+ */
+static uintptr tlb_entry(addrbank *bank, uaecptr addr)
+{
+    uintptr flags;
+    if (bank == &ram_bank || bank == &ram24_bank)
+	flags = 0;
+    else if (bank == &rom_bank || bank == &rom24_bank)
+	flags = TLB_READONLY;
+    else if (bank == &frame_direct_bank || bank == &fram24_bank)
+	flags = TLB_DIRTY;
+    else
+	return (uintptr)bank + TLB_IO;
+
+    uintptr host = (uintptr)bank->xlateaddr(addr);
+    if (host == 0 || (host & TLB_FLAGS))
+	return (uintptr)bank + TLB_IO;
+    if (tlb_mapped_banks[flags] == NULL)
+	tlb_mapped_banks[flags] = bank;
+    else if (tlb_mapped_banks[flags] != bank)
+	return (uintptr)bank + TLB_IO;
+    return (host - addr) | flags;
+}
+#endif
+
+#if !USE_SOFT_TLB && defined(SAVE_MEMORY_BANKS)
+/*
+ *  ID of an addrbank in mem_bank_descs, added on first use. The set of
+ *  banks is fixed, so the array never fills up in practice; if it does,
+ *  the bank is left unmapped.
+ */
+uae_u8 mem_bank_id(addrbank *bank)
+{
+    for (int i = 0; i < mem_bank_count; i++)
+	if (mem_bank_descs[i] == bank)
+	    return i;
+    if (mem_bank_count == MAX_MEM_BANKS) {
+	write_log("ERROR: More than %d memory banks, mapping as dummy\n", MAX_MEM_BANKS);
+	return mem_bank_id(&dummy_bank);
+    }
+    mem_bank_descs[mem_bank_count] = bank;
+    return mem_bank_count++;
+}
+#endif
+
+static void map_bank(addrbank *bank, int bnr)
+{
+#if USE_SOFT_TLB
+    mem_tlb[bnr] = tlb_entry(bank, (uaecptr)bnr << 16);
+#else
+    put_mem_bank(bnr << 16, bank);
+#endif
 }
 
 void map_banks(addrbank *bank, int start, int size)
@@ -673,17 +914,51 @@ void map_banks(addrbank *bank, int start, int size)
     int bnr;
     unsigned long int hioffs = 0, endhioffs = 0x100;
 
+#if USE_PC_CACHE
+    pc_xlate_flush();
+#endif
     if (start >= 0x100) {
 	for (bnr = start; bnr < start + size; bnr++)
-	    put_mem_bank (bnr << 16, bank);
+	    map_bank(bank, bnr);
 	return;
     }
     if (TwentyFourBitAddressing) endhioffs = 0x10000;
     for (hioffs = 0; hioffs < endhioffs; hioffs += 0x100)
 	for (bnr = start; bnr < start+size; bnr++)
-	    put_mem_bank((bnr + hioffs) << 16, bank);
+	    map_bank(bank, bnr + hioffs);
 }
 
+#if USE_PC_CACHE
+/*
+ *  Translate a new PC outside the cached code region and make the region
+ *  around it the cached one. Unmapped addresses are not cached, so every
+ *  jump there still reaches default_xlate().
+ */
+uae_u8 *pc_xlate_refill(uaecptr addr)
+{
+    addrbank *bank = &get_mem_bank(addr);
+    if (!pc_cache_enabled || bank == &dummy_bank)
+	return bank->xlateaddr(addr);
+
+    pc_xlate_cache *c;
+    if (bank == &ram_bank) {
+	c = &pc_xlate[PC_XLATE_RAM];
+	c->base = RAMBaseMac;
+	c->size = RAMMappedSize;
+    } else if (bank == &rom_bank) {
+	c = &pc_xlate[PC_XLATE_OTHER];
+	c->base = ROMBaseMac;
+	c->size = ROMSize & ~0xffff;
+    } else {
+	c = &pc_xlate[PC_XLATE_OTHER];
+	c->base = addr & 0xffff0000;
+	c->size = 0x10000;
+    }
+    c->host = bank->xlateaddr(c->base);
+    return c->host + (addr - c->base);
+}
+#endif
+
 /*
  *  get_virtual_address - Convert host address to Mac address
  *  This is only called in virtual addressing mode
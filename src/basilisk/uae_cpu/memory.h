@@ -71,11 +71,18 @@ extern uae_u8 *REGPARAM2 default_xlate(uaecptr addr) REGPARAM;
 
 #define bankindex(addr) (((uaecptr)(addr)) >> 16)
 
-#ifdef SAVE_MEMORY_BANKS
-// Note: mem_banks is dynamically allocated in PSRAM on ESP32
-extern addrbank **mem_banks;
-#define get_mem_bank(addr) (*mem_banks[bankindex(addr)])
-#define put_mem_bank(addr, b) (mem_banks[bankindex(addr)] = (b))
+#if USE_SOFT_TLB
+/* The bank table is folded into the software TLB (see below) */
+#define get_mem_bank(addr) (*tlb_bank(get_mem_tlb(addr)))
+#elif defined(SAVE_MEMORY_BANKS)
+/* One byte per 64KB bank (64KB) indexing a small array of the distinct
+ * addrbanks; there are only about ten of them. */
+#define MAX_MEM_BANKS 32
+extern uae_u8 *mem_banks;
+extern addrbank *mem_bank_descs[MAX_MEM_BANKS];
+extern uae_u8 mem_bank_id(addrbank *bank);
+#define get_mem_bank(addr) (*mem_bank_descs[mem_banks[bankindex(addr)]])
+#define put_mem_bank(addr, b) (mem_banks[bankindex(addr)] = mem_bank_id(b))
 #else
 extern addrbank mem_banks[65536];
 #define get_mem_bank(addr) (mem_banks[bankindex(addr)])
@@ -84,6 +91,107 @@ extern addrbank mem_banks[65536];
 
 extern void memory_init(void);
 extern void map_banks(addrbank *bank, int first, int count);
+extern void map_frame_banks(void);
+
+#if USE_SOFT_TLB
+/*
+ * Software TLB, one entry per 64KB bank, filled by map_banks(). It is the
+ * bank table as well, so there is no separate mem_banks. An entry of a bank
+ * with a host mapping is the host address of the bank minus its Mac address,
+ * so host = entry + addr, with permission bits in the low two bits (host
+ * bases are at least 4-byte aligned; a bank that is not falls back to
+ * TLB_IO):
+ *
+ *   0             plain RAM, reads and writes go straight to host memory
+ *   TLB_READONLY  ROM, writes go to the bank (which ignores them)
+ *   TLB_DIRTY     frame buffer, writes go to the bank for dirty tracking
+ *   TLB_IO        no host mapping, everything goes to the bank
+ *
+ * A TLB_IO entry is the addrbank pointer itself plus TLB_IO. Each of the
+ * other three stands for one bank, tlb_mapped_banks[bits] (ram_bank or
+ * ram24_bank, and so on); a second bank with the same bits would be mapped
+ * as TLB_IO. A RAM access is one load and an add, and get_mem_bank() reads
+ * the same entry.
+ */
+#define TLB_READONLY	1
+#define TLB_DIRTY		2
+#define TLB_IO			3
+#define TLB_FLAGS		3
+
+extern uintptr *mem_tlb;
+extern addrbank *tlb_mapped_banks[TLB_IO];
+#define get_mem_tlb(addr) (mem_tlb[bankindex(addr)])
+
+static inline addrbank *tlb_bank(uintptr e) {
+    if ((e & TLB_FLAGS) == TLB_IO)
+	return (addrbank *)(e - TLB_IO);
+    return tlb_mapped_banks[e & TLB_FLAGS];
+}
+#endif
+
+#if USE_LOW_MEM_MIRROR
+#if !USE_SOFT_TLB
+#error "USE_LOW_MEM_MIRROR needs USE_SOFT_TLB (the mirror is read from its fast paths)"
+#endif
+/*
+ * Low memory mirror: a copy of the first LOW_MEM_MIRROR_SIZE bytes of Mac
+ * RAM (system globals such as Ticks, MemTop, CurrentA5 and the trap tables)
+ * in internal SRAM. RAM stays the real copy, so Mac2HostAddr() and
+ * RAMBaseHost are unaffected: fast path reads below low_mem_read_limit come
+ * from the mirror, and RAM writes below low_mem_write_limit also go to the
+ * mirror, from the fast paths and the RAM bank handlers alike
+ * (low_mem_check_write()). Both limits are 0 while the mirror is off.
+ *
+ * Host code writing Mac RAM through Mac_memset(), Host2Mac_memcpy(),
+ * Mac2Mac_memcpy() or FlushCodeCache() resyncs the mirror with
+ * low_mem_mirror_sync(). Other host writes through a pointer from
+ * Mac2HostAddr() or RAMBaseHost do not, and must call it themselves if
+ * they can reach low memory.
+ */
+#ifndef LOW_MEM_MIRROR_SIZE
+#define LOW_MEM_MIRROR_SIZE 0x2000
+#endif
+extern uae_u8 *low_mem_mirror;
+extern uae_u32 low_mem_read_limit;		// Whole access below LOW_MEM_MIRROR_SIZE
+extern uae_u32 low_mem_write_limit;		// Access starting below it
+extern bool low_mem_mirror_enabled;		// Runtime switch, applied by low_mem_mirror_enable()
+extern void low_mem_mirror_enable(bool enable);
+
+// Write-through to the low memory mirror, by RAM offset (host address
+// minus RAMBaseHost, which also covers the 24-bit RAM mirrors)
+#define low_mem_check_offset(offset, put, type, v) do { \
+        if (unlikely((offset) < low_mem_write_limit)) \
+            put((type *)(low_mem_mirror + (offset)), v); \
+    } while (0)
+#define low_mem_check_write(m, put, type, v) \
+        low_mem_check_offset((uae_u32)((uae_u8 *)(m) - RAMBaseHost), put, type, v)
+#else
+#define low_mem_check_offset(offset, put, type, v)
+#define low_mem_check_write(m, put, type, v)
+#endif
+
+#if USE_BLOCK_CACHE
+/*
+ * Block cache write check (see blockcache.h). One bit per 256-byte RAM line
+ * that holds the start of a cached instruction; a write into such a line
+ * drops the blocks recorded there. A write can straddle two lines, so both
+ * ends are checked.
+ */
+#define BLOCK_LINE_SHIFT 8
+extern uae_u8 *block_code_lines;
+extern void block_cache_invalidate_line(uae_u32 line);
+
+static inline void block_cache_check_write(uaecptr addr, int size) {
+    if (block_code_lines == NULL)
+        return;
+    uae_u32 first = addr >> BLOCK_LINE_SHIFT;
+    uae_u32 last = (addr + size - 1) >> BLOCK_LINE_SHIFT;
+    if (unlikely(block_code_lines[first >> 3] & (1 << (first & 7))))
+        block_cache_invalidate_line(first);
+    if (unlikely(last != first && (block_code_lines[last >> 3] & (1 << (last & 7)))))
+        block_cache_invalidate_line(last);
+}
+#endif
 
 #ifndef NO_INLINE_MEMORY_ACCESS
 
@@ -101,6 +209,10 @@ extern void map_banks(addrbank *bank, int first, int count);
  * - RAM: 0x00000000 to RAMSize (typically 8MB)
  * - ROM: ROMBaseMac to ROMBaseMac + ROMSize (varies by ROM type)
  * - Frame buffer: MacFrameBaseMac (0xa0000000)
+ *
+ * With USE_SOFT_TLB the range checks are replaced by one mem_tlb load per
+ * access: RAM, ROM and frame buffer reads and RAM writes take the host
+ * pointer from the table, only I/O and dirty-tracked writes call the bank.
  */
 
 // Branch prediction hints (may already be defined in sysdeps.h)
@@ -119,6 +231,95 @@ extern uint32 ROMBaseMac;
 extern uint8 *ROMBaseHost;
 extern uint32 ROMSize;
 
+#if USE_SOFT_TLB
+
+// Reads need a host mapping; read-only and dirty-tracked banks have one
+static inline uae_u8 *tlb_read_address(uaecptr addr) {
+#if USE_LOW_MEM_MIRROR
+    if (addr < low_mem_read_limit)
+        return low_mem_mirror + addr;
+#endif
+    uintptr e = get_mem_tlb(addr);
+    if (likely((e & TLB_FLAGS) != TLB_IO))
+        return (uae_u8 *)((e & ~(uintptr)TLB_FLAGS) + addr);
+    return NULL;
+}
+
+// Writes only bypass the bank for plain RAM
+static inline uae_u8 *tlb_write_address(uaecptr addr) {
+    uintptr e = get_mem_tlb(addr);
+    if (likely((e & TLB_FLAGS) == 0))
+        return (uae_u8 *)(e + addr);
+    return NULL;
+}
+
+// Store to plain RAM through the TLB, then the low memory mirror and block
+// cache checks by RAM offset: plain TLB banks are Mac RAM, so that is the
+// host offset (which also covers the 24-bit mirrors, whose Mac addresses
+// are not). It is taken before the store, which could alias RAMBaseHost.
+#if USE_BLOCK_CACHE
+#define tlb_check_write(offset, size) block_cache_check_write(offset, size)
+#else
+#define tlb_check_write(offset, size)
+#endif
+#define tlb_put_ram(m, put, type, v) do { \
+        uae_u32 offset = (uae_u8 *)(m) - RAMBaseHost; \
+        put((type *)(m), v); \
+        low_mem_check_offset(offset, put, type, v); \
+        tlb_check_write(offset, sizeof(type)); \
+        (void)offset; \
+    } while (0)
+
+static inline uae_u32 longget_fastpath(uaecptr addr) {
+    uae_u8 *m = tlb_read_address(addr);
+    if (likely(m != NULL))
+        return do_get_mem_long((uae_u32 *)m);
+    return call_mem_get_func(get_mem_bank(addr).lget, addr);
+}
+
+static inline uae_u32 wordget_fastpath(uaecptr addr) {
+    uae_u8 *m = tlb_read_address(addr);
+    if (likely(m != NULL))
+        return do_get_mem_word((uae_u16 *)m);
+    return call_mem_get_func(get_mem_bank(addr).wget, addr);
+}
+
+static inline uae_u32 byteget_fastpath(uaecptr addr) {
+    uae_u8 *m = tlb_read_address(addr);
+    if (likely(m != NULL))
+        return *m;
+    return call_mem_get_func(get_mem_bank(addr).bget, addr);
+}
+
+static inline void longput_fastpath(uaecptr addr, uae_u32 l) {
+    uae_u8 *m = tlb_write_address(addr);
+    if (likely(m != NULL)) {
+        tlb_put_ram(m, do_put_mem_long, uae_u32, l);
+        return;
+    }
+    call_mem_put_func(get_mem_bank(addr).lput, addr, l);
+}
+
+static inline void wordput_fastpath(uaecptr addr, uae_u32 w) {
+    uae_u8 *m = tlb_write_address(addr);
+    if (likely(m != NULL)) {
+        tlb_put_ram(m, do_put_mem_word, uae_u16, w);
+        return;
+    }
+    call_mem_put_func(get_mem_bank(addr).wput, addr, w);
+}
+
+static inline void byteput_fastpath(uaecptr addr, uae_u32 b) {
+    uae_u8 *m = tlb_write_address(addr);
+    if (likely(m != NULL)) {
+        tlb_put_ram(m, do_put_mem_byte, uae_u8, b);
+        return;
+    }
+    call_mem_put_func(get_mem_bank(addr).bput, addr, b);
+}
+
+#else
+
 // Fast-path long (32-bit) read
 static inline uae_u32 longget_fastpath(uaecptr addr) {
     // Fast path for RAM (most common case)
@@ -166,6 +367,9 @@ static inline void longput_fastpath(uaecptr addr, uae_u32 l) {
     if (likely(addr < RAMSize)) {
         uae_u32 *m = (uae_u32 *)(RAMBaseHost + addr);
         do_put_mem_long(m, l);
+#if USE_BLOCK_CACHE
+        block_cache_check_write(addr, 4);
+#endif
         return;
     }
     // ROM writes go to bank handler (which will log/ignore them)
@@ -178,6 +382,9 @@ static inline void wordput_fastpath(uaecptr addr, uae_u32 w) {
     if (likely(addr < RAMSize)) {
         uae_u16 *m = (uae_u16 *)(RAMBaseHost + addr);
         do_put_mem_word(m, w);
+#if USE_BLOCK_CACHE
+        block_cache_check_write(addr, 2);
+#endif
         return;
     }
     call_mem_put_func(get_mem_bank(addr).wput, addr, w);
@@ -187,11 +394,16 @@ static inline void wordput_fastpath(uaecptr addr, uae_u32 w) {
 static inline void byteput_fastpath(uaecptr addr, uae_u32 b) {
     if (likely(addr < RAMSize)) {
         *(uae_u8 *)(RAMBaseHost + addr) = b;
+#if USE_BLOCK_CACHE
+        block_cache_check_write(addr, 1);
+#endif
         return;
     }
     call_mem_put_func(get_mem_bank(addr).bput, addr, b);
 }
 
+#endif /* USE_SOFT_TLB */
+
 // Use fast-path functions for all memory access
 #define longget(addr) longget_fastpath(addr)
 #define wordget(addr) wordget_fastpath(addr)
@@ -306,9 +518,55 @@ static __inline__ uae_u8 *get_real_address(uaecptr addr)
 {
     return get_mem_bank(addr).xlateaddr(addr);
 }
+
+#if USE_PC_CACHE
+/*
+ * PC translation cache for m68k_setpc(): Mac address range and host base of
+ * the code regions the PC was last set into, one slot for RAM and one for
+ * the last other region (ROM, or a single 64KB bank). A jump, RTS or
+ * exception that lands in either is a subtraction and a compare, so calls
+ * from applications into the ROM and back do not refill; anything else
+ * refills a slot from the bank table. map_banks() and FlushCodeCache()
+ * empty it.
+ */
+struct pc_xlate_cache {
+    uaecptr base;
+    uae_u32 size;		// 0 = empty
+    uae_u8 *host;
+};
+#define PC_XLATE_RAM	0
+#define PC_XLATE_OTHER	1
+extern struct pc_xlate_cache pc_xlate[2];
+extern bool pc_cache_enabled;		// Runtime switch for host benchmarks, pc_xlate_flush() after a change
+extern uae_u8 *pc_xlate_refill(uaecptr addr);
+
+static inline uae_u8 *get_pc_real_address(uaecptr addr)
+{
+    uae_u32 offset = addr - pc_xlate[PC_XLATE_RAM].base;
+    if (likely(offset < pc_xlate[PC_XLATE_RAM].size))
+        return pc_xlate[PC_XLATE_RAM].host + offset;
+    offset = addr - pc_xlate[PC_XLATE_OTHER].base;
+    if (likely(offset < pc_xlate[PC_XLATE_OTHER].size))
+        return pc_xlate[PC_XLATE_OTHER].host + offset;
+    return pc_xlate_refill(addr);
+}
+
+static inline void pc_xlate_flush(void)
+{
+    pc_xlate[PC_XLATE_RAM].size = 0;
+    pc_xlate[PC_XLATE_OTHER].size = 0;
+}
+#endif
 /* gb-- deliberately not implemented since it shall not be used... */
 extern uae_u32 get_virtual_address(uae_u8 *addr);
 #endif /* DIRECT_ADDRESSING || REAL_ADDRESSING */
 
+// Host code wrote Mac RAM through a host pointer
+#if USE_LOW_MEM_MIRROR
+extern void low_mem_mirror_sync(const void *host, uae_u32 size);
+#else
+static inline void low_mem_mirror_sync(const void *host, uae_u32 size) {}
+#endif
+
 #endif /* MEMORY_H */
 
@@ -23,6 +23,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if OPCODE_PROFILE
+#include <map>
+#include <vector>
+#include <algorithm>
+#endif
 
 #include "sysdeps.h"
 
@@ -42,6 +47,8 @@ extern int intlev(void);	// From baisilisk_glue.cpp
 #include "memory.h"
 #include "readcpu.h"
 #include "newcpu.h"
+#include "blockcache.h"
+#include "profiler.h"
 #include "compiler/compemu.h"
 #include "fpu/fpu.h"
 
@@ -126,6 +133,12 @@ const int movem_next[256] = {
 // 256KB opcode lookup table - dynamically allocated in PSRAM on ESP32
 cpuop_func **cpufunctbl = NULL;
 
+#if USE_COMPACT_DISPATCH
+// Compact dispatch table in use (see newcpu.h)
+struct cpudispatch_tbl cpu_dispatch;
+static void *cpu_dispatch_mem = NULL;
+#endif
+
 #if FLIGHT_RECORDER
 struct rec_step {
 	uae_u32 pc;
@@ -266,6 +279,144 @@ void REGPARAM2 op_illg_1 (uae_u32 opcode)
 	op_illg (cft_map (opcode));
 }
 
+#if OPCODE_PROFILE
+uae_u32 opcode_profile[65536];
+
+// Handler table picked by build_cpufunctbl(), names the handlers in the dump
+static struct cputbl *profile_tbl = NULL;
+static int profile_tbl_index = 0;
+
+// Maps each handler to the opcode it is listed under in cpustbl.cpp
+static void profile_handler_opcodes(std::map<cpuop_func *, uae_u32> &handler_opcode)
+{
+	for (int i = 0; profile_tbl[i].handler != NULL; i++) {
+		if (handler_opcode.find(profile_tbl[i].handler) == handler_opcode.end())
+			handler_opcode[profile_tbl[i].handler] = profile_tbl[i].opcode;
+	}
+}
+
+/*
+ *  Write the executed instruction counts per handler, keyed by the opcode
+ *  the handler is listed under in cpustbl.cpp, most frequent first
+ */
+void m68k_dump_opcode_profile(FILE *f)
+{
+	std::map<cpuop_func *, uae_u32> handler_opcode;
+	profile_handler_opcodes(handler_opcode);
+
+	std::map<uae_u32, uae_u64> counts;
+	uae_u64 total = 0;
+	for (uae_u32 opcode = 0; opcode < 65536; opcode++) {
+		if (opcode_profile[opcode] == 0)
+			continue;
+		total += opcode_profile[opcode];
+		std::map<cpuop_func *, uae_u32>::iterator it = handler_opcode.find(cpufunctbl[cft_map (opcode)]);
+		if (it != handler_opcode.end())
+			counts[it->second] += opcode_profile[opcode];
+	}
+
+	std::vector<std::pair<uae_u64, uae_u32> > sorted;
+	for (std::map<uae_u32, uae_u64>::iterator it = counts.begin(); it != counts.end(); ++it)
+		sorted.push_back(std::make_pair(it->second, it->first));
+	std::sort(sorted.rbegin(), sorted.rend());
+
+	fprintf(f, "# BasiliskII opcode profile\n");
+	fprintf(f, "# table %d\n", profile_tbl_index);
+	fprintf(f, "# instructions %llu\n", (unsigned long long)total);
+	for (size_t i = 0; i < sorted.size(); i++)
+		fprintf(f, "%04x %llu\n", sorted[i].second, (unsigned long long)sorted[i].first);
+}
+
+#if USE_FUSION
+// Executed pairs of a straight-line instruction and the Bcc/DBcc after it,
+// keyed by first opcode << 16 | second opcode
+static std::map<uae_u32, uae_u64> pair_profile;
+static uae_u32 pair_prev_opcode = 0;
+static bool pair_prev_straight = false;
+
+void m68k_profile_pair(uae_u32 opcode)
+{
+	int mnemo = table68k[opcode].mnemo;
+	if (pair_prev_straight && (mnemo == i_Bcc || mnemo == i_DBcc))
+		pair_profile[(pair_prev_opcode << 16) | opcode]++;
+	pair_prev_opcode = opcode;
+	pair_prev_straight = block_flags_straight_line(opcode);
+}
+
+/*
+ *  Write the pair counts per handler pair, most frequent first, in the
+ *  format gencpu --fuse reads (tools/cpu_gen/fused_pairs.txt)
+ */
+void m68k_dump_pair_profile(FILE *f)
+{
+	std::map<cpuop_func *, uae_u32> handler_opcode;
+	profile_handler_opcodes(handler_opcode);
+
+	std::map<uae_u32, uae_u64> counts;
+	uae_u64 total = 0;
+	for (std::map<uae_u32, uae_u64>::iterator it = pair_profile.begin(); it != pair_profile.end(); ++it) {
+		std::map<cpuop_func *, uae_u32>::iterator first = handler_opcode.find(cpufunctbl[cft_map (it->first >> 16)]);
+		std::map<cpuop_func *, uae_u32>::iterator second = handler_opcode.find(cpufunctbl[cft_map (it->first & 0xffff)]);
+		total += it->second;
+		if (first != handler_opcode.end() && second != handler_opcode.end())
+			counts[(first->second << 16) | second->second] += it->second;
+	}
+
+	std::vector<std::pair<uae_u64, uae_u32> > sorted;
+	for (std::map<uae_u32, uae_u64>::iterator it = counts.begin(); it != counts.end(); ++it)
+		sorted.push_back(std::make_pair(it->second, it->first));
+	std::sort(sorted.rbegin(), sorted.rend());
+
+	fprintf(f, "# BasiliskII instruction pair profile\n");
+	fprintf(f, "# table %d\n", profile_tbl_index);
+	fprintf(f, "# pairs %llu\n", (unsigned long long)total);
+	for (size_t i = 0; i < sorted.size(); i++)
+		fprintf(f, "%04x %04x %llu\n", sorted[i].second >> 16, sorted[i].second & 0xffff,
+		        (unsigned long long)sorted[i].first);
+}
+#endif
+#endif
+
+#if USE_COMPACT_DISPATCH
+/*
+ *  Select the generated dispatch table for the CPU level and copy it to
+ *  internal SRAM, it is read for every instruction
+ */
+static void build_cpudispatch (unsigned int cpu_level)
+{
+	const struct cpudispatch_tbl *tbl = (
+				cpu_level == 4 ? &op_dispatch_0
+				: cpu_level == 3 ? &op_dispatch_1
+				: cpu_level == 2 ? &op_dispatch_2
+				: cpu_level == 1 ? &op_dispatch_3
+				: &op_dispatch_4);
+
+	size_t handlers_size = tbl->nhandlers * sizeof(cpuop_func *);
+	size_t pages_size = (tbl->npages << CPUDISPATCH_PAGE_BITS) * sizeof(uae_u16);
+	size_t index_size = (65536 >> CPUDISPATCH_PAGE_BITS) * sizeof(uae_u16);
+
+	FreeCPUTable(cpu_dispatch_mem);
+	cpu_dispatch_mem = AllocCPUTable("dispatch table", handlers_size + pages_size + index_size, TABLE_SRAM_ONLY);
+	cpu_dispatch = *tbl;
+	if (cpu_dispatch_mem != NULL) {
+		uae_u8 *p = (uae_u8 *)cpu_dispatch_mem;
+		cpu_dispatch.handlers = (cpuop_func *const *)memcpy(p, tbl->handlers, handlers_size);
+		cpu_dispatch.pages = (const uae_u16 *)memcpy(p + handlers_size, tbl->pages, pages_size);
+		cpu_dispatch.index = (const uae_u16 *)memcpy(p + handlers_size + pages_size, tbl->index, index_size);
+	} else {
+		write_log("Dispatch table stays in flash\n");
+	}
+
+	// Generated from the same tables, so this only trips on a stale cpudispatch.cpp
+	for (uae_u32 opcode = 0; opcode < 65536; opcode++) {
+		if (cpu_opcode_handler(opcode) != cpufunctbl[cft_map (opcode)]) {
+			write_log("ERROR: cpudispatch.cpp does not match cpustbl.cpp (opcode %04x)\n", opcode);
+			abort();
+		}
+	}
+}
+#endif
+
 static void build_cpufunctbl (void)
 {
 	int i;
@@ -287,6 +438,26 @@ static void build_cpufunctbl (void)
 				: cpu_level == 2 ? op_smalltbl_2_ff
 				: cpu_level == 1 ? op_smalltbl_3_ff
 				: op_smalltbl_4_ff);
+#if OPCODE_PROFILE
+	profile_tbl = tbl;
+	profile_tbl_index = 4 - cpu_level;
+#endif
+#if USE_FLAG_LIVENESS
+	block_cache_set_noflags(tbl, (
+				cpu_level == 4 ? op_smalltbl_0_nf
+				: cpu_level == 3 ? op_smalltbl_1_nf
+				: cpu_level == 2 ? op_smalltbl_2_nf
+				: cpu_level == 1 ? op_smalltbl_3_nf
+				: op_smalltbl_4_nf));
+#endif
+#if USE_FUSION
+	block_cache_set_fused(
+				cpu_level == 4 ? op_fusedtbl_0_ff
+				: cpu_level == 3 ? op_fusedtbl_1_ff
+				: cpu_level == 2 ? op_fusedtbl_2_ff
+				: cpu_level == 1 ? op_fusedtbl_3_ff
+				: op_fusedtbl_4_ff);
+#endif
 
 	for (opcode = 0; opcode < 65536; opcode++)
 		cpufunctbl[cft_map (opcode)] = op_illg_1;
@@ -311,6 +482,9 @@ static void build_cpufunctbl (void)
 		if (tbl[i].specific)
 			cpufunctbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
 	}
+#if USE_COMPACT_DISPATCH
+	build_cpudispatch (cpu_level);
+#endif
 }
 
 void init_m68k (void)
@@ -352,6 +526,9 @@ void init_m68k (void)
 	do_merges ();
 
 	build_cpufunctbl ();
+#if USE_BLOCK_CACHE
+	block_cache_init ();
+#endif
 
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
 	spcflags_lock = B2_create_mutex();
@@ -362,6 +539,13 @@ void init_m68k (void)
 void exit_m68k (void)
 {
 	fpu_exit ();
+#if USE_BLOCK_CACHE
+	block_cache_exit ();
+#endif
+#if USE_COMPACT_DISPATCH
+	FreeCPUTable (cpu_dispatch_mem);
+	cpu_dispatch_mem = NULL;
+#endif
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
 	B2_delete_mutex(spcflags_lock);
 #endif
@@ -736,6 +920,38 @@ uae_u32 get_disp_ea_000 (uae_u32 base, uae_u32 dp)
 #endif
 }
 
+#if LAZY_FLAGS
+/*
+ *  Compute C/Z/N/V from the operation recorded by a lazyflag_* handler
+ */
+void m68k_eval_lazy_flags (void)
+{
+	uae_u32 op = regflags.lazy_op;
+	uae_u32 res = regflags.lazy_res;
+	uae_u32 src = regflags.lazy_src;
+	uae_u32 dst = regflags.lazy_dst;
+	uae_u32 sign = 1 << ((op & 7) * 8 - 1);
+
+	switch (op & ~7) {
+	case LAZYFLAG_LOGICAL:
+		CFLG = 0;
+		VFLG = 0;
+		break;
+	case LAZYFLAG_ADD:
+		CFLG = res < src;
+		VFLG = ((src ^ res) & (dst ^ res) & sign) != 0;
+		break;
+	case LAZYFLAG_SUB:
+		CFLG = src > dst;
+		VFLG = ((src ^ dst) & (res ^ dst) & sign) != 0;
+		break;
+	}
+	ZFLG = res == 0;
+	NFLG = (res & sign) != 0;
+	regflags.lazy_op = LAZYFLAG_NONE;
+}
+#endif
+
 void MakeSR (void)
 {
 #if 0
@@ -1035,8 +1251,14 @@ void m68k_divl (uae_u32 opcode, uae_u32 src, uae_u16 extra, uaecptr oldpc)
 			a &= 0xffffffffu;
 			a |= (uae_s64)m68k_dreg(regs, extra & 7) << 32;
 		}
-		rem = a % (uae_s64)(uae_s32)src;
-		quot = a / (uae_s64)(uae_s32)src;
+		if ((uae_s32)src == -1) {
+			/* Dividing INT64_MIN by -1 traps on most hosts, negate instead */
+			rem = 0;
+			quot = (uae_s64)(0 - (uae_u64)a);
+		} else {
+			rem = a % (uae_s64)(uae_s32)src;
+			quot = a / (uae_s64)(uae_s32)src;
+		}
 		if ((quot & UVAL64(0xffffffff80000000)) != 0
 				&& (quot & UVAL64(0xffffffff80000000)) != UVAL64(0xffffffff80000000))
 		{
@@ -1325,6 +1547,9 @@ void REGPARAM2 op_illg (uae_u32 opcode)
 	uaecptr pc = m68k_getpc ();
 
 	if ((opcode & 0xF000) == 0xA000) {
+#if USE_PROFILER
+		profiler_trap(opcode);
+#endif
 		Exception(0xA,0);
 		return;
 	}
@@ -1407,6 +1632,11 @@ int m68k_do_specialties (void)
 		SPCFLAGS_CLEAR( SPCFLAG_JIT_EXEC_RETURN );
 #endif
 
+#if USE_BLOCK_CACHE
+	// Only needed to get out of the block that was running
+	SPCFLAGS_CLEAR( SPCFLAG_BLOCK_INVALID );
+#endif
+
 	if (SPCFLAGS_TEST( SPCFLAG_DOTRACE )) {
 		Exception (9,last_trace_ad);
 	}
@@ -1470,12 +1700,21 @@ void m68k_do_execute (void)
 		int batch_count = EXEC_BATCH_SIZE;
 		int instructions_executed = 0;
 		
+#if USE_BLOCK_CACHE
+		// Predecoded blocks (see blockcache.h); a batch ends on a block boundary
+		if (likely(block_cache_enabled))
+			instructions_executed = block_cache_execute(EXEC_BATCH_SIZE);
+		else
+#endif
 		do {
 			uae_u32 opcode = GET_OPCODE;
 #if FLIGHT_RECORDER
 			m68k_record_step(m68k_getpc());
 #endif
-			(*cpufunctbl[opcode])(opcode);
+#if OPCODE_PROFILE
+			m68k_profile_opcode(opcode);
+#endif
+			(*cpu_opcode_handler(opcode))(opcode);
 			instructions_executed++;
 			
 			// Early exit if special flags are set (interrupts, etc.)
@@ -1491,6 +1730,13 @@ void m68k_do_execute (void)
 		if (emulated_ticks <= 0) {
 			cpu_do_check_ticks();
 		}
+#if USE_PROFILER
+		// Cached blocks are sampled by block_cache_execute()
+#if USE_BLOCK_CACHE
+		if (!block_cache_enabled)
+#endif
+			profiler_tick(instructions_executed);
+#endif
 		
 		// Handle special conditions (interrupts, trace, etc.)
 		if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)) {
@@ -27,6 +27,10 @@
 #define FLIGHT_RECORDER 0
 #endif
 
+#ifndef OPCODE_PROFILE
+#define OPCODE_PROFILE 0
+#endif
+
 #include "m68k.h"
 #include "readcpu.h"
 #include "spcflags.h"
@@ -67,9 +71,58 @@ struct cputbl {
     uae_u16 opcode;
 };
 
+/* Fused handler for an instruction pair (op_fusedtbl_*, see USE_FUSION) */
+struct cpufused {
+    cpuop_func *first;
+    cpuop_func *second;
+    cpuop_func *handler;
+};
+
 // Note: cpufunctbl is dynamically allocated in PSRAM on ESP32
 extern cpuop_func **cpufunctbl;
 
+#if USE_COMPACT_DISPATCH
+/* Two-level opcode dispatch (generated/cpudispatch.cpp, written by gencpu).
+   opcode >> 6 selects a 64-entry page of 16-bit handler indices, identical
+   pages are stored once. About 40KB instead of the 256KB cpufunctbl, so it
+   fits in internal SRAM; cpufunctbl is still built and used off the hot path.  */
+#define CPUDISPATCH_PAGE_BITS 6
+
+struct cpudispatch_tbl {
+    cpuop_func *const *handlers;
+    const uae_u16 *pages;
+    const uae_u16 *index;		/* Page of each 64-opcode group */
+    uae_u32 nhandlers;
+    uae_u32 npages;
+};
+
+/* One table per CPU level, numbered like op_smalltbl_* */
+extern const struct cpudispatch_tbl op_dispatch_0;
+extern const struct cpudispatch_tbl op_dispatch_1;
+extern const struct cpudispatch_tbl op_dispatch_2;
+extern const struct cpudispatch_tbl op_dispatch_3;
+extern const struct cpudispatch_tbl op_dispatch_4;
+
+/* Table in use, normally a copy in internal SRAM */
+extern struct cpudispatch_tbl cpu_dispatch;
+
+static __inline__ uae_u32 cpu_opcode_handler_index(uae_u32 opcode)
+{
+    uae_u32 page = cpu_dispatch.index[opcode >> CPUDISPATCH_PAGE_BITS];
+    return cpu_dispatch.pages[(page << CPUDISPATCH_PAGE_BITS) | (opcode & ((1 << CPUDISPATCH_PAGE_BITS) - 1))];
+}
+
+static __inline__ cpuop_func *cpu_opcode_handler(uae_u32 opcode)
+{
+    return cpu_dispatch.handlers[cpu_opcode_handler_index(opcode)];
+}
+#else
+static __inline__ cpuop_func *cpu_opcode_handler(uae_u32 opcode)
+{
+    return cpufunctbl[opcode];
+}
+#endif
+
 #if USE_JIT
 typedef void compop_func (uae_u32) REGPARAM;
 
@@ -200,6 +253,9 @@ static __inline__ void m68k_setpc (uaecptr newpc)
 
 #if REAL_ADDRESSING || DIRECT_ADDRESSING
 	regs.pc_p = get_real_address(newpc);
+#elif USE_PC_CACHE
+	regs.pc_p = regs.pc_oldp = get_pc_real_address(newpc);
+	regs.pc = newpc;
 #else
 	regs.pc_p = regs.pc_oldp = get_real_address(newpc);
 	regs.pc = newpc;
@@ -333,9 +389,45 @@ extern struct cputbl op_smalltbl_3_ff[];
 /* 68000 slow but compatible.  */
 extern struct cputbl op_smalltbl_4_ff[];
 
+#if USE_FLAG_LIVENESS
+/* Same tables with handlers that leave the condition codes alone */
+extern struct cputbl op_smalltbl_0_nf[];
+extern struct cputbl op_smalltbl_1_nf[];
+extern struct cputbl op_smalltbl_2_nf[];
+extern struct cputbl op_smalltbl_3_nf[];
+extern struct cputbl op_smalltbl_4_nf[];
+#endif
+
+#if USE_FUSION
+/* Fused instruction pairs per CPU level (flag-setting handlers only: the
+   branch reads the flags, so the first instruction never loses them) */
+extern struct cpufused op_fusedtbl_0_ff[];
+extern struct cpufused op_fusedtbl_1_ff[];
+extern struct cpufused op_fusedtbl_2_ff[];
+extern struct cpufused op_fusedtbl_3_ff[];
+extern struct cpufused op_fusedtbl_4_ff[];
+#endif
+
 #if FLIGHT_RECORDER
 extern void m68k_record_step(uaecptr) REGPARAM;
 #endif
+#if OPCODE_PROFILE
+/* Executed opcode counts, for placing hot handlers (scripts/hot_handlers.py) */
+extern uae_u32 opcode_profile[65536];
+#if USE_FUSION
+/* Straight-line instruction + Bcc/DBcc pairs, for picking fused handlers */
+extern void m68k_profile_pair(uae_u32 opcode);
+extern void m68k_dump_pair_profile(FILE *f);
+#endif
+static __inline__ void m68k_profile_opcode(uae_u32 opcode)
+{
+	opcode_profile[opcode]++;
+#if USE_FUSION
+	m68k_profile_pair(opcode);
+#endif
+}
+extern void m68k_dump_opcode_profile(FILE *f);
+#endif
 extern void m68k_do_execute(void);
 extern void m68k_execute(void);
 #if USE_JIT
@@ -139,4 +139,31 @@ static __inline__ void SET_CFLG_ALWAYS(uae_u32 x)
 #define optflag_cmpb(s, d) do { } while (0)
 #endif
 
+/* Lazy flags (gencpu --lazy-flags) record the operation directly instead of
+   going through SET_?FLG, so drop the recording as well. The value itself is
+   computed by the handler before the lazyflag_* call. CMP is left alone for
+   the same reason as above. Without LAZY_FLAGS these map to eagerflag_*,
+   which only use the macros already redefined.  */
+#if LAZY_FLAGS
+#undef lazyflag_testb
+#undef lazyflag_testw
+#undef lazyflag_testl
+#undef lazyflag_addb
+#undef lazyflag_addw
+#undef lazyflag_addl
+#undef lazyflag_subb
+#undef lazyflag_subw
+#undef lazyflag_subl
+
+#define lazyflag_testb(v) do { } while (0)
+#define lazyflag_testw(v) do { } while (0)
+#define lazyflag_testl(v) do { } while (0)
+#define lazyflag_addb(v, s, d) do { } while (0)
+#define lazyflag_addw(v, s, d) do { } while (0)
+#define lazyflag_addl(v, s, d) do { } while (0)
+#define lazyflag_subb(v, s, d) do { } while (0)
+#define lazyflag_subw(v, s, d) do { } while (0)
+#define lazyflag_subl(v, s, d) do { } while (0)
+#endif
+
 #endif
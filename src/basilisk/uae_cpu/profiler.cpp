@@ -0,0 +1,412 @@
+/*
+ *  profiler.cpp - Sampling opcode and A-line trap profiler
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  See profiler.h. Started and dumped from the serial console on the
+ *  device (main_esp32.cpp) and with --sample-profile on the host runner.
+ */
+
+#include "sysdeps.h"
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "profiler.h"
+
+#if USE_PROFILER
+
+// A-line trap counters: OS traps (A0xx) first, then Toolbox traps (A8xx-ABxx)
+#define OS_TRAPS 256
+#define TOOLBOX_TRAPS 1024
+#define TRAP_SLOTS (OS_TRAPS + TOOLBOX_TRAPS)
+
+bool profiler_enabled = false;
+int32 profiler_countdown = 0;
+struct profiler_stats profiler_stats;
+
+static uae_u32 *handler_samples = NULL;	// Per dispatch handler
+static uae_u16 *handler_opcode = NULL;		// First opcode seen per handler
+static uae_u32 *trap_calls = NULL;
+static uae_u32 handler_count = 0;
+
+static uae_u32 rng_state = 0x6d2b79f5;
+
+/*
+ *  Trap names (Inside Macintosh), for the report. Flag bits are masked off;
+ *  traps that are not listed are shown by number.
+ */
+struct trap_name {
+	uae_u16 trap;
+	const char *name;
+};
+
+static const trap_name trap_names[] = {
+	{ 0xa000, "Open" }, { 0xa001, "Close" }, { 0xa002, "Read" }, { 0xa003, "Write" },
+	{ 0xa004, "Control" }, { 0xa005, "Status" }, { 0xa006, "KillIO" }, { 0xa007, "GetVolInfo" },
+	{ 0xa008, "Create" }, { 0xa009, "Delete" }, { 0xa00a, "OpenRF" }, { 0xa00b, "Rename" },
+	{ 0xa00c, "GetFileInfo" }, { 0xa00d, "SetFileInfo" }, { 0xa00e, "UnmountVol" }, { 0xa00f, "MountVol" },
+	{ 0xa010, "Allocate" }, { 0xa011, "GetEOF" }, { 0xa012, "SetEOF" }, { 0xa013, "FlushVol" },
+	{ 0xa014, "GetVol" }, { 0xa015, "SetVol" }, { 0xa016, "FInitQueue" }, { 0xa017, "Eject" },
+	{ 0xa018, "GetFPos" }, { 0xa019, "InitZone" }, { 0xa01a, "GetZone" }, { 0xa01b, "SetZone" },
+	{ 0xa01c, "FreeMem" }, { 0xa01d, "MaxMem" }, { 0xa01e, "NewPtr" }, { 0xa01f, "DisposePtr" },
+	{ 0xa020, "SetPtrSize" }, { 0xa021, "GetPtrSize" }, { 0xa022, "NewHandle" }, { 0xa023, "DisposeHandle" },
+	{ 0xa024, "SetHandleSize" }, { 0xa025, "GetHandleSize" }, { 0xa026, "HandleZone" }, { 0xa027, "ReallocHandle" },
+	{ 0xa028, "RecoverHandle" }, { 0xa029, "HLock" }, { 0xa02a, "HUnlock" }, { 0xa02b, "EmptyHandle" },
+	{ 0xa02c, "InitApplZone" }, { 0xa02d, "SetApplLimit" }, { 0xa02e, "BlockMove" }, { 0xa02f, "PostEvent" },
+	{ 0xa030, "OSEventAvail" }, { 0xa031, "GetOSEvent" }, { 0xa032, "FlushEvents" }, { 0xa033, "VInstall" },
+	{ 0xa034, "VRemove" }, { 0xa035, "OffLine" }, { 0xa036, "MoreMasters" }, { 0xa038, "WriteParam" },
+	{ 0xa039, "ReadDateTime" }, { 0xa03a, "SetDateTime" }, { 0xa03b, "Delay" }, { 0xa03c, "CmpString" },
+	{ 0xa03d, "DrvrInstall" }, { 0xa03e, "DrvrRemove" }, { 0xa03f, "InitUtil" }, { 0xa040, "ResrvMem" },
+	{ 0xa041, "SetFilLock" }, { 0xa042, "RstFilLock" }, { 0xa043, "SetFilType" }, { 0xa044, "SetFPos" },
+	{ 0xa045, "FlushFile" }, { 0xa046, "GetTrapAddress" }, { 0xa047, "SetTrapAddress" }, { 0xa048, "PtrZone" },
+	{ 0xa049, "HPurge" }, { 0xa04a, "HNoPurge" }, { 0xa04b, "SetGrowZone" }, { 0xa04c, "CompactMem" },
+	{ 0xa04d, "PurgeMem" }, { 0xa04e, "AddDrive" }, { 0xa04f, "RDrvrInstall" }, { 0xa050, "RelString" },
+	{ 0xa051, "ReadXPRam" }, { 0xa052, "WriteXPRam" }, { 0xa054, "UprString" }, { 0xa055, "StripAddress" },
+	{ 0xa056, "LowerText" }, { 0xa057, "SetAppBase" }, { 0xa058, "InsTime" }, { 0xa059, "RmvTime" },
+	{ 0xa05a, "PrimeTime" }, { 0xa05b, "PowerOff" }, { 0xa05c, "MemoryDispatch" }, { 0xa05d, "SwapMMUMode" },
+	{ 0xa05e, "NMInstall" }, { 0xa05f, "NMRemove" }, { 0xa060, "HFSDispatch" }, { 0xa061, "MaxBlock" },
+	{ 0xa062, "PurgeSpace" }, { 0xa063, "MaxApplZone" }, { 0xa064, "MoveHHi" }, { 0xa065, "StackSpace" },
+	{ 0xa066, "NewEmptyHandle" }, { 0xa067, "HSetRBit" }, { 0xa068, "HClrRBit" }, { 0xa069, "HGetState" },
+	{ 0xa06a, "HSetState" }, { 0xa06c, "InitFS" }, { 0xa06d, "InitEvents" }, { 0xa06e, "SlotManager" },
+	{ 0xa06f, "SlotVInstall" }, { 0xa070, "SlotVRemove" }, { 0xa071, "AttachVBL" }, { 0xa072, "DoVBLTask" },
+	{ 0xa075, "SIntInstall" }, { 0xa076, "SIntRemove" }, { 0xa077, "CountADBs" }, { 0xa078, "GetIndADB" },
+	{ 0xa079, "GetADBInfo" }, { 0xa07a, "SetADBInfo" }, { 0xa07b, "ADBReInit" }, { 0xa07c, "ADBOp" },
+	{ 0xa07d, "GetDefaultStartup" }, { 0xa07e, "SetDefaultStartup" }, { 0xa07f, "InternalWait" },
+	{ 0xa080, "GetVideoDefault" }, { 0xa081, "SetVideoDefault" }, { 0xa082, "DTInstall" },
+	{ 0xa083, "SetOSDefault" }, { 0xa084, "GetOSDefault" }, { 0xa090, "SysEnvirons" },
+	{ 0xa098, "HWPriv" }, { 0xa0ad, "Gestalt" }, { 0xa0bd, "FlushCodeCache" },
+
+	{ 0xa82a, "ComponentDispatch" },
+	{ 0xa850, "InitCursor" }, { 0xa851, "SetCursor" }, { 0xa852, "HideCursor" }, { 0xa853, "ShowCursor" },
+	{ 0xa856, "ObscureCursor" }, { 0xa860, "WaitNextEvent" }, { 0xa86e, "InitGraf" }, { 0xa86f, "OpenPort" },
+	{ 0xa873, "SetPort" }, { 0xa874, "GetPort" }, { 0xa878, "SetOrigin" }, { 0xa879, "SetClip" },
+	{ 0xa87a, "GetClip" }, { 0xa87b, "ClipRect" }, { 0xa87d, "ClosePort" }, { 0xa883, "DrawChar" },
+	{ 0xa884, "DrawString" }, { 0xa885, "DrawText" }, { 0xa886, "TextWidth" }, { 0xa887, "TextFont" },
+	{ 0xa888, "TextFace" }, { 0xa889, "TextMode" }, { 0xa88a, "TextSize" }, { 0xa88b, "GetFontInfo" },
+	{ 0xa88c, "StringWidth" }, { 0xa88d, "CharWidth" }, { 0xa88f, "OSDispatch" }, { 0xa891, "LineTo" },
+	{ 0xa892, "Line" }, { 0xa893, "MoveTo" }, { 0xa894, "Move" }, { 0xa896, "HidePen" },
+	{ 0xa897, "ShowPen" }, { 0xa898, "GetPenState" }, { 0xa899, "SetPenState" }, { 0xa89a, "GetPen" },
+	{ 0xa89b, "PenSize" }, { 0xa89c, "PenMode" }, { 0xa89d, "PenPat" }, { 0xa89e, "PenNormal" },
+	{ 0xa8a1, "FrameRect" }, { 0xa8a2, "PaintRect" }, { 0xa8a3, "EraseRect" }, { 0xa8a4, "InverRect" },
+	{ 0xa8a5, "FillRect" }, { 0xa8a6, "EqualRect" }, { 0xa8a7, "SetRect" }, { 0xa8a8, "OffsetRect" },
+	{ 0xa8a9, "InsetRect" }, { 0xa8aa, "SectRect" }, { 0xa8ab, "UnionRect" }, { 0xa8ad, "PtInRect" },
+	{ 0xa8ae, "EmptyRect" }, { 0xa8d8, "NewRgn" }, { 0xa8d9, "DisposeRgn" }, { 0xa8da, "OpenRgn" },
+	{ 0xa8db, "CloseRgn" }, { 0xa8dc, "CopyRgn" }, { 0xa8dd, "SetEmptyRgn" }, { 0xa8de, "SetRecRgn" },
+	{ 0xa8df, "RectRgn" }, { 0xa8e0, "OffsetRgn" }, { 0xa8e1, "InsetRgn" }, { 0xa8e2, "EmptyRgn" },
+	{ 0xa8e3, "EqualRgn" }, { 0xa8e4, "SectRgn" }, { 0xa8e5, "UnionRgn" }, { 0xa8e6, "DiffRgn" },
+	{ 0xa8e7, "XorRgn" }, { 0xa8e8, "PtInRgn" }, { 0xa8e9, "RectInRgn" }, { 0xa8ec, "CopyBits" },
+	{ 0xa8ef, "ScrollRect" }, { 0xa8f6, "DrawPicture" },
+	{ 0xa912, "InitWindows" }, { 0xa913, "NewWindow" }, { 0xa914, "DisposeWindow" }, { 0xa915, "ShowWindow" },
+	{ 0xa916, "HideWindow" }, { 0xa917, "GetWRefCon" }, { 0xa918, "SetWRefCon" }, { 0xa919, "GetWTitle" },
+	{ 0xa91a, "SetWTitle" }, { 0xa91b, "MoveWindow" }, { 0xa91c, "HiliteWindow" }, { 0xa91d, "SizeWindow" },
+	{ 0xa91e, "TrackGoAway" }, { 0xa91f, "SelectWindow" }, { 0xa920, "BringToFront" }, { 0xa921, "SendBehind" },
+	{ 0xa922, "BeginUpdate" }, { 0xa923, "EndUpdate" }, { 0xa924, "FrontWindow" }, { 0xa925, "DragWindow" },
+	{ 0xa927, "InvalRgn" }, { 0xa928, "InvalRect" }, { 0xa929, "ValidRgn" }, { 0xa92a, "ValidRect" },
+	{ 0xa92b, "GrowWindow" }, { 0xa92c, "FindWindow" }, { 0xa92d, "CloseWindow" },
+	{ 0xa930, "InitMenus" }, { 0xa931, "NewMenu" }, { 0xa932, "DisposeMenu" }, { 0xa933, "AppendMenu" },
+	{ 0xa934, "ClearMenuBar" }, { 0xa935, "InsertMenu" }, { 0xa936, "DeleteMenu" }, { 0xa937, "DrawMenuBar" },
+	{ 0xa938, "HiliteMenu" }, { 0xa93d, "MenuSelect" }, { 0xa93e, "MenuKey" }, { 0xa949, "GetMenuHandle" },
+	{ 0xa970, "GetNextEvent" }, { 0xa971, "EventAvail" }, { 0xa972, "GetMouse" }, { 0xa973, "StillDown" },
+	{ 0xa974, "Button" }, { 0xa975, "TickCount" }, { 0xa976, "GetKeys" }, { 0xa977, "WaitMouseUp" },
+	{ 0xa994, "CurResFile" }, { 0xa997, "OpenResFile" }, { 0xa998, "UseResFile" }, { 0xa99a, "CloseResFile" },
+	{ 0xa99b, "SetResLoad" }, { 0xa99c, "CountResources" }, { 0xa99d, "GetIndResource" }, { 0xa99e, "CountTypes" },
+	{ 0xa99f, "GetIndType" }, { 0xa9a0, "GetResource" }, { 0xa9a1, "GetNamedResource" }, { 0xa9a2, "LoadResource" },
+	{ 0xa9a3, "ReleaseResource" }, { 0xa9a4, "HomeResFile" }, { 0xa9a5, "SizeRsrc" }, { 0xa9a6, "GetResAttrs" },
+	{ 0xa9a7, "SetResAttrs" }, { 0xa9a8, "GetResInfo" }, { 0xa9a9, "SetResInfo" }, { 0xa9aa, "ChangedResource" },
+	{ 0xa9ab, "AddResource" }, { 0xa9ad, "RmveResource" }, { 0xa9af, "ResError" }, { 0xa9b0, "WriteResource" },
+	{ 0xa9b4, "SystemTask" }, { 0xa9c8, "SysBeep" }, { 0xa9c9, "SysError" },
+	{ 0xa9e1, "HandToHand" }, { 0xa9e2, "PtrToXHand" }, { 0xa9e3, "PtrToHand" }, { 0xa9e4, "HandAndHand" },
+	{ 0xa9e7, "Pack0" }, { 0xa9e8, "Pack1" }, { 0xa9e9, "Pack2" }, { 0xa9ea, "Pack3" },
+	{ 0xa9eb, "Pack4" }, { 0xa9ec, "Pack5" }, { 0xa9ed, "Pack6" }, { 0xa9ee, "Pack7" },
+	{ 0xa9f0, "LoadSeg" }, { 0xa9f1, "UnloadSeg" }, { 0xa9f2, "Launch" }, { 0xa9f3, "Chain" },
+	{ 0xa9f4, "ExitToShell" }, { 0xa9f5, "GetAppParms" }, { 0xa9ff, "Debugger" },
+	{ 0xaafe, "MixedModeDispatch" },
+};
+
+static const char *find_trap_name(uae_u16 trap)
+{
+	int lo = 0, hi = sizeof(trap_names) / sizeof(trap_names[0]) - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		if (trap_names[mid].trap == trap)
+			return trap_names[mid].name;
+		if (trap_names[mid].trap < trap)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+	return NULL;
+}
+
+// Trap word with the flag bits masked off, and its counter
+static inline uae_u16 trap_number(uae_u16 opcode)
+{
+	return (opcode & 0x0800) ? (opcode & 0xfbff) : (opcode & 0xf0ff);
+}
+
+static inline uae_u32 trap_slot(uae_u16 opcode)
+{
+	return (opcode & 0x0800) ? OS_TRAPS + (opcode & 0x3ff) : (opcode & 0xff);
+}
+
+static uae_u16 slot_trap(uae_u32 slot)
+{
+	return slot >= OS_TRAPS ? 0xa800 + (slot - OS_TRAPS) : 0xa000 + slot;
+}
+
+#if USE_COMPACT_DISPATCH
+static uae_u32 collect_handlers(void)
+{
+	return cpu_dispatch.nhandlers;
+}
+
+static inline uae_u32 handler_index(uae_u32 opcode)
+{
+	return cpu_opcode_handler_index(opcode);
+}
+#else
+// Distinct handlers of cpufunctbl sorted by address, numbered by rank
+static cpuop_func **handler_funcs = NULL;
+
+// Rank of f among the first n handlers, or where it would go
+static uae_u32 find_handler(cpuop_func *f, uae_u32 n)
+{
+	uae_u32 lo = 0, hi = n;
+	while (lo < hi) {
+		uae_u32 mid = (lo + hi) / 2;
+		if ((uintptr)handler_funcs[mid] < (uintptr)f)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static uae_u32 collect_handlers(void)
+{
+	// At most every generated function, plus op_illg_1
+	uae_u32 max = nr_cpuop_funcs + 1, n = 0;
+	handler_funcs = (cpuop_func **)AllocCPUTable("profiler handler map", max * sizeof(cpuop_func *), TABLE_PSRAM);
+	if (handler_funcs == NULL)
+		return 0;
+	for (uae_u32 opcode = 0; opcode < 65536 && n < max; opcode++) {
+		cpuop_func *f = cpufunctbl[opcode];
+		uae_u32 i = find_handler(f, n);
+		if (i < n && handler_funcs[i] == f)
+			continue;
+		memmove(handler_funcs + i + 1, handler_funcs + i, (n - i) * sizeof(cpuop_func *));
+		handler_funcs[i] = f;
+		n++;
+	}
+	return n;
+}
+
+static inline uae_u32 handler_index(uae_u32 opcode)
+{
+	uae_u32 h = find_handler(cpu_opcode_handler(opcode), handler_count);
+	return h < handler_count ? h : 0;
+}
+#endif
+
+static void next_countdown(void)
+{
+	// Uniform in [interval/2, 3*interval/2), so loops don't alias with it
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	uae_u32 interval = profiler_stats.interval;
+	profiler_countdown = interval / 2 + rng_state % (interval ? interval : 1);
+}
+
+bool profiler_start(uae_u32 interval)
+{
+	if (handler_samples == NULL) {
+		handler_count = collect_handlers();
+		// Written on every sample, so internal SRAM while the budget lasts
+		handler_samples = (uae_u32 *)AllocCPUTable("profiler handlers", handler_count * sizeof(uae_u32), TABLE_SRAM);
+		handler_opcode = (uae_u16 *)AllocCPUTable("profiler opcodes", handler_count * sizeof(uae_u16), TABLE_SRAM);
+		trap_calls = (uae_u32 *)AllocCPUTable("profiler traps", TRAP_SLOTS * sizeof(uae_u32), TABLE_SRAM);
+		if (handler_count == 0 || handler_samples == NULL || handler_opcode == NULL || trap_calls == NULL) {
+			write_log("Profiler: cannot allocate counters\n");
+			FreeCPUTable(handler_samples);
+			FreeCPUTable(handler_opcode);
+			FreeCPUTable(trap_calls);
+			handler_samples = NULL;
+			handler_opcode = NULL;
+			trap_calls = NULL;
+#if !USE_COMPACT_DISPATCH
+			FreeCPUTable(handler_funcs);
+			handler_funcs = NULL;
+#endif
+			return false;
+		}
+		profiler_reset();
+	}
+	profiler_stats.interval = interval ? interval : PROFILER_INTERVAL;
+	next_countdown();
+	profiler_enabled = true;
+	return true;
+}
+
+void profiler_stop(void)
+{
+	profiler_enabled = false;
+}
+
+void profiler_reset(void)
+{
+	uae_u32 interval = profiler_stats.interval;
+	memset(&profiler_stats, 0, sizeof(profiler_stats));
+	profiler_stats.interval = interval;
+	if (handler_samples) {
+		memset(handler_samples, 0, handler_count * sizeof(uae_u32));
+		memset(handler_opcode, 0, handler_count * sizeof(uae_u16));
+		memset(trap_calls, 0, TRAP_SLOTS * sizeof(uae_u32));
+	}
+}
+
+void profiler_sample(uae_u32 opcode)
+{
+	next_countdown();
+	profiler_stats.samples++;
+
+	uae_u32 h = handler_index(opcode);
+	if (handler_samples[h]++ == 0)
+		handler_opcode[h] = opcode;
+}
+
+void profiler_count_trap(uae_u32 opcode)
+{
+	trap_calls[trap_slot(opcode)]++;
+	profiler_stats.traps++;
+}
+
+/*
+ *  Report
+ */
+
+// Indices of the non-zero counters, most samples first
+static uae_u32 *sort_counters(const uae_u32 *counts, uae_u32 n, uae_u32 *used)
+{
+	uae_u32 *order = (uae_u32 *)malloc(n * sizeof(uae_u32));
+	uae_u32 k = 0;
+	if (order == NULL) {
+		*used = 0;
+		return NULL;
+	}
+	for (uae_u32 i = 0; i < n; i++) {
+		if (counts[i])
+			order[k++] = i;
+	}
+	// Insertion sort, only a few hundred are non-zero
+	for (uae_u32 i = 1; i < k; i++) {
+		uae_u32 v = order[i], j = i;
+		while (j > 0 && counts[order[j - 1]] < counts[v]) {
+			order[j] = order[j - 1];
+			j--;
+		}
+		order[j] = v;
+	}
+	*used = k;
+	return order;
+}
+
+static const char *mnemonic_name(int mnemo)
+{
+	for (struct mnemolookup *lookup = lookuptab; lookup->name; lookup++) {
+		if (lookup->mnemo == mnemo)
+			return lookup->name;
+	}
+	return "?";
+}
+
+static const char *amode_name(int mode)
+{
+	switch (mode) {
+	case Dreg: return "Dn";
+	case Areg: return "An";
+	case Aind: return "(An)";
+	case Aipi: return "(An)+";
+	case Apdi: return "-(An)";
+	case Ad16: return "(d16,An)";
+	case Ad8r: return "(d8,An,Xn)";
+	case absw: return "(xxx).W";
+	case absl: return "(xxx).L";
+	case PC16: return "(d16,PC)";
+	case PC8r: return "(d8,PC,Xn)";
+	case imm: case imm0: case imm1: case imm2: case immi: return "#<data>";
+	default: return "?";
+	}
+}
+
+// "MOVE.L (An)+,-(An)" for the opcode a handler was first seen with
+static void describe_opcode(uae_u16 opcode, char *buf, size_t size)
+{
+	const struct instr *dp = &table68k[opcode];
+	int n = snprintf(buf, size, "%s.%c", mnemonic_name(dp->mnemo), "BWL?"[dp->size]);
+	if (dp->suse && n < (int)size)
+		n += snprintf(buf + n, size - n, " %s", amode_name(dp->smode));
+	if (dp->duse && n < (int)size)
+		snprintf(buf + n, size - n, "%s%s", dp->suse ? "," : " ", amode_name(dp->dmode));
+}
+
+void profiler_report(profiler_print_func print, void *arg, int max_rows)
+{
+	char line[96], desc[48];
+	double total = profiler_stats.samples ? profiler_stats.samples : 1;
+
+	snprintf(line, sizeof(line), "# profile: %u samples, 1 in %u instructions, %s",
+	         profiler_stats.samples, profiler_stats.interval, profiler_enabled ? "running" : "stopped");
+	print(line, arg);
+	if (handler_samples == NULL)
+		return;
+
+	uae_u32 used;
+	uae_u32 *order = sort_counters(handler_samples, handler_count, &used);
+	print("# opcodes:  share  samples  opcode  instruction", arg);
+	for (uae_u32 i = 0; i < used && (int)i < max_rows; i++) {
+		uae_u32 h = order[i];
+		describe_opcode(handler_opcode[h], desc, sizeof(desc));
+		snprintf(line, sizeof(line), "%7.2f%% %8u  %04x  %s",
+		         100.0 * handler_samples[h] / total, handler_samples[h], handler_opcode[h], desc);
+		print(line, arg);
+	}
+	free(order);
+
+	double traps = profiler_stats.traps ? profiler_stats.traps : 1;
+	order = sort_counters(trap_calls, TRAP_SLOTS, &used);
+	snprintf(line, sizeof(line), "# traps: %u A-line traps taken", profiler_stats.traps);
+	print(line, arg);
+	print("# traps:    share    calls  trap    name", arg);
+	for (uae_u32 i = 0; i < used && (int)i < max_rows; i++) {
+		uae_u16 trap = slot_trap(order[i]);
+		const char *name = find_trap_name(trap_number(trap));
+		snprintf(line, sizeof(line), "%7.2f%% %8u  %04x  _%s",
+		         100.0 * trap_calls[order[i]] / traps, trap_calls[order[i]], trap, name ? name : "?");
+		print(line, arg);
+	}
+	free(order);
+}
+
+static void print_to_file(const char *line, void *arg)
+{
+	fprintf((FILE *)arg, "%s\n", line);
+}
+
+bool profiler_write_file(const char *path, int max_rows)
+{
+	FILE *f = fopen(path, "w");
+	if (f == NULL) {
+		write_log("Profiler: cannot write %s\n", path);
+		return false;
+	}
+	profiler_report(print_to_file, f, max_rows);
+	fclose(f);
+	return true;
+}
+
+#endif /* USE_PROFILER */
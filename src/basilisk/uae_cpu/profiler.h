@@ -0,0 +1,85 @@
+/*
+ *  profiler.h - Sampling opcode and A-line trap profiler
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Cheap enough to leave compiled in: while stopped, the batch loop pays one
+ *  predictable branch per instruction batch or cached block. While running,
+ *  a countdown of roughly N instructions (randomly jittered so loops don't
+ *  alias with the interval) is decremented per batch or block, and the
+ *  instruction at which it runs out is sampled. For a cached block that is
+ *  the exact entry, so samples are not biased towards block heads. The
+ *  plain interpreter loop samples the instruction after the batch.
+ *
+ *  Opcodes are counted per handler, so one counter per mnemonic and
+ *  addressing mode: the index in the compact dispatch table, or without
+ *  USE_COMPACT_DISPATCH the rank of the handler among the distinct entries
+ *  of cpufunctbl (a sorted list built once, searched per sample). All
+ *  counters together take about 16KB of internal RAM, allocated by the
+ *  first profiler_start().
+ *
+ *  A-line traps are not sampled: a trap is one instruction, and the
+ *  sample would almost never land on it. Instead the A-line exception
+ *  (op_illg() in newcpu.cpp) counts every trap taken while the profiler
+ *  runs, per trap number.
+ *
+ *  Reports list handlers sorted by samples, with the mnemonic and the
+ *  share of all sampled instructions, and traps sorted by calls, with the
+ *  trap name and the share of all traps.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#if USE_PROFILER
+
+// Default sampling interval in instructions
+#ifndef PROFILER_INTERVAL
+#define PROFILER_INTERVAL 1000
+#endif
+
+extern bool profiler_enabled;
+extern int32 profiler_countdown;	// Instructions to the next sample
+
+extern bool profiler_start(uae_u32 interval);	// Keeps samples taken so far
+extern void profiler_stop(void);
+extern void profiler_reset(void);
+extern void profiler_sample(uae_u32 opcode);	// Also restarts the countdown
+extern void profiler_count_trap(uae_u32 opcode);
+
+// Called once per report line (no trailing newline)
+typedef void (*profiler_print_func)(const char *line, void *arg);
+
+// At most max_rows handlers and max_rows traps
+extern void profiler_report(profiler_print_func print, void *arg, int max_rows);
+extern bool profiler_write_file(const char *path, int max_rows);
+
+// Statistics
+struct profiler_stats {
+	uae_u32 interval;
+	uae_u32 samples;		// Instructions sampled
+	uae_u32 traps;			// A-line traps taken
+};
+extern struct profiler_stats profiler_stats;
+
+/*
+ *  Called by the plain interpreter loop after each batch
+ */
+static inline void profiler_tick(int instructions)
+{
+	if (unlikely(profiler_enabled) && (profiler_countdown -= instructions) <= 0)
+		profiler_sample(GET_OPCODE);
+}
+
+/*
+ *  Called by the A-line exception path for every trap
+ */
+static inline void profiler_trap(uae_u32 opcode)
+{
+	if (unlikely(profiler_enabled))
+		profiler_count_trap(opcode);
+}
+
+#endif /* USE_PROFILER */
+
+#endif /* PROFILER_H */
@@ -39,6 +39,11 @@ enum {
 	SPCFLAG_JIT_END_COMPILE		= 0,
 	SPCFLAG_JIT_EXEC_RETURN		= 0,
 #endif
+#if USE_BLOCK_CACHE
+	SPCFLAG_BLOCK_INVALID		= 0x100,	// Cached code was invalidated, leave the current block
+#else
+	SPCFLAG_BLOCK_INVALID		= 0,
+#endif
 	
 	SPCFLAG_ALL					= SPCFLAG_STOP
 								| SPCFLAG_INT
@@ -48,6 +53,7 @@ enum {
 								| SPCFLAG_DOINT
 								| SPCFLAG_JIT_END_COMPILE
 								| SPCFLAG_JIT_EXEC_RETURN
+								| SPCFLAG_BLOCK_INVALID
 								,
 	
 	SPCFLAG_ALL_BUT_EXEC_RETURN	= SPCFLAG_ALL & ~SPCFLAG_JIT_EXEC_RETURN
@@ -0,0 +1,262 @@
+/*
+ *  video_cursor.cpp - Mouse cursor drawn as a display overlay
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Shared by the ESP32 display driver and the host build, see video_cursor.h.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "emul_op.h"
+#include "video_cursor.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if USE_HW_CURSOR
+
+// Low memory globals of the QuickDraw cursor
+const uint32 LM_MTEMP = 0x828;          // Point: mouse position from the cursor device
+const uint32 LM_RAW_MOUSE = 0x82c;      // Point: unpinned position
+const uint32 LM_MOUSE = 0x830;          // Point: pinned position
+const uint32 LM_CRSR_PIN = 0x834;       // Rect: cursor pinning rectangle
+const uint32 LM_THE_CRSR = 0x844;       // Cursor: current cursor (68 bytes)
+const uint32 LM_CRSR_VIS = 0x8cc;       // Byte: cursor visible
+const uint32 LM_CRSR_NEW = 0x8ce;       // Byte: mouse moved
+const uint32 LM_CRSR_COUPLE = 0x8cf;    // Byte: cursor follows the mouse
+const uint32 LM_CRSR_STATE = 0x8d0;     // Word: hide level, 0 = shown
+const uint32 LM_CRSR_OBSCURE = 0x8d2;   // Byte: hidden until the mouse moves
+
+// Cursor record (Cursor, and the 1-bit part of CCrsr)
+const uint32 CURSOR_DATA = 0;
+const uint32 CURSOR_MASK = 32;
+const uint32 CURSOR_HOTSPOT = 64;
+const uint32 CURSOR_RECORD_SIZE = 68;
+const uint32 CCRSR_1BIT = 20;           // crsr1Data, crsrMask, crsrHotSpot
+
+static bool installed = false;
+
+/*
+ *  State of the emulation core (the only writer)
+ */
+static int hide_depth = 0;              // -CrsrState
+static uint32 shield_bits = 0;          // Bit n: hide level n+1 came from ShieldCursor()
+static bool obscured = false;
+static int mouse_h = 0, mouse_v = 0;
+static int hot_h = 0, hot_v = 0;
+static uint16 crsr_data[CURSOR_SIZE], crsr_mask[CURSOR_SIZE];
+
+// Published for the display driver
+static video_cursor shared;
+
+/*
+ *  Shown unless a HideCursor() level is outstanding (shield levels don't
+ *  count) or the cursor is obscured
+ */
+static bool cursor_visible(void)
+{
+    if (obscured || hide_depth > 32)
+        return false;
+    uint32 levels = hide_depth == 32 ? ~0u : (1u << hide_depth) - 1;
+    return (shield_bits & levels) == levels;
+}
+
+/*
+ *  Publish the state (seqlock: odd sequence while writing)
+ */
+static void publish(void)
+{
+    WriteMacInt16(LM_CRSR_STATE, -hide_depth);
+    WriteMacInt8(LM_CRSR_VIS, cursor_visible() ? 0xff : 0);
+
+    uint32 seq = shared.seq;
+    __atomic_store_n(&shared.seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(shared.data, crsr_data, sizeof(crsr_data));
+    memcpy(shared.mask, crsr_mask, sizeof(crsr_mask));
+    shared.x = mouse_h - hot_h;
+    shared.y = mouse_v - hot_v;
+    shared.visible = cursor_visible();
+    __atomic_store_n(&shared.seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+void VideoCursorRead(video_cursor *c)
+{
+    for (;;) {
+        uint32 seq = __atomic_load_n(&shared.seq, __ATOMIC_ACQUIRE);
+        if (seq & 1)
+            continue;
+        memcpy(c, &shared, sizeof(video_cursor));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&shared.seq, __ATOMIC_RELAXED) == seq) {
+            c->seq = seq;
+            return;
+        }
+    }
+}
+
+static void read_cursor_record(uint32 addr)
+{
+    for (int i = 0; i < CURSOR_SIZE; i++) {
+        crsr_data[i] = ReadMacInt16(addr + CURSOR_DATA + i * 2);
+        crsr_mask[i] = ReadMacInt16(addr + CURSOR_MASK + i * 2);
+    }
+    hot_v = (int16)ReadMacInt16(addr + CURSOR_HOTSPOT);
+    hot_h = (int16)ReadMacInt16(addr + CURSOR_HOTSPOT + 2);
+}
+
+static void push_level(bool shield)
+{
+    if (hide_depth < 32) {
+        if (shield)
+            shield_bits |= 1u << hide_depth;
+        else
+            shield_bits &= ~(1u << hide_depth);
+    }
+    hide_depth++;
+}
+
+bool CursorInstalled(void)
+{
+    return installed;
+}
+
+void CursorInstall(void)
+{
+    // Let QuickDraw erase its cursor, then take over its hide level
+    int level = (int16)ReadMacInt16(LM_CRSR_STATE);
+    M68kRegisters r;
+    Execute68kTrap(0xa852, &r);        // HideCursor()
+
+    hide_depth = 0;
+    shield_bits = 0;
+    for (; level < 0; level++)
+        push_level(false);
+    obscured = ReadMacInt8(LM_CRSR_OBSCURE) != 0;
+    mouse_v = (int16)ReadMacInt16(LM_MOUSE);
+    mouse_h = (int16)ReadMacInt16(LM_MOUSE + 2);
+    read_cursor_record(LM_THE_CRSR);
+    installed = true;
+    publish();
+    D(bug("Cursor overlay installed, level %d\n", -hide_depth));
+}
+
+void CursorHide(void)
+{
+    push_level(false);
+    publish();
+}
+
+void CursorShow(void)
+{
+    if (hide_depth > 0)
+        hide_depth--;
+    publish();
+}
+
+// ShieldCursor(shieldRect, offsetPt): a hide level that leaves the cursor up
+void CursorShield(void)
+{
+    push_level(true);
+    publish();
+}
+
+void CursorSet(uint32 crsr)
+{
+    for (uint32 i = 0; i < CURSOR_RECORD_SIZE; i += 2)
+        WriteMacInt16(LM_THE_CRSR + i, ReadMacInt16(crsr + i));
+    read_cursor_record(crsr);
+    publish();
+}
+
+void CursorSetColor(uint32 ccrsr_handle)
+{
+    uint32 ccrsr = ReadMacInt32(ccrsr_handle);
+    if (ccrsr == 0)
+        return;
+    CursorSet(ccrsr + CCRSR_1BIT);
+}
+
+void CursorObscure(void)
+{
+    obscured = true;
+    WriteMacInt8(LM_CRSR_OBSCURE, 1);
+    publish();
+}
+
+/*
+ *  VBL task: follow the mouse (pinned to CrsrPin as QuickDraw does)
+ */
+void CursorTask(void)
+{
+    if (!ReadMacInt8(LM_CRSR_NEW))
+        return;
+    WriteMacInt8(LM_CRSR_NEW, 0);
+    if (!ReadMacInt8(LM_CRSR_COUPLE))
+        return;
+
+    int v = (int16)ReadMacInt16(LM_MTEMP);
+    int h = (int16)ReadMacInt16(LM_MTEMP + 2);
+    int top = (int16)ReadMacInt16(LM_CRSR_PIN);
+    int left = (int16)ReadMacInt16(LM_CRSR_PIN + 2);
+    int bottom = (int16)ReadMacInt16(LM_CRSR_PIN + 4);
+    int right = (int16)ReadMacInt16(LM_CRSR_PIN + 6);
+    if (v >= bottom) v = bottom - 1;
+    if (v < top) v = top;
+    if (h >= right) h = right - 1;
+    if (h < left) h = left;
+
+    WriteMacInt16(LM_MTEMP, v);
+    WriteMacInt16(LM_MTEMP + 2, h);
+    WriteMacInt16(LM_RAW_MOUSE, v);
+    WriteMacInt16(LM_RAW_MOUSE + 2, h);
+    WriteMacInt16(LM_MOUSE, v);
+    WriteMacInt16(LM_MOUSE + 2, h);
+
+    if (v == mouse_v && h == mouse_h)
+        return;
+    mouse_v = v;
+    mouse_h = h;
+    if (obscured) {
+        obscured = false;
+        WriteMacInt8(LM_CRSR_OBSCURE, 0);
+    }
+    publish();
+}
+
+/*
+ *  Mask and data give black (1/1), white (1/0), inverted screen (0/1) or
+ *  transparent (0/0), as QuickDraw draws a cursor
+ */
+void VideoCursorComposite(const video_cursor *c, int scale, uint16 *buf, int stride,
+                          int buf_x, int buf_y, int width, int height)
+{
+    if (!c->visible)
+        return;
+
+    // Cursor rectangle in display pixels, clipped to the buffer
+    int shift = scale == 2 ? 1 : 0;
+    int size = CURSOR_SIZE << shift;
+    int cx = c->x << shift, cy = c->y << shift;
+    int x0 = cx > buf_x ? cx : buf_x;
+    int y0 = cy > buf_y ? cy : buf_y;
+    int x1 = cx + size < buf_x + width ? cx + size : buf_x + width;
+    int y1 = cy + size < buf_y + height ? cy + size : buf_y + height;
+
+    for (int y = y0; y < y1; y++) {
+        int row = (y - cy) >> shift;
+        uint16 data = c->data[row], mask = c->mask[row];
+        uint16 *out = buf + (y - buf_y) * stride - buf_x;
+        for (int x = x0; x < x1; x++) {
+            uint16 bit = 0x8000 >> ((x - cx) >> shift);
+            if (mask & bit)
+                out[x] = (data & bit) ? 0x0000 : 0xffff;    // Black, white
+            else if (data & bit)
+                out[x] = ~out[x];
+        }
+    }
+}
+
+#endif
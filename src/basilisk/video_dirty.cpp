@@ -0,0 +1,507 @@
+/*
+ *  video_dirty.cpp - Write-time dirty tile tracking for the frame buffer
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Shared by the ESP32 display driver and the host build, see video_dirty.h.
+ */
+
+#include "sysdeps.h"
+#include "video.h"
+#include "video_dirty.h"
+#include "video_render.h"
+#include "video_unpack.h"
+
+#ifdef ARDUINO
+#include "esp_attr.h"
+#endif
+
+// Tiles dirtied by CPU writes since the last VideoDirtyCollect()
+DRAM_ATTR static uint32 write_dirty_tiles[TILE_WORDS];
+
+#if USE_DIRTY_PAGES
+// Frame buffer pages written since the last VideoDirtyCollect(), mapped to
+// tiles there
+DRAM_ATTR static uint32 write_dirty_pages[DIRTY_PAGE_WORDS];
+static uint32 dirty_page_shift = 5;
+static uint32 dirty_page_words = DIRTY_PAGE_WORDS;    // Covering the visible frame
+#ifndef ARDUINO
+bool dirty_pages_enabled = true;
+#endif
+#endif
+
+/*
+ *  Per-mode lookup tables, in internal SRAM since every frame buffer store
+ *  reads them
+ *
+ *  Frame buffer row:  y = (offset * dirty_row_recip) >> dirty_row_shift
+ *  First tile of row: dirty_row_tile[y]
+ *  Tile column:       dirty_col_tile[offset - y * bytes_per_row]
+ *                     (DIRTY_NO_COLUMN right of the screen)
+ */
+#define DIRTY_NO_COLUMN 0xff
+
+DRAM_ATTR static uint16 dirty_row_tile[DIRTY_MAX_HEIGHT];
+DRAM_ATTR static uint8 dirty_col_tile[DIRTY_MAX_BYTES_PER_ROW];
+static uint32 dirty_row_recip = 1;
+static uint32 dirty_row_shift = 32;
+static uint32 dirty_bytes_per_row = 1;
+static uint32 dirty_height = 0;
+static uint32 dirty_frame_size = 0;
+static uint32 dirty_tile_bytes = 1;     // Bytes per row of a tile
+static uint32 dirty_tile_height = 1;    // Rows per tile
+
+/*
+ *  Row of a byte offset without a division. With 2^k < bpr,
+ *  recip = floor(2^(32+k) / bpr) + 1 still fits 32 bits, and the rounding
+ *  error stays below one row for every offset < 2^(32+k) / bpr >= 2^31.
+ */
+static inline uint32 dirtyRow(uint32 offset)
+{
+    return (uint32)(((uint64)offset * dirty_row_recip) >> dirty_row_shift);
+}
+
+/*
+ *  Every mark is followed by a release fence: the frame buffer bank marks
+ *  before its store as well as after it, and the video task must not see
+ *  the store without the mark (VideoDirtyTileWritten()).
+ */
+static inline void markBit(uint32 *bitmap, uint32 n)
+{
+    uint32 *word = &bitmap[n >> 5];
+    uint32 bit = 1u << (n & 31);
+    // Repeated stores to one tile or page (fills, scrolling) skip the atomic
+    if (!(__atomic_load_n(word, __ATOMIC_RELAXED) & bit))
+        __atomic_or_fetch(word, bit, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+// Bits first..last (inclusive, first <= last)
+static void markBits(uint32 *bitmap, uint32 first, uint32 last)
+{
+    uint32 w = first >> 5, last_w = last >> 5;
+    uint32 mask = ~0u << (first & 31);
+    for (; w < last_w; w++) {
+        __atomic_or_fetch(&bitmap[w], mask, __ATOMIC_RELAXED);
+        mask = ~0u;
+    }
+    mask &= ~0u >> (31 - (last & 31));
+    if ((__atomic_load_n(&bitmap[w], __ATOMIC_RELAXED) & mask) != mask)
+        __atomic_or_fetch(&bitmap[w], mask, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void markTile(uint32 tile)
+{
+    markBit(write_dirty_tiles, tile);
+}
+
+static inline void markTiles(uint32 first, uint32 last)
+{
+    markBits(write_dirty_tiles, first, last);
+}
+
+#if USE_DIRTY_PAGES
+/*
+ *  Pages are only set by the emulation core, so a plain load and store
+ *  will do: if the video task's exchange slips in between, the store puts
+ *  back bits it already collected. Those pages are drawn once more, but no
+ *  store is lost.
+ */
+static inline void markPage(uint32 page)
+{
+    uint32 *word = &write_dirty_pages[page >> 5];
+    uint32 bits = __atomic_load_n(word, __ATOMIC_RELAXED);
+    uint32 bit = 1u << (page & 31);
+    if (!(bits & bit))
+        __atomic_store_n(word, bits | bit, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+#endif
+
+/*
+ *  Set up the lookup tables for a mode
+ */
+void VideoDirtySetMode(uint32 width, uint32 height, video_depth depth, uint32 bytes_per_row, uint32 frame_size)
+{
+    if (width > DIRTY_MAX_WIDTH) width = DIRTY_MAX_WIDTH;
+    if (height > DIRTY_MAX_HEIGHT) height = DIRTY_MAX_HEIGHT;
+    if (bytes_per_row < 2) bytes_per_row = 2;
+
+    // Bits per pixel, 1 to 16
+    uint32 bits = 1 << (depth > VDEPTH_16BIT ? VDEPTH_16BIT : depth);
+
+    // Tile size in Mac pixels for this resolution
+    uint32 tile_width = width / TILES_X, tile_height = height / TILES_Y;
+    if (tile_width < 8) tile_width = 8;
+    if (tile_height < 1) tile_height = 1;
+
+    for (uint32 x = 0; x < DIRTY_MAX_BYTES_PER_ROW; x++) {
+        uint32 pixel = x * 8 / bits;
+        dirty_col_tile[x] = (x < bytes_per_row && pixel < width) ? pixel / tile_width : DIRTY_NO_COLUMN;
+    }
+    for (uint32 y = 0; y < DIRTY_MAX_HEIGHT; y++)
+        dirty_row_tile[y] = (y < height ? y / tile_height : TILES_Y - 1) * TILES_X;
+
+    uint32 k = 31 - __builtin_clz(bytes_per_row - 1);
+    dirty_row_recip = (uint32)((1ULL << (32 + k)) / bytes_per_row + 1);
+    dirty_row_shift = 32 + k;
+    dirty_bytes_per_row = bytes_per_row;
+    dirty_tile_bytes = tile_width * bits / 8;
+    dirty_tile_height = tile_height;
+
+    memset(write_dirty_tiles, 0, sizeof(write_dirty_tiles));
+#if USE_DIRTY_PAGES
+    // Largest power of two that fits in the bytes of one tile row
+    uint32 tile_bytes = dirty_tile_bytes;
+    dirty_page_shift = 31 - __builtin_clz(tile_bytes);
+    memset(write_dirty_pages, 0, sizeof(write_dirty_pages));
+    if (frame_size > (DIRTY_PAGE_WORDS * 32) << dirty_page_shift)
+        frame_size = (DIRTY_PAGE_WORDS * 32) << dirty_page_shift;
+    // Pages below the last row map to no tile, and are never collected
+    uint32 visible = frame_size < height * bytes_per_row ? frame_size : height * bytes_per_row;
+    dirty_page_words = (((visible + (1 << dirty_page_shift) - 1) >> dirty_page_shift) + 31) / 32;
+#endif
+    dirty_height = height;
+    dirty_frame_size = frame_size;
+}
+
+/*
+ *  Mark the tile holding one frame buffer byte dirty (bput)
+ *
+ *  Tiles being rendered are marked unconditionally, so a store racing with
+ *  the video task's conversion shows in VideoDirtyTileWritten() and the
+ *  tile is redrawn in the next frame. Stores call this (and
+ *  VideoMarkDirtyRange()) both before and after they land, see
+ *  VideoDirtyTileWritten().
+ */
+void VideoMarkDirtyOffset(uint32 offset)
+{
+    if (offset >= dirty_frame_size) return;
+#if USE_DIRTY_PAGES
+    if (dirty_pages_enabled) {
+        markPage(offset >> dirty_page_shift);
+        return;
+    }
+#endif
+    uint32 y = dirtyRow(offset);
+    if (y >= dirty_height) return;
+    uint32 col = dirty_col_tile[offset - y * dirty_bytes_per_row];
+    if (col == DIRTY_NO_COLUMN) return;
+    markTile(dirty_row_tile[y] + col);
+}
+
+/*
+ *  Mark the tiles under a multi-byte store (lput, wput) or block write
+ *
+ *  Within one row this marks the tiles from the first to the last byte;
+ *  a write spanning rows marks the full width of every tile row it touches.
+ */
+void VideoMarkDirtyRange(uint32 offset, uint32 size)
+{
+    if (offset >= dirty_frame_size || size == 0) return;
+    uint32 last = offset + size - 1;
+    if (last >= dirty_frame_size) last = dirty_frame_size - 1;
+
+#if USE_DIRTY_PAGES
+    if (dirty_pages_enabled) {
+        uint32 page = offset >> dirty_page_shift, last_page = last >> dirty_page_shift;
+        if (last_page - page < 4) {
+            for (; page <= last_page; page++)
+                markPage(page);
+        } else
+            markBits(write_dirty_pages, page, last_page);
+        return;
+    }
+#endif
+
+    uint32 y = dirtyRow(offset);
+    if (y >= dirty_height) return;
+    uint32 last_y = dirtyRow(last);
+
+    if (last_y == y) {
+        uint32 row = y * dirty_bytes_per_row;
+        uint32 col = dirty_col_tile[offset - row];
+        if (col == DIRTY_NO_COLUMN) return;
+        uint32 last_col = dirty_col_tile[last - row];
+        uint32 first = dirty_row_tile[y] + col;
+        if (last_col == col) {
+            markTile(first);
+            return;
+        }
+        if (last_col == DIRTY_NO_COLUMN) last_col = TILES_X - 1;
+        markTiles(first, dirty_row_tile[y] + last_col);
+        return;
+    }
+
+    if (last_y >= dirty_height) last_y = dirty_height - 1;
+    markTiles(dirty_row_tile[y], dirty_row_tile[last_y] + TILES_X - 1);
+}
+
+#if USE_DIRTY_PAGES
+/*
+ *  Add the tiles under frame buffer bytes offset..last to bitmap, one row
+ *  segment at a time (a page may cover the end of one row and the start of
+ *  the next). Whole rows of one tile row all map to the same tiles, so
+ *  after the first the rest of them are skipped.
+ */
+static void mapBytesToTiles(uint32 *bitmap, uint32 offset, uint32 last)
+{
+    uint32 bpr = dirty_bytes_per_row;
+    uint32 y = dirtyRow(offset);
+    uint32 row = y * bpr;
+    for (; offset <= last && y < dirty_height; y++, row += bpr) {
+        uint32 row_last = row + bpr - 1;
+        uint32 seg_last = last < row_last ? last : row_last;
+        uint32 col = dirty_col_tile[offset - row];
+        if (col != DIRTY_NO_COLUMN) {
+            uint32 last_col = dirty_col_tile[seg_last - row];
+            if (last_col == DIRTY_NO_COLUMN) last_col = TILES_X - 1;
+            for (uint32 t = dirty_row_tile[y] + col; t <= dirty_row_tile[y] + last_col; t++)
+                bitmap[t >> 5] |= 1u << (t & 31);
+        }
+        if (offset == row) {
+            while (row + 2 * bpr - 1 <= last && y + 1 < dirty_height && dirty_row_tile[y + 1] == dirty_row_tile[y]) {
+                y++;
+                row += bpr;
+            }
+            row_last = row + bpr - 1;
+        }
+        offset = row_last + 1;
+    }
+}
+#endif
+
+/*
+ *  Collect and clear the tiles marked since the last call
+ *
+ *  With USE_DIRTY_PAGES the page bitmap is mapped to tiles here, on the
+ *  video task's core. Runs of consecutive pages are mapped as one block.
+ *  Only the words covering the visible frame are scanned (225 of 720 at
+ *  640x360 8-bit).
+ */
+int VideoDirtyCollect(uint32 *bitmap)
+{
+    for (int i = 0; i < TILE_WORDS; i++)
+        bitmap[i] = __atomic_exchange_n(&write_dirty_tiles[i], 0, __ATOMIC_RELAXED);
+
+#if USE_DIRTY_PAGES
+    uint32 run_start = 0, run_end = 0;     // Pending run of pages [start, end)
+    for (uint32 i = 0; dirty_pages_enabled && i < dirty_page_words; i++) {
+        if (!__atomic_load_n(&write_dirty_pages[i], __ATOMIC_RELAXED))
+            continue;
+        uint32 bits = __atomic_exchange_n(&write_dirty_pages[i], 0, __ATOMIC_RELAXED);
+        if (bits == ~0u && i * 32 == run_end && run_end > run_start) {
+            run_end += 32;      // Scrolls and fills: a run goes on
+            continue;
+        }
+        while (bits) {
+            uint32 page = i * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            if (page != run_end) {
+                if (run_end > run_start)
+                    mapBytesToTiles(bitmap, run_start << dirty_page_shift, (run_end << dirty_page_shift) - 1);
+                run_start = page;
+            }
+            run_end = page + 1;
+        }
+    }
+    if (run_end > run_start) {
+        uint32 last = (run_end << dirty_page_shift) - 1;
+        if (last >= dirty_frame_size) last = dirty_frame_size - 1;
+        mapBytesToTiles(bitmap, run_start << dirty_page_shift, last);
+    }
+#endif
+
+    int count = 0;
+    for (int i = 0; i < TILE_WORDS; i++)
+        count += __builtin_popcount(bitmap[i]);
+    return count;
+}
+
+/*
+ *  Generation check after rendering a tile from the live frame buffer
+ *
+ *  A store marks its page or tile before it lands, with a release fence,
+ *  so if the render read any of it, the acquire fence here makes the mark
+ *  visible and the tile is redrawn in the next frame. The store marks once
+ *  more after it lands (normally a load finding the bit set): a first mark
+ *  collected before a store the render then missed would otherwise be
+ *  lost, as the check finds it cleared. Pages shared with a neighbouring
+ *  tile can report a store that missed this one; that only costs a redraw.
+ */
+bool VideoDirtyTileWritten(int tile)
+{
+    // The frame buffer loads of the render come before the mark loads
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&write_dirty_tiles[tile >> 5], __ATOMIC_RELAXED) & (1u << (tile & 31)))
+        return true;
+#if USE_DIRTY_PAGES
+    uint32 ty = tile / TILES_X, tx = tile % TILES_X;
+    uint32 offset = ty * dirty_tile_height * dirty_bytes_per_row + tx * dirty_tile_bytes;
+    for (uint32 row = 0; dirty_pages_enabled && row < dirty_tile_height && offset < dirty_frame_size; row++) {
+        uint32 page = offset >> dirty_page_shift;
+        uint32 last_page = (offset + dirty_tile_bytes - 1) >> dirty_page_shift;
+        for (; page <= last_page; page++) {
+            if (__atomic_load_n(&write_dirty_pages[page >> 5], __ATOMIC_RELAXED) & (1u << (page & 31)))
+                return true;
+        }
+        offset += dirty_bytes_per_row;
+    }
+#endif
+    return false;
+}
+
+#if USE_PALETTE_USAGE
+/*
+ *  Record which palette indices a tile uses, read from the frame buffer.
+ *  Runs of one byte (most of a desktop) cost a compare per byte; packed
+ *  bytes are only split into their pixels when they differ from the last.
+ */
+static void recordPaletteUsage(uint32 *usage, const uint8 *src, uint32 stride, int row_bytes, int rows,
+                               video_depth depth)
+{
+    uint32 bits[PALETTE_WORDS] = {0};
+    int pixels_per_byte = 8 >> depth;
+    int last = -1;
+    for (int row = 0; row < rows; row++) {
+        const uint8 *p = src + row * stride;
+        for (int i = 0; i < row_bytes; i++) {
+            int b = p[i];
+            if (b == last)
+                continue;
+            last = b;
+            if (depth == VDEPTH_8BIT) {
+                bits[b >> 5] |= 1u << (b & 31);
+                continue;
+            }
+            // Packed indices are below 16, all in the first word
+            for (int x = 0; x < pixels_per_byte; x++)
+                bits[0] |= 1u << VideoPackedPixel(p + i, x, depth);
+        }
+    }
+    memcpy(usage, bits, sizeof(bits));
+}
+
+int VideoDirtyRecolorTiles(const video_tile_state *state, const uint32 *changed, uint32 *recolor)
+{
+    int count = 0;
+    for (int t = 0; t < TOTAL_TILES; t++) {
+        uint32 hit = 0;
+        for (int w = 0; w < PALETTE_WORDS; w++)
+            hit |= state->palette_usage[t][w] & changed[w];
+        if (hit) {
+            recolor[t >> 5] |= 1u << (t & 31);
+            count++;
+        }
+    }
+    return count;
+}
+#endif
+
+/*
+ *  Push the dirty tiles, rendered straight from the live frame buffer
+ *
+ *  The uncollected write-dirty marks act as a per-tile generation
+ *  (seqlock): the tile is hashed and converted after the collect, and if a
+ *  store was marked in between, it is queued in state->torn and converted
+ *  again from settled pixels in the next pass. Stores mark before they
+ *  land, so the marks alone catch every store the conversion read; the
+ *  tile is not hashed a second time.
+ *
+ *  Runs of adjacent tiles that need pushing go to push_run() together, so
+ *  a band of dirty tiles costs the panel a few DMA transfers instead of
+ *  one per tile.
+ *
+ *  With USE_PALETTE_USAGE the indices of every pushed tile are recorded
+ *  for VideoDirtyRecolorTiles(); a tile skipped by its hash still uses the
+ *  ones recorded when it was last pushed.
+ */
+int VideoDirtyRenderTiles(video_tile_pass *pass, video_tile_state *state, const uint32 *dirty,
+                          const uint32 *recolor, bool redraw_all)
+{
+    // Tiles torn last pass; this pass's go back into state->torn
+    uint32 retry[TILE_WORDS];
+    memcpy(retry, state->torn, sizeof(retry));
+    memset(state->torn, 0, sizeof(state->torn));
+
+    uint32 bpr = pass->bytes_per_row;
+    int tile_height = pass->tile_height;
+    int tile_bytes = (pass->tile_width << pass->depth) >> 3;
+    int pushed = 0;
+
+    for (int ty = 0; ty < TILES_Y; ty++) {
+        uint32 push_mask = 0;   // Tiles of this row to push, bit tx
+
+        for (int tx = 0; tx < TILES_X; tx++) {
+            int tile = ty * TILES_X + tx;
+            uint32 bit = 1u << (tile & 31);
+            if (!(dirty[tile >> 5] & bit))
+                continue;
+#if USE_TILE_HASH
+            // Written but unchanged since it was last pushed: nothing to do
+            // (unless its colors changed or it was torn)
+            const uint8 *tile_src = pass->src + ty * tile_height * bpr + tx * tile_bytes;
+            uint32 hash = VideoHashTile(tile_src, bpr, tile_bytes, tile_height);
+            bool forced = redraw_all || (retry[tile >> 5] & bit) || (recolor && (recolor[tile >> 5] & bit));
+            if (!forced && hash == state->hash[tile]) {
+                pass->identical++;
+                continue;
+            }
+            state->hash[tile] = hash;
+#else
+            UNUSED(redraw_all);
+            UNUSED(recolor);
+#endif
+            push_mask |= 1u << tx;
+        }
+
+        // Push each run of adjacent tiles, then check it
+        while (push_mask) {
+            int first_tx = __builtin_ctz(push_mask);
+            int count = __builtin_ctz(~(push_mask >> first_tx));
+#if USE_PALETTE_USAGE
+            if (pass->depth != VDEPTH_16BIT) {
+                for (int i = 0; i < count; i++) {
+                    int tile = ty * TILES_X + first_tx + i;
+                    recordPaletteUsage(state->palette_usage[tile], pass->src + ty * tile_height * bpr
+                                       + (first_tx + i) * tile_bytes, bpr, tile_bytes, tile_height, pass->depth);
+                }
+            }
+#endif
+            pass->push_run(pass->ctx, first_tx, count, ty);
+            if (pass->after_push)
+                pass->after_push(pass->ctx, first_tx, count, ty);
+            pushed += count;
+
+            // A store during the conversion may be half on the display.
+            // Its mark is still uncollected, so the tile is dirty again in
+            // the next pass; state->torn keeps the hash from skipping it
+            for (int i = 0; i < count && !pass->unchecked; i++) {
+                int tile = ty * TILES_X + first_tx + i;
+                if (VideoDirtyTileWritten(tile)) {
+                    state->torn[tile >> 5] |= 1u << (tile & 31);
+                    pass->torn++;
+                }
+            }
+            push_mask &= ~(((1u << count) - 1) << first_tx);
+        }
+    }
+    pass->pushed += pushed;
+    return pushed;
+}
+
+void VideoDirtyMarkAll(void)
+{
+    markTiles(0, TOTAL_TILES - 1);
+}
+
+void VideoDirtyReset(void)
+{
+    for (int i = 0; i < TILE_WORDS; i++)
+        __atomic_store_n(&write_dirty_tiles[i], 0, __ATOMIC_RELAXED);
+#if USE_DIRTY_PAGES
+    for (int i = 0; i < DIRTY_PAGE_WORDS; i++)
+        __atomic_store_n(&write_dirty_pages[i], 0, __ATOMIC_RELAXED);
+#endif
+}
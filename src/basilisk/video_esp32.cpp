@@ -9,7 +9,7 @@
  *  1. 8-bit indexed frame buffer - minimizes PSRAM bandwidth
  *     - mac_frame_buffer: CPU writes here (8-bit indexed, 230KB)
  *     - Conversion to RGB565 happens at display write time
- *  2. Write-time dirty tracking - CPU marks tiles dirty as it writes
+ *  2. Write-time dirty tracking - CPU marks tiles dirty as it writes (video_dirty.cpp)
  *     - No per-frame comparison needed (eliminates ~460KB PSRAM traffic)
  *     - Dirty tiles tracked via atomic bitmap operations
  *  3. Tile-based partial updates - only updates changed screen regions
@@ -18,10 +18,13 @@
  *     - Falls back to full update if >80% of tiles are dirty (reduces API overhead)
  *     - Working buffers placed in internal SRAM for fast access
  *  
+ *  4. Two resolutions - 640x360 scaled 2x, and 1280x720 at 1:1 for the
+ *     depths whose frame buffer fits in the PSRAM left after Mac RAM
+ *  
  *  TUNING PARAMETERS (defined below):
- *  - TILE_WIDTH/TILE_HEIGHT: Tile size in Mac pixels (40x40 default)
+ *  - TILE_WIDTH/TILE_HEIGHT: Tile size in Mac pixels at 640x360 (40x40 default)
  *  - DIRTY_THRESHOLD_PERCENT: Threshold for switching to full update (80% default)
- *  - VIDEO_SIGNAL_INTERVAL: Frame rate target in main_esp32.cpp (~15 FPS)
+ *  - PACE_*: Adaptive frame pacing (60 FPS for small updates, down to 15 FPS)
  */
 
 #include "sysdeps.h"
@@ -31,6 +34,12 @@
 #include "prefs.h"
 #include "video.h"
 #include "video_defs.h"
+#include "video_dirty.h"
+#include "video_render.h"
+#include "input.h"
+#if USE_HW_CURSOR
+#include "video_cursor.h"
+#endif
 
 #include <M5Unified.h>
 #include <M5GFX.h>
@@ -46,6 +55,9 @@
 // ESP-IDF memory attributes (DRAM_ATTR for internal SRAM placement)
 #include "esp_attr.h"
 
+// Free PSRAM, to budget the 1280x720 frame buffer
+#include <esp_heap_caps.h>
+
 // Cache control for DMA visibility
 #if __has_include(<esp_cache.h>)
 #include <esp_cache.h>
@@ -70,15 +82,25 @@
 #define DISPLAY_WIDTH     1280
 #define DISPLAY_HEIGHT    720
 
-// Tile-based dirty tracking configuration
-// Tile size: 40x40 Mac pixels (80x80 display pixels after 2x scaling)
-// Grid: 16 columns x 9 rows = 144 tiles total
-// Coverage: 640x360 exactly (40*16=640, 40*9=360)
-#define TILE_WIDTH        40
-#define TILE_HEIGHT       40
-#define TILES_X           16
-#define TILES_Y           9
-#define TOTAL_TILES       (TILES_X * TILES_Y)  // 144 tiles
+// Resolutions offered to the Mac (Monitors control panel). Both fill the
+// display: 640x360 is scaled 2x, 1280x720 is shown 1:1.
+struct screen_resolution {
+    uint32 id;
+    int width, height;
+};
+static const screen_resolution screen_resolutions[] = {
+    {0x80, MAC_SCREEN_WIDTH, MAC_SCREEN_HEIGHT},
+    {0x81, DISPLAY_WIDTH, DISPLAY_HEIGHT},
+};
+#define NUM_RESOLUTIONS (sizeof(screen_resolutions) / sizeof(screen_resolutions[0]))
+
+// PSRAM kept free after the frame buffer (disk and audio buffers allocated
+// later in InitAll); 1280x720 depths that would eat into it are not offered
+#define VIDEO_PSRAM_RESERVE  (512 * 1024)
+
+// Tile-based dirty tracking: 16x9 grid from video_dirty.h, every tile is
+// 80x80 display pixels
+#define TILE_DISPLAY_SIZE  (TILE_WIDTH * PIXEL_SCALE)
 
 // Dirty tile threshold - if more than this percentage of tiles are dirty,
 // do a full update instead of partial
@@ -87,6 +109,15 @@
 // double-buffered DMA while streaming mode processes rows sequentially
 #define DIRTY_THRESHOLD_PERCENT  101
 
+// Adaptive frame pacing (pacingInterval()): the next frame may start once
+// its predicted render time is at most PACE_DUTY_PERCENT of the time since
+// the last one, within PACE_MIN_FRAME_US..PACE_MAX_FRAME_US
+#define PACE_MIN_FRAME_US      16667   // 60 FPS for a few dirty tiles
+#define PACE_MAX_FRAME_US      66667   // 15 FPS under full screen churn
+#define PACE_DUTY_PERCENT      50      // Render time per frame interval
+#define PACE_POLL_US           8000    // Wake-up interval while idle
+#define PACE_TILE_US_INITIAL   200     // Render cost per tile before the first measurement
+
 // Video task configuration
 #define VIDEO_TASK_STACK_SIZE  8192
 #define VIDEO_TASK_PRIORITY    1
@@ -111,29 +142,50 @@ DRAM_ATTR static uint16 palette_rgb565[256];
 // Flag to track if palette has changed - avoids unnecessary copies in video task
 static volatile bool palette_changed = true;
 
+#if USE_PALETTE_USAGE
+// Palette indices whose color changed since the video task last copied the
+// palette (guarded by frame_spinlock)
+static uint32 palette_changed_indices[PALETTE_WORDS];
+#endif
+
 // Dirty tile bitmap - in internal SRAM for fast access during video frame processing
-DRAM_ATTR static uint32 dirty_tiles[(TOTAL_TILES + 31) / 32];          // Bitmap of dirty tiles (read by video task)
+// Filled from the write-time bitmap in video_dirty.cpp once per frame, so CPU
+// writes during rendering land in the next frame
+DRAM_ATTR static uint32 dirty_tiles[TILE_WORDS];          // Bitmap of dirty tiles (read by video task)
 
-// Write-time dirty tracking bitmap - marked when CPU writes to framebuffer
-// This is double-buffered to avoid race conditions between CPU writes and video task reads
-DRAM_ATTR static uint32 write_dirty_tiles[(TOTAL_TILES + 31) / 32];    // Tiles dirtied by CPU writes
+// Content hash of each tile as last pushed to the display, and the tiles a
+// store landed in while they were being converted (torn), to redraw in the
+// next frame even if their hash matches (VideoDirtyRenderTiles())
+// Tiles that were written but hash the same (cursor blinks, apps redrawing
+// identical pixels) skip palette conversion and DMA with USE_TILE_HASH
+DRAM_ATTR static video_tile_state tile_state;
 
-// Per-tile render lock bitmap - set while video task is snapshotting a tile
-// If CPU tries to write while this is set, the tile is re-marked dirty for next frame
-// This prevents torn data from race conditions during snapshot
-DRAM_ATTR static uint32 tile_render_active[(TOTAL_TILES + 31) / 32];   // Tiles currently being rendered
+#if USE_PALETTE_USAGE
+// Tiles to redraw for a palette change this frame, even if their content
+// hash is unchanged
+DRAM_ATTR static uint32 recolor_tiles[TILE_WORDS];
+#endif
 
 // Double-buffered row buffers for streaming full-frame renders with async DMA
 // Processes 4 Mac rows at a time (becomes 8 display rows with 2x scaling)
 // Size: 1280 pixels * 8 rows * 2 bytes = 20,480 bytes (20KB) per buffer
 // Double-buffering allows rendering to one buffer while DMA pushes the other
+// Also the output buffers for runs of dirty tiles (pushTileRun())
 // In internal SRAM for fast access during full-frame renders
 #define STREAMING_ROW_COUNT 8
-DRAM_ATTR static uint16 streaming_row_buffer_a[DISPLAY_WIDTH * STREAMING_ROW_COUNT];
-DRAM_ATTR static uint16 streaming_row_buffer_b[DISPLAY_WIDTH * STREAMING_ROW_COUNT];
+// 16-byte aligned for the PIE row repeat (video_render.h)
+DRAM_ATTR static uint16 streaming_row_buffer_a[DISPLAY_WIDTH * STREAMING_ROW_COUNT] __attribute__((aligned(16)));
+DRAM_ATTR static uint16 streaming_row_buffer_b[DISPLAY_WIDTH * STREAMING_ROW_COUNT] __attribute__((aligned(16)));
 static uint16 *render_buffer = streaming_row_buffer_a;
 static uint16 *push_buffer = streaming_row_buffer_b;
 
+#if USE_HW_CURSOR
+// Cursor composited into this frame's pixels, read once per frame so all
+// strips agree, and the cursor as the display currently shows it
+static video_cursor frame_cursor;
+static video_cursor shown_cursor;
+#endif
+
 static volatile bool force_full_update = true;               // Force full update on first frame or palette change
 static int dirty_tile_count = 0;                             // Count of dirty tiles for threshold check
 
@@ -151,6 +203,11 @@ static volatile uint32 current_bytes_per_row = MAC_SCREEN_WIDTH;  // Bytes per r
 static volatile int current_pixels_per_byte = 1;  // Pixels packed per byte (8=1bit, 4=2bit, 2=4bit, 1=8bit)
 static volatile int current_bit_shift = 0;  // Bits to shift per pixel (7=1bit, 6=2bit, 4=4bit, 0=8bit)
 static volatile uint8 current_pixel_mask = 0xFF;  // Mask for extracting pixel value
+static volatile int current_width = MAC_SCREEN_WIDTH;    // Mac screen size
+static volatile int current_height = MAC_SCREEN_HEIGHT;
+static volatile int current_scale = PIXEL_SCALE;         // Display pixels per Mac pixel (2 or 1)
+static volatile int current_tile_width = TILE_WIDTH;     // Tile size in Mac pixels
+static volatile int current_tile_height = TILE_HEIGHT;
 
 // ============================================================================
 // Performance profiling counters (lightweight, always enabled)
@@ -161,6 +218,19 @@ static volatile uint32_t perf_frame_count = 0;      // Frames rendered
 static volatile uint32_t perf_partial_count = 0;    // Partial updates
 static volatile uint32_t perf_full_count = 0;       // Full updates
 static volatile uint32_t perf_skip_count = 0;       // Skipped frames (no changes)
+static volatile uint32_t perf_identical_count = 0;  // Dirty tiles skipped as unchanged (USE_TILE_HASH)
+static volatile uint32_t perf_dma_count = 0;        // DMA transfers to the display
+static volatile uint32_t perf_dma_bytes = 0;        // Bytes pushed by them
+static volatile uint32_t perf_recolor_count = 0;    // Tiles redrawn for palette changes (USE_PALETTE_USAGE)
+static volatile uint32_t perf_recolor_saved = 0;    // Tiles a palette change did not need to redraw
+static volatile uint32_t perf_cursor_count = 0;     // Cursor overlay pushes (USE_HW_CURSOR)
+static volatile uint32_t perf_torn_count = 0;       // Tiles written while converted, redrawn next frame
+static volatile uint32_t perf_pace_frames = 0;      // Frames that reached the display
+static volatile uint32_t perf_pace_fast = 0;        // ... at the minimum interval (small damage)
+static volatile uint32_t perf_pace_deferred = 0;    // Wake-ups that held damage back for pacing
+static volatile uint32_t perf_pace_interval_us = 0; // Sum of the intervals the frames waited for
+static volatile uint32_t perf_pace_latency_us = 0;  // Sum of first damage to frame pushed
+static volatile uint32_t perf_pace_latency_max = 0; // Longest of those
 static volatile uint32_t perf_last_report_ms = 0;   // Last time stats were printed
 #define PERF_REPORT_INTERVAL_MS 5000                // Report every 5 seconds
 
@@ -178,42 +248,32 @@ public:
 // Pointer to our monitor
 static ESP32_monitor_desc *the_monitor = NULL;
 
-/*
- *  Convert RGB888 to swap565 format for M5GFX writePixels
- *  
- *  M5GFX uses byte-swapped RGB565 (swap565_t):
- *  - Low byte:  RRRRRGGG (R5 in bits 7-3, G high 3 bits in bits 2-0)
- *  - High byte: GGGBBBBB (G low 3 bits in bits 7-5, B5 in bits 4-0)
- */
-static inline uint16 rgb888_to_rgb565(uint8 r, uint8 g, uint8 b)
-{
-    // swap565 format: matches M5GFX's internal swap565() function
-    return ((r >> 3) << 3 | (g >> 5)) | (((g >> 2) << 5 | (b >> 3)) << 8);
-}
-
 /*
  *  Set palette for indexed color modes
  *  Thread-safe: uses spinlock since palette can be updated from CPU emulation
  *  
- *  When palette changes, we force a full screen update since all pixels
- *  may look different even though the framebuffer data hasn't changed.
+ *  When palette changes, pixels may look different even though the
+ *  framebuffer data hasn't changed. With USE_PALETTE_USAGE the indices whose
+ *  color actually changed are recorded and the video task redraws only the
+ *  tiles using them; otherwise we force a full screen update.
  */
 void ESP32_monitor_desc::set_palette(uint8 *pal, int num)
 {
     D(bug("[VIDEO] set_palette: %d entries\n", num));
     
     portENTER_CRITICAL(&frame_spinlock);
-    for (int i = 0; i < num && i < 256; i++) {
-        uint8 r = pal[i * 3 + 0];
-        uint8 g = pal[i * 3 + 1];
-        uint8 b = pal[i * 3 + 2];
-        palette_rgb565[i] = rgb888_to_rgb565(r, g, b);
-    }
+#if USE_PALETTE_USAGE
+    VideoSetPalette(pal, num, palette_rgb565, palette_changed_indices);
+#else
+    VideoSetPalette(pal, num, palette_rgb565, NULL);
+#endif
     palette_changed = true;
     portEXIT_CRITICAL(&frame_spinlock);
     
+#if !USE_PALETTE_USAGE
     // Force a full screen update since palette affects all pixels
     force_full_update = true;
+#endif
 }
 
 /*
@@ -228,12 +288,17 @@ void ESP32_monitor_desc::set_gamma(uint8 *gamma, int num)
 }
 
 /*
- *  Helper to update the video state cache based on depth
+ *  Helper to update the video state cache for a mode
  */
-static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row)
+static void updateVideoStateCache(int width, int height, video_depth depth, uint32 bytes_per_row)
 {
     current_depth = depth;
     current_bytes_per_row = bytes_per_row;
+    current_width = width;
+    current_height = height;
+    current_scale = DISPLAY_WIDTH / width;
+    current_tile_width = width / TILES_X;
+    current_tile_height = height / TILES_Y;
     
     switch (depth) {
         case VDEPTH_1BIT:
@@ -257,109 +322,38 @@ static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row)
             current_bit_shift = 0;
             current_pixel_mask = 0xFF;
             break;
+        case VDEPTH_16BIT:
+            // Direct color, 2 bytes per pixel in display format
+            current_pixels_per_byte = 0;
+            current_bit_shift = 0;
+            current_pixel_mask = 0;
+            break;
     }
     
-    Serial.printf("[VIDEO] Mode cache updated: depth=%d, bpr=%d, ppb=%d\n", 
-                  (int)depth, (int)bytes_per_row, current_pixels_per_byte);
+    // Rebuild the write-time dirty tracking tables for the new geometry
+    VideoDirtySetMode(width, height, depth, bytes_per_row, frame_buffer_size);
+    
+    // Touch coordinates follow the resolution
+    InputSetScreenSize(width, height);
+    
+    Serial.printf("[VIDEO] Mode cache updated: %dx%d (%dx), depth=%d, bpr=%d, ppb=%d\n", 
+                  width, height, current_scale, (int)depth, (int)bytes_per_row, current_pixels_per_byte);
 }
 
 /*
  *  Initialize palette with default colors for the specified depth
- *  
- *  This sets up appropriate default colors:
- *  - 1-bit: Black and white (standard Mac B&W)
- *  - 2-bit: 4-color grayscale (white, light gray, dark gray, black)
- *  - 4-bit: Classic Mac 16-color palette
- *  - 8-bit: Mac 256-color palette (6x6x6 color cube + grayscale ramp)
- *  
- *  Classic Mac convention: index 0 = white, highest index = black
+ *  (VideoDefaultPalette(), shared with the host build)
  */
 static void initDefaultPalette(video_depth depth)
 {
     portENTER_CRITICAL(&frame_spinlock);
+    VideoDefaultPalette(depth, palette_rgb565);
+    portEXIT_CRITICAL(&frame_spinlock);
     
-    switch (depth) {
-        case VDEPTH_1BIT:
-            // 1-bit: Black and white
-            // Index 0 = white, Index 1 = black
-            palette_rgb565[0] = rgb888_to_rgb565(255, 255, 255);  // White
-            palette_rgb565[1] = rgb888_to_rgb565(0, 0, 0);        // Black
-            Serial.println("[VIDEO] Initialized 1-bit B&W palette");
-            break;
-            
-        case VDEPTH_2BIT:
-            // 2-bit: 4 levels of gray
-            // Index 0 = white, Index 3 = black
-            palette_rgb565[0] = rgb888_to_rgb565(255, 255, 255);  // White
-            palette_rgb565[1] = rgb888_to_rgb565(170, 170, 170);  // Light gray
-            palette_rgb565[2] = rgb888_to_rgb565(85, 85, 85);     // Dark gray
-            palette_rgb565[3] = rgb888_to_rgb565(0, 0, 0);        // Black
-            Serial.println("[VIDEO] Initialized 2-bit grayscale palette");
-            break;
-            
-        case VDEPTH_4BIT:
-            // 4-bit: Classic Mac 16-color palette
-            // This matches the standard Mac 16-color CLUT
-            {
-                static const uint8 mac16[16][3] = {
-                    {255, 255, 255},  // 0: White
-                    {255, 255, 0},    // 1: Yellow
-                    {255, 102, 0},    // 2: Orange
-                    {221, 0, 0},      // 3: Red
-                    {255, 0, 153},    // 4: Magenta
-                    {51, 0, 153},     // 5: Purple
-                    {0, 0, 204},      // 6: Blue
-                    {0, 153, 255},    // 7: Cyan
-                    {0, 170, 0},      // 8: Green
-                    {0, 102, 0},      // 9: Dark Green
-                    {102, 51, 0},     // 10: Brown
-                    {153, 102, 51},   // 11: Tan
-                    {187, 187, 187},  // 12: Light Gray
-                    {136, 136, 136},  // 13: Medium Gray
-                    {68, 68, 68},     // 14: Dark Gray
-                    {0, 0, 0}         // 15: Black
-                };
-                for (int i = 0; i < 16; i++) {
-                    palette_rgb565[i] = rgb888_to_rgb565(mac16[i][0], mac16[i][1], mac16[i][2]);
-                }
-            }
-            Serial.println("[VIDEO] Initialized 4-bit 16-color palette");
-            break;
-            
-        case VDEPTH_8BIT:
-        default:
-            // 8-bit: Mac 256-color palette
-            // Uses a 6x6x6 color cube (216 colors) plus grayscale ramp
-            // This provides a good default color palette for 256-color mode
-            {
-                int idx = 0;
-                
-                // First, create a 6x6x6 color cube (216 colors)
-                // This gives 6 levels each of R, G, B: 0, 51, 102, 153, 204, 255
-                for (int r = 0; r < 6; r++) {
-                    for (int g = 0; g < 6; g++) {
-                        for (int b = 0; b < 6; b++) {
-                            uint8 rv = r * 51;
-                            uint8 gv = g * 51;
-                            uint8 bv = b * 51;
-                            palette_rgb565[idx++] = rgb888_to_rgb565(rv, gv, bv);
-                        }
-                    }
-                }
-                
-                // Fill remaining 40 entries with a grayscale ramp
-                // This provides smooth grays for UI elements
-                for (int i = 0; i < 40; i++) {
-                    uint8 gray = (i * 255) / 39;
-                    palette_rgb565[idx++] = rgb888_to_rgb565(gray, gray, gray);
-                }
-            }
-            Serial.println("[VIDEO] Initialized 8-bit 256-color palette");
-            break;
+    if (depth != VDEPTH_16BIT) {
+        Serial.printf("[VIDEO] Initialized %d-color default palette\n", 1 << (1 << depth));
     }
     
-    portEXIT_CRITICAL(&frame_spinlock);
-    
     // Force a full screen update since palette changed
     force_full_update = true;
 }
@@ -374,13 +368,21 @@ void ESP32_monitor_desc::switch_to_current_mode(void)
           mode.x, mode.y, mode.depth, mode.bytes_per_row));
     
     // Update the video state cache for rendering
-    updateVideoStateCache(mode.depth, mode.bytes_per_row);
+    updateVideoStateCache(mode.x, mode.y, mode.depth, mode.bytes_per_row);
     
     // Initialize default palette for this depth
     // MacOS will set its own palette shortly after, but this ensures
     // the display looks reasonable immediately after the mode switch
     initDefaultPalette(mode.depth);
     
+    // Thousands stores are converted to the display's 565 format as they
+    // happen (memory.cpp); indexed modes store Mac pixels unchanged
+    int layout = mode.depth == VDEPTH_16BIT ? FLAYOUT_BE_565 : FLAYOUT_DIRECT;
+    if (layout != MacFrameLayout) {
+        MacFrameLayout = layout;
+        map_frame_banks();
+    }
+    
     // Update frame buffer base address
     set_mac_frame_base(MacFrameBaseMac);
     
@@ -389,519 +391,262 @@ void ESP32_monitor_desc::switch_to_current_mode(void)
 }
 
 // ============================================================================
-// Packed pixel decoding helpers for 1/2/4-bit modes
+// Palette changes
 // ============================================================================
 
+#if USE_PALETTE_USAGE
 /*
- *  Decode a row of packed pixels to 8-bit palette indices
- *  
- *  In packed modes, multiple pixels are stored per byte:
- *  - 1-bit: 8 pixels per byte, MSB first (bit 7 = leftmost pixel)
- *  - 2-bit: 4 pixels per byte, MSB first (bits 7-6 = leftmost pixel)
- *  - 4-bit: 2 pixels per byte, MSB first (bits 7-4 = leftmost pixel)
- *  - 8-bit: 1 pixel per byte (no decoding needed)
- *  
- *  @param src       Source row in frame buffer (packed)
- *  @param dst       Destination buffer for 8-bit indices (must hold width pixels)
- *  @param width     Number of pixels to decode
- *  @param depth     Current video depth
- */
-static void decodePackedRow(const uint8 *src, uint8 *dst, int width, video_depth depth)
-{
-    switch (depth) {
-        case VDEPTH_1BIT: {
-            // 8 pixels per byte, MSB first
-            for (int x = 0; x < width; x++) {
-                int byte_idx = x / 8;
-                int bit_idx = 7 - (x % 8);  // MSB first
-                dst[x] = (src[byte_idx] >> bit_idx) & 0x01;
-            }
-            break;
-        }
-        case VDEPTH_2BIT: {
-            // 4 pixels per byte, MSB first
-            for (int x = 0; x < width; x++) {
-                int byte_idx = x / 4;
-                int shift = 6 - ((x % 4) * 2);  // MSB first: 6, 4, 2, 0
-                dst[x] = (src[byte_idx] >> shift) & 0x03;
-            }
-            break;
-        }
-        case VDEPTH_4BIT: {
-            // 2 pixels per byte, MSB first
-            for (int x = 0; x < width; x++) {
-                int byte_idx = x / 2;
-                int shift = (x % 2 == 0) ? 4 : 0;  // MSB first: high nibble, low nibble
-                dst[x] = (src[byte_idx] >> shift) & 0x0F;
-            }
-            break;
-        }
-        case VDEPTH_8BIT:
-        default:
-            // Direct copy, no decoding needed
-            memcpy(dst, src, width);
-            break;
-    }
-}
-
-/*
- *  Get pixel index from packed framebuffer at given (x, y) coordinate
- *  Used for single-pixel access when full row decode is overkill
- *  
- *  @param fb        Frame buffer pointer
- *  @param x         X coordinate (pixel)
- *  @param y         Y coordinate (row)
- *  @param bpr       Bytes per row
- *  @param depth     Current video depth
- *  @return          8-bit palette index for the pixel
- */
-static inline uint8 getPackedPixel(const uint8 *fb, int x, int y, uint32 bpr, video_depth depth)
-{
-    const uint8 *row = fb + y * bpr;
-    
-    switch (depth) {
-        case VDEPTH_1BIT: {
-            int byte_idx = x / 8;
-            int bit_idx = 7 - (x % 8);
-            return (row[byte_idx] >> bit_idx) & 0x01;
-        }
-        case VDEPTH_2BIT: {
-            int byte_idx = x / 4;
-            int shift = 6 - ((x % 4) * 2);
-            return (row[byte_idx] >> shift) & 0x03;
-        }
-        case VDEPTH_4BIT: {
-            int byte_idx = x / 2;
-            int shift = (x % 2 == 0) ? 4 : 0;
-            return (row[byte_idx] >> shift) & 0x0F;
-        }
-        case VDEPTH_8BIT:
-        default:
-            return row[x];
-    }
-}
-
-/*
- *  Check if a specific tile is marked as dirty
+ *  Queue the tiles that use any of the changed palette indices for redraw
+ *  (recolor_tiles) and count the ones a full refresh would have redrawn
+ *  for nothing
  */
-static inline bool isTileDirty(int tile_idx)
+static void markRecolorTiles(const uint32 *changed)
 {
-    return (dirty_tiles[tile_idx / 32] & (1 << (tile_idx % 32))) != 0;
+    int count = VideoDirtyRecolorTiles(&tile_state, changed, recolor_tiles);
+    perf_recolor_count += count;
+    perf_recolor_saved += TOTAL_TILES - count;
 }
+#endif
 
 /*
- *  Tile render lock functions - used to prevent race conditions during snapshot
- *  When a tile is being rendered (snapshotted), CPU writes to that tile will
- *  be deferred to the next frame by re-marking the tile dirty.
+ *  Double-buffered DMA state shared by the runs of one frame
  */
-static inline void setTileRenderActive(int tile_idx)
-{
-    __atomic_or_fetch(&tile_render_active[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELEASE);
-}
-
-static inline void clearTileRenderActive(int tile_idx)
-{
-    __atomic_and_fetch(&tile_render_active[tile_idx / 32], ~(1u << (tile_idx % 32)), __ATOMIC_RELEASE);
-}
-
-static inline bool isTileRenderActive(int tile_idx)
-{
-    return (__atomic_load_n(&tile_render_active[tile_idx / 32], __ATOMIC_ACQUIRE) & (1u << (tile_idx % 32))) != 0;
-}
+struct tile_push_state {
+    const uint8 *src_buffer;
+    const uint32 *doubled_palette;
+    uint16 *render_buf;     // Being rendered into
+    uint16 *dma_buf;        // Possibly being pushed
+    bool dma_pending;
+    int transfers;          // Since startWrite
+};
 
 /*
- *  Mark a tile as dirty at write-time (called from frame buffer put functions)
- *  This is MUCH faster than per-frame comparison as it only runs on actual writes.
- *  
- *  Handles packed pixel modes by mapping byte offset to pixel coordinates using
- *  current_bytes_per_row and current_pixels_per_byte.
+ *  Render and push a run of adjacent dirty tiles in one tile row
+ *  (video_tile_pass::push_run)
  *  
- *  RACE CONDITION HANDLING:
- *  If the video task is currently rendering (snapshotting) this tile, the snapshot
- *  might contain torn data. However, we unconditionally mark the tile dirty here,
- *  which ensures it will be re-rendered cleanly in the next frame. Combined with
- *  the tile_render_active lock in renderAndPushDirtyTiles(), this provides
- *  eventual consistency - a torn frame may appear briefly but will be fixed
- *  within one frame interval (42ms).
+ *  The run is rendered in horizontal strips as tall as fit in one
+ *  streaming row buffer (DISPLAY_WIDTH * STREAMING_ROW_COUNT pixels), and
+ *  each strip is one setAddrWindow + writePixelsDMA. A single tile is one
+ *  transfer, a full row of 16 tiles is 10 instead of 16.
  *  
- *  @param offset  Byte offset into the Mac framebuffer
+ *  The span is rendered straight from the live frame buffer;
+ *  VideoDirtyRenderTiles() checks its tiles for stores that landed
+ *  meanwhile once this returns.
  */
-void VideoMarkDirtyOffset(uint32 offset)
+static void pushTileRun(void *ctx, int first_tx, int count, int ty)
 {
-    if (offset >= frame_buffer_size) return;
-    
-    // Get current bytes per row (volatile)
+    tile_push_state &st = *(tile_push_state *)ctx;
+    const uint8 *src_buffer = st.src_buffer;
+    const uint32 *doubled_palette = st.doubled_palette;
+    int scale = current_scale;
+    int tile_width = current_tile_width, tile_height = current_tile_height;
+    video_depth depth = current_depth;
     uint32 bpr = current_bytes_per_row;
-    int ppb = current_pixels_per_byte;
-    
-    // Calculate row from byte offset
-    int y = offset / bpr;
-    if (y >= MAC_SCREEN_HEIGHT) return;
-    
-    // Calculate byte position within row
-    int byte_in_row = offset % bpr;
-    
-    // Calculate pixel range that this byte affects
-    int pixel_start = byte_in_row * ppb;
-    int pixel_end = pixel_start + ppb - 1;
-    
-    // Clamp to screen width
-    if (pixel_start >= MAC_SCREEN_WIDTH) return;
-    if (pixel_end >= MAC_SCREEN_WIDTH) pixel_end = MAC_SCREEN_WIDTH - 1;
-    
-    // Calculate tile range
-    int tile_x_start = pixel_start / TILE_WIDTH;
-    int tile_x_end = pixel_end / TILE_WIDTH;
-    int tile_y = y / TILE_HEIGHT;
-    
-    // Mark all affected tiles dirty (unconditionally - even if being rendered)
-    // This ensures tiles written during rendering are re-rendered next frame
-    for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
-        int tile_idx = tile_y * TILES_X + tile_x;
-        if (tile_idx < TOTAL_TILES) {
-            __atomic_or_fetch(&write_dirty_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
+    int span_width = count * TILE_DISPLAY_SIZE;
+    int strip_rows = DISPLAY_WIDTH * STREAMING_ROW_COUNT / (span_width * scale);   // Mac rows
+    if (strip_rows > tile_height) strip_rows = tile_height;
+    
+    for (int row = 0; row < tile_height; row += strip_rows) {
+        int rows = tile_height - row < strip_rows ? tile_height - row : strip_rows;
+        
+        // Tiles start on a byte boundary at every depth (tile widths are
+        // multiples of 8 pixels)
+        const uint8 *src = src_buffer + (ty * tile_height + row) * bpr + ((first_tx * tile_width << depth) >> 3);
+        for (int r = 0; r < rows; r++) {
+            if (scale == 1) {
+                VideoRenderRow1x(src + r * bpr, st.render_buf + r * span_width,
+                                 count * tile_width, depth, doubled_palette);
+            } else {
+                VideoRenderRow2x(src + r * bpr, st.render_buf + r * 2 * span_width,
+                                 count * tile_width, depth, doubled_palette);
+            }
+        }
+        
+        // Second display row of each pair, for the whole span at once
+        if (scale == 2) {
+            for (int r = 0; r < rows; r++) {
+                uint16 *line = st.render_buf + r * 2 * span_width;
+                VideoRepeatRow(line, line + span_width, span_width);
+            }
+        }
+        
+#if USE_HW_CURSOR
+        VideoCursorComposite(&frame_cursor, scale, st.render_buf, span_width, first_tx * TILE_DISPLAY_SIZE,
+                             (ty * tile_height + row) * scale, span_width, rows * scale);
+#endif
+        
+        // Wait for the DMA still reading the other buffer
+        if (st.dma_pending) {
+            M5.Display.waitDMA();
+            st.dma_pending = false;
+        }
+        
+        int pixels = span_width * rows * scale;
+        M5.Display.setAddrWindow(first_tx * TILE_DISPLAY_SIZE,
+                                 (ty * tile_height + row) * scale, span_width, rows * scale);
+        M5.Display.writePixelsDMA(st.render_buf, pixels);
+        st.dma_pending = true;
+        st.transfers++;
+        perf_dma_count++;
+        perf_dma_bytes += pixels * sizeof(uint16);
+        
+        // Render the next strip while this one is pushed
+        uint16 *tmp = st.render_buf;
+        st.render_buf = st.dma_buf;
+        st.dma_buf = tmp;
+        
+        // Every 8 transfers, yield to let other tasks run
+        // This prevents starvation during full-screen updates
+        if ((st.transfers & 0x07) == 0) {
+            taskYIELD();
         }
     }
 }
 
 /*
- *  Mark a range of tiles as dirty at write-time
- *  Used for multi-byte writes (lput, wput)
+ *  Render and push only dirty tiles to the display
  *  
- *  For packed pixel modes, a multi-byte write can span many pixels across
- *  potentially multiple rows and tiles.
+ *  Tiles are converted straight from the frame buffer while the CPU may be
+ *  writing to it, with no snapshot copy and no lock on the write path;
+ *  VideoDirtyRenderTiles() (video_dirty.cpp) does the hash skip and the
+ *  generation check that re-queues torn tiles in tile_state.torn, and
+ *  hands runs of adjacent tiles to pushTileRun(), so a band of dirty tiles
+ *  costs a few DMA transfers instead of one per tile. Double-buffered
+ *  output lets DMA overlap with rendering.
  *  
- *  See VideoMarkDirtyOffset() for race condition handling notes.
+ *  With USE_TILE_HASH, a tile that hashes the same as when it was last
+ *  pushed is skipped, unless redraw_all is set (palette or mode change,
+ *  where identical indices still need new colors), it was torn last frame
+ *  or, with USE_PALETTE_USAGE, it uses a palette entry that changed.
  *  
- *  @param offset  Starting byte offset into the Mac framebuffer
- *  @param size    Number of bytes being written
+ *  @param src_buffer       Mac framebuffer
+ *  @param doubled_palette  Pre-copied doubled palette for thread safety
+ *  @param redraw_all       Push every dirty tile even if its content is unchanged
  */
-void VideoMarkDirtyRange(uint32 offset, uint32 size)
+static void renderAndPushDirtyTiles(uint8 *src_buffer, const uint32 *doubled_palette, bool redraw_all)
 {
-    if (offset >= frame_buffer_size) return;
-    
-    // Clamp size to framebuffer bounds
-    if (offset + size > frame_buffer_size) {
-        size = frame_buffer_size - offset;
-    }
+    // Output goes through the streaming row buffers (double-buffered DMA)
+    tile_push_state st;
+    st.src_buffer = src_buffer;
+    st.doubled_palette = doubled_palette;
+    st.render_buf = streaming_row_buffer_a;
+    st.dma_buf = streaming_row_buffer_b;
+    st.dma_pending = false;
+    st.transfers = 0;
+    
+    video_tile_pass pass;
+    memset(&pass, 0, sizeof(pass));
+    pass.src = src_buffer;
+    pass.bytes_per_row = current_bytes_per_row;
+    pass.depth = current_depth;
+    pass.tile_width = current_tile_width;
+    pass.tile_height = current_tile_height;
+    pass.push_run = pushTileRun;
+    pass.ctx = &st;
+    
+    const uint32 *recolor = NULL;
+#if USE_PALETTE_USAGE
+    recolor = recolor_tiles;
+#endif
     
-    // Get current bytes per row (volatile)
-    uint32 bpr = current_bytes_per_row;
-    int ppb = current_pixels_per_byte;
-    
-    // Calculate start and end rows
-    int start_y = offset / bpr;
-    int end_y = (offset + size - 1) / bpr;
-    
-    // For small writes or writes within a single row, just mark individual bytes
-    if (end_y == start_y && size <= 4) {
-        // Simple case: mark start and end bytes
-        VideoMarkDirtyOffset(offset);
-        if (size > 1) {
-            VideoMarkDirtyOffset(offset + size - 1);
-        }
-        return;
-    }
+    M5.Display.startWrite();
+    VideoDirtyRenderTiles(&pass, &tile_state, dirty_tiles, recolor, redraw_all);
     
-    // For larger writes spanning multiple rows, calculate affected tile columns
-    // This is more efficient than marking every byte individually
-    int start_byte_in_row = offset % bpr;
-    int end_byte_in_row = (offset + size - 1) % bpr;
-    
-    // Calculate pixel columns affected
-    int pixel_col_start = start_byte_in_row * ppb;
-    int pixel_col_end = (end_byte_in_row + 1) * ppb - 1;
-    
-    // For writes spanning multiple rows, the middle rows are fully affected
-    // So we need to consider columns from 0 to end for complex cases
-    if (end_y > start_y) {
-        // Multi-row write: could affect any column
-        pixel_col_start = 0;
-        pixel_col_end = MAC_SCREEN_WIDTH - 1;
+    // Wait for final DMA to complete before ending write session
+    if (st.dma_pending) {
+        M5.Display.waitDMA();
     }
     
-    // Calculate tile ranges
-    int tile_x_start = pixel_col_start / TILE_WIDTH;
-    int tile_x_end = pixel_col_end / TILE_WIDTH;
-    if (tile_x_end >= TILES_X) tile_x_end = TILES_X - 1;
-    
-    int tile_y_start = start_y / TILE_HEIGHT;
-    int tile_y_end = end_y / TILE_HEIGHT;
-    if (tile_y_end >= TILES_Y) tile_y_end = TILES_Y - 1;
+    M5.Display.endWrite();
     
-    // Mark all affected tiles dirty
-    for (int tile_y = tile_y_start; tile_y <= tile_y_end; tile_y++) {
-        for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
-            int tile_idx = tile_y * TILES_X + tile_x;
-            __atomic_or_fetch(&write_dirty_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
-        }
-    }
+    perf_identical_count += pass.identical;
+    perf_torn_count += pass.torn;
 }
 
+#if USE_HW_CURSOR
 /*
- *  Collect write-dirty tiles into the render dirty bitmap and clear write bitmap
- *  Returns the number of dirty tiles
- *  Called at the start of each video frame
+ *  Mac pixel rectangle covered by a cursor, x widened to multiples of 8 so
+ *  packed rows start on a byte boundary. Returns false if it is off screen.
  */
-static int collectWriteDirtyTiles(void)
+static bool cursorRect(const video_cursor *c, int &x0, int &y0, int &x1, int &y1)
 {
-    int count = 0;
-    
-    // Copy write_dirty_tiles to dirty_tiles and count
-    for (int i = 0; i < (TOTAL_TILES + 31) / 32; i++) {
-        // Atomically read and clear the write dirty bitmap
-        uint32 bits = __atomic_exchange_n(&write_dirty_tiles[i], 0, __ATOMIC_RELAXED);
-        dirty_tiles[i] = bits;
-        
-        // Count set bits (popcount)
-        while (bits) {
-            count += (bits & 1);
-            bits >>= 1;
-        }
-    }
-    
-    return count;
+    x0 = c->x & ~7;
+    x1 = (c->x + CURSOR_SIZE + 7) & ~7;
+    y0 = c->y;
+    y1 = c->y + CURSOR_SIZE;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > current_width) x1 = current_width;
+    if (y1 > current_height) y1 = current_height;
+    return x0 < x1 && y0 < y1;
 }
 
 /*
- *  Copy a single tile's source data from framebuffer to a snapshot buffer
- *  This creates a consistent snapshot of the tile to avoid race conditions
- *  when the CPU is writing to the framebuffer while we're rendering.
- *  
- *  For packed pixel modes, decodes to 8-bit indices in the snapshot buffer.
- *  
- *  @param src_buffer     Mac framebuffer (may be packed or 8-bit)
- *  @param tile_x         Tile column index (0 to TILES_X-1)
- *  @param tile_y         Tile row index (0 to TILES_Y-1)
- *  @param snapshot       Output buffer (TILE_WIDTH * TILE_HEIGHT bytes, always 8-bit indices)
+ *  Render a Mac pixel rectangle from the frame buffer, composite the cursor
+ *  and push it in one DMA transfer (at most TILE_DISPLAY_SIZE display pixels
+ *  square, so it fits a streaming row buffer)
  */
-static void snapshotTile(uint8 *src_buffer, int tile_x, int tile_y, uint8 *snapshot)
+static void pushCursorRect(uint8 *src_buffer, const uint32 *doubled_palette, int x0, int y0, int x1, int y1)
 {
-    int src_start_x = tile_x * TILE_WIDTH;
-    int src_start_y = tile_y * TILE_HEIGHT;
-    
-    // Get current depth and bytes per row (volatile, so copy locally)
     video_depth depth = current_depth;
     uint32 bpr = current_bytes_per_row;
-    
-    // Copy and decode each row of the tile to the contiguous snapshot buffer
-    uint8 *dst = snapshot;
-    
-    if (depth == VDEPTH_8BIT) {
-        // 8-bit mode: direct copy, no decoding needed
-        for (int row = 0; row < TILE_HEIGHT; row++) {
-            uint8 *src = src_buffer + (src_start_y + row) * bpr + src_start_x;
-            memcpy(dst, src, TILE_WIDTH);
-            dst += TILE_WIDTH;
-        }
-    } else {
-        // Packed mode: need to decode pixels
-        // For each row, extract the tile's pixel range from the packed source
-        for (int row = 0; row < TILE_HEIGHT; row++) {
-            uint8 *src_row = src_buffer + (src_start_y + row) * bpr;
-            
-            // Decode TILE_WIDTH pixels starting at src_start_x
-            for (int x = 0; x < TILE_WIDTH; x++) {
-                int pixel_x = src_start_x + x;
-                
-                switch (depth) {
-                    case VDEPTH_1BIT: {
-                        int byte_idx = pixel_x / 8;
-                        int bit_idx = 7 - (pixel_x % 8);
-                        *dst++ = (src_row[byte_idx] >> bit_idx) & 0x01;
-                        break;
-                    }
-                    case VDEPTH_2BIT: {
-                        int byte_idx = pixel_x / 4;
-                        int shift = 6 - ((pixel_x % 4) * 2);
-                        *dst++ = (src_row[byte_idx] >> shift) & 0x03;
-                        break;
-                    }
-                    case VDEPTH_4BIT: {
-                        int byte_idx = pixel_x / 2;
-                        int shift = (pixel_x % 2 == 0) ? 4 : 0;
-                        *dst++ = (src_row[byte_idx] >> shift) & 0x0F;
-                        break;
-                    }
-                    default:
-                        *dst++ = src_row[pixel_x];
-                        break;
-                }
-            }
+    int scale = current_scale;
+    int width = (x1 - x0) * scale;
+    int height = (y1 - y0) * scale;
+    uint16 *out = streaming_row_buffer_a;
+    
+    for (int y = y0; y < y1; y++) {
+        const uint8 *src = src_buffer + y * bpr + ((x0 << depth) >> 3);
+        if (scale == 1) {
+            VideoRenderRow1x(src, out, x1 - x0, depth, doubled_palette);
+        } else {
+            VideoRenderRow2x(src, out, x1 - x0, depth, doubled_palette);
+            VideoRepeatRow(out, out + width, width);
         }
+        out += width * scale;
     }
-}
-
-/*
- *  Render a tile from a contiguous snapshot buffer (not from framebuffer)
- *  This ensures we render from consistent data that won't change mid-render.
- *  
- *  @param snapshot        Tile snapshot buffer (TILE_WIDTH * TILE_HEIGHT bytes, contiguous)
- *  @param local_palette   Pre-copied palette for thread safety
- *  @param out_buffer      Output buffer for RGB565 pixels
- */
-static void renderTileFromSnapshot(uint8 *snapshot, uint16 *local_palette, uint16 *out_buffer)
-{
-    int tile_pixel_width = TILE_WIDTH * PIXEL_SCALE;  // 80 pixels
-    
-    uint8 *src = snapshot;
-    uint16 *out = out_buffer;
+    VideoCursorComposite(&frame_cursor, scale, streaming_row_buffer_a, width, x0 * scale, y0 * scale,
+                         width, height);
     
-    // Process each row of the Mac tile
-    for (int row = 0; row < TILE_HEIGHT; row++) {
-        // Output row pointers (two rows for 2x vertical scaling)
-        uint16 *dst_row0 = out;
-        uint16 *dst_row1 = out + tile_pixel_width;
-        
-        // Process 4 pixels at a time for better memory bandwidth
-        int x = 0;
-        for (; x < TILE_WIDTH - 3; x += 4) {
-            // Read 4 source pixels at once (32-bit read)
-            uint32 src4 = *((uint32 *)src);
-            src += 4;
-            
-            // Convert each pixel through palette and write 2x2 scaled
-            uint16 c0 = local_palette[src4 & 0xFF];
-            uint16 c1 = local_palette[(src4 >> 8) & 0xFF];
-            uint16 c2 = local_palette[(src4 >> 16) & 0xFF];
-            uint16 c3 = local_palette[(src4 >> 24) & 0xFF];
-            
-            // Write to row 0 (2 pixels per source pixel)
-            dst_row0[0] = c0; dst_row0[1] = c0;
-            dst_row0[2] = c1; dst_row0[3] = c1;
-            dst_row0[4] = c2; dst_row0[5] = c2;
-            dst_row0[6] = c3; dst_row0[7] = c3;
-            
-            // Write to row 1 (duplicate of row 0)
-            dst_row1[0] = c0; dst_row1[1] = c0;
-            dst_row1[2] = c1; dst_row1[3] = c1;
-            dst_row1[4] = c2; dst_row1[5] = c2;
-            dst_row1[6] = c3; dst_row1[7] = c3;
-            
-            dst_row0 += 8;
-            dst_row1 += 8;
-        }
-        
-        // Handle remaining pixels (TILE_WIDTH=40 is divisible by 4, so this rarely runs)
-        for (; x < TILE_WIDTH; x++) {
-            uint16 c = local_palette[*src++];
-            dst_row0[0] = c; dst_row0[1] = c;
-            dst_row1[0] = c; dst_row1[1] = c;
-            dst_row0 += 2;
-            dst_row1 += 2;
-        }
-        
-        // Move output pointer by 2 rows (2x vertical scaling)
-        out += tile_pixel_width * 2;
-    }
+    M5.Display.startWrite();
+    M5.Display.setAddrWindow(x0 * scale, y0 * scale, width, height);
+    M5.Display.writePixelsDMA(streaming_row_buffer_a, width * height);
+    M5.Display.waitDMA();
+    M5.Display.endWrite();
+    perf_dma_count++;
+    perf_dma_bytes += width * height * sizeof(uint16);
 }
 
 /*
- *  Render and push only dirty tiles to the display
- *  RACE-CONDITION FIX: Uses per-tile render lock and double-buffered DMA.
- *  
- *  This prevents visual glitches (especially around the mouse cursor) caused by
- *  the CPU writing to the framebuffer while we're reading it:
- *  1. Set tile_render_active before snapshot
- *  2. If CPU writes during snapshot, tile is re-marked dirty for next frame
- *  3. Double-buffered output allows DMA overlap with rendering
- *  
- *  @param src_buffer     Mac framebuffer (8-bit indexed)
- *  @param local_palette  Pre-copied palette for thread safety
+ *  Move the cursor on the display: restore the pixels under shown_cursor
+ *  and draw frame_cursor. Nearby positions (any move within a frame at
+ *  normal mouse speeds) are covered by one rectangle, so a move is a
+ *  single small DMA instead of redrawing the 2-4 tiles QuickDraw dirtied.
  */
-static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
+static void pushCursorOverlay(uint8 *src_buffer, const uint32 *doubled_palette)
 {
-    // Double-buffered tile snapshot buffers (40x40 = 1600 bytes each)
-    // Static to avoid stack allocation on each call
-    // In internal SRAM for fast access during partial updates
-    DRAM_ATTR static uint8 tile_snapshot_a[TILE_WIDTH * TILE_HEIGHT];
-    DRAM_ATTR static uint8 tile_snapshot_b[TILE_WIDTH * TILE_HEIGHT];
-    
-    // Double-buffered RGB565 output buffers (80x80 = 12,800 bytes each)
-    // In internal SRAM for fast access during partial updates
-    DRAM_ATTR static uint16 tile_buffer_a[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE];
-    DRAM_ATTR static uint16 tile_buffer_b[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE];
-    
-    // Buffer pointers for double-buffering
-    uint8 *current_snapshot = tile_snapshot_a;
-    uint8 *next_snapshot = tile_snapshot_b;
-    uint16 *current_buffer = tile_buffer_a;
-    uint16 *next_buffer = tile_buffer_b;
-    
-    int tile_pixel_width = TILE_WIDTH * PIXEL_SCALE;
-    int tile_pixel_height = TILE_HEIGHT * PIXEL_SCALE;
-    int tiles_rendered = 0;
-    bool dma_pending = false;
-    
-    M5.Display.startWrite();
+    if (!src_buffer) return;
     
-    for (int ty = 0; ty < TILES_Y; ty++) {
-        for (int tx = 0; tx < TILES_X; tx++) {
-            int tile_idx = ty * TILES_X + tx;
-            
-            // Skip tiles that aren't dirty
-            if (!isTileDirty(tile_idx)) {
-                continue;
-            }
-            
-            // STEP 1: Mark tile as being rendered (prevents CPU from tearing)
-            setTileRenderActive(tile_idx);
-            
-            // STEP 2: Take a mini-snapshot of just this tile
-            // While render_active is set, CPU writes will re-mark tile dirty
-            snapshotTile(src_buffer, tx, ty, current_snapshot);
-            
-            // STEP 3: Clear render lock - snapshot is complete
-            // Any CPU writes after this point will be visible in next frame
-            clearTileRenderActive(tile_idx);
-            
-            // Memory barrier to ensure snapshot is complete before rendering
-            __sync_synchronize();
-            
-            // STEP 4: Render from the snapshot (not from the live framebuffer)
-            renderTileFromSnapshot(current_snapshot, local_palette, current_buffer);
-            
-            // STEP 5: Wait for any pending DMA before using its buffer
-            if (dma_pending) {
-                M5.Display.waitDMA();
-                dma_pending = false;
-            }
-            
-            // STEP 6: Push to display using async DMA
-            int dst_start_x = tx * tile_pixel_width;
-            int dst_start_y = ty * tile_pixel_height;
-            
-            M5.Display.setAddrWindow(dst_start_x, dst_start_y, tile_pixel_width, tile_pixel_height);
-            M5.Display.writePixelsDMA(current_buffer, tile_pixel_width * tile_pixel_height);
-            dma_pending = true;
-            
-            // STEP 7: Swap buffers for next tile
-            // This allows rendering next tile while DMA pushes current
-            uint8 *tmp_snap = current_snapshot;
-            current_snapshot = next_snapshot;
-            next_snapshot = tmp_snap;
-            
-            uint16 *tmp_buf = current_buffer;
-            current_buffer = next_buffer;
-            next_buffer = tmp_buf;
-            
-            tiles_rendered++;
-            
-            // Every 8 tiles, yield to let other tasks run
-            // This prevents starvation during full-screen updates
-            if ((tiles_rendered & 0x07) == 0) {
-                taskYIELD();
-            }
+    int ox0, oy0, ox1, oy1, nx0, ny0, nx1, ny1;
+    bool old_rect = shown_cursor.visible && cursorRect(&shown_cursor, ox0, oy0, ox1, oy1);
+    bool new_rect = frame_cursor.visible && cursorRect(&frame_cursor, nx0, ny0, nx1, ny1);
+    
+    if (old_rect && new_rect) {
+        int x0 = ox0 < nx0 ? ox0 : nx0, y0 = oy0 < ny0 ? oy0 : ny0;
+        int x1 = ox1 > nx1 ? ox1 : nx1, y1 = oy1 > ny1 ? oy1 : ny1;
+        int scale = current_scale;
+        if ((x1 - x0) * scale <= TILE_DISPLAY_SIZE && (y1 - y0) * scale <= TILE_DISPLAY_SIZE) {
+            pushCursorRect(src_buffer, doubled_palette, x0, y0, x1, y1);
+            old_rect = new_rect = false;
         }
     }
-    
-    // Wait for final DMA to complete before ending write session
-    if (dma_pending) {
-        M5.Display.waitDMA();
-    }
-    
-    M5.Display.endWrite();
+    if (old_rect)
+        pushCursorRect(src_buffer, doubled_palette, ox0, oy0, ox1, oy1);
+    if (new_rect)
+        pushCursorRect(src_buffer, doubled_palette, nx0, ny0, nx1, ny1);
+    perf_cursor_count++;
 }
+#endif
 
 /*
  *  Render frame buffer directly to display using streaming (no intermediate PSRAM buffer)
@@ -914,19 +659,19 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
  *  PSRAM traffic: ~230KB read (mac_frame_buffer only)
  *  vs old method: ~230KB read + 1.8MB write + 1.8MB read = ~3.8MB
  *  
- *  Supports all bit depths (1/2/4/8-bit) by decoding packed pixels first.
+ *  Supports all bit depths (1/2/4/8-bit); packed pixels are unpacked by the
+ *  render kernel.
  */
-static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
+static void renderFrameStreaming(uint8 *src_buffer, const uint32 *doubled_palette)
 {
     if (!src_buffer) return;
     
     // Get current depth and bytes per row (volatile, so copy locally)
     video_depth depth = current_depth;
     uint32 bpr = current_bytes_per_row;
-    
-    // Row decode buffer for packed pixel modes
-    // In internal SRAM for fast access during rendering
-    DRAM_ATTR static uint8 decoded_row[MAC_SCREEN_WIDTH];
+    int width = current_width, height = current_height;
+    int scale = current_scale;
+    int chunk_rows = STREAMING_ROW_COUNT / scale;     // Mac rows per chunk
     
     // Track if we have a pending DMA transfer
     bool dma_pending = false;
@@ -934,73 +679,28 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
     
     M5.Display.startWrite();
     
-    // Process 4 Mac rows at a time (produces 8 display rows with 2x scaling)
+    // Process 8 display rows at a time (4 Mac rows with 2x scaling, 8 at 1:1)
     // Double-buffering: render to one buffer while DMA pushes the other
-    for (int mac_y = 0; mac_y < MAC_SCREEN_HEIGHT; mac_y += 4) {
+    for (int mac_y = 0; mac_y < height; mac_y += chunk_rows) {
         uint16 *out = render_buffer;
         
-        // Process 4 Mac rows into render_buffer
-        for (int row_offset = 0; row_offset < 4; row_offset++) {
+        // Process the chunk's Mac rows into render_buffer
+        for (int row_offset = 0; row_offset < chunk_rows; row_offset++) {
             int y = mac_y + row_offset;
-            if (y >= MAC_SCREEN_HEIGHT) break;
+            if (y >= height) break;
             
-            // Get source row pointer
+            // Unpack (packed modes), convert and scale the row in one pass,
+            // then repeat it for the second display row
             uint8 *src_row = src_buffer + y * bpr;
-            
-            // Decode the row if needed (converts packed pixels to 8-bit indices)
-            uint8 *pixel_row;
-            if (depth == VDEPTH_8BIT) {
-                // 8-bit mode: direct access, no decoding needed
-                pixel_row = src_row;
+            if (scale == 1) {
+                VideoRenderRow1x(src_row, out, width, depth, doubled_palette);
             } else {
-                // Packed mode: decode to 8-bit indices
-                decodePackedRow(src_row, decoded_row, MAC_SCREEN_WIDTH, depth);
-                pixel_row = decoded_row;
-            }
-            
-            // Output row pointers for the two scaled display rows
-            uint16 *dst_row0 = out;
-            uint16 *dst_row1 = out + DISPLAY_WIDTH;
-            
-            // Process 4 decoded pixels at a time for better memory bandwidth
-            int x = 0;
-            for (; x < MAC_SCREEN_WIDTH - 3; x += 4) {
-                // Read 4 decoded pixels at once (32-bit read from 8-bit indices)
-                uint32 src4 = *((uint32 *)(pixel_row + x));
-                
-                // Convert each pixel through palette and write 2x2 scaled
-                uint16 c0 = local_palette[src4 & 0xFF];
-                uint16 c1 = local_palette[(src4 >> 8) & 0xFF];
-                uint16 c2 = local_palette[(src4 >> 16) & 0xFF];
-                uint16 c3 = local_palette[(src4 >> 24) & 0xFF];
-                
-                // Write to row 0 (2 pixels per source pixel)
-                dst_row0[0] = c0; dst_row0[1] = c0;
-                dst_row0[2] = c1; dst_row0[3] = c1;
-                dst_row0[4] = c2; dst_row0[5] = c2;
-                dst_row0[6] = c3; dst_row0[7] = c3;
-                
-                // Write to row 1 (duplicate of row 0)
-                dst_row1[0] = c0; dst_row1[1] = c0;
-                dst_row1[2] = c1; dst_row1[3] = c1;
-                dst_row1[4] = c2; dst_row1[5] = c2;
-                dst_row1[6] = c3; dst_row1[7] = c3;
-                
-                dst_row0 += 8;
-                dst_row1 += 8;
-            }
-            
-            // Handle remaining pixels (if width not divisible by 4)
-            for (; x < MAC_SCREEN_WIDTH; x++) {
-                uint16 c = local_palette[pixel_row[x]];
-                dst_row0[0] = c; dst_row0[1] = c;
-                dst_row1[0] = c; dst_row1[1] = c;
-                dst_row0 += 2;
-                dst_row1 += 2;
+                VideoRenderRow2x(src_row, out, width, depth, doubled_palette);
+                VideoRepeatRow(out, out + DISPLAY_WIDTH, DISPLAY_WIDTH);
             }
             
-            // Move output pointer by 2 display rows (2x vertical scaling)
-            out += DISPLAY_WIDTH * 2;
+            // Move output pointer by the display rows of one Mac row
+            out += DISPLAY_WIDTH * scale;
         }
         
         // Wait for any pending DMA transfer to complete before swapping buffers
@@ -1016,7 +716,7 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
         
         // Start async DMA push of the just-rendered buffer (now in push_buffer)
         // 8 display rows * 1280 pixels = 10240 pixels per chunk
-        int display_y = mac_y * PIXEL_SCALE;
+        int display_y = mac_y * scale;
         M5.Display.setAddrWindow(0, display_y, DISPLAY_WIDTH, STREAMING_ROW_COUNT);
         M5.Display.writePixelsDMA(push_buffer, DISPLAY_WIDTH * STREAMING_ROW_COUNT);
         dma_pending = true;
@@ -1070,6 +770,28 @@ static void reportVideoPerfStats(void)
             Serial.printf("[VIDEO PERF] avg: detect=%uus render=%uus\n",
                           perf_detect_us / (total_frames > 0 ? total_frames : 1),
                           perf_render_us / (total_frames > 0 ? total_frames : 1));
+            uint32_t pushed_frames = perf_full_count + perf_partial_count;
+            if (pushed_frames > 0) {
+                Serial.printf("[VIDEO PERF] dma: %u transfers/frame, %u bytes/frame\n",
+                              perf_dma_count / pushed_frames, perf_dma_bytes / pushed_frames);
+            }
+#if USE_TILE_HASH
+            Serial.printf("[VIDEO PERF] skipped-identical=%u tiles\n", perf_identical_count);
+#endif
+#if USE_PALETTE_USAGE
+            Serial.printf("[VIDEO PERF] palette: %u tiles redrawn, %u saved\n",
+                          perf_recolor_count, perf_recolor_saved);
+#endif
+#if USE_HW_CURSOR
+            Serial.printf("[VIDEO PERF] cursor: %u overlay pushes\n", perf_cursor_count);
+#endif
+            Serial.printf("[VIDEO PERF] torn: %u tiles redrawn next frame\n", perf_torn_count);
+            if (perf_pace_frames > 0) {
+                Serial.printf("[VIDEO PERF] pacing: %u frames (%u fast), %u deferred, interval=%uus latency=%uus max=%uus\n",
+                              perf_pace_frames, perf_pace_fast, perf_pace_deferred,
+                              perf_pace_interval_us / perf_pace_frames,
+                              perf_pace_latency_us / perf_pace_frames, perf_pace_latency_max);
+            }
         }
         
         // Reset counters for next interval
@@ -1079,16 +801,63 @@ static void reportVideoPerfStats(void)
         perf_partial_count = 0;
         perf_full_count = 0;
         perf_skip_count = 0;
+        perf_identical_count = 0;
+        perf_dma_count = 0;
+        perf_dma_bytes = 0;
+        perf_recolor_count = 0;
+        perf_recolor_saved = 0;
+        perf_cursor_count = 0;
+        perf_torn_count = 0;
+        perf_pace_frames = 0;
+        perf_pace_fast = 0;
+        perf_pace_deferred = 0;
+        perf_pace_interval_us = 0;
+        perf_pace_latency_us = 0;
+        perf_pace_latency_max = 0;
     }
 }
 
+/*
+ *  Adaptive frame pacing
+ *  
+ *  The render time per dirty tile of each frame feeds a running average.
+ *  A frame with N dirty tiles is expected to take N times that, and starts
+ *  once it would use at most PACE_DUTY_PERCENT of the time since the last
+ *  frame: the cursor, typing or a menu (a few tiles) go out at up to 60 FPS
+ *  as soon as the task sees them, while full screen animation is spaced out
+ *  (down to 15 FPS) so the emulation core keeps most of the PSRAM bandwidth.
+ */
+static uint32 pace_tile_us = PACE_TILE_US_INITIAL;
+
+static uint32 pacingInterval(int tiles)
+{
+    uint32 interval = (uint32)tiles * pace_tile_us * 100 / PACE_DUTY_PERCENT;
+    if (interval < PACE_MIN_FRAME_US) interval = PACE_MIN_FRAME_US;
+    if (interval > PACE_MAX_FRAME_US) interval = PACE_MAX_FRAME_US;
+    return interval;
+}
+
+static void pacingUpdate(uint32 render_us, int tiles)
+{
+    if (tiles <= 0) return;
+    uint32 tile_us = render_us / tiles;
+    pace_tile_us = (pace_tile_us * 3 + tile_us + 3) / 4;
+}
+
+static TickType_t pacingWaitTicks(uint32 us)
+{
+    TickType_t ticks = pdMS_TO_TICKS((us + 999) / 1000);
+    return ticks > 0 ? ticks : 1;
+}
+
 /*
  *  Optimized video rendering task - uses WRITE-TIME dirty tracking
  *  
  *  Key optimizations over the old triple-buffer approach:
  *  1. NO frame snapshot copy - we read directly from mac_frame_buffer
  *  2. NO per-frame comparison - dirty tiles are marked at write time by memory.cpp
- *  3. Event-driven with timeout - wakes on notification OR after 67ms max
+ *  3. Event-driven with timeout - wakes on notification OR every PACE_POLL_US,
+ *     and paces frames by their predicted cost (pacingInterval())
  *  
  *  This eliminates ~230KB memcpy per frame and expensive tile comparisons.
  *  Dirty tracking overhead is spread across actual CPU writes instead of
@@ -1113,66 +882,116 @@ static void videoRenderTaskOptimized(void *param)
     // Wait a moment for everything to initialize
     vTaskDelay(pdMS_TO_TICKS(100));
     
-    // Local palette copy for thread safety
+    // Local palette copy for thread safety, and its doubled form for the
+    // render kernels (video_render.h)
     uint16 local_palette[256];
+    DRAM_ATTR static uint32 doubled_palette[256];
     
     // Initialize perf reporting timer
     perf_last_report_ms = millis();
     
-    // Minimum frame interval (42ms = ~24 FPS)
-    // 24fps is cinema standard and perceptually smooth
-    const TickType_t min_frame_ticks = pdMS_TO_TICKS(42);
-    TickType_t last_frame_ticks = xTaskGetTickCount();
+    // Frame pacing state (pacingInterval())
+    uint32 last_frame_us = micros() - PACE_MAX_FRAME_US;
+    uint32 damage_since_us = 0;     // First damage not yet on the display
+    bool damage_pending = false;
+    TickType_t wait_ticks = pacingWaitTicks(PACE_POLL_US);
     
     while (video_task_running) {
         // Note: Watchdog is configured with 10s timeout and no panic,
         // so we don't need to reset it frequently
         
         // Event-driven: wait for frame signal with timeout
-        // This replaces the old polling loop - task sleeps until signaled
-        // Max wait time ensures we still render periodically even if no signal
-        uint32_t notification = ulTaskNotifyTake(pdTRUE, min_frame_ticks);
-        
-        // Also check legacy frame_ready flag for compatibility
-        bool should_render = (notification > 0) || frame_ready;
+        // The timeout polls for damage while idle, or ends a pacing delay
+        ulTaskNotifyTake(pdTRUE, wait_ticks);
         frame_ready = false;
+        wait_ticks = pacingWaitTicks(PACE_POLL_US);
         
-        // Rate limit: ensure minimum time between frames
-        TickType_t now = xTaskGetTickCount();
-        TickType_t elapsed = now - last_frame_ticks;
-        if (should_render && elapsed < min_frame_ticks) {
-            // Too soon - skip this frame signal, we'll render on next timeout
-            continue;
-        }
-        
-        // Only render if we have something to render
-        if (!should_render && !force_full_update) {
-            // Timeout with nothing to do - check for write-dirty tiles anyway
-            // This handles cases where writes happened but no explicit signal
-        }
+        // Report performance stats periodically
+        reportVideoPerfStats();
         
         uint32_t t0, t1;
         
         // Take a snapshot of the palette only if it changed (thread-safe)
         // This avoids 512-byte memcpy and spinlock contention on every frame
         if (palette_changed) {
+#if USE_PALETTE_USAGE
+            uint32 changed[PALETTE_WORDS];
+#endif
             portENTER_CRITICAL(&frame_spinlock);
             memcpy(local_palette, palette_rgb565, 256 * sizeof(uint16));
+#if USE_PALETTE_USAGE
+            memcpy(changed, palette_changed_indices, sizeof(changed));
+            memset(palette_changed_indices, 0, sizeof(palette_changed_indices));
+#endif
             palette_changed = false;
             portEXIT_CRITICAL(&frame_spinlock);
+            VideoDoublePalette(local_palette, doubled_palette, 256);
+#if USE_PALETTE_USAGE
+            // Only tiles using a changed entry need new colors
+            markRecolorTiles(changed);
+#endif
         }
         
-        // Collect dirty tiles from write-time tracking
+#if USE_HW_CURSOR
+        // The cursor as of this frame (stays hidden until the patches are in)
+        if (CursorInstalled()) {
+            VideoCursorRead(&frame_cursor);
+        }
+#endif
+        
+        // Collect dirty tiles from write-time tracking, on top of any that
+        // pacing held back or that were torn last frame
         t0 = micros();
-        dirty_tile_count = collectWriteDirtyTiles();
+        uint32 collected[TILE_WORDS];
+        VideoDirtyCollect(collected);
+        dirty_tile_count = 0;
+        for (int i = 0; i < TILE_WORDS; i++) {
+            dirty_tiles[i] |= collected[i] | tile_state.torn[i];
+#if USE_PALETTE_USAGE
+            dirty_tiles[i] |= recolor_tiles[i];
+#endif
+            dirty_tile_count += __builtin_popcount(dirty_tiles[i]);
+        }
         t1 = micros();
         perf_detect_us += (t1 - t0);
         
+        bool redraw_all = force_full_update;
+        bool cursor_moved = false;
+#if USE_HW_CURSOR
+        cursor_moved = frame_cursor.seq != shown_cursor.seq;
+#endif
+        if (dirty_tile_count == 0 && !redraw_all && !cursor_moved) {
+            // No tiles dirty, nothing to do!
+            perf_skip_count++;
+            continue;
+        }
+        if (!damage_pending) {
+            damage_pending = true;
+            damage_since_us = t0;
+        }
+        
+        // Pace: wait until this much damage may be rendered
+        uint32 interval = pacingInterval(redraw_all ? TOTAL_TILES : dirty_tile_count);
+        uint32 since_last = t1 - last_frame_us;
+        if (since_last < interval) {
+#if USE_HW_CURSOR
+            // The cursor does not wait for the tiles
+            if (cursor_moved) {
+                pushCursorOverlay(mac_frame_buffer, doubled_palette);
+                shown_cursor = frame_cursor;
+            }
+#endif
+            perf_pace_deferred++;
+            wait_ticks = pacingWaitTicks(interval - since_last);
+            continue;
+        }
+        last_frame_us = t1;
+        
         // If force_full_update is set (palette change, first frame), mark ALL tiles dirty
         // This ensures we always use tile mode (faster than streaming mode)
-        if (force_full_update) {
+        if (redraw_all) {
             // Mark all tiles as dirty
-            for (int i = 0; i < (TOTAL_TILES + 31) / 32; i++) {
+            for (int i = 0; i < TILE_WORDS; i++) {
                 dirty_tiles[i] = 0xFFFFFFFF;
             }
             dirty_tile_count = TOTAL_TILES;
@@ -1184,21 +1003,36 @@ static void videoRenderTaskOptimized(void *param)
         if (dirty_tile_count > 0) {
             // Render and push only dirty tiles
             t0 = micros();
-            renderAndPushDirtyTiles(mac_frame_buffer, local_palette);
+            renderAndPushDirtyTiles(mac_frame_buffer, doubled_palette, redraw_all);
+#if USE_PALETTE_USAGE
+            memset(recolor_tiles, 0, sizeof(recolor_tiles));
+#endif
             t1 = micros();
             perf_render_us += (t1 - t0);
+            pacingUpdate(t1 - t0, dirty_tile_count);
             
             perf_partial_count++;
-        } else {
-            // No tiles dirty, nothing to do!
-            perf_skip_count++;
         }
+        memset(dirty_tiles, 0, sizeof(dirty_tiles));
         
-        perf_frame_count++;
-        last_frame_ticks = now;
+#if USE_HW_CURSOR
+        // Cursor moved, changed shape or visibility: one small push
+        if (cursor_moved) {
+            pushCursorOverlay(mac_frame_buffer, doubled_palette);
+            shown_cursor = frame_cursor;
+        }
+#endif
         
-        // Report performance stats periodically
-        reportVideoPerfStats();
+        // Damage to display latency, and whether this was a 60 FPS frame
+        uint32 latency = micros() - damage_since_us;
+        damage_pending = false;
+        perf_pace_frames++;
+        if (interval == PACE_MIN_FRAME_US) perf_pace_fast++;
+        perf_pace_interval_us += interval;
+        perf_pace_latency_us += latency;
+        if (latency > perf_pace_latency_max) perf_pace_latency_max = latency;
+        
+        perf_frame_count++;
     }
     
     Serial.println("[VIDEO] Video render task exiting");
@@ -1225,10 +1059,61 @@ bool VideoInit(bool classic)
                       DISPLAY_WIDTH, DISPLAY_HEIGHT, display_width, display_height);
     }
     
-    // Allocate Mac frame buffer in PSRAM
-    // For 640x360 @ 8-bit = 230,400 bytes
-    frame_buffer_size = MAC_SCREEN_WIDTH * MAC_SCREEN_HEIGHT;
+    // Build the mode list. Per Basilisk II rules: lowest depth must be
+    // available in all resolutions, and if a resolution has a depth, it must
+    // have all lower depths too.
+    // 640x360 always has 1/2/4/8 bit depths and 16-bit (Thousands). 1280x720
+    // gets each depth whose frame buffer fits in the PSRAM left after the
+    // Mac RAM (AllocateRAM() runs first), minus VIDEO_PSRAM_RESERVE:
+    // 115KB at 1-bit, 921KB at 8-bit, 1.8MB at 16-bit.
+    size_t psram_free = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    size_t budget = psram_free > VIDEO_PSRAM_RESERVE ? psram_free - VIDEO_PSRAM_RESERVE : 0;
+    Serial.printf("[VIDEO] Frame buffer budget: %u bytes (largest free PSRAM block %u)\n",
+                  (unsigned)budget, (unsigned)psram_free);
+    
+    vector<video_mode> modes;
+    video_mode mode;
+    mode.user_data = 0;
+    frame_buffer_size = 0;
+    for (int r = 0; r < (int)NUM_RESOLUTIONS; r++) {
+        const screen_resolution &res = screen_resolutions[r];
+        mode.x = res.width;
+        mode.y = res.height;
+        mode.resolution_id = res.id;
+        for (int d = VDEPTH_1BIT; d <= VDEPTH_16BIT; d++) {
+            mode.depth = (video_depth)d;
+            mode.bytes_per_row = TrivialBytesPerRow(res.width, mode.depth);
+            uint32 size = mode.bytes_per_row * res.height;
+            if (r > 0 && size > budget) {
+                break;
+            }
+            modes.push_back(mode);
+            if (size > frame_buffer_size) {
+                frame_buffer_size = size;
+            }
+            Serial.printf("[VIDEO] Added mode: %dx%d %d-bit, %d bytes/row\n",
+                          res.width, res.height, 1 << d, mode.bytes_per_row);
+        }
+    }
+    
+    // Default: 8-bit at the resolution named by the "screen" preference
+    // (win/<w>/<h>) if it was registered, else at 640x360
+    int pref_width = 0, pref_height = 0;
+    const char *screen_str = PrefsFindString("screen");
+    if (screen_str) {
+        sscanf(screen_str, "win/%d/%d", &pref_width, &pref_height);
+    }
+    for (size_t i = 0; i < modes.size(); i++) {
+        bool preferred = (int)modes[i].x == pref_width && (int)modes[i].y == pref_height;
+        if (modes[i].depth == VDEPTH_8BIT &&
+            (modes[i].resolution_id == screen_resolutions[0].id || preferred)) {
+            current_mode = modes[i];
+        }
+    }
+    uint32 default_id = current_mode.resolution_id;
     
+    // Allocate Mac frame buffer in PSRAM, sized for the largest mode
+    // For 640x360 @ 16-bit = 460,800 bytes, 1280x720 @ 16-bit = 1,843,200
     mac_frame_buffer = (uint8 *)ps_malloc(frame_buffer_size);
     if (!mac_frame_buffer) {
         Serial.println("[VIDEO] ERROR: Failed to allocate Mac frame buffer in PSRAM!");
@@ -1240,14 +1125,14 @@ bool VideoInit(bool classic)
     // Clear frame buffer to gray
     memset(mac_frame_buffer, 0x80, frame_buffer_size);
     
-    // Initialize dirty tracking and render lock
+    // Initialize dirty tracking
     memset(dirty_tiles, 0, sizeof(dirty_tiles));
-    memset(write_dirty_tiles, 0, sizeof(write_dirty_tiles));
-    memset(tile_render_active, 0, sizeof(tile_render_active));
+    VideoDirtyReset();
+    memset(tile_state.torn, 0, sizeof(tile_state.torn));
     force_full_update = true;  // Force full update on first frame
     
     // Clear display to dark gray using streaming row buffer
-    uint16 gray565 = rgb888_to_rgb565(64, 64, 64);
+    uint16 gray565 = VideoRGB565(64, 64, 64);
     for (int i = 0; i < DISPLAY_WIDTH * STREAMING_ROW_COUNT; i++) {
         streaming_row_buffer_a[i] = gray565;
     }
@@ -1269,49 +1154,11 @@ bool VideoInit(bool classic)
     // so MacOS will default to "256 colors" instead of "256 grays"
     initDefaultPalette(VDEPTH_8BIT);
     
-    // Create video mode vector with all supported depths
-    // Per Basilisk II rules: lowest depth must be available in all resolutions,
-    // and if a resolution has a depth, it must have all lower depths too.
-    // We support 1/2/4/8 bit depths at 640x360.
-    vector<video_mode> modes;
-    video_mode mode;
-    mode.x = MAC_SCREEN_WIDTH;
-    mode.y = MAC_SCREEN_HEIGHT;
-    mode.resolution_id = 0x80;
-    mode.user_data = 0;
-    
-    // Add 1-bit mode (black and white)
-    mode.depth = VDEPTH_1BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_1BIT);  // 80 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 1-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Add 2-bit mode (4 colors)
-    mode.depth = VDEPTH_2BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_2BIT);  // 160 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 2-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Add 4-bit mode (16 colors)
-    mode.depth = VDEPTH_4BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_4BIT);  // 320 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 4-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Add 8-bit mode (256 colors) - this is our default
-    mode.depth = VDEPTH_8BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_8BIT);  // 640 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 8-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Store current mode info (8-bit default)
-    current_mode = mode;
-    
-    // Initialize the video state cache for 8-bit mode
-    updateVideoStateCache(VDEPTH_8BIT, mode.bytes_per_row);
+    // Initialize the video state cache for the default mode
+    updateVideoStateCache(current_mode.x, current_mode.y, VDEPTH_8BIT, current_mode.bytes_per_row);
     
     // Create monitor descriptor with 8-bit as default depth
-    the_monitor = new ESP32_monitor_desc(modes, VDEPTH_8BIT, 0x80);
+    the_monitor = new ESP32_monitor_desc(modes, VDEPTH_8BIT, default_id);
     VideoMonitors.push_back(the_monitor);
     
     // Set Mac frame buffer base address
@@ -1355,10 +1202,10 @@ void VideoExit(void)
     // Stop video task first
     stopVideoTask();
     
-    // Clear dirty tracking and render lock (safety for potential re-init)
+    // Clear dirty tracking (safety for potential re-init)
     memset(dirty_tiles, 0, sizeof(dirty_tiles));
-    memset(write_dirty_tiles, 0, sizeof(write_dirty_tiles));
-    memset(tile_render_active, 0, sizeof(tile_render_active));
+    VideoDirtyReset();
+    memset(tile_state.torn, 0, sizeof(tile_state.torn));
     
     if (mac_frame_buffer) {
         free(mac_frame_buffer);
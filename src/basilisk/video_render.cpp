@@ -0,0 +1,295 @@
+/*
+ *  video_render.cpp - Palette conversion and 2x scaling kernels
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Shared by the ESP32 display driver and the host build, see video_render.h.
+ */
+
+#include "sysdeps.h"
+#include "video.h"
+#include "video_render.h"
+
+#ifdef ARDUINO
+#include "esp_attr.h"
+#endif
+
+/*
+ *  Default palettes (classic Mac convention: index 0 = white, highest
+ *  index = black)
+ *  - 1-bit: Black and white (standard Mac B&W)
+ *  - 2-bit: 4-color grayscale (white, light gray, dark gray, black)
+ *  - 4-bit: Classic Mac 16-color palette
+ *  - 8-bit: 6x6x6 color cube + grayscale ramp
+ */
+void VideoDefaultPalette(video_depth depth, uint16 *palette)
+{
+    switch (depth) {
+        case VDEPTH_1BIT:
+            palette[0] = VideoRGB565(255, 255, 255);    // White
+            palette[1] = VideoRGB565(0, 0, 0);          // Black
+            break;
+
+        case VDEPTH_2BIT:
+            palette[0] = VideoRGB565(255, 255, 255);    // White
+            palette[1] = VideoRGB565(170, 170, 170);    // Light gray
+            palette[2] = VideoRGB565(85, 85, 85);       // Dark gray
+            palette[3] = VideoRGB565(0, 0, 0);          // Black
+            break;
+
+        case VDEPTH_4BIT: {
+            // The standard Mac 16-color CLUT
+            static const uint8 mac16[16][3] = {
+                {255, 255, 255},  // 0: White
+                {255, 255, 0},    // 1: Yellow
+                {255, 102, 0},    // 2: Orange
+                {221, 0, 0},      // 3: Red
+                {255, 0, 153},    // 4: Magenta
+                {51, 0, 153},     // 5: Purple
+                {0, 0, 204},      // 6: Blue
+                {0, 153, 255},    // 7: Cyan
+                {0, 170, 0},      // 8: Green
+                {0, 102, 0},      // 9: Dark Green
+                {102, 51, 0},     // 10: Brown
+                {153, 102, 51},   // 11: Tan
+                {187, 187, 187},  // 12: Light Gray
+                {136, 136, 136},  // 13: Medium Gray
+                {68, 68, 68},     // 14: Dark Gray
+                {0, 0, 0}         // 15: Black
+            };
+            for (int i = 0; i < 16; i++)
+                palette[i] = VideoRGB565(mac16[i][0], mac16[i][1], mac16[i][2]);
+            break;
+        }
+
+        case VDEPTH_16BIT:
+            // Thousands: direct color, the palette is not used
+            break;
+
+        case VDEPTH_8BIT:
+        default: {
+            // 6 levels each of R, G, B (0, 51, ... 255), then 40 grays
+            int idx = 0;
+            for (int r = 0; r < 6; r++)
+                for (int g = 0; g < 6; g++)
+                    for (int b = 0; b < 6; b++)
+                        palette[idx++] = VideoRGB565(r * 51, g * 51, b * 51);
+            for (int i = 0; i < 40; i++) {
+                uint8 gray = (i * 255) / 39;
+                palette[idx++] = VideoRGB565(gray, gray, gray);
+            }
+            break;
+        }
+    }
+}
+
+void VideoSetPalette(const uint8 *pal, int num, uint16 *palette, uint32 *changed)
+{
+    if (num > 256)
+        num = 256;
+    for (int i = 0; i < num; i++) {
+        uint16 color = VideoRGB565(pal[i * 3], pal[i * 3 + 1], pal[i * 3 + 2]);
+        if (changed && color != palette[i])
+            changed[i >> 5] |= 1u << (i & 31);
+        palette[i] = color;
+    }
+}
+
+void VideoDoublePalette(const uint16 *palette, uint32 *doubled, int count)
+{
+    for (int i = 0; i < count; i++)
+        doubled[i] = VideoDoublePixel(palette[i]);
+}
+
+/*
+ *  MurmurHash3 block mixing, one word per step. Tiles are hashed in the
+ *  frame buffer, where packed tile rows may be unaligned and end in a
+ *  partial word (10 bytes at 1-bit); still far cheaper than converting
+ *  and pushing the tile.
+ */
+static inline uint32 rotl32(uint32 x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+static inline uint32 hashMix(uint32 h, uint32 k)
+{
+    k *= 0xcc9e2d51;
+    k = rotl32(k, 15) * 0x1b873593;
+    return rotl32(h ^ k, 13) * 5 + 0xe6546b64;
+}
+
+uint32 VideoHashTile(const uint8 *src, uint32 stride, int row_bytes, int rows)
+{
+    uint32 h = 0;
+    bool aligned = (((uintptr_t)src | stride | row_bytes) & 3) == 0;
+    for (int row = 0; row < rows; row++) {
+        const uint8 *p = src + row * stride;
+        if (aligned) {
+            const uint32 *w = (const uint32 *)p;
+            for (int i = 0; i < row_bytes / 4; i++)
+                h = hashMix(h, w[i]);
+            continue;
+        }
+        int i = 0;
+        for (; i + 4 <= row_bytes; i += 4) {
+            uint32 k;
+            memcpy(&k, p + i, 4);
+            h = hashMix(h, k);
+        }
+        if (i < row_bytes) {
+            uint32 k = 0;
+            memcpy(&k, p + i, row_bytes - i);
+            h = hashMix(h, k);
+        }
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    return h;
+}
+
+/*
+ *  Packed pixels, MSB first: each source byte gives 8 / BITS stores
+ */
+template <int BITS>
+static inline void renderPacked2x(const uint8 *src, uint32 *out, int width, const uint32 *doubled)
+{
+    const int ppb = 8 / BITS;
+    const uint32 mask = (1 << BITS) - 1;
+    int x = 0;
+    for (; x + ppb <= width; x += ppb) {
+        uint32 b = *src++;
+        for (int i = 0; i < ppb; i++)
+            out[i] = doubled[(b >> (8 - BITS - i * BITS)) & mask];
+        out += ppb;
+    }
+    // Pixels of a last, partly used byte
+    for (int i = 0; x < width; x++, i++)
+        *out++ = doubled[(*src >> (8 - BITS - i * BITS)) & mask];
+}
+
+void VideoRenderRow2x(const uint8 *src, uint16 *dst, int width, video_depth depth, const uint32 *doubled)
+{
+    uint32 *out = (uint32 *)dst;
+    switch (depth) {
+        case VDEPTH_1BIT:
+            renderPacked2x<1>(src, out, width, doubled);
+            break;
+        case VDEPTH_2BIT:
+            renderPacked2x<2>(src, out, width, doubled);
+            break;
+        case VDEPTH_4BIT:
+            renderPacked2x<4>(src, out, width, doubled);
+            break;
+        case VDEPTH_16BIT: {
+            // Direct color, already in display format (FLAYOUT_BE_565):
+            // only the doubling is left, no palette
+            const uint16 *pixels = (const uint16 *)src;
+            int x = 0;
+            for (; x + 4 <= width; x += 4) {
+                out[0] = VideoDoublePixel(pixels[0]);
+                out[1] = VideoDoublePixel(pixels[1]);
+                out[2] = VideoDoublePixel(pixels[2]);
+                out[3] = VideoDoublePixel(pixels[3]);
+                pixels += 4;
+                out += 4;
+            }
+            for (; x < width; x++)
+                *out++ = VideoDoublePixel(*pixels++);
+            break;
+        }
+        default: {
+            // One index per byte, 4 pixels (16 bytes out) per step
+            int x = 0;
+            for (; x + 4 <= width; x += 4) {
+                out[0] = doubled[src[0]];
+                out[1] = doubled[src[1]];
+                out[2] = doubled[src[2]];
+                out[3] = doubled[src[3]];
+                src += 4;
+                out += 4;
+            }
+            for (; x < width; x++)
+                *out++ = doubled[*src++];
+            break;
+        }
+    }
+}
+
+/*
+ *  Packed pixels at 1:1, one display pixel per Mac pixel
+ */
+template <int BITS>
+static inline void renderPacked1x(const uint8 *src, uint16 *out, int width, const uint32 *doubled)
+{
+    const int ppb = 8 / BITS;
+    const uint32 mask = (1 << BITS) - 1;
+    int x = 0;
+    for (; x + ppb <= width; x += ppb) {
+        uint32 b = *src++;
+        for (int i = 0; i < ppb; i++)
+            out[i] = (uint16)doubled[(b >> (8 - BITS - i * BITS)) & mask];
+        out += ppb;
+    }
+    for (int i = 0; x < width; x++, i++)
+        *out++ = (uint16)doubled[(*src >> (8 - BITS - i * BITS)) & mask];
+}
+
+void VideoRenderRow1x(const uint8 *src, uint16 *dst, int width, video_depth depth, const uint32 *doubled)
+{
+    switch (depth) {
+        case VDEPTH_1BIT:
+            renderPacked1x<1>(src, dst, width, doubled);
+            break;
+        case VDEPTH_2BIT:
+            renderPacked1x<2>(src, dst, width, doubled);
+            break;
+        case VDEPTH_4BIT:
+            renderPacked1x<4>(src, dst, width, doubled);
+            break;
+        case VDEPTH_16BIT:
+            // Already display pixels (FLAYOUT_BE_565)
+            memcpy(dst, src, width * sizeof(uint16));
+            break;
+        default: {
+            // Two pixels per 32-bit store where dst is aligned: the low
+            // half of one doubled entry, the high half of the next
+            int x = 0;
+            if (((uintptr_t)dst & 3) == 0) {
+                uint32 *out = (uint32 *)dst;
+                for (; x + 4 <= width; x += 4) {
+                    out[0] = (doubled[src[0]] & 0xffff) | (doubled[src[1]] & 0xffff0000);
+                    out[1] = (doubled[src[2]] & 0xffff) | (doubled[src[3]] & 0xffff0000);
+                    src += 4;
+                    out += 2;
+                }
+                dst = (uint16 *)out;
+            }
+            for (; x < width; x++)
+                *dst++ = (uint16)doubled[*src++];
+            break;
+        }
+    }
+}
+
+void VideoRepeatRow(const uint16 *src, uint16 *dst, int pixels)
+{
+#if USE_PIE_SIMD && defined(ARDUINO)
+    // 8 pixels per vector load/store pair
+    int blocks = pixels >> 3;
+    if (blocks > 0) {
+        asm volatile(
+            "1:\n"
+            "esp.vld.128.ip q0, %0, 16\n"
+            "esp.vst.128.ip q0, %1, 16\n"
+            "addi %2, %2, -1\n"
+            "bnez %2, 1b\n"
+            : "+r"(src), "+r"(dst), "+r"(blocks)
+            :
+            : "memory");
+    }
+#else
+    memcpy(dst, src, pixels * sizeof(uint16));
+#endif
+}
@@ -0,0 +1,75 @@
+/*
+ *  video_unpack.cpp - Packed pixel (1/2/4-bit) to palette index unpacking
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Host build only, see video_unpack.h.
+ */
+
+#include "sysdeps.h"
+#include "video.h"
+#include "video_unpack.h"
+
+#ifndef ARDUINO
+
+/*
+ *  Byte -> palette indices, leftmost pixel in the lowest address. Filled
+ *  byte by byte, so one word store writes the pixels in frame buffer order
+ *  on either endianness. 3.5KB.
+ */
+static uint32 unpack_1bit[256][2];   // 8 pixels
+static uint32 unpack_2bit[256];      // 4 pixels
+static uint16 unpack_4bit[256];      // 2 pixels
+
+void VideoUnpackInit(void)
+{
+    for (int b = 0; b < 256; b++) {
+        uint8 *p1 = (uint8 *)unpack_1bit[b];
+        for (int i = 0; i < 8; i++)
+            p1[i] = (b >> (7 - i)) & 0x01;
+        uint8 *p2 = (uint8 *)&unpack_2bit[b];
+        for (int i = 0; i < 4; i++)
+            p2[i] = (b >> (6 - i * 2)) & 0x03;
+        uint8 *p4 = (uint8 *)&unpack_4bit[b];
+        p4[0] = b >> 4;
+        p4[1] = b & 0x0f;
+    }
+}
+
+void VideoUnpackRow(const uint8 *src, uint8 *dst, int width, video_depth depth)
+{
+    int x = 0;
+    switch (depth) {
+        case VDEPTH_1BIT: {
+            uint32 *out = (uint32 *)dst;
+            for (; x + 8 <= width; x += 8) {
+                const uint32 *p = unpack_1bit[*src++];
+                out[0] = p[0];
+                out[1] = p[1];
+                out += 2;
+            }
+            break;
+        }
+        case VDEPTH_2BIT: {
+            uint32 *out = (uint32 *)dst;
+            for (; x + 4 <= width; x += 4)
+                *out++ = unpack_2bit[*src++];
+            break;
+        }
+        case VDEPTH_4BIT: {
+            uint16 *out = (uint16 *)dst;
+            for (; x + 2 <= width; x += 2)
+                *out++ = unpack_4bit[*src++];
+            break;
+        }
+        default:
+            memcpy(dst, src, width);
+            return;
+    }
+
+    // Pixels of a last, partly used byte
+    for (int i = 0; x < width; x++, i++)
+        dst[x] = VideoPackedPixel(src, i, depth);
+}
+
+#endif
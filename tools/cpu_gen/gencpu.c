@@ -55,6 +55,10 @@ static int using_prefetch;
 static int using_exception_3;
 static int cpu_level;
 
+/* Emit lazyflag_* calls for the common flag types instead of computing
+ * C/Z/N/V inline (--lazy-flags, see m68k.h).  */
+static int lazy_flags;
+
 /* For the current opcode, the next lower level that will have different code.
  * Initialized to -1 for each opcode. If it remains unchanged, indicates we
  * are done with that opcode.  */
@@ -63,6 +67,10 @@ static int next_cpu_level;
 static int *opcode_map;
 static int *opcode_next_clev;
 static int *opcode_last_postfix;
+
+/* Handler each opcode gets in op_smalltbl_<postfix> (opcode << 3 | postfix
+ * of the function), -1 if none. Feeds the compact dispatch tables.  */
+static int *stbl_func[5];
 static unsigned long *counts;
 
 static void read_counts (void)
@@ -736,8 +744,64 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
     }
 }
 
+static const char *size_suffix (wordsizes size)
+{
+    switch (size) {
+     case sz_byte: return "b";
+     case sz_word: return "w";
+     case sz_long: return "l";
+     default: abort ();
+    }
+    return "";
+}
+
+static const char *size_cast (wordsizes size)
+{
+    switch (size) {
+     case sz_byte: return "uae_s8";
+     case sz_word: return "uae_s16";
+     case sz_long: return "uae_s32";
+     default: abort ();
+    }
+    return "";
+}
+
+/* Record the operation and its operands, m68k.h computes C/Z/N/V from
+ * them when they are read. The result is still computed here.  */
+static int genflags_lazy (flagtypes type, wordsizes size, char *value, char *src, char *dst)
+{
+    const char *cast = size_cast (size);
+    const char *sfx = size_suffix (size);
+
+    switch (type) {
+     case flag_logical:
+	printf ("\tlazyflag_test%s (%s);\n", sfx, value);
+	return 1;
+     case flag_add:
+	start_brace ();
+	printf ("uae_u32 %s = ((%s)(%s)) + ((%s)(%s));\n", value, cast, dst, cast, src);
+	printf ("\tlazyflag_add%s (%s, %s, %s);\n", sfx, value, src, dst);
+	return 1;
+     case flag_sub:
+	start_brace ();
+	printf ("uae_u32 %s = ((%s)(%s)) - ((%s)(%s));\n", value, cast, dst, cast, src);
+	printf ("\tlazyflag_sub%s (%s, %s, %s);\n", sfx, value, src, dst);
+	return 1;
+     case flag_cmp:
+	start_brace ();
+	printf ("uae_u32 %s = ((%s)(%s)) - ((%s)(%s));\n", value, cast, dst, cast, src);
+	printf ("\tlazyflag_cmp%s (%s, %s, %s);\n", sfx, value, src, dst);
+	return 1;
+     default:
+	return 0;
+    }
+}
+
 static void genflags (flagtypes type, wordsizes size, char *value, char *src, char *dst)
 {
+    if (lazy_flags && genflags_lazy (type, size, value, src, dst))
+	return;
+
     /* Temporarily deleted 68k/ARM flag optimizations.  I'd prefer to have
        them in the appropriate m68k.h files and use just one copy of this
        code here.  The API can be changed if necessary.  */
@@ -1444,8 +1508,9 @@ static void gen_opcode (unsigned long int opcode)
 	genamode (curi->dmode, "dstreg", sz_long, "dst", 1, 0);
 	sync_m68k_pc ();
 	printf ("\tif (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto %s; } else {\n", endlabelstr);
-	printf ("\tuae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;\n");
-	printf ("\tuae_u16 rem = (uae_s32)dst %% (uae_s32)(uae_s16)src;\n");
+	/* 0x80000000 / -1 traps on most hosts, negate instead */
+	printf ("\tuae_s32 newv = (uae_s16)src == -1 ? (uae_s32)(0 - (uae_u32)dst) : (uae_s32)dst / (uae_s32)(uae_s16)src;\n");
+	printf ("\tuae_u16 rem = (uae_s16)src == -1 ? 0 : (uae_s32)dst %% (uae_s32)(uae_s16)src;\n");
 	printf ("\tif ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else\n\t{\n");
 	printf ("\tif (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;\n");
 	genflags (flag_logical, sz_word, "newv", "", "");
@@ -2275,54 +2340,19 @@ static void generate_includes (FILE * f)
 	fprintf (f, "#ifdef NOFLAGS\n");
 	fprintf (f, "# include \"noflags.h\"\n");
 	fprintf (f, "#endif\n");
+
+	/* Placement of the profiled hot handlers, written by scripts/hot_handlers.py */
+	fprintf (f, "#if defined(ARDUINO) && USE_HOT_HANDLERS\n");
+	fprintf (f, "# include \"cpuhot.h\"\n");
+	fprintf (f, "#endif\n");
 }
 
 static int postfix;
 
-static void generate_one_opcode (int rp)
+/* Register fields and code of one instruction, the inside of its handler */
+static void generate_opcode_body (long int opcode)
 {
     uae_u16 smsk, dmsk;
-    long int opcode = opcode_map[rp];
-    const char *opcode_str;
-
-    if (table68k[opcode].mnemo == i_ILLG
-	|| table68k[opcode].clev > (unsigned)cpu_level)
-	return;
-
-    if (table68k[opcode].handler != -1)
-	return;
-
-    opcode_str = get_instruction_string (opcode);
-
-    if (opcode_next_clev[rp] != cpu_level) {
-	if (table68k[opcode].flagdead == 0)
-	/* force to the "ff" variant since the instruction doesn't set at all the condition codes */
-	fprintf (stblfile, "{ CPUFUNC_FF(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
-		 opcode, opcode_str);
-	else
-	fprintf (stblfile, "{ CPUFUNC(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
-		 opcode, opcode_str);
-	return;
-    }
-	
-	if (table68k[opcode].flagdead == 0)
-	/* force to the "ff" variant since the instruction doesn't set at all the condition codes */
-    fprintf (stblfile, "{ CPUFUNC_FF(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, postfix, opcode, opcode_str);
-	else
-    fprintf (stblfile, "{ CPUFUNC(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, postfix, opcode, opcode_str);
-
-    fprintf (headerfile, "extern cpuop_func op_%lx_%d_nf;\n", opcode, postfix);
-    fprintf (headerfile, "extern cpuop_func op_%lx_%d_ff;\n", opcode, postfix);
-	
-	/* gb-- The "nf" variant for an instruction that doesn't set the condition
-	   codes at all is the same as the "ff" variant, so we don't need the "nf"
-	   variant to be compiled since it is mapped to the "ff" variant in the
-	   smalltbl. */
-	if (table68k[opcode].flagdead == 0)
-	printf ("#ifndef NOFLAGS\n");
-
-	printf ("void REGPARAM2 CPUFUNC(op_%lx_%d)(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, opcode_str);
-	printf ("\tcpuop_begin();\n");
 
     switch (table68k[opcode].stype) {
      case 0: smsk = 7; break;
@@ -2443,6 +2473,57 @@ static void generate_one_opcode (int rp)
     gen_opcode (opcode);
     if (need_endlabel)
 	printf ("%s: ;\n", endlabelstr);
+}
+
+static void generate_one_opcode (int rp)
+{
+    long int opcode = opcode_map[rp];
+    const char *opcode_str;
+
+    if (table68k[opcode].mnemo == i_ILLG
+	|| table68k[opcode].clev > (unsigned)cpu_level)
+	return;
+
+    if (table68k[opcode].handler != -1)
+	return;
+
+    opcode_str = get_instruction_string (opcode);
+
+    if (opcode_next_clev[rp] != cpu_level) {
+	if (postfix < 5)
+	    stbl_func[postfix][opcode] = (opcode << 3) | opcode_last_postfix[rp];
+	if (table68k[opcode].flagdead == 0)
+	/* force to the "ff" variant since the instruction doesn't set at all the condition codes */
+	fprintf (stblfile, "{ CPUFUNC_FF(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
+		 opcode, opcode_str);
+	else
+	fprintf (stblfile, "{ CPUFUNC(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
+		 opcode, opcode_str);
+	return;
+    }
+	
+	if (postfix < 5)
+	    stbl_func[postfix][opcode] = (opcode << 3) | postfix;
+	if (table68k[opcode].flagdead == 0)
+	/* force to the "ff" variant since the instruction doesn't set at all the condition codes */
+    fprintf (stblfile, "{ CPUFUNC_FF(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, postfix, opcode, opcode_str);
+	else
+    fprintf (stblfile, "{ CPUFUNC(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, postfix, opcode, opcode_str);
+
+    fprintf (headerfile, "extern cpuop_func op_%lx_%d_nf;\n", opcode, postfix);
+    fprintf (headerfile, "extern cpuop_func op_%lx_%d_ff;\n", opcode, postfix);
+	
+	/* gb-- The "nf" variant for an instruction that doesn't set the condition
+	   codes at all is the same as the "ff" variant, so we don't need the "nf"
+	   variant to be compiled since it is mapped to the "ff" variant in the
+	   smalltbl. */
+	if (table68k[opcode].flagdead == 0)
+	printf ("#ifndef NOFLAGS\n");
+
+	printf ("void REGPARAM2 CPUFUNC(op_%lx_%d)(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, opcode_str);
+	printf ("\tcpuop_begin();\n");
+
+    generate_opcode_body (opcode);
 	printf ("\tcpuop_end();\n");
     printf ("}\n");
 	if (table68k[opcode].flagdead == 0)
@@ -2451,6 +2532,127 @@ static void generate_one_opcode (int rp)
     opcode_last_postfix[rp] = postfix;
 }
 
+/*
+ * Fused handlers (USE_FUSION) for the instruction pairs listed in the --fuse
+ * file: an instruction that always falls through (see
+ * block_flags_straight_line() in blockcache.cpp) and the Bcc or DBcc after
+ * it, run in one dispatch. The block cache switches recorded pairs to them
+ * through op_fusedtbl_*. The second opcode word is read at regs.pc_p once
+ * the first instruction is done; if that raised a special flag the handler
+ * stops there, where the replay loop would have stopped too.
+ *
+ * Only the flag-setting versions are generated: the Bcc or DBcc reads the
+ * flags (DBRA aside, the liveness scan treats every branch as reading them
+ * all), so the first instruction of a pair never gets its no-flags twin and
+ * a NOFLAGS fused handler could not be reached.
+ */
+#define MAX_FUSED_PAIRS 64
+
+static int fused_first[MAX_FUSED_PAIRS];
+static int fused_second[MAX_FUSED_PAIRS];
+static int nr_fused_pairs;
+
+/* Handler pairs already generated for an earlier CPU level */
+static int fused_done[MAX_FUSED_PAIRS * 5][2];
+static int nr_fused_done;
+
+/* File format: "<first opcode> <second opcode> [count]" in hex, most
+ * frequent first, as written by basilisk_host --pair-profile */
+static void read_fused_pairs (const char *path)
+{
+    FILE *file = fopen (path, "r");
+    char line[256];
+    unsigned int first, second;
+
+    if (file == NULL) {
+	fprintf (stderr, "gencpu: cannot read %s\n", path);
+	exit (1);
+    }
+    while (fgets (line, sizeof line, file) != NULL && nr_fused_pairs < MAX_FUSED_PAIRS) {
+	if (line[0] == '#' || sscanf (line, "%x %x", &first, &second) != 2)
+	    continue;
+	if (first > 0xffff || second > 0xffff
+	    || table68k[first].mnemo == i_ILLG
+	    || (table68k[second].mnemo != i_Bcc && table68k[second].mnemo != i_DBcc)) {
+	    fprintf (stderr, "gencpu: ignoring pair %04x %04x, the second must be a Bcc or DBcc\n", first, second);
+	    continue;
+	}
+	fused_first[nr_fused_pairs] = first;
+	fused_second[nr_fused_pairs++] = second;
+    }
+    fclose (file);
+}
+
+/* Function (opcode << 3 | postfix) that handles opcode at the current level */
+static int level_func (int opcode)
+{
+    if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > (unsigned)cpu_level)
+	return -1;
+    if (table68k[opcode].handler != -1)
+	opcode = table68k[opcode].handler;
+    return stbl_func[postfix][opcode];
+}
+
+static const char *func_macro (int func)
+{
+    /* Same rule as the op_smalltbl entries */
+    return table68k[func >> 3].flagdead == 0 ? "CPUFUNC_FF" : "CPUFUNC";
+}
+
+static void generate_fused (void)
+{
+    int i, j;
+
+    fprintf (stblfile, "#ifndef NOFLAGS\n");
+    fprintf (stblfile, "struct cpufused CPUFUNC(op_fusedtbl_%d)[] = {\n", postfix);
+    printf ("#if defined(PART_8) && !defined(NOFLAGS)\n");
+    for (i = 0; i < nr_fused_pairs; i++) {
+	int first = level_func (fused_first[i]);
+	int second = level_func (fused_second[i]);
+	long int op1, op2;
+	char name[64], str1[100], str2[100];
+
+	if (first < 0 || second < 0)
+	    continue;
+	op1 = first >> 3;
+	op2 = second >> 3;
+	sprintf (name, "op_%lx_%d_%lx_%d", op1, first & 7, op2, second & 7);
+	/* get_instruction_string() returns a static buffer */
+	strcpy (str1, get_instruction_string (op1));
+	strcpy (str2, get_instruction_string (op2));
+	fprintf (stblfile, "{ %s(op_%lx_%d), %s(op_%lx_%d), %s(%s) }, /* %s + %s */\n",
+		 func_macro (first), op1, first & 7, func_macro (second), op2, second & 7,
+		 func_macro (first), name, str1, str2);
+
+	for (j = 0; j < nr_fused_done; j++) {
+	    if (fused_done[j][0] == first && fused_done[j][1] == second)
+		break;
+	}
+	if (j < nr_fused_done)
+	    continue;
+	fused_done[nr_fused_done][0] = first;
+	fused_done[nr_fused_done++][1] = second;
+
+	fprintf (headerfile, "extern cpuop_func %s_ff;\n", name);
+
+	printf ("void REGPARAM2 CPUFUNC(%s)(uae_u32 opcode) /* %s + %s */\n{\n", name, str1, str2);
+	printf ("\tcpuop_begin();\n");
+	printf ("\t{\n");
+	generate_opcode_body (op1);
+	printf ("\t}\n");
+	printf ("\tif (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))\n\t\treturn;\n");
+	printf ("\t{\n");
+	printf ("\tuae_u32 opcode = GET_OPCODE;\n");
+	generate_opcode_body (op2);
+	printf ("\t}\n");
+	printf ("\tcpuop_end();\n");
+	printf ("}\n");
+    }
+    printf ("#endif\n\n");
+    fprintf (stblfile, "{ 0, 0, 0 }};\n");
+    fprintf (stblfile, "#endif\n");
+}
+
 static void generate_func (void)
 {
     int i, j, rp;
@@ -2508,20 +2710,145 @@ static void generate_func (void)
 	}
 
 	fprintf (stblfile, "{ 0, 0, 0 }};\n");
+
+	generate_fused ();
     }
 }
 
+/*
+ * Compact dispatch tables (cpudispatch.cpp). For every CPU level this is the
+ * opcode -> handler mapping build_cpufunctbl() makes from op_smalltbl_*, as
+ * 64-entry pages of 16-bit handler indices (opcode >> 6 picks the page) with
+ * identical pages stored once. Assumes cft_map() is the identity, i.e. no
+ * HAVE_GET_WORD_UNSWAPPED.
+ */
+#define DISPATCH_PAGE_BITS 6
+#define DISPATCH_PAGE_SIZE (1 << DISPATCH_PAGE_BITS)
+#define DISPATCH_PAGES (65536 >> DISPATCH_PAGE_BITS)
+
+static void generate_dispatch (FILE *f)
+{
+    int *func = (int *) malloc (65536 * sizeof (int));
+    int *handler_of_func = (int *) malloc ((65536 << 3) * sizeof (int));
+    int *handlers = (int *) malloc (65536 * sizeof (int));
+    unsigned short *slot = (unsigned short *) malloc (65536 * sizeof (unsigned short));
+    unsigned short *pages = (unsigned short *) malloc (65536 * sizeof (unsigned short));
+    unsigned short page_index[DISPATCH_PAGES];
+    int level, opcode, i, j;
+
+    fprintf (f, "#include \"sysdeps.h\"\n");
+    fprintf (f, "#include \"m68k.h\"\n");
+    fprintf (f, "#include \"memory.h\"\n");
+    fprintf (f, "#include \"readcpu.h\"\n");
+    fprintf (f, "#include \"newcpu.h\"\n");
+    fprintf (f, "#include \"cputbl.h\"\n");
+    fprintf (f, "#if USE_COMPACT_DISPATCH\n");
+    fprintf (f, "extern cpuop_func op_illg_1;\n");
+
+    for (level = 0; level < 5; level++) {
+	int cpu_level = 4 - level;
+	int nhandlers = 1, npages = 0;
+
+	/* Same steps as build_cpufunctbl() */
+	for (opcode = 0; opcode < 65536; opcode++)
+	    func[opcode] = stbl_func[level][opcode];
+	for (opcode = 0; opcode < 65536; opcode++) {
+	    if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > (unsigned)cpu_level)
+		continue;
+	    if (table68k[opcode].handler != -1) {
+		func[opcode] = func[table68k[opcode].handler];
+		if (func[opcode] < 0)
+		    abort ();
+	    }
+	}
+
+	/* Handler 0 is op_illg_1, the rest in order of first use */
+	memset (handler_of_func, 0, (65536 << 3) * sizeof (int));
+	for (opcode = 0; opcode < 65536; opcode++) {
+	    if (func[opcode] < 0) {
+		slot[opcode] = 0;
+		continue;
+	    }
+	    if (handler_of_func[func[opcode]] == 0) {
+		handlers[nhandlers] = func[opcode];
+		handler_of_func[func[opcode]] = nhandlers++;
+	    }
+	    slot[opcode] = handler_of_func[func[opcode]];
+	}
+
+	for (i = 0; i < DISPATCH_PAGES; i++) {
+	    unsigned short *page = slot + (i << DISPATCH_PAGE_BITS);
+	    for (j = 0; j < npages; j++) {
+		if (memcmp (pages + (j << DISPATCH_PAGE_BITS), page, DISPATCH_PAGE_SIZE * sizeof (unsigned short)) == 0)
+		    break;
+	    }
+	    if (j == npages)
+		memcpy (pages + (npages++ << DISPATCH_PAGE_BITS), page, DISPATCH_PAGE_SIZE * sizeof (unsigned short));
+	    page_index[i] = j;
+	}
+
+	fprintf (f, "\n/* CPU level %d: %d handlers, %d pages */\n", cpu_level, nhandlers, npages);
+	fprintf (f, "static cpuop_func *const op_dispatch_handlers_%d[] = {\n", level);
+	fprintf (f, "op_illg_1,\n");
+	for (i = 1; i < nhandlers; i++)
+	    fprintf (f, "op_%x_%d_ff,\n", handlers[i] >> 3, handlers[i] & 7);
+	fprintf (f, "};\n");
+
+	fprintf (f, "static const uae_u16 op_dispatch_pages_%d[] = {\n", level);
+	for (i = 0; i < npages << DISPATCH_PAGE_BITS; i++)
+	    fprintf (f, "%d,%s", pages[i], (i & 15) == 15 ? "\n" : "");
+	fprintf (f, "};\n");
+
+	fprintf (f, "static const uae_u16 op_dispatch_index_%d[] = {\n", level);
+	for (i = 0; i < DISPATCH_PAGES; i++)
+	    fprintf (f, "%d,%s", page_index[i], (i & 15) == 15 ? "\n" : "");
+	fprintf (f, "};\n");
+
+	fprintf (f, "const struct cpudispatch_tbl op_dispatch_%d = {\n", level);
+	fprintf (f, "\top_dispatch_handlers_%d, op_dispatch_pages_%d, op_dispatch_index_%d, %d, %d\n",
+		 level, level, level, nhandlers, npages);
+	fprintf (f, "};\n");
+    }
+    fprintf (f, "#endif\n");
+
+    free (func);
+    free (handler_of_func);
+    free (handlers);
+    free (slot);
+    free (pages);
+}
+
 int main (int argc, char **argv)
 {
-    FILE *out;
+    FILE *out, *dispatchfile;
+    const char *fuse_path = NULL;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+	if (strcmp (argv[i], "--lazy-flags") == 0)
+	    lazy_flags = 1;
+	else if (strcmp (argv[i], "--fuse") == 0 && i + 1 < argc)
+	    fuse_path = argv[++i];
+	else {
+	    fprintf (stderr, "usage: %s [--lazy-flags] [--fuse pairs.txt]\n", argv[0]);
+	    return 1;
+	}
+    }
+
     read_table68k ();
     do_merges ();
+    if (fuse_path != NULL)
+	read_fused_pairs (fuse_path);
 
     opcode_map = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     opcode_last_postfix = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     opcode_next_clev = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     counts = (unsigned long *) malloc (65536 * sizeof (unsigned long));
     read_counts ();
+    for (i = 0; i < 5; i++) {
+	stbl_func[i] = (int *) malloc (65536 * sizeof (int));
+	memset (stbl_func[i], -1, 65536 * sizeof (int));
+    }
 
     /* It would be a lot nicer to put all in one file (we'd also get rid of
      * cputbl.h that way), but cpuopti can't cope.  That could be fixed, but
@@ -2536,6 +2863,10 @@ int main (int argc, char **argv)
 
     generate_func ();
 
+    dispatchfile = fopen ("cpudispatch.cpp", "w");
+    generate_dispatch (dispatchfile);
+    fclose (dispatchfile);
+
     free (table68k);
     fclose (headerfile);
     fclose (stblfile);
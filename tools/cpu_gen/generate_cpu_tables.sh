@@ -30,11 +30,13 @@ echo "Step 3: Compiling gencpu..."
 cc -I. -I"$OUTPUT_DIR" -o gencpu gencpu.c readcpu.cpp "$OUTPUT_DIR/cpudefs.cpp" -lstdc++
 echo "  Done."
 
-# Step 4: Generate CPU emulation files
+# Step 4: Generate CPU emulation files (condition codes evaluated lazily,
+# see LAZY_FLAGS in uae_cpu/m68k.h; fused handlers for the pairs in
+# fused_pairs.txt, see USE_FUSION in uae_cpu/blockcache.h)
 echo ""
 echo "Step 4: Generating CPU emulation files..."
 cd "$OUTPUT_DIR"
-"$SCRIPT_DIR/gencpu"
+"$SCRIPT_DIR/gencpu" --lazy-flags --fuse "$SCRIPT_DIR/fused_pairs.txt"
 echo "  Done."
 
 # Step 5: Add ESP32 PSRAM attributes to large tables